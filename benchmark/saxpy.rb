@@ -0,0 +1,36 @@
+# saxpy and dot product over arrays of Floats
+
+N = 100000
+ITER = 200
+
+def saxpy(n, a, x, y)
+  n.times do |i|
+    y[i] = a * x[i] + y[i]
+  end
+end
+
+def scale(n, a, x, y)
+  n.times do |i|
+    y[i] = x[i] * a
+  end
+end
+
+def dot(n, x, y)
+  s = 0.0
+  n.times do |i|
+    s = s + x[i] * y[i]
+  end
+  s
+end
+
+x = Array.new(N)
+y = Array.new(N)
+N.times do |i|
+  x[i] = (i % 100) * 0.01
+  y[i] = 1.0
+end
+ITER.times do
+  saxpy(N, 0.5, x, y)
+  scale(N, 0.5, y, y)
+end
+puts dot(N, x, y)
@@ -0,0 +1,89 @@
+/*
+ * This file contains a list of all
+ * initializing methods which are
+ * necessary to bootstrap all gems.
+ *
+ * IMPORTANT:
+ *   This file was generated!
+ *   All manual changes will get lost.
+ */
+
+#include "mruby.h"
+
+void GENERATED_TMP_mrb_mruby_sprintf_gem_init(mrb_state* mrb);
+void GENERATED_TMP_mrb_mruby_print_gem_init(mrb_state* mrb);
+void GENERATED_TMP_mrb_mruby_math_gem_init(mrb_state* mrb);
+void GENERATED_TMP_mrb_mruby_time_gem_init(mrb_state* mrb);
+void GENERATED_TMP_mrb_mruby_struct_gem_init(mrb_state* mrb);
+void GENERATED_TMP_mrb_mruby_enum_ext_gem_init(mrb_state* mrb);
+void GENERATED_TMP_mrb_mruby_string_ext_gem_init(mrb_state* mrb);
+void GENERATED_TMP_mrb_mruby_numeric_ext_gem_init(mrb_state* mrb);
+void GENERATED_TMP_mrb_mruby_array_ext_gem_init(mrb_state* mrb);
+void GENERATED_TMP_mrb_mruby_hash_ext_gem_init(mrb_state* mrb);
+void GENERATED_TMP_mrb_mruby_range_ext_gem_init(mrb_state* mrb);
+void GENERATED_TMP_mrb_mruby_proc_ext_gem_init(mrb_state* mrb);
+void GENERATED_TMP_mrb_mruby_random_gem_init(mrb_state* mrb);
+void GENERATED_TMP_mrb_mruby_numeric_array_gem_init(mrb_state* mrb);
+void GENERATED_TMP_mrb_mruby_bin_mirb_gem_init(mrb_state* mrb);
+void GENERATED_TMP_mrb_mruby_bin_mruby_gem_init(mrb_state* mrb);
+void GENERATED_TMP_mrb_mruby_bin_hpcmrb_gem_init(mrb_state* mrb);
+
+void GENERATED_TMP_mrb_mruby_sprintf_gem_final(mrb_state* mrb);
+void GENERATED_TMP_mrb_mruby_print_gem_final(mrb_state* mrb);
+void GENERATED_TMP_mrb_mruby_math_gem_final(mrb_state* mrb);
+void GENERATED_TMP_mrb_mruby_time_gem_final(mrb_state* mrb);
+void GENERATED_TMP_mrb_mruby_struct_gem_final(mrb_state* mrb);
+void GENERATED_TMP_mrb_mruby_enum_ext_gem_final(mrb_state* mrb);
+void GENERATED_TMP_mrb_mruby_string_ext_gem_final(mrb_state* mrb);
+void GENERATED_TMP_mrb_mruby_numeric_ext_gem_final(mrb_state* mrb);
+void GENERATED_TMP_mrb_mruby_array_ext_gem_final(mrb_state* mrb);
+void GENERATED_TMP_mrb_mruby_hash_ext_gem_final(mrb_state* mrb);
+void GENERATED_TMP_mrb_mruby_range_ext_gem_final(mrb_state* mrb);
+void GENERATED_TMP_mrb_mruby_proc_ext_gem_final(mrb_state* mrb);
+void GENERATED_TMP_mrb_mruby_random_gem_final(mrb_state* mrb);
+void GENERATED_TMP_mrb_mruby_numeric_array_gem_final(mrb_state* mrb);
+void GENERATED_TMP_mrb_mruby_bin_mirb_gem_final(mrb_state* mrb);
+void GENERATED_TMP_mrb_mruby_bin_mruby_gem_final(mrb_state* mrb);
+void GENERATED_TMP_mrb_mruby_bin_hpcmrb_gem_final(mrb_state* mrb);
+
+void
+mrb_init_mrbgems(mrb_state *mrb) {
+GENERATED_TMP_mrb_mruby_sprintf_gem_init(mrb);
+GENERATED_TMP_mrb_mruby_print_gem_init(mrb);
+GENERATED_TMP_mrb_mruby_math_gem_init(mrb);
+GENERATED_TMP_mrb_mruby_time_gem_init(mrb);
+GENERATED_TMP_mrb_mruby_struct_gem_init(mrb);
+GENERATED_TMP_mrb_mruby_enum_ext_gem_init(mrb);
+GENERATED_TMP_mrb_mruby_string_ext_gem_init(mrb);
+GENERATED_TMP_mrb_mruby_numeric_ext_gem_init(mrb);
+GENERATED_TMP_mrb_mruby_array_ext_gem_init(mrb);
+GENERATED_TMP_mrb_mruby_hash_ext_gem_init(mrb);
+GENERATED_TMP_mrb_mruby_range_ext_gem_init(mrb);
+GENERATED_TMP_mrb_mruby_proc_ext_gem_init(mrb);
+GENERATED_TMP_mrb_mruby_random_gem_init(mrb);
+GENERATED_TMP_mrb_mruby_numeric_array_gem_init(mrb);
+GENERATED_TMP_mrb_mruby_bin_mirb_gem_init(mrb);
+GENERATED_TMP_mrb_mruby_bin_mruby_gem_init(mrb);
+GENERATED_TMP_mrb_mruby_bin_hpcmrb_gem_init(mrb);
+}
+
+void
+mrb_final_mrbgems(mrb_state *mrb) {
+GENERATED_TMP_mrb_mruby_sprintf_gem_final(mrb);
+GENERATED_TMP_mrb_mruby_print_gem_final(mrb);
+GENERATED_TMP_mrb_mruby_math_gem_final(mrb);
+GENERATED_TMP_mrb_mruby_time_gem_final(mrb);
+GENERATED_TMP_mrb_mruby_struct_gem_final(mrb);
+GENERATED_TMP_mrb_mruby_enum_ext_gem_final(mrb);
+GENERATED_TMP_mrb_mruby_string_ext_gem_final(mrb);
+GENERATED_TMP_mrb_mruby_numeric_ext_gem_final(mrb);
+GENERATED_TMP_mrb_mruby_array_ext_gem_final(mrb);
+GENERATED_TMP_mrb_mruby_hash_ext_gem_final(mrb);
+GENERATED_TMP_mrb_mruby_range_ext_gem_final(mrb);
+GENERATED_TMP_mrb_mruby_proc_ext_gem_final(mrb);
+GENERATED_TMP_mrb_mruby_random_gem_final(mrb);
+GENERATED_TMP_mrb_mruby_numeric_array_gem_final(mrb);
+GENERATED_TMP_mrb_mruby_bin_mirb_gem_final(mrb);
+GENERATED_TMP_mrb_mruby_bin_mruby_gem_final(mrb);
+GENERATED_TMP_mrb_mruby_bin_hpcmrb_gem_final(mrb);
+}
@@ -0,0 +1,5 @@
+/* generated by mrbgem.rake */
+#define HPCMRB_CC "gcc", 
+#define HPCMRB_CFLAGS "-I/root/repo/include", "-I/root/repo/mrbgems/mruby-sprintf/include", "-I/root/repo/mrbgems/mruby-print/include", "-I/root/repo/mrbgems/mruby-math/include", "-I/root/repo/mrbgems/mruby-time/include", "-I/root/repo/mrbgems/mruby-struct/include", "-I/root/repo/mrbgems/mruby-enum-ext/include", "-I/root/repo/mrbgems/mruby-string-ext/include", "-I/root/repo/mrbgems/mruby-numeric-ext/include", "-I/root/repo/mrbgems/mruby-array-ext/include", "-I/root/repo/mrbgems/mruby-hash-ext/include", "-I/root/repo/mrbgems/mruby-range-ext/include", "-I/root/repo/mrbgems/mruby-proc-ext/include", "-I/root/repo/mrbgems/mruby-random/include", "-I/root/repo/mrbgems/mruby-numeric-array/include", "-I/root/repo/mrbgems/mruby-bin-mirb/include", "-I/root/repo/mrbgems/mruby-bin-mruby/include", "-I/root/repo/mrbgems/mruby-bin-hpcmrb/include", 
+#define HPCMRB_RUNTIME_DIR "/root/repo/mrbgems/mruby-bin-hpcmrb/tools/hpcmrb"
+#define HPCMRB_LIBS "/root/repo/build/host/lib/libmruby.a", "-lm", 
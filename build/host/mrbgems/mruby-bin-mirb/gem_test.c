@@ -0,0 +1,317 @@
+/*
+ * This file is loading the irep
+ * Ruby GEM code.
+ *
+ * IMPORTANT:
+ *   This file was generated!
+ *   All manual changes will get lost.
+ */
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/irep.h"
+#include "mruby/dump.h"
+#include "mruby/string.h"
+#include "mruby/proc.h"
+#include "mruby/variable.h"
+#include "mruby/array.h"
+#include "mruby/hash.h"
+#include <stdint.h>
+const uint8_t gem_test_irep_mruby_bin_mirb_preload[] = {
+0x52,0x49,0x54,0x45,0x30,0x30,0x30,0x31,0x98,0x0f,0x00,0x00,0x12,0x69,0x4d,0x41,
+0x54,0x5a,0x30,0x30,0x30,0x30,0x49,0x52,0x45,0x50,0x00,0x00,0x12,0x4b,0x30,0x30,
+0x30,0x30,0x00,0x12,0x00,0x00,0x00,0x00,0x02,0x0a,0x00,0x01,0x00,0x03,0x00,0x00,
+0x00,0x36,0x00,0xbf,0xff,0x83,0x00,0x80,0x00,0x0a,0x00,0xbf,0xff,0x83,0x00,0x80,
+0x00,0x8a,0x00,0xbf,0xff,0x83,0x00,0x80,0x01,0x0a,0x00,0x80,0x40,0x37,0x00,0x80,
+0x01,0x8a,0x00,0x80,0x02,0x11,0x01,0x00,0x03,0x04,0x00,0x81,0x40,0xa0,0x00,0xc0,
+0x01,0x99,0x00,0x80,0x03,0x11,0x00,0x81,0xc0,0x20,0x00,0x80,0x04,0x0a,0x00,0x80,
+0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x82,0x40,0x46,0x00,0x80,0x00,0x48,0x01,0x00,
+0x06,0xc0,0x00,0x82,0x80,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x0a,0xc0,0x00,0x82,
+0xc0,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x0c,0xc0,0x00,0x83,0x00,0x46,0x00,0x80,
+0x00,0x48,0x01,0x00,0x0e,0xc0,0x00,0x83,0x40,0x46,0x00,0x80,0x00,0x48,0x01,0x00,
+0x10,0xc0,0x00,0x83,0x80,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x12,0xc0,0x00,0x83,
+0xc0,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x14,0xc0,0x00,0x84,0x00,0x46,0x00,0x80,
+0x00,0x48,0x01,0x00,0x18,0xc0,0x00,0x84,0x40,0x46,0x00,0x80,0x00,0x48,0x01,0x00,
+0x1c,0xc0,0x00,0x84,0x80,0x46,0x00,0x80,0x00,0x05,0x01,0x00,0x09,0x91,0x00,0x85,
+0x00,0x43,0x00,0x80,0x07,0xc5,0x00,0x80,0x00,0x48,0x01,0x00,0x22,0xc0,0x00,0x85,
+0x40,0x46,0x00,0x80,0x00,0x05,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x16,0x00,0x08,0x24,0x6f,0x6b,0x5f,0x74,0x65,0x73,0x74,0x00,0x00,0x08,0x24,
+0x6b,0x6f,0x5f,0x74,0x65,0x73,0x74,0x00,0x00,0x0a,0x24,0x6b,0x69,0x6c,0x6c,0x5f,
+0x74,0x65,0x73,0x74,0x00,0x00,0x08,0x24,0x61,0x73,0x73,0x65,0x72,0x74,0x73,0x00,
+0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x0e,0x63,0x6f,0x6e,0x73,0x74,
+0x5f,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x3f,0x00,0x00,0x04,0x54,0x69,0x6d,0x65,
+0x00,0x00,0x03,0x6e,0x6f,0x77,0x00,0x00,0x0b,0x24,0x74,0x65,0x73,0x74,0x5f,0x73,
+0x74,0x61,0x72,0x74,0x00,0x00,0x10,0x61,0x73,0x73,0x65,0x72,0x74,0x69,0x6f,0x6e,
+0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x06,0x61,0x73,0x73,0x65,0x72,0x74,
+0x00,0x00,0x0e,0x61,0x73,0x73,0x65,0x72,0x74,0x69,0x6f,0x6e,0x5f,0x64,0x69,0x66,
+0x66,0x00,0x00,0x0b,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x74,0x72,0x75,0x65,0x00,
+0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,
+0x0a,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x6e,0x69,0x6c,0x00,0x00,0x0e,0x61,0x73,
+0x73,0x65,0x72,0x74,0x5f,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x00,0x00,0x0c,0x61,
+0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x06,0x72,0x65,
+0x70,0x6f,0x72,0x74,0x00,0x00,0x0b,0x63,0x68,0x65,0x63,0x6b,0x5f,0x66,0x6c,0x6f,
+0x61,0x74,0x00,0x00,0x13,0x4e,0x6f,0x74,0x49,0x6d,0x70,0x6c,0x65,0x6d,0x65,0x6e,
+0x74,0x65,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x0d,0x4d,0x52,0x75,0x62,0x79,
+0x54,0x65,0x73,0x74,0x53,0x6b,0x69,0x70,0x00,0x00,0x04,0x73,0x6b,0x69,0x70,0x00,
+0x00,0x00,0x01,0x7c,0x00,0x07,0x00,0x0a,0x00,0x00,0x00,0x3a,0x04,0x20,0x00,0x26,
+0x00,0x40,0x01,0x17,0x00,0x40,0x01,0x17,0x00,0x40,0x01,0x17,0x01,0x80,0x00,0x05,
+0x02,0x00,0x00,0x05,0x03,0x80,0x00,0x3d,0x04,0x00,0x40,0x01,0x03,0x82,0x00,0x3e,
+0x04,0x00,0x80,0x01,0x03,0x82,0x00,0x3e,0x03,0x01,0xc0,0x01,0x03,0x80,0xc0,0x01,
+0x03,0xc0,0x01,0x99,0x03,0x80,0xc0,0x01,0x04,0x00,0x00,0x3d,0x03,0x80,0x00,0xa0,
+0x03,0xc0,0x04,0x19,0x03,0x81,0x80,0x01,0x04,0x00,0x00,0xbd,0x04,0x80,0xc0,0x01,
+0x04,0x02,0x40,0x3e,0x04,0x80,0x01,0x3d,0x04,0x02,0x40,0x3e,0x03,0x80,0x40,0xac,
+0x03,0x01,0xc0,0x01,0x03,0x81,0x00,0x01,0x03,0xc0,0x03,0x99,0x03,0x81,0x80,0x01,
+0x04,0x00,0x01,0xbd,0x04,0x81,0x00,0x01,0x04,0x80,0x80,0x20,0x04,0x02,0x40,0x3e,
+0x03,0x80,0x40,0xac,0x03,0x01,0xc0,0x01,0x03,0x80,0x01,0x91,0x04,0x00,0x02,0x84,
+0x03,0x81,0x00,0xa0,0x03,0xc0,0x04,0x19,0x03,0x81,0x80,0x01,0x04,0x00,0x02,0x3d,
+0x04,0x80,0x02,0x91,0x04,0x02,0x40,0x3e,0x04,0x80,0x02,0xbd,0x04,0x02,0x40,0x3e,
+0x03,0x80,0x40,0xac,0x03,0x01,0xc0,0x01,0x03,0x80,0x03,0x09,0x03,0xc0,0x02,0x19,
+0x03,0x80,0x03,0x09,0x03,0x81,0xc0,0x20,0x04,0x3f,0xff,0x83,0x03,0x82,0x00,0xb5,
+0x03,0xc0,0x01,0x99,0x03,0x80,0x03,0x09,0x04,0x00,0x03,0x40,0x03,0x82,0x40,0x21,
+0x03,0x00,0x00,0x29,0x00,0x00,0x00,0x06,0x10,0x00,0x00,0x10,0x00,0x02,0x20,0x5b,
+0x10,0x00,0x01,0x5d,0x10,0x00,0x04,0x20,0x3d,0x3e,0x20,0x10,0x00,0x0b,0x20,0x28,
+0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x3a,0x20,0x10,0x00,0x01,0x29,0x00,0x00,0x00,
+0x0a,0x00,0x02,0x21,0x3d,0x00,0x00,0x01,0x2b,0x00,0x00,0x07,0x6d,0x65,0x73,0x73,
+0x61,0x67,0x65,0x00,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x0e,0x63,
+0x6f,0x6e,0x73,0x74,0x5f,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x3f,0x00,0x00,0x07,
+0x47,0x45,0x4d,0x4e,0x41,0x4d,0x45,0x00,0x00,0x0f,0x24,0x6d,0x72,0x62,0x74,0x65,
+0x73,0x74,0x5f,0x61,0x73,0x73,0x65,0x72,0x74,0x00,0x00,0x04,0x73,0x69,0x7a,0x65,
+0x00,0x00,0x01,0x3e,0x00,0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x00,0x00,0x7d,
+0x00,0x05,0x00,0x08,0x00,0x00,0x00,0x10,0x06,0x00,0x00,0x26,0x02,0x81,0x80,0x15,
+0x03,0x00,0x00,0x3d,0x03,0x80,0x40,0x01,0x03,0x01,0xc0,0x3e,0x03,0x80,0x00,0xbd,
+0x03,0x01,0xc0,0x3e,0x03,0x80,0x80,0x01,0x03,0x01,0xc0,0x3e,0x03,0x80,0x01,0x3d,
+0x03,0x01,0xc0,0x3e,0x03,0x80,0xc0,0x01,0x03,0x01,0xc0,0x3e,0x02,0x80,0x00,0xac,
+0x02,0x81,0x80,0x16,0x02,0x80,0x00,0x29,0x00,0x00,0x00,0x04,0x10,0x00,0x0e,0x0a,
+0x20,0x2d,0x20,0x41,0x73,0x73,0x65,0x72,0x74,0x69,0x6f,0x6e,0x5b,0x10,0x00,0x0a,
+0x5d,0x20,0x46,0x61,0x69,0x6c,0x65,0x64,0x3a,0x20,0x10,0x00,0x01,0x0a,0x10,0x00,
+0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x2b,0x00,0x00,0x00,0x03,0x29,0x00,0x05,0x00,
+0x0b,0x00,0x00,0x00,0x75,0x00,0x20,0x00,0x26,0x00,0x40,0x01,0x17,0x00,0x40,0x01,
+0x17,0x00,0x40,0x01,0x17,0x00,0x80,0x00,0x3d,0x01,0x00,0x00,0xbd,0x02,0x80,0x00,
+0x09,0x02,0xc0,0x07,0x99,0x02,0x80,0x00,0x06,0x03,0x00,0x40,0x01,0x03,0x80,0x80,
+0x01,0x04,0x00,0x00,0xbd,0x03,0x80,0x80,0xa0,0x03,0xc0,0x03,0x19,0x03,0x80,0x01,
+0x3d,0x04,0x00,0x80,0x01,0x03,0x82,0x00,0x3e,0x04,0x00,0x01,0xbd,0x03,0x82,0x00,
+0x3e,0x00,0x40,0x00,0x97,0x03,0x80,0x00,0xbd,0x04,0x00,0x02,0x3d,0x02,0x80,0x41,
+0xa0,0x00,0x00,0x00,0x9e,0x00,0x40,0x11,0x9a,0x02,0x81,0x40,0x37,0x02,0x80,0x01,
+0x8a,0x02,0xbf,0xff,0x83,0x02,0x80,0x02,0x0a,0x02,0x84,0x00,0x2b,0x02,0x81,0x40,
+0x20,0x02,0x81,0x80,0x20,0x02,0xc0,0x02,0x18,0x02,0x80,0x01,0x89,0x02,0x81,0xc0,
+0x20,0x03,0x3f,0xff,0x83,0x02,0x82,0x00,0xb5,0x02,0xc0,0x07,0x99,0x02,0x80,0x04,
+0x89,0x03,0x00,0x00,0x06,0x03,0x80,0x02,0xbd,0x04,0x00,0x40,0x01,0x04,0x80,0x80,
+0x01,0x05,0x00,0x00,0x05,0x03,0x02,0xc2,0x20,0x02,0x82,0x80,0xa0,0x02,0x80,0x06,
+0x09,0x02,0x83,0x40,0xad,0x02,0x80,0x06,0x0a,0x02,0x80,0x00,0x06,0x03,0x00,0x03,
+0x3d,0x02,0x80,0x40,0xa0,0x00,0x40,0x03,0x17,0x02,0x80,0x07,0x09,0x02,0x83,0x40,
+0xad,0x02,0x80,0x07,0x0a,0x02,0x80,0x00,0x06,0x03,0x00,0x03,0xbd,0x02,0x80,0x40,
+0xa0,0x00,0x40,0x17,0x97,0x02,0x80,0x00,0x1b,0x03,0x00,0x07,0x91,0x03,0x81,0x40,
+0x01,0x03,0x04,0x00,0xa0,0x03,0x40,0x00,0x98,0x00,0x40,0x14,0x17,0x02,0x01,0x40,
+0x01,0x02,0x81,0x00,0x01,0x02,0x84,0x40,0x20,0x02,0x84,0x80,0x20,0x03,0x00,0x04,
+0x3d,0x02,0x84,0xc0,0xb2,0x02,0xc0,0x09,0x19,0x02,0x80,0x04,0x89,0x03,0x00,0x04,
+0xbd,0x03,0x80,0x40,0x01,0x03,0x01,0xc0,0x3e,0x03,0x80,0x05,0x3d,0x03,0x01,0xc0,
+0x3e,0x03,0x80,0x80,0x01,0x03,0x01,0xc0,0x3e,0x03,0x80,0x05,0x3d,0x03,0x01,0xc0,
+0x3e,0x03,0x81,0x00,0x01,0x03,0x85,0x00,0x20,0x03,0x01,0xc0,0x3e,0x02,0x82,0x80,
+0xa0,0x02,0x80,0x00,0x06,0x03,0x00,0x05,0xbd,0x02,0x80,0x40,0xa0,0x00,0x40,0x07,
+0x17,0x02,0x80,0x04,0x89,0x03,0x00,0x00,0x06,0x03,0x80,0x06,0x3d,0x04,0x00,0x40,
+0x01,0x04,0x80,0x80,0x01,0x05,0x01,0x00,0x01,0x03,0x02,0xc2,0x20,0x02,0x82,0x80,
+0xa0,0x02,0x80,0x0a,0x89,0x02,0x83,0x40,0xad,0x02,0x80,0x0a,0x8a,0x02,0x80,0x00,
+0x06,0x03,0x00,0x06,0xbd,0x02,0x80,0x40,0xa0,0x00,0x40,0x01,0x17,0x02,0x80,0x00,
+0x1d,0x00,0x80,0x00,0x1c,0x00,0x80,0x00,0x1f,0x02,0x80,0x00,0x09,0x02,0xc0,0x02,
+0x19,0x02,0x80,0x00,0x06,0x03,0x00,0x07,0x3d,0x02,0x80,0x40,0xa0,0x00,0x40,0x00,
+0x97,0x02,0x80,0x00,0x05,0x02,0x80,0x00,0x29,0x00,0x00,0x00,0x0f,0x10,0x00,0x10,
+0x41,0x73,0x73,0x65,0x72,0x74,0x69,0x6f,0x6e,0x20,0x66,0x61,0x69,0x6c,0x65,0x64,
+0x10,0x00,0x00,0x10,0x00,0x02,0x20,0x5b,0x10,0x00,0x01,0x5d,0x10,0x00,0x03,0x20,
+0x3a,0x20,0x10,0x00,0x06,0x46,0x61,0x69,0x6c,0x3a,0x20,0x10,0x00,0x01,0x46,0x10,
+0x00,0x01,0x2e,0x10,0x00,0x0d,0x4d,0x52,0x75,0x62,0x79,0x54,0x65,0x73,0x74,0x53,
+0x6b,0x69,0x70,0x10,0x00,0x06,0x53,0x6b,0x69,0x70,0x3a,0x20,0x10,0x00,0x01,0x20,
+0x10,0x00,0x01,0x3f,0x10,0x00,0x07,0x45,0x72,0x72,0x6f,0x72,0x3a,0x20,0x10,0x00,
+0x01,0x58,0x10,0x00,0x01,0x0a,0x00,0x00,0x00,0x16,0x00,0x10,0x24,0x6d,0x72,0x62,
+0x74,0x65,0x73,0x74,0x5f,0x76,0x65,0x72,0x62,0x6f,0x73,0x65,0x00,0x00,0x05,0x70,
+0x72,0x69,0x6e,0x74,0x00,0x00,0x02,0x21,0x3d,0x00,0x00,0x0f,0x24,0x6d,0x72,0x62,
+0x74,0x65,0x73,0x74,0x5f,0x61,0x73,0x73,0x65,0x72,0x74,0x00,0x00,0x13,0x24,0x6d,
+0x72,0x62,0x74,0x65,0x73,0x74,0x5f,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x69,0x64,
+0x78,0x00,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x01,0x21,0x00,0x00,0x04,0x73,
+0x69,0x7a,0x65,0x00,0x00,0x01,0x3e,0x00,0x00,0x08,0x24,0x61,0x73,0x73,0x65,0x72,
+0x74,0x73,0x00,0x00,0x04,0x70,0x75,0x73,0x68,0x00,0x00,0x10,0x61,0x73,0x73,0x65,
+0x72,0x74,0x69,0x6f,0x6e,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x08,0x24,
+0x6b,0x6f,0x5f,0x74,0x65,0x73,0x74,0x00,0x00,0x01,0x2b,0x00,0x00,0x08,0x24,0x6f,
+0x6b,0x5f,0x74,0x65,0x73,0x74,0x00,0x00,0x09,0x45,0x78,0x63,0x65,0x70,0x74,0x69,
+0x6f,0x6e,0x00,0x00,0x03,0x3d,0x3d,0x3d,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,
+0x00,0x00,0x04,0x74,0x6f,0x5f,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x63,
+0x61,0x75,0x73,0x65,0x00,0x00,0x0a,0x24,0x6b,0x69,0x6c,0x6c,0x5f,0x74,0x65,0x73,
+0x74,0x00,0x00,0x00,0x00,0x32,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x03,0x00,0x80,
+0x00,0x05,0x00,0x80,0x00,0x0a,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x01,0x00,0x0f,0x24,0x6d,0x72,0x62,0x74,0x65,0x73,0x74,0x5f,0x61,0x73,0x73,
+0x65,0x72,0x74,0x00,0x00,0x00,0x00,0x7f,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x0d,
+0x04,0x00,0x00,0x26,0x02,0x00,0x00,0x3d,0x02,0x80,0x40,0x01,0x02,0x80,0x00,0x20,
+0x02,0x01,0x40,0x3e,0x02,0x80,0x00,0xbd,0x02,0x01,0x40,0x3e,0x02,0x80,0x01,0x3d,
+0x03,0x00,0x80,0x01,0x03,0x00,0x00,0x20,0x02,0x81,0x80,0x3e,0x02,0x00,0x40,0xac,
+0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x04,0x10,0x00,0x0e,0x20,0x20,0x20,0x20,0x45,
+0x78,0x70,0x65,0x63,0x74,0x65,0x64,0x3a,0x20,0x10,0x00,0x01,0x0a,0x10,0x00,0x0e,
+0x20,0x20,0x20,0x20,0x20,0x20,0x41,0x63,0x74,0x75,0x61,0x6c,0x3a,0x20,0x10,0x00,
+0x00,0x00,0x00,0x00,0x02,0x00,0x07,0x69,0x6e,0x73,0x70,0x65,0x63,0x74,0x00,0x00,
+0x01,0x2b,0x00,0x00,0x00,0x01,0x1c,0x00,0x05,0x00,0x09,0x00,0x00,0x00,0x27,0x02,
+0x20,0x00,0x26,0x00,0x40,0x01,0x17,0x00,0x40,0x01,0x17,0x00,0x40,0x01,0x17,0x01,
+0x00,0x00,0x05,0x01,0x80,0x00,0x05,0x02,0x80,0x00,0x09,0x02,0xc0,0x0f,0x19,0x02,
+0x80,0x00,0x89,0x02,0x80,0x80,0xad,0x02,0x80,0x00,0x8a,0x02,0x80,0x40,0x01,0x02,
+0x80,0xc0,0x20,0x02,0xc0,0x0c,0x19,0x02,0x80,0x80,0x01,0x02,0xc0,0x00,0x99,0x00,
+0x40,0x03,0x97,0x02,0x80,0x00,0x3d,0x03,0x00,0x40,0x01,0x03,0x01,0x00,0x20,0x02,
+0x81,0x80,0x3e,0x03,0x00,0x00,0xbd,0x02,0x81,0x80,0x3e,0x01,0x01,0x40,0x01,0x02,
+0x80,0xc0,0x01,0x02,0xc0,0x00,0x99,0x00,0x40,0x02,0x97,0x02,0x80,0x00,0x06,0x03,
+0x00,0x00,0x07,0x03,0x80,0x40,0x01,0x02,0x81,0x41,0x20,0x01,0x81,0x40,0x01,0x02,
+0x80,0x00,0x09,0x03,0x00,0x00,0x89,0x03,0x80,0x80,0x01,0x04,0x00,0xc0,0x01,0x03,
+0x01,0x81,0xb7,0x02,0x81,0x80,0xa0,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x02,0x10,
+0x00,0x09,0x45,0x78,0x70,0x65,0x63,0x74,0x65,0x64,0x20,0x10,0x00,0x0b,0x20,0x74,
+0x6f,0x20,0x62,0x65,0x20,0x74,0x72,0x75,0x65,0x00,0x00,0x00,0x07,0x00,0x0f,0x24,
+0x6d,0x72,0x62,0x74,0x65,0x73,0x74,0x5f,0x61,0x73,0x73,0x65,0x72,0x74,0x00,0x00,
+0x13,0x24,0x6d,0x72,0x62,0x74,0x65,0x73,0x74,0x5f,0x61,0x73,0x73,0x65,0x72,0x74,
+0x5f,0x69,0x64,0x78,0x00,0x00,0x01,0x2b,0x00,0x00,0x01,0x21,0x00,0x00,0x07,0x69,
+0x6e,0x73,0x70,0x65,0x63,0x74,0x00,0x00,0x0e,0x61,0x73,0x73,0x65,0x72,0x74,0x69,
+0x6f,0x6e,0x5f,0x64,0x69,0x66,0x66,0x00,0x00,0x04,0x70,0x75,0x73,0x68,0x00,0x00,
+0x00,0x00,0xa3,0x00,0x06,0x00,0x0a,0x00,0x00,0x00,0x15,0x04,0x10,0x00,0x26,0x00,
+0x40,0x00,0x97,0x00,0x40,0x00,0x97,0x01,0x80,0x00,0x05,0x03,0x00,0xc0,0x01,0x03,
+0x40,0x00,0x99,0x00,0x40,0x00,0x97,0x01,0x80,0x00,0x3d,0x03,0x00,0x00,0x06,0x03,
+0x80,0x40,0x01,0x04,0x00,0x80,0x01,0x03,0x00,0x01,0x20,0x02,0x81,0x80,0x01,0x03,
+0x00,0x00,0x06,0x03,0x80,0x40,0x01,0x04,0x00,0x80,0x01,0x03,0x80,0x80,0xb2,0x04,
+0x00,0xc0,0x01,0x04,0x81,0x40,0x01,0x03,0x00,0x41,0xa0,0x03,0x00,0x00,0x29,0x00,
+0x00,0x00,0x01,0x10,0x00,0x14,0x45,0x78,0x70,0x65,0x63,0x74,0x65,0x64,0x20,0x74,
+0x6f,0x20,0x62,0x65,0x20,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x00,0x03,0x00,0x0e,
+0x61,0x73,0x73,0x65,0x72,0x74,0x69,0x6f,0x6e,0x5f,0x64,0x69,0x66,0x66,0x00,0x00,
+0x0b,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x74,0x72,0x75,0x65,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x00,0x00,0xc5,0x00,0x05,0x00,0x09,0x00,0x00,0x00,0x1a,0x02,0x10,
+0x00,0x26,0x00,0x40,0x00,0x97,0x00,0x40,0x00,0x97,0x01,0x00,0x00,0x05,0x02,0x80,
+0x80,0x01,0x02,0xc0,0x00,0x99,0x00,0x40,0x03,0x97,0x02,0x80,0x00,0x3d,0x03,0x00,
+0x40,0x01,0x03,0x00,0x00,0x20,0x02,0x81,0x80,0x3e,0x03,0x00,0x00,0xbd,0x02,0x81,
+0x80,0x3e,0x01,0x01,0x40,0x01,0x02,0x80,0x00,0x06,0x03,0x00,0x00,0x05,0x03,0x80,
+0x40,0x01,0x02,0x80,0x41,0x20,0x02,0x01,0x40,0x01,0x02,0x80,0x00,0x06,0x03,0x00,
+0x40,0x01,0x03,0x00,0xc0,0x20,0x03,0x80,0x80,0x01,0x04,0x01,0x00,0x01,0x02,0x80,
+0x81,0xa0,0x02,0x80,0x00,0x29,0x00,0x00,0x00,0x02,0x10,0x00,0x09,0x45,0x78,0x70,
+0x65,0x63,0x74,0x65,0x64,0x20,0x10,0x00,0x0a,0x20,0x74,0x6f,0x20,0x62,0x65,0x20,
+0x6e,0x69,0x6c,0x00,0x00,0x00,0x04,0x00,0x07,0x69,0x6e,0x73,0x70,0x65,0x63,0x74,
+0x00,0x00,0x0e,0x61,0x73,0x73,0x65,0x72,0x74,0x69,0x6f,0x6e,0x5f,0x64,0x69,0x66,
+0x66,0x00,0x00,0x0b,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x74,0x72,0x75,0x65,0x00,
+0x00,0x04,0x6e,0x69,0x6c,0x3f,0x00,0x00,0x00,0x01,0x17,0x00,0x06,0x00,0x0a,0x00,
+0x00,0x00,0x25,0x04,0x10,0x00,0x26,0x00,0x40,0x00,0x97,0x00,0x40,0x00,0x97,0x01,
+0x80,0x00,0x05,0x03,0x00,0xc0,0x01,0x03,0x40,0x00,0x99,0x00,0x40,0x05,0x17,0x03,
+0x00,0x00,0x3d,0x03,0x80,0x40,0x01,0x03,0x80,0x00,0x20,0x03,0x01,0xc0,0x3e,0x03,
+0x80,0x00,0xbd,0x03,0x01,0xc0,0x3e,0x03,0x80,0x80,0x01,0x03,0x80,0x00,0x20,0x03,
+0x01,0xc0,0x3e,0x01,0x81,0x80,0x01,0x03,0x00,0x01,0xbd,0x03,0x80,0x40,0x01,0x03,
+0x80,0x00,0x20,0x03,0x01,0xc0,0x3e,0x03,0x80,0x02,0x3d,0x03,0x01,0xc0,0x3e,0x03,
+0x80,0x02,0xbd,0x04,0x00,0x80,0x01,0x04,0x00,0x00,0x20,0x03,0x82,0x00,0x3e,0x03,
+0x00,0x40,0xac,0x02,0x81,0x80,0x01,0x03,0x00,0x00,0x06,0x03,0x80,0x40,0x01,0x04,
+0x00,0x80,0x01,0x03,0x80,0xc0,0xa0,0x04,0x00,0xc0,0x01,0x04,0x81,0x40,0x01,0x03,
+0x00,0x81,0xa0,0x03,0x00,0x00,0x29,0x00,0x00,0x00,0x06,0x10,0x00,0x09,0x45,0x78,
+0x70,0x65,0x63,0x74,0x65,0x64,0x20,0x10,0x00,0x0c,0x20,0x74,0x6f,0x20,0x69,0x6e,
+0x63,0x6c,0x75,0x64,0x65,0x20,0x10,0x00,0x00,0x10,0x00,0x10,0x20,0x20,0x20,0x20,
+0x43,0x6f,0x6c,0x6c,0x65,0x63,0x74,0x69,0x6f,0x6e,0x3a,0x20,0x10,0x00,0x01,0x0a,
+0x10,0x00,0x10,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x4f,0x62,0x6a,0x65,0x63,
+0x74,0x3a,0x20,0x00,0x00,0x00,0x04,0x00,0x07,0x69,0x6e,0x73,0x70,0x65,0x63,0x74,
+0x00,0x00,0x01,0x2b,0x00,0x00,0x0b,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x74,0x72,
+0x75,0x65,0x00,0x00,0x08,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x3f,0x00,0x00,0x00,
+0x02,0xab,0x00,0x08,0x00,0x0c,0x00,0x00,0x00,0x63,0x00,0x08,0x00,0x26,0x01,0x80,
+0x00,0x07,0x04,0x00,0x00,0x09,0x04,0x40,0x2f,0x19,0x04,0x00,0x00,0x89,0x04,0x00,
+0x80,0xad,0x04,0x00,0x00,0x8a,0x04,0x00,0x40,0x01,0x04,0x00,0xc0,0x20,0x04,0x01,
+0x00,0x20,0x04,0x80,0x03,0x11,0x04,0x01,0x40,0xb2,0x04,0x40,0x01,0x99,0x04,0x00,
+0x40,0x01,0x04,0x01,0xc0,0x20,0x00,0x40,0x00,0x97,0x04,0x00,0x00,0x05,0x02,0x02,
+0x00,0x01,0x04,0x01,0x00,0x01,0x04,0x40,0x02,0x99,0x04,0x01,0x00,0x01,0x04,0x02,
+0x00,0x20,0x04,0x80,0x00,0x3d,0x04,0x00,0x80,0xac,0x02,0x02,0x00,0x01,0x02,0x80,
+0x00,0x08,0x00,0x40,0x02,0x1a,0x04,0x01,0x00,0x2b,0x04,0x02,0x40,0x20,0x02,0x80,
+0x00,0x07,0x00,0x40,0x15,0x17,0x04,0x00,0x00,0x1b,0x04,0x80,0x05,0x11,0x05,0x02,
+0x00,0x01,0x04,0x82,0xc0,0xa0,0x04,0xc0,0x00,0x98,0x00,0x40,0x11,0x97,0x03,0x02,
+0x00,0x01,0x04,0x00,0x00,0xbd,0x04,0x81,0x00,0x01,0x04,0x02,0x40,0x3e,0x04,0x80,
+0x40,0x01,0x04,0x83,0x00,0x20,0x04,0x02,0x40,0x3e,0x04,0x80,0x01,0x3d,0x04,0x02,
+0x40,0x3e,0x02,0x02,0x00,0x01,0x04,0x00,0x01,0xbd,0x04,0x81,0x80,0x01,0x04,0x81,
+0x00,0x20,0x04,0x02,0x40,0x3e,0x04,0x80,0x02,0x3d,0x04,0x02,0x40,0x3e,0x04,0x80,
+0x02,0xbd,0x05,0x01,0x80,0x01,0x05,0x03,0x40,0x20,0x04,0x82,0x80,0x3e,0x04,0x00,
+0x80,0xac,0x03,0x82,0x00,0x01,0x04,0x00,0x40,0x01,0x04,0x80,0x03,0x40,0x04,0x03,
+0x80,0x21,0x04,0x03,0xc0,0x20,0x04,0x40,0x03,0x99,0x04,0x00,0x00,0x09,0x04,0x80,
+0x00,0x89,0x05,0x01,0x00,0x01,0x05,0x81,0xc0,0x01,0x04,0x82,0x41,0xb7,0x04,0x04,
+0x00,0xa0,0x01,0x80,0x00,0x08,0x00,0x40,0x01,0x17,0x04,0x00,0x00,0x1d,0x00,0x80,
+0x00,0x1c,0x04,0x00,0x40,0x01,0x04,0x04,0x40,0x20,0x04,0x40,0x01,0x99,0x04,0x00,
+0x40,0x01,0x04,0x04,0x40,0x20,0x00,0x82,0x00,0x01,0x04,0x01,0x40,0x01,0x04,0x40,
+0x08,0x19,0x04,0x00,0x00,0xbd,0x04,0x81,0x00,0x01,0x04,0x02,0x40,0x3e,0x04,0x80,
+0x40,0x01,0x04,0x83,0x00,0x20,0x04,0x02,0x40,0x3e,0x04,0x80,0x03,0x3d,0x04,0x02,
+0x40,0x3e,0x02,0x02,0x00,0x01,0x04,0x00,0x00,0x09,0x04,0x80,0x00,0x89,0x05,0x01,
+0x00,0x01,0x05,0x80,0x00,0x05,0x04,0x82,0x41,0xb7,0x04,0x04,0x00,0xa0,0x01,0x80,
+0x00,0x08,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x07,0x10,0x00,0x03,0x20,0x3a,0x20,
+0x10,0x00,0x00,0x10,0x00,0x18,0x20,0x65,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,
+0x20,0x65,0x78,0x70,0x65,0x63,0x74,0x65,0x64,0x2c,0x20,0x6e,0x6f,0x74,0x10,0x00,
+0x0e,0x20,0x20,0x20,0x20,0x20,0x20,0x43,0x6c,0x61,0x73,0x73,0x3a,0x20,0x3c,0x10,
+0x00,0x02,0x3e,0x0a,0x10,0x00,0x0d,0x20,0x20,0x20,0x20,0x4d,0x65,0x73,0x73,0x61,
+0x67,0x65,0x3a,0x20,0x10,0x00,0x21,0x20,0x65,0x78,0x70,0x65,0x63,0x74,0x65,0x64,
+0x20,0x62,0x75,0x74,0x20,0x6e,0x6f,0x74,0x68,0x69,0x6e,0x67,0x20,0x77,0x61,0x73,
+0x20,0x72,0x61,0x69,0x73,0x65,0x64,0x2e,0x00,0x00,0x00,0x12,0x00,0x0f,0x24,0x6d,
+0x72,0x62,0x74,0x65,0x73,0x74,0x5f,0x61,0x73,0x73,0x65,0x72,0x74,0x00,0x00,0x13,
+0x24,0x6d,0x72,0x62,0x74,0x65,0x73,0x74,0x5f,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,
+0x69,0x64,0x78,0x00,0x00,0x01,0x2b,0x00,0x00,0x04,0x6c,0x61,0x73,0x74,0x00,0x00,
+0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x06,0x53,0x74,
+0x72,0x69,0x6e,0x67,0x00,0x00,0x03,0x70,0x6f,0x70,0x00,0x00,0x04,0x74,0x6f,0x5f,
+0x73,0x00,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x09,0x45,0x78,0x63,0x65,0x70,
+0x74,0x69,0x6f,0x6e,0x00,0x00,0x03,0x3d,0x3d,0x3d,0x00,0x00,0x07,0x69,0x6e,0x73,
+0x70,0x65,0x63,0x74,0x00,0x00,0x07,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x00,0x00,
+0x04,0x61,0x6e,0x79,0x3f,0x00,0x00,0x01,0x21,0x00,0x00,0x04,0x70,0x75,0x73,0x68,
+0x00,0x00,0x05,0x66,0x69,0x72,0x73,0x74,0x00,0x00,0x00,0x00,0x7c,0x00,0x03,0x00,
+0x05,0x00,0x00,0x00,0x0e,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x00,0x00,
+0x91,0x01,0x80,0x00,0xa0,0x01,0xc0,0x02,0x19,0x01,0x81,0x80,0x15,0x02,0x00,0x40,
+0x01,0x01,0x80,0x80,0xa0,0x00,0x40,0x02,0x17,0x01,0x80,0x40,0x01,0x02,0x01,0x80,
+0x15,0x02,0x01,0x00,0x20,0x01,0x80,0xc0,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x05,0x00,0x0c,0x69,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,
+0x6f,0x66,0x3f,0x00,0x00,0x06,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x00,0x00,0x08,0x6b,
+0x69,0x6e,0x64,0x5f,0x6f,0x66,0x3f,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x63,
+0x6c,0x61,0x73,0x73,0x00,0x00,0x00,0x01,0xe6,0x00,0x02,0x00,0x05,0x00,0x00,0x00,
+0x42,0x00,0x00,0x00,0x26,0x01,0x00,0x00,0x06,0x01,0x80,0x00,0x3d,0x01,0x00,0x00,
+0xa0,0x01,0x00,0x00,0x89,0x01,0x80,0x03,0x40,0x01,0x00,0x80,0x21,0x01,0x00,0x01,
+0x89,0x01,0x80,0x02,0x89,0x01,0x01,0x00,0xac,0x01,0x00,0x03,0x0a,0x01,0x00,0x00,
+0x06,0x01,0x80,0x00,0xbd,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,0x06,0x01,0x80,0x03,
+0x09,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,0x06,0x01,0x80,0x00,0x3d,0x01,0x00,0x00,
+0xa0,0x01,0x00,0x00,0x06,0x01,0x80,0x01,0x3d,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,
+0x06,0x01,0x80,0x01,0x89,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,0x06,0x01,0x80,0x00,
+0x3d,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,0x06,0x01,0x80,0x01,0xbd,0x01,0x00,0x00,
+0xa0,0x01,0x00,0x00,0x06,0x01,0x80,0x02,0x89,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,
+0x06,0x01,0x80,0x00,0x3d,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,0x06,0x01,0x80,0x02,
+0x3d,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,0x06,0x01,0x80,0x03,0x89,0x01,0x00,0x00,
+0xa0,0x01,0x00,0x00,0x06,0x01,0x80,0x00,0x3d,0x01,0x00,0x00,0xa0,0x01,0x00,0x04,
+0x11,0x01,0x80,0x05,0x04,0x01,0x02,0x40,0xa0,0x01,0x40,0x06,0x99,0x01,0x00,0x00,
+0x06,0x01,0x80,0x02,0xbd,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,0x06,0x01,0x80,0x05,
+0x11,0x01,0x82,0xc0,0x20,0x02,0x00,0x06,0x89,0x01,0x83,0x00,0xae,0x01,0x00,0x00,
+0xa0,0x01,0x00,0x00,0x06,0x01,0x80,0x03,0x3d,0x01,0x00,0x00,0xa0,0x00,0x40,0x00,
+0x97,0x01,0x00,0x00,0x05,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x07,0x10,0x00,0x01,
+0x0a,0x10,0x00,0x07,0x54,0x6f,0x74,0x61,0x6c,0x3a,0x20,0x10,0x00,0x07,0x20,0x20,
+0x20,0x4f,0x4b,0x3a,0x20,0x10,0x00,0x07,0x20,0x20,0x20,0x4b,0x4f,0x3a,0x20,0x10,
+0x00,0x07,0x43,0x72,0x61,0x73,0x68,0x3a,0x20,0x10,0x00,0x07,0x20,0x54,0x69,0x6d,
+0x65,0x3a,0x20,0x10,0x00,0x09,0x20,0x73,0x65,0x63,0x6f,0x6e,0x64,0x73,0x0a,0x00,
+0x00,0x00,0x0e,0x00,0x05,0x70,0x72,0x69,0x6e,0x74,0x00,0x00,0x08,0x24,0x61,0x73,
+0x73,0x65,0x72,0x74,0x73,0x00,0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x08,0x24,
+0x6f,0x6b,0x5f,0x74,0x65,0x73,0x74,0x00,0x00,0x01,0x2b,0x00,0x00,0x08,0x24,0x6b,
+0x6f,0x5f,0x74,0x65,0x73,0x74,0x00,0x00,0x0b,0x24,0x74,0x6f,0x74,0x61,0x6c,0x5f,
+0x74,0x65,0x73,0x74,0x00,0x00,0x0a,0x24,0x6b,0x69,0x6c,0x6c,0x5f,0x74,0x65,0x73,
+0x74,0x00,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x0e,0x63,0x6f,0x6e,
+0x73,0x74,0x5f,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x3f,0x00,0x00,0x04,0x54,0x69,
+0x6d,0x65,0x00,0x00,0x03,0x6e,0x6f,0x77,0x00,0x00,0x01,0x2d,0x00,0x00,0x0b,0x24,
+0x74,0x65,0x73,0x74,0x5f,0x73,0x74,0x61,0x72,0x74,0x00,0x00,0x00,0x00,0x2f,0x00,
+0x03,0x00,0x05,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x00,0x06,0x02,
+0x00,0x40,0x01,0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x01,0x00,0x04,0x70,0x75,0x74,0x73,0x00,0x00,0x00,0x00,0xa8,0x00,0x05,
+0x00,0x07,0x00,0x00,0x00,0x17,0x04,0x00,0x00,0x26,0x02,0x00,0x00,0x02,0x02,0x80,
+0x40,0x01,0x02,0x80,0x00,0x20,0x00,0x81,0x40,0x01,0x02,0x80,0x80,0x01,0x02,0x80,
+0x00,0x20,0x01,0x01,0x40,0x01,0x02,0x80,0x40,0x01,0x02,0x80,0x40,0x20,0x02,0xc0,
+0x01,0x19,0x02,0x80,0x80,0x01,0x02,0x80,0x40,0x20,0x02,0xc0,0x03,0x99,0x02,0x80,
+0x40,0x01,0x03,0x00,0x80,0x01,0x02,0x80,0x80,0xae,0x02,0x80,0xc0,0x20,0x03,0x01,
+0x00,0x01,0x02,0x81,0x00,0xb3,0x00,0x40,0x00,0x97,0x02,0x80,0x00,0x07,0x02,0x80,
+0x00,0x29,0x00,0x00,0x00,0x01,0x06,0x00,0x16,0x39,0x2e,0x39,0x39,0x39,0x39,0x39,
+0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x38,0x65,0x2d,0x31,0x33,0x00,
+0x00,0x00,0x05,0x00,0x04,0x74,0x6f,0x5f,0x66,0x00,0x00,0x07,0x66,0x69,0x6e,0x69,
+0x74,0x65,0x3f,0x00,0x00,0x01,0x2d,0x00,0x00,0x03,0x61,0x62,0x73,0x00,0x00,0x01,
+0x3c,0x00,0x00,0x00,0x00,0x59,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x08,0x00,0x80,
+0x00,0x06,0x01,0x00,0x00,0x84,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x48,0x01,0x00,
+0x02,0xc0,0x00,0x80,0x80,0x46,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x0d,0x61,0x74,0x74,0x72,0x5f,0x61,0x63,0x63,
+0x65,0x73,0x73,0x6f,0x72,0x00,0x00,0x05,0x63,0x61,0x75,0x73,0x65,0x00,0x00,0x0a,
+0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,0x29,0x00,
+0x03,0x00,0x04,0x00,0x00,0x00,0x03,0x02,0x00,0x00,0x26,0x00,0x80,0x00,0x0e,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x06,0x40,0x63,0x61,
+0x75,0x73,0x65,0x00,0x00,0x00,0x00,0x5d,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x0a,
+0x00,0x10,0x00,0x26,0x00,0x40,0x00,0x97,0x00,0x40,0x00,0x97,0x00,0x80,0x00,0x3d,
+0x01,0x80,0x00,0x06,0x02,0x00,0x00,0x91,0x02,0x80,0x40,0x01,0x02,0x00,0x80,0xa0,
+0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x10,0x00,0x00,0x00,
+0x00,0x00,0x03,0x00,0x05,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x0d,0x4d,0x52,0x75,
+0x62,0x79,0x54,0x65,0x73,0x74,0x53,0x6b,0x69,0x70,0x00,0x00,0x03,0x6e,0x65,0x77,
+0x00,0x45,0x4e,0x44,0x00,0x00,0x00,0x00,0x08,
+};
+void GENERATED_TMP_mrb_mruby_bin_mirb_gem_test(mrb_state *mrb) {
+}
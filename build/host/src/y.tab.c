@@ -0,0 +1,11579 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 1
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 7 "src/parse.y"
+
+#undef PARSER_DEBUG
+
+#define YYDEBUG 1
+#define YYERROR_VERBOSE 1
+/*
+ * Force yacc to use our memory management.  This is a little evil because
+ * the macros assume that "parser_state *p" is in scope
+ */
+#define YYMALLOC(n)    mrb_malloc(p->mrb, (n))
+#define YYFREE(o)      mrb_free(p->mrb, (o))
+#define YYSTACK_USE_ALLOCA 0
+
+#include <ctype.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mruby.h"
+#include "mruby/compile.h"
+#include "mruby/proc.h"
+#include "node.h"
+
+#define YYLEX_PARAM p
+
+typedef mrb_ast_node node;
+typedef struct mrb_parser_state parser_state;
+typedef struct mrb_parser_heredoc_info parser_heredoc_info;
+
+static int yylex(void *lval, parser_state *p);
+static void yyerror(parser_state *p, const char *s);
+static void yywarn(parser_state *p, const char *s);
+static void yywarning(parser_state *p, const char *s);
+static void backref_error(parser_state *p, node *n);
+
+#ifndef isascii
+#define isascii(c) (((c) & ~0x7f) == 0)
+#endif
+
+#define identchar(c) (isalnum(c) || (c) == '_' || !isascii(c))
+
+typedef unsigned int stack_type;
+
+#define BITSTACK_PUSH(stack, n) ((stack) = ((stack)<<1)|((n)&1))
+#define BITSTACK_POP(stack)     ((stack) = (stack) >> 1)
+#define BITSTACK_LEXPOP(stack)  ((stack) = ((stack) >> 1) | ((stack) & 1))
+#define BITSTACK_SET_P(stack)   ((stack)&1)
+
+#define COND_PUSH(n)    BITSTACK_PUSH(p->cond_stack, (n))
+#define COND_POP()      BITSTACK_POP(p->cond_stack)
+#define COND_LEXPOP()   BITSTACK_LEXPOP(p->cond_stack)
+#define COND_P()        BITSTACK_SET_P(p->cond_stack)
+
+#define CMDARG_PUSH(n)  BITSTACK_PUSH(p->cmdarg_stack, (n))
+#define CMDARG_POP()    BITSTACK_POP(p->cmdarg_stack)
+#define CMDARG_LEXPOP() BITSTACK_LEXPOP(p->cmdarg_stack)
+#define CMDARG_P()      BITSTACK_SET_P(p->cmdarg_stack)
+
+#define sym(x) ((mrb_sym)(intptr_t)(x))
+#define nsym(x) ((node*)(intptr_t)(x))
+
+static inline mrb_sym
+intern_gen(parser_state *p, const char *s)
+{
+  return mrb_intern(p->mrb, s);
+}
+#define intern(s) intern_gen(p,(s))
+
+static inline mrb_sym
+intern_gen2(parser_state *p, const char *s, size_t len)
+{
+  return mrb_intern2(p->mrb, s, len);
+}
+#define intern2(s,len) intern_gen2(p,(s),(len))
+
+static inline mrb_sym
+intern_gen_c(parser_state *p, const char c)
+{
+  return mrb_intern2(p->mrb, &c, 1);
+}
+#define intern_c(c) intern_gen_c(p,(c))
+
+static void
+cons_free_gen(parser_state *p, node *cons)
+{
+  cons->cdr = p->cells;
+  p->cells = cons;
+}
+#define cons_free(c) cons_free_gen(p, (c))
+
+static void*
+parser_palloc(parser_state *p, size_t size)
+{
+  void *m = mrb_pool_alloc(p->pool, size);
+
+  if (!m) {
+    longjmp(p->jmp, 1);
+  }
+  return m;
+}
+
+static node*
+cons_gen(parser_state *p, node *car, node *cdr)
+{
+  node *c;
+
+  if (p->cells) {
+    c = p->cells;
+    p->cells = p->cells->cdr;
+  }
+  else {
+    c = (node *)parser_palloc(p, sizeof(mrb_ast_node));
+  }
+
+  c->car = car;
+  c->cdr = cdr;
+  c->lineno = p->lineno;
+  return c;
+}
+#define cons(a,b) cons_gen(p,(a),(b))
+
+static node*
+list1_gen(parser_state *p, node *a)
+{
+  return cons(a, 0);
+}
+#define list1(a) list1_gen(p, (a))
+
+static node*
+list2_gen(parser_state *p, node *a, node *b)
+{
+  return cons(a, cons(b,0));
+}
+#define list2(a,b) list2_gen(p, (a),(b))
+
+static node*
+list3_gen(parser_state *p, node *a, node *b, node *c)
+{
+  return cons(a, cons(b, cons(c,0)));
+}
+#define list3(a,b,c) list3_gen(p, (a),(b),(c))
+
+static node*
+list4_gen(parser_state *p, node *a, node *b, node *c, node *d)
+{
+  return cons(a, cons(b, cons(c, cons(d, 0))));
+}
+#define list4(a,b,c,d) list4_gen(p, (a),(b),(c),(d))
+
+static node*
+list5_gen(parser_state *p, node *a, node *b, node *c, node *d, node *e)
+{
+  return cons(a, cons(b, cons(c, cons(d, cons(e, 0)))));
+}
+#define list5(a,b,c,d,e) list5_gen(p, (a),(b),(c),(d),(e))
+
+static node*
+list6_gen(parser_state *p, node *a, node *b, node *c, node *d, node *e, node *f)
+{
+  return cons(a, cons(b, cons(c, cons(d, cons(e, cons(f, 0))))));
+}
+#define list6(a,b,c,d,e,f) list6_gen(p, (a),(b),(c),(d),(e),(f))
+
+static node*
+append_gen(parser_state *p, node *a, node *b)
+{
+  node *c = a;
+
+  if (!a) return b;
+  while (c->cdr) {
+    c = c->cdr;
+  }
+  if (b) {
+    c->cdr = b;
+  }
+  return a;
+}
+#define append(a,b) append_gen(p,(a),(b))
+#define push(a,b) append_gen(p,(a),list1(b))
+
+static char*
+parser_strndup(parser_state *p, const char *s, size_t len)
+{
+  char *b = (char *)parser_palloc(p, len+1);
+
+  memcpy(b, s, len);
+  b[len] = '\0';
+  return b;
+}
+#define strndup(s,len) parser_strndup(p, s, len)
+
+static char*
+parser_strdup(parser_state *p, const char *s)
+{
+  return parser_strndup(p, s, strlen(s));
+}
+#undef strdup
+#define strdup(s) parser_strdup(p, s)
+
+// xxx -----------------------------
+
+static node*
+local_switch(parser_state *p)
+{
+  node *prev = p->locals;
+
+  p->locals = cons(0, 0);
+  return prev;
+}
+
+static void
+local_resume(parser_state *p, node *prev)
+{
+  p->locals = prev;
+}
+
+static void
+local_nest(parser_state *p)
+{
+  p->locals = cons(0, p->locals);
+}
+
+static void
+local_unnest(parser_state *p)
+{
+  p->locals = p->locals->cdr;
+}
+
+static int
+local_var_p(parser_state *p, mrb_sym sym)
+{
+  node *l = p->locals;
+
+  while (l) {
+    node *n = l->car;
+    while (n) {
+      if (sym(n->car) == sym) return 1;
+      n = n->cdr;
+    }
+    l = l->cdr;
+  }
+  return 0;
+}
+
+static void
+local_add_f(parser_state *p, mrb_sym sym)
+{
+  p->locals->car = push(p->locals->car, nsym(sym));
+}
+
+static void
+local_add(parser_state *p, mrb_sym sym)
+{
+  if (!local_var_p(p, sym)) {
+    local_add_f(p, sym);
+  }
+}
+
+// (:scope (vars..) (prog...))
+static node*
+new_scope(parser_state *p, node *body)
+{
+  return cons((node*)NODE_SCOPE, cons(p->locals->car, body));
+}
+
+// (:begin prog...)
+static node*
+new_begin(parser_state *p, node *body)
+{
+  if (body) 
+    return list2((node*)NODE_BEGIN, body);
+  return cons((node*)NODE_BEGIN, 0);
+}
+
+#define newline_node(n) (n)
+
+// (:rescue body rescue else)
+static node*
+new_rescue(parser_state *p, node *body, node *resq, node *els)
+{
+  return list4((node*)NODE_RESCUE, body, resq, els);
+}
+
+// (:ensure body ensure)
+static node*
+new_ensure(parser_state *p, node *a, node *b)
+{
+  return cons((node*)NODE_ENSURE, cons(a, cons(0, b)));
+}
+
+// (:nil)
+static node*
+new_nil(parser_state *p)
+{
+  return list1((node*)NODE_NIL);
+}
+
+// (:true)
+static node*
+new_true(parser_state *p)
+{
+  return list1((node*)NODE_TRUE);
+}
+
+// (:false)
+static node*
+new_false(parser_state *p)
+{
+  return list1((node*)NODE_FALSE);
+}
+
+// (:alias new old)
+static node*
+new_alias(parser_state *p, mrb_sym a, mrb_sym b)
+{
+  return cons((node*)NODE_ALIAS, cons(nsym(a), nsym(b)));
+}
+
+// (:if cond then else)
+static node*
+new_if(parser_state *p, node *a, node *b, node *c)
+{
+  return list4((node*)NODE_IF, a, b, c);
+}
+
+// (:unless cond then else)
+static node*
+new_unless(parser_state *p, node *a, node *b, node *c)
+{
+  return list4((node*)NODE_IF, a, c, b);
+}
+
+// (:while cond body)
+static node*
+new_while(parser_state *p, node *a, node *b)
+{
+  return cons((node*)NODE_WHILE, cons(a, b));
+}
+
+// (:until cond body)
+static node*
+new_until(parser_state *p, node *a, node *b)
+{
+  return cons((node*)NODE_UNTIL, cons(a, b));
+}
+
+// (:for var obj body)
+static node*
+new_for(parser_state *p, node *v, node *o, node *b)
+{
+  return list4((node*)NODE_FOR, v, o, b);
+}
+
+// (:case a ((when ...) body) ((when...) body))
+static node*
+new_case(parser_state *p, node *a, node *b)
+{
+  node *n = list2((node*)NODE_CASE, a);
+  node *n2 = n;
+
+  while (n2->cdr) {
+    n2 = n2->cdr;
+  }
+  n2->cdr = b;
+  return n;
+}
+
+// (:postexe a)
+static node*
+new_postexe(parser_state *p, node *a)
+{
+  return cons((node*)NODE_POSTEXE, a);
+}
+
+// (:self)
+static node*
+new_self(parser_state *p)
+{
+  return list1((node*)NODE_SELF);
+}
+
+// (:call a b c)
+static node*
+new_call(parser_state *p, node *a, mrb_sym b, node *c)
+{
+  return list4((node*)NODE_CALL, a, nsym(b), c);
+}
+
+// (:fcall self mid args)
+static node*
+new_fcall(parser_state *p, mrb_sym b, node *c)
+{
+  return list4((node*)NODE_FCALL, new_self(p), nsym(b), c);
+}
+
+// (:super . c)
+static node*
+new_super(parser_state *p, node *c)
+{
+  return cons((node*)NODE_SUPER, c);
+}
+
+// (:zsuper)
+static node*
+new_zsuper(parser_state *p)
+{
+  return list1((node*)NODE_ZSUPER);
+}
+
+// (:yield . c)
+static node*
+new_yield(parser_state *p, node *c)
+{
+  if (c) {
+    if (c->cdr) {
+      yyerror(p, "both block arg and actual block given");
+    }
+    return cons((node*)NODE_YIELD, c->car);
+  }
+  return cons((node*)NODE_YIELD, 0);
+}
+
+// (:return . c)
+static node*
+new_return(parser_state *p, node *c)
+{
+  return cons((node*)NODE_RETURN, c);
+}
+
+// (:break . c)
+static node*
+new_break(parser_state *p, node *c)
+{
+  return cons((node*)NODE_BREAK, c);
+}
+
+// (:next . c)
+static node*
+new_next(parser_state *p, node *c)
+{
+  return cons((node*)NODE_NEXT, c);
+}
+
+// (:redo)
+static node*
+new_redo(parser_state *p)
+{
+  return list1((node*)NODE_REDO);
+}
+
+// (:retry)
+static node*
+new_retry(parser_state *p)
+{
+  return list1((node*)NODE_RETRY);
+}
+
+// (:dot2 a b)
+static node*
+new_dot2(parser_state *p, node *a, node *b)
+{
+  return cons((node*)NODE_DOT2, cons(a, b));
+}
+
+// (:dot3 a b)
+static node*
+new_dot3(parser_state *p, node *a, node *b)
+{
+  return cons((node*)NODE_DOT3, cons(a, b));
+}
+
+// (:colon2 b c)
+static node*
+new_colon2(parser_state *p, node *b, mrb_sym c)
+{
+  return cons((node*)NODE_COLON2, cons(b, nsym(c)));
+}
+
+// (:colon3 . c)
+static node*
+new_colon3(parser_state *p, mrb_sym c)
+{
+  return cons((node*)NODE_COLON3, nsym(c));
+}
+
+// (:and a b)
+static node*
+new_and(parser_state *p, node *a, node *b)
+{
+  return cons((node*)NODE_AND, cons(a, b));
+}
+
+// (:or a b)
+static node*
+new_or(parser_state *p, node *a, node *b)
+{
+  return cons((node*)NODE_OR, cons(a, b));
+}
+
+// (:array a...)
+static node*
+new_array(parser_state *p, node *a)
+{
+  return cons((node*)NODE_ARRAY, a);
+}
+
+// (:splat . a)
+static node*
+new_splat(parser_state *p, node *a)
+{
+  return cons((node*)NODE_SPLAT, a);
+}
+
+// (:hash (k . v) (k . v)...)
+static node*
+new_hash(parser_state *p, node *a)
+{
+  return cons((node*)NODE_HASH, a);
+}
+
+// (:sym . a)
+static node*
+new_sym(parser_state *p, mrb_sym sym)
+{
+  return cons((node*)NODE_SYM, nsym(sym));
+}
+
+static mrb_sym
+new_strsym(parser_state *p, node* str)
+{
+  const char *s = (const char*)str->cdr->car;
+  size_t len = (size_t)str->cdr->cdr;
+
+  return mrb_intern2(p->mrb, s, len);
+}
+
+// (:lvar . a)
+static node*
+new_lvar(parser_state *p, mrb_sym sym)
+{
+  return cons((node*)NODE_LVAR, nsym(sym));
+}
+
+// (:gvar . a)
+static node*
+new_gvar(parser_state *p, mrb_sym sym)
+{
+  return cons((node*)NODE_GVAR, nsym(sym));
+}
+
+// (:ivar . a)
+static node*
+new_ivar(parser_state *p, mrb_sym sym)
+{
+  return cons((node*)NODE_IVAR, nsym(sym));
+}
+
+// (:cvar . a)
+static node*
+new_cvar(parser_state *p, mrb_sym sym)
+{
+  return cons((node*)NODE_CVAR, nsym(sym));
+}
+
+// (:const . a)
+static node*
+new_const(parser_state *p, mrb_sym sym)
+{
+  return cons((node*)NODE_CONST, nsym(sym));
+}
+
+// (:undef a...)
+static node*
+new_undef(parser_state *p, mrb_sym sym)
+{
+  return list2((node*)NODE_UNDEF, nsym(sym));
+}
+
+// (:class class super body)
+static node*
+new_class(parser_state *p, node *c, node *s, node *b)
+{
+  return list4((node*)NODE_CLASS, c, s, cons(p->locals->car, b));
+}
+
+// (:sclass obj body)
+static node*
+new_sclass(parser_state *p, node *o, node *b)
+{
+  return list3((node*)NODE_SCLASS, o, cons(p->locals->car, b));
+}
+
+// (:module module body)
+static node*
+new_module(parser_state *p, node *m, node *b)
+{
+  return list3((node*)NODE_MODULE, m, cons(p->locals->car, b));
+}
+
+// (:def m lv (arg . body))
+static node*
+new_def(parser_state *p, mrb_sym m, node *a, node *b)
+{
+  return list5((node*)NODE_DEF, nsym(m), p->locals->car, a, b);
+}
+
+// (:sdef obj m lv (arg . body))
+static node*
+new_sdef(parser_state *p, node *o, mrb_sym m, node *a, node *b)
+{
+  return list6((node*)NODE_SDEF, o, nsym(m), p->locals->car, a, b);
+}
+
+// (:arg . sym)
+static node*
+new_arg(parser_state *p, mrb_sym sym)
+{
+  return cons((node*)NODE_ARG, nsym(sym));
+}
+
+// (m o r m2 b)
+// m: (a b c)
+// o: ((a . e1) (b . e2))
+// r: a
+// m2: (a b c)
+// b: a
+static node*
+new_args(parser_state *p, node *m, node *opt, mrb_sym rest, node *m2, mrb_sym blk)
+{
+  node *n;
+
+  n = cons(m2, nsym(blk));
+  n = cons(nsym(rest), n);
+  n = cons(opt, n);
+  return cons(m, n);
+}
+
+// (:block_arg . a)
+static node*
+new_block_arg(parser_state *p, node *a)
+{
+  return cons((node*)NODE_BLOCK_ARG, a);
+}
+
+// (:block arg body)
+static node*
+new_block(parser_state *p, node *a, node *b)
+{
+  return list4((node*)NODE_BLOCK, p->locals->car, a, b);
+}
+
+// (:lambda arg body)
+static node*
+new_lambda(parser_state *p, node *a, node *b)
+{
+  return list4((node*)NODE_LAMBDA, p->locals->car, a, b);
+}
+
+// (:asgn lhs rhs)
+static node*
+new_asgn(parser_state *p, node *a, node *b)
+{
+  return cons((node*)NODE_ASGN, cons(a, b));
+}
+
+// (:masgn mlhs=(pre rest post)  mrhs)
+static node*
+new_masgn(parser_state *p, node *a, node *b)
+{
+  return cons((node*)NODE_MASGN, cons(a, b));
+}
+
+// (:asgn lhs rhs)
+static node*
+new_op_asgn(parser_state *p, node *a, mrb_sym op, node *b)
+{
+  return list4((node*)NODE_OP_ASGN, a, nsym(op), b);
+}
+
+// (:int . i)
+static node*
+new_int(parser_state *p, const char *s, int base)
+{
+  return list3((node*)NODE_INT, (node*)strdup(s), (node*)(intptr_t)base);
+}
+
+// (:float . i)
+static node*
+new_float(parser_state *p, const char *s)
+{
+  return cons((node*)NODE_FLOAT, (node*)strdup(s));
+}
+
+// (:str . (s . len))
+static node*
+new_str(parser_state *p, const char *s, int len)
+{
+  return cons((node*)NODE_STR, cons((node*)strndup(s, len), (node*)(intptr_t)len));
+}
+
+// (:dstr . a)
+static node*
+new_dstr(parser_state *p, node *a)
+{
+  return cons((node*)NODE_DSTR, a);
+}
+
+// (:str . (s . len))
+static node*
+new_xstr(parser_state *p, const char *s, int len)
+{
+  return cons((node*)NODE_XSTR, cons((node*)strndup(s, len), (node*)(intptr_t)len));
+}
+
+// (:xstr . a)
+static node*
+new_dxstr(parser_state *p, node *a)
+{
+  return cons((node*)NODE_DXSTR, a);
+}
+
+// (:dsym . a)
+static node*
+new_dsym(parser_state *p, node *a)
+{
+  return cons((node*)NODE_DSYM, new_dstr(p, a));
+}
+
+// (:str . (a . a))
+static node*
+new_regx(parser_state *p, const char *p1, const char* p2)
+{
+  return cons((node*)NODE_REGX, cons((node*)p1, (node*)p2));
+}
+
+// (:dregx . a)
+static node*
+new_dregx(parser_state *p, node *a, node *b)
+{
+  return cons((node*)NODE_DREGX, cons(a, b));
+}
+
+// (:backref . n)
+static node*
+new_back_ref(parser_state *p, int n)
+{
+  return cons((node*)NODE_BACK_REF, (node*)(intptr_t)n);
+}
+
+// (:nthref . n)
+static node*
+new_nth_ref(parser_state *p, int n)
+{
+  return cons((node*)NODE_NTH_REF, (node*)(intptr_t)n);
+}
+
+// (:heredoc . a)
+static node*
+new_heredoc(parser_state *p)
+{
+  parser_heredoc_info *inf = parser_palloc(p, sizeof(parser_heredoc_info));
+  return cons((node*)NODE_HEREDOC, (node*)inf);
+}
+
+static void
+new_bv(parser_state *p, mrb_sym id)
+{
+}
+
+static node*
+new_literal_delim(parser_state *p)
+{
+  return cons((node*)NODE_LITERAL_DELIM, 0);
+}
+
+// (:words . a)
+static node*
+new_words(parser_state *p, node *a)
+{
+  return cons((node*)NODE_WORDS, a);
+}
+
+// (:symbols . a)
+static node*
+new_symbols(parser_state *p, node *a)
+{
+  return cons((node*)NODE_SYMBOLS, a);
+}
+
+// xxx -----------------------------
+
+// (:call a op)
+static node*
+call_uni_op(parser_state *p, node *recv, char *m)
+{
+  return new_call(p, recv, intern(m), 0);
+}
+
+// (:call a op b)
+static node*
+call_bin_op(parser_state *p, node *recv, char *m, node *arg1)
+{
+  return new_call(p, recv, intern(m), list1(list1(arg1)));
+}
+
+static void
+args_with_block(parser_state *p, node *a, node *b)
+{
+  if (b) {
+    if (a->cdr) {
+      yyerror(p, "both block arg and actual block given");
+    }
+    a->cdr = b;
+  }
+}
+
+static void
+call_with_block(parser_state *p, node *a, node *b)
+{
+  node *n;
+
+  if (a->car == (node*)NODE_SUPER ||
+      a->car == (node*)NODE_ZSUPER) {
+    if (!a->cdr) a->cdr = cons(0, b);
+    else {
+      args_with_block(p, a->cdr, b);
+    }
+  }
+  else {
+    n = a->cdr->cdr->cdr;
+    if (!n->car) n->car = cons(0, b);
+    else {
+      args_with_block(p, n->car, b);
+    }
+  }
+}
+
+static node*
+negate_lit(parser_state *p, node *n)
+{
+  return cons((node*)NODE_NEGATE, n);
+}
+
+static node*
+cond(node *n)
+{
+  return n;
+}
+
+static node*
+ret_args(parser_state *p, node *n)
+{
+  if (n->cdr) {
+    yyerror(p, "block argument should not be given");
+  }
+  if (!n->car->cdr) return n->car->car;
+  return new_array(p, n->car);
+}
+
+static void
+assignable(parser_state *p, node *lhs)
+{
+  if ((int)(intptr_t)lhs->car == NODE_LVAR) {
+    local_add(p, sym(lhs->cdr));
+  }
+}
+
+static node*
+var_reference(parser_state *p, node *lhs)
+{
+  node *n;
+
+  if ((int)(intptr_t)lhs->car == NODE_LVAR) {
+    if (!local_var_p(p, sym(lhs->cdr))) {
+      n = new_fcall(p, sym(lhs->cdr), 0);
+      cons_free(lhs);
+      return n;
+    }
+  }
+
+  return lhs;
+}
+
+typedef enum mrb_string_type  string_type;
+
+static node*
+new_strterm(parser_state *p, string_type type, int term, int paren)
+{
+  return cons((node*)(intptr_t)type, cons((node*)0, cons((node*)(intptr_t)paren, (node*)(intptr_t)term)));
+}
+
+static void
+end_strterm(parser_state *p)
+{
+  cons_free(p->lex_strterm->cdr->cdr);
+  cons_free(p->lex_strterm->cdr);
+  cons_free(p->lex_strterm);
+  p->lex_strterm = NULL;
+}
+
+parser_heredoc_info *
+parsing_heredoc_inf(parser_state *p)
+{
+  node *nd = p->parsing_heredoc;
+  if (nd == NULL)
+    return NULL;
+  /* assert(nd->car->car == NODE_HEREDOC); */
+  return (parser_heredoc_info*)nd->car->cdr;
+}
+
+static void
+heredoc_end(parser_state *p)
+{
+  p->parsing_heredoc = p->parsing_heredoc->cdr;
+  if (p->parsing_heredoc == NULL) {
+    p->lstate = EXPR_BEG;
+    p->cmd_start = TRUE;
+    end_strterm(p);
+    p->heredoc_end_now = TRUE;
+  } else {
+    /* next heredoc */
+    p->lex_strterm->car = (node*)(intptr_t)parsing_heredoc_inf(p)->type;
+  }
+}
+#define is_strterm_type(p,str_func) ((int)(intptr_t)((p)->lex_strterm->car) & (str_func))
+
+// xxx -----------------------------
+
+
+#line 1000 "/root/repo/build/host/src/y.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    keyword_class = 258,           /* keyword_class  */
+    keyword_module = 259,          /* keyword_module  */
+    keyword_def = 260,             /* keyword_def  */
+    keyword_undef = 261,           /* keyword_undef  */
+    keyword_begin = 262,           /* keyword_begin  */
+    keyword_rescue = 263,          /* keyword_rescue  */
+    keyword_ensure = 264,          /* keyword_ensure  */
+    keyword_end = 265,             /* keyword_end  */
+    keyword_if = 266,              /* keyword_if  */
+    keyword_unless = 267,          /* keyword_unless  */
+    keyword_then = 268,            /* keyword_then  */
+    keyword_elsif = 269,           /* keyword_elsif  */
+    keyword_else = 270,            /* keyword_else  */
+    keyword_case = 271,            /* keyword_case  */
+    keyword_when = 272,            /* keyword_when  */
+    keyword_while = 273,           /* keyword_while  */
+    keyword_until = 274,           /* keyword_until  */
+    keyword_for = 275,             /* keyword_for  */
+    keyword_break = 276,           /* keyword_break  */
+    keyword_next = 277,            /* keyword_next  */
+    keyword_redo = 278,            /* keyword_redo  */
+    keyword_retry = 279,           /* keyword_retry  */
+    keyword_in = 280,              /* keyword_in  */
+    keyword_do = 281,              /* keyword_do  */
+    keyword_do_cond = 282,         /* keyword_do_cond  */
+    keyword_do_block = 283,        /* keyword_do_block  */
+    keyword_do_LAMBDA = 284,       /* keyword_do_LAMBDA  */
+    keyword_return = 285,          /* keyword_return  */
+    keyword_yield = 286,           /* keyword_yield  */
+    keyword_super = 287,           /* keyword_super  */
+    keyword_self = 288,            /* keyword_self  */
+    keyword_nil = 289,             /* keyword_nil  */
+    keyword_true = 290,            /* keyword_true  */
+    keyword_false = 291,           /* keyword_false  */
+    keyword_and = 292,             /* keyword_and  */
+    keyword_or = 293,              /* keyword_or  */
+    keyword_not = 294,             /* keyword_not  */
+    modifier_if = 295,             /* modifier_if  */
+    modifier_unless = 296,         /* modifier_unless  */
+    modifier_while = 297,          /* modifier_while  */
+    modifier_until = 298,          /* modifier_until  */
+    modifier_rescue = 299,         /* modifier_rescue  */
+    keyword_alias = 300,           /* keyword_alias  */
+    keyword_BEGIN = 301,           /* keyword_BEGIN  */
+    keyword_END = 302,             /* keyword_END  */
+    keyword__LINE__ = 303,         /* keyword__LINE__  */
+    keyword__FILE__ = 304,         /* keyword__FILE__  */
+    keyword__ENCODING__ = 305,     /* keyword__ENCODING__  */
+    tIDENTIFIER = 306,             /* tIDENTIFIER  */
+    tFID = 307,                    /* tFID  */
+    tGVAR = 308,                   /* tGVAR  */
+    tIVAR = 309,                   /* tIVAR  */
+    tCONSTANT = 310,               /* tCONSTANT  */
+    tCVAR = 311,                   /* tCVAR  */
+    tLABEL = 312,                  /* tLABEL  */
+    tINTEGER = 313,                /* tINTEGER  */
+    tFLOAT = 314,                  /* tFLOAT  */
+    tCHAR = 315,                   /* tCHAR  */
+    tXSTRING = 316,                /* tXSTRING  */
+    tREGEXP = 317,                 /* tREGEXP  */
+    tSTRING = 318,                 /* tSTRING  */
+    tSTRING_PART = 319,            /* tSTRING_PART  */
+    tSTRING_MID = 320,             /* tSTRING_MID  */
+    tNTH_REF = 321,                /* tNTH_REF  */
+    tBACK_REF = 322,               /* tBACK_REF  */
+    tREGEXP_END = 323,             /* tREGEXP_END  */
+    tUPLUS = 324,                  /* tUPLUS  */
+    tUMINUS = 325,                 /* tUMINUS  */
+    tPOW = 326,                    /* tPOW  */
+    tCMP = 327,                    /* tCMP  */
+    tEQ = 328,                     /* tEQ  */
+    tEQQ = 329,                    /* tEQQ  */
+    tNEQ = 330,                    /* tNEQ  */
+    tGEQ = 331,                    /* tGEQ  */
+    tLEQ = 332,                    /* tLEQ  */
+    tANDOP = 333,                  /* tANDOP  */
+    tOROP = 334,                   /* tOROP  */
+    tMATCH = 335,                  /* tMATCH  */
+    tNMATCH = 336,                 /* tNMATCH  */
+    tDOT2 = 337,                   /* tDOT2  */
+    tDOT3 = 338,                   /* tDOT3  */
+    tAREF = 339,                   /* tAREF  */
+    tASET = 340,                   /* tASET  */
+    tLSHFT = 341,                  /* tLSHFT  */
+    tRSHFT = 342,                  /* tRSHFT  */
+    tCOLON2 = 343,                 /* tCOLON2  */
+    tCOLON3 = 344,                 /* tCOLON3  */
+    tOP_ASGN = 345,                /* tOP_ASGN  */
+    tASSOC = 346,                  /* tASSOC  */
+    tLPAREN = 347,                 /* tLPAREN  */
+    tLPAREN_ARG = 348,             /* tLPAREN_ARG  */
+    tRPAREN = 349,                 /* tRPAREN  */
+    tLBRACK = 350,                 /* tLBRACK  */
+    tLBRACE = 351,                 /* tLBRACE  */
+    tLBRACE_ARG = 352,             /* tLBRACE_ARG  */
+    tSTAR = 353,                   /* tSTAR  */
+    tAMPER = 354,                  /* tAMPER  */
+    tLAMBDA = 355,                 /* tLAMBDA  */
+    tSYMBEG = 356,                 /* tSYMBEG  */
+    tREGEXP_BEG = 357,             /* tREGEXP_BEG  */
+    tWORDS_BEG = 358,              /* tWORDS_BEG  */
+    tSYMBOLS_BEG = 359,            /* tSYMBOLS_BEG  */
+    tSTRING_BEG = 360,             /* tSTRING_BEG  */
+    tXSTRING_BEG = 361,            /* tXSTRING_BEG  */
+    tSTRING_DVAR = 362,            /* tSTRING_DVAR  */
+    tLAMBEG = 363,                 /* tLAMBEG  */
+    tHEREDOC_BEG = 364,            /* tHEREDOC_BEG  */
+    tHEREDOC_END = 365,            /* tHEREDOC_END  */
+    tLITERAL_DELIM = 366,          /* tLITERAL_DELIM  */
+    tLOWEST = 367,                 /* tLOWEST  */
+    tUMINUS_NUM = 368,             /* tUMINUS_NUM  */
+    idNULL = 369,                  /* idNULL  */
+    idRespond_to = 370,            /* idRespond_to  */
+    idIFUNC = 371,                 /* idIFUNC  */
+    idCFUNC = 372,                 /* idCFUNC  */
+    id_core_set_method_alias = 373, /* id_core_set_method_alias  */
+    id_core_set_variable_alias = 374, /* id_core_set_variable_alias  */
+    id_core_undef_method = 375,    /* id_core_undef_method  */
+    id_core_define_method = 376,   /* id_core_define_method  */
+    id_core_define_singleton_method = 377, /* id_core_define_singleton_method  */
+    id_core_set_postexe = 378,     /* id_core_set_postexe  */
+    tLAST_TOKEN = 379              /* tLAST_TOKEN  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 940 "src/parse.y"
+
+    node *nd;
+    mrb_sym id;
+    int num;
+    unsigned int stack;
+    const struct vtable *vars;
+
+#line 1179 "/root/repo/build/host/src/y.tab.c"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+
+
+int yyparse (parser_state *p);
+
+
+
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_keyword_class = 3,              /* keyword_class  */
+  YYSYMBOL_keyword_module = 4,             /* keyword_module  */
+  YYSYMBOL_keyword_def = 5,                /* keyword_def  */
+  YYSYMBOL_keyword_undef = 6,              /* keyword_undef  */
+  YYSYMBOL_keyword_begin = 7,              /* keyword_begin  */
+  YYSYMBOL_keyword_rescue = 8,             /* keyword_rescue  */
+  YYSYMBOL_keyword_ensure = 9,             /* keyword_ensure  */
+  YYSYMBOL_keyword_end = 10,               /* keyword_end  */
+  YYSYMBOL_keyword_if = 11,                /* keyword_if  */
+  YYSYMBOL_keyword_unless = 12,            /* keyword_unless  */
+  YYSYMBOL_keyword_then = 13,              /* keyword_then  */
+  YYSYMBOL_keyword_elsif = 14,             /* keyword_elsif  */
+  YYSYMBOL_keyword_else = 15,              /* keyword_else  */
+  YYSYMBOL_keyword_case = 16,              /* keyword_case  */
+  YYSYMBOL_keyword_when = 17,              /* keyword_when  */
+  YYSYMBOL_keyword_while = 18,             /* keyword_while  */
+  YYSYMBOL_keyword_until = 19,             /* keyword_until  */
+  YYSYMBOL_keyword_for = 20,               /* keyword_for  */
+  YYSYMBOL_keyword_break = 21,             /* keyword_break  */
+  YYSYMBOL_keyword_next = 22,              /* keyword_next  */
+  YYSYMBOL_keyword_redo = 23,              /* keyword_redo  */
+  YYSYMBOL_keyword_retry = 24,             /* keyword_retry  */
+  YYSYMBOL_keyword_in = 25,                /* keyword_in  */
+  YYSYMBOL_keyword_do = 26,                /* keyword_do  */
+  YYSYMBOL_keyword_do_cond = 27,           /* keyword_do_cond  */
+  YYSYMBOL_keyword_do_block = 28,          /* keyword_do_block  */
+  YYSYMBOL_keyword_do_LAMBDA = 29,         /* keyword_do_LAMBDA  */
+  YYSYMBOL_keyword_return = 30,            /* keyword_return  */
+  YYSYMBOL_keyword_yield = 31,             /* keyword_yield  */
+  YYSYMBOL_keyword_super = 32,             /* keyword_super  */
+  YYSYMBOL_keyword_self = 33,              /* keyword_self  */
+  YYSYMBOL_keyword_nil = 34,               /* keyword_nil  */
+  YYSYMBOL_keyword_true = 35,              /* keyword_true  */
+  YYSYMBOL_keyword_false = 36,             /* keyword_false  */
+  YYSYMBOL_keyword_and = 37,               /* keyword_and  */
+  YYSYMBOL_keyword_or = 38,                /* keyword_or  */
+  YYSYMBOL_keyword_not = 39,               /* keyword_not  */
+  YYSYMBOL_modifier_if = 40,               /* modifier_if  */
+  YYSYMBOL_modifier_unless = 41,           /* modifier_unless  */
+  YYSYMBOL_modifier_while = 42,            /* modifier_while  */
+  YYSYMBOL_modifier_until = 43,            /* modifier_until  */
+  YYSYMBOL_modifier_rescue = 44,           /* modifier_rescue  */
+  YYSYMBOL_keyword_alias = 45,             /* keyword_alias  */
+  YYSYMBOL_keyword_BEGIN = 46,             /* keyword_BEGIN  */
+  YYSYMBOL_keyword_END = 47,               /* keyword_END  */
+  YYSYMBOL_keyword__LINE__ = 48,           /* keyword__LINE__  */
+  YYSYMBOL_keyword__FILE__ = 49,           /* keyword__FILE__  */
+  YYSYMBOL_keyword__ENCODING__ = 50,       /* keyword__ENCODING__  */
+  YYSYMBOL_tIDENTIFIER = 51,               /* tIDENTIFIER  */
+  YYSYMBOL_tFID = 52,                      /* tFID  */
+  YYSYMBOL_tGVAR = 53,                     /* tGVAR  */
+  YYSYMBOL_tIVAR = 54,                     /* tIVAR  */
+  YYSYMBOL_tCONSTANT = 55,                 /* tCONSTANT  */
+  YYSYMBOL_tCVAR = 56,                     /* tCVAR  */
+  YYSYMBOL_tLABEL = 57,                    /* tLABEL  */
+  YYSYMBOL_tINTEGER = 58,                  /* tINTEGER  */
+  YYSYMBOL_tFLOAT = 59,                    /* tFLOAT  */
+  YYSYMBOL_tCHAR = 60,                     /* tCHAR  */
+  YYSYMBOL_tXSTRING = 61,                  /* tXSTRING  */
+  YYSYMBOL_tREGEXP = 62,                   /* tREGEXP  */
+  YYSYMBOL_tSTRING = 63,                   /* tSTRING  */
+  YYSYMBOL_tSTRING_PART = 64,              /* tSTRING_PART  */
+  YYSYMBOL_tSTRING_MID = 65,               /* tSTRING_MID  */
+  YYSYMBOL_tNTH_REF = 66,                  /* tNTH_REF  */
+  YYSYMBOL_tBACK_REF = 67,                 /* tBACK_REF  */
+  YYSYMBOL_tREGEXP_END = 68,               /* tREGEXP_END  */
+  YYSYMBOL_tUPLUS = 69,                    /* tUPLUS  */
+  YYSYMBOL_tUMINUS = 70,                   /* tUMINUS  */
+  YYSYMBOL_tPOW = 71,                      /* tPOW  */
+  YYSYMBOL_tCMP = 72,                      /* tCMP  */
+  YYSYMBOL_tEQ = 73,                       /* tEQ  */
+  YYSYMBOL_tEQQ = 74,                      /* tEQQ  */
+  YYSYMBOL_tNEQ = 75,                      /* tNEQ  */
+  YYSYMBOL_tGEQ = 76,                      /* tGEQ  */
+  YYSYMBOL_tLEQ = 77,                      /* tLEQ  */
+  YYSYMBOL_tANDOP = 78,                    /* tANDOP  */
+  YYSYMBOL_tOROP = 79,                     /* tOROP  */
+  YYSYMBOL_tMATCH = 80,                    /* tMATCH  */
+  YYSYMBOL_tNMATCH = 81,                   /* tNMATCH  */
+  YYSYMBOL_tDOT2 = 82,                     /* tDOT2  */
+  YYSYMBOL_tDOT3 = 83,                     /* tDOT3  */
+  YYSYMBOL_tAREF = 84,                     /* tAREF  */
+  YYSYMBOL_tASET = 85,                     /* tASET  */
+  YYSYMBOL_tLSHFT = 86,                    /* tLSHFT  */
+  YYSYMBOL_tRSHFT = 87,                    /* tRSHFT  */
+  YYSYMBOL_tCOLON2 = 88,                   /* tCOLON2  */
+  YYSYMBOL_tCOLON3 = 89,                   /* tCOLON3  */
+  YYSYMBOL_tOP_ASGN = 90,                  /* tOP_ASGN  */
+  YYSYMBOL_tASSOC = 91,                    /* tASSOC  */
+  YYSYMBOL_tLPAREN = 92,                   /* tLPAREN  */
+  YYSYMBOL_tLPAREN_ARG = 93,               /* tLPAREN_ARG  */
+  YYSYMBOL_tRPAREN = 94,                   /* tRPAREN  */
+  YYSYMBOL_tLBRACK = 95,                   /* tLBRACK  */
+  YYSYMBOL_tLBRACE = 96,                   /* tLBRACE  */
+  YYSYMBOL_tLBRACE_ARG = 97,               /* tLBRACE_ARG  */
+  YYSYMBOL_tSTAR = 98,                     /* tSTAR  */
+  YYSYMBOL_tAMPER = 99,                    /* tAMPER  */
+  YYSYMBOL_tLAMBDA = 100,                  /* tLAMBDA  */
+  YYSYMBOL_tSYMBEG = 101,                  /* tSYMBEG  */
+  YYSYMBOL_tREGEXP_BEG = 102,              /* tREGEXP_BEG  */
+  YYSYMBOL_tWORDS_BEG = 103,               /* tWORDS_BEG  */
+  YYSYMBOL_tSYMBOLS_BEG = 104,             /* tSYMBOLS_BEG  */
+  YYSYMBOL_tSTRING_BEG = 105,              /* tSTRING_BEG  */
+  YYSYMBOL_tXSTRING_BEG = 106,             /* tXSTRING_BEG  */
+  YYSYMBOL_tSTRING_DVAR = 107,             /* tSTRING_DVAR  */
+  YYSYMBOL_tLAMBEG = 108,                  /* tLAMBEG  */
+  YYSYMBOL_tHEREDOC_BEG = 109,             /* tHEREDOC_BEG  */
+  YYSYMBOL_tHEREDOC_END = 110,             /* tHEREDOC_END  */
+  YYSYMBOL_tLITERAL_DELIM = 111,           /* tLITERAL_DELIM  */
+  YYSYMBOL_tLOWEST = 112,                  /* tLOWEST  */
+  YYSYMBOL_113_ = 113,                     /* '='  */
+  YYSYMBOL_114_ = 114,                     /* '?'  */
+  YYSYMBOL_115_ = 115,                     /* ':'  */
+  YYSYMBOL_116_ = 116,                     /* '>'  */
+  YYSYMBOL_117_ = 117,                     /* '<'  */
+  YYSYMBOL_118_ = 118,                     /* '|'  */
+  YYSYMBOL_119_ = 119,                     /* '^'  */
+  YYSYMBOL_120_ = 120,                     /* '&'  */
+  YYSYMBOL_121_ = 121,                     /* '+'  */
+  YYSYMBOL_122_ = 122,                     /* '-'  */
+  YYSYMBOL_123_ = 123,                     /* '*'  */
+  YYSYMBOL_124_ = 124,                     /* '/'  */
+  YYSYMBOL_125_ = 125,                     /* '%'  */
+  YYSYMBOL_tUMINUS_NUM = 126,              /* tUMINUS_NUM  */
+  YYSYMBOL_127_ = 127,                     /* '!'  */
+  YYSYMBOL_128_ = 128,                     /* '~'  */
+  YYSYMBOL_idNULL = 129,                   /* idNULL  */
+  YYSYMBOL_idRespond_to = 130,             /* idRespond_to  */
+  YYSYMBOL_idIFUNC = 131,                  /* idIFUNC  */
+  YYSYMBOL_idCFUNC = 132,                  /* idCFUNC  */
+  YYSYMBOL_id_core_set_method_alias = 133, /* id_core_set_method_alias  */
+  YYSYMBOL_id_core_set_variable_alias = 134, /* id_core_set_variable_alias  */
+  YYSYMBOL_id_core_undef_method = 135,     /* id_core_undef_method  */
+  YYSYMBOL_id_core_define_method = 136,    /* id_core_define_method  */
+  YYSYMBOL_id_core_define_singleton_method = 137, /* id_core_define_singleton_method  */
+  YYSYMBOL_id_core_set_postexe = 138,      /* id_core_set_postexe  */
+  YYSYMBOL_tLAST_TOKEN = 139,              /* tLAST_TOKEN  */
+  YYSYMBOL_140_ = 140,                     /* '{'  */
+  YYSYMBOL_141_ = 141,                     /* '}'  */
+  YYSYMBOL_142_ = 142,                     /* '['  */
+  YYSYMBOL_143_ = 143,                     /* '.'  */
+  YYSYMBOL_144_ = 144,                     /* ','  */
+  YYSYMBOL_145_ = 145,                     /* '`'  */
+  YYSYMBOL_146_ = 146,                     /* '('  */
+  YYSYMBOL_147_ = 147,                     /* ')'  */
+  YYSYMBOL_148_ = 148,                     /* ']'  */
+  YYSYMBOL_149_ = 149,                     /* ';'  */
+  YYSYMBOL_150_n_ = 150,                   /* '\n'  */
+  YYSYMBOL_YYACCEPT = 151,                 /* $accept  */
+  YYSYMBOL_program = 152,                  /* program  */
+  YYSYMBOL_153_1 = 153,                    /* $@1  */
+  YYSYMBOL_top_compstmt = 154,             /* top_compstmt  */
+  YYSYMBOL_top_stmts = 155,                /* top_stmts  */
+  YYSYMBOL_top_stmt = 156,                 /* top_stmt  */
+  YYSYMBOL_157_2 = 157,                    /* @2  */
+  YYSYMBOL_bodystmt = 158,                 /* bodystmt  */
+  YYSYMBOL_compstmt = 159,                 /* compstmt  */
+  YYSYMBOL_stmts = 160,                    /* stmts  */
+  YYSYMBOL_stmt = 161,                     /* stmt  */
+  YYSYMBOL_162_3 = 162,                    /* $@3  */
+  YYSYMBOL_command_asgn = 163,             /* command_asgn  */
+  YYSYMBOL_expr = 164,                     /* expr  */
+  YYSYMBOL_expr_value = 165,               /* expr_value  */
+  YYSYMBOL_command_call = 166,             /* command_call  */
+  YYSYMBOL_block_command = 167,            /* block_command  */
+  YYSYMBOL_cmd_brace_block = 168,          /* cmd_brace_block  */
+  YYSYMBOL_169_4 = 169,                    /* $@4  */
+  YYSYMBOL_command = 170,                  /* command  */
+  YYSYMBOL_mlhs = 171,                     /* mlhs  */
+  YYSYMBOL_mlhs_inner = 172,               /* mlhs_inner  */
+  YYSYMBOL_mlhs_basic = 173,               /* mlhs_basic  */
+  YYSYMBOL_mlhs_item = 174,                /* mlhs_item  */
+  YYSYMBOL_mlhs_list = 175,                /* mlhs_list  */
+  YYSYMBOL_mlhs_post = 176,                /* mlhs_post  */
+  YYSYMBOL_mlhs_node = 177,                /* mlhs_node  */
+  YYSYMBOL_lhs = 178,                      /* lhs  */
+  YYSYMBOL_cname = 179,                    /* cname  */
+  YYSYMBOL_cpath = 180,                    /* cpath  */
+  YYSYMBOL_fname = 181,                    /* fname  */
+  YYSYMBOL_fsym = 182,                     /* fsym  */
+  YYSYMBOL_undef_list = 183,               /* undef_list  */
+  YYSYMBOL_184_5 = 184,                    /* $@5  */
+  YYSYMBOL_op = 185,                       /* op  */
+  YYSYMBOL_reswords = 186,                 /* reswords  */
+  YYSYMBOL_arg = 187,                      /* arg  */
+  YYSYMBOL_arg_value = 188,                /* arg_value  */
+  YYSYMBOL_aref_args = 189,                /* aref_args  */
+  YYSYMBOL_paren_args = 190,               /* paren_args  */
+  YYSYMBOL_opt_paren_args = 191,           /* opt_paren_args  */
+  YYSYMBOL_opt_call_args = 192,            /* opt_call_args  */
+  YYSYMBOL_call_args = 193,                /* call_args  */
+  YYSYMBOL_command_args = 194,             /* command_args  */
+  YYSYMBOL_195_6 = 195,                    /* @6  */
+  YYSYMBOL_block_arg = 196,                /* block_arg  */
+  YYSYMBOL_opt_block_arg = 197,            /* opt_block_arg  */
+  YYSYMBOL_args = 198,                     /* args  */
+  YYSYMBOL_mrhs = 199,                     /* mrhs  */
+  YYSYMBOL_primary = 200,                  /* primary  */
+  YYSYMBOL_201_7 = 201,                    /* $@7  */
+  YYSYMBOL_202_8 = 202,                    /* $@8  */
+  YYSYMBOL_203_9 = 203,                    /* $@9  */
+  YYSYMBOL_204_10 = 204,                   /* @10  */
+  YYSYMBOL_205_11 = 205,                   /* $@11  */
+  YYSYMBOL_206_12 = 206,                   /* $@12  */
+  YYSYMBOL_207_13 = 207,                   /* $@13  */
+  YYSYMBOL_208_14 = 208,                   /* $@14  */
+  YYSYMBOL_209_15 = 209,                   /* $@15  */
+  YYSYMBOL_210_16 = 210,                   /* $@16  */
+  YYSYMBOL_211_17 = 211,                   /* @17  */
+  YYSYMBOL_212_18 = 212,                   /* @18  */
+  YYSYMBOL_213_19 = 213,                   /* @19  */
+  YYSYMBOL_214_20 = 214,                   /* @20  */
+  YYSYMBOL_215_21 = 215,                   /* @21  */
+  YYSYMBOL_216_22 = 216,                   /* $@22  */
+  YYSYMBOL_217_23 = 217,                   /* @23  */
+  YYSYMBOL_primary_value = 218,            /* primary_value  */
+  YYSYMBOL_then = 219,                     /* then  */
+  YYSYMBOL_do = 220,                       /* do  */
+  YYSYMBOL_if_tail = 221,                  /* if_tail  */
+  YYSYMBOL_opt_else = 222,                 /* opt_else  */
+  YYSYMBOL_for_var = 223,                  /* for_var  */
+  YYSYMBOL_f_marg = 224,                   /* f_marg  */
+  YYSYMBOL_f_marg_list = 225,              /* f_marg_list  */
+  YYSYMBOL_f_margs = 226,                  /* f_margs  */
+  YYSYMBOL_block_param = 227,              /* block_param  */
+  YYSYMBOL_opt_block_param = 228,          /* opt_block_param  */
+  YYSYMBOL_block_param_def = 229,          /* block_param_def  */
+  YYSYMBOL_opt_bv_decl = 230,              /* opt_bv_decl  */
+  YYSYMBOL_bv_decls = 231,                 /* bv_decls  */
+  YYSYMBOL_bvar = 232,                     /* bvar  */
+  YYSYMBOL_f_larglist = 233,               /* f_larglist  */
+  YYSYMBOL_lambda_body = 234,              /* lambda_body  */
+  YYSYMBOL_do_block = 235,                 /* do_block  */
+  YYSYMBOL_236_24 = 236,                   /* $@24  */
+  YYSYMBOL_block_call = 237,               /* block_call  */
+  YYSYMBOL_method_call = 238,              /* method_call  */
+  YYSYMBOL_brace_block = 239,              /* brace_block  */
+  YYSYMBOL_240_25 = 240,                   /* $@25  */
+  YYSYMBOL_241_26 = 241,                   /* $@26  */
+  YYSYMBOL_case_body = 242,                /* case_body  */
+  YYSYMBOL_cases = 243,                    /* cases  */
+  YYSYMBOL_opt_rescue = 244,               /* opt_rescue  */
+  YYSYMBOL_exc_list = 245,                 /* exc_list  */
+  YYSYMBOL_exc_var = 246,                  /* exc_var  */
+  YYSYMBOL_opt_ensure = 247,               /* opt_ensure  */
+  YYSYMBOL_literal = 248,                  /* literal  */
+  YYSYMBOL_string = 249,                   /* string  */
+  YYSYMBOL_string_rep = 250,               /* string_rep  */
+  YYSYMBOL_string_interp = 251,            /* string_interp  */
+  YYSYMBOL_252_27 = 252,                   /* @27  */
+  YYSYMBOL_xstring = 253,                  /* xstring  */
+  YYSYMBOL_regexp = 254,                   /* regexp  */
+  YYSYMBOL_heredoc = 255,                  /* heredoc  */
+  YYSYMBOL_opt_heredoc_bodies = 256,       /* opt_heredoc_bodies  */
+  YYSYMBOL_heredoc_bodies = 257,           /* heredoc_bodies  */
+  YYSYMBOL_heredoc_body = 258,             /* heredoc_body  */
+  YYSYMBOL_words = 259,                    /* words  */
+  YYSYMBOL_symbol = 260,                   /* symbol  */
+  YYSYMBOL_basic_symbol = 261,             /* basic_symbol  */
+  YYSYMBOL_sym = 262,                      /* sym  */
+  YYSYMBOL_symbols = 263,                  /* symbols  */
+  YYSYMBOL_numeric = 264,                  /* numeric  */
+  YYSYMBOL_variable = 265,                 /* variable  */
+  YYSYMBOL_var_lhs = 266,                  /* var_lhs  */
+  YYSYMBOL_var_ref = 267,                  /* var_ref  */
+  YYSYMBOL_backref = 268,                  /* backref  */
+  YYSYMBOL_superclass = 269,               /* superclass  */
+  YYSYMBOL_270_28 = 270,                   /* $@28  */
+  YYSYMBOL_f_arglist = 271,                /* f_arglist  */
+  YYSYMBOL_f_args = 272,                   /* f_args  */
+  YYSYMBOL_f_bad_arg = 273,                /* f_bad_arg  */
+  YYSYMBOL_f_norm_arg = 274,               /* f_norm_arg  */
+  YYSYMBOL_f_arg_item = 275,               /* f_arg_item  */
+  YYSYMBOL_f_arg = 276,                    /* f_arg  */
+  YYSYMBOL_f_opt = 277,                    /* f_opt  */
+  YYSYMBOL_f_block_opt = 278,              /* f_block_opt  */
+  YYSYMBOL_f_block_optarg = 279,           /* f_block_optarg  */
+  YYSYMBOL_f_optarg = 280,                 /* f_optarg  */
+  YYSYMBOL_restarg_mark = 281,             /* restarg_mark  */
+  YYSYMBOL_f_rest_arg = 282,               /* f_rest_arg  */
+  YYSYMBOL_blkarg_mark = 283,              /* blkarg_mark  */
+  YYSYMBOL_f_block_arg = 284,              /* f_block_arg  */
+  YYSYMBOL_opt_f_block_arg = 285,          /* opt_f_block_arg  */
+  YYSYMBOL_singleton = 286,                /* singleton  */
+  YYSYMBOL_287_29 = 287,                   /* $@29  */
+  YYSYMBOL_assoc_list = 288,               /* assoc_list  */
+  YYSYMBOL_assocs = 289,                   /* assocs  */
+  YYSYMBOL_assoc = 290,                    /* assoc  */
+  YYSYMBOL_operation = 291,                /* operation  */
+  YYSYMBOL_operation2 = 292,               /* operation2  */
+  YYSYMBOL_operation3 = 293,               /* operation3  */
+  YYSYMBOL_dot_or_colon = 294,             /* dot_or_colon  */
+  YYSYMBOL_opt_terms = 295,                /* opt_terms  */
+  YYSYMBOL_opt_nl = 296,                   /* opt_nl  */
+  YYSYMBOL_rparen = 297,                   /* rparen  */
+  YYSYMBOL_rbracket = 298,                 /* rbracket  */
+  YYSYMBOL_trailer = 299,                  /* trailer  */
+  YYSYMBOL_term = 300,                     /* term  */
+  YYSYMBOL_nl = 301,                       /* nl  */
+  YYSYMBOL_302_30 = 302,                   /* $@30  */
+  YYSYMBOL_terms = 303,                    /* terms  */
+  YYSYMBOL_none = 304                      /* none  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  3
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   10895
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  151
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  154
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  544
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  956
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   379
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_uint8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+     150,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,   127,     2,     2,     2,   125,   120,     2,
+     146,   147,   123,   121,   144,   122,   143,   124,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,   115,   149,
+     117,   113,   116,   114,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,   142,     2,   148,   119,     2,   145,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,   140,   118,   141,   128,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   126,   129,
+     130,   131,   132,   133,   134,   135,   136,   137,   138,   139
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,  1098,  1098,  1098,  1108,  1114,  1118,  1122,  1126,  1132,
+    1134,  1133,  1145,  1171,  1177,  1181,  1185,  1189,  1195,  1195,
+    1199,  1203,  1207,  1211,  1215,  1219,  1223,  1228,  1229,  1233,
+    1237,  1241,  1245,  1249,  1254,  1258,  1263,  1267,  1271,  1275,
+    1278,  1282,  1289,  1290,  1294,  1298,  1302,  1306,  1309,  1316,
+    1317,  1320,  1321,  1325,  1324,  1337,  1341,  1346,  1350,  1355,
+    1359,  1364,  1368,  1372,  1376,  1380,  1386,  1390,  1396,  1397,
+    1403,  1407,  1411,  1415,  1419,  1423,  1427,  1431,  1435,  1439,
+    1445,  1446,  1452,  1456,  1462,  1466,  1472,  1476,  1480,  1484,
+    1488,  1492,  1498,  1504,  1511,  1515,  1519,  1523,  1527,  1531,
+    1537,  1543,  1550,  1554,  1557,  1561,  1565,  1571,  1572,  1573,
+    1574,  1579,  1586,  1587,  1590,  1594,  1594,  1600,  1601,  1602,
+    1603,  1604,  1605,  1606,  1607,  1608,  1609,  1610,  1611,  1612,
+    1613,  1614,  1615,  1616,  1617,  1618,  1619,  1620,  1621,  1622,
+    1623,  1624,  1625,  1626,  1627,  1628,  1631,  1631,  1631,  1632,
+    1632,  1633,  1633,  1633,  1634,  1634,  1634,  1634,  1635,  1635,
+    1635,  1636,  1636,  1636,  1637,  1637,  1637,  1637,  1638,  1638,
+    1638,  1638,  1639,  1639,  1639,  1639,  1640,  1640,  1640,  1640,
+    1641,  1641,  1641,  1641,  1642,  1642,  1645,  1649,  1653,  1657,
+    1661,  1665,  1669,  1673,  1677,  1682,  1687,  1692,  1696,  1700,
+    1704,  1708,  1712,  1716,  1720,  1724,  1728,  1732,  1736,  1740,
+    1744,  1748,  1752,  1756,  1760,  1764,  1768,  1772,  1776,  1780,
+    1784,  1788,  1792,  1796,  1800,  1804,  1808,  1812,  1816,  1820,
+    1826,  1833,  1834,  1838,  1842,  1848,  1854,  1855,  1858,  1859,
+    1860,  1864,  1868,  1874,  1878,  1882,  1886,  1890,  1896,  1896,
+    1907,  1913,  1917,  1923,  1927,  1931,  1935,  1941,  1945,  1949,
+    1955,  1956,  1957,  1958,  1959,  1960,  1961,  1962,  1967,  1966,
+    1977,  1977,  1981,  1981,  1985,  1989,  1993,  1997,  2001,  2005,
+    2009,  2013,  2017,  2021,  2025,  2029,  2033,  2034,  2040,  2039,
+    2052,  2059,  2066,  2066,  2066,  2072,  2072,  2072,  2078,  2084,
+    2089,  2091,  2088,  2098,  2097,  2110,  2115,  2109,  2128,  2127,
+    2140,  2139,  2152,  2153,  2152,  2166,  2170,  2174,  2178,  2184,
+    2191,  2192,  2193,  2196,  2197,  2200,  2201,  2209,  2210,  2216,
+    2220,  2223,  2227,  2233,  2237,  2243,  2247,  2251,  2255,  2259,
+    2263,  2267,  2271,  2275,  2281,  2285,  2289,  2293,  2297,  2301,
+    2305,  2309,  2313,  2317,  2321,  2325,  2329,  2333,  2337,  2343,
+    2344,  2351,  2356,  2361,  2368,  2372,  2378,  2379,  2382,  2387,
+    2390,  2394,  2400,  2404,  2411,  2410,  2423,  2433,  2437,  2442,
+    2449,  2453,  2457,  2461,  2465,  2469,  2473,  2477,  2481,  2488,
+    2487,  2498,  2497,  2509,  2517,  2526,  2529,  2536,  2539,  2543,
+    2544,  2547,  2551,  2554,  2558,  2561,  2562,  2563,  2564,  2567,
+    2568,  2569,  2573,  2579,  2580,  2586,  2591,  2590,  2601,  2607,
+    2611,  2617,  2621,  2627,  2630,  2631,  2634,  2635,  2638,  2643,
+    2650,  2654,  2661,  2665,  2672,  2679,  2680,  2681,  2682,  2683,
+    2687,  2693,  2697,  2703,  2704,  2705,  2709,  2715,  2719,  2723,
+    2727,  2731,  2737,  2743,  2747,  2751,  2755,  2759,  2763,  2770,
+    2779,  2780,  2783,  2788,  2787,  2796,  2803,  2809,  2815,  2819,
+    2823,  2827,  2831,  2835,  2839,  2843,  2847,  2851,  2855,  2859,
+    2863,  2867,  2872,  2878,  2883,  2888,  2893,  2900,  2904,  2911,
+    2915,  2921,  2925,  2931,  2938,  2945,  2949,  2955,  2959,  2965,
+    2966,  2969,  2974,  2981,  2982,  2985,  2992,  2996,  3003,  3008,
+    3008,  3033,  3034,  3040,  3044,  3050,  3054,  3060,  3061,  3062,
+    3065,  3066,  3067,  3068,  3071,  3072,  3073,  3076,  3077,  3080,
+    3081,  3084,  3085,  3088,  3091,  3094,  3095,  3096,  3099,  3100,
+    3104,  3103,  3110,  3111,  3115
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "keyword_class",
+  "keyword_module", "keyword_def", "keyword_undef", "keyword_begin",
+  "keyword_rescue", "keyword_ensure", "keyword_end", "keyword_if",
+  "keyword_unless", "keyword_then", "keyword_elsif", "keyword_else",
+  "keyword_case", "keyword_when", "keyword_while", "keyword_until",
+  "keyword_for", "keyword_break", "keyword_next", "keyword_redo",
+  "keyword_retry", "keyword_in", "keyword_do", "keyword_do_cond",
+  "keyword_do_block", "keyword_do_LAMBDA", "keyword_return",
+  "keyword_yield", "keyword_super", "keyword_self", "keyword_nil",
+  "keyword_true", "keyword_false", "keyword_and", "keyword_or",
+  "keyword_not", "modifier_if", "modifier_unless", "modifier_while",
+  "modifier_until", "modifier_rescue", "keyword_alias", "keyword_BEGIN",
+  "keyword_END", "keyword__LINE__", "keyword__FILE__",
+  "keyword__ENCODING__", "tIDENTIFIER", "tFID", "tGVAR", "tIVAR",
+  "tCONSTANT", "tCVAR", "tLABEL", "tINTEGER", "tFLOAT", "tCHAR",
+  "tXSTRING", "tREGEXP", "tSTRING", "tSTRING_PART", "tSTRING_MID",
+  "tNTH_REF", "tBACK_REF", "tREGEXP_END", "tUPLUS", "tUMINUS", "tPOW",
+  "tCMP", "tEQ", "tEQQ", "tNEQ", "tGEQ", "tLEQ", "tANDOP", "tOROP",
+  "tMATCH", "tNMATCH", "tDOT2", "tDOT3", "tAREF", "tASET", "tLSHFT",
+  "tRSHFT", "tCOLON2", "tCOLON3", "tOP_ASGN", "tASSOC", "tLPAREN",
+  "tLPAREN_ARG", "tRPAREN", "tLBRACK", "tLBRACE", "tLBRACE_ARG", "tSTAR",
+  "tAMPER", "tLAMBDA", "tSYMBEG", "tREGEXP_BEG", "tWORDS_BEG",
+  "tSYMBOLS_BEG", "tSTRING_BEG", "tXSTRING_BEG", "tSTRING_DVAR", "tLAMBEG",
+  "tHEREDOC_BEG", "tHEREDOC_END", "tLITERAL_DELIM", "tLOWEST", "'='",
+  "'?'", "':'", "'>'", "'<'", "'|'", "'^'", "'&'", "'+'", "'-'", "'*'",
+  "'/'", "'%'", "tUMINUS_NUM", "'!'", "'~'", "idNULL", "idRespond_to",
+  "idIFUNC", "idCFUNC", "id_core_set_method_alias",
+  "id_core_set_variable_alias", "id_core_undef_method",
+  "id_core_define_method", "id_core_define_singleton_method",
+  "id_core_set_postexe", "tLAST_TOKEN", "'{'", "'}'", "'['", "'.'", "','",
+  "'`'", "'('", "')'", "']'", "';'", "'\\n'", "$accept", "program", "$@1",
+  "top_compstmt", "top_stmts", "top_stmt", "@2", "bodystmt", "compstmt",
+  "stmts", "stmt", "$@3", "command_asgn", "expr", "expr_value",
+  "command_call", "block_command", "cmd_brace_block", "$@4", "command",
+  "mlhs", "mlhs_inner", "mlhs_basic", "mlhs_item", "mlhs_list",
+  "mlhs_post", "mlhs_node", "lhs", "cname", "cpath", "fname", "fsym",
+  "undef_list", "$@5", "op", "reswords", "arg", "arg_value", "aref_args",
+  "paren_args", "opt_paren_args", "opt_call_args", "call_args",
+  "command_args", "@6", "block_arg", "opt_block_arg", "args", "mrhs",
+  "primary", "$@7", "$@8", "$@9", "@10", "$@11", "$@12", "$@13", "$@14",
+  "$@15", "$@16", "@17", "@18", "@19", "@20", "@21", "$@22", "@23",
+  "primary_value", "then", "do", "if_tail", "opt_else", "for_var",
+  "f_marg", "f_marg_list", "f_margs", "block_param", "opt_block_param",
+  "block_param_def", "opt_bv_decl", "bv_decls", "bvar", "f_larglist",
+  "lambda_body", "do_block", "$@24", "block_call", "method_call",
+  "brace_block", "$@25", "$@26", "case_body", "cases", "opt_rescue",
+  "exc_list", "exc_var", "opt_ensure", "literal", "string", "string_rep",
+  "string_interp", "@27", "xstring", "regexp", "heredoc",
+  "opt_heredoc_bodies", "heredoc_bodies", "heredoc_body", "words",
+  "symbol", "basic_symbol", "sym", "symbols", "numeric", "variable",
+  "var_lhs", "var_ref", "backref", "superclass", "$@28", "f_arglist",
+  "f_args", "f_bad_arg", "f_norm_arg", "f_arg_item", "f_arg", "f_opt",
+  "f_block_opt", "f_block_optarg", "f_optarg", "restarg_mark",
+  "f_rest_arg", "blkarg_mark", "f_block_arg", "opt_f_block_arg",
+  "singleton", "$@29", "assoc_list", "assocs", "assoc", "operation",
+  "operation2", "operation3", "dot_or_colon", "opt_terms", "opt_nl",
+  "rparen", "rbracket", "trailer", "term", "nl", "$@30", "terms", "none", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-745)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-545)
+
+#define yytable_value_is_error(Yyn) \
+  ((Yyn) == YYTABLE_NINF)
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+    -745,   109,  2594,  -745,  7293,  9101,  9428,  5731,  6790,  -745,
+    8762,  8762,  5204,  -745,  -745,  9210,  7519,  7519,  -745,  -745,
+    7519,  3298,  2863,  -745,  -745,  -745,  -745,   -13,  6790,  -745,
+       1,  -745,  -745,  5862,  3008,  -745,  -745,  5993,  -745,  -745,
+    -745,  -745,  -745,  -745,  -745,  8875,  8875,    94,  4515,  8762,
+    7745,  8084,  7061,  -745,  6504,   671,   707,   751,   771,   314,
+    -745,   125,  8988,  8875,  -745,   189,  -745,   905,  -745,   491,
+    -745,  -745,   124,    67,  -745,    43,  9319,  -745,    99,  2845,
+     228,   271,    24,    76,  -745,  -745,  -745,  -745,  -745,  -745,
+    -745,  -745,  -745,  -745,   392,    86,  -745,   436,    63,  -745,
+    -745,  -745,  -745,  -745,   102,   123,   168,   328,   418,  8762,
+     104,  4665,   283,  -745,   160,  -745,   278,  -745,  -745,    63,
+    -745,  -745,  -745,  -745,  -745,  -745,  -745,  -745,  -745,  -745,
+    -745,  -745,  -745,  -745,  -745,  -745,  -745,  -745,  -745,  -745,
+    -745,  -745,  -745,  -745,  -745,  -745,  -745,  -745,    56,    59,
+     214,   234,  -745,  -745,  -745,  -745,  -745,  -745,   260,   274,
+    -745,   292,  -745,   295,  -745,  -745,  -745,  -745,  -745,  -745,
+    -745,  -745,  -745,  -745,  -745,  -745,  -745,  -745,  -745,  -745,
+    -745,  -745,  -745,  -745,  -745,  -745,  -745,  -745,  -745,  -745,
+    -745,  -745,  -745,  -745,  -745,  -745,  -745,  -745,    24,  -745,
+    -745,  -745,  -745,  -745,  -745,  -745,  -745,  6647,  -745,  -745,
+      93,  -745,  3682,   150,   491,    92,   218,   284,    49,   237,
+      75,    92,  -745,  -745,   189,   332,  -745,  -745,   235,  8762,
+    8762,   312,  -745,  -745,   304,   364,    88,    95,  8875,  8875,
+    8875,  8875,  -745,  2845,   300,  -745,  -745,   261,   266,  -745,
+    -745,  -745,  5091,  -745,  7519,  7519,  -745,  -745,  5339,  8762,
+    -745,  -745,   279,  4815,  -745,   330,   370,   472,  7406,  4515,
+     301,   189,   905,   308,   338,  -745,   491,   308,   315,    19,
+     145,  -745,   300,   324,   145,  -745,   421,  9537,   334,   354,
+     373,   378,   745,  -745,  -745,  -745,  -745,   939,  -745,  -745,
+    -745,  -745,  -745,  -745,   696,  -745,  -745,   943,  -745,   961,
+    -745,   971,  -745,   388,   409,   415,  -745,  -745,  -745,  -745,
+    5452,  8762,  8762,  8762,  8762,  7406,  8762,  8762,  -745,  -745,
+    8197,  -745,  4515,  7177,   357,  8197,  8875,  8875,  8875,  8875,
+    8875,  8875,  8875,  8875,  8875,  8875,  8875,  8875,  8875,  8875,
+    8875,  8875,  8875,  8875,  8875,  8875,  8875,  8875,  8875,  8875,
+    8875,  8875,  2206,  7519,  9814,  -745,  -745, 10750,  -745,  -745,
+    -745,  8988,  8988,  -745,   395,  -745,   491,  -745,   381,  -745,
+    -745,  -745,   189,  -745,  -745,  -745,  9892,  7519,  9970,  3682,
+    8762,   875,  -745,   441,  -745,   503,   523,    91,  -745,  3823,
+     520,  8875, 10048,  7519, 10126,  8875,  8875,  4095,   802,   332,
+    8310,   525,  -745,    51,    51,   110, 10204,  7519, 10282,  -745,
+    -745,  -745,  -745,  8875,  7632,  -745,  -745,  7858,  -745,   308,
+     408,  -745,  -745,   308,  -745,   424,   428,  -745,    90,  -745,
+    -745,  6790,  4230,   442, 10048, 10126,  8875,   905,   308,  -745,
+    -745,  5584,   445,   308,  -745,  -745,  7971,  -745,  -745,  8084,
+    -745,  -745,  -745,   381,    43,  9537,  -745,  9537, 10360,  7519,
+   10438,   446,  -745,  -745,  -745,  -745,  1004,  -745,  -745,  -745,
+    -745,   986,    58,  -745,  -745,  -745,  -745,   459,  -745,   462,
+     539,   478,   582,  -745,  -745,   567,  4815,  -745,  -745,  -745,
+    -745,  -745,  -745,  8875,  8875,  -745,  -745,  -745,  -745,  -745,
+    -745,  -745,  -745,    55,  8875,  -745,   490,   494,  -745,   308,
+    9537,   499,  -745,  -745,  -745,   533,  1174,  -745,  -745,   370,
+    1773,  1773,  1773,  1773,   837,   837,  1845,  2028,  1773,  1773,
+    2990,  2990,   558,   558,  2700,   837,   837,   752,   752,   812,
+     385,   385,   370,   370,   370,  3443,  6242,  3532,  6360,  -745,
+     123,  -745,   308,   580,  -745,   584,  -745,  -745,  3153,  -745,
+    -745,  1199,    55,    55,  -745,  1283,  -745,  2845,  -745,  -745,
+     189,  -745,  8762,  3682,   579,    48,  -745,   123,   308,   123,
+     637,    90,   986,  3682,   189,  6933,  6790,  -745,  8423,   634,
+    -745,   563,  -745,  2099,  6124,  2718,   308,   412,   432,   634,
+    -745,   853,  -745,   802,  -745,  -745,   642,    79,  -745,  -745,
+    -745,  -745,  -745,   139,   219,   308,   120,   128,  8762,  -745,
+    8875,   300,  -745,   266,  -745,  -745,  -745,  -745,  7632,  7858,
+    -745,  -745,   512,  -745,  2845,    30,   905,  -745,   145,   357,
+    -745,   579,    48,   308,    35,    45,  8875,  -745,  1004,   647,
+    -745,   510,   308,  -745,   308,  4956,  4815,  -745,   986,  -745,
+    -745,   986,  -745,  -745,  1095,  -745,  -745,  -745,   514,   370,
+     370,  -745,   734,  4956,  -745,  -745,   517,  8536,  -745,  -745,
+    9537,  8988,  8875,   547,  8988,  8988,  -745,   395,   516,   598,
+    8988,  8988,  -745,  -745,   395,  -745,    76,   124,  4956,  4815,
+    8875,    55,  -745,   189,   658,  -745,  -745,  -745,   308,   659,
+    -745,  -745,  -745,   490,  -745,   585,  -745,  4380,   662,  -745,
+    8762,   663,  -745,  8875,  8875,   454,  8875,  8875,   675,  -745,
+    -745,  -745,  8649,  3959,  4956,  4956,   147,    51,  -745,  -745,
+     542,  -745,  -745,   348,  -745,   308,  1135,   545,  1076,  -745,
+     543,   550,   702,   565,  -745,   569,   571,  -745,   573,  -745,
+     574,   573,  -745,   607,   308,   611,   587,  -745,   593,   594,
+    -745,   730,  8875,   599,  -745,  2845,  8875,  -745,  2845,  -745,
+    2845,  -745,  -745,  8988,  -745,  2845,  -745,  2845,  -745,  -745,
+    -745,   735,   603,  2845,  4815,  3682,  -745,  -745,  -745,  -745,
+     875,  9646,    92,  -745,  -745,  4956,  -745,  -745,    92,  -745,
+    8875,  -745,  -745,   196,   737,   740,  -745,  7858,  -745,   610,
+    1135,   795,  -745,  -745,  1088,  -745,  -745,   986,  -745,  1095,
+    -745,  1095,  -745,  1095,  -745,  -745,  9755,   633,  -745,  1215,
+    -745,  1215,  -745,  1095,  -745,  -745,   612,  2845,  -745,  2845,
+    -745,  -745,   621,   755,  3682,   712,  -745,   396,   373,   378,
+    3682,  -745,  3823,  -745,  -745,  -745,  -745,  -745,  4956,  1135,
+     610,  1135,   629,  -745,   333,  -745,  -745,   573,   631,   573,
+     573,   723,   410,  -745,   635,   639,   573,  -745,   648,   573,
+    -745,  -745,   776,   381, 10516,  7519, 10594,   523,   563,   784,
+     610,  1135,  1088,  -745,  -745,  1095,  -745,  -745,  -745,  -745,
+   10672,  1215,  -745,  1095,  -745,  -745,  1095,  -745,  -745,  -745,
+     113,    48,   308,   129,   138,  -745,  -745,  -745,   610,  -745,
+     573,   656,   660,   573,   667,   573,   573,   185,  -745,  -745,
+    1095,  -745,  -745,  -745,   573,  -745
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+       2,     0,     0,     1,     0,     0,     0,     0,     0,   268,
+       0,     0,   529,   292,   295,     0,   315,   316,   317,   318,
+     279,   248,   248,   455,   454,   456,   457,   531,     0,    10,
+       0,   459,   458,   447,   519,   449,   448,   451,   450,   443,
+     444,   409,   410,   460,   461,     0,     0,     0,     0,   272,
+     544,   544,    78,   288,     0,     0,     0,     0,     0,     0,
+     423,     0,     0,     0,     3,   529,     6,     9,    27,    39,
+      42,    50,    49,     0,    66,     0,    70,    80,     0,    47,
+     229,     0,    51,   286,   260,   261,   262,   263,   264,   407,
+     406,   432,   408,   405,   453,     0,   265,   266,   248,     5,
+       8,   315,   316,   279,   282,   387,     0,   102,   103,     0,
+       0,     0,     0,   105,     0,   319,     0,   453,   266,     0,
+     308,   156,   166,   157,   179,   153,   172,   162,   161,   182,
+     183,   177,   160,   159,   155,   180,   184,   185,   164,   154,
+     167,   171,   173,   165,   158,   174,   181,   176,   175,   168,
+     178,   163,   152,   170,   169,   151,   149,   150,   146,   147,
+     148,   107,   109,   108,   141,   142,   138,   120,   121,   122,
+     129,   126,   128,   123,   124,   143,   144,   130,   131,   135,
+     125,   127,   117,   118,   119,   132,   133,   134,   136,   137,
+     139,   140,   145,   509,   310,   110,   111,   508,     0,   175,
+     168,   178,   163,   146,   147,   107,   108,     0,   112,   114,
+      20,   113,     0,     0,    48,     0,     0,     0,   453,     0,
+     266,     0,   538,   540,   529,     0,   542,   539,   530,     0,
+       0,     0,   330,   329,     0,     0,   453,   266,     0,     0,
+       0,     0,   243,   230,   253,    64,   247,   544,   544,   513,
+      65,    63,   531,    62,     0,   544,   386,    61,   531,     0,
+     532,    18,     0,     0,   207,     0,   208,   276,     0,     0,
+       0,   529,    15,   531,    68,    14,   270,   531,     0,   535,
+     535,   231,     0,     0,   535,   511,     0,     0,    76,     0,
+      86,    93,   482,   437,   436,   438,   439,     0,   435,   434,
+     421,   416,   415,   418,     0,   413,   430,     0,   441,     0,
+     411,     0,   419,     0,   445,   446,    46,   222,   223,     4,
+     530,     0,     0,     0,     0,     0,     0,     0,   374,   376,
+       0,    82,     0,    74,    71,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   544,     0,   528,   527,     0,   391,   389,
+     287,     0,     0,   380,    55,   285,   305,   102,   103,   104,
+     445,   446,     0,   463,   303,   462,     0,   544,     0,     0,
+       0,   482,   312,     0,   115,     0,   544,   276,   321,     0,
+     320,     0,     0,   544,     0,     0,     0,     0,   544,     0,
+       0,     0,   543,     0,     0,   276,     0,   544,     0,   300,
+     516,   254,   250,     0,     0,   244,   252,     0,   245,   531,
+       0,   281,   249,   531,   239,   544,   544,   238,   531,   284,
+      45,     0,     0,     0,     0,     0,     0,    17,   531,   274,
+      13,   530,    67,   531,   273,   277,   537,   232,   536,   537,
+     234,   278,   512,    92,    84,     0,    79,     0,     0,   544,
+       0,   488,   485,   484,   483,   486,     0,   500,   504,   503,
+     499,   482,     0,   371,   487,   489,   491,   544,   497,   544,
+     502,   544,     0,   481,   440,     0,     0,   422,   414,   431,
+     442,   412,   420,     0,     0,     7,    21,    22,    23,    24,
+      25,    43,    44,   544,     0,    28,    37,     0,    38,   531,
+       0,    72,    83,    41,    40,     0,   186,   253,    36,   204,
+     212,   217,   218,   219,   214,   216,   226,   227,   220,   221,
+     197,   198,   224,   225,   531,   213,   215,   209,   210,   211,
+     199,   200,   201,   202,   203,   520,   525,   521,   526,   385,
+     248,   383,   531,   520,   522,   521,   523,   384,   248,   520,
+     521,   248,   544,   544,    29,   188,    35,   196,    53,    56,
+       0,   465,     0,     0,   102,   103,   106,     0,   531,   544,
+       0,   531,   482,     0,     0,     0,     0,   269,   544,   544,
+     397,   544,   322,   186,   524,   521,   531,   520,   521,   544,
+     428,     0,   541,   425,   426,   424,     0,     0,   299,   324,
+     293,   323,   296,   524,   275,   531,   520,   521,     0,   515,
+       0,   255,   251,   544,   514,   280,   533,   235,   240,   242,
+     283,    19,     0,    26,   195,    69,    16,   271,   535,    85,
+      77,    89,    91,   531,   520,   521,     0,   488,     0,   342,
+     333,   335,   531,   331,   531,     0,     0,   289,     0,   474,
+     507,     0,   477,   501,     0,   479,   505,   433,     0,   205,
+     206,   362,   531,     0,   360,   359,   259,     0,    81,    75,
+       0,     0,     0,     0,     0,     0,   382,    59,     0,   388,
+       0,     0,   237,   381,    57,   236,   377,    52,     0,     0,
+       0,   544,   306,     0,     0,   388,   309,   510,   531,     0,
+     467,   313,   116,   398,   399,   544,   400,     0,   544,   327,
+       0,     0,   325,     0,     0,   388,     0,     0,     0,   429,
+     427,   298,     0,     0,     0,     0,   388,     0,   256,   246,
+     544,    11,   233,    87,   493,   531,     0,   340,     0,   490,
+       0,   364,     0,     0,   492,   544,   544,   506,   544,   498,
+     544,   544,   417,   488,   531,     0,   544,   495,   544,   544,
+     358,     0,     0,   257,    73,   187,     0,    34,   193,    33,
+     194,    60,   534,     0,    31,   191,    32,   192,    58,   378,
+     379,     0,     0,   189,     0,     0,   464,   304,   466,   311,
+     482,     0,     0,   402,   328,     0,    12,   404,     0,   290,
+       0,   291,   255,   544,     0,     0,   301,   241,   332,   343,
+       0,   338,   334,   370,     0,   373,   372,     0,   470,     0,
+     472,     0,   478,     0,   475,   480,     0,     0,   361,   349,
+     351,     0,   354,     0,   356,   375,   258,   228,    30,   190,
+     392,   390,     0,     0,     0,     0,   401,     0,    94,   101,
+       0,   403,     0,   394,   395,   393,   294,   297,     0,     0,
+     341,     0,   336,   368,   531,   366,   369,   544,   544,   544,
+     544,     0,   494,   363,   544,   544,   544,   496,   544,   544,
+      54,   307,     0,   100,     0,   544,     0,   544,   544,     0,
+     339,     0,     0,   365,   471,     0,   468,   473,   476,   276,
+       0,     0,   346,     0,   348,   355,     0,   352,   357,   314,
+     524,    99,   531,   520,   521,   396,   326,   302,   337,   367,
+     544,   524,   275,   544,   544,   544,   544,   388,   469,   347,
+       0,   344,   350,   353,   544,   345
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -745,  -745,  -745,   375,  -745,    32,  -745,  -350,   285,  -745,
+      61,  -745,  -318,    -3,    22,   -59,  -745,  -582,  -745,    -5,
+     797,  -146,    28,   -63,  -236,  -424,   -27,  1718,   -79,   814,
+       7,   -12,  -745,  -745,  -248,  -745,  1213,   681,  -745,     5,
+     253,  -323,   101,    77,  -745,  -403,  -243,    21,  -283,    14,
+    -745,  -745,  -745,  -745,  -745,  -745,  -745,  -745,  -745,  -745,
+    -745,  -745,  -745,  -745,  -745,  -745,  -745,   288,  -217,  -359,
+     -81,  -537,  -745,  -672,  -673,   170,  -745,  -443,  -745,  -603,
+    -745,   -83,  -745,  -745,   133,  -745,  -745,  -745,   -82,  -745,
+    -745,  -391,  -745,   -76,  -745,  -745,  -745,  -745,  -745,  1009,
+    -216,  -745,  -745,  -745,  -745,  -745,  -745,   232,  -745,  -745,
+       2,  -745,  -745,  -745,  1319,  1671,   840,  1691,  -745,  -745,
+      42,  -264,  -734,  -165,  -567,   148,  -618,  -744,     4,   188,
+    -745,  -141,  -745,  -260,  1306,  -745,  -745,  -745,     6,  -382,
+     793,  -320,  -745,   665,    10,   -25,  -223,  -521,  -211,    -6,
+      46,  -745,     9,    -2
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,     1,     2,    64,    65,    66,   262,   395,   396,   271,
+     272,   441,    68,    69,   215,    70,    71,   579,   711,    72,
+      73,   273,    74,    75,    76,   466,    77,   216,   113,   114,
+     208,   209,   210,   596,   195,   196,    79,   244,   278,   559,
+     703,   433,   434,   253,   254,   246,   425,   435,   518,    80,
+     212,   453,   277,   292,   229,   744,   230,   745,   628,   878,
+     583,   580,   805,   389,   391,   595,   810,   265,   399,   620,
+     731,   732,   235,   660,   661,   662,   774,   683,   684,   760,
+     884,   885,   482,   667,   329,   513,    82,    83,   375,   573,
+     572,   411,   875,   599,   725,   812,   816,    84,    85,   611,
+     305,   496,    86,    87,    88,   612,   613,   614,    89,    90,
+      91,   299,    92,    93,   218,   219,    96,   220,   384,   582,
+     593,   594,   484,   485,   486,   487,   488,   777,   778,   489,
+     490,   491,   492,   767,   669,   198,   390,   283,   436,   249,
+     119,   587,   561,   367,   225,   430,   431,   699,   457,   400,
+     260,   408,   228,   275
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      99,   370,   259,   316,   407,   428,   226,   214,   214,   214,
+     211,   242,   242,   334,   194,   242,   261,   523,   616,   115,
+     115,   632,   248,   248,   632,   288,   248,   256,   483,   115,
+     211,   379,   493,   221,   224,   439,   100,   247,   247,   590,
+     562,   247,   560,   650,   568,   634,   276,   571,   281,   285,
+     452,   465,   528,   769,   454,   622,   280,   284,   227,   226,
+     -88,   298,   728,    67,   588,    67,   115,   715,   589,   460,
+     -90,   279,   738,   462,   320,   319,   274,   634,   619,   775,
+     606,   495,   560,   829,   568,   735,   832,   665,   498,   368,
+     115,   498,   398,   498,   625,   498,   689,   498,   589,   257,
+     886,   764,   368,   373,   746,   398,   376,   897,   385,     3,
+     256,   227,   365,   -94,   558,   791,   566,   245,   250,   566,
+    -101,   251,   798,   448,   373,   589,   -97,   326,   327,   708,
+     709,   493,   753,   258,   681,  -100,  -275,   223,   558,  -452,
+     566,   263,   -96,   -67,  -455,   -96,   653,  -454,   -88,   267,
+     589,   -98,   328,   -98,   558,   377,   566,   880,   -90,   378,
+     227,   382,   -94,   456,   -97,   406,   666,   366,   558,   223,
+     566,   847,   -95,   682,   -81,   374,   371,   897,   886,   -88,
+     330,   446,   -88,   314,   315,   -88,   519,   331,  -101,   -90,
+    -275,  -275,   -90,   428,  -521,   -90,   558,   566,   -95,  -455,
+     222,   223,  -454,   369,  -100,   397,   635,   832,   910,   255,
+     637,   727,   335,   410,   298,   640,   369,   664,   226,   769,
+     558,   493,   566,   742,   464,   645,   214,   214,   222,   223,
+     647,   465,   -86,   714,   409,   632,   632,   394,   938,   -93,
+     223,   222,   223,   719,   -99,   426,   426,   242,   252,   242,
+     242,   413,   414,   437,   -92,   438,   440,   634,   248,  -520,
+     248,   227,   -97,   -97,   -88,   226,   784,   227,   804,   255,
+     227,   515,   -90,   247,   764,   247,   524,   383,   -96,   -96,
+     451,   450,   764,   -89,   465,  -520,   873,   -98,   -98,   459,
+      81,   -87,    81,   116,   116,   223,   688,   274,   217,   217,
+     217,   115,  -456,   234,   217,   217,   521,   586,   217,   222,
+     223,   663,   574,   576,   258,   724,  -319,   227,   214,   214,
+     214,   214,  -457,   511,   512,   458,   458,   405,   718,   447,
+     458,   401,   493,   270,   -95,   -95,    81,   217,   222,   223,
+     289,   380,   381,   506,   507,   508,   509,   115,  -459,   410,
+     217,   517,   505,   429,  -517,   432,   517,  -456,   242,   362,
+     274,   437,  -458,   -91,   289,  -521,   386,   415,   717,   567,
+    -319,  -319,   402,   523,  -388,   312,   581,  -457,   301,   302,
+    -447,    67,   242,  -451,   412,   437,   510,   591,   826,   419,
+     749,   423,   416,   567,   600,   498,   270,   217,   242,    81,
+     743,   437,   649,  -459,   464,   424,   615,   621,   621,   567,
+     427,   947,   242,   363,   364,   437,  -447,  -458,   444,   442,
+     387,   388,   780,   567,   632,   303,   403,   404,   227,   641,
+     633,   617,   874,   426,   426,  -447,  -388,   752,  -451,   759,
+      99,   336,   468,   211,  -518,   634,   417,   418,   449,   502,
+     567,   -66,   301,   302,   465,   863,   336,   464,   223,   227,
+     227,  -453,   648,   455,   242,   461,  -266,   437,  -517,  -276,
+    -447,  -447,   403,   445,  -517,   567,   463,   912,   467,   115,
+     503,   115,  -452,   223,   904,   670,   504,   670,  -388,   670,
+    -388,  -388,   578,   663,   757,   808,   469,   470,   920,   303,
+      81,   522,   736,    67,   494,   -94,  -451,   749,   359,   360,
+     361,   685,   646,   597,   902,  -453,  -453,   217,   217,   693,
+    -266,  -266,   737,  -276,  -276,   -96,   372,   766,   326,   327,
+     770,   598,   828,   602,   115,   618,   -86,   698,   905,   906,
+     217,   779,   217,   217,   820,   -98,   217,   217,   443,  -101,
+     493,    81,   387,   388,   270,   636,    81,    81,  -518,   656,
+    -451,  -451,   446,   698,  -518,   696,   705,   -95,   638,   705,
+     685,   685,   639,   702,   712,   289,   702,   730,   727,   214,
+     -93,   698,   932,   643,   722,  -100,   589,   705,   720,   -81,
+     673,   663,   696,   663,   702,   870,   726,   729,   211,   729,
+     698,   872,   721,   668,   713,  -524,   671,   729,    81,   217,
+     217,   217,   217,    81,   217,   217,   -92,   270,   217,   517,
+      81,   289,   674,   217,   799,   214,   227,   464,   698,   336,
+     677,   426,   524,   676,  -253,   787,   789,   697,   687,   761,
+     227,   794,   796,   690,   750,   704,   691,   716,   707,   727,
+     747,   217,   741,   751,   758,   772,   558,   761,   566,   217,
+     217,  -254,   786,   227,   792,   663,   882,  -524,   807,   809,
+     700,   815,   558,   819,   701,   217,   811,    81,   217,   357,
+     358,   359,   360,   361,   601,   821,   827,    81,   793,   830,
+     833,   217,   609,   -96,   458,    81,   888,   -98,   657,   834,
+     472,   473,   474,   475,   115,   217,   836,   806,   895,   685,
+     898,   -95,   835,   837,   663,   839,   663,   841,   843,  -524,
+     846,  -524,  -524,   813,   -88,  -520,   817,   214,   -90,   848,
+      81,   849,   282,   300,   858,   301,   302,   851,   853,    81,
+     855,   621,   -87,  -255,   861,   860,   663,   876,   426,   761,
+     877,   893,   818,   289,   879,   289,  -256,   217,   497,   227,
+     301,   302,   900,   670,   670,   901,   670,   903,   670,   670,
+     306,   301,   302,   911,   670,   915,   670,   670,   919,   921,
+     944,   678,   303,   923,    81,   773,   929,   472,   473,   474,
+     475,   756,   926,   227,   937,    98,   471,    98,   472,   473,
+     474,   475,  -520,    98,    98,    98,  -521,   303,   289,    98,
+      98,   950,   232,    98,   308,   301,   302,   642,   303,   768,
+     120,   729,   771,   336,   706,   115,   476,   936,   755,   939,
+     776,   935,   477,   478,   310,   301,   302,   476,   349,   350,
+     800,    98,    98,   477,   478,   740,   657,   197,   472,   473,
+     474,   475,   864,   894,   479,    98,   765,   480,   227,   913,
+     115,     0,   303,   392,   227,   479,   301,   302,   480,     0,
+     217,    81,   356,   357,   358,   359,   360,   361,     0,     0,
+       0,    81,   303,   336,   223,   670,   670,   670,   670,     0,
+       0,   481,   670,   670,   670,     0,   670,   670,   349,   350,
+     242,     0,    98,   437,    98,   600,   729,   698,   336,     0,
+       0,   567,   610,   303,     0,     0,   217,   301,   302,   420,
+     421,   422,     0,   349,   350,     0,   471,     0,   472,   473,
+     474,   475,     0,   357,   358,   359,   360,   361,   670,   881,
+       0,   670,   670,   670,   670,   321,   322,   323,   324,   325,
+     762,   763,   670,    81,    81,   354,   355,   356,   357,   358,
+     359,   360,   361,   739,   303,     0,     0,   476,   781,     0,
+       0,    81,     0,   477,   478,     0,     0,     0,   289,   217,
+       0,     0,   217,   217,     0,   887,     0,   889,   217,   217,
+       0,   890,     0,   801,   802,   479,    81,    81,   480,   896,
+       0,   899,   494,   301,   302,    98,   499,   301,   302,     0,
+       0,   516,   814,     0,     0,    81,   527,     0,   217,     0,
+       0,   592,    98,    98,   500,   301,   302,     0,   823,   824,
+     825,    81,    81,    81,   501,   301,   302,   471,     0,   472,
+     473,   474,   475,     0,     0,    98,     0,    98,    98,     0,
+     303,    98,    98,     0,   303,   657,    98,   472,   473,   474,
+     475,    98,    98,   940,   304,   307,   309,   311,   313,   943,
+       0,   945,   303,     0,   946,     0,     0,     0,   476,     0,
+       0,   217,   303,     0,   477,   478,     0,     0,     0,   862,
+       0,   527,    81,    81,     0,     0,   658,     0,   954,   867,
+     871,     0,   659,    81,   629,   631,   479,     0,   282,   480,
+       0,     0,     0,    98,    98,    98,    98,    98,    98,    98,
+      98,     0,     0,    98,     0,    98,     0,   657,    98,   472,
+     473,   474,   475,     0,   892,     0,     0,   631,     0,   883,
+     282,   472,   473,   474,   475,     0,   657,     0,   472,   473,
+     474,   475,    81,     0,     0,   907,    98,   908,    81,     0,
+      81,     0,     0,   909,    98,    98,    81,     0,   658,     0,
+       0,     0,     0,     0,   831,     0,     0,     0,     0,     0,
+      98,     0,    98,    98,     0,     0,   657,   476,   472,   473,
+     474,   475,    98,   217,   478,   686,    98,     0,     0,  -544,
+      98,     0,     0,     0,     0,     0,     0,  -544,  -544,  -544,
+      98,     0,  -544,  -544,  -544,   479,  -544,     0,   692,     0,
+       0,     0,     0,     0,     0,  -544,  -544,   658,     0,   243,
+     243,     0,     0,   243,     0,    98,  -544,  -544,     0,  -544,
+    -544,  -544,  -544,  -544,    98,   336,   337,   338,   339,   340,
+     341,   342,   343,   344,   345,   346,   347,   348,   264,   266,
+     349,   350,    98,   243,   243,     0,   773,     0,   472,   473,
+     474,   475,     0,     0,     0,   317,   318,     0,     0,   723,
+       0,     0,     0,     0,     0,     0,     0,  -544,   351,    98,
+     352,   353,   354,   355,   356,   357,   358,   359,   360,   361,
+       0,     0,     0,     0,     0,     0,     0,   476,     0,     0,
+       0,   748,     0,   477,   478,     0,     0,     0,  -230,   631,
+     282,    94,     0,    94,   117,   117,   117,   710,     0,     0,
+       0,     0,     0,     0,   236,   479,     0,   754,   480,  -544,
+    -544,     0,  -544,     0,     0,   255,  -544,     0,  -544,  -544,
+       0,     0,     0,     0,   336,   337,   338,   339,   340,   341,
+     342,   343,   344,   345,   346,   347,   348,    94,   783,   349,
+     350,   290,     0,     0,     0,    98,    98,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    98,     0,     0,     0,
+       0,     0,     0,     0,     0,   290,     0,   351,     0,   352,
+     353,   354,   355,   356,   357,   358,   359,   360,   361,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    98,     0,   822,     0,     0,     0,     0,     0,     0,
+      94,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   243,   243,   243,   317,     0,     0,     0,    98,    98,
+       0,     0,     0,   856,     0,   243,     0,   243,   243,     0,
+       0,     0,     0,     0,     0,     0,    98,     0,     0,     0,
+       0,     0,     0,     0,    98,     0,     0,    98,    98,     0,
+       0,     0,     0,    98,    98,     0,     0,     0,     0,     0,
+       0,    98,    98,     0,     0,     0,     0,     0,   282,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      98,     0,     0,    98,     0,     0,     0,     0,     0,     0,
+       0,    94,     0,     0,     0,     0,    98,    98,    98,     0,
+       0,     0,     0,   243,     0,     0,     0,     0,   526,   529,
+     530,   531,   532,   533,   534,   535,   536,   537,   538,   539,
+     540,   541,   542,   543,   544,   545,   546,   547,   548,   549,
+     550,   551,   552,   553,   554,     0,   243,     0,     0,     0,
+       0,     0,    94,     0,   575,   577,    98,    94,    94,     0,
+       0,     0,     0,     0,     0,     0,     0,    98,    98,     0,
+     243,     0,     0,     0,     0,     0,   290,     0,    98,     0,
+       0,     0,     0,     0,   603,     0,   243,     0,   575,   577,
+       0,     0,     0,   243,     0,     0,     0,     0,     0,     0,
+     243,     0,     0,     0,     0,     0,   243,   243,     0,    94,
+     243,     0,     0,     0,    94,     0,     0,     0,     0,     0,
+       0,    94,   290,     0,     0,     0,     0,    98,     0,   644,
+       0,     0,     0,    98,     0,    98,     0,     0,     0,   243,
+       0,    98,   243,    95,     0,    95,     0,     0,     0,     0,
+       0,     0,   243,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    97,     0,    97,   118,   118,    98,     0,
+       0,     0,     0,     0,     0,     0,   237,     0,    94,     0,
+       0,     0,     0,     0,     0,     0,   679,   680,    94,    95,
+      78,     0,    78,     0,     0,     0,    94,   243,     0,     0,
+       0,     0,     0,   233,     0,     0,     0,     0,     0,    97,
+       0,     0,     0,   291,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    94,     0,     0,     0,     0,    78,   291,     0,     0,
+      94,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    95,     0,   290,     0,   290,     0,     0,     0,
+       0,     0,     0,     0,     0,   672,     0,   675,     0,     0,
+       0,     0,    97,     0,     0,     0,     0,     0,     0,     0,
+       0,   243,     0,     0,     0,    94,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    78,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   290,
+       0,     0,     0,   243,   336,  -545,  -545,  -545,  -545,   341,
+     342,   243,   243,  -545,  -545,     0,     0,     0,     0,   349,
+     350,     0,     0,     0,     0,     0,     0,     0,     0,   243,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    95,     0,     0,     0,     0,     0,   352,
+     353,   354,   355,   356,   357,   358,   359,   360,   361,     0,
+     243,     0,    94,    97,   603,   785,     0,   788,   790,     0,
+       0,     0,    94,   795,   797,     0,   336,   337,   338,   339,
+     340,   341,   342,   803,     0,   345,   346,     0,     0,     0,
+      78,   349,   350,     0,    95,     0,     0,     0,     0,    95,
+      95,     0,     0,     0,     0,     0,   788,   790,     0,   795,
+     797,     0,     0,     0,    97,   243,     0,     0,     0,    97,
+      97,   352,   353,   354,   355,   356,   357,   358,   359,   360,
+     361,     0,     0,     0,     0,     0,     0,     0,   291,     0,
+       0,    78,     0,     0,    94,    94,    78,    78,     0,     0,
+       0,    95,     0,     0,     0,   243,    95,     0,     0,   857,
+       0,     0,    94,    95,     0,     0,   859,     0,     0,   290,
+       0,    97,     0,     0,     0,     0,    97,     0,     0,     0,
+       0,     0,     0,    97,   291,     0,     0,    94,    94,     0,
+       0,     0,     0,   859,     0,     0,     0,     0,    78,     0,
+     243,     0,     0,    78,     0,     0,    94,     0,     0,     0,
+      78,     0,     0,   525,     0,     0,     0,     0,     0,     0,
+      95,     0,    94,    94,    94,     0,     0,     0,     0,     0,
+      95,   838,   840,     0,   842,     0,   844,   845,    95,     0,
+      97,     0,   850,     0,   852,   854,     0,     0,     0,     0,
+      97,     0,     0,     0,     0,     0,     0,     0,    97,   336,
+     337,   338,   339,   340,   341,   342,   343,    78,   345,   346,
+       0,     0,     0,    95,   349,   350,     0,    78,   243,     0,
+       0,     0,    95,    94,    94,    78,     0,     0,     0,     0,
+     868,     0,     0,    97,    94,     0,     0,     0,     0,     0,
+       0,     0,    97,   692,   352,   353,   354,   355,   356,   357,
+     358,   359,   360,   361,     0,     0,   291,     0,   291,     0,
+      78,     0,     0,     0,     0,   117,     0,    95,     0,    78,
+     336,   337,   338,   339,   340,   341,   342,   343,   344,   345,
+     346,   347,   348,    94,     0,   349,   350,    97,     0,    94,
+       0,    94,     0,   914,   916,   917,   918,    94,     0,     0,
+     922,   924,   925,     0,   927,   928,     0,     0,     0,     0,
+       0,   291,     0,   351,    78,   352,   353,   354,   355,   356,
+     357,   358,   359,   360,   361,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   948,     0,     0,   949,
+     951,   952,   953,     0,    95,     0,     0,   555,   556,     0,
+     955,   557,     0,     0,    95,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    97,   164,   165,   166,   167,   168,
+     169,   170,   171,   172,    97,     0,   173,   174,     0,     0,
+     175,   176,   177,   178,     0,     0,     0,     0,     0,     0,
+       0,    78,     0,     0,   179,     0,     0,     0,     0,     0,
+       0,    78,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   180,   181,   182,   183,   184,   185,   186,   187,
+     188,   189,     0,   190,   191,     0,    95,    95,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   192,   255,     0,    95,     0,    97,    97,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    97,     0,     0,     0,     0,    95,
+      95,   291,     0,    78,    78,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    95,    97,
+      97,    78,     0,     0,     0,     0,     0,     0,     0,   525,
+       0,     0,     0,     0,    95,    95,    95,     0,    97,     0,
+       0,     0,     0,     0,     0,     0,    78,    78,     0,     0,
+       0,     0,     0,     0,    97,    97,    97,     0,     0,     0,
+       0,     0,     0,     0,     0,    78,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    78,    78,    78,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    95,    95,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    95,     0,     0,     0,
+       0,     0,     0,     0,     0,    97,    97,     0,     0,     0,
+       0,     0,   869,     0,     0,     0,    97,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    78,    78,     0,     0,     0,     0,     0,   866,
+       0,     0,     0,    78,     0,    95,     0,   118,     0,     0,
+       0,    95,     0,    95,     0,     0,     0,     0,     0,    95,
+       0,     0,     0,     0,     0,    97,     0,     0,     0,     0,
+       0,    97,     0,    97,     0,     0,     0,     0,     0,    97,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    78,     0,     0,     0,     0,     0,    78,     0,
+      78,     0,     0,     0,  -544,     4,    78,     5,     6,     7,
+       8,     9,     0,     0,     0,    10,    11,     0,     0,     0,
+      12,     0,    13,    14,    15,    16,    17,    18,    19,     0,
+       0,     0,     0,     0,    20,    21,    22,    23,    24,    25,
+      26,     0,     0,    27,     0,     0,     0,     0,     0,    28,
+      29,    30,    31,    32,     0,    33,    34,    35,    36,    37,
+      38,     0,    39,    40,    41,     0,     0,    42,     0,     0,
+      43,    44,     0,    45,    46,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    47,     0,     0,    48,    49,     0,    50,
+      51,     0,    52,     0,    53,    54,    55,    56,    57,    58,
+      59,     0,     0,    60,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,  -275,     0,
+      61,    62,    63,     0,     0,     0,  -275,  -275,  -275,     0,
+       0,  -275,  -275,  -275,     0,  -275,     0,     0,     0,     0,
+       0,     0,     0,  -544,  -544,  -275,  -275,  -275,     0,     0,
+       0,     0,     0,     0,     0,  -275,  -275,     0,  -275,  -275,
+    -275,  -275,  -275,     0,     0,     0,     0,     0,     0,     0,
+       0,   336,   337,   338,   339,   340,   341,   342,   343,   344,
+     345,   346,   347,   348,     0,     0,   349,   350,     0,  -275,
+    -275,  -275,  -275,  -275,  -275,  -275,  -275,  -275,  -275,  -275,
+    -275,  -275,     0,     0,  -275,  -275,  -275,     0,   734,  -275,
+       0,     0,     0,     0,   351,  -275,   352,   353,   354,   355,
+     356,   357,   358,   359,   360,   361,  -275,     0,     0,     0,
+       0,   -99,  -275,  -275,  -275,  -275,  -275,  -275,  -275,  -275,
+    -275,  -275,  -275,  -275,     0,     0,     0,     0,     0,     0,
+     223,     0,     0,     0,     0,     0,     0,     0,     0,  -275,
+    -275,  -275,  -275,  -387,     0,  -275,  -275,  -275,  -275,     0,
+       0,  -387,  -387,  -387,     0,     0,  -387,  -387,  -387,     0,
+    -387,     0,     0,     0,     0,     0,     0,     0,     0,  -387,
+    -387,  -387,     0,     0,     0,     0,     0,     0,     0,     0,
+    -387,  -387,     0,  -387,  -387,  -387,  -387,  -387,     0,     0,
+       0,     0,     0,     0,     0,     0,   336,   337,   338,   339,
+     340,   341,   342,   343,   344,   345,   346,   347,   348,     0,
+       0,   349,   350,     0,  -387,  -387,  -387,  -387,  -387,  -387,
+    -387,  -387,  -387,  -387,  -387,  -387,  -387,     0,     0,  -387,
+    -387,  -387,     0,     0,  -387,     0,     0,     0,     0,   351,
+    -387,   352,   353,   354,   355,   356,   357,   358,   359,   360,
+     361,     0,     0,     0,     0,     0,     0,  -387,     0,  -387,
+    -387,  -387,  -387,  -387,  -387,  -387,  -387,  -387,  -387,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,  -387,  -387,  -387,  -387,  -387,  -267,   255,
+    -387,  -387,  -387,  -387,     0,     0,  -267,  -267,  -267,     0,
+       0,  -267,  -267,  -267,     0,  -267,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,  -267,  -267,  -267,     0,     0,
+       0,     0,     0,     0,     0,  -267,  -267,     0,  -267,  -267,
+    -267,  -267,  -267,     0,     0,     0,     0,     0,     0,     0,
+       0,   336,   337,   338,   339,   340,   341,   342,   343,   344,
+     345,   346,  -545,  -545,     0,     0,   349,   350,     0,  -267,
+    -267,  -267,  -267,  -267,  -267,  -267,  -267,  -267,  -267,  -267,
+    -267,  -267,     0,     0,  -267,  -267,  -267,     0,     0,  -267,
+       0,     0,     0,     0,     0,  -267,   352,   353,   354,   355,
+     356,   357,   358,   359,   360,   361,  -267,     0,     0,     0,
+       0,     0,  -267,  -267,  -267,  -267,  -267,  -267,  -267,  -267,
+    -267,  -267,  -267,  -267,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,  -267,
+    -267,  -267,  -267,  -544,     0,  -267,  -267,  -267,  -267,     0,
+       0,  -544,  -544,  -544,     0,     0,  -544,  -544,  -544,     0,
+    -544,     0,     0,     0,     0,     0,     0,     0,     0,  -544,
+    -544,  -544,     0,     0,     0,     0,     0,     0,     0,     0,
+    -544,  -544,     0,  -544,  -544,  -544,  -544,  -544,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,  -544,  -544,  -544,  -544,  -544,  -544,
+    -544,  -544,  -544,  -544,  -544,  -544,  -544,     0,     0,  -544,
+    -544,  -544,     0,     0,  -544,     0,     0,     0,     0,     0,
+    -544,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,  -544,     0,  -544,
+    -544,  -544,  -544,  -544,  -544,  -544,  -544,  -544,  -544,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,  -544,  -544,  -544,  -544,  -544,  -282,   255,
+    -544,  -544,  -544,  -544,     0,     0,  -282,  -282,  -282,     0,
+       0,  -282,  -282,  -282,     0,  -282,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,  -282,  -282,     0,     0,     0,
+       0,     0,     0,     0,     0,  -282,  -282,     0,  -282,  -282,
+    -282,  -282,  -282,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,  -282,
+    -282,  -282,  -282,  -282,  -282,  -282,  -282,  -282,  -282,  -282,
+    -282,  -282,     0,     0,  -282,  -282,  -282,     0,     0,  -282,
+       0,     0,     0,     0,     0,  -282,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,  -282,     0,  -282,  -282,  -282,  -282,  -282,  -282,
+    -282,  -282,  -282,  -282,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,  -282,
+    -282,  -282,  -282,  -524,   252,  -282,  -282,  -282,  -282,     0,
+       0,  -524,  -524,  -524,     0,     0,     0,  -524,  -524,     0,
+    -524,     0,     0,     0,     0,     0,     0,     0,     0,  -524,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+    -524,  -524,     0,  -524,  -524,  -524,  -524,  -524,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,  -524,  -524,  -524,  -524,  -524,  -524,
+    -524,  -524,  -524,  -524,  -524,  -524,  -524,     0,     0,  -524,
+    -524,  -524,  -275,   694,     0,     0,     0,     0,     0,     0,
+    -275,  -275,  -275,     0,     0,     0,  -275,  -275,     0,  -275,
+       0,     0,     0,     0,     0,     0,   -97,  -524,     0,  -524,
+    -524,  -524,  -524,  -524,  -524,  -524,  -524,  -524,  -524,  -275,
+    -275,     0,  -275,  -275,  -275,  -275,  -275,     0,     0,     0,
+       0,     0,     0,  -524,  -524,  -524,  -524,   -89,     0,     0,
+    -524,     0,  -524,  -524,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,  -275,  -275,  -275,  -275,  -275,  -275,  -275,
+    -275,  -275,  -275,  -275,  -275,  -275,     0,     0,  -275,  -275,
+    -275,     0,   695,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   -99,  -275,     0,  -275,  -275,
+    -275,  -275,  -275,  -275,  -275,  -275,  -275,  -275,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,  -275,  -275,  -275,   -91,     0,     0,  -275,
+       0,  -275,  -275,   268,     0,     5,     6,     7,     8,     9,
+    -544,  -544,  -544,    10,    11,     0,     0,  -544,    12,     0,
+      13,    14,    15,    16,    17,    18,    19,     0,     0,     0,
+       0,     0,    20,    21,    22,    23,    24,    25,    26,     0,
+       0,    27,     0,     0,     0,     0,     0,    28,     0,    30,
+      31,    32,     0,    33,    34,    35,    36,    37,    38,     0,
+      39,    40,    41,     0,     0,    42,     0,     0,    43,    44,
+       0,    45,    46,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    47,     0,     0,    48,    49,     0,    50,    51,     0,
+      52,     0,    53,    54,    55,    56,    57,    58,    59,     0,
+       0,    60,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    61,    62,
+      63,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   268,     0,     5,     6,     7,     8,
+       9,  -544,  -544,  -544,    10,    11,     0,  -544,  -544,    12,
+       0,    13,    14,    15,    16,    17,    18,    19,     0,     0,
+       0,     0,     0,    20,    21,    22,    23,    24,    25,    26,
+       0,     0,    27,     0,     0,     0,     0,     0,    28,     0,
+      30,    31,    32,     0,    33,    34,    35,    36,    37,    38,
+       0,    39,    40,    41,     0,     0,    42,     0,     0,    43,
+      44,     0,    45,    46,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    47,     0,     0,    48,    49,     0,    50,    51,
+       0,    52,     0,    53,    54,    55,    56,    57,    58,    59,
+       0,     0,    60,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    61,
+      62,    63,     0,     0,     0,     0,     0,     0,     0,     0,
+     268,     0,     5,     6,     7,     8,     9,     0,     0,  -544,
+      10,    11,  -544,  -544,  -544,    12,  -544,    13,    14,    15,
+      16,    17,    18,    19,     0,     0,     0,     0,     0,    20,
+      21,    22,    23,    24,    25,    26,     0,     0,    27,     0,
+       0,     0,     0,     0,    28,     0,    30,    31,    32,     0,
+      33,    34,    35,    36,    37,    38,     0,    39,    40,    41,
+       0,     0,    42,     0,     0,    43,    44,     0,    45,    46,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    47,     0,
+       0,    48,    49,     0,    50,    51,     0,    52,     0,    53,
+      54,    55,    56,    57,    58,    59,     0,     0,    60,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    61,    62,    63,     0,     0,
+       0,     0,     0,     0,     0,     0,   268,     0,     5,     6,
+       7,     8,     9,     0,     0,  -544,    10,    11,  -544,  -544,
+    -544,    12,     0,    13,    14,    15,    16,    17,    18,    19,
+       0,     0,     0,     0,     0,    20,    21,    22,    23,    24,
+      25,    26,     0,     0,    27,     0,     0,     0,     0,     0,
+      28,     0,    30,    31,    32,     0,    33,    34,    35,    36,
+      37,    38,     0,    39,    40,    41,     0,     0,    42,     0,
+       0,    43,    44,     0,    45,    46,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    47,     0,     0,    48,    49,     0,
+      50,    51,     0,    52,     0,    53,    54,    55,    56,    57,
+      58,    59,     0,     0,    60,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    61,    62,    63,     0,     0,     0,     0,     0,     0,
+       0,     4,     0,     5,     6,     7,     8,     9,     0,     0,
+       0,    10,    11,     0,  -544,  -544,    12,     0,    13,    14,
+      15,    16,    17,    18,    19,     0,     0,     0,     0,     0,
+      20,    21,    22,    23,    24,    25,    26,     0,     0,    27,
+       0,     0,     0,     0,     0,    28,    29,    30,    31,    32,
+       0,    33,    34,    35,    36,    37,    38,     0,    39,    40,
+      41,     0,     0,    42,     0,     0,    43,    44,     0,    45,
+      46,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    47,
+       0,     0,    48,    49,     0,    50,    51,     0,    52,     0,
+      53,    54,    55,    56,    57,    58,    59,     0,     0,    60,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    61,    62,    63,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,  -544,     0,     0,     0,     0,     0,     0,     0,  -544,
+    -544,   268,     0,     5,     6,     7,     8,     9,     0,  -544,
+    -544,    10,    11,     0,     0,     0,    12,     0,    13,    14,
+      15,    16,    17,    18,    19,     0,     0,     0,     0,     0,
+      20,    21,    22,    23,    24,    25,    26,     0,     0,    27,
+       0,     0,     0,     0,     0,    28,     0,    30,    31,    32,
+       0,    33,    34,    35,    36,    37,    38,     0,    39,    40,
+      41,     0,     0,    42,     0,     0,    43,    44,     0,    45,
+      46,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    47,
+       0,     0,    48,    49,     0,    50,    51,     0,    52,     0,
+      53,    54,    55,    56,    57,    58,    59,     0,     0,    60,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    61,    62,    63,     0,
+       0,     0,     0,     0,     0,     0,   268,     0,     5,     6,
+       7,     8,     9,     0,     0,     0,    10,    11,     0,  -544,
+    -544,    12,     0,    13,    14,    15,    16,    17,    18,    19,
+       0,     0,     0,     0,     0,    20,    21,    22,    23,    24,
+      25,    26,     0,     0,    27,     0,     0,     0,     0,     0,
+      28,     0,    30,    31,    32,     0,    33,    34,    35,    36,
+      37,    38,     0,    39,    40,    41,     0,     0,    42,     0,
+       0,    43,    44,     0,    45,    46,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    47,     0,     0,   269,    49,     0,
+      50,    51,     0,    52,     0,    53,    54,    55,    56,    57,
+      58,    59,     0,     0,    60,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    61,    62,    63,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,  -544,     0,  -544,  -544,   268,     0,     5,     6,
+       7,     8,     9,     0,     0,     0,    10,    11,     0,     0,
+       0,    12,     0,    13,    14,    15,    16,    17,    18,    19,
+       0,     0,     0,     0,     0,    20,    21,    22,    23,    24,
+      25,    26,     0,     0,    27,     0,     0,     0,     0,     0,
+      28,     0,    30,    31,    32,     0,    33,    34,    35,    36,
+      37,    38,     0,    39,    40,    41,     0,     0,    42,     0,
+       0,    43,    44,     0,    45,    46,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    47,     0,     0,    48,    49,     0,
+      50,    51,     0,    52,     0,    53,    54,    55,    56,    57,
+      58,    59,     0,     0,    60,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    61,    62,    63,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,  -544,     0,  -544,  -544,   268,     0,     5,     6,
+       7,     8,     9,     0,     0,     0,    10,    11,     0,     0,
+       0,    12,     0,    13,    14,    15,    16,    17,    18,    19,
+       0,     0,     0,     0,     0,    20,    21,    22,    23,    24,
+      25,    26,     0,     0,    27,     0,     0,     0,     0,     0,
+      28,     0,    30,    31,    32,     0,    33,    34,    35,    36,
+      37,    38,     0,    39,    40,    41,     0,     0,    42,     0,
+       0,    43,    44,     0,    45,    46,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    47,     0,     0,    48,    49,     0,
+      50,    51,     0,    52,     0,    53,    54,    55,    56,    57,
+      58,    59,     0,     0,    60,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    61,    62,    63,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,  -544,   268,     0,     5,
+       6,     7,     8,     9,  -544,  -544,  -544,    10,    11,     0,
+       0,     0,    12,     0,    13,    14,    15,    16,    17,    18,
+      19,     0,     0,     0,     0,     0,    20,    21,    22,    23,
+      24,    25,    26,     0,     0,    27,     0,     0,     0,     0,
+       0,    28,     0,    30,    31,    32,     0,    33,    34,    35,
+      36,    37,    38,     0,    39,    40,    41,     0,     0,    42,
+       0,     0,    43,    44,     0,    45,    46,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    47,     0,     0,    48,    49,
+       0,    50,    51,     0,    52,     0,    53,    54,    55,    56,
+      57,    58,    59,     0,     0,    60,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    61,    62,    63,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     5,     6,     7,     0,     9,     0,
+       0,     0,    10,    11,     0,  -544,  -544,    12,     0,    13,
+      14,    15,    16,    17,    18,    19,     0,     0,     0,     0,
+       0,    20,    21,    22,    23,    24,    25,    26,     0,     0,
+     106,     0,     0,     0,     0,     0,     0,     0,     0,    31,
+      32,     0,    33,    34,    35,    36,    37,    38,   238,    39,
+      40,    41,     0,     0,    42,     0,     0,    43,    44,     0,
+      45,    46,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     213,     0,     0,   111,    49,     0,    50,    51,     0,   239,
+     240,    53,    54,    55,    56,    57,    58,    59,     0,     0,
+      60,     0,     0,     0,     0,     0,     0,     5,     6,     7,
+       0,     9,     0,     0,     0,    10,    11,    61,   241,    63,
+      12,     0,    13,    14,    15,    16,    17,    18,    19,     0,
+       0,     0,     0,     0,    20,    21,    22,    23,    24,    25,
+      26,   223,     0,    27,     0,     0,     0,     0,     0,     0,
+       0,     0,    31,    32,     0,    33,    34,    35,    36,    37,
+      38,     0,    39,    40,    41,     0,     0,    42,     0,     0,
+      43,    44,     0,    45,    46,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   213,     0,     0,   111,    49,     0,    50,
+      51,     0,     0,     0,    53,    54,    55,    56,    57,    58,
+      59,     0,     0,    60,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      61,    62,    63,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     5,     6,     7,     0,     9,     0,     0,     0,
+      10,    11,     0,   222,   223,    12,     0,    13,    14,    15,
+      16,    17,    18,    19,     0,     0,     0,     0,     0,    20,
+      21,    22,    23,    24,    25,    26,     0,     0,    27,     0,
+       0,     0,     0,     0,     0,     0,     0,    31,    32,     0,
+      33,    34,    35,    36,    37,    38,     0,    39,    40,    41,
+       0,     0,    42,     0,     0,    43,    44,     0,    45,    46,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   213,     0,
+       0,   111,    49,     0,    50,    51,     0,     0,     0,    53,
+      54,    55,    56,    57,    58,    59,     0,     0,    60,     0,
+       0,     0,     0,     0,     0,     5,     6,     7,     8,     9,
+       0,     0,     0,    10,    11,    61,    62,    63,    12,     0,
+      13,    14,    15,    16,    17,    18,    19,     0,     0,     0,
+       0,     0,    20,    21,    22,    23,    24,    25,    26,   223,
+       0,    27,     0,     0,     0,     0,     0,    28,    29,    30,
+      31,    32,     0,    33,    34,    35,    36,    37,    38,     0,
+      39,    40,    41,     0,     0,    42,     0,     0,    43,    44,
+       0,    45,    46,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    47,     0,     0,    48,    49,     0,    50,    51,     0,
+      52,     0,    53,    54,    55,    56,    57,    58,    59,     0,
+       0,    60,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    61,    62,
+      63,     0,     0,     0,     0,     0,     0,     5,     6,     7,
+       8,     9,     0,     0,     0,    10,    11,     0,     0,     0,
+      12,   412,    13,    14,    15,    16,    17,    18,    19,     0,
+       0,     0,     0,     0,    20,    21,    22,    23,    24,    25,
+      26,     0,     0,    27,     0,     0,     0,     0,     0,    28,
+       0,    30,    31,    32,     0,    33,    34,    35,    36,    37,
+      38,     0,    39,    40,    41,     0,     0,    42,     0,     0,
+      43,    44,     0,    45,    46,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    47,     0,     0,    48,    49,     0,    50,
+      51,     0,    52,     0,    53,    54,    55,    56,    57,    58,
+      59,     0,     0,    60,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      61,    62,    63,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   412,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,   131,   132,   133,   134,   135,   136,
+     137,   138,   139,   140,   141,   142,   143,   144,     0,     0,
+       0,   145,   146,   147,   148,   149,   150,   151,   152,   153,
+     154,     0,     0,     0,     0,     0,   155,   156,   157,   158,
+     159,   160,   161,   162,    35,    36,   163,    38,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     164,   165,   166,   167,   168,   169,   170,   171,   172,     0,
+       0,   173,   174,     0,     0,   175,   176,   177,   178,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   179,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   180,   181,   182,
+     183,   184,   185,   186,   187,   188,   189,     0,   190,   191,
+       0,     0,     0,     0,     0,  -517,  -517,  -517,     0,  -517,
+       0,     0,     0,  -517,  -517,     0,   192,   193,  -517,     0,
+    -517,  -517,  -517,  -517,  -517,  -517,  -517,     0,  -517,     0,
+       0,     0,  -517,  -517,  -517,  -517,  -517,  -517,  -517,     0,
+       0,  -517,     0,     0,     0,     0,     0,     0,     0,     0,
+    -517,  -517,     0,  -517,  -517,  -517,  -517,  -517,  -517,  -517,
+    -517,  -517,  -517,     0,     0,  -517,     0,     0,  -517,  -517,
+       0,  -517,  -517,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,  -517,     0,     0,  -517,  -517,     0,  -517,  -517,     0,
+    -517,  -517,  -517,  -517,  -517,  -517,  -517,  -517,  -517,     0,
+       0,  -517,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,  -517,  -517,
+    -517,     0,     0,     0,     0,     0,  -518,  -518,  -518,     0,
+    -518,     0,  -517,     0,  -518,  -518,     0,     0,  -517,  -518,
+       0,  -518,  -518,  -518,  -518,  -518,  -518,  -518,     0,  -518,
+       0,     0,     0,  -518,  -518,  -518,  -518,  -518,  -518,  -518,
+       0,     0,  -518,     0,     0,     0,     0,     0,     0,     0,
+       0,  -518,  -518,     0,  -518,  -518,  -518,  -518,  -518,  -518,
+    -518,  -518,  -518,  -518,     0,     0,  -518,     0,     0,  -518,
+    -518,     0,  -518,  -518,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,  -518,     0,     0,  -518,  -518,     0,  -518,  -518,
+       0,  -518,  -518,  -518,  -518,  -518,  -518,  -518,  -518,  -518,
+       0,     0,  -518,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,  -518,
+    -518,  -518,     0,     0,     0,     0,     0,  -520,  -520,  -520,
+       0,  -520,     0,  -518,     0,  -520,  -520,     0,     0,  -518,
+    -520,     0,  -520,  -520,  -520,  -520,  -520,  -520,  -520,     0,
+       0,     0,     0,     0,  -520,  -520,  -520,  -520,  -520,  -520,
+    -520,     0,     0,  -520,     0,     0,     0,     0,     0,     0,
+       0,     0,  -520,  -520,     0,  -520,  -520,  -520,  -520,  -520,
+    -520,  -520,  -520,  -520,  -520,     0,     0,  -520,     0,     0,
+    -520,  -520,     0,  -520,  -520,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,  -520,   733,     0,  -520,  -520,     0,  -520,
+    -520,     0,  -520,  -520,  -520,  -520,  -520,  -520,  -520,  -520,
+    -520,     0,     0,  -520,     0,     0,     0,   -97,     0,     0,
+       0,     0,     0,     0,     0,  -522,  -522,  -522,     0,  -522,
+    -520,  -520,  -520,  -522,  -522,     0,     0,     0,  -522,     0,
+    -522,  -522,  -522,  -522,  -522,  -522,  -522,     0,     0,     0,
+    -520,     0,  -522,  -522,  -522,  -522,  -522,  -522,  -522,     0,
+       0,  -522,     0,     0,     0,     0,     0,     0,     0,     0,
+    -522,  -522,     0,  -522,  -522,  -522,  -522,  -522,  -522,  -522,
+    -522,  -522,  -522,     0,     0,  -522,     0,     0,  -522,  -522,
+       0,  -522,  -522,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,  -522,     0,     0,  -522,  -522,     0,  -522,  -522,     0,
+    -522,  -522,  -522,  -522,  -522,  -522,  -522,  -522,  -522,     0,
+       0,  -522,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,  -523,  -523,  -523,     0,  -523,  -522,  -522,
+    -522,  -523,  -523,     0,     0,     0,  -523,     0,  -523,  -523,
+    -523,  -523,  -523,  -523,  -523,     0,     0,     0,  -522,     0,
+    -523,  -523,  -523,  -523,  -523,  -523,  -523,     0,     0,  -523,
+       0,     0,     0,     0,     0,     0,     0,     0,  -523,  -523,
+       0,  -523,  -523,  -523,  -523,  -523,  -523,  -523,  -523,  -523,
+    -523,     0,     0,  -523,     0,     0,  -523,  -523,     0,  -523,
+    -523,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,  -523,
+       0,     0,  -523,  -523,     0,  -523,  -523,     0,  -523,  -523,
+    -523,  -523,  -523,  -523,  -523,  -523,  -523,     0,     0,  -523,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,  -523,  -523,  -523,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,  -523,   121,   122,   123,
+     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
+     134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
+     144,     0,     0,     0,   145,   146,   147,   199,   200,   201,
+     202,   152,   153,   154,     0,     0,     0,     0,     0,   155,
+     156,   157,   203,   204,   160,   205,   162,   293,   294,   206,
+     295,     0,     0,     0,     0,     0,     0,   296,     0,     0,
+       0,     0,     0,   164,   165,   166,   167,   168,   169,   170,
+     171,   172,     0,     0,   173,   174,     0,     0,   175,   176,
+     177,   178,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   179,     0,     0,     0,     0,     0,     0,   297,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
+       0,   190,   191,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   192,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,     0,     0,     0,   145,   146,   147,
+     199,   200,   201,   202,   152,   153,   154,     0,     0,     0,
+       0,     0,   155,   156,   157,   203,   204,   160,   205,   162,
+     293,   294,   206,   295,     0,     0,     0,     0,     0,     0,
+     296,     0,     0,     0,     0,     0,   164,   165,   166,   167,
+     168,   169,   170,   171,   172,     0,     0,   173,   174,     0,
+       0,   175,   176,   177,   178,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   179,     0,     0,     0,     0,
+       0,     0,   393,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   180,   181,   182,   183,   184,   185,   186,
+     187,   188,   189,     0,   190,   191,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   192,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,   135,   136,   137,
+     138,   139,   140,   141,   142,   143,   144,     0,     0,     0,
+     145,   146,   147,   199,   200,   201,   202,   152,   153,   154,
+       0,     0,     0,     0,     0,   155,   156,   157,   203,   204,
+     160,   205,   162,     0,     0,   206,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   164,
+     165,   166,   167,   168,   169,   170,   171,   172,     0,     0,
+     173,   174,     0,     0,   175,   176,   177,   178,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   179,     0,
+       0,   207,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   180,   181,   182,   183,
+     184,   185,   186,   187,   188,   189,     0,   190,   191,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   192,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+       0,     0,     0,   145,   146,   147,   199,   200,   201,   202,
+     152,   153,   154,     0,     0,     0,     0,     0,   155,   156,
+     157,   203,   204,   160,   205,   162,     0,     0,   206,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   164,   165,   166,   167,   168,   169,   170,   171,
+     172,     0,     0,   173,   174,     0,     0,   175,   176,   177,
+     178,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   179,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   180,
+     181,   182,   183,   184,   185,   186,   187,   188,   189,     0,
+     190,   191,     0,     0,     5,     6,     7,     0,     9,     0,
+       0,     0,    10,    11,     0,     0,     0,    12,   192,    13,
+      14,    15,   101,   102,    18,    19,     0,     0,     0,     0,
+       0,   103,   104,   105,    23,    24,    25,    26,     0,     0,
+     106,     0,     0,     0,     0,     0,     0,     0,     0,    31,
+      32,     0,    33,    34,    35,    36,    37,    38,     0,    39,
+      40,    41,     0,     0,    42,     0,     0,    43,    44,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     286,     0,     0,   111,    49,     0,    50,    51,     0,     0,
+       0,    53,    54,    55,    56,    57,    58,    59,     0,     0,
+      60,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       5,     6,     7,     0,     9,     0,     0,   112,    10,    11,
+       0,     0,     0,    12,     0,    13,    14,    15,   101,   102,
+      18,    19,     0,     0,     0,   287,     0,   103,   104,   105,
+      23,    24,    25,    26,     0,     0,   106,     0,     0,     0,
+       0,     0,     0,     0,     0,    31,    32,     0,    33,    34,
+      35,    36,    37,    38,     0,    39,    40,    41,     0,     0,
+      42,     0,     0,    43,    44,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   286,     0,     0,   111,
+      49,     0,    50,    51,     0,     0,     0,    53,    54,    55,
+      56,    57,    58,    59,     0,     0,    60,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     5,     6,     7,     8,
+       9,     0,     0,   112,    10,    11,     0,     0,     0,    12,
+       0,    13,    14,    15,    16,    17,    18,    19,     0,     0,
+       0,   520,     0,    20,    21,    22,    23,    24,    25,    26,
+       0,     0,    27,     0,     0,     0,     0,     0,    28,    29,
+      30,    31,    32,     0,    33,    34,    35,    36,    37,    38,
+       0,    39,    40,    41,     0,     0,    42,     0,     0,    43,
+      44,     0,    45,    46,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    47,     0,     0,    48,    49,     0,    50,    51,
+       0,    52,     0,    53,    54,    55,    56,    57,    58,    59,
+       0,     0,    60,     0,     0,     0,     0,     0,     0,     5,
+       6,     7,     8,     9,     0,     0,     0,    10,    11,    61,
+      62,    63,    12,     0,    13,    14,    15,    16,    17,    18,
+      19,     0,     0,     0,     0,     0,    20,    21,    22,    23,
+      24,    25,    26,     0,     0,    27,     0,     0,     0,     0,
+       0,    28,     0,    30,    31,    32,     0,    33,    34,    35,
+      36,    37,    38,     0,    39,    40,    41,     0,     0,    42,
+       0,     0,    43,    44,     0,    45,    46,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    47,     0,     0,    48,    49,
+       0,    50,    51,     0,    52,     0,    53,    54,    55,    56,
+      57,    58,    59,     0,     0,    60,     0,     0,     0,     0,
+       0,     0,     5,     6,     7,     0,     9,     0,     0,     0,
+      10,    11,    61,    62,    63,    12,     0,    13,    14,    15,
+      16,    17,    18,    19,     0,     0,     0,     0,     0,    20,
+      21,    22,    23,    24,    25,    26,     0,     0,   106,     0,
+       0,     0,     0,     0,     0,     0,     0,    31,    32,     0,
+      33,    34,    35,    36,    37,    38,   238,    39,    40,    41,
+       0,     0,    42,     0,     0,    43,    44,     0,    45,    46,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   213,     0,
+       0,   111,    49,     0,    50,    51,     0,   239,   240,    53,
+      54,    55,    56,    57,    58,    59,     0,     0,    60,     0,
+       0,     0,     0,     0,     0,     5,     6,     7,     0,     9,
+       0,     0,     0,    10,    11,    61,   241,    63,    12,     0,
+      13,    14,    15,   101,   102,    18,    19,     0,     0,     0,
+       0,     0,   103,   104,   105,    23,    24,    25,    26,     0,
+       0,   106,     0,     0,     0,     0,     0,     0,     0,     0,
+      31,    32,     0,    33,    34,    35,    36,    37,    38,   238,
+      39,    40,    41,     0,     0,    42,     0,     0,    43,    44,
+       0,    45,    46,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   213,     0,     0,   111,    49,     0,    50,    51,     0,
+     630,   240,    53,    54,    55,    56,    57,    58,    59,     0,
+       0,    60,     0,     0,     0,     0,     0,     0,     5,     6,
+       7,     0,     9,     0,     0,     0,    10,    11,    61,   241,
+      63,    12,     0,    13,    14,    15,   101,   102,    18,    19,
+       0,     0,     0,     0,     0,   103,   104,   105,    23,    24,
+      25,    26,     0,     0,   106,     0,     0,     0,     0,     0,
+       0,     0,     0,    31,    32,     0,    33,    34,    35,    36,
+      37,    38,   238,    39,    40,    41,     0,     0,    42,     0,
+       0,    43,    44,     0,    45,    46,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   213,     0,     0,   111,    49,     0,
+      50,    51,     0,   239,     0,    53,    54,    55,    56,    57,
+      58,    59,     0,     0,    60,     0,     0,     0,     0,     0,
+       0,     5,     6,     7,     0,     9,     0,     0,     0,    10,
+      11,    61,   241,    63,    12,     0,    13,    14,    15,   101,
+     102,    18,    19,     0,     0,     0,     0,     0,   103,   104,
+     105,    23,    24,    25,    26,     0,     0,   106,     0,     0,
+       0,     0,     0,     0,     0,     0,    31,    32,     0,    33,
+      34,    35,    36,    37,    38,   238,    39,    40,    41,     0,
+       0,    42,     0,     0,    43,    44,     0,    45,    46,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   213,     0,     0,
+     111,    49,     0,    50,    51,     0,     0,   240,    53,    54,
+      55,    56,    57,    58,    59,     0,     0,    60,     0,     0,
+       0,     0,     0,     0,     5,     6,     7,     0,     9,     0,
+       0,     0,    10,    11,    61,   241,    63,    12,     0,    13,
+      14,    15,   101,   102,    18,    19,     0,     0,     0,     0,
+       0,   103,   104,   105,    23,    24,    25,    26,     0,     0,
+     106,     0,     0,     0,     0,     0,     0,     0,     0,    31,
+      32,     0,    33,    34,    35,    36,    37,    38,   238,    39,
+      40,    41,     0,     0,    42,     0,     0,    43,    44,     0,
+      45,    46,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     213,     0,     0,   111,    49,     0,    50,    51,     0,   630,
+       0,    53,    54,    55,    56,    57,    58,    59,     0,     0,
+      60,     0,     0,     0,     0,     0,     0,     5,     6,     7,
+       0,     9,     0,     0,     0,    10,    11,    61,   241,    63,
+      12,     0,    13,    14,    15,   101,   102,    18,    19,     0,
+       0,     0,     0,     0,   103,   104,   105,    23,    24,    25,
+      26,     0,     0,   106,     0,     0,     0,     0,     0,     0,
+       0,     0,    31,    32,     0,    33,    34,    35,    36,    37,
+      38,   238,    39,    40,    41,     0,     0,    42,     0,     0,
+      43,    44,     0,    45,    46,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   213,     0,     0,   111,    49,     0,    50,
+      51,     0,     0,     0,    53,    54,    55,    56,    57,    58,
+      59,     0,     0,    60,     0,     0,     0,     0,     0,     0,
+       5,     6,     7,     0,     9,     0,     0,     0,    10,    11,
+      61,   241,    63,    12,     0,    13,    14,    15,    16,    17,
+      18,    19,     0,     0,     0,     0,     0,    20,    21,    22,
+      23,    24,    25,    26,     0,     0,   106,     0,     0,     0,
+       0,     0,     0,     0,     0,    31,    32,     0,    33,    34,
+      35,    36,    37,    38,     0,    39,    40,    41,     0,     0,
+      42,     0,     0,    43,    44,     0,    45,    46,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   213,     0,     0,   111,
+      49,     0,    50,    51,     0,   514,     0,    53,    54,    55,
+      56,    57,    58,    59,     0,     0,    60,     0,     0,     0,
+       0,     0,     0,     5,     6,     7,     0,     9,     0,     0,
+       0,    10,    11,    61,   241,    63,    12,     0,    13,    14,
+      15,   101,   102,    18,    19,     0,     0,     0,     0,     0,
+     103,   104,   105,    23,    24,    25,    26,     0,     0,   106,
+       0,     0,     0,     0,     0,     0,     0,     0,    31,    32,
+       0,    33,    34,    35,    36,    37,    38,     0,    39,    40,
+      41,     0,     0,    42,     0,     0,    43,    44,     0,    45,
+      46,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   213,
+       0,     0,   111,    49,     0,    50,    51,     0,   239,     0,
+      53,    54,    55,    56,    57,    58,    59,     0,     0,    60,
+       0,     0,     0,     0,     0,     0,     5,     6,     7,     0,
+       9,     0,     0,     0,    10,    11,    61,   241,    63,    12,
+       0,    13,    14,    15,   101,   102,    18,    19,     0,     0,
+       0,     0,     0,   103,   104,   105,    23,    24,    25,    26,
+       0,     0,   106,     0,     0,     0,     0,     0,     0,     0,
+       0,    31,    32,     0,    33,    34,    35,    36,    37,    38,
+       0,    39,    40,    41,     0,     0,    42,     0,     0,    43,
+      44,     0,    45,    46,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   213,     0,     0,   111,    49,     0,    50,    51,
+       0,   514,     0,    53,    54,    55,    56,    57,    58,    59,
+       0,     0,    60,     0,     0,     0,     0,     0,     0,     5,
+       6,     7,     0,     9,     0,     0,     0,    10,    11,    61,
+     241,    63,    12,     0,    13,    14,    15,   101,   102,    18,
+      19,     0,     0,     0,     0,     0,   103,   104,   105,    23,
+      24,    25,    26,     0,     0,   106,     0,     0,     0,     0,
+       0,     0,     0,     0,    31,    32,     0,    33,    34,    35,
+      36,    37,    38,     0,    39,    40,    41,     0,     0,    42,
+       0,     0,    43,    44,     0,    45,    46,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   213,     0,     0,   111,    49,
+       0,    50,    51,     0,   782,     0,    53,    54,    55,    56,
+      57,    58,    59,     0,     0,    60,     0,     0,     0,     0,
+       0,     0,     5,     6,     7,     0,     9,     0,     0,     0,
+      10,    11,    61,   241,    63,    12,     0,    13,    14,    15,
+     101,   102,    18,    19,     0,     0,     0,     0,     0,   103,
+     104,   105,    23,    24,    25,    26,     0,     0,   106,     0,
+       0,     0,     0,     0,     0,     0,     0,    31,    32,     0,
+      33,    34,    35,    36,    37,    38,     0,    39,    40,    41,
+       0,     0,    42,     0,     0,    43,    44,     0,    45,    46,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   213,     0,
+       0,   111,    49,     0,    50,    51,     0,   630,     0,    53,
+      54,    55,    56,    57,    58,    59,     0,     0,    60,     0,
+       0,     0,     0,     0,     0,     5,     6,     7,     0,     9,
+       0,     0,     0,    10,    11,    61,   241,    63,    12,     0,
+      13,    14,    15,    16,    17,    18,    19,     0,     0,     0,
+       0,     0,    20,    21,    22,    23,    24,    25,    26,     0,
+       0,    27,     0,     0,     0,     0,     0,     0,     0,     0,
+      31,    32,     0,    33,    34,    35,    36,    37,    38,     0,
+      39,    40,    41,     0,     0,    42,     0,     0,    43,    44,
+       0,    45,    46,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   213,     0,     0,   111,    49,     0,    50,    51,     0,
+       0,     0,    53,    54,    55,    56,    57,    58,    59,     0,
+       0,    60,     0,     0,     0,     0,     0,     0,     5,     6,
+       7,     0,     9,     0,     0,     0,    10,    11,    61,    62,
+      63,    12,     0,    13,    14,    15,   101,   102,    18,    19,
+       0,     0,     0,     0,     0,   103,   104,   105,    23,    24,
+      25,    26,     0,     0,   106,     0,     0,     0,     0,     0,
+       0,     0,     0,    31,    32,     0,    33,    34,    35,    36,
+      37,    38,     0,    39,    40,    41,     0,     0,    42,     0,
+       0,    43,    44,     0,    45,    46,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   213,     0,     0,   111,    49,     0,
+      50,    51,     0,     0,     0,    53,    54,    55,    56,    57,
+      58,    59,     0,     0,    60,     0,     0,     0,     0,     0,
+       0,     5,     6,     7,     0,     9,     0,     0,     0,    10,
+      11,    61,   241,    63,    12,     0,    13,    14,    15,    16,
+      17,    18,    19,     0,     0,     0,     0,     0,    20,    21,
+      22,    23,    24,    25,    26,     0,     0,   106,     0,     0,
+       0,     0,     0,     0,     0,     0,    31,    32,     0,    33,
+      34,    35,    36,    37,    38,     0,    39,    40,    41,     0,
+       0,    42,     0,     0,    43,    44,     0,    45,    46,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   213,     0,     0,
+     111,    49,     0,    50,    51,     0,     0,     0,    53,    54,
+      55,    56,    57,    58,    59,     0,     0,    60,     0,     0,
+       0,     0,     0,     0,     5,     6,     7,     0,     9,     0,
+       0,     0,    10,    11,    61,   241,    63,    12,     0,    13,
+      14,    15,   101,   102,    18,    19,     0,     0,     0,     0,
+       0,   103,   104,   105,    23,    24,    25,    26,     0,     0,
+     106,     0,     0,     0,     0,     0,     0,     0,     0,    31,
+      32,     0,   107,    34,    35,    36,   108,    38,     0,    39,
+      40,    41,     0,     0,    42,     0,     0,    43,    44,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   109,     0,     0,
+     110,     0,     0,   111,    49,     0,    50,    51,     0,     0,
+       0,    53,    54,    55,    56,    57,    58,    59,     0,     0,
+      60,     0,     0,     5,     6,     7,     0,     9,     0,     0,
+       0,    10,    11,     0,     0,     0,    12,   112,    13,    14,
+      15,   101,   102,    18,    19,     0,     0,     0,     0,     0,
+     103,   104,   105,    23,    24,    25,    26,     0,     0,   106,
+       0,     0,     0,     0,     0,     0,     0,     0,    31,    32,
+       0,    33,    34,    35,    36,    37,    38,     0,    39,    40,
+      41,     0,     0,    42,     0,     0,    43,    44,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   231,
+       0,     0,    48,    49,     0,    50,    51,     0,    52,     0,
+      53,    54,    55,    56,    57,    58,    59,     0,     0,    60,
+       0,     0,     5,     6,     7,     0,     9,     0,     0,     0,
+      10,    11,     0,     0,     0,    12,   112,    13,    14,    15,
+     101,   102,    18,    19,     0,     0,     0,     0,     0,   103,
+     104,   105,    23,    24,    25,    26,     0,     0,   106,     0,
+       0,     0,     0,     0,     0,     0,     0,    31,    32,     0,
+      33,    34,    35,    36,    37,    38,     0,    39,    40,    41,
+       0,     0,    42,     0,     0,    43,    44,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   286,     0,
+       0,   332,    49,     0,    50,    51,     0,   333,     0,    53,
+      54,    55,    56,    57,    58,    59,     0,     0,    60,     0,
+       0,     5,     6,     7,     0,     9,     0,     0,     0,    10,
+      11,     0,     0,     0,    12,   112,    13,    14,    15,   101,
+     102,    18,    19,     0,     0,     0,     0,     0,   103,   104,
+     105,    23,    24,    25,    26,     0,     0,   106,     0,     0,
+       0,     0,     0,     0,     0,     0,    31,    32,     0,   107,
+      34,    35,    36,   108,    38,     0,    39,    40,    41,     0,
+       0,    42,     0,     0,    43,    44,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   110,     0,     0,
+     111,    49,     0,    50,    51,     0,     0,     0,    53,    54,
+      55,    56,    57,    58,    59,     0,     0,    60,     0,     0,
+       5,     6,     7,     0,     9,     0,     0,     0,    10,    11,
+       0,     0,     0,    12,   112,    13,    14,    15,   101,   102,
+      18,    19,     0,     0,     0,     0,     0,   103,   104,   105,
+      23,    24,    25,    26,     0,     0,   106,     0,     0,     0,
+       0,     0,     0,     0,     0,    31,    32,     0,    33,    34,
+      35,    36,    37,    38,     0,    39,    40,    41,     0,     0,
+      42,     0,     0,    43,    44,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   286,     0,     0,   332,
+      49,     0,    50,    51,     0,     0,     0,    53,    54,    55,
+      56,    57,    58,    59,     0,     0,    60,     0,     0,     5,
+       6,     7,     0,     9,     0,     0,     0,    10,    11,     0,
+       0,     0,    12,   112,    13,    14,    15,   101,   102,    18,
+      19,     0,     0,     0,     0,     0,   103,   104,   105,    23,
+      24,    25,    26,     0,     0,   106,     0,     0,     0,     0,
+       0,     0,     0,     0,    31,    32,     0,    33,    34,    35,
+      36,    37,    38,     0,    39,    40,    41,     0,     0,    42,
+       0,     0,    43,    44,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   865,     0,     0,   111,    49,
+       0,    50,    51,     0,     0,     0,    53,    54,    55,    56,
+      57,    58,    59,     0,     0,    60,     0,     0,     5,     6,
+       7,     0,     9,     0,     0,     0,    10,    11,     0,     0,
+       0,    12,   112,    13,    14,    15,   101,   102,    18,    19,
+       0,     0,     0,     0,     0,   103,   104,   105,    23,    24,
+      25,    26,     0,     0,   106,     0,     0,     0,     0,     0,
+       0,     0,     0,    31,    32,     0,    33,    34,    35,    36,
+      37,    38,     0,    39,    40,    41,     0,     0,    42,     0,
+       0,    43,    44,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   891,     0,     0,   111,    49,     0,
+      50,    51,     0,     0,     0,    53,    54,    55,    56,    57,
+      58,    59,     0,     0,    60,   563,   564,     0,     0,   565,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   112,     0,   164,   165,   166,   167,   168,   169,   170,
+     171,   172,     0,     0,   173,   174,     0,     0,   175,   176,
+     177,   178,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   179,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
+       0,   190,   191,   584,   556,     0,     0,   585,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   192,
+     255,   164,   165,   166,   167,   168,   169,   170,   171,   172,
+       0,     0,   173,   174,     0,     0,   175,   176,   177,   178,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     179,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,   189,     0,   190,
+     191,   569,   564,     0,     0,   570,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   192,   255,   164,
+     165,   166,   167,   168,   169,   170,   171,   172,     0,     0,
+     173,   174,     0,     0,   175,   176,   177,   178,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   179,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   180,   181,   182,   183,
+     184,   185,   186,   187,   188,   189,     0,   190,   191,   604,
+     556,     0,     0,   605,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   192,   255,   164,   165,   166,
+     167,   168,   169,   170,   171,   172,     0,     0,   173,   174,
+       0,     0,   175,   176,   177,   178,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   179,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   180,   181,   182,   183,   184,   185,
+     186,   187,   188,   189,     0,   190,   191,   607,   564,     0,
+       0,   608,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   192,   255,   164,   165,   166,   167,   168,
+     169,   170,   171,   172,     0,     0,   173,   174,     0,     0,
+     175,   176,   177,   178,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   179,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   180,   181,   182,   183,   184,   185,   186,   187,
+     188,   189,     0,   190,   191,   623,   556,     0,     0,   624,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   192,   255,   164,   165,   166,   167,   168,   169,   170,
+     171,   172,     0,     0,   173,   174,     0,     0,   175,   176,
+     177,   178,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   179,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
+       0,   190,   191,   626,   564,     0,     0,   627,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   192,
+     255,   164,   165,   166,   167,   168,   169,   170,   171,   172,
+       0,     0,   173,   174,     0,     0,   175,   176,   177,   178,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     179,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,   189,     0,   190,
+     191,   651,   556,     0,     0,   652,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   192,   255,   164,
+     165,   166,   167,   168,   169,   170,   171,   172,     0,     0,
+     173,   174,     0,     0,   175,   176,   177,   178,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   179,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   180,   181,   182,   183,
+     184,   185,   186,   187,   188,   189,     0,   190,   191,   654,
+     564,     0,     0,   655,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   192,   255,   164,   165,   166,
+     167,   168,   169,   170,   171,   172,     0,     0,   173,   174,
+       0,     0,   175,   176,   177,   178,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   179,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   180,   181,   182,   183,   184,   185,
+     186,   187,   188,   189,     0,   190,   191,   930,   556,     0,
+       0,   931,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   192,   255,   164,   165,   166,   167,   168,
+     169,   170,   171,   172,     0,     0,   173,   174,     0,     0,
+     175,   176,   177,   178,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   179,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   180,   181,   182,   183,   184,   185,   186,   187,
+     188,   189,     0,   190,   191,   933,   564,     0,     0,   934,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   192,   255,   164,   165,   166,   167,   168,   169,   170,
+     171,   172,     0,     0,   173,   174,     0,     0,   175,   176,
+     177,   178,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   179,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
+       0,   190,   191,   941,   556,     0,     0,   942,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   192,
+     255,   164,   165,   166,   167,   168,   169,   170,   171,   172,
+       0,     0,   173,   174,     0,     0,   175,   176,   177,   178,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     179,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,   189,     0,   190,
+     191,   569,   564,     0,     0,   570,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   192,   255,   164,
+     165,   166,   167,   168,   169,   170,   171,   172,     0,     0,
+     173,   174,     0,     0,   175,   176,   177,   178,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   179,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   180,   181,   182,   183,
+     184,   185,   186,   187,   188,   189,     0,   190,   191,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   192
+};
+
+static const yytype_int16 yycheck[] =
+{
+       2,    83,    27,    62,   221,   248,    12,    10,    11,    12,
+       8,    16,    17,    76,     7,    20,    28,   335,   409,     5,
+       6,   424,    16,    17,   427,    52,    20,    22,   292,    15,
+      28,   110,   292,    11,    12,   258,     4,    16,    17,   389,
+     363,    20,   362,   467,   364,   427,    49,   367,    50,    51,
+     273,   287,   335,   671,   277,   414,    50,    51,    12,    65,
+      25,    54,   599,     2,   387,     4,    52,   588,   388,   280,
+      25,    50,   609,   284,    65,    65,    48,   459,    27,   682,
+     403,   297,   402,   756,   404,   606,   758,    29,   304,    26,
+      76,   307,    13,   309,   417,   311,   520,   313,   418,    22,
+     834,   668,    26,    98,   625,    13,   109,   851,   114,     0,
+     105,    65,    88,    25,   362,   697,   364,    16,    17,   367,
+      25,    20,   704,   269,   119,   445,    13,    37,    38,   572,
+     573,   391,   653,   146,    79,    25,    88,   150,   386,    90,
+     388,   140,    13,   113,    88,    25,   469,    88,   113,    55,
+     470,    13,    28,    25,   402,    51,   404,   830,   113,    55,
+     114,     1,   113,   144,    25,    90,   108,   143,   416,   150,
+     418,   774,    25,   118,   144,    98,    90,   921,   912,   144,
+     113,    90,   147,    58,    59,   150,   332,   144,   113,   144,
+     142,   143,   147,   436,   146,   150,   444,   445,    13,   143,
+     149,   150,   143,   140,   113,    55,   429,   879,   881,   146,
+     433,    15,   113,    17,   207,   438,   140,   481,   224,   837,
+     468,   481,   470,   144,   287,   448,   229,   230,   149,   150,
+     453,   467,   144,   583,   224,   638,   639,   144,   911,   144,
+     150,   149,   150,   593,    25,   247,   248,   252,   146,   254,
+     255,   229,   230,   255,   144,   258,   259,   639,   252,   146,
+     254,   215,   149,   150,   144,   271,   690,   221,   711,   146,
+     224,   330,   144,   252,   841,   254,   335,   117,   149,   150,
+     271,   271,   849,   144,   520,   146,   823,   149,   150,   144,
+       2,   144,     4,     5,     6,   150,   519,   269,    10,    11,
+      12,   287,    88,    15,    16,    17,   333,   386,    20,   149,
+     150,   476,   371,   372,   146,   598,    88,   271,   321,   322,
+     323,   324,    88,   326,   327,   279,   280,    90,   592,   268,
+     284,   113,   592,    48,   149,   150,    48,    49,   149,   150,
+      52,    58,    59,   321,   322,   323,   324,   333,    88,    17,
+      62,   330,   320,   252,    26,   254,   335,   143,   363,    88,
+     332,   363,    88,   144,    76,   146,    88,    55,   591,   364,
+     142,   143,    88,   691,    26,    61,   382,   143,    64,    65,
+      88,   320,   387,    88,   149,   387,   325,   390,   747,    25,
+     633,    91,    88,   388,   396,   611,   111,   109,   403,   111,
+     617,   403,   465,   143,   467,   144,   408,   413,   414,   404,
+     144,   932,   417,   142,   143,   417,    88,   143,    88,   140,
+     142,   143,   682,   418,   827,   111,   142,   143,   382,   441,
+     424,   410,   823,   435,   436,   143,    88,   648,   143,   662,
+     442,    71,    88,   441,    26,   827,   142,   143,   147,    61,
+     445,   113,    64,    65,   690,   805,    71,   520,   150,   413,
+     414,    88,   456,   148,   469,   141,    88,   469,   140,    88,
+     142,   143,   142,   143,   146,   470,    55,   144,   144,   465,
+      71,   467,    90,   150,    88,   487,    71,   489,   140,   491,
+     142,   143,    97,   658,   659,   718,   142,   143,    88,   111,
+     212,   144,    90,   442,    63,   113,    88,   750,   123,   124,
+     125,   513,   451,    10,   864,   142,   143,   229,   230,   544,
+     142,   143,    90,   142,   143,   113,    90,   668,    37,    38,
+     671,     8,   755,    13,   520,    10,   144,   562,   142,   143,
+     252,   682,   254,   255,    90,   113,   258,   259,   263,   113,
+     810,   263,   142,   143,   269,   147,   268,   269,   140,   113,
+     142,   143,    90,   588,   146,   560,   568,   113,   144,   571,
+     572,   573,   144,   568,   580,   287,   571,    14,    15,   582,
+     144,   606,   905,   141,   596,   113,   906,   589,   594,   144,
+      51,   756,   587,   758,   589,   812,   598,   599,   596,   601,
+     625,   818,   595,   144,   582,    26,   144,   609,   320,   321,
+     322,   323,   324,   325,   326,   327,   144,   332,   330,   598,
+     332,   333,   144,   335,   706,   628,   580,   690,   653,    71,
+      63,   633,   691,    51,   144,   694,   695,   560,   144,   664,
+     594,   700,   701,   144,   638,   568,   113,    10,   571,    15,
+     628,   363,    10,   141,   144,   141,   904,   682,   906,   371,
+     372,   144,   115,   617,   148,   830,   831,    88,    10,    10,
+      90,     9,   920,    10,    90,   387,    91,   389,   390,   121,
+     122,   123,   124,   125,   399,    10,   144,   399,    90,   144,
+     147,   403,   407,   113,   648,   407,   837,   113,    51,   149,
+      53,    54,    55,    56,   690,   417,   141,   713,   849,   711,
+     851,   113,    10,   144,   879,   144,   881,   144,   144,   140,
+     113,   142,   143,   725,   144,   146,   728,   730,   144,   118,
+     442,   144,    51,    62,   793,    64,    65,   144,   144,   451,
+      10,   747,   144,   144,   141,    10,   911,    10,   750,   774,
+      10,   118,   730,   465,   144,   467,   144,   469,    62,   713,
+      64,    65,   141,   765,   766,    10,   768,    55,   770,   771,
+      63,    64,    65,   144,   776,   144,   778,   779,    55,   144,
+     921,   496,   111,   144,   496,    51,    10,    53,    54,    55,
+      56,   144,   144,   747,    10,     2,    51,     4,    53,    54,
+      55,    56,   146,    10,    11,    12,   146,   111,   520,    16,
+      17,   144,    15,    20,    63,    64,    65,   442,   111,   671,
+       6,   823,   674,    71,   571,   811,    92,   908,   658,   912,
+     682,   907,    98,    99,    63,    64,    65,    92,    86,    87,
+     707,    48,    49,    98,    99,   613,    51,     7,    53,    54,
+      55,    56,   810,   849,   120,    62,   668,   123,   812,   884,
+     846,    -1,   111,   198,   818,   120,    64,    65,   123,    -1,
+     582,   583,   120,   121,   122,   123,   124,   125,    -1,    -1,
+      -1,   593,   111,    71,   150,   887,   888,   889,   890,    -1,
+      -1,   146,   894,   895,   896,    -1,   898,   899,    86,    87,
+     905,    -1,   109,   905,   111,   907,   908,   932,    71,    -1,
+      -1,   906,   110,   111,    -1,    -1,   628,    64,    65,   238,
+     239,   240,    -1,    86,    87,    -1,    51,    -1,    53,    54,
+      55,    56,    -1,   121,   122,   123,   124,   125,   940,   144,
+      -1,   943,   944,   945,   946,    40,    41,    42,    43,    44,
+     665,   666,   954,   665,   666,   118,   119,   120,   121,   122,
+     123,   124,   125,   110,   111,    -1,    -1,    92,   683,    -1,
+      -1,   683,    -1,    98,    99,    -1,    -1,    -1,   690,   691,
+      -1,    -1,   694,   695,    -1,   837,    -1,   839,   700,   701,
+      -1,   843,    -1,   708,   709,   120,   708,   709,   123,   851,
+      -1,   853,    63,    64,    65,   212,    63,    64,    65,    -1,
+      -1,   330,   727,    -1,    -1,   727,   335,    -1,   730,    -1,
+      -1,   146,   229,   230,    63,    64,    65,    -1,   743,   744,
+     745,   743,   744,   745,    63,    64,    65,    51,    -1,    53,
+      54,    55,    56,    -1,    -1,   252,    -1,   254,   255,    -1,
+     111,   258,   259,    -1,   111,    51,   263,    53,    54,    55,
+      56,   268,   269,   915,    55,    56,    57,    58,    59,   921,
+      -1,   923,   111,    -1,   926,    -1,    -1,    -1,    92,    -1,
+      -1,   793,   111,    -1,    98,    99,    -1,    -1,    -1,   804,
+      -1,   410,   804,   805,    -1,    -1,    92,    -1,   950,   811,
+     815,    -1,    98,   815,   423,   424,   120,    -1,   427,   123,
+      -1,    -1,    -1,   320,   321,   322,   323,   324,   325,   326,
+     327,    -1,    -1,   330,    -1,   332,    -1,    51,   335,    53,
+      54,    55,    56,    -1,   846,    -1,    -1,   456,    -1,    51,
+     459,    53,    54,    55,    56,    -1,    51,    -1,    53,    54,
+      55,    56,   864,    -1,    -1,   870,   363,   872,   870,    -1,
+     872,    -1,    -1,   878,   371,   372,   878,    -1,    92,    -1,
+      -1,    -1,    -1,    -1,    98,    -1,    -1,    -1,    -1,    -1,
+     387,    -1,   389,   390,    -1,    -1,    51,    92,    53,    54,
+      55,    56,   399,   905,    99,   514,   403,    -1,    -1,     0,
+     407,    -1,    -1,    -1,    -1,    -1,    -1,     8,     9,    10,
+     417,    -1,    13,    14,    15,   120,    17,    -1,    44,    -1,
+      -1,    -1,    -1,    -1,    -1,    26,    27,    92,    -1,    16,
+      17,    -1,    -1,    20,    -1,   442,    37,    38,    -1,    40,
+      41,    42,    43,    44,   451,    71,    72,    73,    74,    75,
+      76,    77,    78,    79,    80,    81,    82,    83,    45,    46,
+      86,    87,   469,    50,    51,    -1,    51,    -1,    53,    54,
+      55,    56,    -1,    -1,    -1,    62,    63,    -1,    -1,   598,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    88,   114,   496,
+     116,   117,   118,   119,   120,   121,   122,   123,   124,   125,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    92,    -1,    -1,
+      -1,   630,    -1,    98,    99,    -1,    -1,    -1,   144,   638,
+     639,     2,    -1,     4,     5,     6,     7,    44,    -1,    -1,
+      -1,    -1,    -1,    -1,    15,   120,    -1,   656,   123,   140,
+     141,    -1,   143,    -1,    -1,   146,   147,    -1,   149,   150,
+      -1,    -1,    -1,    -1,    71,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    82,    83,    48,   687,    86,
+      87,    52,    -1,    -1,    -1,   582,   583,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   593,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    76,    -1,   114,    -1,   116,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   628,    -1,   742,    -1,    -1,    -1,    -1,    -1,    -1,
+     111,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   238,   239,   240,   241,    -1,    -1,    -1,   665,   666,
+      -1,    -1,    -1,   782,    -1,   252,    -1,   254,   255,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   683,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   691,    -1,    -1,   694,   695,    -1,
+      -1,    -1,    -1,   700,   701,    -1,    -1,    -1,    -1,    -1,
+      -1,   708,   709,    -1,    -1,    -1,    -1,    -1,   827,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     727,    -1,    -1,   730,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   212,    -1,    -1,    -1,    -1,   743,   744,   745,    -1,
+      -1,    -1,    -1,   330,    -1,    -1,    -1,    -1,   335,   336,
+     337,   338,   339,   340,   341,   342,   343,   344,   345,   346,
+     347,   348,   349,   350,   351,   352,   353,   354,   355,   356,
+     357,   358,   359,   360,   361,    -1,   363,    -1,    -1,    -1,
+      -1,    -1,   263,    -1,   371,   372,   793,   268,   269,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   804,   805,    -1,
+     387,    -1,    -1,    -1,    -1,    -1,   287,    -1,   815,    -1,
+      -1,    -1,    -1,    -1,   401,    -1,   403,    -1,   405,   406,
+      -1,    -1,    -1,   410,    -1,    -1,    -1,    -1,    -1,    -1,
+     417,    -1,    -1,    -1,    -1,    -1,   423,   424,    -1,   320,
+     427,    -1,    -1,    -1,   325,    -1,    -1,    -1,    -1,    -1,
+      -1,   332,   333,    -1,    -1,    -1,    -1,   864,    -1,   446,
+      -1,    -1,    -1,   870,    -1,   872,    -1,    -1,    -1,   456,
+      -1,   878,   459,     2,    -1,     4,    -1,    -1,    -1,    -1,
+      -1,    -1,   469,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,     2,    -1,     4,     5,     6,   905,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    15,    -1,   389,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   503,   504,   399,    48,
+       2,    -1,     4,    -1,    -1,    -1,   407,   514,    -1,    -1,
+      -1,    -1,    -1,    15,    -1,    -1,    -1,    -1,    -1,    48,
+      -1,    -1,    -1,    52,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   442,    -1,    -1,    -1,    -1,    48,    76,    -1,    -1,
+     451,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   111,    -1,   465,    -1,   467,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   489,    -1,   491,    -1,    -1,
+      -1,    -1,   111,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   598,    -1,    -1,    -1,   496,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   111,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   520,
+      -1,    -1,    -1,   630,    71,    72,    73,    74,    75,    76,
+      77,   638,   639,    80,    81,    -1,    -1,    -1,    -1,    86,
+      87,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   656,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   212,    -1,    -1,    -1,    -1,    -1,   116,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,    -1,
+     687,    -1,   583,   212,   691,   692,    -1,   694,   695,    -1,
+      -1,    -1,   593,   700,   701,    -1,    71,    72,    73,    74,
+      75,    76,    77,   710,    -1,    80,    81,    -1,    -1,    -1,
+     212,    86,    87,    -1,   263,    -1,    -1,    -1,    -1,   268,
+     269,    -1,    -1,    -1,    -1,    -1,   733,   734,    -1,   736,
+     737,    -1,    -1,    -1,   263,   742,    -1,    -1,    -1,   268,
+     269,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   287,    -1,
+      -1,   263,    -1,    -1,   665,   666,   268,   269,    -1,    -1,
+      -1,   320,    -1,    -1,    -1,   782,   325,    -1,    -1,   786,
+      -1,    -1,   683,   332,    -1,    -1,   793,    -1,    -1,   690,
+      -1,   320,    -1,    -1,    -1,    -1,   325,    -1,    -1,    -1,
+      -1,    -1,    -1,   332,   333,    -1,    -1,   708,   709,    -1,
+      -1,    -1,    -1,   820,    -1,    -1,    -1,    -1,   320,    -1,
+     827,    -1,    -1,   325,    -1,    -1,   727,    -1,    -1,    -1,
+     332,    -1,    -1,   335,    -1,    -1,    -1,    -1,    -1,    -1,
+     389,    -1,   743,   744,   745,    -1,    -1,    -1,    -1,    -1,
+     399,   765,   766,    -1,   768,    -1,   770,   771,   407,    -1,
+     389,    -1,   776,    -1,   778,   779,    -1,    -1,    -1,    -1,
+     399,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   407,    71,
+      72,    73,    74,    75,    76,    77,    78,   389,    80,    81,
+      -1,    -1,    -1,   442,    86,    87,    -1,   399,   905,    -1,
+      -1,    -1,   451,   804,   805,   407,    -1,    -1,    -1,    -1,
+     811,    -1,    -1,   442,   815,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   451,    44,   116,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,    -1,    -1,   465,    -1,   467,    -1,
+     442,    -1,    -1,    -1,    -1,   846,    -1,   496,    -1,   451,
+      71,    72,    73,    74,    75,    76,    77,    78,    79,    80,
+      81,    82,    83,   864,    -1,    86,    87,   496,    -1,   870,
+      -1,   872,    -1,   887,   888,   889,   890,   878,    -1,    -1,
+     894,   895,   896,    -1,   898,   899,    -1,    -1,    -1,    -1,
+      -1,   520,    -1,   114,   496,   116,   117,   118,   119,   120,
+     121,   122,   123,   124,   125,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   940,    -1,    -1,   943,
+     944,   945,   946,    -1,   583,    -1,    -1,    51,    52,    -1,
+     954,    55,    -1,    -1,   593,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   583,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,   593,    -1,    80,    81,    -1,    -1,
+      84,    85,    86,    87,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   583,    -1,    -1,    98,    -1,    -1,    -1,    -1,    -1,
+      -1,   593,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   116,   117,   118,   119,   120,   121,   122,   123,
+     124,   125,    -1,   127,   128,    -1,   665,   666,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   145,   146,    -1,   683,    -1,   665,   666,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   683,    -1,    -1,    -1,    -1,   708,
+     709,   690,    -1,   665,   666,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   727,   708,
+     709,   683,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   691,
+      -1,    -1,    -1,    -1,   743,   744,   745,    -1,   727,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   708,   709,    -1,    -1,
+      -1,    -1,    -1,    -1,   743,   744,   745,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   727,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   743,   744,   745,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   804,   805,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   815,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   804,   805,    -1,    -1,    -1,
+      -1,    -1,   811,    -1,    -1,    -1,   815,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   804,   805,    -1,    -1,    -1,    -1,    -1,   811,
+      -1,    -1,    -1,   815,    -1,   864,    -1,   846,    -1,    -1,
+      -1,   870,    -1,   872,    -1,    -1,    -1,    -1,    -1,   878,
+      -1,    -1,    -1,    -1,    -1,   864,    -1,    -1,    -1,    -1,
+      -1,   870,    -1,   872,    -1,    -1,    -1,    -1,    -1,   878,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   864,    -1,    -1,    -1,    -1,    -1,   870,    -1,
+     872,    -1,    -1,    -1,     0,     1,   878,     3,     4,     5,
+       6,     7,    -1,    -1,    -1,    11,    12,    -1,    -1,    -1,
+      16,    -1,    18,    19,    20,    21,    22,    23,    24,    -1,
+      -1,    -1,    -1,    -1,    30,    31,    32,    33,    34,    35,
+      36,    -1,    -1,    39,    -1,    -1,    -1,    -1,    -1,    45,
+      46,    47,    48,    49,    -1,    51,    52,    53,    54,    55,
+      56,    -1,    58,    59,    60,    -1,    -1,    63,    -1,    -1,
+      66,    67,    -1,    69,    70,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    89,    -1,    -1,    92,    93,    -1,    95,
+      96,    -1,    98,    -1,   100,   101,   102,   103,   104,   105,
+     106,    -1,    -1,   109,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     0,    -1,
+     126,   127,   128,    -1,    -1,    -1,     8,     9,    10,    -1,
+      -1,    13,    14,    15,    -1,    17,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   149,   150,    27,    28,    29,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    37,    38,    -1,    40,    41,
+      42,    43,    44,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    71,    72,    73,    74,    75,    76,    77,    78,    79,
+      80,    81,    82,    83,    -1,    -1,    86,    87,    -1,    71,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      82,    83,    -1,    -1,    86,    87,    88,    -1,    90,    91,
+      -1,    -1,    -1,    -1,   114,    97,   116,   117,   118,   119,
+     120,   121,   122,   123,   124,   125,   108,    -1,    -1,    -1,
+      -1,   113,   114,   115,   116,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,    -1,    -1,    -1,    -1,    -1,    -1,
+     150,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   141,
+     142,   143,   144,     0,    -1,   147,   148,   149,   150,    -1,
+      -1,     8,     9,    10,    -1,    -1,    13,    14,    15,    -1,
+      17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    26,
+      27,    28,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      37,    38,    -1,    40,    41,    42,    43,    44,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    -1,
+      -1,    86,    87,    -1,    71,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    82,    83,    -1,    -1,    86,
+      87,    88,    -1,    -1,    91,    -1,    -1,    -1,    -1,   114,
+      97,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,    -1,    -1,    -1,    -1,    -1,    -1,   114,    -1,   116,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   140,   141,   142,   143,   144,     0,   146,
+     147,   148,   149,   150,    -1,    -1,     8,     9,    10,    -1,
+      -1,    13,    14,    15,    -1,    17,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    27,    28,    29,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    37,    38,    -1,    40,    41,
+      42,    43,    44,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    71,    72,    73,    74,    75,    76,    77,    78,    79,
+      80,    81,    82,    83,    -1,    -1,    86,    87,    -1,    71,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      82,    83,    -1,    -1,    86,    87,    88,    -1,    -1,    91,
+      -1,    -1,    -1,    -1,    -1,    97,   116,   117,   118,   119,
+     120,   121,   122,   123,   124,   125,   108,    -1,    -1,    -1,
+      -1,    -1,   114,   115,   116,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   141,
+     142,   143,   144,     0,    -1,   147,   148,   149,   150,    -1,
+      -1,     8,     9,    10,    -1,    -1,    13,    14,    15,    -1,
+      17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    26,
+      27,    28,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      37,    38,    -1,    40,    41,    42,    43,    44,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    71,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    82,    83,    -1,    -1,    86,
+      87,    88,    -1,    -1,    91,    -1,    -1,    -1,    -1,    -1,
+      97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   114,    -1,   116,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   140,   141,   142,   143,   144,     0,   146,
+     147,   148,   149,   150,    -1,    -1,     8,     9,    10,    -1,
+      -1,    13,    14,    15,    -1,    17,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    27,    28,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    37,    38,    -1,    40,    41,
+      42,    43,    44,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    71,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      82,    83,    -1,    -1,    86,    87,    88,    -1,    -1,    91,
+      -1,    -1,    -1,    -1,    -1,    97,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   114,    -1,   116,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   141,
+     142,   143,   144,     0,   146,   147,   148,   149,   150,    -1,
+      -1,     8,     9,    10,    -1,    -1,    -1,    14,    15,    -1,
+      17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    26,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      37,    38,    -1,    40,    41,    42,    43,    44,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    71,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    82,    83,    -1,    -1,    86,
+      87,    88,     0,    90,    -1,    -1,    -1,    -1,    -1,    -1,
+       8,     9,    10,    -1,    -1,    -1,    14,    15,    -1,    17,
+      -1,    -1,    -1,    -1,    -1,    -1,   113,   114,    -1,   116,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,    37,
+      38,    -1,    40,    41,    42,    43,    44,    -1,    -1,    -1,
+      -1,    -1,    -1,   140,   141,   142,   143,   144,    -1,    -1,
+     147,    -1,   149,   150,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    71,    72,    73,    74,    75,    76,    77,
+      78,    79,    80,    81,    82,    83,    -1,    -1,    86,    87,
+      88,    -1,    90,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   113,   114,    -1,   116,   117,
+     118,   119,   120,   121,   122,   123,   124,   125,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   141,   142,   143,   144,    -1,    -1,   147,
+      -1,   149,   150,     1,    -1,     3,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,    -1,    -1,    15,    16,    -1,
+      18,    19,    20,    21,    22,    23,    24,    -1,    -1,    -1,
+      -1,    -1,    30,    31,    32,    33,    34,    35,    36,    -1,
+      -1,    39,    -1,    -1,    -1,    -1,    -1,    45,    -1,    47,
+      48,    49,    -1,    51,    52,    53,    54,    55,    56,    -1,
+      58,    59,    60,    -1,    -1,    63,    -1,    -1,    66,    67,
+      -1,    69,    70,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    89,    -1,    -1,    92,    93,    -1,    95,    96,    -1,
+      98,    -1,   100,   101,   102,   103,   104,   105,   106,    -1,
+      -1,   109,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   126,   127,
+     128,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,     1,    -1,     3,     4,     5,     6,
+       7,   149,   150,    10,    11,    12,    -1,    14,    15,    16,
+      -1,    18,    19,    20,    21,    22,    23,    24,    -1,    -1,
+      -1,    -1,    -1,    30,    31,    32,    33,    34,    35,    36,
+      -1,    -1,    39,    -1,    -1,    -1,    -1,    -1,    45,    -1,
+      47,    48,    49,    -1,    51,    52,    53,    54,    55,    56,
+      -1,    58,    59,    60,    -1,    -1,    63,    -1,    -1,    66,
+      67,    -1,    69,    70,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    89,    -1,    -1,    92,    93,    -1,    95,    96,
+      -1,    98,    -1,   100,   101,   102,   103,   104,   105,   106,
+      -1,    -1,   109,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   126,
+     127,   128,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+       1,    -1,     3,     4,     5,     6,     7,    -1,    -1,    10,
+      11,    12,   149,   150,    15,    16,    17,    18,    19,    20,
+      21,    22,    23,    24,    -1,    -1,    -1,    -1,    -1,    30,
+      31,    32,    33,    34,    35,    36,    -1,    -1,    39,    -1,
+      -1,    -1,    -1,    -1,    45,    -1,    47,    48,    49,    -1,
+      51,    52,    53,    54,    55,    56,    -1,    58,    59,    60,
+      -1,    -1,    63,    -1,    -1,    66,    67,    -1,    69,    70,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    89,    -1,
+      -1,    92,    93,    -1,    95,    96,    -1,    98,    -1,   100,
+     101,   102,   103,   104,   105,   106,    -1,    -1,   109,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   126,   127,   128,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,     1,    -1,     3,     4,
+       5,     6,     7,    -1,    -1,    10,    11,    12,   149,   150,
+      15,    16,    -1,    18,    19,    20,    21,    22,    23,    24,
+      -1,    -1,    -1,    -1,    -1,    30,    31,    32,    33,    34,
+      35,    36,    -1,    -1,    39,    -1,    -1,    -1,    -1,    -1,
+      45,    -1,    47,    48,    49,    -1,    51,    52,    53,    54,
+      55,    56,    -1,    58,    59,    60,    -1,    -1,    63,    -1,
+      -1,    66,    67,    -1,    69,    70,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    89,    -1,    -1,    92,    93,    -1,
+      95,    96,    -1,    98,    -1,   100,   101,   102,   103,   104,
+     105,   106,    -1,    -1,   109,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   126,   127,   128,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,     1,    -1,     3,     4,     5,     6,     7,    -1,    -1,
+      -1,    11,    12,    -1,   149,   150,    16,    -1,    18,    19,
+      20,    21,    22,    23,    24,    -1,    -1,    -1,    -1,    -1,
+      30,    31,    32,    33,    34,    35,    36,    -1,    -1,    39,
+      -1,    -1,    -1,    -1,    -1,    45,    46,    47,    48,    49,
+      -1,    51,    52,    53,    54,    55,    56,    -1,    58,    59,
+      60,    -1,    -1,    63,    -1,    -1,    66,    67,    -1,    69,
+      70,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    89,
+      -1,    -1,    92,    93,    -1,    95,    96,    -1,    98,    -1,
+     100,   101,   102,   103,   104,   105,   106,    -1,    -1,   109,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   126,   127,   128,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   141,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   149,
+     150,     1,    -1,     3,     4,     5,     6,     7,    -1,     9,
+      10,    11,    12,    -1,    -1,    -1,    16,    -1,    18,    19,
+      20,    21,    22,    23,    24,    -1,    -1,    -1,    -1,    -1,
+      30,    31,    32,    33,    34,    35,    36,    -1,    -1,    39,
+      -1,    -1,    -1,    -1,    -1,    45,    -1,    47,    48,    49,
+      -1,    51,    52,    53,    54,    55,    56,    -1,    58,    59,
+      60,    -1,    -1,    63,    -1,    -1,    66,    67,    -1,    69,
+      70,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    89,
+      -1,    -1,    92,    93,    -1,    95,    96,    -1,    98,    -1,
+     100,   101,   102,   103,   104,   105,   106,    -1,    -1,   109,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   126,   127,   128,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,     1,    -1,     3,     4,
+       5,     6,     7,    -1,    -1,    -1,    11,    12,    -1,   149,
+     150,    16,    -1,    18,    19,    20,    21,    22,    23,    24,
+      -1,    -1,    -1,    -1,    -1,    30,    31,    32,    33,    34,
+      35,    36,    -1,    -1,    39,    -1,    -1,    -1,    -1,    -1,
+      45,    -1,    47,    48,    49,    -1,    51,    52,    53,    54,
+      55,    56,    -1,    58,    59,    60,    -1,    -1,    63,    -1,
+      -1,    66,    67,    -1,    69,    70,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    89,    -1,    -1,    92,    93,    -1,
+      95,    96,    -1,    98,    -1,   100,   101,   102,   103,   104,
+     105,   106,    -1,    -1,   109,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   126,   127,   128,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   147,    -1,   149,   150,     1,    -1,     3,     4,
+       5,     6,     7,    -1,    -1,    -1,    11,    12,    -1,    -1,
+      -1,    16,    -1,    18,    19,    20,    21,    22,    23,    24,
+      -1,    -1,    -1,    -1,    -1,    30,    31,    32,    33,    34,
+      35,    36,    -1,    -1,    39,    -1,    -1,    -1,    -1,    -1,
+      45,    -1,    47,    48,    49,    -1,    51,    52,    53,    54,
+      55,    56,    -1,    58,    59,    60,    -1,    -1,    63,    -1,
+      -1,    66,    67,    -1,    69,    70,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    89,    -1,    -1,    92,    93,    -1,
+      95,    96,    -1,    98,    -1,   100,   101,   102,   103,   104,
+     105,   106,    -1,    -1,   109,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   126,   127,   128,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   147,    -1,   149,   150,     1,    -1,     3,     4,
+       5,     6,     7,    -1,    -1,    -1,    11,    12,    -1,    -1,
+      -1,    16,    -1,    18,    19,    20,    21,    22,    23,    24,
+      -1,    -1,    -1,    -1,    -1,    30,    31,    32,    33,    34,
+      35,    36,    -1,    -1,    39,    -1,    -1,    -1,    -1,    -1,
+      45,    -1,    47,    48,    49,    -1,    51,    52,    53,    54,
+      55,    56,    -1,    58,    59,    60,    -1,    -1,    63,    -1,
+      -1,    66,    67,    -1,    69,    70,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    89,    -1,    -1,    92,    93,    -1,
+      95,    96,    -1,    98,    -1,   100,   101,   102,   103,   104,
+     105,   106,    -1,    -1,   109,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   126,   127,   128,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   141,     1,    -1,     3,
+       4,     5,     6,     7,   149,   150,    10,    11,    12,    -1,
+      -1,    -1,    16,    -1,    18,    19,    20,    21,    22,    23,
+      24,    -1,    -1,    -1,    -1,    -1,    30,    31,    32,    33,
+      34,    35,    36,    -1,    -1,    39,    -1,    -1,    -1,    -1,
+      -1,    45,    -1,    47,    48,    49,    -1,    51,    52,    53,
+      54,    55,    56,    -1,    58,    59,    60,    -1,    -1,    63,
+      -1,    -1,    66,    67,    -1,    69,    70,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    89,    -1,    -1,    92,    93,
+      -1,    95,    96,    -1,    98,    -1,   100,   101,   102,   103,
+     104,   105,   106,    -1,    -1,   109,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   126,   127,   128,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,     3,     4,     5,    -1,     7,    -1,
+      -1,    -1,    11,    12,    -1,   149,   150,    16,    -1,    18,
+      19,    20,    21,    22,    23,    24,    -1,    -1,    -1,    -1,
+      -1,    30,    31,    32,    33,    34,    35,    36,    -1,    -1,
+      39,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    48,
+      49,    -1,    51,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    -1,    -1,    63,    -1,    -1,    66,    67,    -1,
+      69,    70,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      89,    -1,    -1,    92,    93,    -1,    95,    96,    -1,    98,
+      99,   100,   101,   102,   103,   104,   105,   106,    -1,    -1,
+     109,    -1,    -1,    -1,    -1,    -1,    -1,     3,     4,     5,
+      -1,     7,    -1,    -1,    -1,    11,    12,   126,   127,   128,
+      16,    -1,    18,    19,    20,    21,    22,    23,    24,    -1,
+      -1,    -1,    -1,    -1,    30,    31,    32,    33,    34,    35,
+      36,   150,    -1,    39,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    48,    49,    -1,    51,    52,    53,    54,    55,
+      56,    -1,    58,    59,    60,    -1,    -1,    63,    -1,    -1,
+      66,    67,    -1,    69,    70,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    89,    -1,    -1,    92,    93,    -1,    95,
+      96,    -1,    -1,    -1,   100,   101,   102,   103,   104,   105,
+     106,    -1,    -1,   109,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     126,   127,   128,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,     3,     4,     5,    -1,     7,    -1,    -1,    -1,
+      11,    12,    -1,   149,   150,    16,    -1,    18,    19,    20,
+      21,    22,    23,    24,    -1,    -1,    -1,    -1,    -1,    30,
+      31,    32,    33,    34,    35,    36,    -1,    -1,    39,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    48,    49,    -1,
+      51,    52,    53,    54,    55,    56,    -1,    58,    59,    60,
+      -1,    -1,    63,    -1,    -1,    66,    67,    -1,    69,    70,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    89,    -1,
+      -1,    92,    93,    -1,    95,    96,    -1,    -1,    -1,   100,
+     101,   102,   103,   104,   105,   106,    -1,    -1,   109,    -1,
+      -1,    -1,    -1,    -1,    -1,     3,     4,     5,     6,     7,
+      -1,    -1,    -1,    11,    12,   126,   127,   128,    16,    -1,
+      18,    19,    20,    21,    22,    23,    24,    -1,    -1,    -1,
+      -1,    -1,    30,    31,    32,    33,    34,    35,    36,   150,
+      -1,    39,    -1,    -1,    -1,    -1,    -1,    45,    46,    47,
+      48,    49,    -1,    51,    52,    53,    54,    55,    56,    -1,
+      58,    59,    60,    -1,    -1,    63,    -1,    -1,    66,    67,
+      -1,    69,    70,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    89,    -1,    -1,    92,    93,    -1,    95,    96,    -1,
+      98,    -1,   100,   101,   102,   103,   104,   105,   106,    -1,
+      -1,   109,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   126,   127,
+     128,    -1,    -1,    -1,    -1,    -1,    -1,     3,     4,     5,
+       6,     7,    -1,    -1,    -1,    11,    12,    -1,    -1,    -1,
+      16,   149,    18,    19,    20,    21,    22,    23,    24,    -1,
+      -1,    -1,    -1,    -1,    30,    31,    32,    33,    34,    35,
+      36,    -1,    -1,    39,    -1,    -1,    -1,    -1,    -1,    45,
+      -1,    47,    48,    49,    -1,    51,    52,    53,    54,    55,
+      56,    -1,    58,    59,    60,    -1,    -1,    63,    -1,    -1,
+      66,    67,    -1,    69,    70,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    89,    -1,    -1,    92,    93,    -1,    95,
+      96,    -1,    98,    -1,   100,   101,   102,   103,   104,   105,
+     106,    -1,    -1,   109,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     126,   127,   128,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   149,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,    -1,    -1,
+      -1,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    -1,    -1,    -1,    -1,    -1,    45,    46,    47,    48,
+      49,    50,    51,    52,    53,    54,    55,    56,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      69,    70,    71,    72,    73,    74,    75,    76,    77,    -1,
+      -1,    80,    81,    -1,    -1,    84,    85,    86,    87,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    98,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   116,   117,   118,
+     119,   120,   121,   122,   123,   124,   125,    -1,   127,   128,
+      -1,    -1,    -1,    -1,    -1,     3,     4,     5,    -1,     7,
+      -1,    -1,    -1,    11,    12,    -1,   145,   146,    16,    -1,
+      18,    19,    20,    21,    22,    23,    24,    -1,    26,    -1,
+      -1,    -1,    30,    31,    32,    33,    34,    35,    36,    -1,
+      -1,    39,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      48,    49,    -1,    51,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    -1,    -1,    63,    -1,    -1,    66,    67,
+      -1,    69,    70,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    89,    -1,    -1,    92,    93,    -1,    95,    96,    -1,
+      98,    99,   100,   101,   102,   103,   104,   105,   106,    -1,
+      -1,   109,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   126,   127,
+     128,    -1,    -1,    -1,    -1,    -1,     3,     4,     5,    -1,
+       7,    -1,   140,    -1,    11,    12,    -1,    -1,   146,    16,
+      -1,    18,    19,    20,    21,    22,    23,    24,    -1,    26,
+      -1,    -1,    -1,    30,    31,    32,    33,    34,    35,    36,
+      -1,    -1,    39,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    48,    49,    -1,    51,    52,    53,    54,    55,    56,
+      57,    58,    59,    60,    -1,    -1,    63,    -1,    -1,    66,
+      67,    -1,    69,    70,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    89,    -1,    -1,    92,    93,    -1,    95,    96,
+      -1,    98,    99,   100,   101,   102,   103,   104,   105,   106,
+      -1,    -1,   109,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   126,
+     127,   128,    -1,    -1,    -1,    -1,    -1,     3,     4,     5,
+      -1,     7,    -1,   140,    -1,    11,    12,    -1,    -1,   146,
+      16,    -1,    18,    19,    20,    21,    22,    23,    24,    -1,
+      -1,    -1,    -1,    -1,    30,    31,    32,    33,    34,    35,
+      36,    -1,    -1,    39,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    48,    49,    -1,    51,    52,    53,    54,    55,
+      56,    57,    58,    59,    60,    -1,    -1,    63,    -1,    -1,
+      66,    67,    -1,    69,    70,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    89,    90,    -1,    92,    93,    -1,    95,
+      96,    -1,    98,    99,   100,   101,   102,   103,   104,   105,
+     106,    -1,    -1,   109,    -1,    -1,    -1,   113,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,     3,     4,     5,    -1,     7,
+     126,   127,   128,    11,    12,    -1,    -1,    -1,    16,    -1,
+      18,    19,    20,    21,    22,    23,    24,    -1,    -1,    -1,
+     146,    -1,    30,    31,    32,    33,    34,    35,    36,    -1,
+      -1,    39,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      48,    49,    -1,    51,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    -1,    -1,    63,    -1,    -1,    66,    67,
+      -1,    69,    70,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    89,    -1,    -1,    92,    93,    -1,    95,    96,    -1,
+      98,    99,   100,   101,   102,   103,   104,   105,   106,    -1,
+      -1,   109,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,     3,     4,     5,    -1,     7,   126,   127,
+     128,    11,    12,    -1,    -1,    -1,    16,    -1,    18,    19,
+      20,    21,    22,    23,    24,    -1,    -1,    -1,   146,    -1,
+      30,    31,    32,    33,    34,    35,    36,    -1,    -1,    39,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    48,    49,
+      -1,    51,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,    -1,    -1,    63,    -1,    -1,    66,    67,    -1,    69,
+      70,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    89,
+      -1,    -1,    92,    93,    -1,    95,    96,    -1,    98,    99,
+     100,   101,   102,   103,   104,   105,   106,    -1,    -1,   109,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   126,   127,   128,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   146,     3,     4,     5,
+       6,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
+      26,    -1,    -1,    -1,    30,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    -1,    -1,    -1,    -1,    -1,    45,
+      46,    47,    48,    49,    50,    51,    52,    53,    54,    55,
+      56,    -1,    -1,    -1,    -1,    -1,    -1,    63,    -1,    -1,
+      -1,    -1,    -1,    69,    70,    71,    72,    73,    74,    75,
+      76,    77,    -1,    -1,    80,    81,    -1,    -1,    84,    85,
+      86,    87,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    98,    -1,    -1,    -1,    -1,    -1,    -1,   105,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     116,   117,   118,   119,   120,   121,   122,   123,   124,   125,
+      -1,   127,   128,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   145,
+       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
+      23,    24,    25,    26,    -1,    -1,    -1,    30,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    -1,    -1,    -1,
+      -1,    -1,    45,    46,    47,    48,    49,    50,    51,    52,
+      53,    54,    55,    56,    -1,    -1,    -1,    -1,    -1,    -1,
+      63,    -1,    -1,    -1,    -1,    -1,    69,    70,    71,    72,
+      73,    74,    75,    76,    77,    -1,    -1,    80,    81,    -1,
+      -1,    84,    85,    86,    87,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    98,    -1,    -1,    -1,    -1,
+      -1,    -1,   105,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   116,   117,   118,   119,   120,   121,   122,
+     123,   124,   125,    -1,   127,   128,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   145,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
+      20,    21,    22,    23,    24,    25,    26,    -1,    -1,    -1,
+      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      -1,    -1,    -1,    -1,    -1,    45,    46,    47,    48,    49,
+      50,    51,    52,    -1,    -1,    55,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    69,
+      70,    71,    72,    73,    74,    75,    76,    77,    -1,    -1,
+      80,    81,    -1,    -1,    84,    85,    86,    87,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    98,    -1,
+      -1,   101,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   116,   117,   118,   119,
+     120,   121,   122,   123,   124,   125,    -1,   127,   128,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   145,     3,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      -1,    -1,    -1,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    -1,    -1,    -1,    -1,    -1,    45,    46,
+      47,    48,    49,    50,    51,    52,    -1,    -1,    55,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    69,    70,    71,    72,    73,    74,    75,    76,
+      77,    -1,    -1,    80,    81,    -1,    -1,    84,    85,    86,
+      87,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   116,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,    -1,
+     127,   128,    -1,    -1,     3,     4,     5,    -1,     7,    -1,
+      -1,    -1,    11,    12,    -1,    -1,    -1,    16,   145,    18,
+      19,    20,    21,    22,    23,    24,    -1,    -1,    -1,    -1,
+      -1,    30,    31,    32,    33,    34,    35,    36,    -1,    -1,
+      39,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    48,
+      49,    -1,    51,    52,    53,    54,    55,    56,    -1,    58,
+      59,    60,    -1,    -1,    63,    -1,    -1,    66,    67,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      89,    -1,    -1,    92,    93,    -1,    95,    96,    -1,    -1,
+      -1,   100,   101,   102,   103,   104,   105,   106,    -1,    -1,
+     109,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+       3,     4,     5,    -1,     7,    -1,    -1,   126,    11,    12,
+      -1,    -1,    -1,    16,    -1,    18,    19,    20,    21,    22,
+      23,    24,    -1,    -1,    -1,   144,    -1,    30,    31,    32,
+      33,    34,    35,    36,    -1,    -1,    39,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    48,    49,    -1,    51,    52,
+      53,    54,    55,    56,    -1,    58,    59,    60,    -1,    -1,
+      63,    -1,    -1,    66,    67,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    89,    -1,    -1,    92,
+      93,    -1,    95,    96,    -1,    -1,    -1,   100,   101,   102,
+     103,   104,   105,   106,    -1,    -1,   109,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,     3,     4,     5,     6,
+       7,    -1,    -1,   126,    11,    12,    -1,    -1,    -1,    16,
+      -1,    18,    19,    20,    21,    22,    23,    24,    -1,    -1,
+      -1,   144,    -1,    30,    31,    32,    33,    34,    35,    36,
+      -1,    -1,    39,    -1,    -1,    -1,    -1,    -1,    45,    46,
+      47,    48,    49,    -1,    51,    52,    53,    54,    55,    56,
+      -1,    58,    59,    60,    -1,    -1,    63,    -1,    -1,    66,
+      67,    -1,    69,    70,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    89,    -1,    -1,    92,    93,    -1,    95,    96,
+      -1,    98,    -1,   100,   101,   102,   103,   104,   105,   106,
+      -1,    -1,   109,    -1,    -1,    -1,    -1,    -1,    -1,     3,
+       4,     5,     6,     7,    -1,    -1,    -1,    11,    12,   126,
+     127,   128,    16,    -1,    18,    19,    20,    21,    22,    23,
+      24,    -1,    -1,    -1,    -1,    -1,    30,    31,    32,    33,
+      34,    35,    36,    -1,    -1,    39,    -1,    -1,    -1,    -1,
+      -1,    45,    -1,    47,    48,    49,    -1,    51,    52,    53,
+      54,    55,    56,    -1,    58,    59,    60,    -1,    -1,    63,
+      -1,    -1,    66,    67,    -1,    69,    70,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    89,    -1,    -1,    92,    93,
+      -1,    95,    96,    -1,    98,    -1,   100,   101,   102,   103,
+     104,   105,   106,    -1,    -1,   109,    -1,    -1,    -1,    -1,
+      -1,    -1,     3,     4,     5,    -1,     7,    -1,    -1,    -1,
+      11,    12,   126,   127,   128,    16,    -1,    18,    19,    20,
+      21,    22,    23,    24,    -1,    -1,    -1,    -1,    -1,    30,
+      31,    32,    33,    34,    35,    36,    -1,    -1,    39,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    48,    49,    -1,
+      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
+      -1,    -1,    63,    -1,    -1,    66,    67,    -1,    69,    70,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    89,    -1,
+      -1,    92,    93,    -1,    95,    96,    -1,    98,    99,   100,
+     101,   102,   103,   104,   105,   106,    -1,    -1,   109,    -1,
+      -1,    -1,    -1,    -1,    -1,     3,     4,     5,    -1,     7,
+      -1,    -1,    -1,    11,    12,   126,   127,   128,    16,    -1,
+      18,    19,    20,    21,    22,    23,    24,    -1,    -1,    -1,
+      -1,    -1,    30,    31,    32,    33,    34,    35,    36,    -1,
+      -1,    39,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      48,    49,    -1,    51,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    -1,    -1,    63,    -1,    -1,    66,    67,
+      -1,    69,    70,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    89,    -1,    -1,    92,    93,    -1,    95,    96,    -1,
+      98,    99,   100,   101,   102,   103,   104,   105,   106,    -1,
+      -1,   109,    -1,    -1,    -1,    -1,    -1,    -1,     3,     4,
+       5,    -1,     7,    -1,    -1,    -1,    11,    12,   126,   127,
+     128,    16,    -1,    18,    19,    20,    21,    22,    23,    24,
+      -1,    -1,    -1,    -1,    -1,    30,    31,    32,    33,    34,
+      35,    36,    -1,    -1,    39,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    48,    49,    -1,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    -1,    -1,    63,    -1,
+      -1,    66,    67,    -1,    69,    70,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    89,    -1,    -1,    92,    93,    -1,
+      95,    96,    -1,    98,    -1,   100,   101,   102,   103,   104,
+     105,   106,    -1,    -1,   109,    -1,    -1,    -1,    -1,    -1,
+      -1,     3,     4,     5,    -1,     7,    -1,    -1,    -1,    11,
+      12,   126,   127,   128,    16,    -1,    18,    19,    20,    21,
+      22,    23,    24,    -1,    -1,    -1,    -1,    -1,    30,    31,
+      32,    33,    34,    35,    36,    -1,    -1,    39,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    48,    49,    -1,    51,
+      52,    53,    54,    55,    56,    57,    58,    59,    60,    -1,
+      -1,    63,    -1,    -1,    66,    67,    -1,    69,    70,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    89,    -1,    -1,
+      92,    93,    -1,    95,    96,    -1,    -1,    99,   100,   101,
+     102,   103,   104,   105,   106,    -1,    -1,   109,    -1,    -1,
+      -1,    -1,    -1,    -1,     3,     4,     5,    -1,     7,    -1,
+      -1,    -1,    11,    12,   126,   127,   128,    16,    -1,    18,
+      19,    20,    21,    22,    23,    24,    -1,    -1,    -1,    -1,
+      -1,    30,    31,    32,    33,    34,    35,    36,    -1,    -1,
+      39,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    48,
+      49,    -1,    51,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    -1,    -1,    63,    -1,    -1,    66,    67,    -1,
+      69,    70,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      89,    -1,    -1,    92,    93,    -1,    95,    96,    -1,    98,
+      -1,   100,   101,   102,   103,   104,   105,   106,    -1,    -1,
+     109,    -1,    -1,    -1,    -1,    -1,    -1,     3,     4,     5,
+      -1,     7,    -1,    -1,    -1,    11,    12,   126,   127,   128,
+      16,    -1,    18,    19,    20,    21,    22,    23,    24,    -1,
+      -1,    -1,    -1,    -1,    30,    31,    32,    33,    34,    35,
+      36,    -1,    -1,    39,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    48,    49,    -1,    51,    52,    53,    54,    55,
+      56,    57,    58,    59,    60,    -1,    -1,    63,    -1,    -1,
+      66,    67,    -1,    69,    70,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    89,    -1,    -1,    92,    93,    -1,    95,
+      96,    -1,    -1,    -1,   100,   101,   102,   103,   104,   105,
+     106,    -1,    -1,   109,    -1,    -1,    -1,    -1,    -1,    -1,
+       3,     4,     5,    -1,     7,    -1,    -1,    -1,    11,    12,
+     126,   127,   128,    16,    -1,    18,    19,    20,    21,    22,
+      23,    24,    -1,    -1,    -1,    -1,    -1,    30,    31,    32,
+      33,    34,    35,    36,    -1,    -1,    39,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    48,    49,    -1,    51,    52,
+      53,    54,    55,    56,    -1,    58,    59,    60,    -1,    -1,
+      63,    -1,    -1,    66,    67,    -1,    69,    70,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    89,    -1,    -1,    92,
+      93,    -1,    95,    96,    -1,    98,    -1,   100,   101,   102,
+     103,   104,   105,   106,    -1,    -1,   109,    -1,    -1,    -1,
+      -1,    -1,    -1,     3,     4,     5,    -1,     7,    -1,    -1,
+      -1,    11,    12,   126,   127,   128,    16,    -1,    18,    19,
+      20,    21,    22,    23,    24,    -1,    -1,    -1,    -1,    -1,
+      30,    31,    32,    33,    34,    35,    36,    -1,    -1,    39,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    48,    49,
+      -1,    51,    52,    53,    54,    55,    56,    -1,    58,    59,
+      60,    -1,    -1,    63,    -1,    -1,    66,    67,    -1,    69,
+      70,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    89,
+      -1,    -1,    92,    93,    -1,    95,    96,    -1,    98,    -1,
+     100,   101,   102,   103,   104,   105,   106,    -1,    -1,   109,
+      -1,    -1,    -1,    -1,    -1,    -1,     3,     4,     5,    -1,
+       7,    -1,    -1,    -1,    11,    12,   126,   127,   128,    16,
+      -1,    18,    19,    20,    21,    22,    23,    24,    -1,    -1,
+      -1,    -1,    -1,    30,    31,    32,    33,    34,    35,    36,
+      -1,    -1,    39,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    48,    49,    -1,    51,    52,    53,    54,    55,    56,
+      -1,    58,    59,    60,    -1,    -1,    63,    -1,    -1,    66,
+      67,    -1,    69,    70,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    89,    -1,    -1,    92,    93,    -1,    95,    96,
+      -1,    98,    -1,   100,   101,   102,   103,   104,   105,   106,
+      -1,    -1,   109,    -1,    -1,    -1,    -1,    -1,    -1,     3,
+       4,     5,    -1,     7,    -1,    -1,    -1,    11,    12,   126,
+     127,   128,    16,    -1,    18,    19,    20,    21,    22,    23,
+      24,    -1,    -1,    -1,    -1,    -1,    30,    31,    32,    33,
+      34,    35,    36,    -1,    -1,    39,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    48,    49,    -1,    51,    52,    53,
+      54,    55,    56,    -1,    58,    59,    60,    -1,    -1,    63,
+      -1,    -1,    66,    67,    -1,    69,    70,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    89,    -1,    -1,    92,    93,
+      -1,    95,    96,    -1,    98,    -1,   100,   101,   102,   103,
+     104,   105,   106,    -1,    -1,   109,    -1,    -1,    -1,    -1,
+      -1,    -1,     3,     4,     5,    -1,     7,    -1,    -1,    -1,
+      11,    12,   126,   127,   128,    16,    -1,    18,    19,    20,
+      21,    22,    23,    24,    -1,    -1,    -1,    -1,    -1,    30,
+      31,    32,    33,    34,    35,    36,    -1,    -1,    39,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    48,    49,    -1,
+      51,    52,    53,    54,    55,    56,    -1,    58,    59,    60,
+      -1,    -1,    63,    -1,    -1,    66,    67,    -1,    69,    70,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    89,    -1,
+      -1,    92,    93,    -1,    95,    96,    -1,    98,    -1,   100,
+     101,   102,   103,   104,   105,   106,    -1,    -1,   109,    -1,
+      -1,    -1,    -1,    -1,    -1,     3,     4,     5,    -1,     7,
+      -1,    -1,    -1,    11,    12,   126,   127,   128,    16,    -1,
+      18,    19,    20,    21,    22,    23,    24,    -1,    -1,    -1,
+      -1,    -1,    30,    31,    32,    33,    34,    35,    36,    -1,
+      -1,    39,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      48,    49,    -1,    51,    52,    53,    54,    55,    56,    -1,
+      58,    59,    60,    -1,    -1,    63,    -1,    -1,    66,    67,
+      -1,    69,    70,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    89,    -1,    -1,    92,    93,    -1,    95,    96,    -1,
+      -1,    -1,   100,   101,   102,   103,   104,   105,   106,    -1,
+      -1,   109,    -1,    -1,    -1,    -1,    -1,    -1,     3,     4,
+       5,    -1,     7,    -1,    -1,    -1,    11,    12,   126,   127,
+     128,    16,    -1,    18,    19,    20,    21,    22,    23,    24,
+      -1,    -1,    -1,    -1,    -1,    30,    31,    32,    33,    34,
+      35,    36,    -1,    -1,    39,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    48,    49,    -1,    51,    52,    53,    54,
+      55,    56,    -1,    58,    59,    60,    -1,    -1,    63,    -1,
+      -1,    66,    67,    -1,    69,    70,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    89,    -1,    -1,    92,    93,    -1,
+      95,    96,    -1,    -1,    -1,   100,   101,   102,   103,   104,
+     105,   106,    -1,    -1,   109,    -1,    -1,    -1,    -1,    -1,
+      -1,     3,     4,     5,    -1,     7,    -1,    -1,    -1,    11,
+      12,   126,   127,   128,    16,    -1,    18,    19,    20,    21,
+      22,    23,    24,    -1,    -1,    -1,    -1,    -1,    30,    31,
+      32,    33,    34,    35,    36,    -1,    -1,    39,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    48,    49,    -1,    51,
+      52,    53,    54,    55,    56,    -1,    58,    59,    60,    -1,
+      -1,    63,    -1,    -1,    66,    67,    -1,    69,    70,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    89,    -1,    -1,
+      92,    93,    -1,    95,    96,    -1,    -1,    -1,   100,   101,
+     102,   103,   104,   105,   106,    -1,    -1,   109,    -1,    -1,
+      -1,    -1,    -1,    -1,     3,     4,     5,    -1,     7,    -1,
+      -1,    -1,    11,    12,   126,   127,   128,    16,    -1,    18,
+      19,    20,    21,    22,    23,    24,    -1,    -1,    -1,    -1,
+      -1,    30,    31,    32,    33,    34,    35,    36,    -1,    -1,
+      39,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    48,
+      49,    -1,    51,    52,    53,    54,    55,    56,    -1,    58,
+      59,    60,    -1,    -1,    63,    -1,    -1,    66,    67,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    86,    -1,    -1,
+      89,    -1,    -1,    92,    93,    -1,    95,    96,    -1,    -1,
+      -1,   100,   101,   102,   103,   104,   105,   106,    -1,    -1,
+     109,    -1,    -1,     3,     4,     5,    -1,     7,    -1,    -1,
+      -1,    11,    12,    -1,    -1,    -1,    16,   126,    18,    19,
+      20,    21,    22,    23,    24,    -1,    -1,    -1,    -1,    -1,
+      30,    31,    32,    33,    34,    35,    36,    -1,    -1,    39,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    48,    49,
+      -1,    51,    52,    53,    54,    55,    56,    -1,    58,    59,
+      60,    -1,    -1,    63,    -1,    -1,    66,    67,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    89,
+      -1,    -1,    92,    93,    -1,    95,    96,    -1,    98,    -1,
+     100,   101,   102,   103,   104,   105,   106,    -1,    -1,   109,
+      -1,    -1,     3,     4,     5,    -1,     7,    -1,    -1,    -1,
+      11,    12,    -1,    -1,    -1,    16,   126,    18,    19,    20,
+      21,    22,    23,    24,    -1,    -1,    -1,    -1,    -1,    30,
+      31,    32,    33,    34,    35,    36,    -1,    -1,    39,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    48,    49,    -1,
+      51,    52,    53,    54,    55,    56,    -1,    58,    59,    60,
+      -1,    -1,    63,    -1,    -1,    66,    67,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    89,    -1,
+      -1,    92,    93,    -1,    95,    96,    -1,    98,    -1,   100,
+     101,   102,   103,   104,   105,   106,    -1,    -1,   109,    -1,
+      -1,     3,     4,     5,    -1,     7,    -1,    -1,    -1,    11,
+      12,    -1,    -1,    -1,    16,   126,    18,    19,    20,    21,
+      22,    23,    24,    -1,    -1,    -1,    -1,    -1,    30,    31,
+      32,    33,    34,    35,    36,    -1,    -1,    39,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    48,    49,    -1,    51,
+      52,    53,    54,    55,    56,    -1,    58,    59,    60,    -1,
+      -1,    63,    -1,    -1,    66,    67,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    89,    -1,    -1,
+      92,    93,    -1,    95,    96,    -1,    -1,    -1,   100,   101,
+     102,   103,   104,   105,   106,    -1,    -1,   109,    -1,    -1,
+       3,     4,     5,    -1,     7,    -1,    -1,    -1,    11,    12,
+      -1,    -1,    -1,    16,   126,    18,    19,    20,    21,    22,
+      23,    24,    -1,    -1,    -1,    -1,    -1,    30,    31,    32,
+      33,    34,    35,    36,    -1,    -1,    39,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    48,    49,    -1,    51,    52,
+      53,    54,    55,    56,    -1,    58,    59,    60,    -1,    -1,
+      63,    -1,    -1,    66,    67,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    89,    -1,    -1,    92,
+      93,    -1,    95,    96,    -1,    -1,    -1,   100,   101,   102,
+     103,   104,   105,   106,    -1,    -1,   109,    -1,    -1,     3,
+       4,     5,    -1,     7,    -1,    -1,    -1,    11,    12,    -1,
+      -1,    -1,    16,   126,    18,    19,    20,    21,    22,    23,
+      24,    -1,    -1,    -1,    -1,    -1,    30,    31,    32,    33,
+      34,    35,    36,    -1,    -1,    39,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    48,    49,    -1,    51,    52,    53,
+      54,    55,    56,    -1,    58,    59,    60,    -1,    -1,    63,
+      -1,    -1,    66,    67,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    89,    -1,    -1,    92,    93,
+      -1,    95,    96,    -1,    -1,    -1,   100,   101,   102,   103,
+     104,   105,   106,    -1,    -1,   109,    -1,    -1,     3,     4,
+       5,    -1,     7,    -1,    -1,    -1,    11,    12,    -1,    -1,
+      -1,    16,   126,    18,    19,    20,    21,    22,    23,    24,
+      -1,    -1,    -1,    -1,    -1,    30,    31,    32,    33,    34,
+      35,    36,    -1,    -1,    39,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    48,    49,    -1,    51,    52,    53,    54,
+      55,    56,    -1,    58,    59,    60,    -1,    -1,    63,    -1,
+      -1,    66,    67,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    89,    -1,    -1,    92,    93,    -1,
+      95,    96,    -1,    -1,    -1,   100,   101,   102,   103,   104,
+     105,   106,    -1,    -1,   109,    51,    52,    -1,    -1,    55,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   126,    -1,    69,    70,    71,    72,    73,    74,    75,
+      76,    77,    -1,    -1,    80,    81,    -1,    -1,    84,    85,
+      86,    87,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     116,   117,   118,   119,   120,   121,   122,   123,   124,   125,
+      -1,   127,   128,    51,    52,    -1,    -1,    55,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   145,
+     146,    69,    70,    71,    72,    73,    74,    75,    76,    77,
+      -1,    -1,    80,    81,    -1,    -1,    84,    85,    86,    87,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   116,   117,
+     118,   119,   120,   121,   122,   123,   124,   125,    -1,   127,
+     128,    51,    52,    -1,    -1,    55,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   145,   146,    69,
+      70,    71,    72,    73,    74,    75,    76,    77,    -1,    -1,
+      80,    81,    -1,    -1,    84,    85,    86,    87,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    98,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   116,   117,   118,   119,
+     120,   121,   122,   123,   124,   125,    -1,   127,   128,    51,
+      52,    -1,    -1,    55,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   145,   146,    69,    70,    71,
+      72,    73,    74,    75,    76,    77,    -1,    -1,    80,    81,
+      -1,    -1,    84,    85,    86,    87,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    98,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   116,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,    -1,   127,   128,    51,    52,    -1,
+      -1,    55,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   145,   146,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,    -1,    -1,    80,    81,    -1,    -1,
+      84,    85,    86,    87,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    98,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   116,   117,   118,   119,   120,   121,   122,   123,
+     124,   125,    -1,   127,   128,    51,    52,    -1,    -1,    55,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   145,   146,    69,    70,    71,    72,    73,    74,    75,
+      76,    77,    -1,    -1,    80,    81,    -1,    -1,    84,    85,
+      86,    87,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     116,   117,   118,   119,   120,   121,   122,   123,   124,   125,
+      -1,   127,   128,    51,    52,    -1,    -1,    55,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   145,
+     146,    69,    70,    71,    72,    73,    74,    75,    76,    77,
+      -1,    -1,    80,    81,    -1,    -1,    84,    85,    86,    87,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   116,   117,
+     118,   119,   120,   121,   122,   123,   124,   125,    -1,   127,
+     128,    51,    52,    -1,    -1,    55,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   145,   146,    69,
+      70,    71,    72,    73,    74,    75,    76,    77,    -1,    -1,
+      80,    81,    -1,    -1,    84,    85,    86,    87,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    98,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   116,   117,   118,   119,
+     120,   121,   122,   123,   124,   125,    -1,   127,   128,    51,
+      52,    -1,    -1,    55,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   145,   146,    69,    70,    71,
+      72,    73,    74,    75,    76,    77,    -1,    -1,    80,    81,
+      -1,    -1,    84,    85,    86,    87,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    98,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   116,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,    -1,   127,   128,    51,    52,    -1,
+      -1,    55,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   145,   146,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,    -1,    -1,    80,    81,    -1,    -1,
+      84,    85,    86,    87,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    98,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   116,   117,   118,   119,   120,   121,   122,   123,
+     124,   125,    -1,   127,   128,    51,    52,    -1,    -1,    55,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   145,   146,    69,    70,    71,    72,    73,    74,    75,
+      76,    77,    -1,    -1,    80,    81,    -1,    -1,    84,    85,
+      86,    87,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     116,   117,   118,   119,   120,   121,   122,   123,   124,   125,
+      -1,   127,   128,    51,    52,    -1,    -1,    55,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   145,
+     146,    69,    70,    71,    72,    73,    74,    75,    76,    77,
+      -1,    -1,    80,    81,    -1,    -1,    84,    85,    86,    87,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      98,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   116,   117,
+     118,   119,   120,   121,   122,   123,   124,   125,    -1,   127,
+     128,    51,    52,    -1,    -1,    55,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   145,   146,    69,
+      70,    71,    72,    73,    74,    75,    76,    77,    -1,    -1,
+      80,    81,    -1,    -1,    84,    85,    86,    87,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    98,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   116,   117,   118,   119,
+     120,   121,   122,   123,   124,   125,    -1,   127,   128,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   145
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
+{
+       0,   152,   153,     0,     1,     3,     4,     5,     6,     7,
+      11,    12,    16,    18,    19,    20,    21,    22,    23,    24,
+      30,    31,    32,    33,    34,    35,    36,    39,    45,    46,
+      47,    48,    49,    51,    52,    53,    54,    55,    56,    58,
+      59,    60,    63,    66,    67,    69,    70,    89,    92,    93,
+      95,    96,    98,   100,   101,   102,   103,   104,   105,   106,
+     109,   126,   127,   128,   154,   155,   156,   161,   163,   164,
+     166,   167,   170,   171,   173,   174,   175,   177,   178,   187,
+     200,   218,   237,   238,   248,   249,   253,   254,   255,   259,
+     260,   261,   263,   264,   265,   266,   267,   268,   291,   304,
+     156,    21,    22,    30,    31,    32,    39,    51,    55,    86,
+      89,    92,   126,   179,   180,   200,   218,   265,   268,   291,
+     180,     3,     4,     5,     6,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    45,    46,    47,    48,    49,
+      50,    51,    52,    55,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    80,    81,    84,    85,    86,    87,    98,
+     116,   117,   118,   119,   120,   121,   122,   123,   124,   125,
+     127,   128,   145,   146,   181,   185,   186,   267,   286,    33,
+      34,    35,    36,    48,    49,    51,    55,   101,   181,   182,
+     183,   261,   201,    89,   164,   165,   178,   218,   265,   266,
+     268,   165,   149,   150,   165,   295,   300,   301,   303,   205,
+     207,    89,   171,   178,   218,   223,   265,   268,    57,    98,
+      99,   127,   170,   187,   188,   193,   196,   198,   289,   290,
+     193,   193,   146,   194,   195,   146,   190,   194,   146,   296,
+     301,   182,   157,   140,   187,   218,   187,    55,     1,    92,
+     159,   160,   161,   172,   173,   304,   164,   203,   189,   198,
+     289,   304,   188,   288,   289,   304,    89,   144,   177,   218,
+     265,   268,   204,    53,    54,    56,    63,   105,   181,   262,
+      62,    64,    65,   111,   250,   251,    63,   250,    63,   250,
+      63,   250,    61,   250,    58,    59,   166,   187,   187,   295,
+     303,    40,    41,    42,    43,    44,    37,    38,    28,   235,
+     113,   144,    92,    98,   174,   113,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    86,
+      87,   114,   116,   117,   118,   119,   120,   121,   122,   123,
+     124,   125,    88,   142,   143,    88,   143,   294,    26,   140,
+     239,    90,    90,   190,   194,   239,   164,    51,    55,   179,
+      58,    59,     1,   117,   269,   300,    88,   142,   143,   214,
+     287,   215,   294,   105,   144,   158,   159,    55,    13,   219,
+     300,   113,    88,   142,   143,    90,    90,   219,   302,   295,
+      17,   242,   149,   165,   165,    55,    88,   142,   143,    25,
+     188,   188,   188,    91,   144,   197,   304,   144,   197,   193,
+     296,   297,   193,   192,   193,   198,   289,   304,   164,   297,
+     164,   162,   140,   159,    88,   143,    90,   161,   172,   147,
+     295,   303,   297,   202,   297,   148,   144,   299,   301,   144,
+     299,   141,   299,    55,   174,   175,   176,   144,    88,   142,
+     143,    51,    53,    54,    55,    56,    92,    98,    99,   120,
+     123,   146,   233,   272,   273,   274,   275,   276,   277,   280,
+     281,   282,   283,   284,    63,   251,   252,    62,   251,    63,
+      63,    63,    61,    71,    71,   156,   165,   165,   165,   165,
+     161,   164,   164,   236,    98,   166,   188,   198,   199,   172,
+     144,   177,   144,   163,   166,   178,   187,   188,   199,   187,
+     187,   187,   187,   187,   187,   187,   187,   187,   187,   187,
+     187,   187,   187,   187,   187,   187,   187,   187,   187,   187,
+     187,   187,   187,   187,   187,    51,    52,    55,   185,   190,
+     292,   293,   192,    51,    52,    55,   185,   190,   292,    51,
+      55,   292,   241,   240,   166,   187,   166,   187,    97,   168,
+     212,   300,   270,   211,    51,    55,   179,   292,   192,   292,
+     158,   164,   146,   271,   272,   216,   184,    10,     8,   244,
+     304,   159,    13,   187,    51,    55,   192,    51,    55,   159,
+     110,   250,   256,   257,   258,   304,   242,   198,    10,    27,
+     220,   300,   220,    51,    55,   192,    51,    55,   209,   188,
+      98,   188,   196,   289,   290,   297,   147,   297,   144,   144,
+     297,   182,   154,   141,   187,   297,   161,   297,   289,   174,
+     176,    51,    55,   192,    51,    55,   113,    51,    92,    98,
+     224,   225,   226,   274,   272,    29,   108,   234,   144,   285,
+     304,   144,   285,    51,   144,   285,    51,    63,   159,   187,
+     187,    79,   118,   228,   229,   304,   188,   144,   297,   176,
+     144,   113,    44,   296,    90,    90,   190,   194,   296,   298,
+      90,    90,   190,   191,   194,   304,   191,   194,   228,   228,
+      44,   169,   300,   165,   158,   298,    10,   297,   272,   158,
+     300,   181,   182,   188,   199,   245,   304,    15,   222,   304,
+      14,   221,   222,    90,    90,   298,    90,    90,   222,   110,
+     258,    10,   144,   219,   206,   208,   298,   165,   188,   197,
+     289,   141,   299,   298,   188,   226,   144,   274,   144,   297,
+     230,   296,   159,   159,   275,   280,   282,   284,   276,   277,
+     282,   276,   141,    51,   227,   230,   276,   278,   279,   282,
+     284,   159,    98,   188,   176,   187,   115,   166,   187,   166,
+     187,   168,   148,    90,   166,   187,   166,   187,   168,   239,
+     235,   159,   159,   187,   228,   213,   300,    10,   297,    10,
+     217,    91,   246,   304,   159,     9,   247,   304,   165,    10,
+      90,    10,   188,   159,   159,   159,   220,   144,   297,   225,
+     144,    98,   224,   147,   149,    10,   141,   144,   285,   144,
+     285,   144,   285,   144,   285,   285,   113,   230,   118,   144,
+     285,   144,   285,   144,   285,    10,   188,   187,   166,   187,
+      10,   141,   159,   158,   271,    89,   178,   218,   265,   268,
+     219,   159,   219,   222,   242,   243,    10,    10,   210,   144,
+     225,   144,   274,    51,   231,   232,   273,   276,   282,   276,
+     276,    89,   218,   118,   279,   282,   276,   278,   282,   276,
+     141,    10,   158,    55,    88,   142,   143,   159,   159,   159,
+     225,   144,   144,   296,   285,   144,   285,   285,   285,    55,
+      88,   144,   285,   144,   285,   285,   144,   285,   285,    10,
+      51,    55,   192,    51,    55,   244,   221,    10,   225,   232,
+     276,    51,    55,   276,   282,   276,   276,   298,   285,   285,
+     144,   285,   285,   285,   276,   285
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
+{
+       0,   151,   153,   152,   154,   155,   155,   155,   155,   156,
+     157,   156,   158,   159,   160,   160,   160,   160,   162,   161,
+     161,   161,   161,   161,   161,   161,   161,   161,   161,   161,
+     161,   161,   161,   161,   161,   161,   161,   161,   161,   161,
+     163,   163,   164,   164,   164,   164,   164,   164,   165,   166,
+     166,   167,   167,   169,   168,   170,   170,   170,   170,   170,
+     170,   170,   170,   170,   170,   170,   171,   171,   172,   172,
+     173,   173,   173,   173,   173,   173,   173,   173,   173,   173,
+     174,   174,   175,   175,   176,   176,   177,   177,   177,   177,
+     177,   177,   177,   177,   178,   178,   178,   178,   178,   178,
+     178,   178,   179,   179,   180,   180,   180,   181,   181,   181,
+     181,   181,   182,   182,   183,   184,   183,   185,   185,   185,
+     185,   185,   185,   185,   185,   185,   185,   185,   185,   185,
+     185,   185,   185,   185,   185,   185,   185,   185,   185,   185,
+     185,   185,   185,   185,   185,   185,   186,   186,   186,   186,
+     186,   186,   186,   186,   186,   186,   186,   186,   186,   186,
+     186,   186,   186,   186,   186,   186,   186,   186,   186,   186,
+     186,   186,   186,   186,   186,   186,   186,   186,   186,   186,
+     186,   186,   186,   186,   186,   186,   187,   187,   187,   187,
+     187,   187,   187,   187,   187,   187,   187,   187,   187,   187,
+     187,   187,   187,   187,   187,   187,   187,   187,   187,   187,
+     187,   187,   187,   187,   187,   187,   187,   187,   187,   187,
+     187,   187,   187,   187,   187,   187,   187,   187,   187,   187,
+     188,   189,   189,   189,   189,   190,   191,   191,   192,   192,
+     192,   192,   192,   193,   193,   193,   193,   193,   195,   194,
+     196,   197,   197,   198,   198,   198,   198,   199,   199,   199,
+     200,   200,   200,   200,   200,   200,   200,   200,   201,   200,
+     202,   200,   203,   200,   200,   200,   200,   200,   200,   200,
+     200,   200,   200,   200,   200,   200,   200,   200,   204,   200,
+     200,   200,   205,   206,   200,   207,   208,   200,   200,   200,
+     209,   210,   200,   211,   200,   212,   213,   200,   214,   200,
+     215,   200,   216,   217,   200,   200,   200,   200,   200,   218,
+     219,   219,   219,   220,   220,   221,   221,   222,   222,   223,
+     223,   224,   224,   225,   225,   226,   226,   226,   226,   226,
+     226,   226,   226,   226,   227,   227,   227,   227,   227,   227,
+     227,   227,   227,   227,   227,   227,   227,   227,   227,   228,
+     228,   229,   229,   229,   230,   230,   231,   231,   232,   232,
+     233,   233,   234,   234,   236,   235,   237,   237,   237,   237,
+     238,   238,   238,   238,   238,   238,   238,   238,   238,   240,
+     239,   241,   239,   242,   243,   243,   244,   244,   245,   245,
+     245,   246,   246,   247,   247,   248,   248,   248,   248,   249,
+     249,   249,   249,   250,   250,   251,   252,   251,   251,   253,
+     253,   254,   254,   255,   256,   256,   257,   257,   258,   258,
+     259,   259,   260,   260,   261,   262,   262,   262,   262,   262,
+     262,   263,   263,   264,   264,   264,   264,   265,   265,   265,
+     265,   265,   266,   267,   267,   267,   267,   267,   267,   267,
+     268,   268,   269,   270,   269,   269,   271,   271,   272,   272,
+     272,   272,   272,   272,   272,   272,   272,   272,   272,   272,
+     272,   272,   272,   273,   273,   273,   273,   274,   274,   275,
+     275,   276,   276,   277,   278,   279,   279,   280,   280,   281,
+     281,   282,   282,   283,   283,   284,   285,   285,   286,   287,
+     286,   288,   288,   289,   289,   290,   290,   291,   291,   291,
+     292,   292,   292,   292,   293,   293,   293,   294,   294,   295,
+     295,   296,   296,   297,   298,   299,   299,   299,   300,   300,
+     302,   301,   303,   303,   304
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     0,     2,     2,     1,     1,     3,     2,     1,
+       0,     5,     4,     2,     1,     1,     3,     2,     0,     4,
+       2,     3,     3,     3,     3,     3,     4,     1,     3,     3,
+       6,     5,     5,     5,     5,     3,     3,     3,     3,     1,
+       3,     3,     1,     3,     3,     3,     2,     1,     1,     1,
+       1,     1,     4,     0,     5,     2,     3,     4,     5,     4,
+       5,     2,     2,     2,     2,     2,     1,     3,     1,     3,
+       1,     2,     3,     5,     2,     4,     2,     4,     1,     3,
+       1,     3,     2,     3,     1,     2,     1,     4,     3,     3,
+       3,     3,     2,     1,     1,     4,     3,     3,     3,     3,
+       2,     1,     1,     1,     2,     1,     3,     1,     1,     1,
+       1,     1,     1,     1,     1,     0,     4,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     3,     5,     3,     5,
+       6,     5,     5,     5,     5,     4,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     4,     4,     2,     2,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     2,     2,     3,     3,     3,     3,     6,     1,
+       1,     1,     2,     4,     2,     3,     1,     1,     1,     1,
+       2,     4,     2,     1,     2,     2,     4,     1,     0,     2,
+       2,     2,     1,     1,     2,     3,     4,     3,     4,     2,
+       1,     1,     1,     1,     1,     1,     1,     1,     0,     4,
+       0,     4,     0,     3,     3,     3,     2,     3,     3,     1,
+       4,     3,     1,     4,     3,     2,     1,     2,     0,     4,
+       6,     6,     0,     0,     7,     0,     0,     7,     5,     4,
+       0,     0,     9,     0,     6,     0,     0,     8,     0,     5,
+       0,     6,     0,     0,     9,     1,     1,     1,     1,     1,
+       1,     1,     2,     1,     1,     1,     5,     1,     2,     1,
+       1,     1,     3,     1,     3,     1,     4,     6,     3,     5,
+       2,     4,     1,     3,     6,     8,     4,     6,     4,     2,
+       6,     2,     4,     6,     2,     4,     2,     4,     1,     1,
+       1,     3,     1,     4,     1,     4,     1,     3,     1,     1,
+       4,     1,     3,     3,     0,     5,     2,     4,     5,     5,
+       2,     4,     4,     3,     3,     3,     2,     1,     4,     0,
+       5,     0,     5,     5,     1,     1,     6,     1,     1,     1,
+       1,     2,     1,     2,     1,     1,     1,     1,     1,     1,
+       1,     2,     3,     1,     2,     1,     0,     4,     1,     2,
+       3,     2,     3,     1,     1,     1,     1,     2,     1,     2,
+       2,     3,     1,     4,     2,     1,     1,     1,     1,     1,
+       2,     2,     3,     1,     1,     2,     2,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     0,     4,     2,     3,     2,     6,     8,
+       4,     6,     4,     6,     2,     4,     6,     2,     4,     2,
+       4,     1,     0,     1,     1,     1,     1,     1,     1,     1,
+       3,     1,     3,     3,     3,     1,     3,     1,     3,     1,
+       1,     2,     1,     1,     1,     2,     2,     1,     1,     0,
+       4,     1,     2,     1,     3,     3,     2,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     0,
+       1,     0,     1,     2,     2,     0,     1,     1,     1,     1,
+       0,     3,     1,     2,     0
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (p, YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value, p); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, parser_state *p)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (p);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, parser_state *p)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep, p);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule, parser_state *p)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)], p);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule, p); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, parser_state *p)
+{
+  YY_USE (yyvaluep);
+  YY_USE (p);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (parser_state *p)
+{
+/* Lookahead token kind.  */
+int yychar;
+
+
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
+
+    /* Number of syntax errors so far.  */
+    int yynerrs = 0;
+
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex (&yylval, p);
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 2: /* $@1: %empty  */
+#line 1098 "src/parse.y"
+                   {
+		     p->lstate = EXPR_BEG;
+		     if (!p->locals) p->locals = cons(0,0);
+		   }
+#line 5180 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 3: /* program: $@1 top_compstmt  */
+#line 1103 "src/parse.y"
+                    {
+		      p->tree = new_scope(p, (yyvsp[0].nd));
+		    }
+#line 5188 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 4: /* top_compstmt: top_stmts opt_terms  */
+#line 1109 "src/parse.y"
+                    {
+		      (yyval.nd) = (yyvsp[-1].nd);
+		    }
+#line 5196 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 5: /* top_stmts: none  */
+#line 1115 "src/parse.y"
+                    {
+		      (yyval.nd) = new_begin(p, 0);
+		    }
+#line 5204 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 6: /* top_stmts: top_stmt  */
+#line 1119 "src/parse.y"
+                    {
+		      (yyval.nd) = new_begin(p, (yyvsp[0].nd));
+		    }
+#line 5212 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 7: /* top_stmts: top_stmts terms top_stmt  */
+#line 1123 "src/parse.y"
+                    {
+		      (yyval.nd) = push((yyvsp[-2].nd), newline_node((yyvsp[0].nd)));
+		    }
+#line 5220 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 8: /* top_stmts: error top_stmt  */
+#line 1127 "src/parse.y"
+                    {
+		      (yyval.nd) = new_begin(p, 0);
+		    }
+#line 5228 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 10: /* @2: %empty  */
+#line 1134 "src/parse.y"
+                    {
+		      (yyval.nd) = local_switch(p);
+		    }
+#line 5236 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 11: /* top_stmt: keyword_BEGIN @2 '{' top_compstmt '}'  */
+#line 1138 "src/parse.y"
+                    {
+		      yyerror(p, "BEGIN not supported");
+		      local_resume(p, (yyvsp[-3].nd));
+		      (yyval.nd) = 0;
+		    }
+#line 5246 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 12: /* bodystmt: compstmt opt_rescue opt_else opt_ensure  */
+#line 1149 "src/parse.y"
+                    {
+		      if ((yyvsp[-2].nd)) {
+			(yyval.nd) = new_rescue(p, (yyvsp[-3].nd), (yyvsp[-2].nd), (yyvsp[-1].nd));
+		      }
+		      else if ((yyvsp[-1].nd)) {
+			yywarn(p, "else without rescue is useless");
+			(yyval.nd) = push((yyvsp[-3].nd), (yyvsp[-1].nd));
+		      }
+		      else {
+			(yyval.nd) = (yyvsp[-3].nd);
+		      }
+		      if ((yyvsp[0].nd)) {
+			if ((yyval.nd)) {
+			  (yyval.nd) = new_ensure(p, (yyval.nd), (yyvsp[0].nd));
+			}
+			else {
+			  (yyval.nd) = push((yyvsp[0].nd), new_nil(p));
+			}
+		      }
+		    }
+#line 5271 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 13: /* compstmt: stmts opt_terms  */
+#line 1172 "src/parse.y"
+                    {
+		      (yyval.nd) = (yyvsp[-1].nd);
+		    }
+#line 5279 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 14: /* stmts: none  */
+#line 1178 "src/parse.y"
+                    {
+		      (yyval.nd) = new_begin(p, 0);
+		    }
+#line 5287 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 15: /* stmts: stmt  */
+#line 1182 "src/parse.y"
+                    {
+		      (yyval.nd) = new_begin(p, (yyvsp[0].nd));
+		    }
+#line 5295 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 16: /* stmts: stmts terms stmt  */
+#line 1186 "src/parse.y"
+                    {
+			(yyval.nd) = push((yyvsp[-2].nd), newline_node((yyvsp[0].nd)));
+		    }
+#line 5303 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 17: /* stmts: error stmt  */
+#line 1190 "src/parse.y"
+                    {
+		      (yyval.nd) = new_begin(p, (yyvsp[0].nd));
+		    }
+#line 5311 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 18: /* $@3: %empty  */
+#line 1195 "src/parse.y"
+                                     {p->lstate = EXPR_FNAME;}
+#line 5317 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 19: /* stmt: keyword_alias fsym $@3 fsym  */
+#line 1196 "src/parse.y"
+                    {
+		      (yyval.nd) = new_alias(p, (yyvsp[-2].id), (yyvsp[0].id));
+		    }
+#line 5325 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 20: /* stmt: keyword_undef undef_list  */
+#line 1200 "src/parse.y"
+                    {
+		      (yyval.nd) = (yyvsp[0].nd);
+		    }
+#line 5333 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 21: /* stmt: stmt modifier_if expr_value  */
+#line 1204 "src/parse.y"
+                    {
+			(yyval.nd) = new_if(p, cond((yyvsp[0].nd)), (yyvsp[-2].nd), 0);
+		    }
+#line 5341 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 22: /* stmt: stmt modifier_unless expr_value  */
+#line 1208 "src/parse.y"
+                    {
+		      (yyval.nd) = new_unless(p, cond((yyvsp[0].nd)), (yyvsp[-2].nd), 0);
+		    }
+#line 5349 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 23: /* stmt: stmt modifier_while expr_value  */
+#line 1212 "src/parse.y"
+                    {
+		      (yyval.nd) = new_while(p, cond((yyvsp[0].nd)), (yyvsp[-2].nd));
+		    }
+#line 5357 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 24: /* stmt: stmt modifier_until expr_value  */
+#line 1216 "src/parse.y"
+                    {
+		      (yyval.nd) = new_until(p, cond((yyvsp[0].nd)), (yyvsp[-2].nd));
+		    }
+#line 5365 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 25: /* stmt: stmt modifier_rescue stmt  */
+#line 1220 "src/parse.y"
+                    {
+		      (yyval.nd) = new_rescue(p, (yyvsp[-2].nd), list1(list3(0, 0, (yyvsp[0].nd))), 0);
+		    }
+#line 5373 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 26: /* stmt: keyword_END '{' compstmt '}'  */
+#line 1224 "src/parse.y"
+                    {
+		      yyerror(p, "END not suported");
+		      (yyval.nd) = new_postexe(p, (yyvsp[-1].nd));
+		    }
+#line 5382 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 28: /* stmt: mlhs '=' command_call  */
+#line 1230 "src/parse.y"
+                    {
+		      (yyval.nd) = new_masgn(p, (yyvsp[-2].nd), (yyvsp[0].nd));
+		    }
+#line 5390 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 29: /* stmt: var_lhs tOP_ASGN command_call  */
+#line 1234 "src/parse.y"
+                    {
+		      (yyval.nd) = new_op_asgn(p, (yyvsp[-2].nd), (yyvsp[-1].id), (yyvsp[0].nd));
+		    }
+#line 5398 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 30: /* stmt: primary_value '[' opt_call_args rbracket tOP_ASGN command_call  */
+#line 1238 "src/parse.y"
+                    {
+		      (yyval.nd) = new_op_asgn(p, new_call(p, (yyvsp[-5].nd), intern2("[]",2), (yyvsp[-3].nd)), (yyvsp[-1].id), (yyvsp[0].nd));
+		    }
+#line 5406 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 31: /* stmt: primary_value '.' tIDENTIFIER tOP_ASGN command_call  */
+#line 1242 "src/parse.y"
+                    {
+		      (yyval.nd) = new_op_asgn(p, new_call(p, (yyvsp[-4].nd), (yyvsp[-2].id), 0), (yyvsp[-1].id), (yyvsp[0].nd));
+		    }
+#line 5414 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 32: /* stmt: primary_value '.' tCONSTANT tOP_ASGN command_call  */
+#line 1246 "src/parse.y"
+                    {
+		      (yyval.nd) = new_op_asgn(p, new_call(p, (yyvsp[-4].nd), (yyvsp[-2].id), 0), (yyvsp[-1].id), (yyvsp[0].nd));
+		    }
+#line 5422 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 33: /* stmt: primary_value tCOLON2 tCONSTANT tOP_ASGN command_call  */
+#line 1250 "src/parse.y"
+                    {
+		      yyerror(p, "constant re-assignment");
+		      (yyval.nd) = 0;
+		    }
+#line 5431 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 34: /* stmt: primary_value tCOLON2 tIDENTIFIER tOP_ASGN command_call  */
+#line 1255 "src/parse.y"
+                    {
+		      (yyval.nd) = new_op_asgn(p, new_call(p, (yyvsp[-4].nd), (yyvsp[-2].id), 0), (yyvsp[-1].id), (yyvsp[0].nd));
+		    }
+#line 5439 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 35: /* stmt: backref tOP_ASGN command_call  */
+#line 1259 "src/parse.y"
+                    {
+		      backref_error(p, (yyvsp[-2].nd));
+		      (yyval.nd) = new_begin(p, 0);
+		    }
+#line 5448 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 36: /* stmt: lhs '=' mrhs  */
+#line 1264 "src/parse.y"
+                    {
+		      (yyval.nd) = new_asgn(p, (yyvsp[-2].nd), new_array(p, (yyvsp[0].nd)));
+		    }
+#line 5456 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 37: /* stmt: mlhs '=' arg_value  */
+#line 1268 "src/parse.y"
+                    {
+		      (yyval.nd) = new_masgn(p, (yyvsp[-2].nd), (yyvsp[0].nd));
+		    }
+#line 5464 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 38: /* stmt: mlhs '=' mrhs  */
+#line 1272 "src/parse.y"
+                    {
+		      (yyval.nd) = new_masgn(p, (yyvsp[-2].nd), new_array(p, (yyvsp[0].nd)));
+		    }
+#line 5472 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 40: /* command_asgn: lhs '=' command_call  */
+#line 1279 "src/parse.y"
+                    {
+		      (yyval.nd) = new_asgn(p, (yyvsp[-2].nd), (yyvsp[0].nd));
+		    }
+#line 5480 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 41: /* command_asgn: lhs '=' command_asgn  */
+#line 1283 "src/parse.y"
+                    {
+		      (yyval.nd) = new_asgn(p, (yyvsp[-2].nd), (yyvsp[0].nd));
+		    }
+#line 5488 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 43: /* expr: expr keyword_and expr  */
+#line 1291 "src/parse.y"
+                    {
+		      (yyval.nd) = new_and(p, (yyvsp[-2].nd), (yyvsp[0].nd));
+		    }
+#line 5496 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 44: /* expr: expr keyword_or expr  */
+#line 1295 "src/parse.y"
+                    {
+		      (yyval.nd) = new_or(p, (yyvsp[-2].nd), (yyvsp[0].nd));
+		    }
+#line 5504 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 45: /* expr: keyword_not opt_nl expr  */
+#line 1299 "src/parse.y"
+                    {
+		      (yyval.nd) = call_uni_op(p, cond((yyvsp[0].nd)), "!");
+		    }
+#line 5512 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 46: /* expr: '!' command_call  */
+#line 1303 "src/parse.y"
+                    {
+		      (yyval.nd) = call_uni_op(p, cond((yyvsp[0].nd)), "!");
+		    }
+#line 5520 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 48: /* expr_value: expr  */
+#line 1310 "src/parse.y"
+                    {
+		      if (!(yyvsp[0].nd)) (yyval.nd) = new_nil(p);
+		      else (yyval.nd) = (yyvsp[0].nd);
+		    }
+#line 5529 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 53: /* $@4: %empty  */
+#line 1325 "src/parse.y"
+                    {
+		      local_nest(p);
+		    }
+#line 5537 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 54: /* cmd_brace_block: tLBRACE_ARG $@4 opt_block_param compstmt '}'  */
+#line 1331 "src/parse.y"
+                    {
+		      (yyval.nd) = new_block(p, (yyvsp[-2].nd), (yyvsp[-1].nd));
+		      local_unnest(p);
+		    }
+#line 5546 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 55: /* command: operation command_args  */
+#line 1338 "src/parse.y"
+                    {
+		      (yyval.nd) = new_fcall(p, (yyvsp[-1].id), (yyvsp[0].nd));
+		    }
+#line 5554 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 56: /* command: operation command_args cmd_brace_block  */
+#line 1342 "src/parse.y"
+                    {
+		      args_with_block(p, (yyvsp[-1].nd), (yyvsp[0].nd));
+		      (yyval.nd) = new_fcall(p, (yyvsp[-2].id), (yyvsp[-1].nd));
+		    }
+#line 5563 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 57: /* command: primary_value '.' operation2 command_args  */
+#line 1347 "src/parse.y"
+                    {
+		      (yyval.nd) = new_call(p, (yyvsp[-3].nd), (yyvsp[-1].id), (yyvsp[0].nd));
+		    }
+#line 5571 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 58: /* command: primary_value '.' operation2 command_args cmd_brace_block  */
+#line 1351 "src/parse.y"
+                    {
+		      args_with_block(p, (yyvsp[-1].nd), (yyvsp[0].nd));
+		      (yyval.nd) = new_call(p, (yyvsp[-4].nd), (yyvsp[-2].id), (yyvsp[-1].nd));
+		   }
+#line 5580 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 59: /* command: primary_value tCOLON2 operation2 command_args  */
+#line 1356 "src/parse.y"
+                    {
+		      (yyval.nd) = new_call(p, (yyvsp[-3].nd), (yyvsp[-1].id), (yyvsp[0].nd));
+		    }
+#line 5588 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 60: /* command: primary_value tCOLON2 operation2 command_args cmd_brace_block  */
+#line 1360 "src/parse.y"
+                    {
+		      args_with_block(p, (yyvsp[-1].nd), (yyvsp[0].nd));
+		      (yyval.nd) = new_call(p, (yyvsp[-4].nd), (yyvsp[-2].id), (yyvsp[-1].nd));
+		    }
+#line 5597 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 61: /* command: keyword_super command_args  */
+#line 1365 "src/parse.y"
+                    {
+		      (yyval.nd) = new_super(p, (yyvsp[0].nd));
+		    }
+#line 5605 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 62: /* command: keyword_yield command_args  */
+#line 1369 "src/parse.y"
+                    {
+		      (yyval.nd) = new_yield(p, (yyvsp[0].nd));
+		    }
+#line 5613 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 63: /* command: keyword_return call_args  */
+#line 1373 "src/parse.y"
+                    {
+		      (yyval.nd) = new_return(p, ret_args(p, (yyvsp[0].nd)));
+		    }
+#line 5621 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 64: /* command: keyword_break call_args  */
+#line 1377 "src/parse.y"
+                    {
+		      (yyval.nd) = new_break(p, ret_args(p, (yyvsp[0].nd)));
+		    }
+#line 5629 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 65: /* command: keyword_next call_args  */
+#line 1381 "src/parse.y"
+                    {
+		      (yyval.nd) = new_next(p, ret_args(p, (yyvsp[0].nd)));
+		    }
+#line 5637 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 66: /* mlhs: mlhs_basic  */
+#line 1387 "src/parse.y"
+                    {
+		      (yyval.nd) = (yyvsp[0].nd);
+		    }
+#line 5645 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 67: /* mlhs: tLPAREN mlhs_inner rparen  */
+#line 1391 "src/parse.y"
+                    {
+		      (yyval.nd) = (yyvsp[-1].nd);
+		    }
+#line 5653 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 69: /* mlhs_inner: tLPAREN mlhs_inner rparen  */
+#line 1398 "src/parse.y"
+                    {
+		      (yyval.nd) = list1((yyvsp[-1].nd));
+		    }
+#line 5661 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 70: /* mlhs_basic: mlhs_list  */
+#line 1404 "src/parse.y"
+                    {
+		      (yyval.nd) = list1((yyvsp[0].nd));
+		    }
+#line 5669 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 71: /* mlhs_basic: mlhs_list mlhs_item  */
+#line 1408 "src/parse.y"
+                    {
+		      (yyval.nd) = list1(push((yyvsp[-1].nd),(yyvsp[0].nd)));
+		    }
+#line 5677 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 72: /* mlhs_basic: mlhs_list tSTAR mlhs_node  */
+#line 1412 "src/parse.y"
+                    {
+		      (yyval.nd) = list2((yyvsp[-2].nd), (yyvsp[0].nd));
+		    }
+#line 5685 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 73: /* mlhs_basic: mlhs_list tSTAR mlhs_node ',' mlhs_post  */
+#line 1416 "src/parse.y"
+                    {
+		      (yyval.nd) = list3((yyvsp[-4].nd), (yyvsp[-2].nd), (yyvsp[0].nd));
+		    }
+#line 5693 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 74: /* mlhs_basic: mlhs_list tSTAR  */
+#line 1420 "src/parse.y"
+                    {
+		      (yyval.nd) = list2((yyvsp[-1].nd), new_nil(p));
+		    }
+#line 5701 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 75: /* mlhs_basic: mlhs_list tSTAR ',' mlhs_post  */
+#line 1424 "src/parse.y"
+                    {
+		      (yyval.nd) = list3((yyvsp[-3].nd), new_nil(p), (yyvsp[0].nd));
+		    }
+#line 5709 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 76: /* mlhs_basic: tSTAR mlhs_node  */
+#line 1428 "src/parse.y"
+                    {
+		      (yyval.nd) = list2(0, (yyvsp[0].nd));
+		    }
+#line 5717 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 77: /* mlhs_basic: tSTAR mlhs_node ',' mlhs_post  */
+#line 1432 "src/parse.y"
+                    {
+		      (yyval.nd) = list3(0, (yyvsp[-2].nd), (yyvsp[0].nd));
+		    }
+#line 5725 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 78: /* mlhs_basic: tSTAR  */
+#line 1436 "src/parse.y"
+                    {
+		      (yyval.nd) = list2(0, new_nil(p));
+		    }
+#line 5733 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 79: /* mlhs_basic: tSTAR ',' mlhs_post  */
+#line 1440 "src/parse.y"
+                    {
+		      (yyval.nd) = list3(0, new_nil(p), (yyvsp[0].nd));
+		    }
+#line 5741 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 81: /* mlhs_item: tLPAREN mlhs_inner rparen  */
+#line 1447 "src/parse.y"
+                    {
+		      (yyval.nd) = (yyvsp[-1].nd);
+		    }
+#line 5749 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 82: /* mlhs_list: mlhs_item ','  */
+#line 1453 "src/parse.y"
+                    {
+		      (yyval.nd) = list1((yyvsp[-1].nd));
+		    }
+#line 5757 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 83: /* mlhs_list: mlhs_list mlhs_item ','  */
+#line 1457 "src/parse.y"
+                    {
+		      (yyval.nd) = push((yyvsp[-2].nd), (yyvsp[-1].nd));
+		    }
+#line 5765 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 84: /* mlhs_post: mlhs_item  */
+#line 1463 "src/parse.y"
+                    {
+		      (yyval.nd) = list1((yyvsp[0].nd));
+		    }
+#line 5773 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 85: /* mlhs_post: mlhs_list mlhs_item  */
+#line 1467 "src/parse.y"
+                    {
+		      (yyval.nd) = push((yyvsp[-1].nd), (yyvsp[0].nd));
+		    }
+#line 5781 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 86: /* mlhs_node: variable  */
+#line 1473 "src/parse.y"
+                    {
+		      assignable(p, (yyvsp[0].nd));
+		    }
+#line 5789 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 87: /* mlhs_node: primary_value '[' opt_call_args rbracket  */
+#line 1477 "src/parse.y"
+                    {
+		      (yyval.nd) = new_call(p, (yyvsp[-3].nd), intern2("[]",2), (yyvsp[-1].nd));
+		    }
+#line 5797 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 88: /* mlhs_node: primary_value '.' tIDENTIFIER  */
+#line 1481 "src/parse.y"
+                    {
+		      (yyval.nd) = new_call(p, (yyvsp[-2].nd), (yyvsp[0].id), 0);
+		    }
+#line 5805 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 89: /* mlhs_node: primary_value tCOLON2 tIDENTIFIER  */
+#line 1485 "src/parse.y"
+                    {
+		      (yyval.nd) = new_call(p, (yyvsp[-2].nd), (yyvsp[0].id), 0);
+		    }
+#line 5813 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 90: /* mlhs_node: primary_value '.' tCONSTANT  */
+#line 1489 "src/parse.y"
+                    {
+		      (yyval.nd) = new_call(p, (yyvsp[-2].nd), (yyvsp[0].id), 0);
+		    }
+#line 5821 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 91: /* mlhs_node: primary_value tCOLON2 tCONSTANT  */
+#line 1493 "src/parse.y"
+                    {
+		      if (p->in_def || p->in_single)
+			yyerror(p, "dynamic constant assignment");
+		      (yyval.nd) = new_colon2(p, (yyvsp[-2].nd), (yyvsp[0].id));
+		    }
+#line 5831 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 92: /* mlhs_node: tCOLON3 tCONSTANT  */
+#line 1499 "src/parse.y"
+                    {
+		      if (p->in_def || p->in_single)
+			yyerror(p, "dynamic constant assignment");
+		      (yyval.nd) = new_colon3(p, (yyvsp[0].id));
+		    }
+#line 5841 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 93: /* mlhs_node: backref  */
+#line 1505 "src/parse.y"
+                    {
+		      backref_error(p, (yyvsp[0].nd));
+		      (yyval.nd) = 0;
+		    }
+#line 5850 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 94: /* lhs: variable  */
+#line 1512 "src/parse.y"
+                    {
+		      assignable(p, (yyvsp[0].nd));
+		    }
+#line 5858 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 95: /* lhs: primary_value '[' opt_call_args rbracket  */
+#line 1516 "src/parse.y"
+                    {
+		      (yyval.nd) = new_call(p, (yyvsp[-3].nd), intern2("[]",2), (yyvsp[-1].nd));
+		    }
+#line 5866 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 96: /* lhs: primary_value '.' tIDENTIFIER  */
+#line 1520 "src/parse.y"
+                    {
+		      (yyval.nd) = new_call(p, (yyvsp[-2].nd), (yyvsp[0].id), 0);
+		    }
+#line 5874 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 97: /* lhs: primary_value tCOLON2 tIDENTIFIER  */
+#line 1524 "src/parse.y"
+                    {
+		      (yyval.nd) = new_call(p, (yyvsp[-2].nd), (yyvsp[0].id), 0);
+		    }
+#line 5882 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 98: /* lhs: primary_value '.' tCONSTANT  */
+#line 1528 "src/parse.y"
+                    {
+		      (yyval.nd) = new_call(p, (yyvsp[-2].nd), (yyvsp[0].id), 0);
+		    }
+#line 5890 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 99: /* lhs: primary_value tCOLON2 tCONSTANT  */
+#line 1532 "src/parse.y"
+                    {
+		      if (p->in_def || p->in_single)
+			yyerror(p, "dynamic constant assignment");
+		      (yyval.nd) = new_colon2(p, (yyvsp[-2].nd), (yyvsp[0].id));
+		    }
+#line 5900 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 100: /* lhs: tCOLON3 tCONSTANT  */
+#line 1538 "src/parse.y"
+                    {
+		      if (p->in_def || p->in_single)
+			yyerror(p, "dynamic constant assignment");
+		      (yyval.nd) = new_colon3(p, (yyvsp[0].id));
+		    }
+#line 5910 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 101: /* lhs: backref  */
+#line 1544 "src/parse.y"
+                    {
+		      backref_error(p, (yyvsp[0].nd));
+		      (yyval.nd) = 0;
+		    }
+#line 5919 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 102: /* cname: tIDENTIFIER  */
+#line 1551 "src/parse.y"
+                    {
+		      yyerror(p, "class/module name must be CONSTANT");
+		    }
+#line 5927 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 104: /* cpath: tCOLON3 cname  */
+#line 1558 "src/parse.y"
+                    {
+		      (yyval.nd) = cons((node*)1, nsym((yyvsp[0].id)));
+		    }
+#line 5935 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 105: /* cpath: cname  */
+#line 1562 "src/parse.y"
+                    {
+		      (yyval.nd) = cons((node*)0, nsym((yyvsp[0].id)));
+		    }
+#line 5943 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 106: /* cpath: primary_value tCOLON2 cname  */
+#line 1566 "src/parse.y"
+                    {
+		      (yyval.nd) = cons((yyvsp[-2].nd), nsym((yyvsp[0].id)));
+		    }
+#line 5951 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 110: /* fname: op  */
+#line 1575 "src/parse.y"
+                    {
+		      p->lstate = EXPR_ENDFN;
+		      (yyval.id) = (yyvsp[0].id);
+		    }
+#line 5960 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 111: /* fname: reswords  */
+#line 1580 "src/parse.y"
+                    {
+		      p->lstate = EXPR_ENDFN;
+		      (yyval.id) = (yyvsp[0].id);
+		    }
+#line 5969 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 114: /* undef_list: fsym  */
+#line 1591 "src/parse.y"
+                    {
+		      (yyval.nd) = new_undef(p, (yyvsp[0].id));
+		    }
+#line 5977 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 115: /* $@5: %empty  */
+#line 1594 "src/parse.y"
+                                 {p->lstate = EXPR_FNAME;}
+#line 5983 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 116: /* undef_list: undef_list ',' $@5 fsym  */
+#line 1595 "src/parse.y"
+                    {
+		      (yyval.nd) = push((yyvsp[-3].nd), nsym((yyvsp[0].id)));
+		    }
+#line 5991 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 117: /* op: '|'  */
+#line 1600 "src/parse.y"
+                                { (yyval.id) = intern_c('|'); }
+#line 5997 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 118: /* op: '^'  */
+#line 1601 "src/parse.y"
+                                { (yyval.id) = intern_c('^'); }
+#line 6003 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 119: /* op: '&'  */
+#line 1602 "src/parse.y"
+                                { (yyval.id) = intern_c('&'); }
+#line 6009 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 120: /* op: tCMP  */
+#line 1603 "src/parse.y"
+                                { (yyval.id) = intern2("<=>",3); }
+#line 6015 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 121: /* op: tEQ  */
+#line 1604 "src/parse.y"
+                                { (yyval.id) = intern2("==",2); }
+#line 6021 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 122: /* op: tEQQ  */
+#line 1605 "src/parse.y"
+                                { (yyval.id) = intern2("===",3); }
+#line 6027 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 123: /* op: tMATCH  */
+#line 1606 "src/parse.y"
+                                { (yyval.id) = intern2("=~",2); }
+#line 6033 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 124: /* op: tNMATCH  */
+#line 1607 "src/parse.y"
+                                { (yyval.id) = intern2("!~",2); }
+#line 6039 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 125: /* op: '>'  */
+#line 1608 "src/parse.y"
+                                { (yyval.id) = intern_c('>'); }
+#line 6045 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 126: /* op: tGEQ  */
+#line 1609 "src/parse.y"
+                                { (yyval.id) = intern2(">=",2); }
+#line 6051 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 127: /* op: '<'  */
+#line 1610 "src/parse.y"
+                                { (yyval.id) = intern_c('<'); }
+#line 6057 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 128: /* op: tLEQ  */
+#line 1611 "src/parse.y"
+                                { (yyval.id) = intern2("<=",2); }
+#line 6063 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 129: /* op: tNEQ  */
+#line 1612 "src/parse.y"
+                                { (yyval.id) = intern2("!=",2); }
+#line 6069 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 130: /* op: tLSHFT  */
+#line 1613 "src/parse.y"
+                                { (yyval.id) = intern2("<<",2); }
+#line 6075 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 131: /* op: tRSHFT  */
+#line 1614 "src/parse.y"
+                                { (yyval.id) = intern2(">>",2); }
+#line 6081 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 132: /* op: '+'  */
+#line 1615 "src/parse.y"
+                                { (yyval.id) = intern_c('+'); }
+#line 6087 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 133: /* op: '-'  */
+#line 1616 "src/parse.y"
+                                { (yyval.id) = intern_c('-'); }
+#line 6093 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 134: /* op: '*'  */
+#line 1617 "src/parse.y"
+                                { (yyval.id) = intern_c('*'); }
+#line 6099 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 135: /* op: tSTAR  */
+#line 1618 "src/parse.y"
+                                { (yyval.id) = intern_c('*'); }
+#line 6105 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 136: /* op: '/'  */
+#line 1619 "src/parse.y"
+                                { (yyval.id) = intern_c('/'); }
+#line 6111 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 137: /* op: '%'  */
+#line 1620 "src/parse.y"
+                                { (yyval.id) = intern_c('%'); }
+#line 6117 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 138: /* op: tPOW  */
+#line 1621 "src/parse.y"
+                                { (yyval.id) = intern2("**",2); }
+#line 6123 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 139: /* op: '!'  */
+#line 1622 "src/parse.y"
+                                { (yyval.id) = intern_c('!'); }
+#line 6129 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 140: /* op: '~'  */
+#line 1623 "src/parse.y"
+                                { (yyval.id) = intern_c('~'); }
+#line 6135 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 141: /* op: tUPLUS  */
+#line 1624 "src/parse.y"
+                                { (yyval.id) = intern2("+@",2); }
+#line 6141 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 142: /* op: tUMINUS  */
+#line 1625 "src/parse.y"
+                                { (yyval.id) = intern2("-@",2); }
+#line 6147 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 143: /* op: tAREF  */
+#line 1626 "src/parse.y"
+                                { (yyval.id) = intern2("[]",2); }
+#line 6153 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 144: /* op: tASET  */
+#line 1627 "src/parse.y"
+                                { (yyval.id) = intern2("[]=",3); }
+#line 6159 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 145: /* op: '`'  */
+#line 1628 "src/parse.y"
+                                { (yyval.id) = intern_c('`'); }
+#line 6165 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 186: /* arg: lhs '=' arg  */
+#line 1646 "src/parse.y"
+                    {
+		      (yyval.nd) = new_asgn(p, (yyvsp[-2].nd), (yyvsp[0].nd));
+		    }
+#line 6173 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 187: /* arg: lhs '=' arg modifier_rescue arg  */
+#line 1650 "src/parse.y"
+                    {
+		      (yyval.nd) = new_asgn(p, (yyvsp[-4].nd), new_rescue(p, (yyvsp[-2].nd), list1(list3(0, 0, (yyvsp[0].nd))), 0));
+		    }
+#line 6181 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 188: /* arg: var_lhs tOP_ASGN arg  */
+#line 1654 "src/parse.y"
+                    {
+		      (yyval.nd) = new_op_asgn(p, (yyvsp[-2].nd), (yyvsp[-1].id), (yyvsp[0].nd));
+		    }
+#line 6189 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 189: /* arg: var_lhs tOP_ASGN arg modifier_rescue arg  */
+#line 1658 "src/parse.y"
+                    {
+		      (yyval.nd) = new_op_asgn(p, (yyvsp[-4].nd), (yyvsp[-3].id), new_rescue(p, (yyvsp[-2].nd), list1(list3(0, 0, (yyvsp[0].nd))), 0));
+		    }
+#line 6197 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 190: /* arg: primary_value '[' opt_call_args rbracket tOP_ASGN arg  */
+#line 1662 "src/parse.y"
+                    {
+		      (yyval.nd) = new_op_asgn(p, new_call(p, (yyvsp[-5].nd), intern2("[]",2), (yyvsp[-3].nd)), (yyvsp[-1].id), (yyvsp[0].nd));
+		    }
+#line 6205 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 191: /* arg: primary_value '.' tIDENTIFIER tOP_ASGN arg  */
+#line 1666 "src/parse.y"
+                    {
+		      (yyval.nd) = new_op_asgn(p, new_call(p, (yyvsp[-4].nd), (yyvsp[-2].id), 0), (yyvsp[-1].id), (yyvsp[0].nd));
+		    }
+#line 6213 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 192: /* arg: primary_value '.' tCONSTANT tOP_ASGN arg  */
+#line 1670 "src/parse.y"
+                    {
+		      (yyval.nd) = new_op_asgn(p, new_call(p, (yyvsp[-4].nd), (yyvsp[-2].id), 0), (yyvsp[-1].id), (yyvsp[0].nd));
+		    }
+#line 6221 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 193: /* arg: primary_value tCOLON2 tIDENTIFIER tOP_ASGN arg  */
+#line 1674 "src/parse.y"
+                    {
+		      (yyval.nd) = new_op_asgn(p, new_call(p, (yyvsp[-4].nd), (yyvsp[-2].id), 0), (yyvsp[-1].id), (yyvsp[0].nd));
+		    }
+#line 6229 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 194: /* arg: primary_value tCOLON2 tCONSTANT tOP_ASGN arg  */
+#line 1678 "src/parse.y"
+                    {
+		      yyerror(p, "constant re-assignment");
+		      (yyval.nd) = new_begin(p, 0);
+		    }
+#line 6238 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 195: /* arg: tCOLON3 tCONSTANT tOP_ASGN arg  */
+#line 1683 "src/parse.y"
+                    {
+		      yyerror(p, "constant re-assignment");
+		      (yyval.nd) = new_begin(p, 0);
+		    }
+#line 6247 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 196: /* arg: backref tOP_ASGN arg  */
+#line 1688 "src/parse.y"
+                    {
+		      backref_error(p, (yyvsp[-2].nd));
+		      (yyval.nd) = new_begin(p, 0);
+		    }
+#line 6256 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 197: /* arg: arg tDOT2 arg  */
+#line 1693 "src/parse.y"
+                    {
+		      (yyval.nd) = new_dot2(p, (yyvsp[-2].nd), (yyvsp[0].nd));
+		    }
+#line 6264 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 198: /* arg: arg tDOT3 arg  */
+#line 1697 "src/parse.y"
+                    {
+		      (yyval.nd) = new_dot3(p, (yyvsp[-2].nd), (yyvsp[0].nd));
+		    }
+#line 6272 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 199: /* arg: arg '+' arg  */
+#line 1701 "src/parse.y"
+                    {
+		      (yyval.nd) = call_bin_op(p, (yyvsp[-2].nd), "+", (yyvsp[0].nd));
+		    }
+#line 6280 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 200: /* arg: arg '-' arg  */
+#line 1705 "src/parse.y"
+                    {
+		      (yyval.nd) = call_bin_op(p, (yyvsp[-2].nd), "-", (yyvsp[0].nd));
+		    }
+#line 6288 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 201: /* arg: arg '*' arg  */
+#line 1709 "src/parse.y"
+                    {
+		      (yyval.nd) = call_bin_op(p, (yyvsp[-2].nd), "*", (yyvsp[0].nd));
+		    }
+#line 6296 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 202: /* arg: arg '/' arg  */
+#line 1713 "src/parse.y"
+                    {
+		      (yyval.nd) = call_bin_op(p, (yyvsp[-2].nd), "/", (yyvsp[0].nd));
+		    }
+#line 6304 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 203: /* arg: arg '%' arg  */
+#line 1717 "src/parse.y"
+                    {
+		      (yyval.nd) = call_bin_op(p, (yyvsp[-2].nd), "%", (yyvsp[0].nd));
+		    }
+#line 6312 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 204: /* arg: arg tPOW arg  */
+#line 1721 "src/parse.y"
+                    {
+		      (yyval.nd) = call_bin_op(p, (yyvsp[-2].nd), "**", (yyvsp[0].nd));
+		    }
+#line 6320 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 205: /* arg: tUMINUS_NUM tINTEGER tPOW arg  */
+#line 1725 "src/parse.y"
+                    {
+		      (yyval.nd) = call_uni_op(p, call_bin_op(p, (yyvsp[-2].nd), "**", (yyvsp[0].nd)), "-@");
+		    }
+#line 6328 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 206: /* arg: tUMINUS_NUM tFLOAT tPOW arg  */
+#line 1729 "src/parse.y"
+                    {
+		      (yyval.nd) = call_uni_op(p, call_bin_op(p, (yyvsp[-2].nd), "**", (yyvsp[0].nd)), "-@");
+		    }
+#line 6336 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 207: /* arg: tUPLUS arg  */
+#line 1733 "src/parse.y"
+                    {
+		      (yyval.nd) = call_uni_op(p, (yyvsp[0].nd), "+@");
+		    }
+#line 6344 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 208: /* arg: tUMINUS arg  */
+#line 1737 "src/parse.y"
+                    {
+		      (yyval.nd) = call_uni_op(p, (yyvsp[0].nd), "-@");
+		    }
+#line 6352 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 209: /* arg: arg '|' arg  */
+#line 1741 "src/parse.y"
+                    {
+		      (yyval.nd) = call_bin_op(p, (yyvsp[-2].nd), "|", (yyvsp[0].nd));
+		    }
+#line 6360 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 210: /* arg: arg '^' arg  */
+#line 1745 "src/parse.y"
+                    {
+		      (yyval.nd) = call_bin_op(p, (yyvsp[-2].nd), "^", (yyvsp[0].nd));
+		    }
+#line 6368 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 211: /* arg: arg '&' arg  */
+#line 1749 "src/parse.y"
+                    {
+		      (yyval.nd) = call_bin_op(p, (yyvsp[-2].nd), "&", (yyvsp[0].nd));
+		    }
+#line 6376 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 212: /* arg: arg tCMP arg  */
+#line 1753 "src/parse.y"
+                    {
+		      (yyval.nd) = call_bin_op(p, (yyvsp[-2].nd), "<=>", (yyvsp[0].nd));
+		    }
+#line 6384 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 213: /* arg: arg '>' arg  */
+#line 1757 "src/parse.y"
+                    {
+		      (yyval.nd) = call_bin_op(p, (yyvsp[-2].nd), ">", (yyvsp[0].nd));
+		    }
+#line 6392 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 214: /* arg: arg tGEQ arg  */
+#line 1761 "src/parse.y"
+                    {
+		      (yyval.nd) = call_bin_op(p, (yyvsp[-2].nd), ">=", (yyvsp[0].nd));
+		    }
+#line 6400 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 215: /* arg: arg '<' arg  */
+#line 1765 "src/parse.y"
+                    {
+		      (yyval.nd) = call_bin_op(p, (yyvsp[-2].nd), "<", (yyvsp[0].nd));
+		    }
+#line 6408 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 216: /* arg: arg tLEQ arg  */
+#line 1769 "src/parse.y"
+                    {
+		      (yyval.nd) = call_bin_op(p, (yyvsp[-2].nd), "<=", (yyvsp[0].nd));
+		    }
+#line 6416 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 217: /* arg: arg tEQ arg  */
+#line 1773 "src/parse.y"
+                    {
+		      (yyval.nd) = call_bin_op(p, (yyvsp[-2].nd), "==", (yyvsp[0].nd));
+		    }
+#line 6424 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 218: /* arg: arg tEQQ arg  */
+#line 1777 "src/parse.y"
+                    {
+		      (yyval.nd) = call_bin_op(p, (yyvsp[-2].nd), "===", (yyvsp[0].nd));
+		    }
+#line 6432 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 219: /* arg: arg tNEQ arg  */
+#line 1781 "src/parse.y"
+                    {
+		      (yyval.nd) = call_bin_op(p, (yyvsp[-2].nd), "!=", (yyvsp[0].nd));
+		    }
+#line 6440 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 220: /* arg: arg tMATCH arg  */
+#line 1785 "src/parse.y"
+                    {
+		      (yyval.nd) = call_bin_op(p, (yyvsp[-2].nd), "=~", (yyvsp[0].nd));
+		    }
+#line 6448 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 221: /* arg: arg tNMATCH arg  */
+#line 1789 "src/parse.y"
+                    {
+		      (yyval.nd) = call_bin_op(p, (yyvsp[-2].nd), "!~", (yyvsp[0].nd));
+		    }
+#line 6456 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 222: /* arg: '!' arg  */
+#line 1793 "src/parse.y"
+                    {
+		      (yyval.nd) = call_uni_op(p, cond((yyvsp[0].nd)), "!");
+		    }
+#line 6464 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 223: /* arg: '~' arg  */
+#line 1797 "src/parse.y"
+                    {
+		      (yyval.nd) = call_uni_op(p, cond((yyvsp[0].nd)), "~");
+		    }
+#line 6472 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 224: /* arg: arg tLSHFT arg  */
+#line 1801 "src/parse.y"
+                    {
+		      (yyval.nd) = call_bin_op(p, (yyvsp[-2].nd), "<<", (yyvsp[0].nd));
+		    }
+#line 6480 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 225: /* arg: arg tRSHFT arg  */
+#line 1805 "src/parse.y"
+                    {
+		      (yyval.nd) = call_bin_op(p, (yyvsp[-2].nd), ">>", (yyvsp[0].nd));
+		    }
+#line 6488 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 226: /* arg: arg tANDOP arg  */
+#line 1809 "src/parse.y"
+                    {
+		      (yyval.nd) = new_and(p, (yyvsp[-2].nd), (yyvsp[0].nd));
+		    }
+#line 6496 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 227: /* arg: arg tOROP arg  */
+#line 1813 "src/parse.y"
+                    {
+		      (yyval.nd) = new_or(p, (yyvsp[-2].nd), (yyvsp[0].nd));
+		    }
+#line 6504 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 228: /* arg: arg '?' arg opt_nl ':' arg  */
+#line 1817 "src/parse.y"
+                    {
+		      (yyval.nd) = new_if(p, cond((yyvsp[-5].nd)), (yyvsp[-3].nd), (yyvsp[0].nd));
+		    }
+#line 6512 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 229: /* arg: primary  */
+#line 1821 "src/parse.y"
+                    {
+		      (yyval.nd) = (yyvsp[0].nd);
+		    }
+#line 6520 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 230: /* arg_value: arg  */
+#line 1827 "src/parse.y"
+                    {
+		      (yyval.nd) = (yyvsp[0].nd);
+		      if (!(yyval.nd)) (yyval.nd) = new_nil(p);
+		    }
+#line 6529 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 232: /* aref_args: args trailer  */
+#line 1835 "src/parse.y"
+                    {
+		      (yyval.nd) = (yyvsp[-1].nd);
+		    }
+#line 6537 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 233: /* aref_args: args ',' assocs trailer  */
+#line 1839 "src/parse.y"
+                    {
+		      (yyval.nd) = push((yyvsp[-3].nd), new_hash(p, (yyvsp[-1].nd)));
+		    }
+#line 6545 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 234: /* aref_args: assocs trailer  */
+#line 1843 "src/parse.y"
+                    {
+		      (yyval.nd) = cons(new_hash(p, (yyvsp[-1].nd)), 0);
+		    }
+#line 6553 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 235: /* paren_args: '(' opt_call_args rparen  */
+#line 1849 "src/parse.y"
+                    {
+		      (yyval.nd) = (yyvsp[-1].nd);
+		    }
+#line 6561 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 240: /* opt_call_args: args ','  */
+#line 1861 "src/parse.y"
+                    {
+		      (yyval.nd) = cons((yyvsp[-1].nd),0);
+		    }
+#line 6569 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 241: /* opt_call_args: args ',' assocs ','  */
+#line 1865 "src/parse.y"
+                    {
+		      (yyval.nd) = cons(push((yyvsp[-3].nd), new_hash(p, (yyvsp[-1].nd))), 0);
+		    }
+#line 6577 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 242: /* opt_call_args: assocs ','  */
+#line 1869 "src/parse.y"
+                    {
+		      (yyval.nd) = cons(list1(new_hash(p, (yyvsp[-1].nd))), 0);
+		    }
+#line 6585 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 243: /* call_args: command  */
+#line 1875 "src/parse.y"
+                    {
+		      (yyval.nd) = cons(list1((yyvsp[0].nd)), 0);
+		    }
+#line 6593 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 244: /* call_args: args opt_block_arg  */
+#line 1879 "src/parse.y"
+                    {
+		      (yyval.nd) = cons((yyvsp[-1].nd), (yyvsp[0].nd));
+		    }
+#line 6601 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 245: /* call_args: assocs opt_block_arg  */
+#line 1883 "src/parse.y"
+                    {
+		      (yyval.nd) = cons(list1(new_hash(p, (yyvsp[-1].nd))), (yyvsp[0].nd));
+		    }
+#line 6609 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 246: /* call_args: args ',' assocs opt_block_arg  */
+#line 1887 "src/parse.y"
+                    {
+		      (yyval.nd) = cons(push((yyvsp[-3].nd), new_hash(p, (yyvsp[-1].nd))), (yyvsp[0].nd));
+		    }
+#line 6617 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 247: /* call_args: block_arg  */
+#line 1891 "src/parse.y"
+                    {
+		      (yyval.nd) = cons(0, (yyvsp[0].nd));
+		    }
+#line 6625 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 248: /* @6: %empty  */
+#line 1896 "src/parse.y"
+                   {
+		      (yyval.stack) = p->cmdarg_stack;
+		      CMDARG_PUSH(1);
+		    }
+#line 6634 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 249: /* command_args: @6 call_args  */
+#line 1901 "src/parse.y"
+                    {
+		      p->cmdarg_stack = (yyvsp[-1].stack);
+		      (yyval.nd) = (yyvsp[0].nd);
+		    }
+#line 6643 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 250: /* block_arg: tAMPER arg_value  */
+#line 1908 "src/parse.y"
+                    {
+		      (yyval.nd) = new_block_arg(p, (yyvsp[0].nd));
+		    }
+#line 6651 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 251: /* opt_block_arg: ',' block_arg  */
+#line 1914 "src/parse.y"
+                    {
+		      (yyval.nd) = (yyvsp[0].nd);
+		    }
+#line 6659 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 252: /* opt_block_arg: none  */
+#line 1918 "src/parse.y"
+                    {
+		      (yyval.nd) = 0;
+		    }
+#line 6667 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 253: /* args: arg_value  */
+#line 1924 "src/parse.y"
+                    {
+		      (yyval.nd) = cons((yyvsp[0].nd), 0);
+		    }
+#line 6675 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 254: /* args: tSTAR arg_value  */
+#line 1928 "src/parse.y"
+                    {
+		      (yyval.nd) = cons(new_splat(p, (yyvsp[0].nd)), 0);
+		    }
+#line 6683 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 255: /* args: args ',' arg_value  */
+#line 1932 "src/parse.y"
+                    {
+		      (yyval.nd) = push((yyvsp[-2].nd), (yyvsp[0].nd));
+		    }
+#line 6691 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 256: /* args: args ',' tSTAR arg_value  */
+#line 1936 "src/parse.y"
+                    {
+		      (yyval.nd) = push((yyvsp[-3].nd), new_splat(p, (yyvsp[0].nd)));
+		    }
+#line 6699 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 257: /* mrhs: args ',' arg_value  */
+#line 1942 "src/parse.y"
+                    {
+		      (yyval.nd) = push((yyvsp[-2].nd), (yyvsp[0].nd));
+		    }
+#line 6707 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 258: /* mrhs: args ',' tSTAR arg_value  */
+#line 1946 "src/parse.y"
+                    {
+		      (yyval.nd) = push((yyvsp[-3].nd), new_splat(p, (yyvsp[0].nd)));
+		    }
+#line 6715 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 259: /* mrhs: tSTAR arg_value  */
+#line 1950 "src/parse.y"
+                    {
+		      (yyval.nd) = list1(new_splat(p, (yyvsp[0].nd)));
+		    }
+#line 6723 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 267: /* primary: tFID  */
+#line 1963 "src/parse.y"
+                    {
+		      (yyval.nd) = new_fcall(p, (yyvsp[0].id), 0);
+		    }
+#line 6731 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 268: /* $@7: %empty  */
+#line 1967 "src/parse.y"
+                    {
+		      (yyvsp[0].stack) = p->cmdarg_stack;
+		      p->cmdarg_stack = 0;
+		    }
+#line 6740 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 269: /* primary: keyword_begin $@7 bodystmt keyword_end  */
+#line 1973 "src/parse.y"
+                    {
+		      p->cmdarg_stack = (yyvsp[-3].stack);
+		      (yyval.nd) = (yyvsp[-1].nd);
+		    }
+#line 6749 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 270: /* $@8: %empty  */
+#line 1977 "src/parse.y"
+                                   {p->lstate = EXPR_ENDARG;}
+#line 6755 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 271: /* primary: tLPAREN_ARG expr $@8 rparen  */
+#line 1978 "src/parse.y"
+                    {
+		      (yyval.nd) = (yyvsp[-2].nd);
+		    }
+#line 6763 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 272: /* $@9: %empty  */
+#line 1981 "src/parse.y"
+                              {p->lstate = EXPR_ENDARG;}
+#line 6769 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 273: /* primary: tLPAREN_ARG $@9 rparen  */
+#line 1982 "src/parse.y"
+                    {
+		      (yyval.nd) = 0;
+		    }
+#line 6777 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 274: /* primary: tLPAREN compstmt ')'  */
+#line 1986 "src/parse.y"
+                    {
+		      (yyval.nd) = (yyvsp[-1].nd);
+		    }
+#line 6785 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 275: /* primary: primary_value tCOLON2 tCONSTANT  */
+#line 1990 "src/parse.y"
+                    {
+		      (yyval.nd) = new_colon2(p, (yyvsp[-2].nd), (yyvsp[0].id));
+		    }
+#line 6793 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 276: /* primary: tCOLON3 tCONSTANT  */
+#line 1994 "src/parse.y"
+                    {
+		      (yyval.nd) = new_colon3(p, (yyvsp[0].id));
+		    }
+#line 6801 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 277: /* primary: tLBRACK aref_args ']'  */
+#line 1998 "src/parse.y"
+                    {
+		      (yyval.nd) = new_array(p, (yyvsp[-1].nd));
+		    }
+#line 6809 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 278: /* primary: tLBRACE assoc_list '}'  */
+#line 2002 "src/parse.y"
+                    {
+		      (yyval.nd) = new_hash(p, (yyvsp[-1].nd));
+		    }
+#line 6817 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 279: /* primary: keyword_return  */
+#line 2006 "src/parse.y"
+                    {
+		      (yyval.nd) = new_return(p, 0);
+		    }
+#line 6825 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 280: /* primary: keyword_yield '(' call_args rparen  */
+#line 2010 "src/parse.y"
+                    {
+		      (yyval.nd) = new_yield(p, (yyvsp[-1].nd));
+		    }
+#line 6833 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 281: /* primary: keyword_yield '(' rparen  */
+#line 2014 "src/parse.y"
+                    {
+		      (yyval.nd) = new_yield(p, 0);
+		    }
+#line 6841 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 282: /* primary: keyword_yield  */
+#line 2018 "src/parse.y"
+                    {
+		      (yyval.nd) = new_yield(p, 0);
+		    }
+#line 6849 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 283: /* primary: keyword_not '(' expr rparen  */
+#line 2022 "src/parse.y"
+                    {
+		      (yyval.nd) = call_uni_op(p, cond((yyvsp[-1].nd)), "!");
+		    }
+#line 6857 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 284: /* primary: keyword_not '(' rparen  */
+#line 2026 "src/parse.y"
+                    {
+		      (yyval.nd) = call_uni_op(p, new_nil(p), "!");
+		    }
+#line 6865 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 285: /* primary: operation brace_block  */
+#line 2030 "src/parse.y"
+                    {
+		      (yyval.nd) = new_fcall(p, (yyvsp[-1].id), cons(0, (yyvsp[0].nd)));
+		    }
+#line 6873 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 287: /* primary: method_call brace_block  */
+#line 2035 "src/parse.y"
+                    {
+		      call_with_block(p, (yyvsp[-1].nd), (yyvsp[0].nd));
+		      (yyval.nd) = (yyvsp[-1].nd);
+		    }
+#line 6882 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 288: /* @10: %empty  */
+#line 2040 "src/parse.y"
+                    {
+		      local_nest(p);
+		      (yyval.num) = p->lpar_beg;
+		      p->lpar_beg = ++p->paren_nest;
+		    }
+#line 6892 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 289: /* primary: tLAMBDA @10 f_larglist lambda_body  */
+#line 2047 "src/parse.y"
+                    {
+		      p->lpar_beg = (yyvsp[-2].num);
+		      (yyval.nd) = new_lambda(p, (yyvsp[-1].nd), (yyvsp[0].nd));
+		      local_unnest(p);
+		    }
+#line 6902 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 290: /* primary: keyword_if expr_value then compstmt if_tail keyword_end  */
+#line 2056 "src/parse.y"
+                    {
+		      (yyval.nd) = new_if(p, cond((yyvsp[-4].nd)), (yyvsp[-2].nd), (yyvsp[-1].nd));
+		    }
+#line 6910 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 291: /* primary: keyword_unless expr_value then compstmt opt_else keyword_end  */
+#line 2063 "src/parse.y"
+                    {
+		      (yyval.nd) = new_unless(p, cond((yyvsp[-4].nd)), (yyvsp[-2].nd), (yyvsp[-1].nd));
+		    }
+#line 6918 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 292: /* $@11: %empty  */
+#line 2066 "src/parse.y"
+                                {COND_PUSH(1);}
+#line 6924 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 293: /* $@12: %empty  */
+#line 2066 "src/parse.y"
+                                                              {COND_POP();}
+#line 6930 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 294: /* primary: keyword_while $@11 expr_value do $@12 compstmt keyword_end  */
+#line 2069 "src/parse.y"
+                    {
+		      (yyval.nd) = new_while(p, cond((yyvsp[-4].nd)), (yyvsp[-1].nd));
+		    }
+#line 6938 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 295: /* $@13: %empty  */
+#line 2072 "src/parse.y"
+                                {COND_PUSH(1);}
+#line 6944 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 296: /* $@14: %empty  */
+#line 2072 "src/parse.y"
+                                                              {COND_POP();}
+#line 6950 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 297: /* primary: keyword_until $@13 expr_value do $@14 compstmt keyword_end  */
+#line 2075 "src/parse.y"
+                    {
+		      (yyval.nd) = new_until(p, cond((yyvsp[-4].nd)), (yyvsp[-1].nd));
+		    }
+#line 6958 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 298: /* primary: keyword_case expr_value opt_terms case_body keyword_end  */
+#line 2081 "src/parse.y"
+                    {
+		      (yyval.nd) = new_case(p, (yyvsp[-3].nd), (yyvsp[-1].nd));
+		    }
+#line 6966 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 299: /* primary: keyword_case opt_terms case_body keyword_end  */
+#line 2085 "src/parse.y"
+                    {
+		      (yyval.nd) = new_case(p, 0, (yyvsp[-1].nd));
+		    }
+#line 6974 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 300: /* $@15: %empty  */
+#line 2089 "src/parse.y"
+                  {COND_PUSH(1);}
+#line 6980 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 301: /* $@16: %empty  */
+#line 2091 "src/parse.y"
+                  {COND_POP();}
+#line 6986 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 302: /* primary: keyword_for for_var keyword_in $@15 expr_value do $@16 compstmt keyword_end  */
+#line 2094 "src/parse.y"
+                    {
+		      (yyval.nd) = new_for(p, (yyvsp[-7].nd), (yyvsp[-4].nd), (yyvsp[-1].nd));
+		    }
+#line 6994 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 303: /* @17: %empty  */
+#line 2098 "src/parse.y"
+                    {
+		      if (p->in_def || p->in_single)
+			yyerror(p, "class definition in method body");
+		      (yyval.nd) = local_switch(p);
+		    }
+#line 7004 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 304: /* primary: keyword_class cpath superclass @17 bodystmt keyword_end  */
+#line 2105 "src/parse.y"
+                    {
+		      (yyval.nd) = new_class(p, (yyvsp[-4].nd), (yyvsp[-3].nd), (yyvsp[-1].nd));
+		      local_resume(p, (yyvsp[-2].nd));
+		    }
+#line 7013 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 305: /* @18: %empty  */
+#line 2110 "src/parse.y"
+                    {
+		      (yyval.num) = p->in_def;
+		      p->in_def = 0;
+		    }
+#line 7022 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 306: /* @19: %empty  */
+#line 2115 "src/parse.y"
+                    {
+		      (yyval.nd) = cons(local_switch(p), (node*)(intptr_t)p->in_single);
+		      p->in_single = 0;
+		    }
+#line 7031 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 307: /* primary: keyword_class tLSHFT expr @18 term @19 bodystmt keyword_end  */
+#line 2121 "src/parse.y"
+                    {
+		      (yyval.nd) = new_sclass(p, (yyvsp[-5].nd), (yyvsp[-1].nd));
+		      local_resume(p, (yyvsp[-2].nd)->car);
+		      p->in_def = (yyvsp[-4].num);
+		      p->in_single = (int)(intptr_t)(yyvsp[-2].nd)->cdr;
+		    }
+#line 7042 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 308: /* @20: %empty  */
+#line 2128 "src/parse.y"
+                    {
+		      if (p->in_def || p->in_single)
+			yyerror(p, "module definition in method body");
+		      (yyval.nd) = local_switch(p);
+		    }
+#line 7052 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 309: /* primary: keyword_module cpath @20 bodystmt keyword_end  */
+#line 2135 "src/parse.y"
+                    {
+		      (yyval.nd) = new_module(p, (yyvsp[-3].nd), (yyvsp[-1].nd));
+		      local_resume(p, (yyvsp[-2].nd));
+		    }
+#line 7061 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 310: /* @21: %empty  */
+#line 2140 "src/parse.y"
+                    {
+		      p->in_def++;
+		      (yyval.nd) = local_switch(p);
+		    }
+#line 7070 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 311: /* primary: keyword_def fname @21 f_arglist bodystmt keyword_end  */
+#line 2147 "src/parse.y"
+                    {
+		      (yyval.nd) = new_def(p, (yyvsp[-4].id), (yyvsp[-2].nd), (yyvsp[-1].nd));
+		      local_resume(p, (yyvsp[-3].nd));
+		      p->in_def--;
+		    }
+#line 7080 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 312: /* $@22: %empty  */
+#line 2152 "src/parse.y"
+                                                     {p->lstate = EXPR_FNAME;}
+#line 7086 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 313: /* @23: %empty  */
+#line 2153 "src/parse.y"
+                    {
+		      p->in_single++;
+		      p->lstate = EXPR_ENDFN; /* force for args */
+		      (yyval.nd) = local_switch(p);
+		    }
+#line 7096 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 314: /* primary: keyword_def singleton dot_or_colon $@22 fname @23 f_arglist bodystmt keyword_end  */
+#line 2161 "src/parse.y"
+                    {
+		      (yyval.nd) = new_sdef(p, (yyvsp[-7].nd), (yyvsp[-4].id), (yyvsp[-2].nd), (yyvsp[-1].nd));
+		      local_resume(p, (yyvsp[-3].nd));
+		      p->in_single--;
+		    }
+#line 7106 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 315: /* primary: keyword_break  */
+#line 2167 "src/parse.y"
+                    {
+		      (yyval.nd) = new_break(p, 0);
+		    }
+#line 7114 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 316: /* primary: keyword_next  */
+#line 2171 "src/parse.y"
+                    {
+		      (yyval.nd) = new_next(p, 0);
+		    }
+#line 7122 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 317: /* primary: keyword_redo  */
+#line 2175 "src/parse.y"
+                    {
+		      (yyval.nd) = new_redo(p);
+		    }
+#line 7130 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 318: /* primary: keyword_retry  */
+#line 2179 "src/parse.y"
+                    {
+		      (yyval.nd) = new_retry(p);
+		    }
+#line 7138 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 319: /* primary_value: primary  */
+#line 2185 "src/parse.y"
+                    {
+		      (yyval.nd) = (yyvsp[0].nd);
+		      if (!(yyval.nd)) (yyval.nd) = new_nil(p);
+		    }
+#line 7147 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 326: /* if_tail: keyword_elsif expr_value then compstmt if_tail  */
+#line 2204 "src/parse.y"
+                    {
+		      (yyval.nd) = new_if(p, cond((yyvsp[-3].nd)), (yyvsp[-1].nd), (yyvsp[0].nd));
+		    }
+#line 7155 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 328: /* opt_else: keyword_else compstmt  */
+#line 2211 "src/parse.y"
+                    {
+		      (yyval.nd) = (yyvsp[0].nd);
+		    }
+#line 7163 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 329: /* for_var: lhs  */
+#line 2217 "src/parse.y"
+                    {
+		      (yyval.nd) = list1(list1((yyvsp[0].nd)));
+		    }
+#line 7171 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 331: /* f_marg: f_norm_arg  */
+#line 2224 "src/parse.y"
+                    {
+		      (yyval.nd) = new_arg(p, (yyvsp[0].id));
+		    }
+#line 7179 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 332: /* f_marg: tLPAREN f_margs rparen  */
+#line 2228 "src/parse.y"
+                    {
+		      (yyval.nd) = new_masgn(p, (yyvsp[-1].nd), 0);
+		    }
+#line 7187 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 333: /* f_marg_list: f_marg  */
+#line 2234 "src/parse.y"
+                    {
+		      (yyval.nd) = list1((yyvsp[0].nd));
+		    }
+#line 7195 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 334: /* f_marg_list: f_marg_list ',' f_marg  */
+#line 2238 "src/parse.y"
+                    {
+		      (yyval.nd) = push((yyvsp[-2].nd), (yyvsp[0].nd));
+		    }
+#line 7203 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 335: /* f_margs: f_marg_list  */
+#line 2244 "src/parse.y"
+                    {
+		      (yyval.nd) = list3((yyvsp[0].nd),0,0);
+		    }
+#line 7211 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 336: /* f_margs: f_marg_list ',' tSTAR f_norm_arg  */
+#line 2248 "src/parse.y"
+                    {
+		      (yyval.nd) = list3((yyvsp[-3].nd), new_arg(p, (yyvsp[0].id)), 0);
+		    }
+#line 7219 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 337: /* f_margs: f_marg_list ',' tSTAR f_norm_arg ',' f_marg_list  */
+#line 2252 "src/parse.y"
+                    {
+		      (yyval.nd) = list3((yyvsp[-5].nd), new_arg(p, (yyvsp[-2].id)), (yyvsp[0].nd));
+		    }
+#line 7227 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 338: /* f_margs: f_marg_list ',' tSTAR  */
+#line 2256 "src/parse.y"
+                    {
+		      (yyval.nd) = list3((yyvsp[-2].nd), (node*)-1, 0);
+		    }
+#line 7235 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 339: /* f_margs: f_marg_list ',' tSTAR ',' f_marg_list  */
+#line 2260 "src/parse.y"
+                    {
+		      (yyval.nd) = list3((yyvsp[-4].nd), (node*)-1, (yyvsp[0].nd));
+		    }
+#line 7243 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 340: /* f_margs: tSTAR f_norm_arg  */
+#line 2264 "src/parse.y"
+                    {
+		      (yyval.nd) = list3(0, new_arg(p, (yyvsp[0].id)), 0);
+		    }
+#line 7251 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 341: /* f_margs: tSTAR f_norm_arg ',' f_marg_list  */
+#line 2268 "src/parse.y"
+                    {
+		      (yyval.nd) = list3(0, new_arg(p, (yyvsp[-2].id)), (yyvsp[0].nd));
+		    }
+#line 7259 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 342: /* f_margs: tSTAR  */
+#line 2272 "src/parse.y"
+                    {
+		      (yyval.nd) = list3(0, (node*)-1, 0);
+		    }
+#line 7267 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 343: /* f_margs: tSTAR ',' f_marg_list  */
+#line 2276 "src/parse.y"
+                    {
+		      (yyval.nd) = list3(0, (node*)-1, (yyvsp[0].nd));
+		    }
+#line 7275 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 344: /* block_param: f_arg ',' f_block_optarg ',' f_rest_arg opt_f_block_arg  */
+#line 2282 "src/parse.y"
+                    {
+		      (yyval.nd) = new_args(p, (yyvsp[-5].nd), (yyvsp[-3].nd), (yyvsp[-1].id), 0, (yyvsp[0].id));
+		    }
+#line 7283 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 345: /* block_param: f_arg ',' f_block_optarg ',' f_rest_arg ',' f_arg opt_f_block_arg  */
+#line 2286 "src/parse.y"
+                    {
+		      (yyval.nd) = new_args(p, (yyvsp[-7].nd), (yyvsp[-5].nd), (yyvsp[-3].id), (yyvsp[-1].nd), (yyvsp[0].id));
+		    }
+#line 7291 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 346: /* block_param: f_arg ',' f_block_optarg opt_f_block_arg  */
+#line 2290 "src/parse.y"
+                    {
+		      (yyval.nd) = new_args(p, (yyvsp[-3].nd), (yyvsp[-1].nd), 0, 0, (yyvsp[0].id));
+		    }
+#line 7299 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 347: /* block_param: f_arg ',' f_block_optarg ',' f_arg opt_f_block_arg  */
+#line 2294 "src/parse.y"
+                    {
+		      (yyval.nd) = new_args(p, (yyvsp[-5].nd), (yyvsp[-3].nd), 0, (yyvsp[-1].nd), (yyvsp[0].id));
+		    }
+#line 7307 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 348: /* block_param: f_arg ',' f_rest_arg opt_f_block_arg  */
+#line 2298 "src/parse.y"
+                    {
+		      (yyval.nd) = new_args(p, (yyvsp[-3].nd), 0, (yyvsp[-1].id), 0, (yyvsp[0].id));
+		    }
+#line 7315 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 349: /* block_param: f_arg ','  */
+#line 2302 "src/parse.y"
+                    {
+		      (yyval.nd) = new_args(p, (yyvsp[-1].nd), 0, 1, 0, 0);
+		    }
+#line 7323 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 350: /* block_param: f_arg ',' f_rest_arg ',' f_arg opt_f_block_arg  */
+#line 2306 "src/parse.y"
+                    {
+		      (yyval.nd) = new_args(p, (yyvsp[-5].nd), 0, (yyvsp[-3].id), (yyvsp[-1].nd), (yyvsp[0].id));
+		    }
+#line 7331 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 351: /* block_param: f_arg opt_f_block_arg  */
+#line 2310 "src/parse.y"
+                    {
+		      (yyval.nd) = new_args(p, (yyvsp[-1].nd), 0, 0, 0, (yyvsp[0].id));
+		    }
+#line 7339 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 352: /* block_param: f_block_optarg ',' f_rest_arg opt_f_block_arg  */
+#line 2314 "src/parse.y"
+                    {
+		      (yyval.nd) = new_args(p, 0, (yyvsp[-3].nd), (yyvsp[-1].id), 0, (yyvsp[0].id));
+		    }
+#line 7347 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 353: /* block_param: f_block_optarg ',' f_rest_arg ',' f_arg opt_f_block_arg  */
+#line 2318 "src/parse.y"
+                    {
+		      (yyval.nd) = new_args(p, 0, (yyvsp[-5].nd), (yyvsp[-3].id), (yyvsp[-1].nd), (yyvsp[0].id));
+		    }
+#line 7355 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 354: /* block_param: f_block_optarg opt_f_block_arg  */
+#line 2322 "src/parse.y"
+                    {
+		      (yyval.nd) = new_args(p, 0, (yyvsp[-1].nd), 0, 0, (yyvsp[0].id));
+		    }
+#line 7363 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 355: /* block_param: f_block_optarg ',' f_arg opt_f_block_arg  */
+#line 2326 "src/parse.y"
+                    {
+		      (yyval.nd) = new_args(p, 0, (yyvsp[-3].nd), 0, (yyvsp[-1].nd), (yyvsp[0].id));
+		    }
+#line 7371 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 356: /* block_param: f_rest_arg opt_f_block_arg  */
+#line 2330 "src/parse.y"
+                    {
+		      (yyval.nd) = new_args(p, 0, 0, (yyvsp[-1].id), 0, (yyvsp[0].id));
+		    }
+#line 7379 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 357: /* block_param: f_rest_arg ',' f_arg opt_f_block_arg  */
+#line 2334 "src/parse.y"
+                    {
+		      (yyval.nd) = new_args(p, 0, 0, (yyvsp[-3].id), (yyvsp[-1].nd), (yyvsp[0].id));
+		    }
+#line 7387 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 358: /* block_param: f_block_arg  */
+#line 2338 "src/parse.y"
+                    {
+		      (yyval.nd) = new_args(p, 0, 0, 0, 0, (yyvsp[0].id));
+		    }
+#line 7395 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 360: /* opt_block_param: block_param_def  */
+#line 2345 "src/parse.y"
+                    {
+		      p->cmd_start = TRUE;
+		      (yyval.nd) = (yyvsp[0].nd);
+		    }
+#line 7404 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 361: /* block_param_def: '|' opt_bv_decl '|'  */
+#line 2352 "src/parse.y"
+                    {
+		      local_add_f(p, 0);
+		      (yyval.nd) = 0;
+		    }
+#line 7413 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 362: /* block_param_def: tOROP  */
+#line 2357 "src/parse.y"
+                    {
+		      local_add_f(p, 0);
+		      (yyval.nd) = 0;
+		    }
+#line 7422 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 363: /* block_param_def: '|' block_param opt_bv_decl '|'  */
+#line 2362 "src/parse.y"
+                    {
+		      (yyval.nd) = (yyvsp[-2].nd);
+		    }
+#line 7430 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 364: /* opt_bv_decl: opt_nl  */
+#line 2369 "src/parse.y"
+                    {
+		      (yyval.nd) = 0;
+		    }
+#line 7438 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 365: /* opt_bv_decl: opt_nl ';' bv_decls opt_nl  */
+#line 2373 "src/parse.y"
+                    {
+		      (yyval.nd) = 0;
+		    }
+#line 7446 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 368: /* bvar: tIDENTIFIER  */
+#line 2383 "src/parse.y"
+                    {
+		      local_add_f(p, (yyvsp[0].id));
+		      new_bv(p, (yyvsp[0].id));
+		    }
+#line 7455 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 370: /* f_larglist: '(' f_args opt_bv_decl ')'  */
+#line 2391 "src/parse.y"
+                    {
+		      (yyval.nd) = (yyvsp[-2].nd);
+		    }
+#line 7463 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 371: /* f_larglist: f_args  */
+#line 2395 "src/parse.y"
+                    {
+		      (yyval.nd) = (yyvsp[0].nd);
+		    }
+#line 7471 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 372: /* lambda_body: tLAMBEG compstmt '}'  */
+#line 2401 "src/parse.y"
+                    {
+		      (yyval.nd) = (yyvsp[-1].nd);
+		    }
+#line 7479 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 373: /* lambda_body: keyword_do_LAMBDA compstmt keyword_end  */
+#line 2405 "src/parse.y"
+                    {
+		      (yyval.nd) = (yyvsp[-1].nd);
+		    }
+#line 7487 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 374: /* $@24: %empty  */
+#line 2411 "src/parse.y"
+                    {
+		      local_nest(p);
+		    }
+#line 7495 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 375: /* do_block: keyword_do_block $@24 opt_block_param compstmt keyword_end  */
+#line 2417 "src/parse.y"
+                    {
+		      (yyval.nd) = new_block(p,(yyvsp[-2].nd),(yyvsp[-1].nd));
+		      local_unnest(p);
+		    }
+#line 7504 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 376: /* block_call: command do_block  */
+#line 2424 "src/parse.y"
+                    {
+		      if ((yyvsp[-1].nd)->car == (node*)NODE_YIELD) {
+			yyerror(p, "block given to yield");
+		      }
+		      else {
+			call_with_block(p, (yyvsp[-1].nd), (yyvsp[0].nd));
+		      }
+		      (yyval.nd) = (yyvsp[-1].nd);
+		    }
+#line 7518 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 377: /* block_call: block_call dot_or_colon operation2 opt_paren_args  */
+#line 2434 "src/parse.y"
+                    {
+		      (yyval.nd) = new_call(p, (yyvsp[-3].nd), (yyvsp[-1].id), (yyvsp[0].nd));
+		    }
+#line 7526 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 378: /* block_call: block_call dot_or_colon operation2 opt_paren_args brace_block  */
+#line 2438 "src/parse.y"
+                    {
+		      (yyval.nd) = new_call(p, (yyvsp[-4].nd), (yyvsp[-2].id), (yyvsp[-1].nd));
+		      call_with_block(p, (yyval.nd), (yyvsp[0].nd));
+		    }
+#line 7535 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 379: /* block_call: block_call dot_or_colon operation2 command_args do_block  */
+#line 2443 "src/parse.y"
+                    {
+		      (yyval.nd) = new_call(p, (yyvsp[-4].nd), (yyvsp[-2].id), (yyvsp[-1].nd));
+		      call_with_block(p, (yyval.nd), (yyvsp[0].nd));
+		    }
+#line 7544 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 380: /* method_call: operation paren_args  */
+#line 2450 "src/parse.y"
+                    {
+		      (yyval.nd) = new_fcall(p, (yyvsp[-1].id), (yyvsp[0].nd));
+		    }
+#line 7552 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 381: /* method_call: primary_value '.' operation2 opt_paren_args  */
+#line 2454 "src/parse.y"
+                    {
+		      (yyval.nd) = new_call(p, (yyvsp[-3].nd), (yyvsp[-1].id), (yyvsp[0].nd));
+		    }
+#line 7560 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 382: /* method_call: primary_value tCOLON2 operation2 paren_args  */
+#line 2458 "src/parse.y"
+                    {
+		      (yyval.nd) = new_call(p, (yyvsp[-3].nd), (yyvsp[-1].id), (yyvsp[0].nd));
+		    }
+#line 7568 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 383: /* method_call: primary_value tCOLON2 operation3  */
+#line 2462 "src/parse.y"
+                    {
+		      (yyval.nd) = new_call(p, (yyvsp[-2].nd), (yyvsp[0].id), 0);
+		    }
+#line 7576 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 384: /* method_call: primary_value '.' paren_args  */
+#line 2466 "src/parse.y"
+                    {
+		      (yyval.nd) = new_call(p, (yyvsp[-2].nd), intern2("call",4), (yyvsp[0].nd));
+		    }
+#line 7584 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 385: /* method_call: primary_value tCOLON2 paren_args  */
+#line 2470 "src/parse.y"
+                    {
+		      (yyval.nd) = new_call(p, (yyvsp[-2].nd), intern2("call",4), (yyvsp[0].nd));
+		    }
+#line 7592 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 386: /* method_call: keyword_super paren_args  */
+#line 2474 "src/parse.y"
+                    {
+		      (yyval.nd) = new_super(p, (yyvsp[0].nd));
+		    }
+#line 7600 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 387: /* method_call: keyword_super  */
+#line 2478 "src/parse.y"
+                    {
+		      (yyval.nd) = new_zsuper(p);
+		    }
+#line 7608 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 388: /* method_call: primary_value '[' opt_call_args rbracket  */
+#line 2482 "src/parse.y"
+                    {
+		      (yyval.nd) = new_call(p, (yyvsp[-3].nd), intern2("[]",2), (yyvsp[-1].nd));
+		    }
+#line 7616 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 389: /* $@25: %empty  */
+#line 2488 "src/parse.y"
+                    {
+		      local_nest(p);
+		    }
+#line 7624 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 390: /* brace_block: '{' $@25 opt_block_param compstmt '}'  */
+#line 2493 "src/parse.y"
+                    {
+		      (yyval.nd) = new_block(p,(yyvsp[-2].nd),(yyvsp[-1].nd));
+		      local_unnest(p);
+		    }
+#line 7633 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 391: /* $@26: %empty  */
+#line 2498 "src/parse.y"
+                    {
+		      local_nest(p);
+		    }
+#line 7641 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 392: /* brace_block: keyword_do $@26 opt_block_param compstmt keyword_end  */
+#line 2503 "src/parse.y"
+                    {
+		      (yyval.nd) = new_block(p,(yyvsp[-2].nd),(yyvsp[-1].nd));
+		      local_unnest(p);
+		    }
+#line 7650 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 393: /* case_body: keyword_when args then compstmt cases  */
+#line 2512 "src/parse.y"
+                    {
+		      (yyval.nd) = cons(cons((yyvsp[-3].nd), (yyvsp[-1].nd)), (yyvsp[0].nd));
+		    }
+#line 7658 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 394: /* cases: opt_else  */
+#line 2518 "src/parse.y"
+                    {
+		      if ((yyvsp[0].nd)) {
+			(yyval.nd) = cons(cons(0, (yyvsp[0].nd)), 0);
+		      }
+		      else {
+			(yyval.nd) = 0;
+		      }
+		    }
+#line 7671 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 396: /* opt_rescue: keyword_rescue exc_list exc_var then compstmt opt_rescue  */
+#line 2532 "src/parse.y"
+                    {
+		      (yyval.nd) = list1(list3((yyvsp[-4].nd), (yyvsp[-3].nd), (yyvsp[-1].nd)));
+		      if ((yyvsp[0].nd)) (yyval.nd) = append((yyval.nd), (yyvsp[0].nd));
+		    }
+#line 7680 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 398: /* exc_list: arg_value  */
+#line 2540 "src/parse.y"
+                    {
+			(yyval.nd) = list1((yyvsp[0].nd));
+		    }
+#line 7688 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 401: /* exc_var: tASSOC lhs  */
+#line 2548 "src/parse.y"
+                    {
+		      (yyval.nd) = (yyvsp[0].nd);
+		    }
+#line 7696 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 403: /* opt_ensure: keyword_ensure compstmt  */
+#line 2555 "src/parse.y"
+                    {
+		      (yyval.nd) = (yyvsp[0].nd);
+		    }
+#line 7704 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 411: /* string: tSTRING_BEG tSTRING  */
+#line 2570 "src/parse.y"
+                    {
+		      (yyval.nd) = (yyvsp[0].nd);
+		    }
+#line 7712 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 412: /* string: tSTRING_BEG string_rep tSTRING  */
+#line 2574 "src/parse.y"
+                    {
+		      (yyval.nd) = new_dstr(p, push((yyvsp[-1].nd), (yyvsp[0].nd)));
+		    }
+#line 7720 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 414: /* string_rep: string_rep string_interp  */
+#line 2581 "src/parse.y"
+                    {
+		      (yyval.nd) = append((yyvsp[-1].nd), (yyvsp[0].nd));
+		    }
+#line 7728 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 415: /* string_interp: tSTRING_MID  */
+#line 2587 "src/parse.y"
+                    {
+		      (yyval.nd) = list1((yyvsp[0].nd));
+		    }
+#line 7736 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 416: /* @27: %empty  */
+#line 2591 "src/parse.y"
+                    {
+		      (yyval.nd) = p->lex_strterm;
+		      p->lex_strterm = NULL;
+		    }
+#line 7745 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 417: /* string_interp: tSTRING_PART @27 compstmt '}'  */
+#line 2597 "src/parse.y"
+                    {
+		      p->lex_strterm = (yyvsp[-2].nd);
+		      (yyval.nd) = list2((yyvsp[-3].nd), (yyvsp[-1].nd));
+		    }
+#line 7754 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 418: /* string_interp: tLITERAL_DELIM  */
+#line 2602 "src/parse.y"
+                    {
+		      (yyval.nd) = list1(new_literal_delim(p));
+		    }
+#line 7762 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 419: /* xstring: tXSTRING_BEG tXSTRING  */
+#line 2608 "src/parse.y"
+                    {
+			(yyval.nd) = (yyvsp[0].nd);
+		    }
+#line 7770 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 420: /* xstring: tXSTRING_BEG string_rep tXSTRING  */
+#line 2612 "src/parse.y"
+                    {
+		      (yyval.nd) = new_dxstr(p, push((yyvsp[-1].nd), (yyvsp[0].nd)));
+		    }
+#line 7778 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 421: /* regexp: tREGEXP_BEG tREGEXP  */
+#line 2618 "src/parse.y"
+                    {
+			(yyval.nd) = (yyvsp[0].nd);
+		    }
+#line 7786 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 422: /* regexp: tREGEXP_BEG string_rep tREGEXP  */
+#line 2622 "src/parse.y"
+                    {
+		      (yyval.nd) = new_dregx(p, (yyvsp[-1].nd), (yyvsp[0].nd));
+		    }
+#line 7794 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 428: /* heredoc_body: tHEREDOC_END  */
+#line 2639 "src/parse.y"
+                    {
+		      parsing_heredoc_inf(p)->doc = list1(new_str(p, "", 0));
+		      heredoc_end(p);
+		    }
+#line 7803 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 429: /* heredoc_body: string_rep tHEREDOC_END  */
+#line 2644 "src/parse.y"
+                    {
+		      parsing_heredoc_inf(p)->doc = (yyvsp[-1].nd);
+		      heredoc_end(p);
+		    }
+#line 7812 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 430: /* words: tWORDS_BEG tSTRING  */
+#line 2651 "src/parse.y"
+                    {
+		      (yyval.nd) = new_words(p, list1((yyvsp[0].nd)));
+		    }
+#line 7820 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 431: /* words: tWORDS_BEG string_rep tSTRING  */
+#line 2655 "src/parse.y"
+                    {
+		      (yyval.nd) = new_words(p, push((yyvsp[-1].nd), (yyvsp[0].nd)));
+		    }
+#line 7828 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 432: /* symbol: basic_symbol  */
+#line 2662 "src/parse.y"
+                    {
+		      (yyval.nd) = new_sym(p, (yyvsp[0].id));
+		    }
+#line 7836 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 433: /* symbol: tSYMBEG tSTRING_BEG string_interp tSTRING  */
+#line 2666 "src/parse.y"
+                    {
+		      p->lstate = EXPR_END;
+		      (yyval.nd) = new_dsym(p, push((yyvsp[-1].nd), (yyvsp[0].nd)));
+		    }
+#line 7845 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 434: /* basic_symbol: tSYMBEG sym  */
+#line 2673 "src/parse.y"
+                    {
+		      p->lstate = EXPR_END;
+		      (yyval.id) = (yyvsp[0].id);
+		    }
+#line 7854 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 439: /* sym: tSTRING  */
+#line 2684 "src/parse.y"
+                    {
+		      (yyval.id) = new_strsym(p, (yyvsp[0].nd));
+		    }
+#line 7862 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 440: /* sym: tSTRING_BEG tSTRING  */
+#line 2688 "src/parse.y"
+                    {
+		      (yyval.id) = new_strsym(p, (yyvsp[0].nd));
+		    }
+#line 7870 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 441: /* symbols: tSYMBOLS_BEG tSTRING  */
+#line 2694 "src/parse.y"
+                    {
+		      (yyval.nd) = new_symbols(p, list1((yyvsp[0].nd)));
+		    }
+#line 7878 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 442: /* symbols: tSYMBOLS_BEG string_rep tSTRING  */
+#line 2698 "src/parse.y"
+                    {
+		      (yyval.nd) = new_symbols(p, push((yyvsp[-1].nd), (yyvsp[0].nd)));
+		    }
+#line 7886 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 445: /* numeric: tUMINUS_NUM tINTEGER  */
+#line 2706 "src/parse.y"
+                    {
+		      (yyval.nd) = negate_lit(p, (yyvsp[0].nd));
+		    }
+#line 7894 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 446: /* numeric: tUMINUS_NUM tFLOAT  */
+#line 2710 "src/parse.y"
+                    {
+		      (yyval.nd) = negate_lit(p, (yyvsp[0].nd));
+		    }
+#line 7902 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 447: /* variable: tIDENTIFIER  */
+#line 2716 "src/parse.y"
+                    {
+		      (yyval.nd) = new_lvar(p, (yyvsp[0].id));
+		    }
+#line 7910 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 448: /* variable: tIVAR  */
+#line 2720 "src/parse.y"
+                    {
+		      (yyval.nd) = new_ivar(p, (yyvsp[0].id));
+		    }
+#line 7918 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 449: /* variable: tGVAR  */
+#line 2724 "src/parse.y"
+                    {
+		      (yyval.nd) = new_gvar(p, (yyvsp[0].id));
+		    }
+#line 7926 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 450: /* variable: tCVAR  */
+#line 2728 "src/parse.y"
+                    {
+		      (yyval.nd) = new_cvar(p, (yyvsp[0].id));
+		    }
+#line 7934 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 451: /* variable: tCONSTANT  */
+#line 2732 "src/parse.y"
+                    {
+		      (yyval.nd) = new_const(p, (yyvsp[0].id));
+		    }
+#line 7942 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 452: /* var_lhs: variable  */
+#line 2738 "src/parse.y"
+                    {
+		      assignable(p, (yyvsp[0].nd));
+		    }
+#line 7950 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 453: /* var_ref: variable  */
+#line 2744 "src/parse.y"
+                    {
+		      (yyval.nd) = var_reference(p, (yyvsp[0].nd));
+		    }
+#line 7958 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 454: /* var_ref: keyword_nil  */
+#line 2748 "src/parse.y"
+                    {
+		      (yyval.nd) = new_nil(p);
+		    }
+#line 7966 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 455: /* var_ref: keyword_self  */
+#line 2752 "src/parse.y"
+                    {
+		      (yyval.nd) = new_self(p);
+   		    }
+#line 7974 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 456: /* var_ref: keyword_true  */
+#line 2756 "src/parse.y"
+                    {
+		      (yyval.nd) = new_true(p);
+   		    }
+#line 7982 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 457: /* var_ref: keyword_false  */
+#line 2760 "src/parse.y"
+                    {
+		      (yyval.nd) = new_false(p);
+   		    }
+#line 7990 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 458: /* var_ref: keyword__FILE__  */
+#line 2764 "src/parse.y"
+                    {
+		      if (!p->filename) {
+			p->filename = "(null)";
+		      }
+		      (yyval.nd) = new_str(p, p->filename, strlen(p->filename));
+		    }
+#line 8001 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 459: /* var_ref: keyword__LINE__  */
+#line 2771 "src/parse.y"
+                    {
+		      char buf[16];
+
+		      snprintf(buf, sizeof(buf), "%d", p->lineno);
+		      (yyval.nd) = new_int(p, buf, 10);
+		    }
+#line 8012 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 462: /* superclass: term  */
+#line 2784 "src/parse.y"
+                    {
+		      (yyval.nd) = 0;
+		    }
+#line 8020 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 463: /* $@28: %empty  */
+#line 2788 "src/parse.y"
+                    {
+		      p->lstate = EXPR_BEG;
+		      p->cmd_start = TRUE;
+		    }
+#line 8029 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 464: /* superclass: '<' $@28 expr_value term  */
+#line 2793 "src/parse.y"
+                    {
+		      (yyval.nd) = (yyvsp[-1].nd);
+		    }
+#line 8037 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 465: /* superclass: error term  */
+#line 2797 "src/parse.y"
+                    {
+		      yyerrok;
+		      (yyval.nd) = 0;
+		    }
+#line 8046 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 466: /* f_arglist: '(' f_args rparen  */
+#line 2804 "src/parse.y"
+                    {
+		      (yyval.nd) = (yyvsp[-1].nd);
+		      p->lstate = EXPR_BEG;
+		      p->cmd_start = TRUE;
+		    }
+#line 8056 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 467: /* f_arglist: f_args term  */
+#line 2810 "src/parse.y"
+                    {
+		      (yyval.nd) = (yyvsp[-1].nd);
+		    }
+#line 8064 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 468: /* f_args: f_arg ',' f_optarg ',' f_rest_arg opt_f_block_arg  */
+#line 2816 "src/parse.y"
+                    {
+		      (yyval.nd) = new_args(p, (yyvsp[-5].nd), (yyvsp[-3].nd), (yyvsp[-1].id), 0, (yyvsp[0].id));
+		    }
+#line 8072 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 469: /* f_args: f_arg ',' f_optarg ',' f_rest_arg ',' f_arg opt_f_block_arg  */
+#line 2820 "src/parse.y"
+                    {
+		      (yyval.nd) = new_args(p, (yyvsp[-7].nd), (yyvsp[-5].nd), (yyvsp[-3].id), (yyvsp[-1].nd), (yyvsp[0].id));
+		    }
+#line 8080 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 470: /* f_args: f_arg ',' f_optarg opt_f_block_arg  */
+#line 2824 "src/parse.y"
+                    {
+		      (yyval.nd) = new_args(p, (yyvsp[-3].nd), (yyvsp[-1].nd), 0, 0, (yyvsp[0].id));
+		    }
+#line 8088 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 471: /* f_args: f_arg ',' f_optarg ',' f_arg opt_f_block_arg  */
+#line 2828 "src/parse.y"
+                    {
+		      (yyval.nd) = new_args(p, (yyvsp[-5].nd), (yyvsp[-3].nd), 0, (yyvsp[-1].nd), (yyvsp[0].id));
+		    }
+#line 8096 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 472: /* f_args: f_arg ',' f_rest_arg opt_f_block_arg  */
+#line 2832 "src/parse.y"
+                    {
+		      (yyval.nd) = new_args(p, (yyvsp[-3].nd), 0, (yyvsp[-1].id), 0, (yyvsp[0].id));
+		    }
+#line 8104 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 473: /* f_args: f_arg ',' f_rest_arg ',' f_arg opt_f_block_arg  */
+#line 2836 "src/parse.y"
+                    {
+		      (yyval.nd) = new_args(p, (yyvsp[-5].nd), 0, (yyvsp[-3].id), (yyvsp[-1].nd), (yyvsp[0].id));
+		    }
+#line 8112 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 474: /* f_args: f_arg opt_f_block_arg  */
+#line 2840 "src/parse.y"
+                    {
+		      (yyval.nd) = new_args(p, (yyvsp[-1].nd), 0, 0, 0, (yyvsp[0].id));
+		    }
+#line 8120 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 475: /* f_args: f_optarg ',' f_rest_arg opt_f_block_arg  */
+#line 2844 "src/parse.y"
+                    {
+		      (yyval.nd) = new_args(p, 0, (yyvsp[-3].nd), (yyvsp[-1].id), 0, (yyvsp[0].id));
+		    }
+#line 8128 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 476: /* f_args: f_optarg ',' f_rest_arg ',' f_arg opt_f_block_arg  */
+#line 2848 "src/parse.y"
+                    {
+		      (yyval.nd) = new_args(p, 0, (yyvsp[-5].nd), (yyvsp[-3].id), (yyvsp[-1].nd), (yyvsp[0].id));
+		    }
+#line 8136 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 477: /* f_args: f_optarg opt_f_block_arg  */
+#line 2852 "src/parse.y"
+                    {
+		      (yyval.nd) = new_args(p, 0, (yyvsp[-1].nd), 0, 0, (yyvsp[0].id));
+		    }
+#line 8144 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 478: /* f_args: f_optarg ',' f_arg opt_f_block_arg  */
+#line 2856 "src/parse.y"
+                    {
+		      (yyval.nd) = new_args(p, 0, (yyvsp[-3].nd), 0, (yyvsp[-1].nd), (yyvsp[0].id));
+		    }
+#line 8152 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 479: /* f_args: f_rest_arg opt_f_block_arg  */
+#line 2860 "src/parse.y"
+                    {
+		      (yyval.nd) = new_args(p, 0, 0, (yyvsp[-1].id), 0, (yyvsp[0].id));
+		    }
+#line 8160 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 480: /* f_args: f_rest_arg ',' f_arg opt_f_block_arg  */
+#line 2864 "src/parse.y"
+                    {
+		      (yyval.nd) = new_args(p, 0, 0, (yyvsp[-3].id), (yyvsp[-1].nd), (yyvsp[0].id));
+		    }
+#line 8168 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 481: /* f_args: f_block_arg  */
+#line 2868 "src/parse.y"
+                    {
+		      (yyval.nd) = new_args(p, 0, 0, 0, 0, (yyvsp[0].id));
+		    }
+#line 8176 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 482: /* f_args: %empty  */
+#line 2872 "src/parse.y"
+                    {
+		      local_add_f(p, 0);
+		      (yyval.nd) = new_args(p, 0, 0, 0, 0, 0);
+		    }
+#line 8185 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 483: /* f_bad_arg: tCONSTANT  */
+#line 2879 "src/parse.y"
+                    {
+		      yyerror(p, "formal argument cannot be a constant");
+		      (yyval.nd) = 0;
+		    }
+#line 8194 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 484: /* f_bad_arg: tIVAR  */
+#line 2884 "src/parse.y"
+                    {
+		      yyerror(p, "formal argument cannot be an instance variable");
+		      (yyval.nd) = 0;
+		    }
+#line 8203 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 485: /* f_bad_arg: tGVAR  */
+#line 2889 "src/parse.y"
+                    {
+		      yyerror(p, "formal argument cannot be a global variable");
+		      (yyval.nd) = 0;
+		    }
+#line 8212 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 486: /* f_bad_arg: tCVAR  */
+#line 2894 "src/parse.y"
+                    {
+		      yyerror(p, "formal argument cannot be a class variable");
+		      (yyval.nd) = 0;
+		    }
+#line 8221 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 487: /* f_norm_arg: f_bad_arg  */
+#line 2901 "src/parse.y"
+                    {
+		      (yyval.id) = 0;
+		    }
+#line 8229 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 488: /* f_norm_arg: tIDENTIFIER  */
+#line 2905 "src/parse.y"
+                    {
+		      local_add_f(p, (yyvsp[0].id));
+		      (yyval.id) = (yyvsp[0].id);
+		    }
+#line 8238 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 489: /* f_arg_item: f_norm_arg  */
+#line 2912 "src/parse.y"
+                    {
+		      (yyval.nd) = new_arg(p, (yyvsp[0].id));
+		    }
+#line 8246 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 490: /* f_arg_item: tLPAREN f_margs rparen  */
+#line 2916 "src/parse.y"
+                    {
+		      (yyval.nd) = new_masgn(p, (yyvsp[-1].nd), 0);
+		    }
+#line 8254 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 491: /* f_arg: f_arg_item  */
+#line 2922 "src/parse.y"
+                    {
+		      (yyval.nd) = list1((yyvsp[0].nd));
+		    }
+#line 8262 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 492: /* f_arg: f_arg ',' f_arg_item  */
+#line 2926 "src/parse.y"
+                    {
+		      (yyval.nd) = push((yyvsp[-2].nd), (yyvsp[0].nd));
+		    }
+#line 8270 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 493: /* f_opt: tIDENTIFIER '=' arg_value  */
+#line 2932 "src/parse.y"
+                    {
+		      local_add_f(p, (yyvsp[-2].id));
+		      (yyval.nd) = cons(nsym((yyvsp[-2].id)), (yyvsp[0].nd));
+		    }
+#line 8279 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 494: /* f_block_opt: tIDENTIFIER '=' primary_value  */
+#line 2939 "src/parse.y"
+                    {
+		      local_add_f(p, (yyvsp[-2].id));
+		      (yyval.nd) = cons(nsym((yyvsp[-2].id)), (yyvsp[0].nd));
+		    }
+#line 8288 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 495: /* f_block_optarg: f_block_opt  */
+#line 2946 "src/parse.y"
+                    {
+		      (yyval.nd) = list1((yyvsp[0].nd));
+		    }
+#line 8296 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 496: /* f_block_optarg: f_block_optarg ',' f_block_opt  */
+#line 2950 "src/parse.y"
+                    {
+		      (yyval.nd) = push((yyvsp[-2].nd), (yyvsp[0].nd));
+		    }
+#line 8304 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 497: /* f_optarg: f_opt  */
+#line 2956 "src/parse.y"
+                    {
+		      (yyval.nd) = list1((yyvsp[0].nd));
+		    }
+#line 8312 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 498: /* f_optarg: f_optarg ',' f_opt  */
+#line 2960 "src/parse.y"
+                    {
+		      (yyval.nd) = push((yyvsp[-2].nd), (yyvsp[0].nd));
+		    }
+#line 8320 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 501: /* f_rest_arg: restarg_mark tIDENTIFIER  */
+#line 2970 "src/parse.y"
+                    {
+		      local_add_f(p, (yyvsp[0].id));
+		      (yyval.id) = (yyvsp[0].id);
+		    }
+#line 8329 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 502: /* f_rest_arg: restarg_mark  */
+#line 2975 "src/parse.y"
+                    {
+		      local_add_f(p, 0);
+		      (yyval.id) = -1;
+		    }
+#line 8338 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 505: /* f_block_arg: blkarg_mark tIDENTIFIER  */
+#line 2986 "src/parse.y"
+                    {
+		      local_add_f(p, (yyvsp[0].id));
+		      (yyval.id) = (yyvsp[0].id);
+		    }
+#line 8347 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 506: /* opt_f_block_arg: ',' f_block_arg  */
+#line 2993 "src/parse.y"
+                    {
+		      (yyval.id) = (yyvsp[0].id);
+		    }
+#line 8355 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 507: /* opt_f_block_arg: none  */
+#line 2997 "src/parse.y"
+                    {
+		      local_add_f(p, 0);
+		      (yyval.id) = 0;
+		    }
+#line 8364 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 508: /* singleton: var_ref  */
+#line 3004 "src/parse.y"
+                    {
+		      (yyval.nd) = (yyvsp[0].nd);
+		      if (!(yyval.nd)) (yyval.nd) = new_nil(p);
+		    }
+#line 8373 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 509: /* $@29: %empty  */
+#line 3008 "src/parse.y"
+                      {p->lstate = EXPR_BEG;}
+#line 8379 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 510: /* singleton: '(' $@29 expr rparen  */
+#line 3009 "src/parse.y"
+                    {
+		      if ((yyvsp[-1].nd) == 0) {
+			yyerror(p, "can't define singleton method for ().");
+		      }
+		      else {
+			switch ((enum node_type)(int)(intptr_t)(yyvsp[-1].nd)->car) {
+			case NODE_STR:
+			case NODE_DSTR:
+			case NODE_XSTR:
+			case NODE_DXSTR:
+			case NODE_DREGX:
+			case NODE_MATCH:
+			case NODE_FLOAT:
+			case NODE_ARRAY:
+			case NODE_HEREDOC:
+			  yyerror(p, "can't define singleton method for literals");
+			default:
+			  break;
+			}
+		      }
+		      (yyval.nd) = (yyvsp[-1].nd);
+		    }
+#line 8406 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 512: /* assoc_list: assocs trailer  */
+#line 3035 "src/parse.y"
+                    {
+		      (yyval.nd) = (yyvsp[-1].nd);
+		    }
+#line 8414 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 513: /* assocs: assoc  */
+#line 3041 "src/parse.y"
+                    {
+		      (yyval.nd) = list1((yyvsp[0].nd));
+		    }
+#line 8422 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 514: /* assocs: assocs ',' assoc  */
+#line 3045 "src/parse.y"
+                    {
+		      (yyval.nd) = push((yyvsp[-2].nd), (yyvsp[0].nd));
+		    }
+#line 8430 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 515: /* assoc: arg_value tASSOC arg_value  */
+#line 3051 "src/parse.y"
+                    {
+		      (yyval.nd) = cons((yyvsp[-2].nd), (yyvsp[0].nd));
+		    }
+#line 8438 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 516: /* assoc: tLABEL arg_value  */
+#line 3055 "src/parse.y"
+                    {
+		      (yyval.nd) = cons(new_sym(p, (yyvsp[-1].id)), (yyvsp[0].nd));
+		    }
+#line 8446 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 538: /* term: ';'  */
+#line 3099 "src/parse.y"
+                      {yyerrok;}
+#line 8452 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 540: /* $@30: %empty  */
+#line 3104 "src/parse.y"
+                    {
+		      p->lineno++;
+		      p->column = 0;
+		    }
+#line 8461 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 543: /* terms: terms ';'  */
+#line 3111 "src/parse.y"
+                            {yyerrok;}
+#line 8467 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+  case 544: /* none: %empty  */
+#line 3115 "src/parse.y"
+                    {
+		      (yyval.nd) = 0;
+		    }
+#line 8475 "/root/repo/build/host/src/y.tab.c"
+    break;
+
+
+#line 8479 "/root/repo/build/host/src/y.tab.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (p, YY_("syntax error"));
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval, p);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, p);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (p, YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval, p);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, p);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 3119 "src/parse.y"
+
+#define yylval  (*((YYSTYPE*)(p->ylval)))
+
+static void
+yyerror(parser_state *p, const char *s)
+{
+  char* c;
+  int n;
+
+  if (! p->capture_errors) {
+#ifdef ENABLE_STDIO
+    if (p->filename) {
+      fprintf(stderr, "%s:%d:%d: %s\n", p->filename, p->lineno, p->column, s);
+    }
+    else {
+      fprintf(stderr, "line %d:%d: %s\n", p->lineno, p->column, s);
+    }
+#endif
+  }
+  else if (p->nerr < sizeof(p->error_buffer) / sizeof(p->error_buffer[0])) {
+    n = strlen(s);
+    c = (char *)parser_palloc(p, n + 1);
+    memcpy(c, s, n + 1);
+    p->error_buffer[p->nerr].message = c;
+    p->error_buffer[p->nerr].lineno = p->lineno;
+    p->error_buffer[p->nerr].column = p->column;
+  }
+  p->nerr++;
+}
+
+static void
+yyerror_i(parser_state *p, const char *fmt, int i)
+{
+  char buf[256];
+
+  snprintf(buf, sizeof(buf), fmt, i);
+  yyerror(p, buf);
+}
+
+static void
+yywarn(parser_state *p, const char *s)
+{
+  char* c;
+  int n;
+
+  if (! p->capture_errors) {
+#ifdef ENABLE_STDIO
+    if (p->filename) {
+      fprintf(stderr, "%s:%d:%d: %s\n", p->filename, p->lineno, p->column, s);
+    }
+    else {
+      fprintf(stderr, "line %d:%d: %s\n", p->lineno, p->column, s);
+    }
+#endif
+  }
+  else if (p->nwarn < sizeof(p->warn_buffer) / sizeof(p->warn_buffer[0])) {
+    n = strlen(s);
+    c = (char *)parser_palloc(p, n + 1);
+    memcpy(c, s, n + 1);
+    p->warn_buffer[p->nwarn].message = c;
+    p->warn_buffer[p->nwarn].lineno = p->lineno;
+    p->warn_buffer[p->nwarn].column = p->column;
+  }
+  p->nwarn++;
+}
+
+static void
+yywarning(parser_state *p, const char *s)
+{
+  yywarn(p, s);
+}
+
+static void
+yywarning_s(parser_state *p, const char *fmt, const char *s)
+{
+  char buf[256];
+
+  snprintf(buf, sizeof(buf), fmt, s);
+  yywarning(p, buf);
+}
+
+static void
+backref_error(parser_state *p, node *n)
+{
+  int c;
+
+  c = (int)(intptr_t)n->car;
+
+  if (c == NODE_NTH_REF) {
+    yyerror_i(p, "can't set variable $%d", (int)(intptr_t)n->cdr);
+  } else if (c == NODE_BACK_REF) {
+    yyerror_i(p, "can't set variable $%c", (int)(intptr_t)n->cdr);
+  } else {
+    mrb_bug("Internal error in backref_error() : n=>car == %d", c);
+  }
+}
+
+static int peeks(parser_state *p, const char *s);
+static int skips(parser_state *p, const char *s);
+
+static inline int
+nextc(parser_state *p)
+{
+  int c;
+
+  if (p->pb) {
+    node *tmp;
+
+    c = (int)(intptr_t)p->pb->car;
+    tmp = p->pb;
+    p->pb = p->pb->cdr;
+    cons_free(tmp);
+  }
+  else {
+#ifdef ENABLE_STDIO
+    if (p->f) {
+      if (feof(p->f)) return -1;
+      c = fgetc(p->f);
+      if (c == EOF) return -1;
+    }
+    else
+#endif
+    if (!p->s || p->s >= p->send) {
+      return -1;
+    }
+    else {
+      c = (unsigned char)*p->s++;
+    }
+  }
+  p->column++;
+  return c;
+}
+
+static void
+pushback(parser_state *p, int c)
+{
+  if (c < 0) return;
+  p->column--;
+  p->pb = cons((node*)(intptr_t)c, p->pb);
+}
+
+static void
+skip(parser_state *p, char term)
+{
+  int c;
+
+  for (;;) {
+    c = nextc(p);
+    if (c < 0) break;
+    if (c == term) break;
+  }
+}
+
+static int
+peek_n(parser_state *p, int c, int n)
+{
+  node *list = 0;
+  int c0;
+
+  do {
+    c0 = nextc(p);
+    if (c0 < 0) return FALSE;
+    list = push(list, (node*)(intptr_t)c0);
+  } while(n--);
+  if (p->pb) {
+    p->pb = push(p->pb, (node*)list);
+  }
+  else {
+    p->pb = list;
+  }
+  if (c0 == c) return TRUE;
+  return FALSE;
+}
+#define peek(p,c) peek_n((p), (c), 0)
+
+static int
+peeks(parser_state *p, const char *s)
+{
+  int len = strlen(s);
+
+#ifdef ENABLE_STDIO
+  if (p->f) {
+    int n = 0;
+    while (*s) {
+      if (!peek_n(p, *s++, n++)) return FALSE;
+    }
+    return TRUE;
+  }
+  else
+#endif
+  if (p->s && p->s + len >= p->send) {
+    if (memcmp(p->s, s, len) == 0) return TRUE;
+  }
+  return FALSE;
+}
+
+static int
+skips(parser_state *p, const char *s)
+{
+  int c;
+
+  for (;;) {
+    // skip until first char
+    for (;;) {
+      c = nextc(p);
+      if (c < 0) return c;
+      if (c == *s) break;
+    }
+    s++;
+    if (peeks(p, s)) {
+      int len = strlen(s);
+
+      while (len--) {
+	nextc(p);
+      }
+      return TRUE;
+    }
+	else{
+      s--;
+    }
+  }
+  return FALSE;
+}
+
+
+static int
+newtok(parser_state *p)
+{
+  p->bidx = 0;
+  return p->column - 1;
+}
+
+static void
+tokadd(parser_state *p, int c)
+{
+  if (p->bidx < MRB_PARSER_BUF_SIZE) {
+    p->buf[p->bidx++] = c;
+  }
+}
+
+static int
+toklast(parser_state *p)
+{
+  return p->buf[p->bidx-1];
+}
+
+static void
+tokfix(parser_state *p)
+{
+  if (p->bidx >= MRB_PARSER_BUF_SIZE) {
+    yyerror(p, "string too long (truncated)");
+  }
+  p->buf[p->bidx] = '\0';
+}
+
+static const char*
+tok(parser_state *p)
+{
+  return p->buf;
+}
+
+static int
+toklen(parser_state *p)
+{
+  return p->bidx;
+}
+
+#define IS_ARG() (p->lstate == EXPR_ARG || p->lstate == EXPR_CMDARG)
+#define IS_END() (p->lstate == EXPR_END || p->lstate == EXPR_ENDARG || p->lstate == EXPR_ENDFN)
+#define IS_BEG() (p->lstate == EXPR_BEG || p->lstate == EXPR_MID || p->lstate == EXPR_VALUE || p->lstate == EXPR_CLASS)
+#define IS_SPCARG(c) (IS_ARG() && space_seen && !ISSPACE(c))
+#define IS_LABEL_POSSIBLE() ((p->lstate == EXPR_BEG && !cmd_state) || IS_ARG())
+#define IS_LABEL_SUFFIX(n) (peek_n(p, ':',(n)) && !peek_n(p, ':', (n)+1))
+
+static int
+scan_oct(const int *start, int len, int *retlen)
+{
+  const int *s = start;
+  int retval = 0;
+
+  /* assert(len <= 3) */
+  while (len-- && *s >= '0' && *s <= '7') {
+    retval <<= 3;
+    retval |= *s++ - '0';
+  }
+  *retlen = s - start;
+
+  return retval;
+}
+
+static int
+scan_hex(const int *start, int len, int *retlen)
+{
+  static const char hexdigit[] = "0123456789abcdef0123456789ABCDEF";
+  register const int *s = start;
+  register int retval = 0;
+  char *tmp;
+
+  /* assert(len <= 2) */
+  while (len-- && *s && (tmp = strchr(hexdigit, *s))) {
+    retval <<= 4;
+    retval |= (tmp - hexdigit) & 15;
+    s++;
+  }
+  *retlen = s - start;
+
+  return retval;
+}
+
+static int
+read_escape(parser_state *p)
+{
+  int c;
+
+  switch (c = nextc(p)) {
+  case '\\':	/* Backslash */
+    return c;
+
+  case 'n':	/* newline */
+    return '\n';
+
+  case 't':	/* horizontal tab */
+    return '\t';
+
+  case 'r':	/* carriage-return */
+    return '\r';
+
+  case 'f':	/* form-feed */
+    return '\f';
+
+  case 'v':	/* vertical tab */
+    return '\13';
+
+  case 'a':	/* alarm(bell) */
+    return '\007';
+
+  case 'e':	/* escape */
+    return 033;
+
+  case '0': case '1': case '2': case '3': /* octal constant */
+  case '4': case '5': case '6': case '7':
+    {
+      int buf[3];
+      int i;
+
+      buf[0] = c;
+      for (i=1; i<3; i++) {
+        buf[i] = nextc(p);
+        if (buf[i] == -1) goto eof;
+        if (buf[i] < '0' || '7' < buf[i]) {
+          pushback(p, buf[i]);
+          break;
+        }
+      }
+      c = scan_oct(buf, i, &i);
+    }
+    return c;
+
+  case 'x':	/* hex constant */
+    {
+      int buf[2];
+      int i;
+
+      for (i=0; i<2; i++) {
+	buf[i] = nextc(p);
+	if (buf[i] == -1) goto eof;
+	if (!ISXDIGIT(buf[i])) {
+	  pushback(p, buf[i]);
+	  break;
+	}
+      }
+      c = scan_hex(buf, i, &i);
+      if (i == 0) {
+	yyerror(p, "Invalid escape character syntax");
+	return 0;
+      }
+    }
+    return c;
+
+  case 'b':	/* backspace */
+    return '\010';
+
+  case 's':	/* space */
+    return ' ';
+
+  case 'M':
+    if ((c = nextc(p)) != '-') {
+      yyerror(p, "Invalid escape character syntax");
+      pushback(p, c);
+      return '\0';
+    }
+    if ((c = nextc(p)) == '\\') {
+      return read_escape(p) | 0x80;
+    }
+    else if (c == -1) goto eof;
+    else {
+      return ((c & 0xff) | 0x80);
+    }
+
+  case 'C':
+    if ((c = nextc(p)) != '-') {
+      yyerror(p, "Invalid escape character syntax");
+      pushback(p, c);
+      return '\0';
+    }
+  case 'c':
+    if ((c = nextc(p))== '\\') {
+      c = read_escape(p);
+    }
+    else if (c == '?')
+      return 0177;
+    else if (c == -1) goto eof;
+    return c & 0x9f;
+
+  eof:
+  case -1:
+    yyerror(p, "Invalid escape character syntax");
+    return '\0';
+
+  default:
+    return c;
+  }
+}
+
+
+static int
+parse_string(parser_state *p)
+{
+  int c;
+  string_type type = (string_type)(intptr_t)p->lex_strterm->car;
+  int nest_level = (intptr_t)p->lex_strterm->cdr->car;
+  int beg = (intptr_t)p->lex_strterm->cdr->cdr->car;
+  int end = (intptr_t)p->lex_strterm->cdr->cdr->cdr;
+  parser_heredoc_info *hinf = (type & STR_FUNC_HEREDOC) ? parsing_heredoc_inf(p) : NULL;
+
+  newtok(p);
+  while ((c = nextc(p)) != end || nest_level != 0) {
+    if (hinf && (c == '\n' || c == -1)) {
+      int line_head;
+      tokadd(p, '\n');
+      tokfix(p);
+      p->lineno++;
+      p->column = 0;
+      line_head = hinf->line_head;
+      hinf->line_head = TRUE;
+      if (line_head) {
+	/* check whether end of heredoc */
+	const char *s = tok(p);
+	int len = toklen(p);
+	if (hinf->allow_indent) {
+	  while (ISSPACE(*s) && len > 0) {
+	    ++s;
+	    --len;
+	  }
+	}
+	if ((len-1 == hinf->term_len) && (strncmp(s, hinf->term, len-1) == 0)) {
+	  return tHEREDOC_END;
+	}
+      }
+      if (c == -1) {
+	char buf[256];
+	snprintf(buf, sizeof(buf), "can't find string \"%s\" anywhere before EOF", hinf->term);
+	yyerror(p, buf);
+	return 0;
+      }
+      yylval.nd = new_str(p, tok(p), toklen(p));
+      return tSTRING_MID;
+    }
+    if (c == -1) {
+      yyerror(p, "unterminated string meets end of file");
+      return 0;
+    }
+    else if (c == beg) {
+      nest_level++;
+      p->lex_strterm->cdr->car = (node*)(intptr_t)nest_level;
+    }
+    else if (c == end) {
+      nest_level--;
+      p->lex_strterm->cdr->car = (node*)(intptr_t)nest_level;
+    }
+    else if (c == '\\') {
+      c = nextc(p);
+      if (type & STR_FUNC_EXPAND) {
+	if (c == end || c == beg) {
+	  tokadd(p, c);
+	}
+	else if ((c == '\n') && (type & STR_FUNC_ARRAY)) {
+	  p->lineno++;
+	  p->column = 0;
+	  tokadd(p, '\n');
+	}
+	else {
+	  pushback(p, c);
+
+	  if(type & STR_FUNC_REGEXP)
+	    tokadd(p, '\\');
+
+	  tokadd(p, read_escape(p));
+	  if (hinf)
+	    hinf->line_head = FALSE;
+	}
+      } else {
+	if (c != beg && c != end) {
+	  switch (c) {
+	  case '\n':
+	    p->lineno++;
+	    p->column = 0;
+	    break;
+
+	  case '\\':
+	    break;
+
+	  default:
+	    if (! ISSPACE(c))
+	      tokadd(p, '\\');
+	  }
+	}
+	tokadd(p, c);
+      }
+      continue;
+    }
+    else if ((c == '#') && (type & STR_FUNC_EXPAND)) {
+      c = nextc(p);
+      if (c == '{') {
+	tokfix(p);
+	p->lstate = EXPR_BEG;
+	p->cmd_start = TRUE;
+	yylval.nd = new_str(p, tok(p), toklen(p));
+	if (hinf)
+	  hinf->line_head = FALSE;
+	return tSTRING_PART;
+      }
+      tokadd(p, '#');
+      pushback(p, c);
+      continue;
+    }
+    if ((type & STR_FUNC_ARRAY) && ISSPACE(c)) {
+      if (toklen(p) == 0) {
+	do {
+	  if (c == '\n') {
+	    p->lineno++;
+	    p->column = 0;
+	  }
+	} while (ISSPACE(c = nextc(p)));
+	pushback(p, c);
+	return tLITERAL_DELIM;
+      } else {
+	pushback(p, c);
+	tokfix(p);
+	yylval.nd = new_str(p, tok(p), toklen(p));
+	return tSTRING_MID;
+      }
+    }
+
+    tokadd(p, c);
+
+  } 
+
+  tokfix(p);
+  p->lstate = EXPR_END;
+  end_strterm(p);
+
+  if (type & STR_FUNC_XQUOTE) {
+    yylval.nd = new_xstr(p, tok(p), toklen(p));
+    return tXSTRING;
+  }
+
+  if (type & STR_FUNC_REGEXP) {
+    int f = 0;
+    int c;
+    char *s = strndup(tok(p), toklen(p));
+    char flag[4] = { '\0' };
+
+    newtok(p);
+    while (c = nextc(p), ISALPHA(c)) {
+      switch (c) {
+      case 'i': f |= 1; break;
+      case 'x': f |= 2; break;
+      case 'm': f |= 4; break;
+      default: tokadd(p, c); break;
+      }
+    }
+    pushback(p, c);
+    if (toklen(p)) {
+      char msg[128];
+      tokfix(p);
+      snprintf(msg, sizeof(msg), "unknown regexp option%s - %s",
+	  toklen(p) > 1 ? "s" : "", tok(p));
+      yyerror(p, msg);
+    }
+    if (f & 1) strcat(flag, "i");
+    if (f & 2) strcat(flag, "x");
+    if (f & 4) strcat(flag, "m");
+    yylval.nd = new_regx(p, s, strdup(flag));
+
+    return tREGEXP;
+  }
+
+  yylval.nd = new_str(p, tok(p), toklen(p));
+  return tSTRING;
+}
+ 
+
+static int
+heredoc_identifier(parser_state *p)
+{
+  int c;
+  int type = str_heredoc;
+  int indent = FALSE;
+  int quote = FALSE;
+  node *newnode;
+  parser_heredoc_info *info;
+
+  c = nextc(p);
+  if (ISSPACE(c) || c == '=') {
+    pushback(p, c);
+    return 0;
+  }
+  if (c == '-') {
+    indent = TRUE;
+    c = nextc(p);
+  }
+  if (c == '\'' || c == '"') {
+    int term = c;
+    if (c == '\'')
+      quote = TRUE;
+    newtok(p);
+    while ((c = nextc(p)) != -1 && c != term) {
+      if (c == '\n') {
+	c = -1;
+	break;
+      }
+      tokadd(p, c);
+    }
+    if (c == -1) {
+      yyerror(p, "unterminated here document identifier");
+      return 0;
+    }
+  } else {
+    if (! identchar(c)) {
+      pushback(p, c);
+      if (indent) pushback(p, '-');
+      return 0;
+    }
+    newtok(p);
+    do {
+      tokadd(p, c);
+    } while ((c = nextc(p)) != -1 && identchar(c));
+    pushback(p, c);
+  }
+  tokfix(p);
+  newnode = new_heredoc(p);
+  info = (parser_heredoc_info*)newnode->cdr;
+  info->term = strndup(tok(p), toklen(p));
+  info->term_len = toklen(p);
+  if (! quote)
+    type |= STR_FUNC_EXPAND;
+  info->type = type;
+  info->allow_indent = indent;
+  info->line_head = TRUE;
+  info->doc = NULL;
+  p->heredocs = push(p->heredocs, newnode);
+  if (p->parsing_heredoc == NULL) {
+    node *n = p->heredocs;
+    while (n->cdr)
+      n = n->cdr;
+    p->parsing_heredoc = n;
+  }
+  p->heredoc_starts_nextline = TRUE;
+  p->lstate = EXPR_END;
+
+  yylval.nd = newnode;
+  return tHEREDOC_BEG;
+}
+
+static int
+arg_ambiguous(parser_state *p)
+{
+  yywarning(p, "ambiguous first argument; put parentheses or even spaces");
+  return 1;
+}
+
+#include "lex.def"
+
+static int
+parser_yylex(parser_state *p)
+{
+  register int c;
+  int space_seen = 0;
+  int cmd_state;
+  enum mrb_lex_state_enum last_state;
+  int token_column;
+
+  if (p->lex_strterm) {
+    if (is_strterm_type(p, STR_FUNC_HEREDOC)) {
+      if ((p->parsing_heredoc != NULL) && (! p->heredoc_starts_nextline))
+	return parse_string(p);
+    }
+    else
+      return parse_string(p);
+  }
+  cmd_state = p->cmd_start;
+  p->cmd_start = FALSE;
+ retry:
+  last_state = p->lstate;
+  switch (c = nextc(p)) {
+  case '\0':    /* NUL */
+  case '\004':  /* ^D */
+  case '\032':  /* ^Z */
+  case -1:      /* end of script. */
+    return 0;
+
+  /* white spaces */
+  case ' ': case '\t': case '\f': case '\r':
+  case '\13':   /* '\v' */
+    space_seen = 1;
+    goto retry;
+
+  case '#':     /* it's a comment */
+    skip(p, '\n');
+  /* fall through */
+  case '\n':
+    p->heredoc_starts_nextline = FALSE;
+    if (p->parsing_heredoc != NULL) {
+      p->lex_strterm = new_strterm(p, parsing_heredoc_inf(p)->type, 0, 0);
+      goto normal_newline;
+    }
+    switch (p->lstate) {
+    case EXPR_BEG:
+    case EXPR_FNAME:
+    case EXPR_DOT:
+    case EXPR_CLASS:
+    case EXPR_VALUE:
+      p->lineno++;
+      p->column = 0;
+      goto retry;
+    default:
+      break;
+    }
+    while ((c = nextc(p))) {
+      switch (c) {
+      case ' ': case '\t': case '\f': case '\r':
+      case '\13': /* '\v' */
+	space_seen = 1;
+	break;
+      case '.':
+	if ((c = nextc(p)) != '.') {
+	  pushback(p, c);
+	  pushback(p, '.');
+	  goto retry;
+	}
+      case -1:			/* EOF */
+	goto normal_newline;
+      default:
+	pushback(p, c);
+	goto normal_newline;
+      }
+    }
+  normal_newline:
+    p->cmd_start = TRUE;
+    p->lstate = EXPR_BEG;
+    return '\n';
+
+  case '*':
+    if ((c = nextc(p)) == '*') {
+      if ((c = nextc(p)) == '=') {
+	yylval.id = intern2("**",2);
+	p->lstate = EXPR_BEG;
+	return tOP_ASGN;
+      }
+      pushback(p, c);
+      c = tPOW;
+    }
+    else {
+      if (c == '=') {
+	yylval.id = intern_c('*');
+	p->lstate = EXPR_BEG;
+	return tOP_ASGN;
+      }
+      pushback(p, c);
+      if (IS_SPCARG(c)) {
+	yywarning(p, "`*' interpreted as argument prefix");
+	c = tSTAR;
+      }
+      else if (IS_BEG()) {
+	c = tSTAR;
+      }
+      else {
+	c = '*';
+      }
+    }
+    if (p->lstate == EXPR_FNAME || p->lstate == EXPR_DOT) {
+      p->lstate = EXPR_ARG;
+    } else {
+      p->lstate = EXPR_BEG;
+    }
+    return c;
+
+  case '!':
+    c = nextc(p);
+    if (p->lstate == EXPR_FNAME || p->lstate == EXPR_DOT) {
+      p->lstate = EXPR_ARG;
+      if (c == '@') {
+	return '!';
+      }
+    }
+    else {
+      p->lstate = EXPR_BEG;
+    }
+    if (c == '=') {
+      return tNEQ;
+    }
+    if (c == '~') {
+      return tNMATCH;
+    }
+    pushback(p, c);
+    return '!';
+
+  case '=':
+    if (p->column == 1) {
+      if (peeks(p, "begin\n")) {
+	skips(p, "\n=end\n");
+      goto retry;
+      }
+    }
+    if (p->lstate == EXPR_FNAME || p->lstate == EXPR_DOT) {
+      p->lstate = EXPR_ARG;
+    } else {
+      p->lstate = EXPR_BEG;
+    }
+    if ((c = nextc(p)) == '=') {
+      if ((c = nextc(p)) == '=') {
+	return tEQQ;
+      }
+      pushback(p, c);
+      return tEQ;
+    }
+    if (c == '~') {
+      return tMATCH;
+    }
+    else if (c == '>') {
+      return tASSOC;
+    }
+    pushback(p, c);
+    return '=';
+
+  case '<':
+    last_state = p->lstate;
+    c = nextc(p);
+    if (c == '<' &&
+	p->lstate != EXPR_DOT &&
+	p->lstate != EXPR_CLASS &&
+	!IS_END() &&
+	(!IS_ARG() || space_seen)) {
+      int token = heredoc_identifier(p);
+      if (token)
+	return token;
+    }
+    if (p->lstate == EXPR_FNAME || p->lstate == EXPR_DOT) {
+      p->lstate = EXPR_ARG;
+    } else {
+      p->lstate = EXPR_BEG;
+      if (p->lstate == EXPR_CLASS) {
+	p->cmd_start = TRUE;
+      }
+    }
+    if (c == '=') {
+      if ((c = nextc(p)) == '>') {
+	return tCMP;
+      }
+      pushback(p, c);
+      return tLEQ;
+    }
+    if (c == '<') {
+      if ((c = nextc(p)) == '=') {
+	yylval.id = intern2("<<",2);
+	p->lstate = EXPR_BEG;
+	return tOP_ASGN;
+      }
+      pushback(p, c);
+      return tLSHFT;
+    }
+    pushback(p, c);
+    return '<';
+
+  case '>':
+    if (p->lstate == EXPR_FNAME || p->lstate == EXPR_DOT) {
+      p->lstate = EXPR_ARG;
+    } else {
+      p->lstate = EXPR_BEG;
+    }
+    if ((c = nextc(p)) == '=') {
+      return tGEQ;
+    }
+    if (c == '>') {
+      if ((c = nextc(p)) == '=') {
+	yylval.id = intern2(">>",2);
+	p->lstate = EXPR_BEG;
+	return tOP_ASGN;
+      }
+      pushback(p, c);
+      return tRSHFT;
+    }
+    pushback(p, c);
+    return '>';
+
+  case '"':
+    p->lex_strterm = new_strterm(p, str_dquote, '"', 0);
+    return tSTRING_BEG;
+
+  case '\'':
+    p->lex_strterm = new_strterm(p, str_squote, '\'', 0);
+    return parse_string(p);
+
+  case '`':
+    if (p->lstate == EXPR_FNAME) {
+      p->lstate = EXPR_ENDFN;
+      return '`';
+    }
+    if (p->lstate == EXPR_DOT) {
+      if (cmd_state)
+        p->lstate = EXPR_CMDARG;
+      else
+        p->lstate = EXPR_ARG;
+      return '`';
+    }
+    p->lex_strterm = new_strterm(p, str_xquote, '`', 0);
+    return tXSTRING_BEG;
+
+  case '?':
+    if (IS_END()) {
+      p->lstate = EXPR_VALUE;
+      return '?';
+    }
+    c = nextc(p);
+    if (c == -1) {
+      yyerror(p, "incomplete character syntax");
+      return 0;
+    }
+    if (isspace(c)) {
+      if (!IS_ARG()) {
+	int c2;
+	switch (c) {
+	case ' ':
+	  c2 = 's';
+	  break;
+	case '\n':
+	  c2 = 'n';
+	  break;
+	case '\t':
+	  c2 = 't';
+	  break;
+	case '\v':
+	  c2 = 'v';
+	  break;
+	case '\r':
+	  c2 = 'r';
+	  break;
+	case '\f':
+	  c2 = 'f';
+	  break;
+	default:
+	  c2 = 0;
+	  break;
+	}
+	if (c2) {
+	  char buf[256];
+	  snprintf(buf, sizeof(buf), "invalid character syntax; use ?\\%c", c2);
+	  yyerror(p, buf);
+	}
+      }
+    ternary:
+      pushback(p, c);
+      p->lstate = EXPR_VALUE;
+      return '?';
+    }
+    token_column = newtok(p);
+    // need support UTF-8 if configured
+    if ((isalnum(c) || c == '_')) {
+      int c2 = nextc(p);
+      pushback(p, c2);
+      if ((isalnum(c2) || c2 == '_')) {
+	goto ternary;
+      }
+    }
+    if (c == '\\') {
+      c = nextc(p);
+      if (c == 'u') {
+#if 0
+	tokadd_utf8(p);
+#endif
+      }
+      else {
+	pushback(p, c);
+	c = read_escape(p);
+	tokadd(p, c);
+      }
+    }
+    else {
+      tokadd(p, c);
+    }
+    tokfix(p);
+    yylval.nd = new_str(p, tok(p), toklen(p));
+    p->lstate = EXPR_END;
+    return tCHAR;
+
+  case '&':
+    if ((c = nextc(p)) == '&') {
+      p->lstate = EXPR_BEG;
+      if ((c = nextc(p)) == '=') {
+	yylval.id = intern2("&&",2);
+	p->lstate = EXPR_BEG;
+	return tOP_ASGN;
+      }
+      pushback(p, c);
+      return tANDOP;
+    }
+    else if (c == '=') {
+      yylval.id = intern_c('&');
+      p->lstate = EXPR_BEG;
+      return tOP_ASGN;
+    }
+    pushback(p, c);
+    if (IS_SPCARG(c)) {
+      yywarning(p, "`&' interpreted as argument prefix");
+      c = tAMPER;
+    }
+    else if (IS_BEG()) {
+      c = tAMPER;
+    }
+    else {
+      c = '&';
+    }
+    if (p->lstate == EXPR_FNAME || p->lstate == EXPR_DOT) {
+      p->lstate = EXPR_ARG;
+    } else {
+      p->lstate = EXPR_BEG;
+    }
+    return c;
+
+  case '|':
+    if ((c = nextc(p)) == '|') {
+      p->lstate = EXPR_BEG;
+      if ((c = nextc(p)) == '=') {
+	yylval.id = intern2("||",2);
+	p->lstate = EXPR_BEG;
+	return tOP_ASGN;
+      }
+      pushback(p, c);
+      return tOROP;
+    }
+    if (c == '=') {
+      yylval.id = intern_c('|');
+      p->lstate = EXPR_BEG;
+      return tOP_ASGN;
+    }
+    if (p->lstate == EXPR_FNAME || p->lstate == EXPR_DOT) {
+      p->lstate = EXPR_ARG;
+    }
+    else {
+      p->lstate = EXPR_BEG;
+    }
+    pushback(p, c);
+    return '|';
+
+  case '+':
+    c = nextc(p);
+    if (p->lstate == EXPR_FNAME || p->lstate == EXPR_DOT) {
+      p->lstate = EXPR_ARG;
+      if (c == '@') {
+	return tUPLUS;
+      }
+      pushback(p, c);
+      return '+';
+    }
+    if (c == '=') {
+      yylval.id = intern_c('+');
+      p->lstate = EXPR_BEG;
+      return tOP_ASGN;
+    }
+    if (IS_BEG() || (IS_SPCARG(c) && arg_ambiguous(p))) {
+      p->lstate = EXPR_BEG;
+      pushback(p, c);
+      if (c != -1 && ISDIGIT(c)) {
+	c = '+';
+	goto start_num;
+      }
+      return tUPLUS;
+    }
+    p->lstate = EXPR_BEG;
+    pushback(p, c);
+    return '+';
+
+  case '-':
+    c = nextc(p);
+    if (p->lstate == EXPR_FNAME || p->lstate == EXPR_DOT) {
+      p->lstate = EXPR_ARG;
+      if (c == '@') {
+	return tUMINUS;
+      }
+      pushback(p, c);
+      return '-';
+    }
+    if (c == '=') {
+      yylval.id = intern_c('-');
+      p->lstate = EXPR_BEG;
+      return tOP_ASGN;
+    }
+    if (c == '>') {
+      p->lstate = EXPR_ENDFN;
+      return tLAMBDA;
+    }
+    if (IS_BEG() || (IS_SPCARG(c) && arg_ambiguous(p))) {
+      p->lstate = EXPR_BEG;
+      pushback(p, c);
+      if (c != -1 && ISDIGIT(c)) {
+	return tUMINUS_NUM;
+      }
+      return tUMINUS;
+    }
+    p->lstate = EXPR_BEG;
+    pushback(p, c);
+    return '-';
+
+  case '.':
+    p->lstate = EXPR_BEG;
+    if ((c = nextc(p)) == '.') {
+      if ((c = nextc(p)) == '.') {
+	return tDOT3;
+      }
+      pushback(p, c);
+      return tDOT2;
+    }
+    pushback(p, c);
+    if (c != -1 && ISDIGIT(c)) {
+      yyerror(p, "no .<digit> floating literal anymore; put 0 before dot");
+    }
+    p->lstate = EXPR_DOT;
+    return '.';
+
+  start_num:
+  case '0': case '1': case '2': case '3': case '4':
+  case '5': case '6': case '7': case '8': case '9':
+    {
+      int is_float, seen_point, seen_e, nondigit;
+
+      is_float = seen_point = seen_e = nondigit = 0;
+      p->lstate = EXPR_END;
+      token_column = newtok(p);
+      if (c == '-' || c == '+') {
+	tokadd(p, c);
+	c = nextc(p);
+      }
+      if (c == '0') {
+#define no_digits() do {yyerror(p,"numeric literal without digits"); return 0;} while (0)
+	int start = toklen(p);
+	c = nextc(p);
+	if (c == 'x' || c == 'X') {
+	  /* hexadecimal */
+	  c = nextc(p);
+	  if (c != -1 && ISXDIGIT(c)) {
+	    do {
+	      if (c == '_') {
+		if (nondigit) break;
+		nondigit = c;
+		continue;
+	      }
+	      if (!ISXDIGIT(c)) break;
+	      nondigit = 0;
+	      tokadd(p, tolower(c));
+	    } while ((c = nextc(p)) != -1);
+	  }
+	  pushback(p, c);
+	  tokfix(p);
+	  if (toklen(p) == start) {
+	    no_digits();
+	  }
+	  else if (nondigit) goto trailing_uc;
+	  yylval.nd = new_int(p, tok(p), 16);
+	  return tINTEGER;
+	}
+	if (c == 'b' || c == 'B') {
+	  /* binary */
+	  c = nextc(p);
+	  if (c == '0' || c == '1') {
+	    do {
+	      if (c == '_') {
+		if (nondigit) break;
+		nondigit = c;
+		continue;
+	      }
+	      if (c != '0' && c != '1') break;
+	      nondigit = 0;
+	      tokadd(p, c);
+	    } while ((c = nextc(p)) != -1);
+	  }
+	  pushback(p, c);
+	  tokfix(p);
+	  if (toklen(p) == start) {
+	    no_digits();
+	  }
+	  else if (nondigit) goto trailing_uc;
+	  yylval.nd = new_int(p, tok(p), 2);
+	  return tINTEGER;
+	}
+	if (c == 'd' || c == 'D') {
+	  /* decimal */
+	  c = nextc(p);
+	  if (c != -1 && ISDIGIT(c)) {
+	    do {
+	      if (c == '_') {
+		if (nondigit) break;
+		nondigit = c;
+		continue;
+	      }
+	      if (!ISDIGIT(c)) break;
+	      nondigit = 0;
+	      tokadd(p, c);
+	    } while ((c = nextc(p)) != -1);
+	  }
+	  pushback(p, c);
+	  tokfix(p);
+	  if (toklen(p) == start) {
+	    no_digits();
+	  }
+	  else if (nondigit) goto trailing_uc;
+	  yylval.nd = new_int(p, tok(p), 10);
+	  return tINTEGER;
+	}
+	if (c == '_') {
+	  /* 0_0 */
+	  goto octal_number;
+	}
+	if (c == 'o' || c == 'O') {
+	  /* prefixed octal */
+	  c = nextc(p);
+	  if (c == -1 || c == '_' || !ISDIGIT(c)) {
+	    no_digits();
+	  }
+	}
+	if (c >= '0' && c <= '7') {
+	  /* octal */
+	octal_number:
+	  do {
+	    if (c == '_') {
+	      if (nondigit) break;
+	      nondigit = c;
+	      continue;
+	    }
+	    if (c < '0' || c > '9') break;
+	    if (c > '7') goto invalid_octal;
+	    nondigit = 0;
+	    tokadd(p, c);
+	  } while ((c = nextc(p)) != -1);
+
+	  if (toklen(p) > start) {
+	    pushback(p, c);
+	    tokfix(p);
+	    if (nondigit) goto trailing_uc;
+	    yylval.nd = new_int(p, tok(p), 8);
+	    return tINTEGER;
+	  }
+	  if (nondigit) {
+	    pushback(p, c);
+	    goto trailing_uc;
+	  }
+	}
+	if (c > '7' && c <= '9') {
+	invalid_octal:
+	  yyerror(p, "Invalid octal digit");
+	}
+	else if (c == '.' || c == 'e' || c == 'E') {
+	  tokadd(p, '0');
+	}
+	else {
+	  pushback(p, c);
+	  yylval.nd = new_int(p, "0", 10);
+	  return tINTEGER;
+	}
+      }
+
+      for (;;) {
+	switch (c) {
+	case '0': case '1': case '2': case '3': case '4':
+	case '5': case '6': case '7': case '8': case '9':
+	  nondigit = 0;
+	  tokadd(p, c);
+	  break;
+
+	case '.':
+	  if (nondigit) goto trailing_uc;
+	  if (seen_point || seen_e) {
+	    goto decode_num;
+	  }
+	  else {
+	    int c0 = nextc(p);
+	    if (c0 == -1 || !ISDIGIT(c0)) {
+	      pushback(p, c0);
+	      goto decode_num;
+	    }
+	    c = c0;
+	  }
+	  tokadd(p, '.');
+	  tokadd(p, c);
+	  is_float++;
+	  seen_point++;
+	  nondigit = 0;
+	  break;
+
+	case 'e':
+	case 'E':
+	  if (nondigit) {
+	    pushback(p, c);
+	    c = nondigit;
+	    goto decode_num;
+	  }
+	  if (seen_e) {
+	    goto decode_num;
+	  }
+	  tokadd(p, c);
+	  seen_e++;
+	  is_float++;
+	  nondigit = c;
+	  c = nextc(p);
+	  if (c != '-' && c != '+') continue;
+	  tokadd(p, c);
+	  nondigit = c;
+	  break;
+
+	case '_':	/* `_' in number just ignored */
+	  if (nondigit) goto decode_num;
+	  nondigit = c;
+	  break;
+
+	default:
+	  goto decode_num;
+	}
+	c = nextc(p);
+      }
+
+    decode_num:
+      pushback(p, c);
+      if (nondigit) {
+      trailing_uc:
+	yyerror_i(p, "trailing `%c' in number", nondigit);
+      }
+      tokfix(p);
+      if (is_float) {
+	double d;
+	char *endp;
+
+	errno = 0;
+	d = strtod(tok(p), &endp);
+	if (d == 0 && endp == tok(p)) {
+	  yywarning_s(p, "corrupted float value %s", tok(p));
+	}
+	else if (errno == ERANGE) {
+	  yywarning_s(p, "float %s out of range", tok(p));
+	  errno = 0;
+	}
+	yylval.nd = new_float(p, tok(p));
+	return tFLOAT;
+      }
+      yylval.nd = new_int(p, tok(p), 10);
+      return tINTEGER;
+    }
+
+  case ')':
+  case ']':
+    p->paren_nest--;
+  case '}':
+    COND_LEXPOP();
+    CMDARG_LEXPOP();
+    if (c == ')')
+      p->lstate = EXPR_ENDFN;
+    else
+      p->lstate = EXPR_ENDARG;
+    return c;
+
+  case ':':
+    c = nextc(p);
+    if (c == ':') {
+      if (IS_BEG() || p->lstate == EXPR_CLASS || IS_SPCARG(-1)) {
+	p->lstate = EXPR_BEG;
+	return tCOLON3;
+      }
+      p->lstate = EXPR_DOT;
+      return tCOLON2;
+    }
+    if (IS_END() || ISSPACE(c)) {
+      pushback(p, c);
+      p->lstate = EXPR_BEG;
+      return ':';
+    }
+    pushback(p, c);
+    p->lstate = EXPR_FNAME;
+    return tSYMBEG;
+
+  case '/':
+    if (IS_BEG()) {
+      p->lex_strterm = new_strterm(p, str_regexp, '/', 0);
+      return tREGEXP_BEG;
+    }
+    if ((c = nextc(p)) == '=') {
+      yylval.id = intern_c('/');
+      p->lstate = EXPR_BEG;
+      return tOP_ASGN;
+    }
+    pushback(p, c);
+    if (IS_SPCARG(c)) {
+      p->lex_strterm = new_strterm(p, str_regexp, '/', 0);
+      return tREGEXP_BEG;
+    }
+    if (p->lstate == EXPR_FNAME || p->lstate == EXPR_DOT) {
+      p->lstate = EXPR_ARG;
+    } else {
+      p->lstate = EXPR_BEG;
+    }
+    return '/';
+
+  case '^':
+    if ((c = nextc(p)) == '=') {
+      yylval.id = intern_c('^');
+      p->lstate = EXPR_BEG;
+      return tOP_ASGN;
+    }
+    if (p->lstate == EXPR_FNAME || p->lstate == EXPR_DOT) {
+      p->lstate = EXPR_ARG;
+    } else {
+      p->lstate = EXPR_BEG;
+    }
+    pushback(p, c);
+    return '^';
+
+  case ';':
+    p->lstate = EXPR_BEG;
+    return ';';
+
+  case ',':
+    p->lstate = EXPR_BEG;
+    return ',';
+
+  case '~':
+    if (p->lstate == EXPR_FNAME || p->lstate == EXPR_DOT) {
+      if ((c = nextc(p)) != '@') {
+	pushback(p, c);
+      }
+      p->lstate = EXPR_ARG;
+    }
+    else {
+      p->lstate = EXPR_BEG;
+    }
+    return '~';
+
+  case '(':
+    if (IS_BEG()) {
+      c = tLPAREN;
+    }
+    else if (IS_SPCARG(-1)) {
+      c = tLPAREN_ARG;
+    }
+    p->paren_nest++;
+    COND_PUSH(0);
+    CMDARG_PUSH(0);
+    p->lstate = EXPR_BEG;
+    return c;
+
+  case '[':
+    p->paren_nest++;
+    if (p->lstate == EXPR_FNAME || p->lstate == EXPR_DOT) {
+      p->lstate = EXPR_ARG;
+      if ((c = nextc(p)) == ']') {
+	if ((c = nextc(p)) == '=') {
+	  return tASET;
+	}
+	pushback(p, c);
+	return tAREF;
+      }
+      pushback(p, c);
+      return '[';
+    }
+    else if (IS_BEG()) {
+      c = tLBRACK;
+    }
+    else if (IS_ARG() && space_seen) {
+      c = tLBRACK;
+    }
+    p->lstate = EXPR_BEG;
+    COND_PUSH(0);
+    CMDARG_PUSH(0);
+    return c;
+
+  case '{':
+    if (p->lpar_beg && p->lpar_beg == p->paren_nest) {
+      p->lstate = EXPR_BEG;
+      p->lpar_beg = 0;
+      p->paren_nest--;
+      COND_PUSH(0);
+      CMDARG_PUSH(0);
+      return tLAMBEG;
+    }
+    if (IS_ARG() || p->lstate == EXPR_END || p->lstate == EXPR_ENDFN)
+      c = '{';          /* block (primary) */
+    else if (p->lstate == EXPR_ENDARG)
+      c = tLBRACE_ARG;  /* block (expr) */
+    else
+      c = tLBRACE;      /* hash */
+    COND_PUSH(0);
+    CMDARG_PUSH(0);
+    p->lstate = EXPR_BEG;
+    return c;
+
+  case '\\':
+    c = nextc(p);
+    if (c == '\n') {
+      p->lineno++;
+      p->column = 0;
+      space_seen = 1;
+      goto retry; /* skip \\n */
+    }
+    pushback(p, c);
+    return '\\';
+
+  case '%':
+    if (IS_BEG()) {
+      int term;
+      int paren;
+
+      c = nextc(p);
+    quotation:
+      if (c == -1 || !ISALNUM(c)) {
+	term = c;
+	c = 'Q';
+      }
+      else {
+	term = nextc(p);
+	if (isalnum(term)) {
+	  yyerror(p, "unknown type of %string");
+	  return 0;
+	}
+      }
+      if (c == -1 || term == -1) {
+	yyerror(p, "unterminated quoted string meets end of file");
+	return 0;
+      }
+      paren = term;
+      if (term == '(') term = ')';
+      else if (term == '[') term = ']';
+      else if (term == '{') term = '}';
+      else if (term == '<') term = '>';
+      else paren = 0;
+
+      switch (c) {
+      case 'Q':
+	p->lex_strterm = new_strterm(p, str_dquote, term, paren);
+	return tSTRING_BEG;
+
+      case 'q':
+	p->lex_strterm = new_strterm(p, str_squote, term, paren);
+	return parse_string(p);
+
+      case 'W':
+	p->lex_strterm = new_strterm(p, str_dword, term, paren);
+	return tWORDS_BEG;
+
+      case 'w':
+	p->lex_strterm = new_strterm(p, str_sword, term, paren);
+	return tWORDS_BEG;
+
+      case 'x':
+	p->lex_strterm = new_strterm(p, str_xquote, term, paren);
+	return tXSTRING_BEG;
+
+      case 'r':
+	p->lex_strterm = new_strterm(p, str_regexp, term, paren);
+	return tREGEXP_BEG;
+
+      case 's':
+	p->lex_strterm = new_strterm(p, str_ssym, term, paren);
+	return tSYMBEG;
+
+      case 'I':
+	p->lex_strterm = new_strterm(p, str_dsymbols, term, paren);
+	return tSYMBOLS_BEG;
+
+      case 'i':
+	p->lex_strterm = new_strterm(p, str_ssymbols, term, paren);
+	return tSYMBOLS_BEG;
+
+      default:
+	yyerror(p, "unknown type of %string");
+	return 0;
+      }
+    }
+    if ((c = nextc(p)) == '=') {
+      yylval.id = intern_c('%');
+      p->lstate = EXPR_BEG;
+      return tOP_ASGN;
+    }
+    if (IS_SPCARG(c)) {
+      goto quotation;
+    }
+    if (p->lstate == EXPR_FNAME || p->lstate == EXPR_DOT) {
+      p->lstate = EXPR_ARG;
+    } else {
+      p->lstate = EXPR_BEG;
+    }
+    pushback(p, c);
+    return '%';
+
+  case '$':
+    p->lstate = EXPR_END;
+    token_column = newtok(p);
+    c = nextc(p);
+    if (c == -1) {
+      yyerror(p, "incomplete global variable syntax");
+      return 0;
+    }
+    switch (c) {
+    case '_':     /* $_: last read line string */
+      c = nextc(p);
+      if (c != -1 && identchar(c)) { /* if there is more after _ it is a variable */
+        tokadd(p, '$');
+        tokadd(p, c);
+        break;
+      }
+      pushback(p, c);
+      c = '_';
+      /* fall through */
+    case '~':     /* $~: match-data */
+    case '*':     /* $*: argv */
+    case '$':     /* $$: pid */
+    case '?':     /* $?: last status */
+    case '!':     /* $!: error string */
+    case '@':     /* $@: error position */
+    case '/':     /* $/: input record separator */
+    case '\\':    /* $\: output record separator */
+    case ';':     /* $;: field separator */
+    case ',':     /* $,: output field separator */
+    case '.':     /* $.: last read line number */
+    case '=':     /* $=: ignorecase */
+    case ':':     /* $:: load path */
+    case '<':     /* $<: reading filename */
+    case '>':     /* $>: default output handle */
+    case '\"':    /* $": already loaded files */
+      tokadd(p, '$');
+      tokadd(p, c);
+      tokfix(p);
+      yylval.id = intern(tok(p));
+      return tGVAR;
+
+    case '-':
+      tokadd(p, '$');
+      tokadd(p, c);
+      c = nextc(p);
+      pushback(p, c);
+    gvar:
+      tokfix(p);
+      yylval.id = intern(tok(p));
+      return tGVAR;
+
+    case '&':     /* $&: last match */
+    case '`':     /* $`: string before last match */
+    case '\'':    /* $': string after last match */
+    case '+':     /* $+: string matches last pattern */
+      if (last_state == EXPR_FNAME) {
+	tokadd(p, '$');
+	tokadd(p, c);
+	goto gvar;
+      }
+      yylval.nd = new_back_ref(p, c);
+      return tBACK_REF;
+
+    case '1': case '2': case '3':
+    case '4': case '5': case '6':
+    case '7': case '8': case '9':
+      do {
+	tokadd(p, c);
+	c = nextc(p);
+      } while (c != -1 && isdigit(c));
+      pushback(p, c);
+      if (last_state == EXPR_FNAME) goto gvar;
+      tokfix(p);
+      yylval.nd = new_nth_ref(p, atoi(tok(p))); 
+      return tNTH_REF;
+
+    default:
+      if (!identchar(c)) {
+	pushback(p,  c);
+	return '$';
+      }
+    case '0':
+      tokadd(p, '$');
+    }
+    break;
+
+  case '@':
+    c = nextc(p);
+    token_column = newtok(p);
+    tokadd(p, '@');
+    if (c == '@') {
+      tokadd(p, '@');
+      c = nextc(p);
+    }
+    if (c == -1) {
+      if (p->bidx == 1) {
+	yyerror(p, "incomplete instance variable syntax");
+      }
+      else {
+	yyerror(p, "incomplete class variable syntax");
+      }
+      return 0;
+    }
+    else if (isdigit(c)) {
+      if (p->bidx == 1) {
+	yyerror_i(p, "`@%c' is not allowed as an instance variable name", c);
+      }
+      else {
+	yyerror_i(p, "`@@%c' is not allowed as a class variable name", c);
+      }
+      return 0;
+    }
+    if (!identchar(c)) {
+      pushback(p, c);
+      return '@';
+    }
+    break;
+
+  case '_':
+    token_column = newtok(p);
+    break;
+
+  default:
+    if (!identchar(c)) {
+      yyerror_i(p,  "Invalid char `\\x%02X' in expression", c);
+      goto retry;
+    }
+
+    token_column = newtok(p);
+    break;
+  }
+
+  do {
+    tokadd(p, c);
+    c = nextc(p);
+    if (c < 0) break;
+  } while (identchar(c));
+  if (token_column == 0 && toklen(p) == 7 && (c < 0 || c == '\n') &&
+      strncmp(tok(p), "__END__", toklen(p)) == 0)
+    return -1;
+
+  switch (tok(p)[0]) {
+  case '@': case '$':
+    pushback(p, c);
+    break;
+  default:
+    if ((c == '!' || c == '?') && !peek(p, '=')) {
+      tokadd(p, c);
+    }
+    else {
+      pushback(p, c);
+    }
+  }
+  tokfix(p);
+  {
+    int result = 0;
+
+    last_state = p->lstate;
+    switch (tok(p)[0]) {
+    case '$':
+      p->lstate = EXPR_END;
+      result = tGVAR;
+      break;
+    case '@':
+      p->lstate = EXPR_END;
+      if (tok(p)[1] == '@')
+	result = tCVAR;
+      else
+	result = tIVAR;
+      break;
+
+    default:
+      if (toklast(p) == '!' || toklast(p) == '?') {
+	result = tFID;
+      }
+      else {
+	if (p->lstate == EXPR_FNAME) {
+	  if ((c = nextc(p)) == '=' && !peek(p, '~') && !peek(p, '>') &&
+	      (!peek(p, '=') || (peek_n(p, '>', 1)))) {
+	    result = tIDENTIFIER;
+	    tokadd(p, c);
+	    tokfix(p);
+	  }
+	  else {
+	    pushback(p, c);
+	  }
+	}
+	if (result == 0 && isupper((int)tok(p)[0])) {
+	  result = tCONSTANT;
+	}
+	else {
+	  result = tIDENTIFIER;
+	}
+      }
+
+      if (IS_LABEL_POSSIBLE()) {
+	if (IS_LABEL_SUFFIX(0)) {
+	  p->lstate = EXPR_BEG;
+	  nextc(p);
+	  tokfix(p);
+	  yylval.id = intern(tok(p));
+	  return tLABEL;
+	}
+      }
+      if (p->lstate != EXPR_DOT) {
+	const struct kwtable *kw;
+
+	/* See if it is a reserved word.  */
+	kw = mrb_reserved_word(tok(p), toklen(p));
+	if (kw) {
+	  enum mrb_lex_state_enum state = p->lstate;
+	  p->lstate = kw->state;
+	  if (state == EXPR_FNAME) {
+	    yylval.id = intern(kw->name);
+	    return kw->id[0];
+	  }
+	  if (p->lstate == EXPR_BEG) {
+	    p->cmd_start = TRUE;
+	  }
+	  if (kw->id[0] == keyword_do) {
+	    if (p->lpar_beg && p->lpar_beg == p->paren_nest) {
+	      p->lpar_beg = 0;
+	      p->paren_nest--;
+	      return keyword_do_LAMBDA;
+	    }
+	    if (COND_P()) return keyword_do_cond;
+	    if (CMDARG_P() && state != EXPR_CMDARG)
+	      return keyword_do_block;
+	    if (state == EXPR_ENDARG || state == EXPR_BEG)
+	      return keyword_do_block;
+	    return keyword_do;
+	  }
+	  if (state == EXPR_BEG || state == EXPR_VALUE)
+	    return kw->id[0];
+	  else {
+	    if (kw->id[0] != kw->id[1])
+	      p->lstate = EXPR_BEG;
+	    return kw->id[1];
+	  }
+	}
+      }
+
+      if (IS_BEG() || p->lstate == EXPR_DOT || IS_ARG()) {
+	if (cmd_state) {
+	  p->lstate = EXPR_CMDARG;
+	}
+	else {
+	  p->lstate = EXPR_ARG;
+	}
+      }
+      else if (p->lstate == EXPR_FNAME) {
+	p->lstate = EXPR_ENDFN;
+      }
+      else {
+	p->lstate = EXPR_END;
+      }
+    }
+    {
+      mrb_sym ident = intern(tok(p));
+
+      yylval.id = ident;
+#if 0
+      if (last_state != EXPR_DOT && islower(tok(p)[0]) && lvar_defined(ident)) {
+	p->lstate = EXPR_END;
+      }
+#endif
+    }
+    return result;
+  }
+}
+
+static int
+yylex(void *lval, parser_state *p)
+{
+  int t;
+
+  p->ylval = lval;
+  t = parser_yylex(p);
+
+  return t;
+}
+
+static void
+parser_init_cxt(parser_state *p, mrbc_context *cxt)
+{
+  if (!cxt) return;
+  if (cxt->lineno) p->lineno = cxt->lineno;
+  if (cxt->filename) p->filename = cxt->filename;
+  if (cxt->syms) {
+    int i;
+
+    p->locals = cons(0,0);
+    for (i=0; i<cxt->slen; i++) {
+      local_add_f(p, cxt->syms[i]);
+    }
+  }
+  p->capture_errors = cxt->capture_errors;
+}
+
+static void
+parser_update_cxt(parser_state *p, mrbc_context *cxt)
+{
+  node *n, *n0;
+  int i = 0;
+
+  if (!cxt) return;
+  if ((int)(intptr_t)p->tree->car != NODE_SCOPE) return;
+  n0 = n = p->tree->cdr->car;
+  while (n) {
+    i++;
+    n = n->cdr;
+  }
+  cxt->syms = (mrb_sym *)mrb_realloc(p->mrb, cxt->syms, i*sizeof(mrb_sym));
+  cxt->slen = i;
+  for (i=0, n=n0; n; i++,n=n->cdr) {
+    cxt->syms[i] = sym(n->car);
+  }
+}
+
+void codedump_all(mrb_state*, int);
+void parser_dump(mrb_state *mrb, node *tree, int offset);
+
+void
+mrb_parser_parse(parser_state *p, mrbc_context *c)
+{
+  if (setjmp(p->jmp) != 0) {
+    yyerror(p, "memory allocation error");
+    p->nerr++;
+    p->tree = 0;
+    return;
+  }
+
+  p->cmd_start = TRUE;
+  p->in_def = p->in_single = FALSE;
+  p->nerr = p->nwarn = 0;
+  p->lex_strterm = NULL;
+
+  parser_init_cxt(p, c);
+  yyparse(p);
+  if (!p->tree) {
+    p->tree = new_nil(p);
+  }
+  parser_update_cxt(p, c);
+  if (c && c->dump_result) {
+    parser_dump(p->mrb, p->tree, 0);
+  }
+}
+
+parser_state*
+mrb_parser_new(mrb_state *mrb)
+{
+  mrb_pool *pool;
+  parser_state *p;
+  static const parser_state parser_state_zero = { 0 };
+
+  pool = mrb_pool_open(mrb);
+  if (!pool) return 0;
+  p = (parser_state *)mrb_pool_alloc(pool, sizeof(parser_state));
+  if (!p) return 0;
+
+  *p = parser_state_zero;
+  p->mrb = mrb;
+  p->pool = pool;
+  p->in_def = p->in_single = 0;
+
+  p->s = p->send = NULL;
+#ifdef ENABLE_STDIO
+  p->f = NULL;
+#endif
+
+  p->cmd_start = TRUE;
+  p->in_def = p->in_single = FALSE;
+
+  p->capture_errors = 0;
+  p->lineno = 1;
+  p->column = 0;
+#if defined(PARSER_TEST) || defined(PARSER_DEBUG)
+  yydebug = 1;
+#endif
+
+  p->lex_strterm = NULL;
+  p->heredocs = p->parsing_heredoc = NULL;
+
+  return p;
+}
+
+void
+mrb_parser_free(parser_state *p) {
+  mrb_pool_close(p->pool);
+}
+
+mrbc_context*
+mrbc_context_new(mrb_state *mrb)
+{
+  mrbc_context *c;
+
+  c = (mrbc_context *)mrb_calloc(mrb, 1, sizeof(mrbc_context));
+  return c;
+}
+
+void
+mrbc_context_free(mrb_state *mrb, mrbc_context *cxt)
+{
+  mrb_free(mrb, cxt->syms);
+  mrb_free(mrb, cxt);
+}
+
+const char*
+mrbc_filename(mrb_state *mrb, mrbc_context *c, const char *s)
+{
+  if (s) {
+    int len = strlen(s);
+    char *p = (char *)mrb_alloca(mrb, len + 1);
+
+    memcpy(p, s, len + 1);
+    c->filename = p;
+    c->lineno = 1;
+  }
+  return c->filename;
+}
+
+#ifdef ENABLE_STDIO
+parser_state*
+mrb_parse_file(mrb_state *mrb, FILE *f, mrbc_context *c)
+{
+  parser_state *p;
+ 
+  p = mrb_parser_new(mrb);
+  if (!p) return 0;
+  p->s = p->send = NULL;
+  p->f = f;
+
+  mrb_parser_parse(p, c);
+  return p;
+}
+#endif
+
+parser_state*
+mrb_parse_nstring(mrb_state *mrb, const char *s, int len, mrbc_context *c)
+{
+  parser_state *p;
+
+  p = mrb_parser_new(mrb);
+  if (!p) return 0;
+  p->s = s;
+  p->send = s + len;
+
+  mrb_parser_parse(p, c);
+  return p;
+}
+
+parser_state*
+mrb_parse_string(mrb_state *mrb, const char *s, mrbc_context *c)
+{
+  return mrb_parse_nstring(mrb, s, strlen(s), c);
+}
+
+static mrb_value
+load_exec(mrb_state *mrb, parser_state *p, mrbc_context *c)
+{
+  int n;
+  mrb_value v;
+
+  if (!p) {
+    return mrb_undef_value();
+  }
+  if (!p->tree || p->nerr) {
+    if (p->capture_errors) {
+      char buf[256];
+
+      n = snprintf(buf, sizeof(buf), "line %d: %s\n",
+      p->error_buffer[0].lineno, p->error_buffer[0].message);
+      mrb->exc = mrb_obj_ptr(mrb_exc_new(mrb, E_SYNTAX_ERROR, buf, n));
+      mrb_parser_free(p);
+      return mrb_undef_value();
+    }
+    else {
+      static const char msg[] = "syntax error";
+      mrb->exc = mrb_obj_ptr(mrb_exc_new(mrb, E_SYNTAX_ERROR, msg, sizeof(msg) - 1));
+      mrb_parser_free(p);
+      return mrb_undef_value();
+    }
+  }
+  n = mrb_generate_code(mrb, p);
+  mrb_parser_free(p);
+  if (n < 0) {
+    static const char msg[] = "codegen error";
+    mrb->exc = mrb_obj_ptr(mrb_exc_new(mrb, E_SCRIPT_ERROR, msg, sizeof(msg) - 1));
+    return mrb_nil_value();
+  }
+  if (c) {
+    if (c->dump_result) codedump_all(mrb, n);
+    if (c->no_exec) return mrb_fixnum_value(n);
+  }
+  v = mrb_run(mrb, mrb_proc_new(mrb, mrb->irep[n]), mrb_top_self(mrb));
+  if (mrb->exc) return mrb_nil_value();
+  return v;
+}
+
+#ifdef ENABLE_STDIO
+mrb_value
+mrb_load_file_cxt(mrb_state *mrb, FILE *f, mrbc_context *c)
+{
+  return load_exec(mrb, mrb_parse_file(mrb, f, c), c);
+}
+
+mrb_value
+mrb_load_file(mrb_state *mrb, FILE *f)
+{
+  return mrb_load_file_cxt(mrb, f, NULL);
+}
+#endif
+
+mrb_value
+mrb_load_nstring_cxt(mrb_state *mrb, const char *s, int len, mrbc_context *c)
+{
+  return load_exec(mrb, mrb_parse_nstring(mrb, s, len, c), c);
+}
+
+mrb_value
+mrb_load_nstring(mrb_state *mrb, const char *s, int len)
+{
+  return mrb_load_nstring_cxt(mrb, s, len, NULL);
+}
+
+mrb_value
+mrb_load_string_cxt(mrb_state *mrb, const char *s, mrbc_context *c)
+{
+  return mrb_load_nstring_cxt(mrb, s, strlen(s), c);
+}
+
+mrb_value
+mrb_load_string(mrb_state *mrb, const char *s)
+{
+  return mrb_load_string_cxt(mrb, s, NULL);
+}
+
+#ifdef ENABLE_STDIO
+
+static void
+dump_prefix(int offset)
+{
+  while (offset--) {
+    putc(' ', stdout);
+    putc(' ', stdout);
+  }
+}
+
+static void
+dump_recur(mrb_state *mrb, node *tree, int offset)
+{
+  while (tree) {
+    parser_dump(mrb, tree->car, offset);
+    tree = tree->cdr;
+  }
+}
+
+#endif
+
+void
+parser_dump(mrb_state *mrb, node *tree, int offset)
+{
+#ifdef ENABLE_STDIO
+  int n;
+
+  if (!tree) return;
+ again:
+  dump_prefix(offset);
+  n = (int)(intptr_t)tree->car;
+  tree = tree->cdr;
+  switch (n) {
+  case NODE_BEGIN:
+    printf("NODE_BEGIN:\n");
+    dump_recur(mrb, tree, offset+1);
+    break;
+
+  case NODE_RESCUE:
+    printf("NODE_RESCUE:\n");
+    if (tree->car) {
+      dump_prefix(offset+1);
+      printf("body:\n");
+      parser_dump(mrb, tree->car, offset+2);
+    }
+    tree = tree->cdr;
+    if (tree->car) {
+      node *n2 = tree->car;
+
+      dump_prefix(offset+1);
+      printf("rescue:\n");
+      while (n2) {
+	node *n3 = n2->car;
+	if (n3->car) {
+	  dump_prefix(offset+2);
+	  printf("handle classes:\n");
+	  dump_recur(mrb, n3->car, offset+3);
+	}
+	if (n3->cdr->car) {
+	  dump_prefix(offset+2);
+	  printf("exc_var:\n");
+	  parser_dump(mrb, n3->cdr->car, offset+3);
+	}
+	if (n3->cdr->cdr->car) {
+	  dump_prefix(offset+2);
+	  printf("rescue body:\n");
+	  parser_dump(mrb, n3->cdr->cdr->car, offset+3);
+	}
+	n2 = n2->cdr;
+      }
+    }
+    tree = tree->cdr;
+    if (tree->car) {
+      dump_prefix(offset+1);
+      printf("else:\n");
+      parser_dump(mrb, tree->car, offset+2);
+    }
+    break;
+
+  case NODE_ENSURE:
+    printf("NODE_ENSURE:\n");
+    dump_prefix(offset+1);
+    printf("body:\n");
+    parser_dump(mrb, tree->car, offset+2);
+    dump_prefix(offset+1);
+    printf("ensure:\n");
+    parser_dump(mrb, tree->cdr->cdr, offset+2);
+    break;
+
+  case NODE_LAMBDA:
+    printf("NODE_BLOCK:\n");
+    goto block;
+
+  case NODE_BLOCK:
+  block:
+    printf("NODE_BLOCK:\n");
+    tree = tree->cdr;
+    if (tree->car) {
+      node *n = tree->car;
+
+      if (n->car) {
+	dump_prefix(offset+1);
+	printf("mandatory args:\n");
+	dump_recur(mrb, n->car, offset+2);
+      }
+      n = n->cdr;
+      if (n->car) {
+	dump_prefix(offset+1);
+	printf("optional args:\n");
+	{
+	  node *n2 = n->car;
+
+	  while (n2) {
+	    dump_prefix(offset+2);
+	    printf("%s=", mrb_sym2name(mrb, sym(n2->car->car)));
+	    parser_dump(mrb, n2->car->cdr, 0);
+	    n2 = n2->cdr;
+	  }
+	}
+      }
+      n = n->cdr;
+      if (n->car) {
+	dump_prefix(offset+1);
+	printf("rest=*%s\n", mrb_sym2name(mrb, sym(n->car)));
+      }
+      n = n->cdr;
+      if (n->car) {
+	dump_prefix(offset+1);
+	printf("post mandatory args:\n");
+	dump_recur(mrb, n->car, offset+2);
+      }
+      n = n->cdr;
+      if (n) {
+	dump_prefix(offset+1);
+	printf("blk=&%s\n", mrb_sym2name(mrb, sym(n)));
+      }
+    }
+    dump_prefix(offset+1);
+    printf("body:\n");
+    parser_dump(mrb, tree->cdr->car, offset+2);
+    break;
+
+  case NODE_IF:
+    printf("NODE_IF:\n");
+    dump_prefix(offset+1);
+    printf("cond:\n");
+    parser_dump(mrb, tree->car, offset+2);
+    dump_prefix(offset+1);
+    printf("then:\n");
+    parser_dump(mrb, tree->cdr->car, offset+2);
+    if (tree->cdr->cdr->car) {
+      dump_prefix(offset+1);
+      printf("else:\n");
+      parser_dump(mrb, tree->cdr->cdr->car, offset+2);
+    }
+    break;
+
+  case NODE_AND:
+    printf("NODE_AND:\n");
+    parser_dump(mrb, tree->car, offset+1);
+    parser_dump(mrb, tree->cdr, offset+1);
+    break;
+
+  case NODE_OR:
+    printf("NODE_OR:\n");
+    parser_dump(mrb, tree->car, offset+1);
+    parser_dump(mrb, tree->cdr, offset+1);
+    break;
+
+  case NODE_CASE:
+    printf("NODE_CASE:\n");
+    if (tree->car) {
+      parser_dump(mrb, tree->car, offset+1);
+    }
+    tree = tree->cdr;
+    while (tree) {
+      dump_prefix(offset+1);
+      printf("case:\n");
+      dump_recur(mrb, tree->car->car, offset+2);
+      dump_prefix(offset+1);
+      printf("body:\n");
+      parser_dump(mrb, tree->car->cdr, offset+2);
+      tree = tree->cdr;
+    }
+    break;
+
+  case NODE_WHILE:
+    printf("NODE_WHILE:\n");
+    dump_prefix(offset+1);
+    printf("cond:\n");
+    parser_dump(mrb, tree->car, offset+2);
+    dump_prefix(offset+1);
+    printf("body:\n");
+    parser_dump(mrb, tree->cdr, offset+2);
+    break;
+
+  case NODE_UNTIL:
+    printf("NODE_UNTIL:\n");
+    dump_prefix(offset+1);
+    printf("cond:\n");
+    parser_dump(mrb, tree->car, offset+2);
+    dump_prefix(offset+1);
+    printf("body:\n");
+    parser_dump(mrb, tree->cdr, offset+2);
+    break;
+
+  case NODE_FOR:
+    printf("NODE_FOR:\n");
+    dump_prefix(offset+1);
+    printf("var:\n");
+    {
+      node *n2 = tree->car;
+
+      if (n2->car) {
+	dump_prefix(offset+2);
+	printf("pre:\n");
+	dump_recur(mrb, n2->car, offset+3);
+      }
+      n2 = n2->cdr;
+      if (n2) {
+	if (n2->car) {
+	  dump_prefix(offset+2);
+	  printf("rest:\n");
+	  parser_dump(mrb, n2->car, offset+3);
+	}
+	n2 = n2->cdr;
+	if (n2) {
+	  if (n2->car) {
+	    dump_prefix(offset+2);
+	    printf("post:\n");
+	    dump_recur(mrb, n2->car, offset+3);
+	  }
+	}
+      }
+    }
+    tree = tree->cdr;
+    dump_prefix(offset+1);
+    printf("in:\n");
+    parser_dump(mrb, tree->car, offset+2);
+    tree = tree->cdr;
+    dump_prefix(offset+1);
+    printf("do:\n");
+    parser_dump(mrb, tree->car, offset+2);
+    break;
+
+  case NODE_SCOPE:
+    printf("NODE_SCOPE:\n");
+    {
+      node *n2 = tree->car;
+
+      if (n2  && (n2->car || n2->cdr)) {
+	dump_prefix(offset+1);
+	printf("local variables:\n");
+	dump_prefix(offset+2);
+	while (n2) {
+	  if (n2->car) {
+	    if (n2 != tree->car) printf(", ");
+	    printf("%s", mrb_sym2name(mrb, sym(n2->car)));
+	  }
+	  n2 = n2->cdr;
+	}
+	printf("\n");
+      }
+    }
+    tree = tree->cdr;
+    offset++;
+    goto again;
+
+  case NODE_FCALL:
+  case NODE_CALL:
+    printf("NODE_CALL:\n");
+    parser_dump(mrb, tree->car, offset+1);
+    dump_prefix(offset+1);
+    printf("method='%s' (%d)\n", 
+    mrb_sym2name(mrb, sym(tree->cdr->car)),
+    (int)(intptr_t)tree->cdr->car);
+    tree = tree->cdr->cdr->car;
+    if (tree) {
+      dump_prefix(offset+1);
+      printf("args:\n");
+      dump_recur(mrb, tree->car, offset+2);
+      if (tree->cdr) {
+	dump_prefix(offset+1);
+	printf("block:\n");
+	parser_dump(mrb, tree->cdr, offset+2);
+      }
+    }
+    break;
+
+  case NODE_DOT2:
+    printf("NODE_DOT2:\n");
+    parser_dump(mrb, tree->car, offset+1);
+    parser_dump(mrb, tree->cdr, offset+1);
+    break;
+
+  case NODE_DOT3:
+    printf("NODE_DOT3:\n");
+    parser_dump(mrb, tree->car, offset+1);
+    parser_dump(mrb, tree->cdr, offset+1);
+    break;
+
+  case NODE_COLON2:
+    printf("NODE_COLON2:\n");
+    parser_dump(mrb, tree->car, offset+1);
+    dump_prefix(offset+1);
+    printf("::%s\n", mrb_sym2name(mrb, sym(tree->cdr)));
+    break;
+
+  case NODE_COLON3:
+    printf("NODE_COLON3:\n");
+    dump_prefix(offset+1);
+    printf("::%s\n", mrb_sym2name(mrb, sym(tree)));
+    break;
+
+  case NODE_ARRAY:
+    printf("NODE_ARRAY:\n");
+    dump_recur(mrb, tree, offset+1);
+    break;
+
+  case NODE_HASH:
+    printf("NODE_HASH:\n");
+    while (tree) {
+      dump_prefix(offset+1);
+      printf("key:\n");
+      parser_dump(mrb, tree->car->car, offset+2);
+      dump_prefix(offset+1);
+      printf("value:\n");
+      parser_dump(mrb, tree->car->cdr, offset+2);
+      tree = tree->cdr;
+    }
+    break;
+
+  case NODE_SPLAT:
+    printf("NODE_SPLAT:\n");
+    parser_dump(mrb, tree, offset+1);
+    break;
+
+  case NODE_ASGN:
+    printf("NODE_ASGN:\n");
+    dump_prefix(offset+1);
+    printf("lhs:\n");
+    parser_dump(mrb, tree->car, offset+2);
+    dump_prefix(offset+1);
+    printf("rhs:\n");
+    parser_dump(mrb, tree->cdr, offset+2);
+    break;
+
+  case NODE_MASGN:
+    printf("NODE_MASGN:\n");
+    dump_prefix(offset+1);
+    printf("mlhs:\n");
+    {
+      node *n2 = tree->car;
+
+      if (n2->car) {
+	dump_prefix(offset+2);
+	printf("pre:\n");
+	dump_recur(mrb, n2->car, offset+3);
+      }
+      n2 = n2->cdr;
+      if (n2) {
+	if (n2->car) {
+	  dump_prefix(offset+2);
+	  printf("rest:\n");
+	  if (n2->car == (node*)-1) {
+	    dump_prefix(offset+2);
+	    printf("(empty)\n");
+	  }
+	  else {
+	    parser_dump(mrb, n2->car, offset+3);
+	  }
+	}
+	n2 = n2->cdr;
+	if (n2) {
+	  if (n2->car) {
+	    dump_prefix(offset+2);
+	    printf("post:\n");
+	    dump_recur(mrb, n2->car, offset+3);
+	  }
+	}
+      }
+    }
+    dump_prefix(offset+1);
+    printf("rhs:\n");
+    parser_dump(mrb, tree->cdr, offset+2);
+    break;
+
+  case NODE_OP_ASGN:
+    printf("NODE_OP_ASGN:\n");
+    dump_prefix(offset+1);
+    printf("lhs:\n");
+    parser_dump(mrb, tree->car, offset+2);
+    tree = tree->cdr;
+    dump_prefix(offset+1);
+    printf("op='%s' (%d)\n", mrb_sym2name(mrb, sym(tree->car)), (int)(intptr_t)tree->car);
+    tree = tree->cdr;
+    parser_dump(mrb, tree->car, offset+1);
+    break;
+
+  case NODE_SUPER:
+    printf("NODE_SUPER:\n");
+    if (tree) {
+      dump_prefix(offset+1);
+      printf("args:\n");
+      dump_recur(mrb, tree->car, offset+2);
+      if (tree->cdr) {
+	dump_prefix(offset+1);
+	printf("block:\n");
+	parser_dump(mrb, tree->cdr, offset+2);
+      }
+    }
+    break;
+
+  case NODE_ZSUPER:
+    printf("NODE_ZSUPER\n");
+    break;
+
+  case NODE_RETURN:
+    printf("NODE_RETURN:\n");
+    parser_dump(mrb, tree, offset+1);
+    break;
+
+  case NODE_YIELD:
+    printf("NODE_YIELD:\n");
+    dump_recur(mrb, tree, offset+1);
+    break;
+
+  case NODE_BREAK:
+    printf("NODE_BREAK:\n");
+    parser_dump(mrb, tree, offset+1);
+    break;
+
+  case NODE_NEXT:
+    printf("NODE_NEXT:\n");
+    parser_dump(mrb, tree, offset+1);
+    break;
+
+  case NODE_REDO:
+    printf("NODE_REDO\n");
+    break;
+
+  case NODE_RETRY:
+    printf("NODE_RETRY\n");
+    break;
+
+  case NODE_LVAR:
+    printf("NODE_LVAR %s\n", mrb_sym2name(mrb, sym(tree)));
+    break;
+
+  case NODE_GVAR:
+    printf("NODE_GVAR %s\n", mrb_sym2name(mrb, sym(tree)));
+    break;
+
+  case NODE_IVAR:
+    printf("NODE_IVAR %s\n", mrb_sym2name(mrb, sym(tree)));
+    break;
+
+  case NODE_CVAR:
+    printf("NODE_CVAR %s\n", mrb_sym2name(mrb, sym(tree)));
+    break;
+
+  case NODE_CONST:
+    printf("NODE_CONST %s\n", mrb_sym2name(mrb, sym(tree)));
+    break;
+
+  case NODE_MATCH:
+    printf("NODE_MATCH:\n");
+    dump_prefix(offset + 1);
+    printf("lhs:\n");
+    parser_dump(mrb, tree->car, offset + 2);
+    dump_prefix(offset + 1);
+    printf("rhs:\n");
+    parser_dump(mrb, tree->cdr, offset + 2);
+    break;
+
+  case NODE_BACK_REF:
+    printf("NODE_BACK_REF: $%c\n", (int)(intptr_t)tree);
+    break;
+
+  case NODE_NTH_REF:
+    printf("NODE_NTH_REF: $%d\n", (int)(intptr_t)tree);
+    break;
+
+  case NODE_ARG:
+    printf("NODE_ARG %s\n", mrb_sym2name(mrb, sym(tree)));
+    break;
+
+  case NODE_BLOCK_ARG:
+    printf("NODE_BLOCK_ARG:\n");
+    parser_dump(mrb, tree, offset+1);
+    break;
+
+  case NODE_INT:
+    printf("NODE_INT %s base %d\n", (char*)tree->car, (int)(intptr_t)tree->cdr->car);
+    break;
+
+  case NODE_FLOAT:
+    printf("NODE_FLOAT %s\n", (char*)tree);
+    break;
+
+  case NODE_NEGATE:
+    printf("NODE_NEGATE\n");
+    parser_dump(mrb, tree, offset+1);
+    break;
+
+  case NODE_STR:
+    printf("NODE_STR \"%s\" len %d\n", (char*)tree->car, (int)(intptr_t)tree->cdr);
+    break;
+
+  case NODE_DSTR:
+    printf("NODE_DSTR\n");
+    dump_recur(mrb, tree, offset+1);
+    break;
+
+  case NODE_XSTR:
+    printf("NODE_XSTR \"%s\" len %d\n", (char*)tree->car, (int)(intptr_t)tree->cdr);
+    break;
+
+  case NODE_DXSTR:
+    printf("NODE_DXSTR\n");
+    dump_recur(mrb, tree, offset+1);
+    break;
+
+  case NODE_REGX:
+    printf("NODE_REGX /%s/%s\n", (char*)tree->car, (char*)tree->cdr);
+    break;
+
+  case NODE_DREGX:
+    printf("NODE_DREGX\n");
+    dump_recur(mrb, tree->car, offset+1);
+    dump_prefix(offset);
+    printf("tail: %s\n", (char*)tree->cdr->cdr->car);
+    dump_prefix(offset);
+    printf("opt: %s\n", (char*)tree->cdr->cdr->cdr);
+    break;
+
+  case NODE_SYM:
+    printf("NODE_SYM :%s\n", mrb_sym2name(mrb, sym(tree)));
+    break;
+
+  case NODE_SELF:
+    printf("NODE_SELF\n");
+    break;
+
+  case NODE_NIL:
+    printf("NODE_NIL\n");
+    break;
+
+  case NODE_TRUE:
+    printf("NODE_TRUE\n");
+    break;
+
+  case NODE_FALSE:
+    printf("NODE_FALSE\n");
+    break;
+
+  case NODE_ALIAS:
+    printf("NODE_ALIAS %s %s:\n",
+	    mrb_sym2name(mrb, sym(tree->car)),
+	    mrb_sym2name(mrb, sym(tree->cdr)));
+    break;
+
+  case NODE_UNDEF:
+    printf("NODE_UNDEF");
+    {
+      node *t = tree;
+      while (t) {
+	printf(" %s", mrb_sym2name(mrb, sym(t->car)));
+	t = t->cdr;
+      }
+    }
+    printf(":\n");
+    break;
+
+  case NODE_CLASS:
+    printf("NODE_CLASS:\n");
+    if (tree->car->car == (node*)0) {
+      dump_prefix(offset+1);
+      printf(":%s\n", mrb_sym2name(mrb, sym(tree->car->cdr)));
+    }
+    else if (tree->car->car == (node*)1) {
+      dump_prefix(offset+1);
+      printf("::%s\n", mrb_sym2name(mrb, sym(tree->car->cdr)));
+    }
+    else {
+      parser_dump(mrb, tree->car->car, offset+1);
+      dump_prefix(offset+1);
+      printf("::%s\n", mrb_sym2name(mrb, sym(tree->car->cdr)));
+    }
+    if (tree->cdr->car) {
+      dump_prefix(offset+1);
+      printf("super:\n");
+      parser_dump(mrb, tree->cdr->car, offset+2);
+    }
+    dump_prefix(offset+1);
+    printf("body:\n");
+    parser_dump(mrb, tree->cdr->cdr->car->cdr, offset+2);
+    break;
+
+  case NODE_MODULE:
+    printf("NODE_MODULE:\n");
+    if (tree->car->car == (node*)0) {
+      dump_prefix(offset+1);
+      printf(":%s\n", mrb_sym2name(mrb, sym(tree->car->cdr)));
+    }
+    else if (tree->car->car == (node*)1) {
+      dump_prefix(offset+1);
+      printf("::%s\n", mrb_sym2name(mrb, sym(tree->car->cdr)));
+    }
+    else {
+      parser_dump(mrb, tree->car->car, offset+1);
+      dump_prefix(offset+1);
+      printf("::%s\n", mrb_sym2name(mrb, sym(tree->car->cdr)));
+    }
+    dump_prefix(offset+1);
+    printf("body:\n");
+    parser_dump(mrb, tree->cdr->car->cdr, offset+2);
+    break;
+
+  case NODE_SCLASS:
+    printf("NODE_SCLASS:\n");
+    parser_dump(mrb, tree->car, offset+1);
+    dump_prefix(offset+1);
+    printf("body:\n");
+    parser_dump(mrb, tree->cdr->car->cdr, offset+2);
+    break;
+
+  case NODE_DEF:
+    printf("NODE_DEF:\n");
+    dump_prefix(offset+1);
+    printf("%s\n", mrb_sym2name(mrb, sym(tree->car)));
+    tree = tree->cdr;
+    {
+      node *n2 = tree->car;
+
+      if (n2 && (n2->car || n2->cdr)) {
+	dump_prefix(offset+1);
+	printf("local variables:\n");
+	dump_prefix(offset+2);
+	while (n2) {
+	  if (n2->car) {
+	    if (n2 != tree->car) printf(", ");
+	    printf("%s", mrb_sym2name(mrb, sym(n2->car)));
+	  }
+	  n2 = n2->cdr;
+	}
+	printf("\n");
+      }
+    }
+    tree = tree->cdr;
+    if (tree->car) {
+      node *n = tree->car;
+
+      if (n->car) {
+	dump_prefix(offset+1);
+	printf("mandatory args:\n");
+	dump_recur(mrb, n->car, offset+2);
+      }
+      n = n->cdr;
+      if (n->car) {
+	dump_prefix(offset+1);
+	printf("optional args:\n");
+	{
+	  node *n2 = n->car;
+
+	  while (n2) {
+	    dump_prefix(offset+2);
+	    printf("%s=", mrb_sym2name(mrb, sym(n2->car->car)));
+	    parser_dump(mrb, n2->car->cdr, 0);
+	    n2 = n2->cdr;
+	  }
+	}
+      }
+      n = n->cdr;
+      if (n->car) {
+	dump_prefix(offset+1);
+	printf("rest=*%s\n", mrb_sym2name(mrb, sym(n->car)));
+      }
+      n = n->cdr;
+      if (n->car) {
+	dump_prefix(offset+1);
+	printf("post mandatory args:\n");
+	dump_recur(mrb, n->car, offset+2);
+      }
+      n = n->cdr;
+      if (n) {
+	dump_prefix(offset+1);
+	printf("blk=&%s\n", mrb_sym2name(mrb, sym(n)));
+      }
+    }
+    parser_dump(mrb, tree->cdr->car, offset+1);
+    break;
+
+  case NODE_SDEF:
+    printf("NODE_SDEF:\n");
+    parser_dump(mrb, tree->car, offset+1);
+    tree = tree->cdr;
+    dump_prefix(offset+1);
+    printf(":%s\n", mrb_sym2name(mrb, sym(tree->car)));
+    tree = tree->cdr->cdr;
+    if (tree->car) {
+      node *n = tree->car;
+
+      if (n->car) {
+	dump_prefix(offset+1);
+	printf("mandatory args:\n");
+	dump_recur(mrb, n->car, offset+2);
+      }
+      n = n->cdr;
+      if (n->car) {
+	dump_prefix(offset+1);
+	printf("optional args:\n");
+	{
+	  node *n2 = n->car;
+
+	  while (n2) {
+	    dump_prefix(offset+2);
+	    printf("%s=", mrb_sym2name(mrb, sym(n2->car->car)));
+	    parser_dump(mrb, n2->car->cdr, 0);
+	    n2 = n2->cdr;
+	  }
+	}
+      }
+      n = n->cdr;
+      if (n->car) {
+	dump_prefix(offset+1);
+	printf("rest=*%s\n", mrb_sym2name(mrb, sym(n->car)));
+      }
+      n = n->cdr;
+      if (n->car) {
+	dump_prefix(offset+1);
+	printf("post mandatory args:\n");
+	dump_recur(mrb, n->car, offset+2);
+      }
+      n = n->cdr;
+      if (n) {
+	dump_prefix(offset+1);
+	printf("blk=&%s\n", mrb_sym2name(mrb, sym(n)));
+      }
+    }
+    tree = tree->cdr;
+    parser_dump(mrb, tree->car, offset+1);
+    break;
+
+  case NODE_POSTEXE:
+    printf("NODE_POSTEXE:\n");
+    parser_dump(mrb, tree, offset+1);
+    break;
+
+  case NODE_HEREDOC:
+    printf("NODE_HEREDOC:\n");
+    parser_dump(mrb, ((parser_heredoc_info*)tree)->doc, offset+1);
+    break;
+
+  default:
+    printf("node type: %d (0x%x)\n", (int)n, (int)n);
+    break;
+  }
+#endif
+}
@@ -0,0 +1,6387 @@
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/irep.h"
+#include "mruby/dump.h"
+#include "mruby/string.h"
+#include "mruby/proc.h"
+
+extern const uint8_t mrbtest_irep[];
+
+void mrbgemtest_init(mrb_state* mrb);
+
+void
+mrb_init_mrbtest(mrb_state *mrb)
+{
+  mrb_load_irep(mrb, mrbtest_irep);
+#ifndef DISABLE_GEMS
+  mrbgemtest_init(mrb);
+#endif
+  if (mrb->exc) {
+    mrb_p(mrb, mrb_obj_value(mrb->exc));
+    exit(EXIT_FAILURE);
+  }
+}
+
+#include <stdint.h>
+const uint8_t mrbtest_irep[] = {
+0x52,0x49,0x54,0x45,0x30,0x30,0x30,0x31,0x10,0xe9,0x00,0x01,0x8b,0x38,0x4d,0x41,
+0x54,0x5a,0x30,0x30,0x30,0x30,0x49,0x52,0x45,0x50,0x00,0x01,0x8b,0x1a,0x30,0x30,
+0x30,0x30,0x03,0x5c,0x00,0x00,0x00,0x00,0x53,0xcf,0x00,0x01,0x00,0x05,0x00,0x00,
+0x08,0xc8,0x00,0xbf,0xff,0x83,0x00,0x80,0x00,0x0a,0x00,0xbf,0xff,0x83,0x00,0x80,
+0x00,0x8a,0x00,0xbf,0xff,0x83,0x00,0x80,0x01,0x0a,0x00,0x80,0x40,0x37,0x00,0x80,
+0x01,0x8a,0x00,0x80,0x02,0x11,0x01,0x00,0x03,0x04,0x00,0x81,0x40,0xa0,0x00,0xc0,
+0x01,0x99,0x00,0x80,0x03,0x11,0x00,0x81,0xc0,0x20,0x00,0x80,0x04,0x0a,0x00,0x80,
+0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x82,0x40,0x46,0x00,0x80,0x00,0x48,0x01,0x00,
+0x06,0xc0,0x00,0x82,0x80,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x0a,0xc0,0x00,0x82,
+0xc0,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x0c,0xc0,0x00,0x83,0x00,0x46,0x00,0x80,
+0x00,0x48,0x01,0x00,0x0e,0xc0,0x00,0x83,0x40,0x46,0x00,0x80,0x00,0x48,0x01,0x00,
+0x10,0xc0,0x00,0x83,0x80,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x12,0xc0,0x00,0x83,
+0xc0,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x14,0xc0,0x00,0x84,0x00,0x46,0x00,0x80,
+0x00,0x48,0x01,0x00,0x18,0xc0,0x00,0x84,0x40,0x46,0x00,0x80,0x00,0x48,0x01,0x00,
+0x1c,0xc0,0x00,0x84,0x80,0x46,0x00,0x80,0x00,0x05,0x01,0x00,0x09,0x91,0x00,0x85,
+0x00,0x43,0x00,0x80,0x07,0xc5,0x00,0x80,0x00,0x48,0x01,0x00,0x22,0xc0,0x00,0x85,
+0x40,0x46,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x3d,0x01,0x80,0x00,0xbd,0x02,0x00,
+0x25,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x01,0x3d,0x01,0x80,
+0x01,0xbd,0x02,0x00,0x27,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0x02,0x3d,0x01,0x80,0x02,0xbd,0x02,0x00,0x29,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0x03,0x3d,0x01,0x80,0x03,0xbd,0x02,0x00,0x2b,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x04,0x3d,0x01,0x80,0x04,0xbd,0x02,0x00,
+0x2d,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x05,0x3d,0x01,0x80,
+0x05,0xbd,0x02,0x00,0x2f,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0x06,0x3d,0x01,0x80,0x06,0xbd,0x02,0x00,0x31,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0x07,0x3d,0x01,0x80,0x07,0xbd,0x02,0x00,0x33,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x08,0x3d,0x01,0x80,0x08,0xbd,0x02,0x00,
+0x35,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x09,0x3d,0x01,0x80,
+0x09,0xbd,0x02,0x00,0x37,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0x0a,0x3d,0x01,0x80,0x0a,0xbd,0x02,0x00,0x39,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0x0b,0x3d,0x01,0x80,0x0b,0xbd,0x02,0x00,0x3b,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x0c,0x3d,0x01,0x80,0x0c,0xbd,0x02,0x00,
+0x3f,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x0d,0x3d,0x01,0x80,
+0x0d,0xbd,0x02,0x00,0x41,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0x0e,0x3d,0x01,0x80,0x0e,0xbd,0x02,0x00,0x43,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0x0f,0x3d,0x01,0x80,0x0f,0xbd,0x02,0x00,0x47,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x10,0x3d,0x01,0x80,0x10,0xbd,0x02,0x00,
+0x4b,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x11,0x3d,0x01,0x80,
+0x11,0xbd,0x02,0x00,0x4d,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0x12,0x3d,0x01,0x80,0x12,0xbd,0x02,0x00,0x4f,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0x13,0x3d,0x01,0x80,0x13,0xbd,0x02,0x00,0x51,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x14,0x3d,0x01,0x80,0x14,0xbd,0x02,0x00,
+0x55,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x15,0x3d,0x01,0x80,
+0x15,0xbd,0x02,0x00,0x57,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0x16,0x3d,0x01,0x80,0x16,0xbd,0x02,0x00,0x59,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0x17,0x3d,0x01,0x80,0x17,0xbd,0x02,0x00,0x5b,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x18,0x3d,0x01,0x80,0x18,0xbd,0x02,0x00,
+0x5d,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x19,0x3d,0x01,0x80,
+0x19,0xbd,0x02,0x00,0x61,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0x1a,0x3d,0x01,0x80,0x1a,0xbd,0x02,0x00,0x63,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0x1b,0x3d,0x01,0x80,0x1b,0xbd,0x02,0x00,0x65,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x1c,0x3d,0x01,0x80,0x1c,0xbd,0x02,0x00,
+0x67,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x1d,0x3d,0x01,0x80,
+0x1d,0xbd,0x02,0x00,0x69,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0x1e,0x3d,0x01,0x80,0x1e,0xbd,0x02,0x00,0x6b,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0x1f,0x3d,0x01,0x80,0x1f,0xbd,0x02,0x00,0x6d,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x20,0x3d,0x01,0x80,0x20,0xbd,0x02,0x00,
+0x6f,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x21,0x3d,0x01,0x80,
+0x21,0xbd,0x02,0x00,0x71,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0x22,0x3d,0x01,0x80,0x22,0xbd,0x02,0x00,0x73,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0x23,0x3d,0x01,0x80,0x23,0xbd,0x02,0x00,0x75,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x24,0x3d,0x01,0x80,0x24,0xbd,0x02,0x00,
+0x77,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x25,0x3d,0x01,0x80,
+0x25,0xbd,0x02,0x00,0x79,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0x26,0x3d,0x01,0x80,0x26,0xbd,0x02,0x00,0x7b,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0x27,0x3d,0x01,0x80,0x27,0xbd,0x02,0x00,0x7d,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x28,0x3d,0x01,0x80,0x7f,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x28,0xbd,0x01,0x80,0x81,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x29,0x3d,0x01,0x80,0x83,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x29,0xbd,0x01,0x80,0x85,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x2a,0x3d,0x01,0x80,0x8b,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x2a,0xbd,0x01,0x80,0x8f,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x2a,0xbd,0x01,0x80,0x97,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x2b,0x3d,0x01,0x80,0x9b,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x2b,0xbd,0x01,0x80,0x9f,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x2c,0x3d,0x01,0x80,0xa3,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x2c,0xbd,0x01,0x80,0xa9,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x2d,0x3d,0x01,0x80,0xaf,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x2d,0xbd,0x01,0x80,0xb1,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x2e,0x3d,0x01,0x80,0xb5,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x2e,0xbd,0x01,0x80,0xbf,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x2f,0x3d,0x01,0x80,0xc7,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x2f,0xbd,0x01,0x80,0xcf,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x30,0x3d,0x01,0x80,0xdb,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x30,0xbd,0x01,0x80,0xe7,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x31,0x3d,0x01,0x80,0xed,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x31,0xbd,0x01,0x80,0xf3,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x32,0x3d,0x01,0x80,0xf9,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x32,0xbd,0x01,0x81,0x01,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x33,0x3d,0x01,0x81,0x07,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x33,0xbd,0x01,0x81,0x0d,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x34,0x3d,0x01,0x81,0x13,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x34,0xbd,0x01,0x81,0x19,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x35,0x3d,0x01,0x81,0x1f,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x35,0xbd,0x01,0x81,0x25,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x36,0x3d,0x01,0x81,0x2d,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x36,0xbd,0x01,0x81,0x35,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x37,0x3d,0x01,0x81,0x3b,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x37,0xbd,0x01,0x81,0x3f,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x38,0x3d,0x01,0x81,0x45,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x38,0xbd,0x01,0x81,0x4b,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x39,0x3d,0x01,0x81,0x51,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x39,0xbd,0x01,0x81,0x57,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x3a,0x3d,0x01,0x81,0x5d,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x3a,0xbd,0x01,0x81,0x63,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x3b,0x3d,0x01,0x81,0x69,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x3b,0xbd,0x01,0x81,0x6d,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x3c,0x3d,0x01,0x81,0x85,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x3c,0xbd,0x01,0x81,0x8f,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x3d,0x3d,0x01,0x81,0x97,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x3d,0xbd,0x01,0x81,0x9f,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x3e,0x3d,0x01,0x81,0xa1,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x3e,0xbd,0x01,0x81,0xa3,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x3f,0x3d,0x01,0x81,0xa5,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x3f,0xbd,0x01,0x81,0xa7,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x40,0x3d,0x01,0x81,0xa9,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x40,0xbd,0x01,0x81,0xab,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x41,0x3d,0x01,0x81,0xad,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x41,0xbd,0x01,0x81,0xaf,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x42,0x3d,0x01,0x80,0x42,0xbd,0x02,0x01,
+0xb1,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x43,0x3d,0x01,0x80,
+0x43,0xbd,0x02,0x01,0xb3,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0x44,0x3d,0x01,0x80,0x44,0xbd,0x02,0x01,0xb5,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0x45,0x3d,0x01,0x80,0x45,0xbd,0x02,0x01,0xbd,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x46,0x3d,0x01,0x80,0x46,0xbd,0x02,0x01,
+0xc5,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x47,0x3d,0x01,0x81,
+0xc9,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x47,0xbd,0x01,0x81,
+0xcd,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x48,0x3d,0x01,0x81,
+0xd1,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x48,0xbd,0x01,0x81,
+0xd5,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x49,0x3d,0x01,0x81,
+0xdb,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x49,0xbd,0x01,0x81,
+0xe1,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x4a,0x3d,0x01,0x81,
+0xe7,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x4a,0xbd,0x01,0x81,
+0xf1,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x4b,0x3d,0x01,0x81,
+0xf9,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x4b,0xbd,0x01,0x81,
+0xfd,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x4c,0x3d,0x01,0x82,
+0x01,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x4c,0xbd,0x01,0x82,
+0x07,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x4d,0x3d,0x01,0x82,
+0x0d,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x4d,0xbd,0x01,0x82,
+0x13,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x4e,0x3d,0x01,0x82,
+0x19,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x4e,0xbd,0x01,0x82,
+0x21,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x4f,0x3d,0x01,0x82,
+0x29,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x4f,0xbd,0x01,0x82,
+0x31,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x50,0x3d,0x01,0x82,
+0x39,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x50,0xbd,0x01,0x82,
+0x41,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x51,0x3d,0x01,0x82,
+0x45,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x51,0xbd,0x01,0x82,
+0x4b,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x52,0x3d,0x01,0x82,
+0x51,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x52,0xbd,0x01,0x82,
+0x55,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x53,0x3d,0x01,0x82,
+0x59,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x53,0xbd,0x01,0x82,
+0x5f,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x54,0x3d,0x01,0x82,
+0x67,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x54,0xbd,0x01,0x82,
+0x6f,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x55,0x3d,0x01,0x80,
+0x55,0xbd,0x02,0x02,0x77,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0x56,0x3d,0x01,0x80,0x56,0xbd,0x02,0x02,0x7d,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0x57,0x3d,0x01,0x80,0x57,0xbd,0x02,0x02,0x83,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x58,0x3d,0x01,0x80,0x58,0xbd,0x02,0x02,
+0x89,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x59,0x3d,0x01,0x80,
+0x59,0xbd,0x02,0x02,0x8f,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0x5a,0x3d,0x01,0x80,0x5a,0xbd,0x02,0x02,0x95,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0x5b,0x3d,0x01,0x80,0x5b,0xbd,0x02,0x02,0x9b,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x5c,0x3d,0x01,0x80,0x5c,0xbd,0x02,0x02,
+0x9d,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x5d,0x3d,0x01,0x80,
+0x5d,0xbd,0x02,0x02,0x9f,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0x5e,0x3d,0x01,0x80,0x5e,0xbd,0x02,0x02,0xa1,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0x5f,0x3d,0x01,0x80,0x5f,0xbd,0x02,0x02,0xa5,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x60,0x3d,0x01,0x80,0x60,0xbd,0x02,0x02,
+0xab,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x61,0x3d,0x01,0x80,
+0x61,0xbd,0x02,0x02,0xaf,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0x62,0x3d,0x01,0x80,0x62,0xbd,0x02,0x02,0xb1,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0x63,0x3d,0x01,0x80,0x63,0xbd,0x02,0x02,0xb7,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x64,0x3d,0x01,0x80,0x64,0xbd,0x02,0x02,
+0xbb,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x65,0x3d,0x01,0x80,
+0x65,0xbd,0x02,0x02,0xbd,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0x66,0x3d,0x01,0x80,0x66,0xbd,0x02,0x02,0xbf,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0x67,0x3d,0x01,0x80,0x67,0xbd,0x02,0x02,0xc5,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x68,0x3d,0x01,0x80,0x68,0xbd,0x02,0x02,
+0xc9,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x69,0x3d,0x01,0x80,
+0x69,0xbd,0x02,0x02,0xcd,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0x6a,0x3d,0x01,0x80,0x6a,0xbd,0x02,0x02,0xd1,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0x6b,0x3d,0x01,0x80,0x6b,0xbd,0x02,0x02,0xd3,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x6c,0x3d,0x01,0x80,0x6c,0xbd,0x02,0x02,
+0xd7,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x6d,0x3d,0x01,0x80,
+0x6d,0xbd,0x02,0x02,0xdb,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0x6e,0x3d,0x01,0x80,0x6e,0xbd,0x02,0x02,0xdf,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0x6f,0x3d,0x01,0x80,0x6f,0xbd,0x02,0x02,0xe3,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x70,0x3d,0x01,0x80,0x70,0xbd,0x02,0x02,
+0xe5,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x71,0x3d,0x01,0x80,
+0x71,0xbd,0x02,0x02,0xe7,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0x72,0x3d,0x01,0x80,0x72,0xbd,0x02,0x02,0xe9,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0x73,0x3d,0x01,0x80,0x73,0xbd,0x02,0x02,0xeb,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x74,0x3d,0x01,0x80,0x74,0xbd,0x02,0x02,
+0xed,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x75,0x3d,0x01,0x80,
+0x75,0xbd,0x02,0x02,0xef,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0x72,0x3d,0x01,0x80,0x72,0xbd,0x02,0x02,0xf1,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0x76,0x3d,0x01,0x80,0x76,0xbd,0x02,0x02,0xf3,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x77,0x3d,0x01,0x80,0x77,0xbd,0x02,0x02,
+0xf5,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x78,0x3d,0x01,0x82,
+0xf7,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x78,0xbd,0x01,0x82,
+0xfb,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x79,0x3d,0x01,0x83,
+0x01,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x79,0xbd,0x01,0x83,
+0x09,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x7a,0x3d,0x01,0x83,
+0x0d,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x7a,0xbd,0x01,0x83,
+0x17,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x7b,0x3d,0x01,0x83,
+0x23,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x7b,0xbd,0x01,0x83,
+0x2b,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x7c,0x3d,0x01,0x83,
+0x2d,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x7c,0xbd,0x01,0x83,
+0x31,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x7d,0x3d,0x01,0x83,
+0x35,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x7d,0xbd,0x01,0x83,
+0x37,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x7e,0x3d,0x01,0x83,
+0x39,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x48,0x01,0x03,0x3a,0xc0,0x00,0x85,
+0x80,0x46,0x00,0x80,0x00,0x06,0x01,0x00,0x7e,0xbd,0x01,0x83,0x3d,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x7f,0x3d,0x01,0x83,0x3f,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x7f,0xbd,0x01,0x83,0x41,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x80,0x3d,0x01,0x83,0x43,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x80,0xbd,0x01,0x83,0x47,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x81,0x3d,0x01,0x83,0x4b,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x81,0xbd,0x01,0x83,0x57,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x82,0x3d,0x01,0x80,0x82,0xbd,0x02,0x03,
+0x59,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x83,0x3d,0x01,0x80,
+0x83,0xbd,0x02,0x03,0x5b,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0x84,0x3d,0x01,0x80,0x84,0xbd,0x02,0x03,0x5d,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0x85,0x3d,0x01,0x80,0x85,0xbd,0x02,0x03,0x5f,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x86,0x3d,0x01,0x80,0x86,0xbd,0x02,0x03,
+0x61,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x87,0x3d,0x01,0x80,
+0x87,0xbd,0x02,0x03,0x63,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0x88,0x3d,0x01,0x80,0x88,0xbd,0x02,0x03,0x65,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0x89,0x3d,0x01,0x80,0x89,0xbd,0x02,0x03,0x67,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x8a,0x3d,0x01,0x80,0x8a,0xbd,0x02,0x03,
+0x69,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x8b,0x3d,0x01,0x80,
+0x8b,0xbd,0x02,0x03,0x6b,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0x8c,0x3d,0x01,0x80,0x8c,0xbd,0x02,0x03,0x6d,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0x8d,0x3d,0x01,0x80,0x8d,0xbd,0x02,0x03,0x6f,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x8e,0x3d,0x01,0x80,0x8e,0xbd,0x02,0x03,
+0x71,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x8f,0x3d,0x01,0x80,
+0x8f,0xbd,0x02,0x03,0x73,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0x90,0x3d,0x01,0x80,0x90,0xbd,0x02,0x03,0x75,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0x91,0x3d,0x01,0x80,0x91,0xbd,0x02,0x03,0x77,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x92,0x3d,0x01,0x80,0x92,0xbd,0x02,0x03,
+0x79,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x93,0x3d,0x01,0x80,
+0x93,0xbd,0x02,0x03,0x7b,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0x94,0x3d,0x01,0x80,0x94,0xbd,0x02,0x03,0x7d,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0x95,0x3d,0x01,0x80,0x95,0xbd,0x02,0x03,0x7f,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x96,0x3d,0x01,0x80,0x96,0xbd,0x02,0x03,
+0x81,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x97,0x3d,0x01,0x80,
+0x97,0xbd,0x02,0x03,0x83,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0x98,0x3d,0x01,0x80,0x98,0xbd,0x02,0x03,0x85,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0x99,0x3d,0x01,0x80,0x99,0xbd,0x02,0x03,0x87,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x9a,0x3d,0x01,0x83,0x89,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x9a,0xbd,0x01,0x83,0x8b,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x9b,0x3d,0x01,0x83,0x8f,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x9b,0xbd,0x01,0x83,0x93,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x9c,0x3d,0x01,0x83,0x97,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0x9c,0xbd,0x01,0x80,0x9d,0x3d,0x02,0x03,
+0x9b,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0x9d,0xbd,0x01,0x80,
+0x9e,0x3d,0x02,0x03,0x9d,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0x9e,0xbd,0x01,0x80,0x9f,0x3d,0x02,0x03,0x9f,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0x9f,0xbd,0x01,0x80,0xa0,0x3d,0x02,0x03,0xa1,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xa0,0xbd,0x01,0x80,0xa1,0x3d,0x02,0x03,
+0xa3,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xa1,0xbd,0x01,0x80,
+0xa2,0x3d,0x02,0x03,0xa5,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0xa2,0xbd,0x01,0x80,0xa3,0x3d,0x02,0x03,0xa7,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0xa3,0xbd,0x01,0x80,0xa4,0x3d,0x02,0x03,0xab,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xa4,0xbd,0x01,0x80,0xa5,0x3d,0x02,0x03,
+0xad,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xa5,0xbd,0x01,0x80,
+0xa6,0x3d,0x02,0x03,0xb1,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0xa6,0xbd,0x01,0x80,0xa7,0x3d,0x02,0x03,0xb7,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0xa7,0xbd,0x01,0x80,0xa8,0x3d,0x02,0x03,0xbb,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xa8,0xbd,0x01,0x80,0xa9,0x3d,0x02,0x03,
+0xbf,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xa9,0xbd,0x01,0x80,
+0xaa,0x3d,0x02,0x03,0xc3,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0xaa,0xbd,0x01,0x80,0xab,0x3d,0x02,0x03,0xc5,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0xab,0xbd,0x01,0x80,0xac,0x3d,0x02,0x03,0xc7,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xac,0xbd,0x01,0x80,0xad,0x3d,0x02,0x03,
+0xc9,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xad,0xbd,0x01,0x80,
+0xae,0x3d,0x02,0x03,0xcb,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0xae,0xbd,0x01,0x80,0xaf,0x3d,0x02,0x03,0xcd,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0xaf,0xbd,0x01,0x80,0xb0,0x3d,0x02,0x03,0xcf,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xb0,0xbd,0x01,0x80,0xb1,0x3d,0x02,0x03,
+0xd1,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xb1,0xbd,0x01,0x80,
+0xb2,0x3d,0x02,0x03,0xd3,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0xb2,0xbd,0x01,0x80,0xb3,0x3d,0x02,0x03,0xd5,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0xb3,0xbd,0x01,0x80,0xb4,0x3d,0x02,0x03,0xd7,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xb4,0xbd,0x01,0x80,0xb5,0x3d,0x02,0x03,
+0xdb,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xb5,0xbd,0x01,0x80,
+0xb6,0x3d,0x02,0x03,0xdd,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0xb6,0xbd,0x01,0x80,0xb7,0x3d,0x02,0x03,0xdf,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0xb7,0xbd,0x01,0x80,0xb8,0x3d,0x02,0x03,0xe1,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xb8,0xbd,0x01,0x80,0xb9,0x3d,0x02,0x03,
+0xe3,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xb9,0xbd,0x01,0x80,
+0xba,0x3d,0x02,0x03,0xe5,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0xba,0xbd,0x01,0x83,0xe7,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,
+0xbb,0x3d,0x01,0x83,0xeb,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,
+0xbb,0xbd,0x01,0x83,0xef,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,
+0xbc,0x3d,0x01,0x83,0xf3,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,
+0xbc,0xbd,0x01,0x80,0xbd,0x3d,0x02,0x03,0xf7,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0xbd,0xbd,0x01,0x80,0xbe,0x3d,0x02,0x03,0xf9,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xbe,0xbd,0x01,0x80,0xbf,0x3d,0x02,0x03,
+0xfb,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xbf,0xbd,0x01,0x80,
+0xc0,0x3d,0x02,0x03,0xfd,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0xc0,0xbd,0x01,0x80,0xc1,0x3d,0x02,0x03,0xff,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0xc1,0xbd,0x01,0x80,0xc2,0x3d,0x02,0x04,0x01,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xc2,0xbd,0x01,0x80,0xc3,0x3d,0x02,0x04,
+0x03,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xc3,0xbd,0x01,0x80,
+0xc4,0x3d,0x02,0x04,0x05,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0xc4,0xbd,0x01,0x80,0xc5,0x3d,0x02,0x04,0x07,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0xc5,0xbd,0x01,0x80,0xc6,0x3d,0x02,0x04,0x09,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xc6,0xbd,0x01,0x80,0xc7,0x3d,0x02,0x04,
+0x0b,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xc7,0xbd,0x01,0x80,
+0xc8,0x3d,0x02,0x04,0x0d,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0xc8,0xbd,0x01,0x80,0xc9,0x3d,0x02,0x04,0x0f,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0xc9,0xbd,0x01,0x80,0xca,0x3d,0x02,0x04,0x11,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xca,0xbd,0x01,0x80,0xcb,0x3d,0x02,0x04,
+0x13,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xcb,0xbd,0x01,0x80,
+0xcc,0x3d,0x02,0x04,0x15,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0xcc,0xbd,0x01,0x80,0xcd,0x3d,0x02,0x04,0x17,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0xcd,0xbd,0x01,0x80,0xce,0x3d,0x02,0x04,0x19,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xce,0xbd,0x01,0x80,0xcf,0x3d,0x02,0x04,
+0x1b,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xcf,0xbd,0x01,0x80,
+0xd0,0x3d,0x02,0x04,0x1f,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0xd0,0xbd,0x01,0x80,0xd1,0x3d,0x02,0x04,0x21,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0xd1,0xbd,0x01,0x80,0xd2,0x3d,0x02,0x04,0x23,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xd2,0xbd,0x01,0x80,0xd3,0x3d,0x02,0x04,
+0x25,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xd3,0xbd,0x01,0x80,
+0xd4,0x3d,0x02,0x04,0x27,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0xd4,0xbd,0x01,0x80,0xd5,0x3d,0x02,0x04,0x29,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0xd5,0xbd,0x01,0x80,0xd6,0x3d,0x02,0x04,0x2d,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xd6,0xbd,0x01,0x80,0xd7,0x3d,0x02,0x04,
+0x2f,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xd7,0xbd,0x01,0x80,
+0xd8,0x3d,0x02,0x04,0x31,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0xd8,0xbd,0x01,0x80,0xd9,0x3d,0x02,0x04,0x33,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0xd9,0xbd,0x01,0x80,0xda,0x3d,0x02,0x04,0x35,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xda,0xbd,0x01,0x84,0x39,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x00,0xdb,0x3d,0x01,0x80,0xdb,0xbd,0x02,0x04,
+0x3f,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xdc,0x3d,0x01,0x80,
+0xdc,0xbd,0x02,0x04,0x41,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0xdd,0x3d,0x01,0x80,0xdd,0xbd,0x02,0x04,0x49,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0xde,0x3d,0x01,0x80,0xde,0xbd,0x02,0x04,0x4b,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xdf,0x3d,0x01,0x80,0xdf,0xbd,0x02,0x04,
+0x4d,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xe0,0x3d,0x01,0x80,
+0xe0,0xbd,0x02,0x04,0x51,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0xe1,0x3d,0x01,0x80,0xe1,0xbd,0x02,0x04,0x55,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0xe2,0x3d,0x01,0x80,0xe2,0xbd,0x02,0x04,0x57,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xe3,0x3d,0x01,0x80,0xe3,0xbd,0x02,0x04,
+0x59,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xe4,0x3d,0x01,0x80,
+0xe4,0xbd,0x02,0x04,0x5b,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0xe5,0x3d,0x01,0x80,0xe5,0xbd,0x02,0x04,0x5d,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0xe6,0x3d,0x01,0x80,0xe6,0xbd,0x02,0x04,0x5f,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xe7,0x3d,0x01,0x80,0xe7,0xbd,0x02,0x04,
+0x63,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xe8,0x3d,0x01,0x80,
+0xe8,0xbd,0x02,0x04,0x6b,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0xe9,0x3d,0x01,0x80,0xe9,0xbd,0x02,0x04,0x6d,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0xea,0x3d,0x01,0x80,0xea,0xbd,0x02,0x04,0x7b,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xeb,0x3d,0x01,0x80,0xeb,0xbd,0x02,0x04,
+0x89,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xec,0x3d,0x01,0x80,
+0xeb,0xbd,0x02,0x04,0x91,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0xec,0xbd,0x01,0x80,0xed,0x3d,0x02,0x04,0x97,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0xed,0xbd,0x01,0x80,0xee,0x3d,0x02,0x04,0x99,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xee,0xbd,0x01,0x80,0xef,0x3d,0x02,0x04,
+0x9b,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xef,0xbd,0x01,0x80,
+0xf0,0x3d,0x02,0x04,0x9d,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0xf0,0xbd,0x01,0x80,0xf1,0x3d,0x02,0x04,0xa1,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0xf1,0xbd,0x01,0x80,0xf2,0x3d,0x02,0x04,0xa3,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xf2,0xbd,0x01,0x80,0xf3,0x3d,0x02,0x04,
+0xa5,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xf3,0xbd,0x01,0x80,
+0xf4,0x3d,0x02,0x04,0xa7,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0xf4,0xbd,0x01,0x80,0xf5,0x3d,0x02,0x04,0xab,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0xf5,0xbd,0x01,0x80,0xf6,0x3d,0x02,0x04,0xaf,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xf6,0xbd,0x01,0x80,0xf7,0x3d,0x02,0x04,
+0xb1,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xf7,0xbd,0x01,0x80,
+0xf8,0x3d,0x02,0x04,0xb3,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0xf8,0xbd,0x01,0x80,0xf9,0x3d,0x02,0x04,0xb5,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0xf9,0xbd,0x01,0x80,0xfa,0x3d,0x02,0x04,0xb7,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xfa,0xbd,0x01,0x80,0xfb,0x3d,0x02,0x04,
+0xb9,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xfb,0xbd,0x01,0x80,
+0xfc,0x3d,0x02,0x04,0xbb,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,
+0xfc,0xbd,0x01,0x80,0xfd,0x3d,0x02,0x04,0xbd,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x00,0xfd,0xbd,0x01,0x80,0xfe,0x3d,0x02,0x04,0xc3,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xfe,0xbd,0x01,0x80,0xff,0x3d,0x02,0x04,
+0xc7,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x00,0xff,0xbd,0x01,0x81,
+0x00,0x3d,0x02,0x04,0xc9,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x00,0xbd,0x01,0x84,0xcb,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x01,
+0x01,0x3d,0x01,0x81,0x01,0xbd,0x02,0x04,0xcd,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x02,0x3d,0x01,0x81,0x02,0xbd,0x02,0x04,0xcf,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x03,0x3d,0x01,0x81,0x03,0xbd,0x02,0x04,
+0xd1,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x04,0x3d,0x01,0x81,
+0x04,0xbd,0x02,0x04,0xd3,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x05,0x3d,0x01,0x81,0x05,0xbd,0x02,0x04,0xd5,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x06,0x3d,0x01,0x81,0x06,0xbd,0x02,0x04,0xd7,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x07,0x3d,0x01,0x81,0x07,0xbd,0x02,0x04,
+0xd9,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x08,0x3d,0x01,0x84,
+0xdb,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x01,0x08,0xbd,0x01,0x81,
+0x09,0x3d,0x02,0x04,0xdd,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x09,0xbd,0x01,0x81,0x0a,0x3d,0x02,0x04,0xdf,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x0a,0xbd,0x01,0x81,0x0b,0x3d,0x02,0x04,0xe1,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x0b,0xbd,0x01,0x81,0x0c,0x3d,0x02,0x04,
+0xe3,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x0c,0xbd,0x01,0x81,
+0x0d,0x3d,0x02,0x04,0xe5,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x0d,0xbd,0x01,0x81,0x0e,0x3d,0x02,0x04,0xe7,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x0e,0xbd,0x01,0x81,0x0f,0x3d,0x02,0x04,0xef,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x0f,0xbd,0x01,0x81,0x10,0x3d,0x02,0x04,
+0xfb,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x10,0xbd,0x01,0x81,
+0x11,0x3d,0x02,0x04,0xff,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x11,0xbd,0x01,0x81,0x12,0x3d,0x02,0x05,0x03,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x12,0xbd,0x01,0x81,0x13,0x3d,0x02,0x05,0x09,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x13,0xbd,0x01,0x81,0x14,0x3d,0x02,0x05,
+0x0f,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x14,0xbd,0x01,0x81,
+0x15,0x3d,0x02,0x05,0x13,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x15,0xbd,0x01,0x81,0x16,0x3d,0x02,0x05,0x17,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x14,0xbd,0x01,0x81,0x16,0xbd,0x02,0x05,0x1d,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x17,0x3d,0x01,0x81,0x17,0xbd,0x02,0x05,
+0x21,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x18,0x3d,0x01,0x81,
+0x18,0xbd,0x02,0x05,0x27,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x19,0x3d,0x01,0x81,0x19,0xbd,0x02,0x05,0x2d,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x1a,0x3d,0x01,0x81,0x1a,0xbd,0x02,0x05,0x35,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x1b,0x3d,0x01,0x81,0x1b,0xbd,0x02,0x05,
+0x3d,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x1c,0x3d,0x01,0x81,
+0x1c,0xbd,0x02,0x05,0x43,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x1d,0x3d,0x01,0x81,0x1d,0xbd,0x02,0x05,0x51,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x1e,0x3d,0x01,0x81,0x1e,0xbd,0x02,0x05,0x61,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x1f,0x3d,0x01,0x81,0x1f,0xbd,0x02,0x05,
+0x69,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x20,0x3d,0x01,0x81,
+0x20,0xbd,0x02,0x05,0x6d,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x21,0x3d,0x01,0x81,0x21,0xbd,0x02,0x05,0x75,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x22,0x3d,0x01,0x81,0x22,0xbd,0x02,0x05,0x83,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x23,0x3d,0x01,0x85,0x93,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x01,0x23,0xbd,0x01,0x85,0x97,0x40,0x00,0x82,
+0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x01,0x24,0x3d,0x01,0x81,0x24,0xbd,0x02,0x05,
+0x9b,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x25,0x3d,0x01,0x81,
+0x25,0xbd,0x02,0x05,0x9d,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x26,0x3d,0x01,0x81,0x26,0xbd,0x02,0x05,0x9f,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x27,0x3d,0x01,0x81,0x27,0xbd,0x02,0x05,0xa3,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x28,0x3d,0x01,0x81,0x28,0xbd,0x02,0x05,
+0xa5,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x29,0x3d,0x01,0x81,
+0x29,0xbd,0x02,0x05,0xa7,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x2a,0x3d,0x01,0x81,0x2a,0xbd,0x02,0x05,0xa9,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x2b,0x3d,0x01,0x81,0x2b,0xbd,0x02,0x05,0xab,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x2c,0x3d,0x01,0x81,0x2c,0xbd,0x02,0x05,
+0xad,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x2d,0x3d,0x01,0x81,
+0x2d,0xbd,0x02,0x05,0xaf,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x2e,0x3d,0x01,0x81,0x2e,0xbd,0x02,0x05,0xb1,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x2f,0x3d,0x01,0x81,0x2f,0xbd,0x02,0x05,0xb3,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x30,0x3d,0x01,0x81,0x30,0xbd,0x02,0x05,
+0xb5,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x31,0x3d,0x01,0x81,
+0x31,0xbd,0x02,0x05,0xb7,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x32,0x3d,0x01,0x81,0x32,0xbd,0x02,0x05,0xb9,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x33,0x3d,0x01,0x81,0x33,0xbd,0x02,0x05,0xbb,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x34,0x3d,0x01,0x81,0x34,0xbd,0x02,0x05,
+0xbd,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x35,0x3d,0x01,0x85,
+0xbf,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x01,0x35,0xbd,0x01,0x81,
+0x36,0x3d,0x02,0x05,0xc1,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x36,0xbd,0x01,0x81,0x37,0x3d,0x02,0x05,0xc3,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x37,0xbd,0x01,0x81,0x38,0x3d,0x02,0x05,0xc5,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x38,0xbd,0x01,0x81,0x39,0x3d,0x02,0x05,
+0xc7,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x39,0xbd,0x01,0x81,
+0x3a,0x3d,0x02,0x05,0xc9,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x3a,0xbd,0x01,0x81,0x3b,0x3d,0x02,0x05,0xcd,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x3b,0xbd,0x01,0x81,0x3c,0x3d,0x02,0x05,0xd3,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x3c,0xbd,0x01,0x81,0x3d,0x3d,0x02,0x05,
+0xdd,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x3d,0xbd,0x01,0x81,
+0x3e,0x3d,0x02,0x05,0xe3,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x3e,0xbd,0x01,0x81,0x3f,0x3d,0x02,0x05,0xe5,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x3f,0xbd,0x01,0x81,0x40,0x3d,0x02,0x05,0xe7,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x40,0xbd,0x01,0x81,0x41,0x3d,0x02,0x05,
+0xe9,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x41,0xbd,0x01,0x81,
+0x42,0x3d,0x02,0x05,0xeb,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x42,0xbd,0x01,0x81,0x43,0x3d,0x02,0x05,0xed,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x43,0xbd,0x01,0x81,0x44,0x3d,0x02,0x05,0xf1,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x44,0xbd,0x01,0x81,0x45,0x3d,0x02,0x05,
+0xf3,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x45,0xbd,0x01,0x81,
+0x46,0x3d,0x02,0x05,0xf5,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x46,0xbd,0x01,0x81,0x47,0x3d,0x02,0x05,0xf7,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x47,0xbd,0x01,0x81,0x48,0x3d,0x02,0x05,0xf9,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x48,0xbd,0x01,0x81,0x49,0x3d,0x02,0x05,
+0xfb,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x49,0xbd,0x01,0x81,
+0x4a,0x3d,0x02,0x05,0xfd,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x4a,0xbd,0x01,0x81,0x4b,0x3d,0x02,0x05,0xff,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x4b,0xbd,0x01,0x81,0x4c,0x3d,0x02,0x06,0x01,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x4c,0xbd,0x01,0x81,0x4d,0x3d,0x02,0x06,
+0x03,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x4d,0xbd,0x01,0x81,
+0x4e,0x3d,0x02,0x06,0x05,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x4e,0xbd,0x01,0x81,0x4f,0x3d,0x02,0x06,0x07,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x4f,0xbd,0x01,0x81,0x50,0x3d,0x02,0x06,0x09,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x50,0xbd,0x01,0x81,0x51,0x3d,0x02,0x06,
+0x0b,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x51,0xbd,0x01,0x81,
+0x52,0x3d,0x02,0x06,0x0d,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x52,0xbd,0x01,0x81,0x53,0x3d,0x02,0x06,0x0f,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x53,0xbd,0x01,0x81,0x54,0x3d,0x02,0x06,0x11,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x54,0xbd,0x01,0x81,0x55,0x3d,0x02,0x06,
+0x13,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x55,0xbd,0x01,0x81,
+0x56,0x3d,0x02,0x06,0x15,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x56,0xbd,0x01,0x86,0x17,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x01,
+0x57,0x3d,0x01,0x81,0x57,0xbd,0x02,0x06,0x19,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x58,0x3d,0x01,0x81,0x58,0xbd,0x02,0x06,0x1b,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x59,0x3d,0x01,0x81,0x59,0xbd,0x02,0x06,
+0x1d,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x5a,0x3d,0x01,0x81,
+0x5a,0xbd,0x02,0x06,0x1f,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x5b,0x3d,0x01,0x81,0x5b,0xbd,0x02,0x06,0x21,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x5c,0x3d,0x01,0x81,0x5c,0xbd,0x02,0x06,0x23,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x5d,0x3d,0x01,0x81,0x5d,0xbd,0x02,0x06,
+0x25,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x5e,0x3d,0x01,0x81,
+0x5e,0xbd,0x02,0x06,0x27,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x5f,0x3d,0x01,0x81,0x5f,0xbd,0x02,0x06,0x29,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x60,0x3d,0x01,0x81,0x60,0xbd,0x02,0x06,0x2d,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x61,0x3d,0x01,0x81,0x61,0xbd,0x02,0x06,
+0x2f,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x62,0x3d,0x01,0x81,
+0x62,0xbd,0x02,0x06,0x31,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x63,0x3d,0x01,0x81,0x63,0xbd,0x02,0x06,0x3b,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x64,0x3d,0x01,0x81,0x64,0xbd,0x02,0x06,0x3f,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x65,0x3d,0x01,0x81,0x65,0xbd,0x02,0x06,
+0x41,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x66,0x3d,0x01,0x81,
+0x66,0xbd,0x02,0x06,0x43,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x67,0x3d,0x01,0x81,0x67,0xbd,0x02,0x06,0x45,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x68,0x3d,0x01,0x81,0x68,0xbd,0x02,0x06,0x47,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x69,0x3d,0x01,0x81,0x69,0xbd,0x02,0x06,
+0x49,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x6a,0x3d,0x01,0x81,
+0x6a,0xbd,0x02,0x06,0x4b,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x6b,0x3d,0x01,0x81,0x6b,0xbd,0x02,0x06,0x4d,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x6c,0x3d,0x01,0x81,0x6c,0xbd,0x02,0x06,0x4f,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x6d,0x3d,0x01,0x81,0x6d,0xbd,0x02,0x06,
+0x51,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x6e,0x3d,0x01,0x81,
+0x6e,0xbd,0x02,0x06,0x53,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x6f,0x3d,0x01,0x81,0x6f,0xbd,0x02,0x06,0x55,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x70,0x3d,0x01,0x81,0x70,0xbd,0x02,0x06,0x57,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x71,0x3d,0x01,0x81,0x71,0xbd,0x02,0x06,
+0x59,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x72,0x3d,0x01,0x81,
+0x72,0xbd,0x02,0x06,0x5b,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x73,0x3d,0x01,0x81,0x73,0xbd,0x02,0x06,0x5f,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x74,0x3d,0x01,0x81,0x74,0xbd,0x02,0x06,0x63,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x75,0x3d,0x01,0x81,0x75,0xbd,0x02,0x06,
+0x65,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x76,0x3d,0x01,0x81,
+0x76,0xbd,0x02,0x06,0x67,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x77,0x3d,0x01,0x81,0x77,0xbd,0x02,0x06,0x69,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x78,0x3d,0x01,0x81,0x78,0xbd,0x02,0x06,0x6b,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x79,0x3d,0x01,0x81,0x79,0xbd,0x02,0x06,
+0x6d,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x7a,0x3d,0x01,0x86,
+0x6f,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x01,0x7a,0xbd,0x01,0x86,
+0x71,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x01,0x7b,0x3d,0x01,0x86,
+0x73,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x01,0x7b,0xbd,0x01,0x86,
+0x75,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x01,0x7c,0x3d,0x01,0x81,
+0x7c,0xbd,0x02,0x06,0x79,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x7d,0x3d,0x01,0x81,0x7d,0xbd,0x02,0x06,0x7b,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x7e,0x3d,0x01,0x81,0x7e,0xbd,0x02,0x06,0x7d,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x7f,0x3d,0x01,0x81,0x7f,0xbd,0x02,0x06,
+0x7f,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x80,0x3d,0x01,0x81,
+0x80,0xbd,0x02,0x06,0x81,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x81,0x3d,0x01,0x81,0x81,0xbd,0x02,0x06,0x83,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x82,0x3d,0x01,0x81,0x82,0xbd,0x02,0x06,0x85,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x83,0x3d,0x01,0x81,0x83,0xbd,0x02,0x06,
+0x93,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x84,0x3d,0x01,0x81,
+0x84,0xbd,0x02,0x06,0x95,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x85,0x3d,0x01,0x86,0x97,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x01,
+0x85,0xbd,0x01,0x86,0x9f,0x40,0x00,0x82,0x80,0xa1,0x00,0x80,0x00,0x06,0x01,0x01,
+0x86,0x3d,0x01,0x81,0x86,0xbd,0x02,0x06,0xa7,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x87,0x3d,0x01,0x81,0x87,0xbd,0x02,0x06,0xa9,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x88,0x3d,0x01,0x81,0x88,0xbd,0x02,0x06,
+0xab,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x89,0x3d,0x01,0x81,
+0x89,0xbd,0x02,0x06,0xad,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x8a,0x3d,0x01,0x81,0x8a,0xbd,0x02,0x06,0xaf,0x40,0x00,0x82,0x81,0x21,0x00,0x80,
+0x00,0x06,0x01,0x01,0x8b,0x3d,0x01,0x81,0x8b,0xbd,0x02,0x06,0xb1,0x40,0x00,0x82,
+0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x8c,0x3d,0x01,0x81,0x8c,0xbd,0x02,0x06,
+0xb3,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,0x8d,0x3d,0x01,0x81,
+0x8d,0xbd,0x02,0x06,0xb5,0x40,0x00,0x82,0x81,0x21,0x00,0x80,0x00,0x06,0x01,0x01,
+0x8e,0x3d,0x01,0x81,0x8e,0xbd,0x02,0x06,0xb7,0x40,0x00,0x82,0x81,0x21,0x00,0x00,
+0x00,0x4a,0x00,0x00,0x03,0x1e,0x10,0x00,0x0d,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,
+0x74,0x45,0x72,0x72,0x6f,0x72,0x10,0x00,0x07,0x31,0x35,0x2e,0x32,0x2e,0x32,0x34,
+0x10,0x00,0x18,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x45,0x72,0x72,0x6f,0x72,
+0x20,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,0x73,0x73,0x10,0x00,0x09,0x31,0x35,
+0x2e,0x32,0x2e,0x32,0x34,0x2e,0x32,0x10,0x00,0x05,0x41,0x72,0x72,0x61,0x79,0x10,
+0x00,0x07,0x31,0x35,0x2e,0x32,0x2e,0x31,0x32,0x10,0x00,0x10,0x41,0x72,0x72,0x61,
+0x79,0x20,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,0x73,0x73,0x10,0x00,0x09,0x31,
+0x35,0x2e,0x32,0x2e,0x31,0x32,0x2e,0x32,0x10,0x00,0x08,0x41,0x72,0x72,0x61,0x79,
+0x2e,0x5b,0x5d,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x32,0x2e,0x34,0x2e,
+0x31,0x10,0x00,0x07,0x41,0x72,0x72,0x61,0x79,0x23,0x2a,0x10,0x00,0x0b,0x31,0x35,
+0x2e,0x32,0x2e,0x31,0x32,0x2e,0x35,0x2e,0x31,0x10,0x00,0x07,0x41,0x72,0x72,0x61,
+0x79,0x23,0x2b,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x32,0x2e,0x35,0x2e,
+0x32,0x10,0x00,0x08,0x41,0x72,0x72,0x61,0x79,0x23,0x3c,0x3c,0x10,0x00,0x0b,0x31,
+0x35,0x2e,0x32,0x2e,0x31,0x32,0x2e,0x35,0x2e,0x33,0x10,0x00,0x08,0x41,0x72,0x72,
+0x61,0x79,0x23,0x5b,0x5d,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x32,0x2e,
+0x35,0x2e,0x34,0x10,0x00,0x09,0x41,0x72,0x72,0x61,0x79,0x23,0x5b,0x5d,0x3d,0x10,
+0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x32,0x2e,0x35,0x2e,0x35,0x10,0x00,0x0b,
+0x41,0x72,0x72,0x61,0x79,0x23,0x63,0x6c,0x65,0x61,0x72,0x10,0x00,0x0b,0x31,0x35,
+0x2e,0x32,0x2e,0x31,0x32,0x2e,0x35,0x2e,0x36,0x10,0x00,0x0e,0x41,0x72,0x72,0x61,
+0x79,0x23,0x63,0x6f,0x6c,0x6c,0x65,0x63,0x74,0x21,0x10,0x00,0x0b,0x31,0x35,0x2e,
+0x32,0x2e,0x31,0x32,0x2e,0x35,0x2e,0x37,0x10,0x00,0x0c,0x41,0x72,0x72,0x61,0x79,
+0x23,0x63,0x6f,0x6e,0x63,0x61,0x74,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,
+0x32,0x2e,0x35,0x2e,0x38,0x10,0x00,0x0f,0x41,0x72,0x72,0x61,0x79,0x23,0x64,0x65,
+0x6c,0x65,0x74,0x65,0x5f,0x61,0x74,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,
+0x32,0x2e,0x35,0x2e,0x39,0x10,0x00,0x0a,0x41,0x72,0x72,0x61,0x79,0x23,0x65,0x61,
+0x63,0x68,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x32,0x2e,0x35,0x2e,0x31,
+0x30,0x10,0x00,0x10,0x41,0x72,0x72,0x61,0x79,0x23,0x65,0x61,0x63,0x68,0x5f,0x69,
+0x6e,0x64,0x65,0x78,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x32,0x2e,0x35,
+0x2e,0x31,0x31,0x10,0x00,0x0c,0x41,0x72,0x72,0x61,0x79,0x23,0x65,0x6d,0x70,0x74,
+0x79,0x3f,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x32,0x2e,0x35,0x2e,0x31,
+0x32,0x10,0x00,0x0b,0x41,0x72,0x72,0x61,0x79,0x23,0x66,0x69,0x72,0x73,0x74,0x10,
+0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x32,0x2e,0x35,0x2e,0x31,0x33,0x10,0x00,
+0x0b,0x41,0x72,0x72,0x61,0x79,0x23,0x69,0x6e,0x64,0x65,0x78,0x10,0x00,0x0c,0x31,
+0x35,0x2e,0x32,0x2e,0x31,0x32,0x2e,0x35,0x2e,0x31,0x34,0x10,0x00,0x10,0x41,0x72,
+0x72,0x61,0x79,0x23,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x69,0x7a,0x65,0x10,0x00,
+0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x32,0x2e,0x35,0x2e,0x31,0x35,0x10,0x00,0x15,
+0x41,0x72,0x72,0x61,0x79,0x23,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x69,0x7a,0x65,
+0x5f,0x63,0x6f,0x70,0x79,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x32,0x2e,
+0x35,0x2e,0x31,0x36,0x10,0x00,0x0a,0x41,0x72,0x72,0x61,0x79,0x23,0x6a,0x6f,0x69,
+0x6e,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x32,0x2e,0x35,0x2e,0x31,0x37,
+0x10,0x00,0x0a,0x41,0x72,0x72,0x61,0x79,0x23,0x6c,0x61,0x73,0x74,0x10,0x00,0x0c,
+0x31,0x35,0x2e,0x32,0x2e,0x31,0x32,0x2e,0x35,0x2e,0x31,0x38,0x10,0x00,0x0c,0x41,
+0x72,0x72,0x61,0x79,0x23,0x6c,0x65,0x6e,0x67,0x74,0x68,0x10,0x00,0x0c,0x31,0x35,
+0x2e,0x32,0x2e,0x31,0x32,0x2e,0x35,0x2e,0x31,0x39,0x10,0x00,0x0a,0x41,0x72,0x72,
+0x61,0x79,0x23,0x6d,0x61,0x70,0x21,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,
+0x32,0x2e,0x35,0x2e,0x32,0x30,0x10,0x00,0x09,0x41,0x72,0x72,0x61,0x79,0x23,0x70,
+0x6f,0x70,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x32,0x2e,0x35,0x2e,0x32,
+0x31,0x10,0x00,0x0a,0x41,0x72,0x72,0x61,0x79,0x23,0x70,0x75,0x73,0x68,0x10,0x00,
+0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x32,0x2e,0x35,0x2e,0x32,0x32,0x10,0x00,0x0d,
+0x41,0x72,0x72,0x61,0x79,0x23,0x72,0x65,0x70,0x6c,0x61,0x63,0x65,0x10,0x00,0x0c,
+0x31,0x35,0x2e,0x32,0x2e,0x31,0x32,0x2e,0x35,0x2e,0x32,0x33,0x10,0x00,0x0d,0x41,
+0x72,0x72,0x61,0x79,0x23,0x72,0x65,0x76,0x65,0x72,0x73,0x65,0x10,0x00,0x0c,0x31,
+0x35,0x2e,0x32,0x2e,0x31,0x32,0x2e,0x35,0x2e,0x32,0x34,0x10,0x00,0x0e,0x41,0x72,
+0x72,0x61,0x79,0x23,0x72,0x65,0x76,0x65,0x72,0x73,0x65,0x21,0x10,0x00,0x0c,0x31,
+0x35,0x2e,0x32,0x2e,0x31,0x32,0x2e,0x35,0x2e,0x32,0x35,0x10,0x00,0x0c,0x41,0x72,
+0x72,0x61,0x79,0x23,0x72,0x69,0x6e,0x64,0x65,0x78,0x10,0x00,0x0c,0x31,0x35,0x2e,
+0x32,0x2e,0x31,0x32,0x2e,0x35,0x2e,0x32,0x36,0x10,0x00,0x0b,0x41,0x72,0x72,0x61,
+0x79,0x23,0x73,0x68,0x69,0x66,0x74,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,
+0x32,0x2e,0x35,0x2e,0x32,0x37,0x10,0x00,0x0a,0x41,0x72,0x72,0x61,0x79,0x23,0x73,
+0x69,0x7a,0x65,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x32,0x2e,0x35,0x2e,
+0x32,0x38,0x10,0x00,0x0b,0x41,0x72,0x72,0x61,0x79,0x23,0x73,0x6c,0x69,0x63,0x65,
+0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x32,0x2e,0x35,0x2e,0x32,0x39,0x10,
+0x00,0x0d,0x41,0x72,0x72,0x61,0x79,0x23,0x75,0x6e,0x73,0x68,0x69,0x66,0x74,0x10,
+0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x32,0x2e,0x35,0x2e,0x33,0x30,0x10,0x00,
+0x0a,0x41,0x72,0x72,0x61,0x79,0x23,0x74,0x6f,0x5f,0x73,0x10,0x00,0x1b,0x31,0x35,
+0x2e,0x32,0x2e,0x31,0x32,0x2e,0x35,0x2e,0x33,0x31,0x20,0x2f,0x20,0x31,0x35,0x2e,
+0x32,0x2e,0x31,0x32,0x2e,0x35,0x2e,0x33,0x32,0x10,0x00,0x08,0x41,0x72,0x72,0x61,
+0x79,0x23,0x3d,0x3d,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x32,0x2e,0x35,
+0x2e,0x33,0x33,0x10,0x00,0x0a,0x41,0x72,0x72,0x61,0x79,0x23,0x65,0x71,0x6c,0x3f,
+0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x32,0x2e,0x35,0x2e,0x33,0x34,0x10,
+0x00,0x0a,0x41,0x72,0x72,0x61,0x79,0x23,0x68,0x61,0x73,0x68,0x10,0x00,0x0c,0x31,
+0x35,0x2e,0x32,0x2e,0x31,0x32,0x2e,0x35,0x2e,0x33,0x35,0x10,0x00,0x09,0x41,0x72,
+0x72,0x61,0x79,0x23,0x3c,0x3d,0x3e,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,
+0x32,0x2e,0x35,0x2e,0x33,0x36,0x10,0x00,0x1f,0x41,0x72,0x72,0x61,0x79,0x20,0x28,
+0x53,0x68,0x61,0x72,0x65,0x64,0x20,0x41,0x72,0x72,0x61,0x79,0x20,0x43,0x6f,0x72,
+0x72,0x75,0x70,0x74,0x69,0x6f,0x6e,0x29,0x10,0x00,0x0b,0x42,0x61,0x73,0x69,0x63,
+0x4f,0x62,0x6a,0x65,0x63,0x74,0x10,0x00,0x16,0x42,0x61,0x73,0x69,0x63,0x4f,0x62,
+0x6a,0x65,0x63,0x74,0x20,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,0x73,0x73,0x10,
+0x00,0x0a,0x42,0x53,0x20,0x42,0x6c,0x6f,0x63,0x6b,0x20,0x31,0x10,0x00,0x0a,0x42,
+0x53,0x20,0x42,0x6c,0x6f,0x63,0x6b,0x20,0x32,0x10,0x00,0x0a,0x42,0x53,0x20,0x42,
+0x6c,0x6f,0x63,0x6b,0x20,0x33,0x10,0x00,0x0a,0x42,0x53,0x20,0x42,0x6c,0x6f,0x63,
+0x6b,0x20,0x34,0x10,0x00,0x0a,0x42,0x53,0x20,0x42,0x6c,0x6f,0x63,0x6b,0x20,0x35,
+0x10,0x00,0x0a,0x42,0x53,0x20,0x42,0x6c,0x6f,0x63,0x6b,0x20,0x36,0x10,0x00,0x0a,
+0x42,0x53,0x20,0x42,0x6c,0x6f,0x63,0x6b,0x20,0x37,0x10,0x00,0x0a,0x42,0x53,0x20,
+0x42,0x6c,0x6f,0x63,0x6b,0x20,0x38,0x10,0x00,0x0a,0x42,0x53,0x20,0x42,0x6c,0x6f,
+0x63,0x6b,0x20,0x39,0x10,0x00,0x0b,0x42,0x53,0x20,0x42,0x6c,0x6f,0x63,0x6b,0x20,
+0x31,0x30,0x10,0x00,0x0b,0x42,0x53,0x20,0x42,0x6c,0x6f,0x63,0x6b,0x20,0x31,0x31,
+0x10,0x00,0x0b,0x42,0x53,0x20,0x42,0x6c,0x6f,0x63,0x6b,0x20,0x31,0x32,0x10,0x00,
+0x0b,0x42,0x53,0x20,0x42,0x6c,0x6f,0x63,0x6b,0x20,0x31,0x33,0x10,0x00,0x0b,0x42,
+0x53,0x20,0x42,0x6c,0x6f,0x63,0x6b,0x20,0x31,0x34,0x10,0x00,0x0b,0x42,0x53,0x20,
+0x42,0x6c,0x6f,0x63,0x6b,0x20,0x31,0x35,0x10,0x00,0x0b,0x42,0x53,0x20,0x42,0x6c,
+0x6f,0x63,0x6b,0x20,0x31,0x36,0x10,0x00,0x0b,0x42,0x53,0x20,0x42,0x6c,0x6f,0x63,
+0x6b,0x20,0x31,0x37,0x10,0x00,0x0b,0x42,0x53,0x20,0x42,0x6c,0x6f,0x63,0x6b,0x20,
+0x31,0x38,0x10,0x00,0x0b,0x42,0x53,0x20,0x42,0x6c,0x6f,0x63,0x6b,0x20,0x31,0x39,
+0x10,0x00,0x0b,0x42,0x53,0x20,0x42,0x6c,0x6f,0x63,0x6b,0x20,0x32,0x30,0x10,0x00,
+0x0b,0x42,0x53,0x20,0x42,0x6c,0x6f,0x63,0x6b,0x20,0x32,0x31,0x10,0x00,0x0b,0x42,
+0x53,0x20,0x42,0x6c,0x6f,0x63,0x6b,0x20,0x32,0x32,0x10,0x00,0x0b,0x42,0x53,0x20,
+0x42,0x6c,0x6f,0x63,0x6b,0x20,0x32,0x33,0x10,0x00,0x0b,0x42,0x53,0x20,0x42,0x6c,
+0x6f,0x63,0x6b,0x20,0x32,0x34,0x10,0x00,0x0b,0x42,0x53,0x20,0x42,0x6c,0x6f,0x63,
+0x6b,0x20,0x32,0x35,0x10,0x00,0x0b,0x42,0x53,0x20,0x42,0x6c,0x6f,0x63,0x6b,0x20,
+0x32,0x36,0x10,0x00,0x0b,0x42,0x53,0x20,0x42,0x6c,0x6f,0x63,0x6b,0x20,0x32,0x37,
+0x10,0x00,0x0b,0x42,0x53,0x20,0x42,0x6c,0x6f,0x63,0x6b,0x20,0x32,0x38,0x10,0x00,
+0x0b,0x42,0x53,0x20,0x42,0x6c,0x6f,0x63,0x6b,0x20,0x32,0x39,0x10,0x00,0x0b,0x42,
+0x53,0x20,0x42,0x6c,0x6f,0x63,0x6b,0x20,0x33,0x30,0x10,0x00,0x19,0x42,0x53,0x20,
+0x42,0x6c,0x6f,0x63,0x6b,0x20,0x5b,0x72,0x75,0x62,0x79,0x2d,0x64,0x65,0x76,0x3a,
+0x33,0x31,0x31,0x34,0x37,0x5d,0x10,0x00,0x19,0x42,0x53,0x20,0x42,0x6c,0x6f,0x63,
+0x6b,0x20,0x5b,0x72,0x75,0x62,0x79,0x2d,0x64,0x65,0x76,0x3a,0x33,0x31,0x31,0x36,
+0x30,0x5d,0x10,0x00,0x15,0x42,0x53,0x20,0x42,0x6c,0x6f,0x63,0x6b,0x20,0x5b,0x69,
+0x73,0x73,0x75,0x65,0x20,0x23,0x37,0x35,0x30,0x5d,0x10,0x00,0x0b,0x42,0x53,0x20,
+0x42,0x6c,0x6f,0x63,0x6b,0x20,0x33,0x31,0x10,0x00,0x19,0x42,0x53,0x20,0x42,0x6c,
+0x6f,0x63,0x6b,0x20,0x5b,0x72,0x75,0x62,0x79,0x2d,0x64,0x65,0x76,0x3a,0x33,0x31,
+0x34,0x34,0x30,0x5d,0x10,0x00,0x0b,0x42,0x53,0x20,0x42,0x6c,0x6f,0x63,0x6b,0x20,
+0x33,0x32,0x10,0x00,0x1a,0x42,0x53,0x20,0x42,0x6c,0x6f,0x63,0x6b,0x20,0x5b,0x72,
+0x75,0x62,0x79,0x2d,0x63,0x6f,0x72,0x65,0x3a,0x31,0x34,0x33,0x39,0x35,0x5d,0x10,
+0x00,0x0b,0x42,0x53,0x20,0x42,0x6c,0x6f,0x63,0x6b,0x20,0x33,0x33,0x10,0x00,0x0b,
+0x42,0x53,0x20,0x42,0x6c,0x6f,0x63,0x6b,0x20,0x33,0x34,0x10,0x00,0x0b,0x42,0x53,
+0x20,0x42,0x6c,0x6f,0x63,0x6b,0x20,0x33,0x35,0x10,0x00,0x0c,0x42,0x53,0x20,0x4c,
+0x69,0x74,0x65,0x72,0x61,0x6c,0x20,0x31,0x10,0x00,0x0c,0x42,0x53,0x20,0x4c,0x69,
+0x74,0x65,0x72,0x61,0x6c,0x20,0x32,0x10,0x00,0x0c,0x42,0x53,0x20,0x4c,0x69,0x74,
+0x65,0x72,0x61,0x6c,0x20,0x33,0x10,0x00,0x0c,0x42,0x53,0x20,0x4c,0x69,0x74,0x65,
+0x72,0x61,0x6c,0x20,0x34,0x10,0x00,0x0c,0x42,0x53,0x20,0x4c,0x69,0x74,0x65,0x72,
+0x61,0x6c,0x20,0x35,0x10,0x00,0x0c,0x42,0x53,0x20,0x4c,0x69,0x74,0x65,0x72,0x61,
+0x6c,0x20,0x36,0x10,0x00,0x0c,0x42,0x53,0x20,0x4c,0x69,0x74,0x65,0x72,0x61,0x6c,
+0x20,0x37,0x10,0x00,0x0c,0x42,0x53,0x20,0x4c,0x69,0x74,0x65,0x72,0x61,0x6c,0x20,
+0x38,0x10,0x00,0x0c,0x42,0x53,0x20,0x4c,0x69,0x74,0x65,0x72,0x61,0x6c,0x20,0x39,
+0x10,0x00,0x05,0x43,0x6c,0x61,0x73,0x73,0x10,0x00,0x06,0x31,0x35,0x2e,0x32,0x2e,
+0x33,0x10,0x00,0x10,0x43,0x6c,0x61,0x73,0x73,0x20,0x73,0x75,0x70,0x65,0x72,0x63,
+0x6c,0x61,0x73,0x73,0x10,0x00,0x08,0x31,0x35,0x2e,0x32,0x2e,0x33,0x2e,0x32,0x10,
+0x00,0x15,0x43,0x6c,0x61,0x73,0x73,0x23,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x69,
+0x7a,0x65,0x5f,0x63,0x6f,0x70,0x79,0x10,0x00,0x0a,0x31,0x35,0x2e,0x32,0x2e,0x33,
+0x2e,0x33,0x2e,0x32,0x10,0x00,0x09,0x43,0x6c,0x61,0x73,0x73,0x23,0x6e,0x65,0x77,
+0x10,0x00,0x0a,0x31,0x35,0x2e,0x32,0x2e,0x33,0x2e,0x33,0x2e,0x33,0x10,0x00,0x10,
+0x43,0x6c,0x61,0x73,0x73,0x23,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,0x73,0x73,
+0x10,0x00,0x0a,0x31,0x35,0x2e,0x32,0x2e,0x33,0x2e,0x33,0x2e,0x34,0x10,0x00,0x07,
+0x43,0x6c,0x61,0x73,0x73,0x20,0x31,0x10,0x00,0x07,0x43,0x6c,0x61,0x73,0x73,0x20,
+0x32,0x10,0x00,0x07,0x43,0x6c,0x61,0x73,0x73,0x20,0x33,0x10,0x00,0x07,0x43,0x6c,
+0x61,0x73,0x73,0x20,0x34,0x10,0x00,0x07,0x43,0x6c,0x61,0x73,0x73,0x20,0x35,0x10,
+0x00,0x07,0x43,0x6c,0x61,0x73,0x73,0x20,0x36,0x10,0x00,0x07,0x43,0x6c,0x61,0x73,
+0x73,0x20,0x37,0x10,0x00,0x07,0x43,0x6c,0x61,0x73,0x73,0x20,0x38,0x10,0x00,0x07,
+0x43,0x6c,0x61,0x73,0x73,0x20,0x39,0x10,0x00,0x0e,0x43,0x6c,0x61,0x73,0x73,0x20,
+0x4d,0x6f,0x64,0x75,0x6c,0x65,0x20,0x31,0x10,0x00,0x0e,0x43,0x6c,0x61,0x73,0x73,
+0x20,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x20,0x32,0x10,0x00,0x0e,0x43,0x6c,0x61,0x73,
+0x73,0x20,0x4e,0x65,0x73,0x74,0x65,0x64,0x20,0x31,0x10,0x00,0x0e,0x43,0x6c,0x61,
+0x73,0x73,0x20,0x4e,0x65,0x73,0x74,0x65,0x64,0x20,0x32,0x10,0x00,0x0e,0x43,0x6c,
+0x61,0x73,0x73,0x20,0x4e,0x65,0x73,0x74,0x65,0x64,0x20,0x33,0x10,0x00,0x0e,0x43,
+0x6c,0x61,0x73,0x73,0x20,0x4e,0x65,0x73,0x74,0x65,0x64,0x20,0x34,0x10,0x00,0x0e,
+0x43,0x6c,0x61,0x73,0x73,0x20,0x4e,0x65,0x73,0x74,0x65,0x64,0x20,0x35,0x10,0x00,
+0x0e,0x43,0x6c,0x61,0x73,0x73,0x20,0x4e,0x65,0x73,0x74,0x65,0x64,0x20,0x36,0x10,
+0x00,0x0e,0x43,0x6c,0x61,0x73,0x73,0x20,0x4e,0x65,0x73,0x74,0x65,0x64,0x20,0x37,
+0x10,0x00,0x0e,0x43,0x6c,0x61,0x73,0x73,0x20,0x4e,0x65,0x73,0x74,0x65,0x64,0x20,
+0x38,0x10,0x00,0x0d,0x43,0x6c,0x61,0x73,0x73,0x20,0x43,0x6f,0x6c,0x6f,0x6e,0x20,
+0x31,0x10,0x00,0x0d,0x43,0x6c,0x61,0x73,0x73,0x20,0x43,0x6f,0x6c,0x6f,0x6e,0x20,
+0x32,0x10,0x00,0x0d,0x43,0x6c,0x61,0x73,0x73,0x20,0x43,0x6f,0x6c,0x6f,0x6e,0x20,
+0x33,0x10,0x00,0x0b,0x43,0x6c,0x61,0x73,0x73,0x20,0x44,0x75,0x70,0x20,0x31,0x10,
+0x00,0x0b,0x43,0x6c,0x61,0x73,0x73,0x20,0x44,0x75,0x70,0x20,0x32,0x10,0x00,0x0d,
+0x43,0x6c,0x61,0x73,0x73,0x20,0x41,0x6c,0x69,0x61,0x73,0x20,0x31,0x10,0x00,0x0d,
+0x43,0x6c,0x61,0x73,0x73,0x20,0x41,0x6c,0x69,0x61,0x73,0x20,0x32,0x10,0x00,0x0d,
+0x43,0x6c,0x61,0x73,0x73,0x20,0x55,0x6e,0x64,0x65,0x66,0x20,0x31,0x10,0x00,0x0d,
+0x43,0x6c,0x61,0x73,0x73,0x20,0x55,0x6e,0x64,0x65,0x66,0x20,0x32,0x10,0x00,0x0c,
+0x43,0x6f,0x6d,0x70,0x61,0x72,0x61,0x62,0x6c,0x65,0x23,0x3c,0x10,0x00,0x0a,0x31,
+0x35,0x2e,0x33,0x2e,0x33,0x2e,0x32,0x2e,0x31,0x10,0x00,0x0d,0x43,0x6f,0x6d,0x70,
+0x61,0x72,0x61,0x62,0x6c,0x65,0x23,0x3c,0x3d,0x10,0x00,0x0a,0x31,0x35,0x2e,0x33,
+0x2e,0x33,0x2e,0x32,0x2e,0x32,0x10,0x00,0x0d,0x43,0x6f,0x6d,0x70,0x61,0x72,0x61,
+0x62,0x6c,0x65,0x23,0x3d,0x3d,0x10,0x00,0x0a,0x31,0x35,0x2e,0x33,0x2e,0x33,0x2e,
+0x32,0x2e,0x33,0x10,0x00,0x0c,0x43,0x6f,0x6d,0x70,0x61,0x72,0x61,0x62,0x6c,0x65,
+0x23,0x3e,0x10,0x00,0x0a,0x31,0x35,0x2e,0x33,0x2e,0x33,0x2e,0x32,0x2e,0x34,0x10,
+0x00,0x0d,0x43,0x6f,0x6d,0x70,0x61,0x72,0x61,0x62,0x6c,0x65,0x23,0x3e,0x3d,0x10,
+0x00,0x0a,0x31,0x35,0x2e,0x33,0x2e,0x33,0x2e,0x32,0x2e,0x35,0x10,0x00,0x13,0x43,
+0x6f,0x6d,0x70,0x61,0x72,0x61,0x62,0x6c,0x65,0x23,0x62,0x65,0x74,0x77,0x65,0x65,
+0x6e,0x3f,0x10,0x00,0x0a,0x31,0x35,0x2e,0x33,0x2e,0x33,0x2e,0x32,0x2e,0x36,0x10,
+0x00,0x0a,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,0x10,0x00,0x06,0x31,
+0x35,0x2e,0x33,0x2e,0x32,0x10,0x00,0x0f,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,
+0x6c,0x65,0x23,0x61,0x6c,0x6c,0x3f,0x10,0x00,0x0a,0x31,0x35,0x2e,0x33,0x2e,0x32,
+0x2e,0x32,0x2e,0x31,0x10,0x00,0x0f,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,
+0x65,0x23,0x61,0x6e,0x79,0x3f,0x10,0x00,0x0a,0x31,0x35,0x2e,0x33,0x2e,0x32,0x2e,
+0x32,0x2e,0x32,0x10,0x00,0x12,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,
+0x23,0x63,0x6f,0x6c,0x6c,0x65,0x63,0x74,0x10,0x00,0x0a,0x31,0x35,0x2e,0x33,0x2e,
+0x32,0x2e,0x32,0x2e,0x33,0x10,0x00,0x11,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,
+0x6c,0x65,0x23,0x64,0x65,0x74,0x65,0x63,0x74,0x10,0x00,0x0a,0x31,0x35,0x2e,0x33,
+0x2e,0x32,0x2e,0x32,0x2e,0x34,0x10,0x00,0x15,0x41,0x72,0x72,0x61,0x79,0x23,0x65,
+0x61,0x63,0x68,0x5f,0x77,0x69,0x74,0x68,0x5f,0x69,0x6e,0x64,0x65,0x78,0x10,0x00,
+0x0a,0x31,0x35,0x2e,0x33,0x2e,0x32,0x2e,0x32,0x2e,0x35,0x10,0x00,0x12,0x45,0x6e,
+0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,0x23,0x65,0x6e,0x74,0x72,0x69,0x65,0x73,
+0x10,0x00,0x0a,0x31,0x35,0x2e,0x33,0x2e,0x32,0x2e,0x32,0x2e,0x36,0x10,0x00,0x0f,
+0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,0x23,0x66,0x69,0x6e,0x64,0x10,
+0x00,0x0a,0x31,0x35,0x2e,0x33,0x2e,0x32,0x2e,0x32,0x2e,0x37,0x10,0x00,0x13,0x45,
+0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,0x23,0x66,0x69,0x6e,0x64,0x5f,0x61,
+0x6c,0x6c,0x10,0x00,0x0a,0x31,0x35,0x2e,0x33,0x2e,0x32,0x2e,0x32,0x2e,0x38,0x10,
+0x00,0x0f,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,0x23,0x67,0x72,0x65,
+0x70,0x10,0x00,0x0a,0x31,0x35,0x2e,0x33,0x2e,0x32,0x2e,0x32,0x2e,0x39,0x10,0x00,
+0x13,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,0x23,0x69,0x6e,0x63,0x6c,
+0x75,0x64,0x65,0x3f,0x10,0x00,0x0b,0x31,0x35,0x2e,0x33,0x2e,0x32,0x2e,0x32,0x2e,
+0x31,0x30,0x10,0x00,0x11,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,0x23,
+0x69,0x6e,0x6a,0x65,0x63,0x74,0x10,0x00,0x0b,0x31,0x35,0x2e,0x33,0x2e,0x32,0x2e,
+0x32,0x2e,0x31,0x31,0x10,0x00,0x0e,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,
+0x65,0x23,0x6d,0x61,0x70,0x10,0x00,0x0b,0x31,0x35,0x2e,0x33,0x2e,0x32,0x2e,0x32,
+0x2e,0x31,0x32,0x10,0x00,0x0e,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,
+0x23,0x6d,0x61,0x78,0x10,0x00,0x0b,0x31,0x35,0x2e,0x33,0x2e,0x32,0x2e,0x32,0x2e,
+0x31,0x33,0x10,0x00,0x0e,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,0x23,
+0x6d,0x69,0x6e,0x10,0x00,0x0b,0x31,0x35,0x2e,0x33,0x2e,0x32,0x2e,0x32,0x2e,0x31,
+0x34,0x10,0x00,0x12,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,0x23,0x6d,
+0x65,0x6d,0x62,0x65,0x72,0x3f,0x10,0x00,0x0b,0x31,0x35,0x2e,0x33,0x2e,0x32,0x2e,
+0x32,0x2e,0x31,0x35,0x10,0x00,0x12,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,
+0x65,0x23,0x70,0x61,0x72,0x74,0x69,0x6f,0x6e,0x10,0x00,0x0b,0x31,0x35,0x2e,0x33,
+0x2e,0x32,0x2e,0x32,0x2e,0x31,0x36,0x10,0x00,0x11,0x45,0x6e,0x75,0x6d,0x65,0x72,
+0x61,0x62,0x6c,0x65,0x23,0x72,0x65,0x6a,0x65,0x63,0x74,0x10,0x00,0x0b,0x31,0x35,
+0x2e,0x33,0x2e,0x32,0x2e,0x32,0x2e,0x31,0x37,0x10,0x00,0x11,0x45,0x6e,0x75,0x6d,
+0x65,0x72,0x61,0x62,0x6c,0x65,0x23,0x73,0x65,0x6c,0x65,0x63,0x74,0x10,0x00,0x0b,
+0x31,0x35,0x2e,0x33,0x2e,0x32,0x2e,0x32,0x2e,0x31,0x38,0x10,0x00,0x0f,0x45,0x6e,
+0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,0x23,0x73,0x6f,0x72,0x74,0x10,0x00,0x0b,
+0x31,0x35,0x2e,0x33,0x2e,0x32,0x2e,0x32,0x2e,0x31,0x39,0x10,0x00,0x0f,0x45,0x6e,
+0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,0x23,0x74,0x6f,0x5f,0x61,0x10,0x00,0x0b,
+0x31,0x35,0x2e,0x33,0x2e,0x32,0x2e,0x32,0x2e,0x32,0x30,0x10,0x00,0x09,0x45,0x78,
+0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x10,0x00,0x07,0x31,0x35,0x2e,0x32,0x2e,0x32,
+0x32,0x10,0x00,0x14,0x45,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x20,0x73,0x75,
+0x70,0x65,0x72,0x63,0x6c,0x61,0x73,0x73,0x10,0x00,0x09,0x31,0x35,0x2e,0x32,0x2e,
+0x32,0x32,0x2e,0x32,0x10,0x00,0x13,0x45,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,
+0x2e,0x65,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x10,0x00,0x0b,0x31,0x35,0x2e,
+0x32,0x2e,0x32,0x32,0x2e,0x34,0x2e,0x31,0x10,0x00,0x13,0x45,0x78,0x63,0x65,0x70,
+0x74,0x69,0x6f,0x6e,0x23,0x65,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x10,0x00,
+0x0b,0x31,0x35,0x2e,0x32,0x2e,0x32,0x32,0x2e,0x35,0x2e,0x31,0x10,0x00,0x11,0x45,
+0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x23,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,
+0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x32,0x32,0x2e,0x35,0x2e,0x32,0x10,0x00,
+0x0e,0x45,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x23,0x74,0x6f,0x5f,0x73,0x10,
+0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x32,0x32,0x2e,0x35,0x2e,0x33,0x10,0x00,0x0b,
+0x53,0x63,0x72,0x69,0x70,0x74,0x45,0x72,0x72,0x6f,0x72,0x10,0x00,0x07,0x31,0x35,
+0x2e,0x32,0x2e,0x33,0x37,0x10,0x00,0x0b,0x53,0x79,0x6e,0x74,0x61,0x78,0x45,0x72,
+0x72,0x6f,0x72,0x10,0x00,0x07,0x31,0x35,0x2e,0x32,0x2e,0x33,0x38,0x10,0x00,0x0b,
+0x45,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x20,0x31,0x10,0x00,0x0b,0x45,0x78,
+0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x20,0x32,0x10,0x00,0x0b,0x45,0x78,0x63,0x65,
+0x70,0x74,0x69,0x6f,0x6e,0x20,0x33,0x10,0x00,0x0b,0x45,0x78,0x63,0x65,0x70,0x74,
+0x69,0x6f,0x6e,0x20,0x34,0x10,0x00,0x0b,0x45,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,
+0x6e,0x20,0x35,0x10,0x00,0x0b,0x45,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x20,
+0x36,0x10,0x00,0x0b,0x45,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x20,0x37,0x10,
+0x00,0x0b,0x45,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x20,0x38,0x10,0x00,0x0b,
+0x45,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x20,0x39,0x10,0x00,0x0c,0x45,0x78,
+0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x20,0x31,0x30,0x10,0x00,0x0c,0x45,0x78,0x63,
+0x65,0x70,0x74,0x69,0x6f,0x6e,0x20,0x31,0x31,0x10,0x00,0x0c,0x45,0x78,0x63,0x65,
+0x70,0x74,0x69,0x6f,0x6e,0x20,0x31,0x32,0x10,0x00,0x0c,0x45,0x78,0x63,0x65,0x70,
+0x74,0x69,0x6f,0x6e,0x20,0x31,0x33,0x10,0x00,0x0c,0x45,0x78,0x63,0x65,0x70,0x74,
+0x69,0x6f,0x6e,0x20,0x31,0x34,0x10,0x00,0x0c,0x45,0x78,0x63,0x65,0x70,0x74,0x69,
+0x6f,0x6e,0x20,0x31,0x35,0x10,0x00,0x0c,0x45,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,
+0x6e,0x20,0x31,0x36,0x10,0x00,0x0c,0x45,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,
+0x20,0x31,0x37,0x10,0x00,0x0c,0x45,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x20,
+0x31,0x38,0x10,0x00,0x0c,0x45,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x20,0x31,
+0x39,0x10,0x00,0x21,0x45,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x23,0x69,0x6e,
+0x73,0x70,0x65,0x63,0x74,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x20,0x6d,0x65,
+0x73,0x73,0x61,0x67,0x65,0x10,0x00,0x0a,0x46,0x61,0x6c,0x73,0x65,0x43,0x6c,0x61,
+0x73,0x73,0x10,0x00,0x06,0x31,0x35,0x2e,0x32,0x2e,0x36,0x10,0x00,0x15,0x46,0x61,
+0x6c,0x73,0x65,0x43,0x6c,0x61,0x73,0x73,0x20,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,
+0x61,0x73,0x73,0x10,0x00,0x08,0x31,0x35,0x2e,0x32,0x2e,0x36,0x2e,0x32,0x10,0x00,
+0x10,0x46,0x61,0x6c,0x73,0x65,0x43,0x6c,0x61,0x73,0x73,0x20,0x66,0x61,0x6c,0x73,
+0x65,0x10,0x00,0x08,0x31,0x35,0x2e,0x32,0x2e,0x36,0x2e,0x31,0x10,0x00,0x0c,0x46,
+0x61,0x6c,0x73,0x65,0x43,0x6c,0x61,0x73,0x73,0x23,0x26,0x10,0x00,0x0a,0x31,0x35,
+0x2e,0x32,0x2e,0x36,0x2e,0x33,0x2e,0x31,0x10,0x00,0x0c,0x46,0x61,0x6c,0x73,0x65,
+0x43,0x6c,0x61,0x73,0x73,0x23,0x5e,0x10,0x00,0x0a,0x31,0x35,0x2e,0x32,0x2e,0x36,
+0x2e,0x33,0x2e,0x32,0x10,0x00,0x0f,0x46,0x61,0x6c,0x73,0x65,0x43,0x6c,0x61,0x73,
+0x73,0x23,0x74,0x6f,0x5f,0x73,0x10,0x00,0x0a,0x31,0x35,0x2e,0x32,0x2e,0x36,0x2e,
+0x33,0x2e,0x33,0x10,0x00,0x0c,0x46,0x61,0x6c,0x73,0x65,0x43,0x6c,0x61,0x73,0x73,
+0x23,0x7c,0x10,0x00,0x0a,0x31,0x35,0x2e,0x32,0x2e,0x36,0x2e,0x33,0x2e,0x34,0x10,
+0x00,0x05,0x46,0x6c,0x6f,0x61,0x74,0x10,0x00,0x06,0x31,0x35,0x2e,0x32,0x2e,0x39,
+0x10,0x00,0x10,0x46,0x6c,0x6f,0x61,0x74,0x20,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,
+0x61,0x73,0x73,0x10,0x00,0x08,0x31,0x35,0x2e,0x32,0x2e,0x39,0x2e,0x32,0x10,0x00,
+0x07,0x46,0x6c,0x6f,0x61,0x74,0x23,0x2b,0x10,0x00,0x0a,0x31,0x35,0x2e,0x32,0x2e,
+0x39,0x2e,0x33,0x2e,0x31,0x10,0x00,0x07,0x46,0x6c,0x6f,0x61,0x74,0x23,0x2d,0x10,
+0x00,0x0a,0x31,0x35,0x2e,0x32,0x2e,0x39,0x2e,0x33,0x2e,0x32,0x10,0x00,0x07,0x46,
+0x6c,0x6f,0x61,0x74,0x23,0x2a,0x10,0x00,0x0a,0x31,0x35,0x2e,0x32,0x2e,0x39,0x2e,
+0x33,0x2e,0x33,0x10,0x00,0x07,0x46,0x6c,0x6f,0x61,0x74,0x23,0x2f,0x10,0x00,0x0a,
+0x31,0x35,0x2e,0x32,0x2e,0x39,0x2e,0x33,0x2e,0x34,0x10,0x00,0x07,0x46,0x6c,0x6f,
+0x61,0x74,0x23,0x25,0x10,0x00,0x0a,0x31,0x35,0x2e,0x32,0x2e,0x39,0x2e,0x33,0x2e,
+0x35,0x10,0x00,0x09,0x46,0x6c,0x6f,0x61,0x74,0x23,0x3c,0x3d,0x3e,0x10,0x00,0x0a,
+0x31,0x35,0x2e,0x32,0x2e,0x39,0x2e,0x33,0x2e,0x36,0x10,0x00,0x08,0x46,0x6c,0x6f,
+0x61,0x74,0x23,0x3d,0x3d,0x10,0x00,0x0a,0x31,0x35,0x2e,0x32,0x2e,0x39,0x2e,0x33,
+0x2e,0x37,0x10,0x00,0x0a,0x46,0x6c,0x6f,0x61,0x74,0x23,0x63,0x65,0x69,0x6c,0x10,
+0x00,0x0a,0x31,0x35,0x2e,0x32,0x2e,0x39,0x2e,0x33,0x2e,0x38,0x10,0x00,0x0d,0x46,
+0x6c,0x6f,0x61,0x74,0x23,0x66,0x69,0x6e,0x69,0x74,0x65,0x3f,0x10,0x00,0x0a,0x31,
+0x35,0x2e,0x32,0x2e,0x39,0x2e,0x33,0x2e,0x39,0x10,0x00,0x0b,0x46,0x6c,0x6f,0x61,
+0x74,0x23,0x66,0x6c,0x6f,0x6f,0x72,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x39,
+0x2e,0x33,0x2e,0x31,0x30,0x10,0x00,0x0f,0x46,0x6c,0x6f,0x61,0x74,0x23,0x69,0x6e,
+0x66,0x69,0x6e,0x69,0x74,0x65,0x3f,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x39,
+0x2e,0x33,0x2e,0x31,0x31,0x10,0x00,0x0b,0x46,0x6c,0x6f,0x61,0x74,0x23,0x72,0x6f,
+0x75,0x6e,0x64,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x39,0x2e,0x33,0x2e,0x31,
+0x32,0x10,0x00,0x0a,0x46,0x6c,0x6f,0x61,0x74,0x23,0x74,0x6f,0x5f,0x66,0x10,0x00,
+0x0b,0x31,0x35,0x2e,0x32,0x2e,0x39,0x2e,0x33,0x2e,0x31,0x33,0x10,0x00,0x0a,0x46,
+0x6c,0x6f,0x61,0x74,0x23,0x74,0x6f,0x5f,0x69,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,
+0x2e,0x39,0x2e,0x33,0x2e,0x31,0x34,0x10,0x00,0x0e,0x46,0x6c,0x6f,0x61,0x74,0x23,
+0x74,0x72,0x75,0x6e,0x63,0x61,0x74,0x65,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,
+0x39,0x2e,0x33,0x2e,0x31,0x35,0x10,0x00,0x09,0x47,0x43,0x2e,0x65,0x6e,0x61,0x62,
+0x6c,0x65,0x10,0x00,0x0a,0x47,0x43,0x2e,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,0x10,
+0x00,0x12,0x47,0x43,0x2e,0x69,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x5f,0x72,0x61,
+0x74,0x69,0x6f,0x3d,0x10,0x00,0x0e,0x47,0x43,0x2e,0x73,0x74,0x65,0x70,0x5f,0x72,
+0x61,0x74,0x69,0x6f,0x3d,0x10,0x00,0x15,0x47,0x43,0x2e,0x67,0x65,0x6e,0x65,0x72,
+0x61,0x74,0x69,0x6f,0x6e,0x61,0x6c,0x5f,0x6d,0x6f,0x64,0x65,0x3d,0x10,0x00,0x04,
+0x48,0x61,0x73,0x68,0x10,0x00,0x07,0x31,0x35,0x2e,0x32,0x2e,0x31,0x33,0x10,0x00,
+0x0f,0x48,0x61,0x73,0x68,0x20,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,0x73,0x73,
+0x10,0x00,0x09,0x31,0x35,0x2e,0x32,0x2e,0x31,0x33,0x2e,0x32,0x10,0x00,0x07,0x48,
+0x61,0x73,0x68,0x23,0x3d,0x3d,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x33,
+0x2e,0x34,0x2e,0x31,0x10,0x00,0x07,0x48,0x61,0x73,0x68,0x23,0x5b,0x5d,0x10,0x00,
+0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x33,0x2e,0x34,0x2e,0x32,0x10,0x00,0x08,0x48,
+0x61,0x73,0x68,0x23,0x5b,0x5d,0x3d,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,
+0x33,0x2e,0x34,0x2e,0x33,0x10,0x00,0x0a,0x48,0x61,0x73,0x68,0x23,0x63,0x6c,0x65,
+0x61,0x72,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x33,0x2e,0x34,0x2e,0x34,
+0x10,0x00,0x0c,0x48,0x61,0x73,0x68,0x23,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x10,
+0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x33,0x2e,0x34,0x2e,0x35,0x10,0x00,0x0d,
+0x48,0x61,0x73,0x68,0x23,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x3d,0x10,0x00,0x0b,
+0x31,0x35,0x2e,0x32,0x2e,0x31,0x33,0x2e,0x34,0x2e,0x36,0x10,0x00,0x11,0x48,0x61,
+0x73,0x68,0x23,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x5f,0x70,0x72,0x6f,0x63,0x10,
+0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x33,0x2e,0x34,0x2e,0x37,0x10,0x00,0x0b,
+0x48,0x61,0x73,0x68,0x23,0x64,0x65,0x6c,0x65,0x74,0x65,0x10,0x00,0x0b,0x31,0x35,
+0x2e,0x32,0x2e,0x31,0x33,0x2e,0x34,0x2e,0x38,0x10,0x00,0x09,0x48,0x61,0x73,0x68,
+0x23,0x65,0x61,0x63,0x68,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x33,0x2e,
+0x34,0x2e,0x39,0x10,0x00,0x0d,0x48,0x61,0x73,0x68,0x23,0x65,0x61,0x63,0x68,0x5f,
+0x6b,0x65,0x79,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x33,0x2e,0x34,0x2e,
+0x31,0x30,0x10,0x00,0x0f,0x48,0x61,0x73,0x68,0x23,0x65,0x61,0x63,0x68,0x5f,0x76,
+0x61,0x6c,0x75,0x65,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x33,0x2e,0x34,
+0x2e,0x31,0x31,0x10,0x00,0x0b,0x48,0x61,0x73,0x68,0x23,0x65,0x6d,0x70,0x74,0x79,
+0x3f,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x33,0x2e,0x34,0x2e,0x31,0x32,
+0x10,0x00,0x0d,0x48,0x61,0x73,0x68,0x23,0x68,0x61,0x73,0x5f,0x6b,0x65,0x79,0x3f,
+0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x33,0x2e,0x34,0x2e,0x31,0x33,0x10,
+0x00,0x0f,0x48,0x61,0x73,0x68,0x23,0x68,0x61,0x73,0x5f,0x76,0x61,0x6c,0x75,0x65,
+0x3f,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x33,0x2e,0x34,0x2e,0x31,0x34,
+0x10,0x00,0x0d,0x48,0x61,0x73,0x68,0x23,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x3f,
+0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x33,0x2e,0x34,0x2e,0x31,0x35,0x10,
+0x00,0x0f,0x48,0x61,0x73,0x68,0x23,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x69,0x7a,
+0x65,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x33,0x2e,0x34,0x2e,0x31,0x36,
+0x10,0x00,0x14,0x48,0x61,0x73,0x68,0x23,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x69,
+0x7a,0x65,0x5f,0x63,0x6f,0x70,0x79,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,
+0x33,0x2e,0x34,0x2e,0x31,0x37,0x10,0x00,0x09,0x48,0x61,0x73,0x68,0x23,0x6b,0x65,
+0x79,0x3f,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x33,0x2e,0x34,0x2e,0x31,
+0x38,0x10,0x00,0x09,0x48,0x61,0x73,0x68,0x23,0x6b,0x65,0x79,0x73,0x10,0x00,0x0c,
+0x31,0x35,0x2e,0x32,0x2e,0x31,0x33,0x2e,0x34,0x2e,0x31,0x39,0x10,0x00,0x0b,0x48,
+0x61,0x73,0x68,0x23,0x6c,0x65,0x6e,0x67,0x74,0x68,0x10,0x00,0x0c,0x31,0x35,0x2e,
+0x32,0x2e,0x31,0x33,0x2e,0x34,0x2e,0x32,0x30,0x10,0x00,0x0c,0x48,0x61,0x73,0x68,
+0x23,0x6d,0x65,0x6d,0x62,0x65,0x72,0x3f,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,
+0x31,0x33,0x2e,0x34,0x2e,0x32,0x31,0x10,0x00,0x0a,0x48,0x61,0x73,0x68,0x23,0x6d,
+0x65,0x72,0x67,0x65,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x33,0x2e,0x34,
+0x2e,0x32,0x32,0x10,0x00,0x0c,0x48,0x61,0x73,0x68,0x23,0x72,0x65,0x70,0x6c,0x61,
+0x63,0x65,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x33,0x2e,0x34,0x2e,0x32,
+0x33,0x10,0x00,0x0a,0x48,0x61,0x73,0x68,0x23,0x73,0x68,0x69,0x66,0x74,0x10,0x00,
+0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x33,0x2e,0x34,0x2e,0x32,0x34,0x10,0x00,0x09,
+0x48,0x61,0x73,0x68,0x23,0x73,0x69,0x7a,0x65,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,
+0x2e,0x31,0x33,0x2e,0x34,0x2e,0x32,0x35,0x10,0x00,0x0a,0x48,0x61,0x73,0x68,0x23,
+0x73,0x74,0x6f,0x72,0x65,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x33,0x2e,
+0x34,0x2e,0x32,0x36,0x10,0x00,0x0b,0x48,0x61,0x73,0x68,0x23,0x76,0x61,0x6c,0x75,
+0x65,0x3f,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x33,0x2e,0x34,0x2e,0x32,
+0x37,0x10,0x00,0x0b,0x48,0x61,0x73,0x68,0x23,0x76,0x61,0x6c,0x75,0x65,0x73,0x10,
+0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x33,0x2e,0x34,0x2e,0x32,0x38,0x10,0x00,
+0x0b,0x48,0x61,0x73,0x68,0x23,0x72,0x65,0x6a,0x65,0x63,0x74,0x10,0x00,0x0c,0x48,
+0x61,0x73,0x68,0x23,0x72,0x65,0x6a,0x65,0x63,0x74,0x21,0x10,0x00,0x0b,0x48,0x61,
+0x73,0x68,0x23,0x73,0x65,0x6c,0x65,0x63,0x74,0x10,0x00,0x0c,0x48,0x61,0x73,0x68,
+0x23,0x73,0x65,0x6c,0x65,0x63,0x74,0x21,0x10,0x00,0x0a,0x49,0x6e,0x64,0x65,0x78,
+0x45,0x72,0x72,0x6f,0x72,0x10,0x00,0x07,0x31,0x35,0x2e,0x32,0x2e,0x33,0x33,0x10,
+0x00,0x15,0x49,0x6e,0x64,0x65,0x78,0x45,0x72,0x72,0x6f,0x72,0x20,0x73,0x75,0x70,
+0x65,0x72,0x63,0x6c,0x61,0x73,0x73,0x10,0x00,0x09,0x31,0x35,0x2e,0x32,0x2e,0x33,
+0x33,0x2e,0x32,0x10,0x00,0x07,0x49,0x6e,0x74,0x65,0x67,0x65,0x72,0x10,0x00,0x06,
+0x31,0x35,0x2e,0x32,0x2e,0x38,0x10,0x00,0x12,0x49,0x6e,0x74,0x65,0x67,0x65,0x72,
+0x20,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,0x73,0x73,0x10,0x00,0x08,0x31,0x35,
+0x2e,0x32,0x2e,0x38,0x2e,0x32,0x10,0x00,0x09,0x49,0x6e,0x74,0x65,0x67,0x65,0x72,
+0x23,0x2b,0x10,0x00,0x0a,0x31,0x35,0x2e,0x32,0x2e,0x38,0x2e,0x33,0x2e,0x31,0x10,
+0x00,0x09,0x49,0x6e,0x74,0x65,0x67,0x65,0x72,0x23,0x2d,0x10,0x00,0x0a,0x31,0x35,
+0x2e,0x32,0x2e,0x38,0x2e,0x33,0x2e,0x32,0x10,0x00,0x09,0x49,0x6e,0x74,0x65,0x67,
+0x65,0x72,0x23,0x2a,0x10,0x00,0x0a,0x31,0x35,0x2e,0x32,0x2e,0x38,0x2e,0x33,0x2e,
+0x33,0x10,0x00,0x09,0x49,0x6e,0x74,0x65,0x67,0x65,0x72,0x23,0x2f,0x10,0x00,0x0a,
+0x31,0x35,0x2e,0x32,0x2e,0x38,0x2e,0x33,0x2e,0x34,0x10,0x00,0x09,0x49,0x6e,0x74,
+0x65,0x67,0x65,0x72,0x23,0x25,0x10,0x00,0x0a,0x31,0x35,0x2e,0x32,0x2e,0x38,0x2e,
+0x33,0x2e,0x35,0x10,0x00,0x0b,0x49,0x6e,0x74,0x65,0x67,0x65,0x72,0x23,0x3c,0x3d,
+0x3e,0x10,0x00,0x0a,0x31,0x35,0x2e,0x32,0x2e,0x38,0x2e,0x33,0x2e,0x36,0x10,0x00,
+0x0a,0x49,0x6e,0x74,0x65,0x67,0x65,0x72,0x23,0x3d,0x3d,0x10,0x00,0x0a,0x31,0x35,
+0x2e,0x32,0x2e,0x38,0x2e,0x33,0x2e,0x37,0x10,0x00,0x09,0x49,0x6e,0x74,0x65,0x67,
+0x65,0x72,0x23,0x7e,0x10,0x00,0x0a,0x31,0x35,0x2e,0x32,0x2e,0x38,0x2e,0x33,0x2e,
+0x38,0x10,0x00,0x09,0x49,0x6e,0x74,0x65,0x67,0x65,0x72,0x23,0x26,0x10,0x00,0x0a,
+0x31,0x35,0x2e,0x32,0x2e,0x38,0x2e,0x33,0x2e,0x39,0x10,0x00,0x09,0x49,0x6e,0x74,
+0x65,0x67,0x65,0x72,0x23,0x7c,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x38,0x2e,
+0x33,0x2e,0x31,0x30,0x10,0x00,0x09,0x49,0x6e,0x74,0x65,0x67,0x65,0x72,0x23,0x5e,
+0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x38,0x2e,0x33,0x2e,0x31,0x31,0x10,0x00,
+0x0a,0x49,0x6e,0x74,0x65,0x67,0x65,0x72,0x23,0x3c,0x3c,0x10,0x00,0x0b,0x31,0x35,
+0x2e,0x32,0x2e,0x38,0x2e,0x33,0x2e,0x31,0x32,0x10,0x00,0x0a,0x49,0x6e,0x74,0x65,
+0x67,0x65,0x72,0x23,0x3e,0x3e,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x38,0x2e,
+0x33,0x2e,0x31,0x33,0x10,0x00,0x0c,0x49,0x6e,0x74,0x65,0x67,0x65,0x72,0x23,0x63,
+0x65,0x69,0x6c,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x38,0x2e,0x33,0x2e,0x31,
+0x34,0x10,0x00,0x0e,0x49,0x6e,0x74,0x65,0x67,0x65,0x72,0x23,0x64,0x6f,0x77,0x6e,
+0x74,0x6f,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x38,0x2e,0x33,0x2e,0x31,0x35,
+0x10,0x00,0x0c,0x49,0x6e,0x74,0x65,0x67,0x65,0x72,0x23,0x65,0x71,0x6c,0x3f,0x10,
+0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x38,0x2e,0x33,0x2e,0x31,0x36,0x10,0x00,0x0d,
+0x49,0x6e,0x74,0x65,0x67,0x65,0x72,0x23,0x66,0x6c,0x6f,0x6f,0x72,0x10,0x00,0x0b,
+0x31,0x35,0x2e,0x32,0x2e,0x38,0x2e,0x33,0x2e,0x31,0x37,0x10,0x00,0x0c,0x49,0x6e,
+0x74,0x65,0x67,0x65,0x72,0x23,0x6e,0x65,0x78,0x74,0x10,0x00,0x0b,0x31,0x35,0x2e,
+0x32,0x2e,0x38,0x2e,0x33,0x2e,0x31,0x39,0x10,0x00,0x0d,0x49,0x6e,0x74,0x65,0x67,
+0x65,0x72,0x23,0x72,0x6f,0x75,0x6e,0x64,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,
+0x38,0x2e,0x33,0x2e,0x32,0x30,0x10,0x00,0x0c,0x49,0x6e,0x74,0x65,0x67,0x65,0x72,
+0x23,0x73,0x75,0x63,0x63,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x38,0x2e,0x33,
+0x2e,0x32,0x31,0x10,0x00,0x0d,0x49,0x6e,0x74,0x65,0x67,0x65,0x72,0x23,0x74,0x69,
+0x6d,0x65,0x73,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x38,0x2e,0x33,0x2e,0x32,
+0x32,0x10,0x00,0x0c,0x49,0x6e,0x74,0x65,0x67,0x65,0x72,0x23,0x74,0x6f,0x5f,0x66,
+0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x38,0x2e,0x33,0x2e,0x32,0x33,0x10,0x00,
+0x0c,0x49,0x6e,0x74,0x65,0x67,0x65,0x72,0x23,0x74,0x6f,0x5f,0x69,0x10,0x00,0x0b,
+0x31,0x35,0x2e,0x32,0x2e,0x38,0x2e,0x33,0x2e,0x32,0x34,0x10,0x00,0x0c,0x49,0x6e,
+0x74,0x65,0x67,0x65,0x72,0x23,0x74,0x6f,0x5f,0x73,0x10,0x00,0x0b,0x31,0x35,0x2e,
+0x32,0x2e,0x38,0x2e,0x33,0x2e,0x32,0x35,0x10,0x00,0x10,0x49,0x6e,0x74,0x65,0x67,
+0x65,0x72,0x23,0x74,0x72,0x75,0x6e,0x63,0x61,0x74,0x65,0x10,0x00,0x0b,0x31,0x35,
+0x2e,0x32,0x2e,0x38,0x2e,0x33,0x2e,0x32,0x36,0x10,0x00,0x0c,0x49,0x6e,0x74,0x65,
+0x67,0x65,0x72,0x23,0x75,0x70,0x74,0x6f,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,
+0x38,0x2e,0x33,0x2e,0x32,0x37,0x10,0x00,0x0c,0x49,0x6e,0x74,0x65,0x67,0x65,0x72,
+0x23,0x73,0x74,0x65,0x70,0x10,0x00,0x06,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x10,0x00,
+0x06,0x31,0x35,0x2e,0x33,0x2e,0x31,0x10,0x00,0x13,0x4b,0x65,0x72,0x6e,0x65,0x6c,
+0x2e,0x62,0x6c,0x6f,0x63,0x6b,0x5f,0x67,0x69,0x76,0x65,0x6e,0x3f,0x10,0x00,0x0a,
+0x31,0x35,0x2e,0x33,0x2e,0x31,0x2e,0x32,0x2e,0x32,0x10,0x00,0x17,0x4b,0x65,0x72,
+0x6e,0x65,0x6c,0x2e,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x5f,0x76,0x61,0x72,0x69,0x61,
+0x62,0x6c,0x65,0x73,0x10,0x00,0x0a,0x31,0x35,0x2e,0x33,0x2e,0x31,0x2e,0x32,0x2e,
+0x34,0x10,0x00,0x10,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x2e,0x69,0x74,0x65,0x72,0x61,
+0x74,0x6f,0x72,0x3f,0x10,0x00,0x0a,0x31,0x35,0x2e,0x33,0x2e,0x31,0x2e,0x32,0x2e,
+0x35,0x10,0x00,0x0d,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x2e,0x6c,0x61,0x6d,0x62,0x64,
+0x61,0x10,0x00,0x0a,0x31,0x35,0x2e,0x33,0x2e,0x31,0x2e,0x32,0x2e,0x36,0x10,0x00,
+0x0b,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x2e,0x6c,0x6f,0x6f,0x70,0x10,0x00,0x0a,0x31,
+0x35,0x2e,0x33,0x2e,0x31,0x2e,0x32,0x2e,0x38,0x10,0x00,0x08,0x4b,0x65,0x72,0x6e,
+0x65,0x6c,0x2e,0x70,0x10,0x00,0x0a,0x31,0x35,0x2e,0x33,0x2e,0x31,0x2e,0x32,0x2e,
+0x39,0x10,0x00,0x0c,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x2e,0x70,0x72,0x69,0x6e,0x74,
+0x10,0x00,0x0b,0x31,0x35,0x2e,0x33,0x2e,0x31,0x2e,0x32,0x2e,0x31,0x30,0x10,0x00,
+0x0b,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x2e,0x70,0x75,0x74,0x73,0x10,0x00,0x0b,0x31,
+0x35,0x2e,0x33,0x2e,0x31,0x2e,0x32,0x2e,0x31,0x31,0x10,0x00,0x0c,0x4b,0x65,0x72,
+0x6e,0x65,0x6c,0x2e,0x72,0x61,0x69,0x73,0x65,0x10,0x00,0x0b,0x31,0x35,0x2e,0x33,
+0x2e,0x31,0x2e,0x32,0x2e,0x31,0x32,0x10,0x00,0x0d,0x4b,0x65,0x72,0x6e,0x65,0x6c,
+0x23,0x5f,0x5f,0x69,0x64,0x5f,0x5f,0x10,0x00,0x0a,0x31,0x35,0x2e,0x33,0x2e,0x31,
+0x2e,0x33,0x2e,0x33,0x10,0x00,0x0f,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x23,0x5f,0x5f,
+0x73,0x65,0x6e,0x64,0x5f,0x5f,0x10,0x00,0x0a,0x31,0x35,0x2e,0x33,0x2e,0x31,0x2e,
+0x33,0x2e,0x34,0x10,0x00,0x13,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x23,0x62,0x6c,0x6f,
+0x63,0x6b,0x5f,0x67,0x69,0x76,0x65,0x6e,0x3f,0x10,0x00,0x0a,0x31,0x35,0x2e,0x33,
+0x2e,0x31,0x2e,0x33,0x2e,0x36,0x10,0x00,0x0c,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x23,
+0x63,0x6c,0x61,0x73,0x73,0x10,0x00,0x0a,0x31,0x35,0x2e,0x33,0x2e,0x31,0x2e,0x33,
+0x2e,0x37,0x10,0x00,0x0c,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x23,0x63,0x6c,0x6f,0x6e,
+0x65,0x10,0x00,0x0a,0x31,0x35,0x2e,0x33,0x2e,0x31,0x2e,0x33,0x2e,0x38,0x10,0x00,
+0x0a,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x23,0x64,0x75,0x70,0x10,0x00,0x0a,0x31,0x35,
+0x2e,0x33,0x2e,0x31,0x2e,0x33,0x2e,0x39,0x10,0x00,0x0d,0x4b,0x65,0x72,0x6e,0x65,
+0x6c,0x23,0x65,0x78,0x74,0x65,0x6e,0x64,0x10,0x00,0x0b,0x31,0x35,0x2e,0x33,0x2e,
+0x31,0x2e,0x33,0x2e,0x31,0x33,0x10,0x00,0x1f,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x23,
+0x65,0x78,0x74,0x65,0x6e,0x64,0x20,0x77,0x6f,0x72,0x6b,0x73,0x20,0x6f,0x6e,0x20,
+0x74,0x6f,0x70,0x6c,0x65,0x76,0x65,0x6c,0x10,0x00,0x17,0x4b,0x65,0x72,0x6e,0x65,
+0x6c,0x23,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x5f,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,
+0x65,0x73,0x10,0x00,0x0b,0x31,0x35,0x2e,0x33,0x2e,0x31,0x2e,0x33,0x2e,0x31,0x34,
+0x10,0x00,0x0b,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x23,0x68,0x61,0x73,0x68,0x10,0x00,
+0x0b,0x31,0x35,0x2e,0x33,0x2e,0x31,0x2e,0x33,0x2e,0x31,0x35,0x10,0x00,0x0e,0x4b,
+0x65,0x72,0x6e,0x65,0x6c,0x23,0x69,0x6e,0x73,0x70,0x65,0x63,0x74,0x10,0x00,0x0b,
+0x31,0x35,0x2e,0x33,0x2e,0x31,0x2e,0x33,0x2e,0x31,0x37,0x10,0x00,0x19,0x4b,0x65,
+0x72,0x6e,0x65,0x6c,0x23,0x69,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x76,0x61,
+0x72,0x69,0x61,0x62,0x6c,0x65,0x73,0x10,0x00,0x0b,0x31,0x35,0x2e,0x33,0x2e,0x31,
+0x2e,0x33,0x2e,0x32,0x33,0x10,0x00,0x0c,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x23,0x69,
+0x73,0x5f,0x61,0x3f,0x10,0x00,0x0b,0x31,0x35,0x2e,0x33,0x2e,0x31,0x2e,0x33,0x2e,
+0x32,0x34,0x10,0x00,0x10,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x23,0x69,0x74,0x65,0x72,
+0x61,0x74,0x6f,0x72,0x3f,0x10,0x00,0x0b,0x31,0x35,0x2e,0x33,0x2e,0x31,0x2e,0x33,
+0x2e,0x32,0x35,0x10,0x00,0x0f,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x23,0x6b,0x69,0x6e,
+0x64,0x5f,0x6f,0x66,0x3f,0x10,0x00,0x0b,0x31,0x35,0x2e,0x33,0x2e,0x31,0x2e,0x33,
+0x2e,0x32,0x36,0x10,0x00,0x0d,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x23,0x6c,0x61,0x6d,
+0x62,0x64,0x61,0x10,0x00,0x0b,0x31,0x35,0x2e,0x33,0x2e,0x31,0x2e,0x33,0x2e,0x32,
+0x37,0x10,0x00,0x0b,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x23,0x6c,0x6f,0x6f,0x70,0x10,
+0x00,0x0b,0x31,0x35,0x2e,0x33,0x2e,0x31,0x2e,0x33,0x2e,0x32,0x39,0x10,0x00,0x0e,
+0x4b,0x65,0x72,0x6e,0x65,0x6c,0x23,0x6d,0x65,0x74,0x68,0x6f,0x64,0x73,0x10,0x00,
+0x0b,0x31,0x35,0x2e,0x33,0x2e,0x31,0x2e,0x33,0x2e,0x33,0x31,0x10,0x00,0x0b,0x4b,
+0x65,0x72,0x6e,0x65,0x6c,0x23,0x6e,0x69,0x6c,0x3f,0x10,0x00,0x0b,0x31,0x35,0x2e,
+0x33,0x2e,0x31,0x2e,0x33,0x2e,0x33,0x32,0x10,0x00,0x10,0x4b,0x65,0x72,0x6e,0x65,
+0x6c,0x23,0x6f,0x62,0x6a,0x65,0x63,0x74,0x5f,0x69,0x64,0x10,0x00,0x0b,0x31,0x35,
+0x2e,0x33,0x2e,0x31,0x2e,0x33,0x2e,0x33,0x33,0x10,0x00,0x16,0x4b,0x65,0x72,0x6e,
+0x65,0x6c,0x23,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x5f,0x6d,0x65,0x74,0x68,0x6f,
+0x64,0x73,0x10,0x00,0x0b,0x31,0x35,0x2e,0x33,0x2e,0x31,0x2e,0x33,0x2e,0x33,0x36,
+0x10,0x00,0x18,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x23,0x70,0x72,0x6f,0x74,0x65,0x63,
+0x74,0x65,0x64,0x5f,0x6d,0x65,0x74,0x68,0x6f,0x64,0x73,0x10,0x00,0x0b,0x31,0x35,
+0x2e,0x33,0x2e,0x31,0x2e,0x33,0x2e,0x33,0x37,0x10,0x00,0x15,0x4b,0x65,0x72,0x6e,
+0x65,0x6c,0x23,0x70,0x75,0x62,0x6c,0x69,0x63,0x5f,0x6d,0x65,0x74,0x68,0x6f,0x64,
+0x73,0x10,0x00,0x0b,0x31,0x35,0x2e,0x33,0x2e,0x31,0x2e,0x33,0x2e,0x33,0x38,0x10,
+0x00,0x0c,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x23,0x72,0x61,0x69,0x73,0x65,0x10,0x00,
+0x0b,0x31,0x35,0x2e,0x33,0x2e,0x31,0x2e,0x33,0x2e,0x34,0x30,0x10,0x00,0x12,0x4b,
+0x65,0x72,0x6e,0x65,0x6c,0x23,0x72,0x65,0x73,0x70,0x6f,0x6e,0x64,0x5f,0x74,0x6f,
+0x3f,0x10,0x00,0x0b,0x31,0x35,0x2e,0x33,0x2e,0x31,0x2e,0x33,0x2e,0x34,0x33,0x10,
+0x00,0x0b,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x23,0x73,0x65,0x6e,0x64,0x10,0x00,0x0b,
+0x31,0x35,0x2e,0x33,0x2e,0x31,0x2e,0x33,0x2e,0x34,0x34,0x10,0x00,0x18,0x4b,0x65,
+0x72,0x6e,0x65,0x6c,0x23,0x73,0x69,0x6e,0x67,0x6c,0x65,0x74,0x6f,0x6e,0x5f,0x6d,
+0x65,0x74,0x68,0x6f,0x64,0x73,0x10,0x00,0x0b,0x31,0x35,0x2e,0x33,0x2e,0x31,0x2e,
+0x33,0x2e,0x34,0x35,0x10,0x00,0x0b,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x23,0x74,0x6f,
+0x5f,0x73,0x10,0x00,0x0b,0x31,0x35,0x2e,0x33,0x2e,0x31,0x2e,0x33,0x2e,0x34,0x36,
+0x10,0x00,0x09,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x23,0x21,0x3d,0x10,0x00,0x12,0x4c,
+0x69,0x74,0x65,0x72,0x61,0x6c,0x73,0x20,0x4e,0x75,0x6d,0x65,0x72,0x69,0x63,0x61,
+0x6c,0x10,0x00,0x07,0x38,0x2e,0x37,0x2e,0x36,0x2e,0x32,0x10,0x00,0x1e,0x4c,0x69,
+0x74,0x65,0x72,0x61,0x6c,0x73,0x20,0x53,0x74,0x72,0x69,0x6e,0x67,0x73,0x20,0x53,
+0x69,0x6e,0x67,0x6c,0x65,0x20,0x51,0x75,0x6f,0x74,0x65,0x64,0x10,0x00,0x09,0x38,
+0x2e,0x37,0x2e,0x36,0x2e,0x33,0x2e,0x32,0x10,0x00,0x1e,0x4c,0x69,0x74,0x65,0x72,
+0x61,0x6c,0x73,0x20,0x53,0x74,0x72,0x69,0x6e,0x67,0x73,0x20,0x44,0x6f,0x75,0x62,
+0x6c,0x65,0x20,0x51,0x75,0x6f,0x74,0x65,0x64,0x10,0x00,0x09,0x38,0x2e,0x37,0x2e,
+0x36,0x2e,0x33,0x2e,0x33,0x10,0x00,0x24,0x4c,0x69,0x74,0x65,0x72,0x61,0x6c,0x73,
+0x20,0x53,0x74,0x72,0x69,0x6e,0x67,0x73,0x20,0x51,0x75,0x6f,0x74,0x65,0x64,0x20,
+0x4e,0x6f,0x6e,0x2d,0x45,0x78,0x70,0x61,0x6e,0x64,0x65,0x64,0x10,0x00,0x09,0x38,
+0x2e,0x37,0x2e,0x36,0x2e,0x33,0x2e,0x34,0x10,0x00,0x20,0x4c,0x69,0x74,0x65,0x72,
+0x61,0x6c,0x73,0x20,0x53,0x74,0x72,0x69,0x6e,0x67,0x73,0x20,0x51,0x75,0x6f,0x74,
+0x65,0x64,0x20,0x45,0x78,0x70,0x61,0x6e,0x64,0x65,0x64,0x10,0x00,0x09,0x38,0x2e,
+0x37,0x2e,0x36,0x2e,0x33,0x2e,0x35,0x10,0x00,0x1f,0x4c,0x69,0x74,0x65,0x72,0x61,
+0x6c,0x73,0x20,0x53,0x74,0x72,0x69,0x6e,0x67,0x73,0x20,0x48,0x65,0x72,0x65,0x20,
+0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x73,0x10,0x00,0x09,0x38,0x2e,0x37,0x2e,
+0x36,0x2e,0x33,0x2e,0x36,0x10,0x00,0x0e,0x4c,0x69,0x74,0x65,0x72,0x61,0x6c,0x73,
+0x20,0x41,0x72,0x72,0x61,0x79,0x10,0x00,0x07,0x38,0x2e,0x37,0x2e,0x36,0x2e,0x34,
+0x10,0x00,0x19,0x4c,0x69,0x74,0x65,0x72,0x61,0x6c,0x73,0x20,0x41,0x72,0x72,0x61,
+0x79,0x20,0x6f,0x66,0x20,0x73,0x79,0x6d,0x62,0x6f,0x6c,0x73,0x10,0x00,0x0f,0x4c,
+0x69,0x74,0x65,0x72,0x61,0x6c,0x73,0x20,0x53,0x79,0x6d,0x62,0x6f,0x6c,0x10,0x00,
+0x07,0x38,0x2e,0x37,0x2e,0x36,0x2e,0x36,0x10,0x00,0x0e,0x4c,0x6f,0x63,0x61,0x6c,
+0x4a,0x75,0x6d,0x6f,0x45,0x72,0x72,0x6f,0x72,0x10,0x00,0x07,0x31,0x35,0x2e,0x32,
+0x2e,0x32,0x35,0x10,0x00,0x06,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x10,0x00,0x06,0x31,
+0x35,0x2e,0x32,0x2e,0x32,0x10,0x00,0x11,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x20,0x73,
+0x75,0x70,0x65,0x72,0x63,0x6c,0x61,0x73,0x73,0x10,0x00,0x08,0x31,0x35,0x2e,0x32,
+0x2e,0x32,0x2e,0x32,0x10,0x00,0x10,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x23,0x61,0x6e,
+0x63,0x65,0x73,0x74,0x6f,0x72,0x73,0x10,0x00,0x0a,0x31,0x35,0x2e,0x32,0x2e,0x32,
+0x2e,0x34,0x2e,0x39,0x10,0x00,0x16,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x23,0x61,0x70,
+0x70,0x65,0x6e,0x64,0x5f,0x66,0x65,0x61,0x74,0x75,0x72,0x65,0x73,0x10,0x00,0x0b,
+0x31,0x35,0x2e,0x32,0x2e,0x32,0x2e,0x34,0x2e,0x31,0x30,0x10,0x00,0x11,0x4d,0x6f,
+0x64,0x75,0x6c,0x65,0x23,0x63,0x6c,0x61,0x73,0x73,0x5f,0x65,0x76,0x61,0x6c,0x10,
+0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x32,0x2e,0x34,0x2e,0x31,0x35,0x10,0x00,0x1e,
+0x4d,0x6f,0x64,0x75,0x6c,0x65,0x23,0x63,0x6c,0x61,0x73,0x73,0x5f,0x76,0x61,0x72,
+0x69,0x61,0x62,0x6c,0x65,0x5f,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x3f,0x10,0x00,
+0x0b,0x31,0x35,0x2e,0x32,0x2e,0x32,0x2e,0x34,0x2e,0x31,0x36,0x10,0x00,0x19,0x4d,
+0x6f,0x64,0x75,0x6c,0x65,0x23,0x63,0x6c,0x61,0x73,0x73,0x5f,0x76,0x61,0x72,0x69,
+0x61,0x62,0x6c,0x65,0x5f,0x67,0x65,0x74,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,
+0x32,0x2e,0x34,0x2e,0x31,0x37,0x10,0x00,0x19,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x23,
+0x63,0x6c,0x61,0x73,0x73,0x5f,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x5f,0x73,
+0x65,0x74,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x32,0x2e,0x34,0x2e,0x31,0x38,
+0x10,0x00,0x16,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x23,0x63,0x6c,0x61,0x73,0x73,0x5f,
+0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x73,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,
+0x2e,0x32,0x2e,0x34,0x2e,0x31,0x39,0x10,0x00,0x15,0x4d,0x6f,0x64,0x75,0x6c,0x65,
+0x23,0x63,0x6f,0x6e,0x73,0x74,0x5f,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x3f,0x10,
+0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x32,0x2e,0x34,0x2e,0x32,0x30,0x10,0x00,0x10,
+0x4d,0x6f,0x64,0x75,0x6c,0x65,0x23,0x63,0x6f,0x6e,0x73,0x74,0x5f,0x67,0x65,0x74,
+0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x32,0x2e,0x34,0x2e,0x32,0x31,0x10,0x00,
+0x14,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x2e,0x63,0x6f,0x6e,0x73,0x74,0x5f,0x6d,0x69,
+0x73,0x73,0x69,0x6e,0x67,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x32,0x2e,0x34,
+0x2e,0x32,0x32,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x32,0x2e,0x34,0x2e,0x32,
+0x33,0x10,0x00,0x10,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x2e,0x63,0x6f,0x6e,0x73,0x74,
+0x61,0x6e,0x74,0x73,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x32,0x2e,0x34,0x2e,
+0x32,0x34,0x10,0x00,0x0e,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x23,0x69,0x6e,0x63,0x6c,
+0x75,0x64,0x65,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x32,0x2e,0x34,0x2e,0x32,
+0x37,0x10,0x00,0x0f,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x23,0x69,0x6e,0x63,0x6c,0x75,
+0x64,0x65,0x3f,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x32,0x2e,0x34,0x2e,0x32,
+0x38,0x10,0x00,0x0f,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x23,0x69,0x6e,0x63,0x6c,0x75,
+0x64,0x65,0x64,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x32,0x2e,0x34,0x2e,0x32,
+0x39,0x10,0x00,0x17,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x23,0x69,0x6e,0x63,0x6c,0x75,
+0x64,0x65,0x64,0x5f,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x73,0x10,0x00,0x0b,0x31,0x35,
+0x2e,0x32,0x2e,0x32,0x2e,0x34,0x2e,0x33,0x30,0x10,0x00,0x17,0x4d,0x6f,0x64,0x75,
+0x6c,0x65,0x23,0x69,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x6d,0x65,0x74,0x68,
+0x6f,0x64,0x73,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x32,0x2e,0x34,0x2e,0x33,
+0x33,0x10,0x00,0x16,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x23,0x6d,0x65,0x74,0x68,0x6f,
+0x64,0x5f,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x3f,0x10,0x00,0x0b,0x31,0x35,0x2e,
+0x32,0x2e,0x32,0x2e,0x34,0x2e,0x33,0x34,0x10,0x00,0x12,0x4d,0x6f,0x64,0x75,0x6c,
+0x65,0x23,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x5f,0x65,0x76,0x61,0x6c,0x10,0x00,0x0b,
+0x31,0x35,0x2e,0x32,0x2e,0x32,0x2e,0x34,0x2e,0x33,0x35,0x10,0x00,0x1c,0x4d,0x6f,
+0x64,0x75,0x6c,0x65,0x23,0x72,0x65,0x6d,0x6f,0x76,0x65,0x5f,0x63,0x6c,0x61,0x73,
+0x73,0x5f,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x10,0x00,0x0b,0x31,0x35,0x2e,
+0x32,0x2e,0x32,0x2e,0x34,0x2e,0x33,0x39,0x10,0x00,0x13,0x4d,0x6f,0x64,0x75,0x6c,
+0x65,0x23,0x72,0x65,0x6d,0x6f,0x76,0x65,0x5f,0x63,0x6f,0x6e,0x73,0x74,0x10,0x00,
+0x0b,0x31,0x35,0x2e,0x32,0x2e,0x32,0x2e,0x34,0x2e,0x34,0x30,0x10,0x00,0x14,0x4d,
+0x6f,0x64,0x75,0x6c,0x65,0x23,0x72,0x65,0x6d,0x6f,0x76,0x65,0x5f,0x6d,0x65,0x74,
+0x68,0x6f,0x64,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x32,0x2e,0x34,0x2e,0x34,
+0x31,0x10,0x00,0x13,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x2e,0x75,0x6e,0x64,0x65,0x66,
+0x5f,0x6d,0x65,0x74,0x68,0x6f,0x64,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x32,
+0x2e,0x34,0x2e,0x34,0x32,0x10,0x00,0x0b,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x23,0x74,
+0x6f,0x5f,0x73,0x10,0x00,0x0e,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x23,0x69,0x6e,0x73,
+0x70,0x65,0x63,0x74,0x10,0x00,0x09,0x4e,0x61,0x6d,0x65,0x45,0x72,0x72,0x6f,0x72,
+0x10,0x00,0x07,0x31,0x35,0x2e,0x32,0x2e,0x33,0x31,0x10,0x00,0x14,0x4e,0x61,0x6d,
+0x65,0x45,0x72,0x72,0x6f,0x72,0x20,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,0x73,
+0x73,0x10,0x00,0x09,0x31,0x35,0x2e,0x32,0x2e,0x33,0x31,0x2e,0x32,0x10,0x00,0x0e,
+0x4e,0x61,0x6d,0x65,0x45,0x72,0x72,0x6f,0x72,0x23,0x6e,0x61,0x6d,0x65,0x10,0x00,
+0x0b,0x31,0x35,0x2e,0x32,0x2e,0x33,0x31,0x2e,0x32,0x2e,0x31,0x10,0x00,0x14,0x4e,
+0x61,0x6d,0x65,0x45,0x72,0x72,0x6f,0x72,0x23,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,
+0x69,0x7a,0x65,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x33,0x31,0x2e,0x32,0x2e,
+0x32,0x10,0x00,0x08,0x4e,0x69,0x6c,0x43,0x6c,0x61,0x73,0x73,0x10,0x00,0x06,0x31,
+0x35,0x2e,0x32,0x2e,0x34,0x10,0x00,0x0a,0x4e,0x69,0x6c,0x43,0x6c,0x61,0x73,0x73,
+0x23,0x26,0x10,0x00,0x0a,0x31,0x35,0x2e,0x32,0x2e,0x34,0x2e,0x33,0x2e,0x31,0x10,
+0x00,0x0a,0x4e,0x69,0x6c,0x43,0x6c,0x61,0x73,0x73,0x23,0x5e,0x10,0x00,0x0a,0x31,
+0x35,0x2e,0x32,0x2e,0x34,0x2e,0x33,0x2e,0x32,0x10,0x00,0x0a,0x4e,0x69,0x6c,0x43,
+0x6c,0x61,0x73,0x73,0x23,0x7c,0x10,0x00,0x0a,0x31,0x35,0x2e,0x32,0x2e,0x34,0x2e,
+0x33,0x2e,0x33,0x10,0x00,0x0d,0x4e,0x69,0x6c,0x43,0x6c,0x61,0x73,0x73,0x23,0x6e,
+0x69,0x6c,0x3f,0x10,0x00,0x0a,0x31,0x35,0x2e,0x32,0x2e,0x34,0x2e,0x33,0x2e,0x34,
+0x10,0x00,0x0d,0x4e,0x69,0x6c,0x43,0x6c,0x61,0x73,0x73,0x23,0x74,0x6f,0x5f,0x73,
+0x10,0x00,0x0a,0x31,0x35,0x2e,0x32,0x2e,0x34,0x2e,0x33,0x2e,0x35,0x10,0x00,0x0d,
+0x4e,0x6f,0x4d,0x65,0x74,0x68,0x6f,0x64,0x45,0x72,0x72,0x6f,0x72,0x10,0x00,0x07,
+0x31,0x35,0x2e,0x32,0x2e,0x33,0x32,0x10,0x00,0x18,0x4e,0x6f,0x4d,0x65,0x74,0x68,
+0x6f,0x64,0x45,0x72,0x72,0x6f,0x72,0x20,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,
+0x73,0x73,0x10,0x00,0x09,0x31,0x35,0x2e,0x32,0x2e,0x33,0x32,0x2e,0x32,0x10,0x00,
+0x07,0x4e,0x75,0x6d,0x65,0x72,0x69,0x63,0x10,0x00,0x06,0x31,0x35,0x2e,0x32,0x2e,
+0x37,0x10,0x00,0x12,0x4e,0x75,0x6d,0x65,0x72,0x69,0x63,0x20,0x73,0x75,0x70,0x65,
+0x72,0x63,0x6c,0x61,0x73,0x73,0x10,0x00,0x08,0x31,0x35,0x2e,0x32,0x2e,0x37,0x2e,
+0x32,0x10,0x00,0x0a,0x4e,0x75,0x6d,0x65,0x72,0x69,0x63,0x23,0x2b,0x40,0x10,0x00,
+0x0a,0x31,0x35,0x2e,0x32,0x2e,0x37,0x2e,0x34,0x2e,0x31,0x10,0x00,0x0a,0x4e,0x75,
+0x6d,0x65,0x72,0x69,0x63,0x23,0x2d,0x40,0x10,0x00,0x0a,0x31,0x35,0x2e,0x32,0x2e,
+0x37,0x2e,0x34,0x2e,0x32,0x10,0x00,0x0b,0x4e,0x75,0x6d,0x65,0x72,0x69,0x63,0x23,
+0x61,0x62,0x73,0x10,0x00,0x0a,0x31,0x35,0x2e,0x32,0x2e,0x37,0x2e,0x34,0x2e,0x33,
+0x10,0x00,0x0a,0x4e,0x75,0x6d,0x65,0x72,0x69,0x63,0x23,0x2a,0x2a,0x10,0x00,0x06,
+0x4f,0x62,0x6a,0x65,0x63,0x74,0x10,0x00,0x06,0x31,0x35,0x2e,0x32,0x2e,0x31,0x10,
+0x00,0x11,0x4f,0x62,0x6a,0x65,0x63,0x74,0x20,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,
+0x61,0x73,0x73,0x10,0x00,0x08,0x31,0x35,0x2e,0x32,0x2e,0x31,0x2e,0x32,0x10,0x00,
+0x04,0x50,0x72,0x6f,0x63,0x10,0x00,0x07,0x31,0x35,0x2e,0x32,0x2e,0x31,0x37,0x10,
+0x00,0x0f,0x50,0x72,0x6f,0x63,0x20,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,0x73,
+0x73,0x10,0x00,0x09,0x31,0x35,0x2e,0x32,0x2e,0x31,0x37,0x2e,0x32,0x10,0x00,0x08,
+0x50,0x72,0x6f,0x63,0x2e,0x6e,0x65,0x77,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,
+0x31,0x37,0x2e,0x33,0x2e,0x31,0x10,0x00,0x07,0x50,0x72,0x6f,0x63,0x23,0x5b,0x5d,
+0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x37,0x2e,0x34,0x2e,0x31,0x10,0x00,
+0x0a,0x50,0x72,0x6f,0x63,0x23,0x61,0x72,0x69,0x74,0x79,0x10,0x00,0x0b,0x31,0x35,
+0x2e,0x32,0x2e,0x31,0x37,0x2e,0x34,0x2e,0x32,0x10,0x00,0x09,0x50,0x72,0x6f,0x63,
+0x23,0x63,0x61,0x6c,0x6c,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x37,0x2e,
+0x34,0x2e,0x33,0x10,0x00,0x05,0x52,0x61,0x6e,0x67,0x65,0x10,0x00,0x07,0x31,0x35,
+0x2e,0x32,0x2e,0x31,0x34,0x10,0x00,0x10,0x52,0x61,0x6e,0x67,0x65,0x20,0x73,0x75,
+0x70,0x65,0x72,0x63,0x6c,0x61,0x73,0x73,0x10,0x00,0x09,0x31,0x35,0x2e,0x32,0x2e,
+0x31,0x34,0x2e,0x32,0x10,0x00,0x08,0x52,0x61,0x6e,0x67,0x65,0x23,0x3d,0x3d,0x10,
+0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x34,0x2e,0x34,0x2e,0x31,0x10,0x00,0x09,
+0x52,0x61,0x6e,0x67,0x65,0x23,0x3d,0x3d,0x3d,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,
+0x2e,0x31,0x34,0x2e,0x34,0x2e,0x32,0x10,0x00,0x0b,0x52,0x61,0x6e,0x67,0x65,0x23,
+0x62,0x65,0x67,0x69,0x6e,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x34,0x2e,
+0x34,0x2e,0x33,0x10,0x00,0x0a,0x52,0x61,0x6e,0x67,0x65,0x23,0x65,0x61,0x63,0x68,
+0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x34,0x2e,0x34,0x2e,0x34,0x10,0x00,
+0x09,0x52,0x61,0x6e,0x67,0x65,0x23,0x65,0x6e,0x64,0x10,0x00,0x0b,0x31,0x35,0x2e,
+0x32,0x2e,0x31,0x34,0x2e,0x34,0x2e,0x35,0x10,0x00,0x12,0x52,0x61,0x6e,0x67,0x65,
+0x23,0x65,0x78,0x63,0x6c,0x75,0x64,0x65,0x5f,0x65,0x6e,0x64,0x3f,0x10,0x00,0x0b,
+0x31,0x35,0x2e,0x32,0x2e,0x31,0x34,0x2e,0x34,0x2e,0x36,0x10,0x00,0x0b,0x52,0x61,
+0x6e,0x67,0x65,0x23,0x66,0x69,0x72,0x73,0x74,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,
+0x2e,0x31,0x34,0x2e,0x34,0x2e,0x37,0x10,0x00,0x0d,0x52,0x61,0x6e,0x67,0x65,0x23,
+0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,
+0x34,0x2e,0x34,0x2e,0x38,0x10,0x00,0x10,0x52,0x61,0x6e,0x67,0x65,0x23,0x69,0x6e,
+0x69,0x74,0x69,0x61,0x6c,0x69,0x7a,0x65,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,
+0x31,0x34,0x2e,0x34,0x2e,0x39,0x10,0x00,0x0a,0x52,0x61,0x6e,0x67,0x65,0x23,0x6c,
+0x61,0x73,0x74,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x34,0x2e,0x34,0x2e,
+0x31,0x30,0x10,0x00,0x0d,0x52,0x61,0x6e,0x67,0x65,0x23,0x6d,0x65,0x6d,0x62,0x65,
+0x72,0x3f,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x34,0x2e,0x34,0x2e,0x31,
+0x31,0x10,0x00,0x0a,0x52,0x61,0x6e,0x67,0x65,0x45,0x72,0x72,0x6f,0x72,0x10,0x00,
+0x07,0x31,0x35,0x2e,0x32,0x2e,0x32,0x36,0x10,0x00,0x15,0x52,0x61,0x6e,0x67,0x65,
+0x45,0x72,0x72,0x6f,0x72,0x20,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,0x73,0x73,
+0x10,0x00,0x09,0x31,0x35,0x2e,0x32,0x2e,0x32,0x36,0x2e,0x32,0x10,0x00,0x0c,0x52,
+0x75,0x6e,0x74,0x69,0x6d,0x65,0x45,0x72,0x72,0x6f,0x72,0x10,0x00,0x07,0x31,0x35,
+0x2e,0x32,0x2e,0x32,0x38,0x10,0x00,0x0d,0x53,0x74,0x61,0x6e,0x64,0x61,0x72,0x64,
+0x45,0x72,0x72,0x6f,0x72,0x10,0x00,0x07,0x31,0x35,0x2e,0x32,0x2e,0x32,0x33,0x10,
+0x00,0x18,0x53,0x74,0x61,0x6e,0x64,0x61,0x72,0x64,0x45,0x72,0x72,0x6f,0x72,0x20,
+0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,0x73,0x73,0x10,0x00,0x09,0x31,0x35,0x2e,
+0x32,0x2e,0x32,0x33,0x2e,0x32,0x10,0x00,0x06,0x53,0x74,0x72,0x69,0x6e,0x67,0x10,
+0x00,0x07,0x31,0x35,0x2e,0x32,0x2e,0x31,0x30,0x10,0x00,0x11,0x53,0x74,0x72,0x69,
+0x6e,0x67,0x20,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,0x73,0x73,0x10,0x00,0x09,
+0x31,0x35,0x2e,0x32,0x2e,0x31,0x30,0x2e,0x32,0x10,0x00,0x08,0x53,0x74,0x72,0x69,
+0x6e,0x67,0x23,0x2a,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x30,0x2e,0x35,
+0x2e,0x31,0x10,0x00,0x08,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x2b,0x10,0x00,0x0b,
+0x31,0x35,0x2e,0x32,0x2e,0x31,0x30,0x2e,0x35,0x2e,0x32,0x10,0x00,0x0a,0x53,0x74,
+0x72,0x69,0x6e,0x67,0x23,0x3c,0x3d,0x3e,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,
+0x31,0x30,0x2e,0x35,0x2e,0x33,0x10,0x00,0x09,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,
+0x3d,0x3d,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x30,0x2e,0x35,0x2e,0x34,
+0x10,0x00,0x09,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x5b,0x5d,0x10,0x00,0x0b,0x31,
+0x35,0x2e,0x32,0x2e,0x31,0x30,0x2e,0x35,0x2e,0x36,0x10,0x00,0x14,0x53,0x74,0x72,
+0x69,0x6e,0x67,0x23,0x5b,0x5d,0x20,0x77,0x69,0x74,0x68,0x20,0x52,0x61,0x6e,0x67,
+0x65,0x10,0x00,0x11,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x63,0x61,0x70,0x69,0x74,
+0x61,0x6c,0x69,0x7a,0x65,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x30,0x2e,
+0x35,0x2e,0x37,0x10,0x00,0x12,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x63,0x61,0x70,
+0x69,0x74,0x61,0x6c,0x69,0x7a,0x65,0x21,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,
+0x31,0x30,0x2e,0x35,0x2e,0x38,0x10,0x00,0x0c,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,
+0x63,0x68,0x6f,0x6d,0x70,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x30,0x2e,
+0x35,0x2e,0x39,0x10,0x00,0x0d,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x63,0x68,0x6f,
+0x6d,0x70,0x21,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x30,0x2e,0x35,0x2e,
+0x31,0x30,0x10,0x00,0x0b,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x63,0x68,0x6f,0x70,
+0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x30,0x2e,0x35,0x2e,0x31,0x31,0x10,
+0x00,0x0c,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x63,0x68,0x6f,0x70,0x21,0x10,0x00,
+0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x30,0x2e,0x35,0x2e,0x31,0x32,0x10,0x00,0x0f,
+0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x64,0x6f,0x77,0x6e,0x63,0x61,0x73,0x65,0x10,
+0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x30,0x2e,0x35,0x2e,0x31,0x33,0x10,0x00,
+0x10,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x64,0x6f,0x77,0x6e,0x63,0x61,0x73,0x65,
+0x21,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x30,0x2e,0x35,0x2e,0x31,0x34,
+0x10,0x00,0x10,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x65,0x61,0x63,0x68,0x5f,0x6c,
+0x69,0x6e,0x65,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x30,0x2e,0x35,0x2e,
+0x31,0x35,0x10,0x00,0x0d,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x65,0x6d,0x70,0x74,
+0x79,0x3f,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x30,0x2e,0x35,0x2e,0x31,
+0x36,0x10,0x00,0x0b,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x65,0x71,0x6c,0x3f,0x10,
+0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x30,0x2e,0x35,0x2e,0x31,0x37,0x10,0x00,
+0x0b,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x67,0x73,0x75,0x62,0x10,0x00,0x0c,0x31,
+0x35,0x2e,0x32,0x2e,0x31,0x30,0x2e,0x35,0x2e,0x31,0x38,0x10,0x00,0x0c,0x53,0x74,
+0x72,0x69,0x6e,0x67,0x23,0x67,0x73,0x75,0x62,0x21,0x10,0x00,0x0c,0x31,0x35,0x2e,
+0x32,0x2e,0x31,0x30,0x2e,0x35,0x2e,0x31,0x39,0x10,0x00,0x0b,0x53,0x74,0x72,0x69,
+0x6e,0x67,0x23,0x68,0x61,0x73,0x68,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,
+0x30,0x2e,0x35,0x2e,0x32,0x30,0x10,0x00,0x0f,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,
+0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x3f,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,
+0x31,0x30,0x2e,0x35,0x2e,0x32,0x31,0x10,0x00,0x0c,0x53,0x74,0x72,0x69,0x6e,0x67,
+0x23,0x69,0x6e,0x64,0x65,0x78,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x30,
+0x2e,0x35,0x2e,0x32,0x32,0x10,0x00,0x11,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x69,
+0x6e,0x69,0x74,0x69,0x61,0x6c,0x69,0x7a,0x65,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,
+0x2e,0x31,0x30,0x2e,0x35,0x2e,0x32,0x33,0x10,0x00,0x16,0x53,0x74,0x72,0x69,0x6e,
+0x67,0x23,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x69,0x7a,0x65,0x5f,0x63,0x6f,0x70,
+0x79,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x30,0x2e,0x35,0x2e,0x32,0x34,
+0x10,0x00,0x0d,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x69,0x6e,0x74,0x65,0x72,0x6e,
+0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x30,0x2e,0x35,0x2e,0x32,0x35,0x10,
+0x00,0x0d,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x6c,0x65,0x6e,0x67,0x74,0x68,0x10,
+0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x30,0x2e,0x35,0x2e,0x32,0x36,0x10,0x00,
+0x0e,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x72,0x65,0x70,0x6c,0x61,0x63,0x65,0x10,
+0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x30,0x2e,0x35,0x2e,0x32,0x38,0x10,0x00,
+0x0e,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x72,0x65,0x76,0x65,0x72,0x73,0x65,0x10,
+0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x30,0x2e,0x35,0x2e,0x32,0x39,0x10,0x00,
+0x0f,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x72,0x65,0x76,0x65,0x72,0x73,0x65,0x21,
+0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x30,0x2e,0x35,0x2e,0x33,0x30,0x10,
+0x00,0x0d,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x72,0x69,0x6e,0x64,0x65,0x78,0x10,
+0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x30,0x2e,0x35,0x2e,0x33,0x31,0x10,0x00,
+0x0b,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x73,0x69,0x7a,0x65,0x10,0x00,0x0c,0x31,
+0x35,0x2e,0x32,0x2e,0x31,0x30,0x2e,0x35,0x2e,0x33,0x33,0x10,0x00,0x0c,0x53,0x74,
+0x72,0x69,0x6e,0x67,0x23,0x73,0x6c,0x69,0x63,0x65,0x10,0x00,0x0c,0x31,0x35,0x2e,
+0x32,0x2e,0x31,0x30,0x2e,0x35,0x2e,0x33,0x34,0x10,0x00,0x0c,0x53,0x74,0x72,0x69,
+0x6e,0x67,0x23,0x73,0x70,0x6c,0x69,0x74,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,
+0x31,0x30,0x2e,0x35,0x2e,0x33,0x35,0x10,0x00,0x0a,0x53,0x74,0x72,0x69,0x6e,0x67,
+0x23,0x73,0x75,0x62,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x30,0x2e,0x35,
+0x2e,0x33,0x36,0x10,0x00,0x0b,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x73,0x75,0x62,
+0x21,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x30,0x2e,0x35,0x2e,0x33,0x37,
+0x10,0x00,0x0b,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x74,0x6f,0x5f,0x69,0x10,0x00,
+0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x30,0x2e,0x35,0x2e,0x33,0x38,0x10,0x00,0x0b,
+0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x74,0x6f,0x5f,0x66,0x10,0x00,0x0c,0x31,0x35,
+0x2e,0x32,0x2e,0x31,0x30,0x2e,0x35,0x2e,0x33,0x39,0x10,0x00,0x0b,0x53,0x74,0x72,
+0x69,0x6e,0x67,0x23,0x74,0x6f,0x5f,0x73,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,
+0x31,0x30,0x2e,0x35,0x2e,0x34,0x30,0x10,0x00,0x0d,0x53,0x74,0x72,0x69,0x6e,0x67,
+0x23,0x74,0x6f,0x5f,0x73,0x79,0x6d,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,
+0x30,0x2e,0x35,0x2e,0x34,0x31,0x10,0x00,0x0d,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,
+0x75,0x70,0x63,0x61,0x73,0x65,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x30,
+0x2e,0x35,0x2e,0x34,0x32,0x10,0x00,0x0e,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x75,
+0x70,0x63,0x61,0x73,0x65,0x21,0x10,0x00,0x0c,0x31,0x35,0x2e,0x32,0x2e,0x31,0x30,
+0x2e,0x35,0x2e,0x34,0x33,0x10,0x00,0x38,0x53,0x74,0x72,0x69,0x6e,0x67,0x20,0x69,
+0x6e,0x74,0x65,0x72,0x70,0x6f,0x6c,0x61,0x74,0x69,0x6f,0x6e,0x20,0x28,0x6d,0x72,
+0x62,0x5f,0x73,0x74,0x72,0x5f,0x63,0x6f,0x6e,0x63,0x61,0x74,0x20,0x66,0x6f,0x72,
+0x20,0x73,0x68,0x61,0x72,0x65,0x64,0x20,0x73,0x74,0x72,0x69,0x6e,0x67,0x73,0x29,
+0x10,0x00,0x22,0x43,0x68,0x65,0x63,0x6b,0x20,0x74,0x68,0x65,0x20,0x75,0x73,0x61,
+0x67,0x65,0x20,0x6f,0x66,0x20,0x61,0x20,0x4e,0x55,0x4c,0x20,0x63,0x68,0x61,0x72,
+0x61,0x63,0x74,0x65,0x72,0x10,0x00,0x0c,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x62,
+0x79,0x74,0x65,0x73,0x10,0x00,0x10,0x53,0x74,0x72,0x69,0x6e,0x67,0x23,0x65,0x61,
+0x63,0x68,0x5f,0x62,0x79,0x74,0x65,0x10,0x00,0x06,0x53,0x79,0x6d,0x62,0x6f,0x6c,
+0x10,0x00,0x07,0x31,0x35,0x2e,0x32,0x2e,0x31,0x31,0x10,0x00,0x11,0x53,0x79,0x6d,
+0x62,0x6f,0x6c,0x20,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,0x73,0x73,0x10,0x00,
+0x09,0x31,0x35,0x2e,0x32,0x2e,0x31,0x31,0x2e,0x32,0x10,0x00,0x0a,0x53,0x79,0x6d,
+0x62,0x6f,0x6c,0x23,0x3d,0x3d,0x3d,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,
+0x31,0x2e,0x33,0x2e,0x31,0x10,0x00,0x0e,0x53,0x79,0x6d,0x62,0x6f,0x6c,0x23,0x69,
+0x64,0x32,0x6e,0x61,0x6d,0x65,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x31,
+0x2e,0x33,0x2e,0x32,0x10,0x00,0x0b,0x53,0x79,0x6d,0x62,0x6f,0x6c,0x23,0x74,0x6f,
+0x5f,0x73,0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x31,0x2e,0x33,0x2e,0x33,
+0x10,0x00,0x0d,0x53,0x79,0x6d,0x62,0x6f,0x6c,0x23,0x74,0x6f,0x5f,0x73,0x79,0x6d,
+0x10,0x00,0x0b,0x31,0x35,0x2e,0x32,0x2e,0x31,0x31,0x2e,0x33,0x2e,0x34,0x10,0x00,
+0x05,0x73,0x75,0x70,0x65,0x72,0x10,0x00,0x06,0x31,0x31,0x2e,0x33,0x2e,0x34,0x10,
+0x00,0x05,0x79,0x69,0x65,0x6c,0x64,0x10,0x00,0x06,0x31,0x31,0x2e,0x33,0x2e,0x35,
+0x10,0x00,0x1f,0x41,0x62,0x62,0x72,0x65,0x76,0x69,0x61,0x74,0x65,0x64,0x20,0x76,
+0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x20,0x61,0x73,0x73,0x69,0x67,0x6e,0x6d,0x65,
+0x6e,0x74,0x10,0x00,0x0a,0x31,0x31,0x2e,0x34,0x2e,0x32,0x2e,0x33,0x2e,0x32,0x10,
+0x00,0x16,0x4e,0x65,0x73,0x74,0x65,0x64,0x20,0x63,0x6f,0x6e,0x73,0x74,0x20,0x72,
+0x65,0x66,0x65,0x72,0x65,0x6e,0x63,0x65,0x10,0x00,0x2a,0x41,0x62,0x62,0x72,0x65,
+0x76,0x69,0x61,0x74,0x65,0x64,0x20,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x20,
+0x61,0x73,0x73,0x69,0x67,0x6e,0x6d,0x65,0x6e,0x74,0x20,0x61,0x73,0x20,0x72,0x65,
+0x74,0x75,0x72,0x6e,0x73,0x10,0x00,0x09,0x54,0x72,0x75,0x65,0x43,0x6c,0x61,0x73,
+0x73,0x10,0x00,0x06,0x31,0x35,0x2e,0x32,0x2e,0x35,0x10,0x00,0x14,0x54,0x72,0x75,
+0x65,0x43,0x6c,0x61,0x73,0x73,0x20,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,0x73,
+0x73,0x10,0x00,0x08,0x31,0x35,0x2e,0x32,0x2e,0x35,0x2e,0x32,0x10,0x00,0x0e,0x54,
+0x72,0x75,0x65,0x43,0x6c,0x61,0x73,0x73,0x20,0x74,0x72,0x75,0x65,0x10,0x00,0x08,
+0x31,0x35,0x2e,0x32,0x2e,0x35,0x2e,0x31,0x10,0x00,0x0b,0x54,0x72,0x75,0x65,0x43,
+0x6c,0x61,0x73,0x73,0x23,0x26,0x10,0x00,0x0a,0x31,0x35,0x2e,0x32,0x2e,0x35,0x2e,
+0x33,0x2e,0x31,0x10,0x00,0x0b,0x54,0x72,0x75,0x65,0x43,0x6c,0x61,0x73,0x73,0x23,
+0x5e,0x10,0x00,0x0a,0x31,0x35,0x2e,0x32,0x2e,0x35,0x2e,0x33,0x2e,0x32,0x10,0x00,
+0x0e,0x54,0x72,0x75,0x65,0x43,0x6c,0x61,0x73,0x73,0x23,0x74,0x6f,0x5f,0x73,0x10,
+0x00,0x0a,0x31,0x35,0x2e,0x32,0x2e,0x35,0x2e,0x33,0x2e,0x33,0x10,0x00,0x0b,0x54,
+0x72,0x75,0x65,0x43,0x6c,0x61,0x73,0x73,0x23,0x7c,0x10,0x00,0x0a,0x31,0x35,0x2e,
+0x32,0x2e,0x35,0x2e,0x33,0x2e,0x34,0x10,0x00,0x09,0x54,0x79,0x70,0x65,0x45,0x72,
+0x72,0x6f,0x72,0x10,0x00,0x07,0x31,0x35,0x2e,0x32,0x2e,0x32,0x39,0x10,0x00,0x14,
+0x54,0x79,0x70,0x65,0x45,0x72,0x72,0x6f,0x72,0x20,0x73,0x75,0x70,0x65,0x72,0x63,
+0x6c,0x61,0x73,0x73,0x10,0x00,0x09,0x31,0x35,0x2e,0x32,0x2e,0x32,0x39,0x2e,0x32,
+0x00,0x00,0x00,0x17,0x00,0x08,0x24,0x6f,0x6b,0x5f,0x74,0x65,0x73,0x74,0x00,0x00,
+0x08,0x24,0x6b,0x6f,0x5f,0x74,0x65,0x73,0x74,0x00,0x00,0x0a,0x24,0x6b,0x69,0x6c,
+0x6c,0x5f,0x74,0x65,0x73,0x74,0x00,0x00,0x08,0x24,0x61,0x73,0x73,0x65,0x72,0x74,
+0x73,0x00,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x0e,0x63,0x6f,0x6e,
+0x73,0x74,0x5f,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x3f,0x00,0x00,0x04,0x54,0x69,
+0x6d,0x65,0x00,0x00,0x03,0x6e,0x6f,0x77,0x00,0x00,0x0b,0x24,0x74,0x65,0x73,0x74,
+0x5f,0x73,0x74,0x61,0x72,0x74,0x00,0x00,0x10,0x61,0x73,0x73,0x65,0x72,0x74,0x69,
+0x6f,0x6e,0x5f,0x73,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x06,0x61,0x73,0x73,0x65,
+0x72,0x74,0x00,0x00,0x0e,0x61,0x73,0x73,0x65,0x72,0x74,0x69,0x6f,0x6e,0x5f,0x64,
+0x69,0x66,0x66,0x00,0x00,0x0b,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x74,0x72,0x75,
+0x65,0x00,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x65,0x71,0x75,0x61,0x6c,
+0x00,0x00,0x0a,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x6e,0x69,0x6c,0x00,0x00,0x0e,
+0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x00,0x00,
+0x0c,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x06,
+0x72,0x65,0x70,0x6f,0x72,0x74,0x00,0x00,0x0b,0x63,0x68,0x65,0x63,0x6b,0x5f,0x66,
+0x6c,0x6f,0x61,0x74,0x00,0x00,0x13,0x4e,0x6f,0x74,0x49,0x6d,0x70,0x6c,0x65,0x6d,
+0x65,0x6e,0x74,0x65,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x0d,0x4d,0x52,0x75,
+0x62,0x79,0x54,0x65,0x73,0x74,0x53,0x6b,0x69,0x70,0x00,0x00,0x04,0x73,0x6b,0x69,
+0x70,0x00,0x00,0x10,0x65,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x5f,0x74,0x65,
+0x73,0x74,0x31,0x34,0x00,0x00,0x00,0x01,0x7c,0x00,0x07,0x00,0x0a,0x00,0x00,0x00,
+0x3a,0x04,0x20,0x00,0x26,0x00,0x40,0x01,0x17,0x00,0x40,0x01,0x17,0x00,0x40,0x01,
+0x17,0x01,0x80,0x00,0x05,0x02,0x00,0x00,0x05,0x03,0x80,0x00,0x3d,0x04,0x00,0x40,
+0x01,0x03,0x82,0x00,0x3e,0x04,0x00,0x80,0x01,0x03,0x82,0x00,0x3e,0x03,0x01,0xc0,
+0x01,0x03,0x80,0xc0,0x01,0x03,0xc0,0x01,0x99,0x03,0x80,0xc0,0x01,0x04,0x00,0x00,
+0x3d,0x03,0x80,0x00,0xa0,0x03,0xc0,0x04,0x19,0x03,0x81,0x80,0x01,0x04,0x00,0x00,
+0xbd,0x04,0x80,0xc0,0x01,0x04,0x02,0x40,0x3e,0x04,0x80,0x01,0x3d,0x04,0x02,0x40,
+0x3e,0x03,0x80,0x40,0xac,0x03,0x01,0xc0,0x01,0x03,0x81,0x00,0x01,0x03,0xc0,0x03,
+0x99,0x03,0x81,0x80,0x01,0x04,0x00,0x01,0xbd,0x04,0x81,0x00,0x01,0x04,0x80,0x80,
+0x20,0x04,0x02,0x40,0x3e,0x03,0x80,0x40,0xac,0x03,0x01,0xc0,0x01,0x03,0x80,0x01,
+0x91,0x04,0x00,0x02,0x84,0x03,0x81,0x00,0xa0,0x03,0xc0,0x04,0x19,0x03,0x81,0x80,
+0x01,0x04,0x00,0x02,0x3d,0x04,0x80,0x02,0x91,0x04,0x02,0x40,0x3e,0x04,0x80,0x02,
+0xbd,0x04,0x02,0x40,0x3e,0x03,0x80,0x40,0xac,0x03,0x01,0xc0,0x01,0x03,0x80,0x03,
+0x09,0x03,0xc0,0x02,0x19,0x03,0x80,0x03,0x09,0x03,0x81,0xc0,0x20,0x04,0x3f,0xff,
+0x83,0x03,0x82,0x00,0xb5,0x03,0xc0,0x01,0x99,0x03,0x80,0x03,0x09,0x04,0x00,0x03,
+0x40,0x03,0x82,0x40,0x21,0x03,0x00,0x00,0x29,0x00,0x00,0x00,0x06,0x10,0x00,0x00,
+0x10,0x00,0x02,0x20,0x5b,0x10,0x00,0x01,0x5d,0x10,0x00,0x04,0x20,0x3d,0x3e,0x20,
+0x10,0x00,0x0b,0x20,0x28,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x3a,0x20,0x10,0x00,
+0x01,0x29,0x00,0x00,0x00,0x0a,0x00,0x02,0x21,0x3d,0x00,0x00,0x01,0x2b,0x00,0x00,
+0x07,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x00,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,
+0x74,0x00,0x00,0x0e,0x63,0x6f,0x6e,0x73,0x74,0x5f,0x64,0x65,0x66,0x69,0x6e,0x65,
+0x64,0x3f,0x00,0x00,0x07,0x47,0x45,0x4d,0x4e,0x41,0x4d,0x45,0x00,0x00,0x0f,0x24,
+0x6d,0x72,0x62,0x74,0x65,0x73,0x74,0x5f,0x61,0x73,0x73,0x65,0x72,0x74,0x00,0x00,
+0x04,0x73,0x69,0x7a,0x65,0x00,0x00,0x01,0x3e,0x00,0x00,0x04,0x65,0x61,0x63,0x68,
+0x00,0x00,0x00,0x00,0x7d,0x00,0x05,0x00,0x08,0x00,0x00,0x00,0x10,0x06,0x00,0x00,
+0x26,0x02,0x81,0x80,0x15,0x03,0x00,0x00,0x3d,0x03,0x80,0x40,0x01,0x03,0x01,0xc0,
+0x3e,0x03,0x80,0x00,0xbd,0x03,0x01,0xc0,0x3e,0x03,0x80,0x80,0x01,0x03,0x01,0xc0,
+0x3e,0x03,0x80,0x01,0x3d,0x03,0x01,0xc0,0x3e,0x03,0x80,0xc0,0x01,0x03,0x01,0xc0,
+0x3e,0x02,0x80,0x00,0xac,0x02,0x81,0x80,0x16,0x02,0x80,0x00,0x29,0x00,0x00,0x00,
+0x04,0x10,0x00,0x0e,0x0a,0x20,0x2d,0x20,0x41,0x73,0x73,0x65,0x72,0x74,0x69,0x6f,
+0x6e,0x5b,0x10,0x00,0x0a,0x5d,0x20,0x46,0x61,0x69,0x6c,0x65,0x64,0x3a,0x20,0x10,
+0x00,0x01,0x0a,0x10,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x2b,0x00,0x00,0x00,
+0x03,0x29,0x00,0x05,0x00,0x0b,0x00,0x00,0x00,0x75,0x00,0x20,0x00,0x26,0x00,0x40,
+0x01,0x17,0x00,0x40,0x01,0x17,0x00,0x40,0x01,0x17,0x00,0x80,0x00,0x3d,0x01,0x00,
+0x00,0xbd,0x02,0x80,0x00,0x09,0x02,0xc0,0x07,0x99,0x02,0x80,0x00,0x06,0x03,0x00,
+0x40,0x01,0x03,0x80,0x80,0x01,0x04,0x00,0x00,0xbd,0x03,0x80,0x80,0xa0,0x03,0xc0,
+0x03,0x19,0x03,0x80,0x01,0x3d,0x04,0x00,0x80,0x01,0x03,0x82,0x00,0x3e,0x04,0x00,
+0x01,0xbd,0x03,0x82,0x00,0x3e,0x00,0x40,0x00,0x97,0x03,0x80,0x00,0xbd,0x04,0x00,
+0x02,0x3d,0x02,0x80,0x41,0xa0,0x00,0x00,0x00,0x9e,0x00,0x40,0x11,0x9a,0x02,0x81,
+0x40,0x37,0x02,0x80,0x01,0x8a,0x02,0xbf,0xff,0x83,0x02,0x80,0x02,0x0a,0x02,0x84,
+0x00,0x2b,0x02,0x81,0x40,0x20,0x02,0x81,0x80,0x20,0x02,0xc0,0x02,0x18,0x02,0x80,
+0x01,0x89,0x02,0x81,0xc0,0x20,0x03,0x3f,0xff,0x83,0x02,0x82,0x00,0xb5,0x02,0xc0,
+0x07,0x99,0x02,0x80,0x04,0x89,0x03,0x00,0x00,0x06,0x03,0x80,0x02,0xbd,0x04,0x00,
+0x40,0x01,0x04,0x80,0x80,0x01,0x05,0x00,0x00,0x05,0x03,0x02,0xc2,0x20,0x02,0x82,
+0x80,0xa0,0x02,0x80,0x06,0x09,0x02,0x83,0x40,0xad,0x02,0x80,0x06,0x0a,0x02,0x80,
+0x00,0x06,0x03,0x00,0x03,0x3d,0x02,0x80,0x40,0xa0,0x00,0x40,0x03,0x17,0x02,0x80,
+0x07,0x09,0x02,0x83,0x40,0xad,0x02,0x80,0x07,0x0a,0x02,0x80,0x00,0x06,0x03,0x00,
+0x03,0xbd,0x02,0x80,0x40,0xa0,0x00,0x40,0x17,0x97,0x02,0x80,0x00,0x1b,0x03,0x00,
+0x07,0x91,0x03,0x81,0x40,0x01,0x03,0x04,0x00,0xa0,0x03,0x40,0x00,0x98,0x00,0x40,
+0x14,0x17,0x02,0x01,0x40,0x01,0x02,0x81,0x00,0x01,0x02,0x84,0x40,0x20,0x02,0x84,
+0x80,0x20,0x03,0x00,0x04,0x3d,0x02,0x84,0xc0,0xb2,0x02,0xc0,0x09,0x19,0x02,0x80,
+0x04,0x89,0x03,0x00,0x04,0xbd,0x03,0x80,0x40,0x01,0x03,0x01,0xc0,0x3e,0x03,0x80,
+0x05,0x3d,0x03,0x01,0xc0,0x3e,0x03,0x80,0x80,0x01,0x03,0x01,0xc0,0x3e,0x03,0x80,
+0x05,0x3d,0x03,0x01,0xc0,0x3e,0x03,0x81,0x00,0x01,0x03,0x85,0x00,0x20,0x03,0x01,
+0xc0,0x3e,0x02,0x82,0x80,0xa0,0x02,0x80,0x00,0x06,0x03,0x00,0x05,0xbd,0x02,0x80,
+0x40,0xa0,0x00,0x40,0x07,0x17,0x02,0x80,0x04,0x89,0x03,0x00,0x00,0x06,0x03,0x80,
+0x06,0x3d,0x04,0x00,0x40,0x01,0x04,0x80,0x80,0x01,0x05,0x01,0x00,0x01,0x03,0x02,
+0xc2,0x20,0x02,0x82,0x80,0xa0,0x02,0x80,0x0a,0x89,0x02,0x83,0x40,0xad,0x02,0x80,
+0x0a,0x8a,0x02,0x80,0x00,0x06,0x03,0x00,0x06,0xbd,0x02,0x80,0x40,0xa0,0x00,0x40,
+0x01,0x17,0x02,0x80,0x00,0x1d,0x00,0x80,0x00,0x1c,0x00,0x80,0x00,0x1f,0x02,0x80,
+0x00,0x09,0x02,0xc0,0x02,0x19,0x02,0x80,0x00,0x06,0x03,0x00,0x07,0x3d,0x02,0x80,
+0x40,0xa0,0x00,0x40,0x00,0x97,0x02,0x80,0x00,0x05,0x02,0x80,0x00,0x29,0x00,0x00,
+0x00,0x0f,0x10,0x00,0x10,0x41,0x73,0x73,0x65,0x72,0x74,0x69,0x6f,0x6e,0x20,0x66,
+0x61,0x69,0x6c,0x65,0x64,0x10,0x00,0x00,0x10,0x00,0x02,0x20,0x5b,0x10,0x00,0x01,
+0x5d,0x10,0x00,0x03,0x20,0x3a,0x20,0x10,0x00,0x06,0x46,0x61,0x69,0x6c,0x3a,0x20,
+0x10,0x00,0x01,0x46,0x10,0x00,0x01,0x2e,0x10,0x00,0x0d,0x4d,0x52,0x75,0x62,0x79,
+0x54,0x65,0x73,0x74,0x53,0x6b,0x69,0x70,0x10,0x00,0x06,0x53,0x6b,0x69,0x70,0x3a,
+0x20,0x10,0x00,0x01,0x20,0x10,0x00,0x01,0x3f,0x10,0x00,0x07,0x45,0x72,0x72,0x6f,
+0x72,0x3a,0x20,0x10,0x00,0x01,0x58,0x10,0x00,0x01,0x0a,0x00,0x00,0x00,0x16,0x00,
+0x10,0x24,0x6d,0x72,0x62,0x74,0x65,0x73,0x74,0x5f,0x76,0x65,0x72,0x62,0x6f,0x73,
+0x65,0x00,0x00,0x05,0x70,0x72,0x69,0x6e,0x74,0x00,0x00,0x02,0x21,0x3d,0x00,0x00,
+0x0f,0x24,0x6d,0x72,0x62,0x74,0x65,0x73,0x74,0x5f,0x61,0x73,0x73,0x65,0x72,0x74,
+0x00,0x00,0x13,0x24,0x6d,0x72,0x62,0x74,0x65,0x73,0x74,0x5f,0x61,0x73,0x73,0x65,
+0x72,0x74,0x5f,0x69,0x64,0x78,0x00,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x01,
+0x21,0x00,0x00,0x04,0x73,0x69,0x7a,0x65,0x00,0x00,0x01,0x3e,0x00,0x00,0x08,0x24,
+0x61,0x73,0x73,0x65,0x72,0x74,0x73,0x00,0x00,0x04,0x70,0x75,0x73,0x68,0x00,0x00,
+0x10,0x61,0x73,0x73,0x65,0x72,0x74,0x69,0x6f,0x6e,0x5f,0x73,0x74,0x72,0x69,0x6e,
+0x67,0x00,0x00,0x08,0x24,0x6b,0x6f,0x5f,0x74,0x65,0x73,0x74,0x00,0x00,0x01,0x2b,
+0x00,0x00,0x08,0x24,0x6f,0x6b,0x5f,0x74,0x65,0x73,0x74,0x00,0x00,0x09,0x45,0x78,
+0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x00,0x00,0x03,0x3d,0x3d,0x3d,0x00,0x00,0x05,
+0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x04,0x74,0x6f,0x5f,0x73,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x05,0x63,0x61,0x75,0x73,0x65,0x00,0x00,0x0a,0x24,0x6b,0x69,0x6c,
+0x6c,0x5f,0x74,0x65,0x73,0x74,0x00,0x00,0x00,0x00,0x32,0x00,0x01,0x00,0x02,0x00,
+0x00,0x00,0x03,0x00,0x80,0x00,0x05,0x00,0x80,0x00,0x0a,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x0f,0x24,0x6d,0x72,0x62,0x74,0x65,0x73,
+0x74,0x5f,0x61,0x73,0x73,0x65,0x72,0x74,0x00,0x00,0x00,0x00,0x7f,0x00,0x04,0x00,
+0x07,0x00,0x00,0x00,0x0d,0x04,0x00,0x00,0x26,0x02,0x00,0x00,0x3d,0x02,0x80,0x40,
+0x01,0x02,0x80,0x00,0x20,0x02,0x01,0x40,0x3e,0x02,0x80,0x00,0xbd,0x02,0x01,0x40,
+0x3e,0x02,0x80,0x01,0x3d,0x03,0x00,0x80,0x01,0x03,0x00,0x00,0x20,0x02,0x81,0x80,
+0x3e,0x02,0x00,0x40,0xac,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x04,0x10,0x00,0x0e,
+0x20,0x20,0x20,0x20,0x45,0x78,0x70,0x65,0x63,0x74,0x65,0x64,0x3a,0x20,0x10,0x00,
+0x01,0x0a,0x10,0x00,0x0e,0x20,0x20,0x20,0x20,0x20,0x20,0x41,0x63,0x74,0x75,0x61,
+0x6c,0x3a,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x07,0x69,0x6e,0x73,0x70,
+0x65,0x63,0x74,0x00,0x00,0x01,0x2b,0x00,0x00,0x00,0x01,0x1c,0x00,0x05,0x00,0x09,
+0x00,0x00,0x00,0x27,0x02,0x20,0x00,0x26,0x00,0x40,0x01,0x17,0x00,0x40,0x01,0x17,
+0x00,0x40,0x01,0x17,0x01,0x00,0x00,0x05,0x01,0x80,0x00,0x05,0x02,0x80,0x00,0x09,
+0x02,0xc0,0x0f,0x19,0x02,0x80,0x00,0x89,0x02,0x80,0x80,0xad,0x02,0x80,0x00,0x8a,
+0x02,0x80,0x40,0x01,0x02,0x80,0xc0,0x20,0x02,0xc0,0x0c,0x19,0x02,0x80,0x80,0x01,
+0x02,0xc0,0x00,0x99,0x00,0x40,0x03,0x97,0x02,0x80,0x00,0x3d,0x03,0x00,0x40,0x01,
+0x03,0x01,0x00,0x20,0x02,0x81,0x80,0x3e,0x03,0x00,0x00,0xbd,0x02,0x81,0x80,0x3e,
+0x01,0x01,0x40,0x01,0x02,0x80,0xc0,0x01,0x02,0xc0,0x00,0x99,0x00,0x40,0x02,0x97,
+0x02,0x80,0x00,0x06,0x03,0x00,0x00,0x07,0x03,0x80,0x40,0x01,0x02,0x81,0x41,0x20,
+0x01,0x81,0x40,0x01,0x02,0x80,0x00,0x09,0x03,0x00,0x00,0x89,0x03,0x80,0x80,0x01,
+0x04,0x00,0xc0,0x01,0x03,0x01,0x81,0xb7,0x02,0x81,0x80,0xa0,0x00,0x80,0x00,0x29,
+0x00,0x00,0x00,0x02,0x10,0x00,0x09,0x45,0x78,0x70,0x65,0x63,0x74,0x65,0x64,0x20,
+0x10,0x00,0x0b,0x20,0x74,0x6f,0x20,0x62,0x65,0x20,0x74,0x72,0x75,0x65,0x00,0x00,
+0x00,0x07,0x00,0x0f,0x24,0x6d,0x72,0x62,0x74,0x65,0x73,0x74,0x5f,0x61,0x73,0x73,
+0x65,0x72,0x74,0x00,0x00,0x13,0x24,0x6d,0x72,0x62,0x74,0x65,0x73,0x74,0x5f,0x61,
+0x73,0x73,0x65,0x72,0x74,0x5f,0x69,0x64,0x78,0x00,0x00,0x01,0x2b,0x00,0x00,0x01,
+0x21,0x00,0x00,0x07,0x69,0x6e,0x73,0x70,0x65,0x63,0x74,0x00,0x00,0x0e,0x61,0x73,
+0x73,0x65,0x72,0x74,0x69,0x6f,0x6e,0x5f,0x64,0x69,0x66,0x66,0x00,0x00,0x04,0x70,
+0x75,0x73,0x68,0x00,0x00,0x00,0x00,0xa3,0x00,0x06,0x00,0x0a,0x00,0x00,0x00,0x15,
+0x04,0x10,0x00,0x26,0x00,0x40,0x00,0x97,0x00,0x40,0x00,0x97,0x01,0x80,0x00,0x05,
+0x03,0x00,0xc0,0x01,0x03,0x40,0x00,0x99,0x00,0x40,0x00,0x97,0x01,0x80,0x00,0x3d,
+0x03,0x00,0x00,0x06,0x03,0x80,0x40,0x01,0x04,0x00,0x80,0x01,0x03,0x00,0x01,0x20,
+0x02,0x81,0x80,0x01,0x03,0x00,0x00,0x06,0x03,0x80,0x40,0x01,0x04,0x00,0x80,0x01,
+0x03,0x80,0x80,0xb2,0x04,0x00,0xc0,0x01,0x04,0x81,0x40,0x01,0x03,0x00,0x41,0xa0,
+0x03,0x00,0x00,0x29,0x00,0x00,0x00,0x01,0x10,0x00,0x14,0x45,0x78,0x70,0x65,0x63,
+0x74,0x65,0x64,0x20,0x74,0x6f,0x20,0x62,0x65,0x20,0x65,0x71,0x75,0x61,0x6c,0x00,
+0x00,0x00,0x03,0x00,0x0e,0x61,0x73,0x73,0x65,0x72,0x74,0x69,0x6f,0x6e,0x5f,0x64,
+0x69,0x66,0x66,0x00,0x00,0x0b,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,0x74,0x72,0x75,
+0x65,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0xc5,0x00,0x05,0x00,0x09,0x00,
+0x00,0x00,0x1a,0x02,0x10,0x00,0x26,0x00,0x40,0x00,0x97,0x00,0x40,0x00,0x97,0x01,
+0x00,0x00,0x05,0x02,0x80,0x80,0x01,0x02,0xc0,0x00,0x99,0x00,0x40,0x03,0x97,0x02,
+0x80,0x00,0x3d,0x03,0x00,0x40,0x01,0x03,0x00,0x00,0x20,0x02,0x81,0x80,0x3e,0x03,
+0x00,0x00,0xbd,0x02,0x81,0x80,0x3e,0x01,0x01,0x40,0x01,0x02,0x80,0x00,0x06,0x03,
+0x00,0x00,0x05,0x03,0x80,0x40,0x01,0x02,0x80,0x41,0x20,0x02,0x01,0x40,0x01,0x02,
+0x80,0x00,0x06,0x03,0x00,0x40,0x01,0x03,0x00,0xc0,0x20,0x03,0x80,0x80,0x01,0x04,
+0x01,0x00,0x01,0x02,0x80,0x81,0xa0,0x02,0x80,0x00,0x29,0x00,0x00,0x00,0x02,0x10,
+0x00,0x09,0x45,0x78,0x70,0x65,0x63,0x74,0x65,0x64,0x20,0x10,0x00,0x0a,0x20,0x74,
+0x6f,0x20,0x62,0x65,0x20,0x6e,0x69,0x6c,0x00,0x00,0x00,0x04,0x00,0x07,0x69,0x6e,
+0x73,0x70,0x65,0x63,0x74,0x00,0x00,0x0e,0x61,0x73,0x73,0x65,0x72,0x74,0x69,0x6f,
+0x6e,0x5f,0x64,0x69,0x66,0x66,0x00,0x00,0x0b,0x61,0x73,0x73,0x65,0x72,0x74,0x5f,
+0x74,0x72,0x75,0x65,0x00,0x00,0x04,0x6e,0x69,0x6c,0x3f,0x00,0x00,0x00,0x01,0x17,
+0x00,0x06,0x00,0x0a,0x00,0x00,0x00,0x25,0x04,0x10,0x00,0x26,0x00,0x40,0x00,0x97,
+0x00,0x40,0x00,0x97,0x01,0x80,0x00,0x05,0x03,0x00,0xc0,0x01,0x03,0x40,0x00,0x99,
+0x00,0x40,0x05,0x17,0x03,0x00,0x00,0x3d,0x03,0x80,0x40,0x01,0x03,0x80,0x00,0x20,
+0x03,0x01,0xc0,0x3e,0x03,0x80,0x00,0xbd,0x03,0x01,0xc0,0x3e,0x03,0x80,0x80,0x01,
+0x03,0x80,0x00,0x20,0x03,0x01,0xc0,0x3e,0x01,0x81,0x80,0x01,0x03,0x00,0x01,0xbd,
+0x03,0x80,0x40,0x01,0x03,0x80,0x00,0x20,0x03,0x01,0xc0,0x3e,0x03,0x80,0x02,0x3d,
+0x03,0x01,0xc0,0x3e,0x03,0x80,0x02,0xbd,0x04,0x00,0x80,0x01,0x04,0x00,0x00,0x20,
+0x03,0x82,0x00,0x3e,0x03,0x00,0x40,0xac,0x02,0x81,0x80,0x01,0x03,0x00,0x00,0x06,
+0x03,0x80,0x40,0x01,0x04,0x00,0x80,0x01,0x03,0x80,0xc0,0xa0,0x04,0x00,0xc0,0x01,
+0x04,0x81,0x40,0x01,0x03,0x00,0x81,0xa0,0x03,0x00,0x00,0x29,0x00,0x00,0x00,0x06,
+0x10,0x00,0x09,0x45,0x78,0x70,0x65,0x63,0x74,0x65,0x64,0x20,0x10,0x00,0x0c,0x20,
+0x74,0x6f,0x20,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x20,0x10,0x00,0x00,0x10,0x00,
+0x10,0x20,0x20,0x20,0x20,0x43,0x6f,0x6c,0x6c,0x65,0x63,0x74,0x69,0x6f,0x6e,0x3a,
+0x20,0x10,0x00,0x01,0x0a,0x10,0x00,0x10,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
+0x4f,0x62,0x6a,0x65,0x63,0x74,0x3a,0x20,0x00,0x00,0x00,0x04,0x00,0x07,0x69,0x6e,
+0x73,0x70,0x65,0x63,0x74,0x00,0x00,0x01,0x2b,0x00,0x00,0x0b,0x61,0x73,0x73,0x65,
+0x72,0x74,0x5f,0x74,0x72,0x75,0x65,0x00,0x00,0x08,0x69,0x6e,0x63,0x6c,0x75,0x64,
+0x65,0x3f,0x00,0x00,0x00,0x02,0xab,0x00,0x08,0x00,0x0c,0x00,0x00,0x00,0x63,0x00,
+0x08,0x00,0x26,0x01,0x80,0x00,0x07,0x04,0x00,0x00,0x09,0x04,0x40,0x2f,0x19,0x04,
+0x00,0x00,0x89,0x04,0x00,0x80,0xad,0x04,0x00,0x00,0x8a,0x04,0x00,0x40,0x01,0x04,
+0x00,0xc0,0x20,0x04,0x01,0x00,0x20,0x04,0x80,0x03,0x11,0x04,0x01,0x40,0xb2,0x04,
+0x40,0x01,0x99,0x04,0x00,0x40,0x01,0x04,0x01,0xc0,0x20,0x00,0x40,0x00,0x97,0x04,
+0x00,0x00,0x05,0x02,0x02,0x00,0x01,0x04,0x01,0x00,0x01,0x04,0x40,0x02,0x99,0x04,
+0x01,0x00,0x01,0x04,0x02,0x00,0x20,0x04,0x80,0x00,0x3d,0x04,0x00,0x80,0xac,0x02,
+0x02,0x00,0x01,0x02,0x80,0x00,0x08,0x00,0x40,0x02,0x1a,0x04,0x01,0x00,0x2b,0x04,
+0x02,0x40,0x20,0x02,0x80,0x00,0x07,0x00,0x40,0x15,0x17,0x04,0x00,0x00,0x1b,0x04,
+0x80,0x05,0x11,0x05,0x02,0x00,0x01,0x04,0x82,0xc0,0xa0,0x04,0xc0,0x00,0x98,0x00,
+0x40,0x11,0x97,0x03,0x02,0x00,0x01,0x04,0x00,0x00,0xbd,0x04,0x81,0x00,0x01,0x04,
+0x02,0x40,0x3e,0x04,0x80,0x40,0x01,0x04,0x83,0x00,0x20,0x04,0x02,0x40,0x3e,0x04,
+0x80,0x01,0x3d,0x04,0x02,0x40,0x3e,0x02,0x02,0x00,0x01,0x04,0x00,0x01,0xbd,0x04,
+0x81,0x80,0x01,0x04,0x81,0x00,0x20,0x04,0x02,0x40,0x3e,0x04,0x80,0x02,0x3d,0x04,
+0x02,0x40,0x3e,0x04,0x80,0x02,0xbd,0x05,0x01,0x80,0x01,0x05,0x03,0x40,0x20,0x04,
+0x82,0x80,0x3e,0x04,0x00,0x80,0xac,0x03,0x82,0x00,0x01,0x04,0x00,0x40,0x01,0x04,
+0x80,0x03,0x40,0x04,0x03,0x80,0x21,0x04,0x03,0xc0,0x20,0x04,0x40,0x03,0x99,0x04,
+0x00,0x00,0x09,0x04,0x80,0x00,0x89,0x05,0x01,0x00,0x01,0x05,0x81,0xc0,0x01,0x04,
+0x82,0x41,0xb7,0x04,0x04,0x00,0xa0,0x01,0x80,0x00,0x08,0x00,0x40,0x01,0x17,0x04,
+0x00,0x00,0x1d,0x00,0x80,0x00,0x1c,0x04,0x00,0x40,0x01,0x04,0x04,0x40,0x20,0x04,
+0x40,0x01,0x99,0x04,0x00,0x40,0x01,0x04,0x04,0x40,0x20,0x00,0x82,0x00,0x01,0x04,
+0x01,0x40,0x01,0x04,0x40,0x08,0x19,0x04,0x00,0x00,0xbd,0x04,0x81,0x00,0x01,0x04,
+0x02,0x40,0x3e,0x04,0x80,0x40,0x01,0x04,0x83,0x00,0x20,0x04,0x02,0x40,0x3e,0x04,
+0x80,0x03,0x3d,0x04,0x02,0x40,0x3e,0x02,0x02,0x00,0x01,0x04,0x00,0x00,0x09,0x04,
+0x80,0x00,0x89,0x05,0x01,0x00,0x01,0x05,0x80,0x00,0x05,0x04,0x82,0x41,0xb7,0x04,
+0x04,0x00,0xa0,0x01,0x80,0x00,0x08,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x07,0x10,
+0x00,0x03,0x20,0x3a,0x20,0x10,0x00,0x00,0x10,0x00,0x18,0x20,0x65,0x78,0x63,0x65,
+0x70,0x74,0x69,0x6f,0x6e,0x20,0x65,0x78,0x70,0x65,0x63,0x74,0x65,0x64,0x2c,0x20,
+0x6e,0x6f,0x74,0x10,0x00,0x0e,0x20,0x20,0x20,0x20,0x20,0x20,0x43,0x6c,0x61,0x73,
+0x73,0x3a,0x20,0x3c,0x10,0x00,0x02,0x3e,0x0a,0x10,0x00,0x0d,0x20,0x20,0x20,0x20,
+0x4d,0x65,0x73,0x73,0x61,0x67,0x65,0x3a,0x20,0x10,0x00,0x21,0x20,0x65,0x78,0x70,
+0x65,0x63,0x74,0x65,0x64,0x20,0x62,0x75,0x74,0x20,0x6e,0x6f,0x74,0x68,0x69,0x6e,
+0x67,0x20,0x77,0x61,0x73,0x20,0x72,0x61,0x69,0x73,0x65,0x64,0x2e,0x00,0x00,0x00,
+0x12,0x00,0x0f,0x24,0x6d,0x72,0x62,0x74,0x65,0x73,0x74,0x5f,0x61,0x73,0x73,0x65,
+0x72,0x74,0x00,0x00,0x13,0x24,0x6d,0x72,0x62,0x74,0x65,0x73,0x74,0x5f,0x61,0x73,
+0x73,0x65,0x72,0x74,0x5f,0x69,0x64,0x78,0x00,0x00,0x01,0x2b,0x00,0x00,0x04,0x6c,
+0x61,0x73,0x74,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x06,0x53,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x03,0x70,0x6f,0x70,0x00,
+0x00,0x04,0x74,0x6f,0x5f,0x73,0x00,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x09,
+0x45,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x00,0x00,0x03,0x3d,0x3d,0x3d,0x00,
+0x00,0x07,0x69,0x6e,0x73,0x70,0x65,0x63,0x74,0x00,0x00,0x07,0x6d,0x65,0x73,0x73,
+0x61,0x67,0x65,0x00,0x00,0x04,0x61,0x6e,0x79,0x3f,0x00,0x00,0x01,0x21,0x00,0x00,
+0x04,0x70,0x75,0x73,0x68,0x00,0x00,0x05,0x66,0x69,0x72,0x73,0x74,0x00,0x00,0x00,
+0x00,0x7c,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x0e,0x02,0x00,0x00,0x26,0x01,0x80,
+0x40,0x01,0x02,0x00,0x00,0x91,0x01,0x80,0x00,0xa0,0x01,0xc0,0x02,0x19,0x01,0x81,
+0x80,0x15,0x02,0x00,0x40,0x01,0x01,0x80,0x80,0xa0,0x00,0x40,0x02,0x17,0x01,0x80,
+0x40,0x01,0x02,0x01,0x80,0x15,0x02,0x01,0x00,0x20,0x01,0x80,0xc0,0xb2,0x01,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x0c,0x69,0x6e,0x73,0x74,
+0x61,0x6e,0x63,0x65,0x5f,0x6f,0x66,0x3f,0x00,0x00,0x06,0x4d,0x6f,0x64,0x75,0x6c,
+0x65,0x00,0x00,0x08,0x6b,0x69,0x6e,0x64,0x5f,0x6f,0x66,0x3f,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x00,0x01,0xe6,0x00,0x02,
+0x00,0x05,0x00,0x00,0x00,0x42,0x00,0x00,0x00,0x26,0x01,0x00,0x00,0x06,0x01,0x80,
+0x00,0x3d,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,0x89,0x01,0x80,0x03,0x40,0x01,0x00,
+0x80,0x21,0x01,0x00,0x01,0x89,0x01,0x80,0x02,0x89,0x01,0x01,0x00,0xac,0x01,0x00,
+0x03,0x0a,0x01,0x00,0x00,0x06,0x01,0x80,0x00,0xbd,0x01,0x00,0x00,0xa0,0x01,0x00,
+0x00,0x06,0x01,0x80,0x03,0x09,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,0x06,0x01,0x80,
+0x00,0x3d,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,0x06,0x01,0x80,0x01,0x3d,0x01,0x00,
+0x00,0xa0,0x01,0x00,0x00,0x06,0x01,0x80,0x01,0x89,0x01,0x00,0x00,0xa0,0x01,0x00,
+0x00,0x06,0x01,0x80,0x00,0x3d,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,0x06,0x01,0x80,
+0x01,0xbd,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,0x06,0x01,0x80,0x02,0x89,0x01,0x00,
+0x00,0xa0,0x01,0x00,0x00,0x06,0x01,0x80,0x00,0x3d,0x01,0x00,0x00,0xa0,0x01,0x00,
+0x00,0x06,0x01,0x80,0x02,0x3d,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,0x06,0x01,0x80,
+0x03,0x89,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,0x06,0x01,0x80,0x00,0x3d,0x01,0x00,
+0x00,0xa0,0x01,0x00,0x04,0x11,0x01,0x80,0x05,0x04,0x01,0x02,0x40,0xa0,0x01,0x40,
+0x06,0x99,0x01,0x00,0x00,0x06,0x01,0x80,0x02,0xbd,0x01,0x00,0x00,0xa0,0x01,0x00,
+0x00,0x06,0x01,0x80,0x05,0x11,0x01,0x82,0xc0,0x20,0x02,0x00,0x06,0x89,0x01,0x83,
+0x00,0xae,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,0x06,0x01,0x80,0x03,0x3d,0x01,0x00,
+0x00,0xa0,0x00,0x40,0x00,0x97,0x01,0x00,0x00,0x05,0x01,0x00,0x00,0x29,0x00,0x00,
+0x00,0x07,0x10,0x00,0x01,0x0a,0x10,0x00,0x07,0x54,0x6f,0x74,0x61,0x6c,0x3a,0x20,
+0x10,0x00,0x07,0x20,0x20,0x20,0x4f,0x4b,0x3a,0x20,0x10,0x00,0x07,0x20,0x20,0x20,
+0x4b,0x4f,0x3a,0x20,0x10,0x00,0x07,0x43,0x72,0x61,0x73,0x68,0x3a,0x20,0x10,0x00,
+0x07,0x20,0x54,0x69,0x6d,0x65,0x3a,0x20,0x10,0x00,0x09,0x20,0x73,0x65,0x63,0x6f,
+0x6e,0x64,0x73,0x0a,0x00,0x00,0x00,0x0e,0x00,0x05,0x70,0x72,0x69,0x6e,0x74,0x00,
+0x00,0x08,0x24,0x61,0x73,0x73,0x65,0x72,0x74,0x73,0x00,0x00,0x04,0x65,0x61,0x63,
+0x68,0x00,0x00,0x08,0x24,0x6f,0x6b,0x5f,0x74,0x65,0x73,0x74,0x00,0x00,0x01,0x2b,
+0x00,0x00,0x08,0x24,0x6b,0x6f,0x5f,0x74,0x65,0x73,0x74,0x00,0x00,0x0b,0x24,0x74,
+0x6f,0x74,0x61,0x6c,0x5f,0x74,0x65,0x73,0x74,0x00,0x00,0x0a,0x24,0x6b,0x69,0x6c,
+0x6c,0x5f,0x74,0x65,0x73,0x74,0x00,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,
+0x00,0x0e,0x63,0x6f,0x6e,0x73,0x74,0x5f,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x3f,
+0x00,0x00,0x04,0x54,0x69,0x6d,0x65,0x00,0x00,0x03,0x6e,0x6f,0x77,0x00,0x00,0x01,
+0x2d,0x00,0x00,0x0b,0x24,0x74,0x65,0x73,0x74,0x5f,0x73,0x74,0x61,0x72,0x74,0x00,
+0x00,0x00,0x00,0x2f,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,
+0x01,0x80,0x00,0x06,0x02,0x00,0x40,0x01,0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x70,0x75,0x74,0x73,0x00,0x00,
+0x00,0x00,0xa8,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0x17,0x04,0x00,0x00,0x26,0x02,
+0x00,0x00,0x02,0x02,0x80,0x40,0x01,0x02,0x80,0x00,0x20,0x00,0x81,0x40,0x01,0x02,
+0x80,0x80,0x01,0x02,0x80,0x00,0x20,0x01,0x01,0x40,0x01,0x02,0x80,0x40,0x01,0x02,
+0x80,0x40,0x20,0x02,0xc0,0x01,0x19,0x02,0x80,0x80,0x01,0x02,0x80,0x40,0x20,0x02,
+0xc0,0x03,0x99,0x02,0x80,0x40,0x01,0x03,0x00,0x80,0x01,0x02,0x80,0x80,0xae,0x02,
+0x80,0xc0,0x20,0x03,0x01,0x00,0x01,0x02,0x81,0x00,0xb3,0x00,0x40,0x00,0x97,0x02,
+0x80,0x00,0x07,0x02,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x06,0x00,0x16,0x39,0x2e,
+0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x38,
+0x65,0x2d,0x31,0x33,0x00,0x00,0x00,0x05,0x00,0x04,0x74,0x6f,0x5f,0x66,0x00,0x00,
+0x07,0x66,0x69,0x6e,0x69,0x74,0x65,0x3f,0x00,0x00,0x01,0x2d,0x00,0x00,0x03,0x61,
+0x62,0x73,0x00,0x00,0x01,0x3c,0x00,0x00,0x00,0x00,0x59,0x00,0x01,0x00,0x03,0x00,
+0x00,0x00,0x08,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x84,0x00,0x80,0x00,0xa0,0x00,
+0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x80,0x46,0x00,0x00,0x00,0x05,0x00,
+0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x0d,0x61,0x74,0x74,
+0x72,0x5f,0x61,0x63,0x63,0x65,0x73,0x73,0x6f,0x72,0x00,0x00,0x05,0x63,0x61,0x75,
+0x73,0x65,0x00,0x00,0x0a,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x69,0x7a,0x65,0x00,
+0x00,0x00,0x00,0x29,0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x03,0x02,0x00,0x00,0x26,
+0x00,0x80,0x00,0x0e,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+0x00,0x06,0x40,0x63,0x61,0x75,0x73,0x65,0x00,0x00,0x00,0x00,0x5d,0x00,0x03,0x00,
+0x06,0x00,0x00,0x00,0x0a,0x00,0x10,0x00,0x26,0x00,0x40,0x00,0x97,0x00,0x40,0x00,
+0x97,0x00,0x80,0x00,0x3d,0x01,0x80,0x00,0x06,0x02,0x00,0x00,0x91,0x02,0x80,0x40,
+0x01,0x02,0x00,0x80,0xa0,0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,
+0x01,0x10,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x05,0x72,0x61,0x69,0x73,0x65,0x00,
+0x00,0x0d,0x4d,0x52,0x75,0x62,0x79,0x54,0x65,0x73,0x74,0x53,0x6b,0x69,0x70,0x00,
+0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x00,0x00,0xc0,0x00,0x04,0x00,0x06,0x00,0x00,
+0x00,0x1b,0x00,0x80,0x00,0x05,0x01,0x01,0x00,0x37,0x00,0x40,0x01,0x9a,0x02,0x00,
+0x80,0x01,0x02,0x00,0x00,0x20,0x00,0x40,0x05,0x17,0x02,0x00,0x00,0x1b,0x02,0x80,
+0x00,0x91,0x03,0x01,0x00,0x01,0x02,0x80,0x80,0xa0,0x02,0xc0,0x00,0x98,0x00,0x40,
+0x01,0x97,0x01,0x81,0x00,0x01,0x00,0x80,0xc0,0x01,0x00,0x40,0x01,0x17,0x02,0x00,
+0x00,0x1d,0x00,0x80,0x00,0x1c,0x02,0x00,0x01,0x91,0x02,0x01,0x00,0x20,0x02,0x80,
+0x03,0x11,0x02,0x01,0x40,0xb2,0x02,0x40,0x02,0x19,0x02,0x00,0x40,0x01,0x02,0x01,
+0x00,0x20,0x02,0x80,0x01,0x91,0x02,0x01,0x40,0xb2,0x02,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x02,0x5b,0x5d,0x00,0x00,0x0d,0x53,0x74,0x61,
+0x6e,0x64,0x61,0x72,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x03,0x3d,0x3d,0x3d,
+0x00,0x00,0x0d,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x45,0x72,0x72,0x6f,0x72,
+0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,
+0x43,0x6c,0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x5a,0x00,0x01,0x00,0x03,0x00,0x00,
+0x00,0x05,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,
+0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x0d,
+0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x0a,
+0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,
+0x00,0x0d,0x53,0x74,0x61,0x6e,0x64,0x61,0x72,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,
+0x00,0x00,0x00,0x45,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x11,
+0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x05,0x41,0x72,0x72,0x61,0x79,0x00,
+0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x43,
+0x6c,0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x4b,0x00,0x01,0x00,0x03,0x00,0x00,0x00,
+0x05,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,
+0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x05,0x41,
+0x72,0x72,0x61,0x79,0x00,0x00,0x0a,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,0x73,
+0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,
+0x00,0x00,0x00,0x52,0x00,0x01,0x00,0x05,0x00,0x00,0x00,0x0b,0x00,0x80,0x00,0x11,
+0x01,0x40,0x00,0x03,0x01,0xc0,0x00,0x83,0x02,0x40,0x01,0x03,0x00,0x80,0x41,0xa0,
+0x01,0x40,0x00,0x03,0x01,0xc0,0x00,0x83,0x02,0x40,0x01,0x03,0x01,0x00,0x81,0xb7,
+0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,
+0x00,0x05,0x41,0x72,0x72,0x61,0x79,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x00,0x00,0xfb,0x00,0x05,0x00,0x09,0x00,0x00,0x00,0x2c,0x00,0x80,
+0x00,0x05,0x00,0x40,0x02,0x9a,0x02,0xc0,0x00,0x03,0x02,0x81,0x40,0xb7,0x03,0x3f,
+0xff,0x03,0x02,0x80,0x00,0xb0,0x00,0x40,0x05,0x17,0x02,0x80,0x00,0x1b,0x03,0x00,
+0x00,0x91,0x03,0x81,0x40,0x01,0x03,0x00,0x80,0xa0,0x03,0x40,0x00,0x98,0x00,0x40,
+0x01,0x97,0x01,0x01,0x40,0x01,0x00,0x80,0x80,0x01,0x00,0x40,0x01,0x17,0x02,0x80,
+0x00,0x1d,0x00,0x80,0x00,0x1c,0x02,0xc0,0x00,0x03,0x02,0x81,0x40,0xb7,0x03,0x40,
+0x01,0x03,0x02,0x80,0x00,0xb0,0x01,0x81,0x40,0x01,0x02,0xc0,0x00,0x03,0x02,0x81,
+0x40,0xb7,0x03,0x3f,0xff,0x83,0x02,0x80,0x00,0xb0,0x02,0x01,0x40,0x01,0x02,0x80,
+0xc0,0x01,0x03,0x40,0x00,0x03,0x03,0xc0,0x00,0x03,0x04,0x40,0x00,0x03,0x03,0x01,
+0x81,0xb7,0x02,0x80,0xc0,0xb2,0x02,0xc0,0x01,0x99,0x02,0x81,0x00,0x01,0x03,0x01,
+0x80,0x37,0x02,0x80,0xc0,0xb2,0x02,0xc0,0x02,0x19,0x02,0x80,0x40,0x01,0x02,0x81,
+0x00,0x20,0x03,0x00,0x02,0x91,0x02,0x80,0xc0,0xb2,0x02,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x01,0x2a,0x00,0x00,0x0d,0x53,0x74,0x61,0x6e,
+0x64,0x61,0x72,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x03,0x3d,0x3d,0x3d,0x00,
+0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x0d,0x41,
+0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,0x00,
+0x45,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x0a,0x00,0xc0,0x00,0x03,0x00,0x80,0x40,
+0xb7,0x01,0x40,0x00,0x03,0x01,0x00,0x80,0xb7,0x00,0x80,0x00,0xac,0x01,0x40,0x00,
+0x03,0x01,0xc0,0x00,0x03,0x01,0x00,0x81,0x37,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x2b,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x00,0x00,0x42,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x09,0x00,0xc0,
+0x00,0x03,0x00,0x80,0x40,0xb7,0x01,0x40,0x00,0x03,0x00,0x80,0x00,0xa0,0x01,0x40,
+0x00,0x03,0x01,0xc0,0x00,0x03,0x01,0x00,0x81,0x37,0x00,0x80,0x40,0xb2,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x02,0x3c,0x3c,0x00,0x00,
+0x02,0x3d,0x3d,0x00,0x00,0x00,0x01,0x3e,0x00,0x05,0x00,0x09,0x00,0x00,0x00,0x39,
+0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x05,0x02,0x80,0x00,0x11,0x02,0x80,0x40,0x20,
+0x01,0x81,0x40,0x01,0x00,0x40,0x01,0x9a,0x02,0x80,0xc0,0x01,0x02,0x80,0x80,0x20,
+0x00,0x40,0x05,0x17,0x02,0x80,0x00,0x1b,0x03,0x00,0x01,0x91,0x03,0x81,0x40,0x01,
+0x03,0x01,0x00,0xa0,0x03,0x40,0x00,0x98,0x00,0x40,0x01,0x97,0x02,0x01,0x40,0x01,
+0x00,0x81,0x00,0x01,0x00,0x40,0x01,0x17,0x02,0x80,0x00,0x1d,0x00,0x80,0x00,0x1c,
+0x00,0x40,0x03,0x1a,0x02,0x80,0xc0,0x01,0x03,0x40,0x00,0x03,0x03,0xc0,0x00,0x83,
+0x04,0x40,0x01,0x03,0x02,0x80,0x81,0xa0,0x00,0x40,0x05,0x17,0x02,0x80,0x00,0x1b,
+0x03,0x00,0x01,0x91,0x03,0x81,0x40,0x01,0x03,0x01,0x00,0xa0,0x03,0x40,0x00,0x98,
+0x00,0x40,0x01,0x97,0x02,0x01,0x40,0x01,0x01,0x01,0x00,0x01,0x00,0x40,0x01,0x17,
+0x02,0x80,0x00,0x1d,0x00,0x80,0x00,0x1c,0x02,0xc0,0x00,0x03,0x03,0x40,0x00,0x83,
+0x03,0xc0,0x01,0x03,0x02,0x81,0x41,0xb7,0x03,0x40,0x00,0x03,0x02,0x80,0x80,0xa0,
+0x03,0x40,0x00,0x83,0x02,0x81,0x40,0xb2,0x02,0xc0,0x02,0x19,0x02,0x80,0x40,0x01,
+0x02,0x81,0x80,0x20,0x03,0x00,0x03,0x91,0x02,0x81,0x40,0xb2,0x02,0xc0,0x02,0x19,
+0x02,0x80,0x80,0x01,0x02,0x81,0x80,0x20,0x03,0x00,0x03,0x91,0x02,0x81,0x40,0xb2,
+0x02,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x05,0x41,0x72,
+0x72,0x61,0x79,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,
+0x0d,0x53,0x74,0x61,0x6e,0x64,0x61,0x72,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,
+0x03,0x3d,0x3d,0x3d,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,
+0x73,0x00,0x00,0x0d,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x45,0x72,0x72,0x6f,
+0x72,0x00,0x00,0x00,0x01,0x73,0x00,0x05,0x00,0x0a,0x00,0x00,0x00,0x46,0x00,0x80,
+0x00,0x05,0x01,0x00,0x00,0x05,0x02,0x80,0x00,0x11,0x02,0x80,0x40,0x20,0x01,0x81,
+0x40,0x01,0x00,0x40,0x01,0x9a,0x02,0x80,0xc0,0x01,0x02,0x80,0x80,0x20,0x00,0x40,
+0x05,0x17,0x02,0x80,0x00,0x1b,0x03,0x00,0x01,0x91,0x03,0x81,0x40,0x01,0x03,0x01,
+0x00,0xa0,0x03,0x40,0x00,0x98,0x00,0x40,0x01,0x97,0x02,0x01,0x40,0x01,0x00,0x81,
+0x00,0x01,0x00,0x40,0x01,0x17,0x02,0x80,0x00,0x1d,0x00,0x80,0x00,0x1c,0x00,0x40,
+0x03,0x9a,0x02,0x80,0xc0,0x01,0x03,0x40,0x00,0x03,0x03,0xc0,0x00,0x83,0x04,0x40,
+0x01,0x03,0x04,0xc0,0x01,0x83,0x02,0x80,0x82,0x20,0x00,0x40,0x05,0x17,0x02,0x80,
+0x00,0x1b,0x03,0x00,0x01,0x91,0x03,0x81,0x40,0x01,0x03,0x01,0x00,0xa0,0x03,0x40,
+0x00,0x98,0x00,0x40,0x01,0x97,0x02,0x01,0x40,0x01,0x01,0x01,0x00,0x01,0x00,0x40,
+0x01,0x17,0x02,0x80,0x00,0x1d,0x00,0x80,0x00,0x1c,0x02,0xc0,0x00,0x03,0x03,0x40,
+0x00,0x83,0x03,0xc0,0x01,0x03,0x02,0x81,0x41,0xb7,0x03,0x40,0x00,0x03,0x03,0xc0,
+0x01,0x83,0x02,0x80,0x81,0x20,0x03,0x40,0x01,0x83,0x02,0x81,0x40,0xb2,0x02,0xc0,
+0x05,0x19,0x02,0xc0,0x00,0x03,0x03,0x40,0x00,0x83,0x03,0xc0,0x01,0x03,0x02,0x81,
+0x41,0xb7,0x03,0x40,0x00,0x03,0x03,0xc0,0x00,0x83,0x04,0x40,0x01,0x03,0x02,0x80,
+0x81,0xa0,0x03,0x40,0x01,0x03,0x02,0x81,0x40,0xb2,0x02,0xc0,0x02,0x19,0x02,0x80,
+0x40,0x01,0x02,0x81,0x80,0x20,0x03,0x00,0x03,0x91,0x02,0x81,0x40,0xb2,0x02,0xc0,
+0x02,0x19,0x02,0x80,0x80,0x01,0x02,0x81,0x80,0x20,0x03,0x00,0x03,0x91,0x02,0x81,
+0x40,0xb2,0x02,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x05,
+0x41,0x72,0x72,0x61,0x79,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x03,0x5b,0x5d,
+0x3d,0x00,0x00,0x0d,0x53,0x74,0x61,0x6e,0x64,0x61,0x72,0x64,0x45,0x72,0x72,0x6f,
+0x72,0x00,0x00,0x03,0x3d,0x3d,0x3d,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x63,
+0x6c,0x61,0x73,0x73,0x00,0x00,0x0d,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x45,
+0x72,0x72,0x6f,0x72,0x00,0x00,0x00,0x00,0x41,0x00,0x02,0x00,0x04,0x00,0x00,0x00,
+0x08,0x01,0x40,0x00,0x03,0x00,0x80,0x80,0xb7,0x01,0x00,0x40,0x01,0x01,0x00,0x00,
+0x20,0x01,0x00,0x40,0x01,0x01,0x80,0xc0,0x37,0x01,0x00,0x40,0xb2,0x01,0x00,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x05,0x63,0x6c,0x65,0x61,0x72,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x5c,0x00,0x02,0x00,0x06,0x00,0x00,
+0x00,0x0e,0x01,0x40,0x00,0x03,0x01,0xc0,0x00,0x83,0x02,0x40,0x01,0x03,0x00,0x80,
+0x81,0xb7,0x01,0x00,0x40,0x01,0x01,0x80,0x03,0x40,0x01,0x00,0x00,0x21,0x01,0x00,
+0x40,0x01,0x01,0xc0,0x00,0x83,0x02,0x40,0x01,0x83,0x02,0xc0,0x02,0x83,0x01,0x80,
+0xc1,0xb7,0x01,0x00,0x40,0xb2,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x02,0x00,0x08,0x63,0x6f,0x6c,0x6c,0x65,0x63,0x74,0x21,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x00,0x00,0x2c,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x05,0x02,0x00,
+0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x00,0x40,0x01,0x01,0x80,0x00,0xac,0x01,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x2b,0x00,0x00,0x00,
+0x00,0x62,0x00,0x03,0x00,0x08,0x00,0x00,0x00,0x10,0x01,0xc0,0x00,0x03,0x02,0x40,
+0x00,0x83,0x00,0x80,0xc1,0x37,0x01,0xc0,0x01,0x03,0x02,0x40,0x01,0x83,0x01,0x00,
+0xc1,0x37,0x01,0x80,0x40,0x01,0x02,0x00,0x80,0x01,0x01,0x80,0x00,0xa0,0x02,0x40,
+0x00,0x03,0x02,0xc0,0x00,0x83,0x03,0x40,0x01,0x03,0x03,0xc0,0x01,0x83,0x02,0x01,
+0x02,0x37,0x01,0x80,0x40,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x02,0x00,0x06,0x63,0x6f,0x6e,0x63,0x61,0x74,0x00,0x00,0x02,0x3d,0x3d,0x00,
+0x00,0x00,0x00,0x59,0x00,0x02,0x00,0x05,0x00,0x00,0x00,0x0d,0x01,0x40,0x00,0x03,
+0x01,0xc0,0x00,0x83,0x02,0x40,0x01,0x03,0x00,0x80,0x81,0xb7,0x01,0x00,0x40,0x01,
+0x01,0xc0,0x00,0x03,0x01,0x00,0x00,0xa0,0x01,0x00,0x40,0x01,0x01,0xc0,0x00,0x03,
+0x02,0x40,0x01,0x03,0x01,0x80,0xc1,0x37,0x01,0x00,0x40,0xb2,0x01,0x00,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x09,0x64,0x65,0x6c,0x65,0x74,0x65,
+0x5f,0x61,0x74,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x50,0x00,0x03,0x00,
+0x06,0x00,0x00,0x00,0x0c,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,
+0x03,0x00,0x80,0xc1,0xb7,0x01,0x3f,0xff,0x83,0x01,0x80,0x40,0x01,0x02,0x00,0x03,
+0x40,0x01,0x80,0x00,0x21,0x01,0x80,0x80,0x01,0x02,0x40,0x02,0x83,0x01,0x80,0x40,
+0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x65,
+0x61,0x63,0x68,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x30,0x00,0x03,0x00,
+0x05,0x00,0x00,0x00,0x06,0x02,0x00,0x00,0x26,0x01,0x80,0x80,0x15,0x02,0x00,0x40,
+0x01,0x01,0x80,0x00,0xac,0x01,0x80,0x80,0x16,0x01,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0x4e,0x00,0x03,0x00,
+0x05,0x00,0x00,0x00,0x0a,0x01,0xc0,0x00,0x03,0x00,0x80,0xc0,0xb7,0x01,0x00,0x00,
+0x05,0x01,0x80,0x40,0x01,0x02,0x00,0x03,0x40,0x01,0x80,0x00,0x21,0x01,0x80,0x80,
+0x01,0x02,0x3f,0xff,0x83,0x01,0x80,0x40,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x02,0x00,0x0a,0x65,0x61,0x63,0x68,0x5f,0x69,0x6e,0x64,0x65,
+0x78,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x20,0x00,0x03,0x00,0x04,0x00,
+0x00,0x00,0x03,0x02,0x00,0x00,0x26,0x00,0x80,0x80,0x16,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0x00,0x03,0x00,0x04,0x00,
+0x00,0x00,0x0a,0x00,0x80,0xc0,0x37,0x01,0x80,0x80,0x01,0x01,0x00,0xc0,0xb7,0x01,
+0x80,0x40,0x01,0x01,0x80,0x00,0x20,0x01,0xc0,0x01,0x99,0x01,0x80,0x80,0x01,0x01,
+0x80,0x00,0x20,0x01,0x80,0x40,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x02,0x00,0x06,0x65,0x6d,0x70,0x74,0x79,0x3f,0x00,0x00,0x01,0x21,0x00,
+0x00,0x00,0x01,0xaf,0x00,0x06,0x00,0x0a,0x00,0x00,0x00,0x58,0x00,0x81,0x80,0x37,
+0x03,0x40,0x00,0x03,0x03,0xc0,0x00,0x83,0x04,0x40,0x01,0x03,0x01,0x01,0x81,0xb7,
+0x01,0x80,0x00,0x05,0x02,0x00,0x00,0x05,0x00,0x40,0x03,0x9a,0x03,0x40,0x00,0x03,
+0x03,0xc0,0x00,0x83,0x04,0x40,0x01,0x03,0x03,0x01,0x81,0xb7,0x03,0xbf,0xff,0x03,
+0x03,0x00,0x00,0xa0,0x00,0x40,0x05,0x17,0x03,0x00,0x00,0x1b,0x03,0x80,0x00,0x91,
+0x04,0x01,0x80,0x01,0x03,0x80,0x80,0xa0,0x03,0xc0,0x00,0x98,0x00,0x40,0x01,0x97,
+0x02,0x81,0x80,0x01,0x01,0x81,0x40,0x01,0x00,0x40,0x01,0x17,0x03,0x00,0x00,0x1d,
+0x00,0x80,0x00,0x1c,0x00,0x40,0x04,0x1a,0x03,0x40,0x00,0x03,0x03,0xc0,0x00,0x83,
+0x04,0x40,0x01,0x03,0x03,0x01,0x81,0xb7,0x03,0xc0,0x00,0x03,0x04,0x40,0x00,0x83,
+0x03,0x00,0x01,0x20,0x00,0x40,0x05,0x17,0x03,0x00,0x00,0x1b,0x03,0x80,0x00,0x91,
+0x04,0x01,0x80,0x01,0x03,0x80,0x80,0xa0,0x03,0xc0,0x00,0x98,0x00,0x40,0x01,0x97,
+0x02,0x81,0x80,0x01,0x02,0x01,0x40,0x01,0x00,0x40,0x01,0x17,0x03,0x00,0x00,0x1d,
+0x00,0x80,0x00,0x1c,0x03,0x00,0x40,0x01,0x03,0x00,0x00,0x20,0x03,0x80,0x00,0x05,
+0x03,0x00,0xc0,0xb2,0x03,0x40,0x02,0x19,0x03,0x00,0x80,0x01,0x03,0x00,0x00,0x20,
+0x03,0xc0,0x00,0x03,0x03,0x00,0xc0,0xb2,0x03,0x40,0x02,0x99,0x03,0x00,0x80,0x01,
+0x03,0xbf,0xff,0x83,0x03,0x00,0x00,0xa0,0x03,0x81,0xc0,0x37,0x03,0x00,0xc0,0xb2,
+0x03,0x40,0x03,0x19,0x03,0x00,0x80,0x01,0x03,0xc0,0x00,0x03,0x03,0x00,0x00,0xa0,
+0x03,0xc0,0x00,0x03,0x03,0x81,0xc0,0xb7,0x03,0x00,0xc0,0xb2,0x03,0x40,0x04,0x19,
+0x03,0x00,0x80,0x01,0x03,0xc0,0x01,0x83,0x03,0x00,0x00,0xa0,0x03,0xc0,0x00,0x03,
+0x04,0x40,0x00,0x83,0x04,0xc0,0x01,0x03,0x03,0x81,0xc1,0xb7,0x03,0x00,0xc0,0xb2,
+0x03,0x40,0x02,0x19,0x03,0x00,0xc0,0x01,0x03,0x01,0x00,0x20,0x03,0x80,0x02,0x91,
+0x03,0x00,0xc0,0xb2,0x03,0x40,0x02,0x19,0x03,0x01,0x00,0x01,0x03,0x01,0x00,0x20,
+0x03,0x80,0x02,0x91,0x03,0x00,0xc0,0xb2,0x03,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x06,0x00,0x05,0x66,0x69,0x72,0x73,0x74,0x00,0x00,0x0d,0x53,0x74,
+0x61,0x6e,0x64,0x61,0x72,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x03,0x3d,0x3d,
+0x3d,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,
+0x0d,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,
+0x00,0x00,0x49,0x00,0x02,0x00,0x05,0x00,0x00,0x00,0x0a,0x01,0x40,0x00,0x03,0x01,
+0xc0,0x00,0x83,0x02,0x40,0x01,0x03,0x00,0x80,0x81,0xb7,0x01,0x00,0x40,0x01,0x01,
+0xc0,0x00,0x83,0x01,0x00,0x00,0xa0,0x01,0xc0,0x00,0x03,0x01,0x00,0x40,0xb2,0x01,
+0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x05,0x69,0x6e,0x64,
+0x65,0x78,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0xca,0x00,0x05,0x00,0x08,
+0x00,0x00,0x00,0x29,0x02,0x81,0x40,0x37,0x03,0x40,0x00,0x03,0x02,0x80,0x00,0xa0,
+0x00,0x81,0x40,0x01,0x02,0x81,0x40,0x37,0x03,0x40,0x00,0x83,0x02,0x80,0x00,0xa0,
+0x01,0x01,0x40,0x01,0x02,0x81,0x40,0x37,0x03,0x40,0x00,0x83,0x03,0xc0,0x00,0x03,
+0x02,0x80,0x01,0x20,0x01,0x81,0x40,0x01,0x02,0x81,0x40,0x37,0x03,0x40,0x00,0x83,
+0x03,0x80,0x03,0x40,0x02,0x80,0x00,0xa1,0x02,0x01,0x40,0x01,0x02,0x80,0x40,0x01,
+0x03,0x00,0x00,0x05,0x03,0x01,0x80,0xb7,0x02,0x80,0x40,0xb2,0x02,0xc0,0x02,0x99,
+0x02,0x80,0x80,0x01,0x03,0x00,0x00,0x05,0x03,0x80,0x00,0x05,0x03,0x01,0x81,0x37,
+0x02,0x80,0x40,0xb2,0x02,0xc0,0x02,0x99,0x02,0x80,0xc0,0x01,0x03,0x40,0x00,0x03,
+0x03,0xc0,0x00,0x03,0x03,0x01,0x81,0x37,0x02,0x80,0x40,0xb2,0x02,0xc0,0x02,0x99,
+0x02,0x81,0x00,0x01,0x03,0x3f,0xff,0x83,0x03,0xc0,0x00,0x03,0x03,0x01,0x81,0x37,
+0x02,0x80,0x40,0xb2,0x02,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
+0x00,0x0a,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x69,0x7a,0x65,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x00,0x00,0x1c,0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x02,0x02,0x00,
+0x00,0x26,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x67,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x0f,0x01,0xc0,0x00,0x03,0x02,0x40,
+0x00,0x83,0x02,0xc0,0x01,0x03,0x00,0x80,0xc1,0xb7,0x01,0x80,0xc0,0x37,0x02,0x00,
+0x40,0x01,0x01,0x80,0x00,0xa0,0x01,0x00,0xc0,0x01,0x01,0x80,0x80,0x01,0x02,0x40,
+0x00,0x03,0x02,0xc0,0x00,0x83,0x03,0x40,0x01,0x03,0x02,0x01,0x01,0xb7,0x01,0x80,
+0x40,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x0f,
+0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x69,0x7a,0x65,0x5f,0x63,0x6f,0x70,0x79,0x00,
+0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x86,0x00,0x03,0x00,0x06,0x00,0x00,0x00,
+0x15,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x01,0x80,0xc1,
+0xb7,0x01,0x80,0x00,0x20,0x00,0x80,0xc0,0x01,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,
+0x83,0x02,0xc0,0x01,0x03,0x01,0x80,0xc1,0xb7,0x02,0x00,0x00,0x3d,0x01,0x80,0x00,
+0xa0,0x01,0x00,0xc0,0x01,0x01,0x80,0x40,0x01,0x02,0x00,0x00,0xbd,0x01,0x80,0x40,
+0xb2,0x01,0xc0,0x01,0x99,0x01,0x80,0x80,0x01,0x02,0x00,0x01,0x3d,0x01,0x80,0x40,
+0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x03,0x10,0x00,0x01,0x2c,0x10,0x00,0x03,
+0x31,0x32,0x33,0x10,0x00,0x05,0x31,0x2c,0x32,0x2c,0x33,0x00,0x00,0x00,0x02,0x00,
+0x04,0x6a,0x6f,0x69,0x6e,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0xea,0x00,
+0x04,0x00,0x07,0x00,0x00,0x00,0x27,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,0x83,0x03,
+0x40,0x01,0x03,0x00,0x81,0x01,0xb7,0x01,0x00,0x00,0x05,0x00,0x40,0x03,0x9a,0x02,
+0x40,0x00,0x03,0x02,0xc0,0x00,0x83,0x03,0x40,0x01,0x03,0x02,0x01,0x01,0xb7,0x02,
+0xbf,0xff,0x03,0x02,0x00,0x00,0xa0,0x00,0x40,0x05,0x17,0x02,0x00,0x00,0x1b,0x02,
+0x80,0x00,0x91,0x03,0x01,0x00,0x01,0x02,0x80,0x80,0xa0,0x02,0xc0,0x00,0x98,0x00,
+0x40,0x01,0x97,0x01,0x81,0x00,0x01,0x01,0x00,0xc0,0x01,0x00,0x40,0x01,0x17,0x02,
+0x00,0x00,0x1d,0x00,0x80,0x00,0x1c,0x02,0x00,0x40,0x01,0x02,0x00,0x00,0x20,0x02,
+0xc0,0x01,0x03,0x02,0x00,0xc0,0xb2,0x02,0x40,0x02,0x19,0x02,0x01,0x00,0x37,0x02,
+0x00,0x00,0x20,0x02,0x80,0x00,0x05,0x02,0x00,0xc0,0xb2,0x02,0x40,0x02,0x19,0x02,
+0x00,0x80,0x01,0x02,0x01,0x00,0x20,0x02,0x80,0x02,0x91,0x02,0x00,0xc0,0xb2,0x02,
+0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x04,0x6c,0x61,0x73,
+0x74,0x00,0x00,0x0d,0x53,0x74,0x61,0x6e,0x64,0x61,0x72,0x64,0x45,0x72,0x72,0x6f,
+0x72,0x00,0x00,0x03,0x3d,0x3d,0x3d,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x63,
+0x6c,0x61,0x73,0x73,0x00,0x00,0x0d,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x45,
+0x72,0x72,0x6f,0x72,0x00,0x00,0x00,0x00,0x46,0x00,0x02,0x00,0x05,0x00,0x00,0x00,
+0x09,0x01,0x40,0x00,0x03,0x01,0xc0,0x00,0x83,0x02,0x40,0x01,0x03,0x00,0x80,0x81,
+0xb7,0x01,0x00,0x40,0x01,0x01,0x00,0x00,0x20,0x01,0xc0,0x01,0x03,0x01,0x00,0x40,
+0xb2,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x06,0x6c,
+0x65,0x6e,0x67,0x74,0x68,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x58,0x00,
+0x02,0x00,0x06,0x00,0x00,0x00,0x0e,0x01,0x40,0x00,0x03,0x01,0xc0,0x00,0x83,0x02,
+0x40,0x01,0x03,0x00,0x80,0x81,0xb7,0x01,0x00,0x40,0x01,0x01,0x80,0x03,0x40,0x01,
+0x00,0x00,0x21,0x01,0x00,0x40,0x01,0x01,0xc0,0x00,0x83,0x02,0x40,0x01,0x83,0x02,
+0xc0,0x02,0x83,0x01,0x80,0xc1,0xb7,0x01,0x00,0x40,0xb2,0x01,0x00,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x6d,0x61,0x70,0x21,0x00,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x00,0x00,0x2c,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x05,0x02,
+0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x00,0x40,0x01,0x01,0x80,0x00,0xac,0x01,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x2b,0x00,0x00,
+0x00,0x00,0x73,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x15,0x01,0xc0,0x00,0x03,0x02,
+0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x00,0x80,0xc1,0xb7,0x01,0x80,0x40,0x01,0x01,
+0x80,0x00,0x20,0x01,0x00,0xc0,0x01,0x01,0x80,0xc0,0x37,0x01,0x80,0x00,0x20,0x02,
+0x00,0x00,0x05,0x01,0x80,0x40,0xb2,0x01,0xc0,0x02,0x99,0x01,0x80,0x40,0x01,0x02,
+0x40,0x00,0x03,0x02,0xc0,0x00,0x83,0x02,0x01,0x01,0x37,0x01,0x80,0x40,0xb2,0x01,
+0xc0,0x01,0x19,0x01,0xc0,0x01,0x03,0x01,0x00,0xc0,0x01,0x01,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x03,0x70,0x6f,0x70,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x00,0x00,0x7c,0x00,0x03,0x00,0x08,0x00,0x00,0x00,0x17,0x01,0xc0,
+0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x00,0x80,0xc1,0xb7,0x01,0x80,
+0x40,0x01,0x02,0x40,0x01,0x83,0x01,0x80,0x00,0xa0,0x01,0x00,0xc0,0x01,0x01,0x80,
+0x40,0x01,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,0x83,0x03,0x40,0x01,0x03,0x03,0xc0,
+0x01,0x83,0x02,0x01,0x02,0x37,0x01,0x80,0x40,0xb2,0x01,0xc0,0x03,0x19,0x01,0xc0,
+0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x03,0x40,0x01,0x83,0x01,0x80,
+0xc2,0x37,0x01,0x00,0xc0,0x01,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x02,0x00,0x04,0x70,0x75,0x73,0x68,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,
+0x00,0x5f,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x0f,0x01,0xc0,0x00,0x03,0x02,0x40,
+0x00,0x83,0x02,0xc0,0x01,0x03,0x00,0x80,0xc1,0xb7,0x01,0x80,0xc0,0x37,0x02,0x00,
+0x40,0x01,0x01,0x80,0x00,0xa0,0x01,0x00,0xc0,0x01,0x01,0x80,0x80,0x01,0x02,0x40,
+0x00,0x03,0x02,0xc0,0x00,0x83,0x03,0x40,0x01,0x03,0x02,0x01,0x01,0xb7,0x01,0x80,
+0x40,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x07,
+0x72,0x65,0x70,0x6c,0x61,0x63,0x65,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,
+0x77,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x15,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,
+0x83,0x02,0xc0,0x01,0x03,0x00,0x80,0xc1,0xb7,0x01,0x80,0x40,0x01,0x01,0x80,0x00,
+0x20,0x01,0x00,0xc0,0x01,0x01,0x80,0x40,0x01,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,
+0x83,0x03,0x40,0x01,0x03,0x02,0x01,0x01,0xb7,0x01,0x80,0x40,0xb2,0x01,0xc0,0x03,
+0x19,0x01,0x80,0x80,0x01,0x02,0x40,0x01,0x03,0x02,0xc0,0x00,0x83,0x03,0x40,0x00,
+0x03,0x02,0x01,0x01,0xb7,0x01,0x80,0x40,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x02,0x00,0x07,0x72,0x65,0x76,0x65,0x72,0x73,0x65,0x00,0x00,
+0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x78,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x15,
+0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x00,0x80,0xc1,0xb7,
+0x01,0x80,0x40,0x01,0x01,0x80,0x00,0x20,0x01,0x00,0xc0,0x01,0x01,0x80,0x40,0x01,
+0x02,0x40,0x01,0x03,0x02,0xc0,0x00,0x83,0x03,0x40,0x00,0x03,0x02,0x01,0x01,0xb7,
+0x01,0x80,0x40,0xb2,0x01,0xc0,0x03,0x19,0x01,0x80,0x80,0x01,0x02,0x40,0x01,0x03,
+0x02,0xc0,0x00,0x83,0x03,0x40,0x00,0x03,0x02,0x01,0x01,0xb7,0x01,0x80,0x40,0xb2,
+0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x08,0x72,0x65,
+0x76,0x65,0x72,0x73,0x65,0x21,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x4a,
+0x00,0x02,0x00,0x05,0x00,0x00,0x00,0x0a,0x01,0x40,0x00,0x03,0x01,0xc0,0x00,0x83,
+0x02,0x40,0x01,0x03,0x00,0x80,0x81,0xb7,0x01,0x00,0x40,0x01,0x01,0xc0,0x00,0x83,
+0x01,0x00,0x00,0xa0,0x01,0xc0,0x00,0x03,0x01,0x00,0x40,0xb2,0x01,0x00,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x06,0x72,0x69,0x6e,0x64,0x65,0x78,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x79,0x00,0x03,0x00,0x06,0x00,0x00,
+0x00,0x16,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x00,0x80,
+0xc1,0xb7,0x01,0x80,0x40,0x01,0x01,0x80,0x00,0x20,0x01,0x00,0xc0,0x01,0x01,0x80,
+0xc0,0x37,0x01,0x80,0x00,0x20,0x02,0x00,0x00,0x05,0x01,0x80,0x40,0xb2,0x01,0xc0,
+0x02,0x99,0x01,0x80,0x40,0x01,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x02,0x01,
+0x01,0x37,0x01,0x80,0x40,0xb2,0x01,0xc0,0x01,0x99,0x01,0x80,0x80,0x01,0x02,0x40,
+0x00,0x03,0x01,0x80,0x40,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x02,0x00,0x05,0x73,0x68,0x69,0x66,0x74,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,
+0x00,0x00,0x44,0x00,0x02,0x00,0x05,0x00,0x00,0x00,0x09,0x01,0x40,0x00,0x03,0x01,
+0xc0,0x00,0x83,0x02,0x40,0x01,0x03,0x00,0x80,0x81,0xb7,0x01,0x00,0x40,0x01,0x01,
+0x00,0x00,0x20,0x01,0xc0,0x01,0x03,0x01,0x00,0x40,0xb2,0x01,0x00,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x73,0x69,0x7a,0x65,0x00,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x00,0x00,0xa2,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x1a,0x01,
+0x80,0x00,0x3d,0x02,0x40,0x00,0x03,0x02,0xc0,0x01,0x03,0x01,0x80,0x01,0x20,0x00,
+0x80,0xc0,0x01,0x01,0x80,0x40,0x01,0x02,0x3f,0xff,0x83,0x01,0x80,0x00,0xa0,0x01,
+0x00,0xc0,0x01,0x01,0x80,0x00,0xbd,0x02,0x00,0x80,0x01,0x01,0x81,0x00,0x3e,0x02,
+0x00,0x01,0x3d,0x01,0x81,0x00,0x3e,0x02,0x00,0x01,0xbd,0x01,0x80,0x40,0xb2,0x01,
+0xc0,0x04,0x19,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x01,
+0x80,0xc1,0xb7,0x02,0x40,0x00,0x03,0x01,0x80,0x80,0xa0,0x02,0x40,0x00,0x83,0x01,
+0x80,0x40,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x04,0x10,0x00,0x05,0x31,0x32,
+0x33,0x34,0x35,0x10,0x00,0x00,0x10,0x00,0x01,0x3a,0x10,0x00,0x02,0x32,0x3a,0x00,
+0x00,0x00,0x03,0x00,0x05,0x73,0x6c,0x69,0x63,0x65,0x00,0x00,0x02,0x3d,0x3d,0x00,
+0x00,0x02,0x5b,0x5d,0x00,0x00,0x00,0x00,0xd7,0x00,0x05,0x00,0x0a,0x00,0x00,0x00,
+0x2d,0x02,0xc0,0x00,0x83,0x03,0x40,0x01,0x03,0x00,0x81,0x41,0x37,0x02,0x80,0x40,
+0x01,0x03,0x40,0x00,0x03,0x02,0x80,0x00,0xa0,0x01,0x01,0x40,0x01,0x02,0xc0,0x00,
+0x83,0x03,0x40,0x01,0x03,0x01,0x81,0x41,0x37,0x02,0x80,0xc0,0x01,0x03,0x3f,0xff,
+0x83,0x03,0xc0,0x00,0x03,0x02,0x80,0x01,0x20,0x02,0x01,0x40,0x01,0x02,0x80,0x40,
+0x01,0x03,0x40,0x00,0x03,0x03,0xc0,0x00,0x83,0x04,0x40,0x01,0x03,0x03,0x01,0x81,
+0xb7,0x02,0x80,0x40,0xb2,0x02,0xc0,0x03,0x19,0x02,0x80,0x80,0x01,0x03,0x40,0x00,
+0x03,0x03,0xc0,0x00,0x83,0x04,0x40,0x01,0x03,0x03,0x01,0x81,0xb7,0x02,0x80,0x40,
+0xb2,0x02,0xc0,0x03,0x99,0x02,0x80,0xc0,0x01,0x03,0x3f,0xff,0x83,0x03,0xc0,0x00,
+0x03,0x04,0x40,0x00,0x83,0x04,0xc0,0x01,0x03,0x03,0x01,0x82,0x37,0x02,0x80,0x40,
+0xb2,0x02,0xc0,0x03,0x99,0x02,0x81,0x00,0x01,0x03,0x3f,0xff,0x83,0x03,0xc0,0x00,
+0x03,0x04,0x40,0x00,0x83,0x04,0xc0,0x01,0x03,0x03,0x01,0x82,0x37,0x02,0x80,0x40,
+0xb2,0x02,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x07,0x75,
+0x6e,0x73,0x68,0x69,0x66,0x74,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x85,
+0x00,0x04,0x00,0x08,0x00,0x00,0x00,0x13,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,
+0x03,0x40,0x01,0x83,0x03,0xc0,0x02,0x03,0x00,0x81,0x02,0x37,0x02,0x00,0x40,0x01,
+0x02,0x00,0x00,0x20,0x01,0x01,0x00,0x01,0x02,0x00,0x40,0x01,0x02,0x00,0x40,0x20,
+0x01,0x81,0x00,0x01,0x02,0x00,0x80,0x01,0x02,0x80,0xc0,0x01,0x02,0x00,0x80,0xb2,
+0x02,0x40,0x01,0x99,0x02,0x00,0x80,0x01,0x02,0x80,0x00,0x3d,0x02,0x00,0x80,0xb2,
+0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x01,0x10,0x00,0x0c,0x5b,0x32,0x2c,0x20,0x33,
+0x2c,0x20,0x34,0x2c,0x20,0x35,0x5d,0x00,0x00,0x00,0x03,0x00,0x04,0x74,0x6f,0x5f,
+0x73,0x00,0x00,0x07,0x69,0x6e,0x73,0x70,0x65,0x63,0x74,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x00,0x00,0xcd,0x00,0x04,0x00,0x08,0x00,0x00,0x00,0x29,0x02,0x00,0x00,
+0x3d,0x02,0x80,0x00,0xbd,0x02,0x01,0x01,0x37,0x02,0x80,0x00,0x3d,0x03,0x00,0x00,
+0xbd,0x03,0xc0,0x03,0x03,0x02,0x81,0x41,0xb7,0x02,0x00,0x00,0xb2,0x00,0x81,0x00,
+0x01,0x02,0x00,0x00,0x3d,0x02,0x80,0x00,0xbd,0x03,0x40,0x03,0x03,0x02,0x01,0x01,
+0xb7,0x02,0x80,0x00,0x3d,0x03,0x00,0x00,0xbd,0x03,0xc0,0x03,0x03,0x02,0x81,0x41,
+0xb7,0x02,0x00,0x00,0xb2,0x01,0x01,0x00,0x01,0x02,0x00,0x00,0x3d,0x02,0x80,0x00,
+0xbd,0x03,0x40,0x03,0x03,0x02,0x01,0x01,0xb7,0x02,0x80,0x00,0x3d,0x03,0x00,0x01,
+0x3d,0x03,0x80,0x01,0xbd,0x02,0x81,0x41,0xb7,0x02,0x00,0x00,0xb2,0x01,0x81,0x00,
+0x01,0x02,0x00,0x40,0x01,0x02,0x80,0x00,0x08,0x02,0x00,0x00,0xb2,0x02,0x40,0x01,
+0x99,0x02,0x00,0x80,0x01,0x02,0x80,0x00,0x07,0x02,0x00,0x00,0xb2,0x02,0x40,0x01,
+0x99,0x02,0x00,0xc0,0x01,0x02,0x80,0x00,0x08,0x02,0x00,0x00,0xb2,0x02,0x00,0x00,
+0x29,0x00,0x00,0x00,0x04,0x10,0x00,0x01,0x61,0x10,0x00,0x01,0x63,0x10,0x00,0x01,
+0x64,0x10,0x00,0x01,0x66,0x00,0x00,0x00,0x01,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,
+0x00,0xbe,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x15,0x02,0x40,0x00,0x03,0x02,0xc0,
+0x00,0x83,0x03,0x40,0x01,0x03,0x00,0x81,0x01,0xb7,0x02,0x40,0x00,0x03,0x02,0xc0,
+0x00,0x83,0x03,0x40,0x01,0x03,0x01,0x01,0x01,0xb7,0x02,0x00,0x00,0x02,0x02,0x80,
+0x00,0x82,0x03,0x00,0x01,0x02,0x01,0x81,0x01,0xb7,0x02,0x00,0x40,0x01,0x02,0x80,
+0x80,0x01,0x02,0x00,0x00,0xa0,0x02,0x40,0x02,0x19,0x02,0x00,0x40,0x01,0x02,0x80,
+0xc0,0x01,0x02,0x00,0x00,0xa0,0x02,0x00,0x40,0x20,0x02,0x00,0x00,0x29,0x00,0x00,
+0x00,0x03,0x06,0x00,0x16,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x06,0x00,0x16,0x32,0x2e,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x65,0x2b,0x30,0x30,0x06,0x00,0x16,0x33,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x00,0x00,0x00,
+0x02,0x00,0x04,0x65,0x71,0x6c,0x3f,0x00,0x00,0x01,0x21,0x00,0x00,0x00,0x00,0x51,
+0x00,0x02,0x00,0x05,0x00,0x00,0x00,0x09,0x01,0x40,0x00,0x03,0x01,0xc0,0x00,0x83,
+0x02,0x40,0x01,0x03,0x00,0x80,0x81,0xb7,0x01,0x00,0x40,0x01,0x01,0x00,0x00,0x20,
+0x01,0x80,0x01,0x11,0x01,0x00,0x40,0xa0,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x03,0x00,0x04,0x68,0x61,0x73,0x68,0x00,0x00,0x05,0x69,0x73,0x5f,
+0x61,0x3f,0x00,0x00,0x07,0x49,0x6e,0x74,0x65,0x67,0x65,0x72,0x00,0x00,0x00,0x00,
+0xdb,0x00,0x04,0x00,0x0a,0x00,0x00,0x00,0x2c,0x02,0x00,0x00,0x3d,0x02,0x80,0x00,
+0x3d,0x03,0x00,0x00,0xbd,0x02,0x01,0x01,0xb7,0x02,0x80,0x00,0x3d,0x03,0x00,0x01,
+0x3d,0x03,0x80,0x00,0xbd,0x02,0x81,0x41,0xb7,0x02,0x00,0x00,0xa0,0x00,0x81,0x00,
+0x01,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,0x83,0x03,0x40,0x01,0x03,0x03,0xc0,0x01,
+0x83,0x04,0x40,0x02,0x03,0x04,0xc0,0x02,0x83,0x02,0x01,0x03,0x37,0x02,0xc0,0x00,
+0x03,0x03,0x40,0x00,0x83,0x02,0x81,0x41,0x37,0x02,0x00,0x00,0xa0,0x01,0x01,0x00,
+0x01,0x02,0x00,0x00,0x3d,0x02,0x80,0x01,0x3d,0x03,0x00,0x00,0xbd,0x02,0x01,0x01,
+0xb7,0x02,0x80,0x00,0x3d,0x03,0x00,0x01,0x3d,0x03,0x80,0x00,0xbd,0x02,0x81,0x41,
+0xb7,0x02,0x00,0x00,0xa0,0x01,0x81,0x00,0x01,0x02,0x00,0x40,0x01,0x02,0xbf,0xff,
+0x03,0x02,0x00,0x40,0xb2,0x02,0x40,0x01,0x99,0x02,0x00,0x80,0x01,0x02,0xc0,0x00,
+0x03,0x02,0x00,0x40,0xb2,0x02,0x40,0x01,0x99,0x02,0x00,0xc0,0x01,0x02,0xbf,0xff,
+0x83,0x02,0x00,0x40,0xb2,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x03,0x10,0x00,0x01,
+0x61,0x10,0x00,0x01,0x63,0x10,0x00,0x01,0x62,0x00,0x00,0x00,0x02,0x00,0x03,0x3c,
+0x3d,0x3e,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x80,0x00,0x03,0x00,0x09,
+0x00,0x00,0x00,0x11,0x01,0x80,0x00,0x3d,0x02,0x00,0x00,0xbd,0x02,0x80,0x01,0x3d,
+0x03,0x00,0x01,0xbd,0x03,0x80,0x02,0x3d,0x04,0x00,0x02,0xbd,0x00,0x80,0xc3,0x37,
+0x01,0x80,0x40,0x01,0x02,0x40,0x00,0x03,0x02,0xc0,0x01,0x03,0x01,0x80,0x01,0x20,
+0x01,0x00,0xc0,0x01,0x01,0x80,0x40,0x01,0x01,0x80,0x40,0x20,0x01,0x80,0x80,0x01,
+0x01,0x80,0x40,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x06,0x10,0x00,0x01,0x61,
+0x10,0x00,0x01,0x62,0x10,0x00,0x01,0x63,0x10,0x00,0x01,0x64,0x10,0x00,0x01,0x65,
+0x10,0x00,0x01,0x66,0x00,0x00,0x00,0x02,0x00,0x05,0x73,0x6c,0x69,0x63,0x65,0x00,
+0x00,0x05,0x63,0x6c,0x65,0x61,0x72,0x00,0x00,0x00,0x00,0x4b,0x00,0x01,0x00,0x03,
+0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,
+0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,
+0x00,0x0b,0x42,0x61,0x73,0x69,0x63,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x05,
+0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x43,0x6c,0x61,
+0x73,0x73,0x00,0x00,0x00,0x00,0x48,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,
+0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x00,0x05,0x00,0x80,0x80,0xb2,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x0b,0x42,0x61,0x73,
+0x69,0x63,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x0a,0x73,0x75,0x70,0x65,0x72,
+0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x39,0x00,
+0x01,0x00,0x03,0x00,0x00,0x00,0x06,0x00,0xc0,0x00,0x03,0x01,0x00,0x03,0x40,0x00,
+0x80,0x00,0x21,0x01,0x40,0x00,0x03,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x05,0x74,0x69,0x6d,0x65,0x73,0x00,0x00,
+0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x28,0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x05,
+0x00,0x00,0x00,0x9e,0x01,0xc0,0x00,0x03,0x00,0x80,0xc0,0x01,0x00,0x80,0x00,0x1f,
+0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,
+0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x03,0x00,0x80,0x00,0x05,0x00,0x80,0x80,0x16,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,
+0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x09,0x00,0xc0,0x00,0x03,0x01,0x40,0x00,0x83,
+0x01,0xc0,0x01,0x03,0x00,0x80,0x41,0xb7,0x01,0x00,0x03,0x40,0x00,0x80,0x00,0x21,
+0x01,0x40,0x00,0x83,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x02,0x00,0x04,0x66,0x69,0x6e,0x64,0x00,0x00,0x02,0x3d,0x3d,0x00,
+0x00,0x00,0x00,0x2d,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,
+0x01,0x80,0x40,0x01,0x02,0x40,0x00,0x83,0x01,0x80,0x00,0xb2,0x01,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,
+0x56,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0b,0x00,0x80,0x00,0x05,0x01,0x00,0x00,
+0x05,0x00,0x80,0x00,0x43,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x11,0x00,0x80,0x40,
+0x20,0x01,0x00,0x07,0x40,0x00,0x80,0x80,0x21,0x01,0x40,0x00,0x83,0x00,0x80,0xc0,
+0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x01,0x45,
+0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x04,0x66,0x69,0x6e,0x64,0x00,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x00,0x00,0x52,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x08,0x00,
+0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x48,0x01,
+0x00,0x02,0xc0,0x00,0x80,0x80,0x46,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x07,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+0x00,0x00,0x0a,0x45,0x6e,0x75,0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,0x00,0x00,0x04,
+0x65,0x61,0x63,0x68,0x00,0x00,0x00,0x00,0x3b,0x00,0x02,0x00,0x05,0x00,0x00,0x00,
+0x08,0x00,0x00,0x00,0xa6,0x01,0x40,0x00,0x03,0x01,0xc0,0x00,0x83,0x02,0x40,0x01,
+0x03,0x01,0x00,0x81,0xb7,0x01,0x80,0x40,0x01,0x01,0x00,0x00,0x21,0x01,0x00,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x65,0x61,0x63,0x68,0x00,
+0x00,0x00,0x00,0x2d,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,
+0x01,0x80,0x40,0x01,0x02,0x40,0x00,0x83,0x01,0x80,0x00,0xb2,0x01,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,
+0x4c,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x0b,0x00,0xbf,0xff,0x83,0x01,0xc0,0x00,
+0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,0x01,0x80,0xc1,0xb7,0x02,0x00,0x03,
+0x40,0x01,0x80,0x00,0x21,0x01,0x80,0x40,0x01,0x02,0x40,0x02,0x83,0x01,0x80,0x40,
+0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x65,
+0x61,0x63,0x68,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x34,0x00,0x02,0x00,
+0x04,0x00,0x00,0x00,0x07,0x02,0x00,0x00,0x26,0x00,0x80,0x80,0x16,0x01,0x00,0x40,
+0x15,0x01,0x80,0x80,0x15,0x01,0x00,0x00,0xac,0x01,0x00,0x40,0x16,0x01,0x00,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x2b,0x00,0x00,0x00,0x00,
+0x48,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x0a,0x00,0xbf,0xff,0x83,0x01,0xc0,0x00,
+0x03,0x02,0x40,0x02,0x03,0x01,0x80,0xc0,0x41,0x02,0x00,0x03,0x40,0x01,0x80,0x00,
+0x21,0x01,0x80,0x40,0x01,0x02,0x40,0x07,0x03,0x01,0x80,0x40,0xb2,0x01,0x80,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x65,0x61,0x63,0x68,0x00,
+0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x34,0x00,0x02,0x00,0x04,0x00,0x00,0x00,
+0x07,0x02,0x00,0x00,0x26,0x00,0x80,0x80,0x16,0x01,0x00,0x40,0x15,0x01,0x80,0x80,
+0x15,0x01,0x00,0x00,0xac,0x01,0x00,0x40,0x16,0x01,0x00,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0x40,0x00,0x03,0x00,
+0x05,0x00,0x00,0x00,0x08,0x00,0xbf,0xff,0x83,0x01,0x80,0xc0,0x37,0x02,0x00,0x03,
+0x40,0x01,0x80,0x00,0x21,0x01,0x80,0x40,0x01,0x02,0x3f,0xff,0x83,0x01,0x80,0x40,
+0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x65,
+0x61,0x63,0x68,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x34,0x00,0x02,0x00,
+0x04,0x00,0x00,0x00,0x07,0x02,0x00,0x00,0x26,0x00,0x80,0x80,0x16,0x01,0x00,0x40,
+0x15,0x01,0x80,0x80,0x15,0x01,0x00,0x00,0xac,0x01,0x00,0x40,0x16,0x01,0x00,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x2b,0x00,0x00,0x00,0x00,
+0x3d,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x07,0x00,0x80,0x80,0x37,0x01,0x40,0x00,
+0x03,0x01,0x80,0x03,0x40,0x01,0x00,0x00,0x21,0x01,0xc0,0x00,0x03,0x01,0x00,0x40,
+0xb2,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x05,0x74,
+0x69,0x6d,0x65,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x33,0x00,0x03,
+0x00,0x05,0x00,0x00,0x00,0x06,0x01,0xc0,0x00,0x03,0x02,0x40,0x01,0x03,0x01,0x80,
+0xc0,0x41,0x02,0x00,0x03,0x40,0x01,0x80,0x00,0x21,0x01,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x00,0x00,
+0x39,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x08,0x02,0x00,0x00,0x26,0x00,0x80,0x40,
+0x16,0x01,0x00,0x40,0x15,0x01,0x00,0x80,0x16,0x01,0x00,0x40,0x95,0x01,0x80,0x80,
+0x15,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x01,0x00,0x02,0x3c,0x3c,0x00,0x00,0x00,0x00,0x4c,0x00,0x05,0x00,0x08,0x00,0x00,
+0x00,0x0b,0x00,0x81,0x40,0x37,0x02,0xc0,0x00,0x03,0x03,0x40,0x01,0x03,0x02,0x81,
+0x40,0x41,0x03,0x00,0x03,0x40,0x02,0x80,0x00,0x21,0x03,0x40,0x00,0x03,0x03,0xc0,
+0x01,0x03,0x03,0x01,0x80,0x41,0x02,0x80,0x40,0xb2,0x02,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x00,0x00,0x3b,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x08,0x02,0x00,
+0x00,0x26,0x00,0x80,0x80,0x16,0x01,0x40,0x00,0x83,0x01,0xc0,0x01,0x83,0x01,0x00,
+0x80,0x41,0x01,0x80,0x03,0x40,0x01,0x00,0x00,0x21,0x01,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x00,0x00,
+0x41,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x0a,0x02,0x00,0x00,0x26,0x00,0x80,0xc0,
+0x96,0x01,0x00,0x80,0x95,0x01,0x80,0xc0,0x95,0x01,0x00,0x81,0x37,0x01,0x01,0x00,
+0x96,0x01,0x00,0x40,0x95,0x01,0x81,0x00,0x95,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x3c,0x3c,0x00,0x00,0x00,
+0x00,0x48,0x00,0x01,0x00,0x05,0x00,0x00,0x00,0x0a,0x00,0xc0,0x00,0x03,0x01,0x40,
+0x01,0x03,0x00,0x80,0x40,0x41,0x00,0x80,0x00,0x20,0x01,0x40,0x00,0x03,0x01,0xc0,
+0x00,0x83,0x02,0x40,0x01,0x03,0x01,0x00,0x81,0xb7,0x00,0x80,0x40,0xb2,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x74,0x6f,0x5f,0x61,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x4b,0x00,0x01,0x00,0x05,0x00,0x00,
+0x00,0x0b,0x00,0xc0,0x00,0x03,0x01,0x40,0x01,0x03,0x00,0x80,0x40,0x41,0x01,0x00,
+0x03,0x40,0x00,0x80,0x00,0x21,0x01,0x40,0x01,0x83,0x01,0xc0,0x03,0x83,0x02,0x40,
+0x05,0x83,0x01,0x00,0x81,0xb7,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x03,0x6d,0x61,0x70,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x00,0x00,0x2c,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x05,0x02,0x00,0x00,
+0x26,0x01,0x80,0x40,0x01,0x02,0x40,0x01,0x83,0x01,0x80,0x00,0xb0,0x01,0x80,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x2a,0x00,0x00,0x00,0x00,
+0x51,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0c,0x00,0x80,0x00,0x48,0x01,0x00,0x02,
+0xc0,0x00,0x80,0x00,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x04,0xc0,0x00,0x80,0x40,
+0x46,0x00,0x80,0x00,0x06,0x01,0x00,0x07,0x40,0x00,0x80,0x00,0x21,0x01,0x40,0x31,
+0x83,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x03,0x00,0x01,0x6d,0x00,0x00,0x01,0x6e,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,
+0x00,0x2b,0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x26,0x01,0x00,
+0x00,0x2b,0x01,0x00,0x00,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x01,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,0x2b,0x00,0x02,0x00,
+0x03,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x26,0x01,0x00,0x00,0x2b,0x01,0x00,0x00,
+0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x63,
+0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,0x28,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x04,
+0x00,0x80,0x00,0x06,0x01,0x00,0x03,0x40,0x00,0x80,0x00,0x21,0x00,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x6e,0x00,0x00,0x00,0x00,0x1c,
+0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x40,0x31,0x83,0x00,0x00,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0x01,0x00,0x03,
+0x00,0x00,0x00,0x09,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,
+0x00,0x80,0x00,0x06,0x01,0x00,0x05,0x40,0x00,0x80,0x00,0x21,0x01,0x40,0x09,0x83,
+0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
+0x00,0x01,0x6d,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x2f,0x00,0x02,0x00,
+0x04,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x26,0x01,0x00,0x00,0x2b,0x01,0xc0,0x00,
+0x03,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x01,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,0x2c,0x00,0x03,0x00,0x05,
+0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x00,0x06,0x02,0x00,0x03,0x40,
+0x01,0x80,0x00,0x21,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+0x00,0x01,0x6d,0x00,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x05,0x00,0x00,0x00,0x03,
+0x02,0x00,0x00,0x26,0x02,0x40,0x09,0x83,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x09,
+0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x80,0x00,0x06,
+0x01,0x00,0x05,0x40,0x00,0x80,0x00,0x21,0x01,0x40,0x00,0x83,0x00,0x80,0x40,0xb2,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x6d,0x00,
+0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x2f,0x00,0x02,0x00,0x04,0x00,0x00,0x00,
+0x05,0x00,0x00,0x00,0x26,0x01,0x00,0x00,0x2b,0x01,0xc0,0x00,0x03,0x01,0x00,0x00,
+0xa0,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x63,
+0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,0x2c,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x05,
+0x02,0x00,0x00,0x26,0x01,0x80,0x00,0x06,0x02,0x00,0x03,0x40,0x01,0x80,0x00,0x21,
+0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x6d,0x00,
+0x00,0x00,0x00,0x28,0x00,0x04,0x00,0x05,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,
+0x02,0x40,0x09,0x83,0x02,0x00,0x40,0x16,0x02,0x40,0x00,0x83,0x02,0x00,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0x00,0x01,0x00,0x03,
+0x00,0x00,0x00,0x0c,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,
+0x00,0x80,0x00,0x48,0x01,0x00,0x06,0xc0,0x00,0x80,0x40,0x46,0x00,0x80,0x00,0x06,
+0x01,0x00,0x09,0x40,0x00,0x80,0x00,0x21,0x01,0x40,0x01,0x03,0x00,0x80,0x80,0xb2,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x05,0x69,0x74,
+0x65,0x72,0x31,0x00,0x00,0x05,0x69,0x74,0x65,0x72,0x32,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x00,0x00,0x30,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+0x26,0x01,0x00,0x00,0x06,0x01,0x80,0x03,0x40,0x01,0x00,0x00,0x21,0x01,0x00,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x05,0x69,0x74,0x65,0x72,0x32,
+0x00,0x00,0x00,0x00,0x27,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x03,0x00,0x80,0x00,
+0xab,0x00,0x80,0x00,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x01,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,0x2b,0x00,0x02,0x00,0x03,
+0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x26,0x01,0x00,0x00,0x2b,0x01,0x00,0x00,0x20,
+0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x63,0x61,
+0x6c,0x6c,0x00,0x00,0x00,0x00,0x30,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x05,0x00,
+0xc0,0x00,0x83,0x01,0x00,0x00,0x06,0x01,0x80,0x03,0x40,0x01,0x00,0x00,0x21,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x05,0x69,0x74,0x65,
+0x72,0x31,0x00,0x00,0x00,0x00,0x20,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x03,0x00,
+0xc0,0x01,0x03,0x00,0x80,0x40,0x16,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x59,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0c,0x00,
+0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x80,0x00,0x48,0x01,
+0x00,0x06,0xc0,0x00,0x80,0x40,0x46,0x00,0x80,0x00,0x06,0x01,0x00,0x09,0x40,0x00,
+0x80,0x00,0x21,0x01,0x40,0x00,0x83,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x05,0x69,0x74,0x65,0x72,0x31,0x00,0x00,
+0x05,0x69,0x74,0x65,0x72,0x32,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x30,
+0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x26,0x01,0x00,0x00,0x06,
+0x01,0x80,0x03,0x40,0x01,0x00,0x00,0x21,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x01,0x00,0x05,0x69,0x74,0x65,0x72,0x32,0x00,0x00,0x00,0x00,0x27,
+0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x03,0x00,0x80,0x00,0xab,0x00,0x80,0x00,0x20,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x63,0x61,
+0x6c,0x6c,0x00,0x00,0x00,0x00,0x2b,0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x04,0x00,
+0x00,0x00,0x26,0x01,0x00,0x00,0x2b,0x01,0x00,0x00,0x20,0x01,0x00,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,
+0x00,0x30,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x05,0x00,0xc0,0x00,0x83,0x01,0x00,
+0x00,0x06,0x01,0x80,0x03,0x40,0x01,0x00,0x00,0x21,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x05,0x69,0x74,0x65,0x72,0x31,0x00,0x00,0x00,
+0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x40,0x15,0x00,0x00,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0x01,
+0x00,0x03,0x00,0x00,0x00,0x09,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,
+0x00,0x46,0x00,0x80,0x00,0x06,0x01,0x00,0x05,0x40,0x00,0x80,0x00,0x21,0x01,0x40,
+0x00,0x83,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x02,0x00,0x01,0x6d,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x2f,0x00,
+0x02,0x00,0x04,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x26,0x01,0x00,0x00,0x2b,0x01,
+0xc0,0x00,0x03,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x01,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,0x2c,0x00,0x03,
+0x00,0x05,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x40,
+0x00,0x83,0x01,0x80,0x00,0xb0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x01,0x00,0x01,0x2a,0x00,0x00,0x00,0x00,0x49,0x00,0x01,0x00,0x03,0x00,0x00,
+0x00,0x09,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x80,
+0x00,0x06,0x01,0x00,0x05,0x40,0x00,0x80,0x00,0x21,0x01,0x00,0x00,0x02,0x00,0x80,
+0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x03,0x00,0x05,0x39,0x32,0x35,
+0x38,0x30,0x00,0x00,0x00,0x02,0x00,0x01,0x6d,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,
+0x00,0x00,0x3b,0x00,0x02,0x00,0x05,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x26,0x01,
+0x00,0x00,0x2b,0x01,0xd8,0x1c,0x03,0x02,0x00,0x00,0x02,0x01,0x00,0x01,0x20,0x01,
+0x00,0x00,0x29,0x00,0x00,0x00,0x01,0x03,0x00,0x05,0x36,0x37,0x38,0x39,0x30,0x00,
+0x00,0x00,0x01,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,0x38,0x00,0x04,
+0x00,0x06,0x00,0x00,0x00,0x07,0x04,0x00,0x00,0x26,0x02,0x00,0x40,0x01,0x02,0xc0,
+0x00,0x83,0x02,0x00,0x00,0xb0,0x02,0x80,0x80,0x01,0x02,0x00,0x40,0xac,0x02,0x00,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x2a,0x00,0x00,0x01,
+0x2b,0x00,0x00,0x00,0x00,0x58,0x00,0x02,0x00,0x05,0x00,0x00,0x00,0x0e,0x01,0x00,
+0x00,0x48,0x01,0x80,0x02,0xc0,0x01,0x00,0x00,0x46,0x00,0x80,0x00,0x05,0x01,0x00,
+0x00,0x06,0x01,0x80,0x05,0x40,0x01,0x00,0x00,0x21,0x01,0x80,0x40,0x01,0x01,0x00,
+0x81,0x37,0x01,0xc0,0x04,0x83,0x02,0x00,0x00,0x05,0x01,0x80,0xc1,0x37,0x01,0x00,
+0x40,0xb2,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,
+0x69,0x74,0x65,0x72,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x2f,0x00,0x02,
+0x00,0x04,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x26,0x01,0x00,0x00,0x2b,0x01,0xc0,
+0x04,0x83,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x01,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,0x1c,0x00,0x03,0x00,
+0x04,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x26,0x00,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x00,0x01,0x00,0x03,0x00,0x00,0x00,
+0x09,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x80,0x00,
+0x06,0x01,0x00,0x05,0x40,0x00,0x80,0x00,0x21,0x01,0x40,0x0a,0x03,0x00,0x80,0x40,
+0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x69,
+0x74,0x65,0x72,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x2f,0x00,0x02,0x00,
+0x04,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x26,0x01,0x00,0x00,0x2b,0x01,0xc0,0x04,
+0x83,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x01,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,0x3b,0x00,0x03,0x00,0x05,
+0x00,0x00,0x00,0x07,0x02,0x00,0x00,0x26,0x01,0x80,0x00,0x06,0x02,0x00,0x03,0x40,
+0x01,0x80,0x00,0x21,0x02,0x00,0x40,0x01,0x01,0x80,0x40,0xac,0x01,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x69,0x74,0x65,0x72,0x00,0x00,
+0x01,0x2b,0x00,0x00,0x00,0x00,0x28,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x04,0x02,
+0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x01,0x80,0x00,0xad,0x01,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0x94,0x00,
+0x05,0x00,0x0e,0x00,0x00,0x00,0x1c,0x02,0x80,0x00,0x48,0x03,0x00,0x02,0xc0,0x02,
+0x80,0x00,0x46,0x02,0x80,0x00,0x05,0x02,0x01,0x40,0x01,0x01,0x81,0x40,0x01,0x01,
+0x01,0x40,0x01,0x00,0x81,0x40,0x01,0x02,0x80,0x00,0x06,0x03,0x00,0x05,0x40,0x02,
+0x80,0x00,0x21,0x03,0x00,0x40,0x01,0x03,0x80,0x80,0x01,0x04,0x00,0xc0,0x01,0x04,
+0x81,0x00,0x01,0x03,0x01,0x82,0x37,0x02,0x80,0x40,0xac,0x03,0x40,0x04,0x83,0x03,
+0xc0,0x09,0x83,0x04,0x40,0x0e,0x83,0x04,0xc0,0x13,0x83,0x05,0x00,0x00,0x05,0x05,
+0x80,0x00,0x05,0x06,0x00,0x00,0x05,0x06,0x80,0x00,0x05,0x03,0x01,0x84,0x37,0x02,
+0x80,0x80,0xb2,0x02,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,
+0x04,0x69,0x74,0x65,0x72,0x00,0x00,0x01,0x2b,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,
+0x00,0x00,0x3b,0x00,0x02,0x00,0x07,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x26,0x01,
+0x00,0x00,0x2b,0x01,0xc0,0x04,0x83,0x02,0x40,0x09,0x83,0x02,0xc0,0x0e,0x83,0x03,
+0x40,0x13,0x83,0x01,0x00,0x02,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x01,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,0x30,0x00,0x06,
+0x00,0x0a,0x00,0x00,0x00,0x07,0x08,0x00,0x00,0x26,0x03,0x00,0x40,0x01,0x03,0x80,
+0x80,0x01,0x04,0x00,0xc0,0x01,0x04,0x81,0x00,0x01,0x00,0x01,0x82,0x37,0x00,0x00,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x03,
+0x00,0x0a,0x00,0x00,0x00,0x16,0x01,0x80,0x00,0x48,0x02,0x00,0x02,0xc0,0x01,0x80,
+0x00,0x46,0x01,0x80,0x00,0x05,0x01,0x00,0xc0,0x01,0x00,0x80,0xc0,0x01,0x01,0x80,
+0x00,0x06,0x02,0x00,0x05,0x40,0x01,0x80,0x00,0x21,0x02,0x00,0x40,0x01,0x02,0x80,
+0x80,0x01,0x02,0x01,0x01,0x37,0x01,0x80,0x40,0xac,0x02,0x40,0x04,0x83,0x02,0xc0,
+0x09,0x83,0x03,0x40,0x0e,0x83,0x03,0xc0,0x13,0x83,0x04,0x00,0x00,0x05,0x04,0x80,
+0x00,0x05,0x02,0x01,0x03,0x37,0x01,0x80,0x80,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x69,0x74,0x65,0x72,0x00,0x00,0x01,0x2b,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x3b,0x00,0x02,0x00,0x07,0x00,0x00,
+0x00,0x08,0x00,0x00,0x00,0x26,0x01,0x00,0x00,0x2b,0x01,0xc0,0x04,0x83,0x02,0x40,
+0x09,0x83,0x02,0xc0,0x0e,0x83,0x03,0x40,0x13,0x83,0x01,0x00,0x02,0x20,0x01,0x00,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x63,0x61,0x6c,0x6c,
+0x00,0x00,0x00,0x00,0x30,0x00,0x06,0x00,0x0a,0x00,0x00,0x00,0x07,0x08,0x00,0x00,
+0x26,0x03,0x00,0x40,0x01,0x03,0x80,0x80,0x01,0x04,0x00,0xc0,0x01,0x04,0x81,0x00,
+0x01,0x00,0x01,0x82,0x37,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x50,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x0c,0x00,0x80,0x00,
+0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x80,0x00,0x06,0x01,0x00,0x05,
+0x40,0x00,0x80,0x00,0x21,0x01,0x40,0x00,0x03,0x01,0xc0,0x00,0x83,0x01,0x80,0xc0,
+0xb7,0x01,0x00,0x81,0x37,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x69,0x74,0x65,0x72,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x00,0x00,0x33,0x00,0x02,0x00,0x05,0x00,0x00,0x00,0x06,0x00,0x00,0x00,
+0x26,0x01,0x00,0x00,0x2b,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x01,0x00,0x01,
+0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x63,
+0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,0x28,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x05,
+0x02,0x08,0x00,0x26,0x02,0x00,0x40,0x01,0x02,0x80,0x80,0x01,0x00,0x01,0x01,0x37,
+0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x50,
+0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x0c,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,
+0x00,0x80,0x00,0x46,0x00,0x80,0x00,0x06,0x01,0x00,0x05,0x40,0x00,0x80,0x00,0x21,
+0x01,0x40,0x00,0x03,0x01,0xc0,0x00,0x83,0x01,0x00,0x81,0x37,0x01,0x00,0x80,0xb7,
+0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
+0x00,0x04,0x69,0x74,0x65,0x72,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x33,
+0x00,0x02,0x00,0x05,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x26,0x01,0x00,0x00,0x2b,
+0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,
+0x00,0x00,0x24,0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x04,0x00,0x08,0x00,0x26,0x01,
+0x80,0x40,0x01,0x00,0x00,0xc0,0xb7,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x50,0x00,0x01,0x00,0x05,0x00,0x00,0x00,0x0c,0x00,
+0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x80,0x00,0x06,0x01,
+0x00,0x05,0x40,0x00,0x80,0x00,0x21,0x01,0x40,0x00,0x03,0x01,0xc0,0x00,0x83,0x02,
+0x01,0x00,0x37,0x01,0x00,0x81,0xb7,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x69,0x74,0x65,0x72,0x00,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x00,0x00,0x33,0x00,0x02,0x00,0x05,0x00,0x00,0x00,0x06,0x00,
+0x00,0x00,0x26,0x01,0x00,0x00,0x2b,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x01,
+0x00,0x01,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,
+0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,0x2c,0x00,0x05,0x00,0x08,0x00,0x00,
+0x00,0x06,0x04,0x08,0x00,0x26,0x02,0x80,0x40,0x01,0x03,0x00,0x80,0x01,0x03,0x80,
+0xc0,0x01,0x00,0x01,0x41,0xb7,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x41,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x09,0x00,0x80,
+0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x80,0x00,0x06,0x01,0x00,
+0x05,0x40,0x00,0x80,0x00,0x21,0x01,0x40,0x00,0x03,0x00,0x80,0x40,0xb2,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x6d,0x00,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x00,0x00,0x2b,0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x04,0x00,
+0x00,0x00,0x26,0x01,0x00,0x00,0x2b,0x01,0x00,0x00,0x20,0x01,0x00,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,
+0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x40,0x00,0x03,0x00,0x00,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0x01,
+0x00,0x03,0x00,0x00,0x00,0x09,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,
+0x00,0x46,0x00,0x80,0x00,0x06,0x01,0x00,0x05,0x40,0x00,0x80,0x00,0x21,0x01,0x5d,
+0x8c,0x03,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x02,0x00,0x01,0x6d,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x2f,0x00,
+0x02,0x00,0x04,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x26,0x01,0x00,0x00,0x2b,0x01,
+0xc0,0x3d,0x03,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x01,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,0x2c,0x00,0x03,
+0x00,0x05,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x00,0x06,0x02,0x00,
+0x03,0x40,0x01,0x80,0x00,0x21,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x01,0x00,0x01,0x6d,0x00,0x00,0x00,0x00,0x2c,0x00,0x03,0x00,0x05,0x00,0x00,
+0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x15,0x02,0x00,0x40,0x01,0x01,0x80,
+0x00,0xb0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,
+0x2a,0x00,0x00,0x00,0x00,0x45,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x0a,0x00,0x80,
+0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x80,0x00,0x06,0x01,0x40,
+0x00,0x03,0x01,0x80,0x05,0x40,0x00,0x80,0x00,0xa1,0x01,0x40,0x00,0x83,0x00,0x80,
+0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,
+0x6d,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x2f,0x00,0x03,0x00,0x05,0x00,
+0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x82,0x00,0x2b,0x02,0x00,0x40,0x01,0x01,
+0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,
+0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,0x30,0x00,0x03,0x00,0x06,0x00,0x00,
+0x00,0x06,0x02,0x00,0x00,0x26,0x01,0x80,0x00,0x06,0x02,0x40,0x00,0x83,0x02,0x80,
+0x03,0x40,0x01,0x80,0x00,0xa1,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x01,0x00,0x01,0x6d,0x00,0x00,0x00,0x00,0x2c,0x00,0x03,0x00,0x05,0x00,0x00,
+0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x15,0x02,0x00,0x40,0x01,0x01,0x80,
+0x00,0xb0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,
+0x2a,0x00,0x00,0x00,0x00,0x41,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x08,0x00,0xbf,
+0xff,0x83,0x01,0x40,0x01,0x03,0x01,0x80,0x03,0x40,0x01,0x00,0x00,0x21,0x01,0x00,
+0x40,0x01,0x01,0xc0,0x04,0x03,0x01,0x00,0x40,0xb2,0x01,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x05,0x74,0x69,0x6d,0x65,0x73,0x00,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x00,0x00,0x30,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x05,0x02,
+0x00,0x00,0x26,0x01,0xc0,0x00,0x83,0x02,0x00,0x03,0x40,0x01,0x80,0x00,0x21,0x01,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x05,0x74,0x69,0x6d,
+0x65,0x73,0x00,0x00,0x00,0x00,0x38,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x08,0x02,
+0x00,0x00,0x26,0x01,0x80,0x40,0x95,0x02,0x00,0x40,0x15,0x02,0x80,0x40,0x01,0x02,
+0x00,0x00,0xac,0x01,0x80,0x00,0xac,0x01,0x80,0x40,0x96,0x01,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0x39,0x00,
+0x01,0x00,0x03,0x00,0x00,0x00,0x06,0x00,0xc0,0x01,0x03,0x01,0x00,0x03,0x40,0x00,
+0x80,0x00,0x21,0x01,0x40,0x04,0x83,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x05,0x74,0x69,0x6d,0x65,0x73,0x00,0x00,
+0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x20,0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x03,
+0x02,0x00,0x00,0x26,0x01,0xc0,0x04,0x83,0x01,0x80,0x40,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4c,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x0b,
+0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x80,0x00,0x06,
+0x01,0x00,0x05,0x40,0x00,0x80,0x00,0x21,0x01,0x40,0x00,0x03,0x01,0xc0,0x00,0x83,
+0x01,0x00,0x81,0x37,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x02,0x00,0x04,0x69,0x74,0x65,0x72,0x00,0x00,0x02,0x3d,0x3d,0x00,
+0x00,0x00,0x00,0x37,0x00,0x02,0x00,0x06,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x26,
+0x01,0x00,0x00,0x2b,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x01,0x03,
+0x01,0x00,0x01,0xa0,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,0x28,0x00,0x04,0x00,0x06,0x00,
+0x00,0x00,0x05,0x04,0x00,0x00,0x26,0x02,0x00,0x40,0x01,0x02,0x80,0x80,0x01,0x00,
+0x01,0x01,0x37,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x4c,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x0b,0x00,0x80,0x00,0x48,0x01,
+0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x80,0x00,0x06,0x01,0x00,0x05,0x40,0x00,
+0x80,0x00,0x21,0x01,0x40,0x00,0x03,0x01,0x80,0x00,0x05,0x01,0x00,0x81,0x37,0x00,
+0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,
+0x04,0x69,0x74,0x65,0x72,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x2f,0x00,
+0x02,0x00,0x04,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x26,0x01,0x00,0x00,0x2b,0x01,
+0xc0,0x00,0x03,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x01,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,0x28,0x00,0x04,
+0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x26,0x02,0x00,0x40,0x01,0x02,0x80,
+0x80,0x01,0x00,0x01,0x01,0x37,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x41,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x09,0x00,0x80,
+0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x80,0x00,0x06,0x01,0x00,
+0x05,0x40,0x00,0x80,0x00,0x21,0x01,0x00,0x00,0x05,0x00,0x80,0x40,0xb2,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x6d,0x00,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x00,0x00,0x2b,0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x04,0x00,
+0x00,0x00,0x26,0x01,0x00,0x00,0x2b,0x01,0x00,0x00,0x20,0x01,0x00,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,
+0x00,0x1c,0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0xa6,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0x01,
+0x00,0x03,0x00,0x00,0x00,0x09,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,
+0x00,0x46,0x00,0x80,0x00,0x06,0x01,0x00,0x05,0x40,0x00,0x80,0x00,0x21,0x01,0x00,
+0x00,0x05,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x02,0x00,0x01,0x6d,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x2b,0x00,
+0x02,0x00,0x03,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x26,0x01,0x00,0x00,0x2b,0x01,
+0x00,0x00,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,
+0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,0x20,0x00,0x03,0x00,0x04,0x00,0x00,
+0x00,0x03,0x02,0x00,0x00,0x26,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5d,0x00,0x02,0x00,0x05,0x00,0x00,
+0x00,0x10,0x01,0x00,0x00,0x48,0x01,0x80,0x02,0xc0,0x01,0x00,0x00,0x46,0x01,0x40,
+0x00,0x03,0x01,0xc0,0x00,0x83,0x02,0x40,0x01,0x03,0x00,0x80,0x81,0xb7,0x01,0x00,
+0x00,0x06,0x01,0x80,0xc0,0x37,0x02,0x00,0x40,0x01,0x01,0x81,0x00,0x38,0x02,0x00,
+0x05,0x40,0x01,0x00,0x3f,0xa1,0x01,0xc0,0x00,0x03,0x01,0x00,0x40,0xb2,0x01,0x00,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x6d,0x00,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x00,0x00,0x2b,0x00,0x04,0x00,0x05,0x00,0x00,0x00,0x04,0x02,
+0x08,0x00,0x26,0x02,0x03,0x00,0x2b,0x02,0x00,0x00,0x20,0x02,0x00,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,
+0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x40,0x00,0x03,0x00,0x00,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0x01,
+0x00,0x03,0x00,0x00,0x00,0x09,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,
+0x00,0x46,0x00,0x80,0x00,0x06,0x01,0x00,0x05,0x40,0x00,0x80,0x00,0x21,0x01,0x00,
+0x00,0x05,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x02,0x00,0x01,0x6d,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x2b,0x00,
+0x02,0x00,0x03,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x26,0x01,0x00,0x00,0x2b,0x01,
+0x00,0x00,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,
+0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,0x20,0x00,0x02,0x00,0x03,0x00,0x00,
+0x00,0x03,0x02,0x00,0x00,0x26,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x00,0x01,0x00,0x03,0x00,0x00,
+0x00,0x0a,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x80,
+0x00,0x06,0x01,0x00,0x05,0x40,0x00,0x80,0x00,0x21,0x01,0x3f,0xff,0x83,0x01,0x00,
+0x80,0xb7,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x02,0x00,0x01,0x6d,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x33,0x00,
+0x02,0x00,0x04,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x26,0x01,0x00,0x00,0x2b,0x01,
+0xbf,0xff,0x83,0x01,0x80,0xc0,0xb7,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,
+0x00,0x1c,0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0xa6,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x58,0x00,0x02,
+0x00,0x04,0x00,0x00,0x00,0x09,0x00,0x80,0x00,0x08,0x01,0x40,0x00,0x03,0x01,0x80,
+0x03,0x40,0x01,0x00,0x00,0x21,0x01,0x00,0x40,0x01,0x01,0x00,0x40,0x20,0x01,0x80,
+0x01,0x91,0x01,0x00,0x80,0xb2,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x04,0x00,0x05,0x74,0x69,0x6d,0x65,0x73,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,
+0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x08,0x4e,0x69,0x6c,0x43,0x6c,0x61,0x73,
+0x73,0x00,0x00,0x00,0x00,0x20,0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,
+0x00,0xa6,0x00,0x80,0x40,0x16,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x7a,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x0e,0x01,0x00,
+0x00,0x05,0x01,0x80,0x00,0x05,0x01,0x00,0x00,0x43,0x01,0x00,0x00,0xc5,0x01,0x00,
+0x00,0x05,0x01,0x80,0x00,0x05,0x01,0x00,0x40,0x43,0x01,0x00,0x04,0x45,0x01,0x00,
+0x00,0x11,0x01,0x00,0x80,0x20,0x00,0x80,0x80,0x01,0x01,0x00,0x40,0x01,0x01,0x00,
+0xc0,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x0a,
+0x43,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x6c,0x65,0x72,0x00,0x00,0x09,0x52,0x65,0x73,
+0x70,0x6f,0x6e,0x64,0x65,0x72,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x0c,0x74,
+0x65,0x73,0x74,0x5f,0x66,0x6f,0x72,0x5f,0x62,0x75,0x67,0x00,0x00,0x00,0x00,0x65,
+0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x0b,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,
+0x00,0x80,0x00,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x04,0xc0,0x00,0x80,0x40,0x46,
+0x00,0x80,0x00,0x48,0x01,0x00,0x0c,0xc0,0x00,0x80,0x80,0x46,0x00,0x00,0x00,0x05,
+0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x0a,0x72,0x65,
+0x73,0x70,0x6f,0x6e,0x64,0x5f,0x74,0x6f,0x00,0x00,0x0c,0x74,0x65,0x73,0x74,0x5f,
+0x66,0x6f,0x72,0x5f,0x62,0x75,0x67,0x00,0x00,0x06,0x72,0x65,0x6e,0x64,0x65,0x72,
+0x00,0x00,0x00,0x00,0x5f,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,
+0xa6,0x01,0x80,0x00,0x11,0x01,0x80,0x40,0x20,0x01,0x00,0xc0,0x01,0x01,0x80,0x40,
+0x01,0x02,0x00,0x80,0x01,0x01,0x80,0x80,0xa0,0x01,0x80,0x80,0x01,0x01,0x80,0xc0,
+0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x09,0x52,
+0x65,0x73,0x70,0x6f,0x6e,0x64,0x65,0x72,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,
+0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x07,0x72,0x65,0x73,0x70,0x6f,0x6e,0x64,0x00,
+0x00,0x00,0x00,0x35,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x26,
+0x01,0x00,0x00,0x06,0x01,0x80,0x03,0x40,0x01,0x00,0x00,0x21,0x01,0x00,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x0a,0x72,0x65,0x73,0x70,0x6f,0x6e,
+0x64,0x5f,0x74,0x6f,0x00,0x00,0x00,0x00,0x2d,0x00,0x03,0x00,0x05,0x00,0x00,0x00,
+0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x00,0x03,0x40,0x01,0x80,0x00,
+0x21,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x6a,
+0x73,0x00,0x00,0x00,0x00,0x2d,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x04,0x00,0x80,
+0x00,0x06,0x01,0x00,0x03,0x40,0x00,0x80,0x00,0x21,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x06,0x72,0x65,0x6e,0x64,0x65,0x72,0x00,0x00,
+0x00,0x00,0x1c,0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x26,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x00,
+0x02,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0xa6,0x00,0x00,0x00,0x3d,0x00,
+0x00,0x00,0x29,0x00,0x00,0x00,0x01,0x10,0x00,0x09,0x69,0x6e,0x20,0x72,0x65,0x6e,
+0x64,0x65,0x72,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4f,0x00,0x01,0x00,0x02,0x00,
+0x00,0x00,0x08,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,
+0x80,0x00,0x48,0x01,0x00,0x06,0xc0,0x00,0x80,0x40,0x46,0x00,0x00,0x00,0x05,0x00,
+0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x0e,0x6d,0x65,0x74,
+0x68,0x6f,0x64,0x5f,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x00,0x00,0x07,0x72,0x65,
+0x73,0x70,0x6f,0x6e,0x64,0x00,0x00,0x00,0x00,0x60,0x00,0x03,0x00,0x05,0x00,0x00,
+0x00,0x07,0x02,0x00,0x00,0xa6,0x01,0x80,0x00,0x11,0x02,0x00,0x03,0x40,0x01,0x80,
+0x40,0x21,0x01,0x80,0x01,0x0e,0x00,0x00,0x00,0x3d,0x00,0x00,0x00,0x29,0x00,0x00,
+0x00,0x01,0x10,0x00,0x14,0x6c,0x65,0x61,0x76,0x65,0x20,0x6d,0x65,0x74,0x68,0x6f,
+0x64,0x5f,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,0x00,0x00,0x00,0x03,0x00,0x04,0x50,
+0x72,0x6f,0x63,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x09,0x40,0x72,0x65,0x73,
+0x70,0x6f,0x6e,0x73,0x65,0x00,0x00,0x00,0x00,0x27,0x00,0x01,0x00,0x02,0x00,0x00,
+0x00,0x03,0x00,0x80,0x80,0x15,0x00,0x80,0x00,0x20,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,
+0x37,0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x26,0x01,0x00,0x00,
+0x0d,0x01,0x00,0x40,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x02,0x00,0x09,0x40,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x00,0x00,0x04,0x63,
+0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,0x61,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x08,
+0x00,0x80,0x00,0x05,0x00,0x80,0x00,0x44,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x11,
+0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x84,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x19,0x54,0x65,0x73,0x74,0x52,0x65,
+0x74,0x75,0x72,0x6e,0x46,0x72,0x6f,0x6d,0x4e,0x65,0x73,0x74,0x65,0x64,0x42,0x6c,
+0x6f,0x63,0x6b,0x00,0x00,0x04,0x74,0x65,0x73,0x74,0x00,0x00,0x02,0x3d,0x3d,0x00,
+0x00,0x02,0x6f,0x6b,0x00,0x00,0x00,0x00,0x33,0x00,0x01,0x00,0x02,0x00,0x00,0x00,
+0x06,0x00,0x80,0x00,0x06,0x00,0x80,0x40,0x47,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,
+0x46,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x01,0x00,0x04,0x74,0x65,0x73,0x74,0x00,0x00,0x00,0x00,0x3a,0x00,0x02,0x00,0x04,
+0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x26,0x01,0x40,0x00,0x03,0x01,0x80,0x03,0x40,
+0x01,0x00,0x00,0x21,0x00,0x00,0x00,0x84,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x02,0x00,0x05,0x74,0x69,0x6d,0x65,0x73,0x00,0x00,0x03,0x62,0x61,
+0x64,0x00,0x00,0x00,0x00,0x2c,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x04,0x00,0xc0,
+0x00,0x03,0x01,0x00,0x03,0x40,0x00,0x80,0x00,0x21,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x05,0x74,0x69,0x6d,0x65,0x73,0x00,0x00,0x00,
+0x00,0x21,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x80,0x00,0x04,0x00,0x80,
+0x80,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x6f,0x6b,0x00,0x00,
+0x00,0x00,0x6b,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x08,0x00,0x80,0x00,0x05,0x00,
+0x80,0x00,0x44,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,
+0x00,0x01,0x84,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x04,0x00,0x23,0x54,0x65,0x73,0x74,0x52,0x65,0x74,0x75,0x72,0x6e,0x46,
+0x72,0x6f,0x6d,0x4e,0x65,0x73,0x74,0x65,0x64,0x42,0x6c,0x6f,0x63,0x6b,0x5f,0x42,
+0x53,0x42,0x6c,0x6f,0x63,0x6b,0x33,0x34,0x00,0x00,0x04,0x74,0x65,0x73,0x74,0x00,
+0x00,0x02,0x3d,0x3d,0x00,0x00,0x02,0x6f,0x6b,0x00,0x00,0x00,0x00,0x33,0x00,0x01,
+0x00,0x02,0x00,0x00,0x00,0x06,0x00,0x80,0x00,0x06,0x00,0x80,0x40,0x47,0x01,0x00,
+0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x74,0x65,0x73,0x74,0x00,0x00,0x00,0x00,
+0x3a,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x26,0x01,0x40,0x00,
+0x03,0x01,0x80,0x03,0x40,0x01,0x00,0x00,0x21,0x00,0x00,0x00,0x84,0x00,0x00,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x05,0x74,0x69,0x6d,0x65,0x73,
+0x00,0x00,0x03,0x62,0x61,0x64,0x00,0x00,0x00,0x00,0x35,0x00,0x01,0x00,0x02,0x00,
+0x00,0x00,0x07,0x00,0x40,0x01,0x17,0x00,0x80,0x00,0x04,0x00,0x80,0x80,0x29,0x00,
+0x80,0x00,0x07,0x00,0xbf,0xfe,0x18,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x6f,0x6b,0x00,0x00,0x00,0x00,0x6b,
+0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x08,0x00,0x80,0x00,0x05,0x00,0x80,0x00,0x44,
+0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x84,
+0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,
+0x00,0x23,0x54,0x65,0x73,0x74,0x52,0x65,0x74,0x75,0x72,0x6e,0x46,0x72,0x6f,0x6d,
+0x4e,0x65,0x73,0x74,0x65,0x64,0x42,0x6c,0x6f,0x63,0x6b,0x5f,0x42,0x53,0x42,0x6c,
+0x6f,0x63,0x6b,0x33,0x35,0x00,0x00,0x04,0x74,0x65,0x73,0x74,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x02,0x6f,0x6b,0x00,0x00,0x00,0x00,0x33,0x00,0x01,0x00,0x02,0x00,
+0x00,0x00,0x06,0x00,0x80,0x00,0x06,0x00,0x80,0x40,0x47,0x01,0x00,0x02,0xc0,0x00,
+0x80,0x00,0x46,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x01,0x00,0x04,0x74,0x65,0x73,0x74,0x00,0x00,0x00,0x00,0x3a,0x00,0x02,
+0x00,0x04,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x26,0x01,0x40,0x00,0x03,0x01,0x80,
+0x03,0x40,0x01,0x00,0x00,0x21,0x00,0x00,0x00,0x84,0x00,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x05,0x74,0x69,0x6d,0x65,0x73,0x00,0x00,0x03,
+0x62,0x61,0x64,0x00,0x00,0x00,0x00,0x35,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x07,
+0x00,0x40,0x01,0x17,0x00,0x80,0x00,0x04,0x00,0x80,0x80,0x29,0x00,0x80,0x00,0x08,
+0x00,0xbf,0xfe,0x19,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x01,0x00,0x02,0x6f,0x6b,0x00,0x00,0x00,0x00,0x29,0x00,0x01,0x00,
+0x03,0x00,0x00,0x00,0x04,0x00,0x80,0x00,0x07,0x01,0x00,0x00,0x07,0x00,0x80,0x00,
+0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x00,0x00,0x41,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,
+0x00,0x11,0x01,0x00,0x00,0x07,0x01,0x00,0x80,0x20,0x00,0x80,0x40,0xb2,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x09,0x54,0x72,0x75,0x65,
+0x43,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x63,0x6c,0x61,
+0x73,0x73,0x00,0x00,0x00,0x00,0x29,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x04,0x00,
+0x80,0x00,0x08,0x01,0x00,0x00,0x08,0x00,0x80,0x00,0xb2,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x42,
+0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x11,0x01,0x00,0x00,0x08,
+0x01,0x00,0x80,0x20,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x03,0x00,0x0a,0x46,0x61,0x6c,0x73,0x65,0x43,0x6c,0x61,0x73,0x73,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x00,
+0x00,0x3d,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x3d,0x01,0x00,
+0x00,0x05,0x01,0x00,0x40,0x20,0x00,0x80,0x00,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x01,0x10,0x00,0x03,0x6e,0x69,0x6c,0x00,0x00,0x00,0x02,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x07,0x69,0x6e,0x73,0x70,0x65,0x63,0x74,0x00,0x00,0x00,0x00,0x40,0x00,
+0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x11,0x01,0x00,0x00,0x05,0x01,
+0x00,0x80,0x20,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x03,0x00,0x08,0x4e,0x69,0x6c,0x43,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x44,0x00,
+0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x11,0x01,0x00,0x01,0x04,0x01,
+0x00,0xc0,0x20,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x04,0x00,0x06,0x53,0x79,0x6d,0x62,0x6f,0x6c,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x03,0x73,0x79,0x6d,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,
+0x00,0x00,0x29,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x04,0x00,0xc2,0x68,0x83,0x01,
+0x42,0x68,0x83,0x00,0x80,0x00,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x01,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x3e,0x00,0x01,0x00,0x03,
+0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x11,0x01,0x42,0x68,0x83,0x01,0x00,0x80,0x20,
+0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,
+0x00,0x06,0x46,0x69,0x78,0x6e,0x75,0x6d,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,
+0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x3d,0x00,0x01,0x00,0x03,0x00,0x00,
+0x00,0x05,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x00,0x11,0x00,0x80,
+0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x05,
+0x43,0x6c,0x61,0x73,0x73,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x00,0x00,0x4b,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,
+0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x05,0x43,0x6c,0x61,
+0x73,0x73,0x00,0x00,0x0a,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,0x73,0x73,0x00,
+0x00,0x02,0x3d,0x3d,0x00,0x00,0x06,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x00,0x00,0x00,
+0x00,0xb2,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x1b,0x02,0x00,0x00,0x05,0x02,0x80,
+0x00,0x05,0x02,0x00,0x00,0x43,0x02,0x00,0x00,0xc5,0x02,0x00,0x00,0x11,0x02,0x80,
+0x00,0x3d,0x02,0x00,0x40,0xa0,0x00,0x81,0x00,0x01,0x02,0x00,0x40,0x01,0x02,0x00,
+0x80,0x20,0x01,0x01,0x00,0x01,0x02,0x00,0x00,0x11,0x02,0x80,0x00,0xbd,0x02,0x00,
+0x40,0xa0,0x01,0x81,0x00,0x01,0x02,0x00,0x40,0x01,0x02,0x00,0xc0,0x20,0x02,0x80,
+0x80,0x01,0x02,0x80,0xc0,0x20,0x02,0x01,0x00,0xb2,0x02,0x40,0x02,0x99,0x02,0x00,
+0x40,0x01,0x02,0x00,0xc0,0x20,0x02,0x80,0xc0,0x01,0x02,0x80,0xc0,0x20,0x02,0x01,
+0x40,0xa0,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x02,0x10,0x00,0x03,0x46,0x6f,0x6f,
+0x10,0x00,0x03,0x42,0x61,0x72,0x00,0x00,0x00,0x06,0x00,0x09,0x54,0x65,0x73,0x74,
+0x43,0x6c,0x61,0x73,0x73,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x03,0x64,0x75,
+0x70,0x00,0x00,0x01,0x6e,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x02,0x21,0x3d,0x00,
+0x00,0x00,0x00,0x73,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0b,0x00,0x80,0x00,0x06,
+0x01,0x00,0x00,0x84,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,
+0x00,0x80,0x80,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x04,0xc0,0x00,0x80,0xc0,0x46,
+0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,
+0x00,0x0d,0x61,0x74,0x74,0x72,0x5f,0x61,0x63,0x63,0x65,0x73,0x73,0x6f,0x72,0x00,
+0x00,0x01,0x6e,0x00,0x00,0x0a,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x69,0x7a,0x65,
+0x00,0x00,0x0f,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x69,0x7a,0x65,0x5f,0x63,0x6f,
+0x70,0x79,0x00,0x00,0x00,0x00,0x25,0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x03,0x02,
+0x00,0x00,0x26,0x00,0x80,0x00,0x0e,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x01,0x00,0x02,0x40,0x6e,0x00,0x00,0x00,0x00,0x31,0x00,0x03,0x00,0x04,
+0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x00,0x06,0x01,0x80,0x00,0x20,
+0x01,0x80,0x00,0x8e,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
+0x00,0x01,0x6e,0x00,0x00,0x02,0x40,0x6e,0x00,0x00,0x00,0x00,0x72,0x00,0x01,0x00,
+0x03,0x00,0x00,0x00,0x0b,0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x05,0x00,0x80,0x00,
+0x43,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x11,0x01,0x00,0x01,0x04,0x00,0x80,0x40,
+0xa0,0x00,0x80,0xc0,0x20,0x01,0x00,0x02,0x84,0x00,0x81,0x00,0xb2,0x00,0x80,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x09,0x54,0x65,0x73,0x74,0x43,
+0x6c,0x61,0x73,0x73,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x03,0x61,0x72,0x67,
+0x00,0x00,0x06,0x72,0x65,0x73,0x75,0x6c,0x74,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,
+0x09,0x6f,0x6e,0x6c,0x79,0x5f,0x61,0x72,0x67,0x73,0x00,0x00,0x00,0x00,0x4a,0x00,
+0x01,0x00,0x02,0x00,0x00,0x00,0x08,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,
+0x80,0x00,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x04,0xc0,0x00,0x80,0x40,0x46,0x00,
+0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,
+0x0a,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x69,0x7a,0x65,0x00,0x00,0x06,0x72,0x65,
+0x73,0x75,0x6c,0x74,0x00,0x00,0x00,0x00,0xab,0x00,0x03,0x00,0x04,0x00,0x00,0x00,
+0x17,0x02,0x00,0x00,0xa6,0x01,0x80,0x40,0x01,0x01,0x80,0x00,0x20,0x01,0x80,0x40,
+0x20,0x01,0xc0,0x01,0x19,0x01,0x80,0x80,0x01,0x01,0x80,0x00,0x20,0x01,0xc0,0x01,
+0x19,0x01,0x80,0x01,0x04,0x00,0x40,0x05,0x97,0x01,0x80,0x40,0x01,0x01,0x80,0x00,
+0x20,0x01,0x80,0x40,0x20,0x01,0xc0,0x01,0x99,0x01,0x80,0x80,0x01,0x01,0x80,0x00,
+0x20,0x01,0x80,0x40,0x20,0x01,0xc0,0x01,0x19,0x01,0x80,0x01,0x84,0x00,0x40,0x00,
+0x97,0x01,0x80,0x02,0x04,0x01,0x80,0x02,0x8e,0x01,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x06,0x00,0x04,0x6e,0x69,0x6c,0x3f,0x00,0x00,0x01,0x21,0x00,
+0x00,0x09,0x6f,0x6e,0x6c,0x79,0x5f,0x61,0x72,0x67,0x73,0x00,0x00,0x0e,0x61,0x72,
+0x67,0x73,0x5f,0x61,0x6e,0x64,0x5f,0x62,0x6c,0x6f,0x63,0x6b,0x00,0x00,0x06,0x62,
+0x72,0x6f,0x6b,0x65,0x6e,0x00,0x00,0x07,0x40,0x72,0x65,0x73,0x75,0x6c,0x74,0x00,
+0x00,0x00,0x00,0x2a,0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x26,
+0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+0x00,0x07,0x40,0x72,0x65,0x73,0x75,0x6c,0x74,0x00,0x00,0x00,0x00,0x5e,0x00,0x01,
+0x00,0x03,0x00,0x00,0x00,0x09,0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x11,0x00,0x80,
+0x40,0x43,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x91,0x00,0x80,0x80,0x20,0x01,0x00,
+0x00,0x11,0x00,0x80,0xc0,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x04,0x00,0x06,0x53,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x08,0x53,0x75,0x62,
+0x43,0x6c,0x61,0x73,0x73,0x00,0x00,0x0a,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,
+0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,
+0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x09,
+0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x05,0x00,0x80,0x00,0x43,0x00,0x80,0x00,0xc5,
+0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x02,0x43,0x31,
+0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,
+0x43,0x6c,0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,
+0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x54,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0a,0x00,0x80,
+0x00,0x05,0x01,0x00,0x00,0x05,0x00,0x80,0x00,0x43,0x00,0x80,0x00,0xc5,0x00,0x80,
+0x00,0x11,0x00,0x80,0x40,0x20,0x00,0x80,0x80,0x20,0x01,0x00,0x00,0x11,0x00,0x80,
+0xc0,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x02,
+0x43,0x32,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,
+0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0b,0x00,0x80,
+0x00,0x05,0x01,0x00,0x00,0x05,0x00,0x80,0x00,0x43,0x00,0x80,0x00,0xc5,0x00,0x80,
+0x00,0x11,0x00,0x80,0x40,0x20,0x00,0x80,0x80,0x20,0x00,0x80,0x80,0x20,0x01,0x00,
+0x02,0x11,0x00,0x80,0xc0,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x05,0x00,0x02,0x43,0x33,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x05,0x63,
+0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x43,0x6c,0x61,0x73,
+0x73,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,
+0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x69,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0d,0x00,0x80,0x00,0x05,0x01,0x00,
+0x00,0x05,0x00,0x80,0x00,0x43,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x05,0x01,0x00,
+0x00,0x11,0x00,0x80,0x40,0x43,0x00,0x80,0x01,0x45,0x00,0x80,0x00,0x91,0x00,0x80,
+0x80,0x20,0x01,0x00,0x02,0x11,0x00,0x80,0xc0,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x43,0x34,0x5f,0x41,0x00,0x00,0x02,0x43,
+0x34,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,
+0x05,0x43,0x6c,0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,
+0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,
+0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x6b,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0e,0x00,0x80,0x00,0x05,0x01,
+0x00,0x00,0x05,0x00,0x80,0x00,0x43,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x05,0x01,
+0x00,0x00,0x11,0x00,0x80,0x40,0x43,0x00,0x80,0x01,0x45,0x00,0x80,0x00,0x91,0x00,
+0x80,0x80,0x20,0x00,0x80,0xc0,0x20,0x01,0x00,0x00,0x91,0x00,0x81,0x00,0xb2,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x43,0x35,0x5f,
+0x41,0x00,0x00,0x02,0x43,0x35,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x05,0x63,
+0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,
+0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,
+0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x77,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0f,0x00,0x80,
+0x00,0x05,0x01,0x00,0x00,0x05,0x00,0x80,0x00,0x43,0x00,0x80,0x00,0xc5,0x00,0x80,
+0x00,0x05,0x01,0x00,0x00,0x11,0x00,0x80,0x40,0x43,0x00,0x80,0x01,0x45,0x00,0x80,
+0x00,0x91,0x00,0x80,0x80,0x20,0x00,0x80,0xc0,0x20,0x00,0x80,0xc0,0x20,0x01,0x00,
+0x02,0x91,0x00,0x81,0x00,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x06,0x00,0x04,0x43,0x36,0x5f,0x41,0x00,0x00,0x02,0x43,0x36,0x00,0x00,0x03,
+0x6e,0x65,0x77,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x05,0x43,0x6c,0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,
+0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,
+0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0xb1,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x1e,0x01,0x00,0x00,
+0x05,0x01,0x80,0x00,0x05,0x01,0x00,0x00,0x43,0x01,0x00,0x00,0xc5,0x01,0x00,0x00,
+0x05,0x01,0x80,0x00,0x05,0x01,0x00,0x40,0x43,0x01,0x00,0x01,0x45,0x01,0x00,0x00,
+0x05,0x01,0x80,0x00,0x11,0x01,0x00,0x80,0x43,0x01,0x00,0x01,0xc5,0x00,0x80,0x00,
+0x08,0x00,0x40,0x02,0x9a,0x01,0x00,0x00,0x05,0x01,0x80,0x00,0x91,0x01,0x00,0x80,
+0x43,0x01,0x00,0x02,0x45,0x00,0x40,0x04,0x97,0x01,0x00,0x00,0x1b,0x01,0x80,0x01,
+0x91,0x02,0x00,0x80,0x01,0x01,0x81,0x00,0xa0,0x01,0xc0,0x00,0x98,0x00,0x40,0x01,
+0x17,0x00,0x80,0x00,0x07,0x00,0x40,0x01,0x17,0x01,0x00,0x00,0x1d,0x00,0x80,0x00,
+0x1c,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x04,0x43,
+0x37,0x5f,0x41,0x00,0x00,0x04,0x43,0x37,0x5f,0x42,0x00,0x00,0x02,0x43,0x37,0x00,
+0x00,0x09,0x54,0x79,0x70,0x65,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x03,0x3d,0x3d,
+0x3d,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,
+0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,
+0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,
+0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x9a,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x1a,0x01,0x00,
+0x00,0x05,0x01,0x80,0x00,0x05,0x01,0x00,0x00,0x43,0x01,0x00,0x00,0xc5,0x01,0x00,
+0x00,0x05,0x01,0x80,0x00,0x05,0x01,0x00,0x40,0x43,0x01,0x00,0x01,0x45,0x00,0x80,
+0x00,0x08,0x00,0x40,0x02,0x9a,0x01,0x00,0x00,0x05,0x01,0x80,0x00,0x11,0x01,0x00,
+0x40,0x43,0x01,0x00,0x01,0xc5,0x00,0x40,0x04,0x97,0x01,0x00,0x00,0x1b,0x01,0x80,
+0x01,0x11,0x02,0x00,0x80,0x01,0x01,0x80,0xc0,0xa0,0x01,0xc0,0x00,0x98,0x00,0x40,
+0x01,0x17,0x00,0x80,0x00,0x07,0x00,0x40,0x01,0x17,0x01,0x00,0x00,0x1d,0x00,0x80,
+0x00,0x1c,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,
+0x43,0x38,0x5f,0x41,0x00,0x00,0x02,0x43,0x38,0x00,0x00,0x09,0x54,0x79,0x70,0x65,
+0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x03,0x3d,0x3d,0x3d,0x00,0x00,0x00,0x00,0x1c,
+0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,
+0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,
+0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x88,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x14,0x01,0x00,0x00,0x3d,
+0x01,0x00,0x00,0x12,0x00,0x80,0x00,0x08,0x00,0x40,0x02,0x9a,0x01,0x00,0x00,0x05,
+0x01,0x80,0x00,0x05,0x01,0x00,0x00,0x43,0x01,0x00,0x00,0xc5,0x00,0x40,0x04,0x97,
+0x01,0x00,0x00,0x1b,0x01,0x80,0x00,0x91,0x02,0x00,0x80,0x01,0x01,0x80,0x80,0xa0,
+0x01,0xc0,0x00,0x98,0x00,0x40,0x01,0x17,0x00,0x80,0x00,0x07,0x00,0x40,0x01,0x17,
+0x01,0x00,0x00,0x1d,0x00,0x80,0x00,0x1c,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,
+0x10,0x00,0x01,0x61,0x00,0x00,0x00,0x03,0x00,0x0b,0x43,0x6c,0x61,0x73,0x73,0x39,
+0x43,0x6f,0x6e,0x73,0x74,0x00,0x00,0x09,0x54,0x79,0x70,0x65,0x45,0x72,0x72,0x6f,
+0x72,0x00,0x00,0x03,0x3d,0x3d,0x3d,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,
+0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4e,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x08,
+0x00,0x80,0x00,0x05,0x00,0x80,0x00,0x44,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x11,
+0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x01,0x4d,0x00,0x00,0x05,0x63,0x6c,
+0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x06,0x4d,0x6f,0x64,0x75,0x6c,
+0x65,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,
+0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x63,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0d,0x00,0x80,0x00,0x05,0x00,0x80,
+0x00,0x44,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x05,0x00,0x80,
+0x40,0x43,0x00,0x80,0x01,0x45,0x00,0x80,0x00,0x91,0x00,0x80,0x80,0x20,0x00,0x80,
+0xc0,0x20,0x01,0x00,0x00,0x91,0x00,0x81,0x00,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x01,0x4d,0x00,0x00,0x01,0x43,0x00,0x00,0x03,
+0x6e,0x65,0x77,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x32,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x04,0x00,0x80,0x00,0x06,0x01,0x00,0x00,
+0x91,0x00,0x80,0x00,0xa0,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x02,0x00,0x07,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x00,0x00,0x01,0x4d,0x00,0x00,
+0x00,0x00,0x59,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0e,0x00,0x80,0x00,0x05,0x01,
+0x00,0x00,0x05,0x00,0x80,0x00,0x43,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x11,0x01,
+0x00,0x00,0x05,0x00,0x80,0x40,0x43,0x00,0x80,0x01,0x45,0x00,0x80,0x00,0x11,0x00,
+0x80,0x00,0x93,0x01,0x00,0x00,0x11,0x01,0x00,0x00,0x93,0x00,0x80,0x80,0xb2,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x01,0x41,0x00,0x00,
+0x01,0x42,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,
+0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,
+0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x6f,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x10,0x00,0x80,0x00,0x05,
+0x01,0x00,0x00,0x05,0x00,0x80,0x00,0x43,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x11,
+0x01,0x00,0x00,0x05,0x00,0x80,0x40,0x43,0x00,0x80,0x01,0x45,0x00,0x80,0x00,0x11,
+0x00,0x80,0x00,0x93,0x00,0x80,0x80,0x20,0x00,0x80,0xc0,0x20,0x01,0x00,0x00,0x11,
+0x01,0x00,0x00,0x93,0x00,0x81,0x00,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x05,0x00,0x01,0x41,0x00,0x00,0x01,0x42,0x00,0x00,0x03,0x6e,0x65,
+0x77,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,
+0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,
+0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,
+0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x00,0x01,0x00,0x03,0x00,
+0x00,0x00,0x10,0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x05,0x00,0x80,0x00,0x43,0x00,
+0x80,0x00,0xc5,0x00,0x80,0x00,0x11,0x01,0x00,0x00,0x05,0x00,0x80,0x40,0x43,0x00,
+0x80,0x01,0x45,0x00,0x80,0x00,0x11,0x00,0x80,0x00,0x93,0x00,0x80,0x80,0x20,0x00,
+0x80,0xc0,0x20,0x00,0x80,0xc0,0x20,0x01,0x00,0x02,0x91,0x00,0x81,0x00,0xb2,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x01,0x41,0x00,0x00,
+0x01,0x42,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x43,0x6c,0x61,0x73,0x73,0x00,0x00,0x00,
+0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,
+0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0x00,0x01,0x00,0x03,0x00,0x00,
+0x00,0x15,0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x05,0x00,0x80,0x00,0x43,0x00,0x80,
+0x00,0xc5,0x00,0x80,0x00,0x11,0x01,0x00,0x00,0x05,0x00,0x80,0x40,0x43,0x00,0x80,
+0x01,0x45,0x00,0x80,0x00,0x11,0x00,0x80,0x00,0x93,0x01,0x00,0x00,0x05,0x00,0x80,
+0x80,0x43,0x00,0x80,0x01,0xc5,0x00,0x80,0x00,0x11,0x00,0x80,0x00,0x93,0x00,0x80,
+0x01,0x13,0x01,0x00,0x00,0x11,0x01,0x00,0x00,0x93,0x01,0x00,0x01,0x13,0x00,0x80,
+0xc0,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x01,
+0x41,0x00,0x00,0x01,0x42,0x00,0x00,0x01,0x43,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,
+0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,
+0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,
+0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,
+0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x85,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x14,0x00,
+0x80,0x00,0x05,0x01,0x00,0x00,0x05,0x00,0x80,0x00,0x43,0x00,0x80,0x00,0xc5,0x00,
+0x80,0x00,0x11,0x01,0x00,0x00,0x05,0x00,0x80,0x40,0x43,0x00,0x80,0x01,0x45,0x00,
+0x80,0x00,0x11,0x00,0x80,0x00,0x93,0x01,0x00,0x00,0x05,0x00,0x80,0x80,0x43,0x00,
+0x80,0x01,0xc5,0x00,0x80,0x00,0x11,0x00,0x80,0x00,0x93,0x00,0x80,0x01,0x13,0x00,
+0x80,0xc0,0x20,0x01,0x00,0x02,0x91,0x00,0x81,0x00,0xb2,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x01,0x41,0x00,0x00,0x01,0x42,0x00,0x00,
+0x01,0x43,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,
+0x00,0x05,0x43,0x6c,0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,
+0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,
+0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,
+0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x8f,
+0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x17,0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x05,
+0x00,0x80,0x00,0x43,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x11,0x01,0x00,0x00,0x05,
+0x00,0x80,0x40,0x43,0x00,0x80,0x01,0x45,0x00,0x80,0x00,0x11,0x00,0x80,0x00,0x93,
+0x01,0x00,0x00,0x05,0x00,0x80,0x80,0x43,0x00,0x80,0x01,0xc5,0x00,0x80,0x00,0x11,
+0x00,0x80,0x00,0x93,0x00,0x80,0x01,0x13,0x00,0x80,0xc0,0x20,0x00,0x81,0x00,0x20,
+0x01,0x00,0x00,0x11,0x01,0x00,0x00,0x93,0x01,0x00,0x01,0x13,0x00,0x81,0x40,0xb2,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x01,0x41,0x00,
+0x00,0x01,0x42,0x00,0x00,0x01,0x43,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x05,
+0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x1c,0x00,
+0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,
+0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,
+0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x72,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x13,0x00,0x80,0x00,0x05,0x01,
+0x00,0x00,0x05,0x00,0x80,0x00,0x43,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x11,0x01,
+0x00,0x00,0x05,0x00,0x80,0x40,0x43,0x00,0x80,0x01,0x45,0x00,0x80,0x00,0x11,0x01,
+0x00,0x00,0x11,0x01,0x00,0x00,0x93,0x00,0x80,0x80,0x43,0x00,0x80,0x01,0xc5,0x00,
+0x80,0x00,0x11,0x00,0x80,0x01,0x13,0x01,0x00,0x00,0x11,0x01,0x00,0x01,0x13,0x00,
+0x80,0xc0,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
+0x01,0x41,0x00,0x00,0x01,0x42,0x00,0x00,0x02,0x42,0x32,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,
+0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0x00,0x01,0x00,0x03,0x00,0x00,0x00,
+0x13,0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x05,0x00,0x80,0x00,0x43,0x00,0x80,0x00,
+0xc5,0x00,0x80,0x00,0x11,0x01,0x00,0x00,0x05,0x00,0x80,0x40,0x43,0x00,0x80,0x01,
+0x45,0x00,0x80,0x00,0x11,0x01,0x00,0x00,0x11,0x01,0x00,0x00,0x93,0x00,0x80,0x80,
+0x43,0x00,0x80,0x01,0xc5,0x00,0x80,0x00,0x11,0x00,0x80,0x01,0x13,0x00,0x80,0xc0,
+0x20,0x01,0x00,0x02,0x91,0x00,0x81,0x00,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x06,0x00,0x01,0x41,0x00,0x00,0x01,0x42,0x00,0x00,0x02,0x42,
+0x32,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,
+0x05,0x43,0x6c,0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,
+0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,
+0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,
+0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,0x00,
+0x01,0x00,0x03,0x00,0x00,0x00,0x0c,0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x05,0x00,
+0x80,0x00,0x43,0x00,0x80,0x00,0xc5,0x00,0xc0,0x00,0x03,0x01,0x00,0x00,0x11,0x00,
+0x80,0x00,0x94,0x00,0x80,0x00,0x11,0x00,0x80,0x00,0x93,0x01,0x40,0x00,0x03,0x00,
+0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,
+0x01,0x41,0x00,0x00,0x01,0x43,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x1c,
+0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x00,0x01,0x00,0x03,
+0x00,0x00,0x00,0x08,0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x05,0x00,0x80,0x00,0x43,
+0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x91,0x01,0x00,0x00,0x91,0x00,0x80,0x80,0xb2,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x01,0x41,0x00,
+0x00,0x01,0x43,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x2c,0x00,0x01,0x00,
+0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x42,0x01,0x00,0x00,0x05,0x00,0x80,0x00,
+0x43,0x00,0x80,0x00,0xc5,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x01,0x00,0x01,0x43,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,
+0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x55,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x09,0x00,0x80,0x00,
+0x05,0x01,0x00,0x00,0x05,0x00,0x80,0x00,0x43,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,
+0x91,0x00,0x80,0x80,0x20,0x01,0x00,0x02,0x11,0x00,0x80,0xc0,0xb2,0x00,0x80,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x01,0x41,0x00,0x00,0x01,0x43,
+0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,
+0x43,0x6c,0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x2c,0x00,0x01,0x00,0x03,0x00,0x00,
+0x00,0x05,0x00,0x80,0x00,0x42,0x01,0x00,0x00,0x05,0x00,0x80,0x00,0x43,0x00,0x80,
+0x00,0xc5,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,
+0x43,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,
+0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x5b,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0a,0x00,0x80,0x00,0x05,0x01,0x00,
+0x00,0x05,0x00,0x80,0x00,0x43,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x11,0x00,0x80,
+0x40,0x20,0x00,0x80,0x80,0x20,0x01,0x00,0x02,0x11,0x00,0x80,0xc0,0xb2,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x01,0x43,0x00,0x00,0x03,
+0x64,0x75,0x70,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x05,0x43,0x6c,0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,
+0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x58,0x00,0x01,0x00,0x03,0x00,0x00,0x00,
+0x09,0x00,0x80,0x00,0x05,0x00,0x80,0x00,0x44,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,
+0x11,0x00,0x80,0x40,0x20,0x00,0x80,0x80,0x20,0x01,0x00,0x02,0x11,0x00,0x80,0xc0,
+0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x01,0x4d,
+0x00,0x00,0x03,0x64,0x75,0x70,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,
+0x02,0x3d,0x3d,0x00,0x00,0x06,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x00,0x00,0x00,0x00,
+0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0x00,0x01,0x00,
+0x03,0x00,0x00,0x00,0x10,0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x05,0x00,0x80,0x00,
+0x43,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x00,0x80,0x80,
+0x20,0x01,0x40,0x00,0x03,0x00,0x80,0xc0,0xb2,0x00,0xc0,0x02,0x99,0x00,0x80,0x00,
+0x11,0x00,0x80,0x40,0x20,0x00,0x81,0x00,0x20,0x01,0x40,0x00,0x03,0x00,0x80,0xc0,
+0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x01,0x41,
+0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x05,0x74,0x65,0x73,0x74,0x32,0x00,0x00,
+0x02,0x3d,0x3d,0x00,0x00,0x05,0x74,0x65,0x73,0x74,0x33,0x00,0x00,0x00,0x00,0x72,
+0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x0e,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,
+0x00,0x80,0x00,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x00,0x84,0x01,0x80,0x00,0x04,
+0x02,0x00,0x00,0x05,0x00,0x80,0x81,0x20,0x00,0x80,0x00,0x48,0x01,0x00,0x01,0x84,
+0x01,0x80,0x00,0x04,0x02,0x00,0x00,0x05,0x00,0x80,0x81,0x20,0x01,0x00,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x74,0x65,0x73,0x74,0x00,0x00,
+0x05,0x74,0x65,0x73,0x74,0x32,0x00,0x00,0x0c,0x61,0x6c,0x69,0x61,0x73,0x5f,0x6d,
+0x65,0x74,0x68,0x6f,0x64,0x00,0x00,0x05,0x74,0x65,0x73,0x74,0x33,0x00,0x00,0x00,
+0x00,0x20,0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x26,0x00,0x40,
+0x00,0x03,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x72,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x10,0x00,0x80,0x00,0x05,0x01,0x00,
+0x00,0x05,0x00,0x80,0x00,0x43,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x11,0x00,0x80,
+0x40,0x20,0x00,0x80,0x80,0x20,0x01,0x40,0x00,0x83,0x00,0x80,0xc0,0xb2,0x00,0xc0,
+0x02,0x99,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x00,0x81,0x00,0x20,0x01,0x40,
+0x00,0x03,0x00,0x80,0xc0,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x05,0x00,0x01,0x41,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x04,0x74,0x65,
+0x73,0x74,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x74,0x65,0x73,0x74,0x32,0x00,
+0x00,0x00,0x00,0x66,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x0d,0x00,0x80,0x00,0x48,
+0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x00,0x84,
+0x01,0x80,0x00,0x04,0x02,0x00,0x00,0x05,0x00,0x80,0x81,0x20,0x00,0x80,0x00,0x48,
+0x01,0x00,0x04,0xc0,0x00,0x80,0x00,0x46,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,0x74,0x65,0x73,0x74,0x00,0x00,
+0x05,0x74,0x65,0x73,0x74,0x32,0x00,0x00,0x0c,0x61,0x6c,0x69,0x61,0x73,0x5f,0x6d,
+0x65,0x74,0x68,0x6f,0x64,0x00,0x00,0x00,0x00,0x20,0x00,0x02,0x00,0x03,0x00,0x00,
+0x00,0x03,0x00,0x00,0x00,0x26,0x00,0x40,0x00,0x03,0x00,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x02,0x00,0x03,0x00,0x00,
+0x00,0x03,0x00,0x00,0x00,0x26,0x00,0x40,0x00,0x83,0x00,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf9,0x00,0x03,0x00,0x05,0x00,0x00,
+0x00,0x2c,0x01,0x80,0x00,0x05,0x02,0x00,0x00,0x05,0x01,0x80,0x00,0x43,0x01,0x80,
+0x00,0xc5,0x00,0x80,0x00,0x08,0x00,0x40,0x02,0x1a,0x01,0x80,0x00,0x11,0x01,0x80,
+0x40,0x20,0x01,0x80,0x80,0x20,0x00,0x40,0x04,0x97,0x01,0x80,0x00,0x1b,0x02,0x00,
+0x01,0x91,0x02,0x80,0xc0,0x01,0x02,0x01,0x00,0xa0,0x02,0x40,0x00,0x98,0x00,0x40,
+0x01,0x17,0x00,0x80,0x00,0x07,0x00,0x40,0x01,0x17,0x01,0x80,0x00,0x1d,0x00,0x80,
+0x00,0x1c,0x01,0x00,0x00,0x08,0x00,0x40,0x02,0x1a,0x01,0x80,0x00,0x11,0x01,0x80,
+0x40,0x20,0x01,0x81,0x40,0x20,0x00,0x40,0x04,0x97,0x01,0x80,0x00,0x1b,0x02,0x00,
+0x01,0x91,0x02,0x80,0xc0,0x01,0x02,0x01,0x00,0xa0,0x02,0x40,0x00,0x98,0x00,0x40,
+0x01,0x17,0x01,0x00,0x00,0x07,0x00,0x40,0x01,0x17,0x01,0x80,0x00,0x1d,0x00,0x80,
+0x00,0x1c,0x01,0x80,0x40,0x01,0x02,0x00,0x00,0x07,0x01,0x81,0x80,0xb2,0x01,0xc0,
+0x01,0x99,0x01,0x80,0x80,0x01,0x02,0x00,0x00,0x07,0x01,0x81,0x80,0xb2,0x01,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x01,0x41,0x00,0x00,0x03,
+0x6e,0x65,0x77,0x00,0x00,0x05,0x74,0x65,0x73,0x74,0x31,0x00,0x00,0x0d,0x4e,0x6f,
+0x4d,0x65,0x74,0x68,0x6f,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x03,0x3d,0x3d,
+0x3d,0x00,0x00,0x05,0x74,0x65,0x73,0x74,0x32,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,
+0x00,0x00,0x67,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0d,0x00,0x80,0x00,0x48,0x01,
+0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x04,0xc0,0x00,
+0x80,0x40,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x00,0x04,0x00,0x80,0x80,0xa0,0x00,
+0x80,0x00,0x48,0x01,0x00,0x00,0x84,0x00,0x80,0x80,0xa0,0x01,0x00,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x05,0x74,0x65,0x73,0x74,0x31,0x00,0x00,
+0x05,0x74,0x65,0x73,0x74,0x32,0x00,0x00,0x0c,0x75,0x6e,0x64,0x65,0x66,0x5f,0x6d,
+0x65,0x74,0x68,0x6f,0x64,0x00,0x00,0x00,0x00,0x20,0x00,0x02,0x00,0x03,0x00,0x00,
+0x00,0x03,0x00,0x00,0x00,0x26,0x00,0x40,0x00,0x03,0x00,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x02,0x00,0x03,0x00,0x00,
+0x00,0x03,0x00,0x00,0x00,0x26,0x00,0x40,0x00,0x83,0x00,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf9,0x00,0x03,0x00,0x05,0x00,0x00,
+0x00,0x2c,0x01,0x80,0x00,0x05,0x02,0x00,0x00,0x05,0x01,0x80,0x00,0x43,0x01,0x80,
+0x00,0xc5,0x00,0x80,0x00,0x08,0x00,0x40,0x02,0x1a,0x01,0x80,0x00,0x11,0x01,0x80,
+0x40,0x20,0x01,0x80,0x80,0x20,0x00,0x40,0x04,0x97,0x01,0x80,0x00,0x1b,0x02,0x00,
+0x01,0x91,0x02,0x80,0xc0,0x01,0x02,0x01,0x00,0xa0,0x02,0x40,0x00,0x98,0x00,0x40,
+0x01,0x17,0x00,0x80,0x00,0x07,0x00,0x40,0x01,0x17,0x01,0x80,0x00,0x1d,0x00,0x80,
+0x00,0x1c,0x01,0x00,0x00,0x08,0x00,0x40,0x02,0x1a,0x01,0x80,0x00,0x11,0x01,0x80,
+0x40,0x20,0x01,0x81,0x40,0x20,0x00,0x40,0x04,0x97,0x01,0x80,0x00,0x1b,0x02,0x00,
+0x01,0x91,0x02,0x80,0xc0,0x01,0x02,0x01,0x00,0xa0,0x02,0x40,0x00,0x98,0x00,0x40,
+0x01,0x17,0x01,0x00,0x00,0x07,0x00,0x40,0x01,0x17,0x01,0x80,0x00,0x1d,0x00,0x80,
+0x00,0x1c,0x01,0x80,0x40,0x01,0x02,0x00,0x00,0x07,0x01,0x81,0x80,0xb2,0x01,0xc0,
+0x01,0x99,0x01,0x80,0x80,0x01,0x02,0x00,0x00,0x07,0x01,0x81,0x80,0xb2,0x01,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x01,0x41,0x00,0x00,0x03,
+0x6e,0x65,0x77,0x00,0x00,0x05,0x74,0x65,0x73,0x74,0x31,0x00,0x00,0x0d,0x4e,0x6f,
+0x4d,0x65,0x74,0x68,0x6f,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x03,0x3d,0x3d,
+0x3d,0x00,0x00,0x05,0x74,0x65,0x73,0x74,0x32,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,
+0x00,0x00,0x5f,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x0b,0x00,0x80,0x00,0x48,0x01,
+0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x04,0xc0,0x00,
+0x80,0x40,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x00,0x04,0x01,0x80,0x00,0x84,0x00,
+0x80,0x81,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,
+0x05,0x74,0x65,0x73,0x74,0x31,0x00,0x00,0x05,0x74,0x65,0x73,0x74,0x32,0x00,0x00,
+0x0c,0x75,0x6e,0x64,0x65,0x66,0x5f,0x6d,0x65,0x74,0x68,0x6f,0x64,0x00,0x00,0x00,
+0x00,0x20,0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x26,0x00,0x40,
+0x00,0x03,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x20,0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x26,0x00,0x40,
+0x00,0x83,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x59,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0c,0x00,0x80,0x00,0x05,0x01,0x00,
+0x00,0x05,0x00,0x80,0x00,0x43,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x11,0x00,0x80,
+0x40,0x20,0x01,0x00,0x00,0x11,0x01,0x00,0x40,0x20,0x00,0x80,0x80,0xb3,0x01,0x00,
+0x00,0x08,0x00,0x80,0xc0,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x04,0x00,0x03,0x46,0x6f,0x6f,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x01,
+0x3c,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x51,0x00,0x01,0x00,0x03,0x00,
+0x00,0x00,0x08,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x00,0x80,0x00,0xa0,0x00,
+0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x80,0x46,0x00,0x00,0x00,0x05,0x00,
+0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x07,0x69,0x6e,0x63,
+0x6c,0x75,0x64,0x65,0x00,0x00,0x0a,0x43,0x6f,0x6d,0x70,0x61,0x72,0x61,0x62,0x6c,
+0x65,0x00,0x00,0x03,0x3c,0x3d,0x3e,0x00,0x00,0x00,0x00,0x20,0x00,0x03,0x00,0x04,
+0x00,0x00,0x00,0x03,0x02,0x00,0x00,0x26,0x00,0x3f,0xff,0x83,0x00,0x00,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5a,0x00,0x01,0x00,0x03,
+0x00,0x00,0x00,0x0c,0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x05,0x00,0x80,0x00,0x43,
+0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x00,0x11,
+0x01,0x00,0x40,0x20,0x00,0x80,0x80,0xb4,0x01,0x00,0x00,0x07,0x00,0x80,0xc0,0xb2,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x03,0x46,0x6f,
+0x6f,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x02,0x3c,0x3d,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x00,0x00,0x51,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x08,0x00,0x80,
+0x00,0x06,0x01,0x00,0x00,0x91,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x48,0x01,0x00,
+0x02,0xc0,0x00,0x80,0x80,0x46,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x07,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x00,
+0x00,0x0a,0x43,0x6f,0x6d,0x70,0x61,0x72,0x61,0x62,0x6c,0x65,0x00,0x00,0x03,0x3c,
+0x3d,0x3e,0x00,0x00,0x00,0x00,0x20,0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x03,0x02,
+0x00,0x00,0x26,0x00,0x3f,0xff,0x83,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0c,0x00,
+0x80,0x00,0x05,0x01,0x00,0x00,0x05,0x00,0x80,0x00,0x43,0x00,0x80,0x00,0xc5,0x00,
+0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x00,0x11,0x01,0x00,0x40,0x20,0x00,
+0x80,0x80,0xb2,0x01,0x00,0x00,0x07,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x03,0x46,0x6f,0x6f,0x00,0x00,0x03,0x6e,
+0x65,0x77,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x51,0x00,0x01,0x00,0x03,
+0x00,0x00,0x00,0x08,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x00,0x80,0x00,0xa0,
+0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x80,0x46,0x00,0x00,0x00,0x05,
+0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x07,0x69,0x6e,
+0x63,0x6c,0x75,0x64,0x65,0x00,0x00,0x0a,0x43,0x6f,0x6d,0x70,0x61,0x72,0x61,0x62,
+0x6c,0x65,0x00,0x00,0x03,0x3c,0x3d,0x3e,0x00,0x00,0x00,0x00,0x20,0x00,0x03,0x00,
+0x04,0x00,0x00,0x00,0x03,0x02,0x00,0x00,0x26,0x00,0x3f,0xff,0x83,0x00,0x00,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0x00,0x01,0x00,
+0x03,0x00,0x00,0x00,0x0c,0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x05,0x00,0x80,0x00,
+0x43,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x00,
+0x11,0x01,0x00,0x40,0x20,0x00,0x80,0x80,0xb5,0x01,0x00,0x00,0x08,0x00,0x80,0xc0,
+0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x03,0x46,
+0x6f,0x6f,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x01,0x3e,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x00,0x00,0x51,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x08,0x00,0x80,
+0x00,0x06,0x01,0x00,0x00,0x91,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x48,0x01,0x00,
+0x02,0xc0,0x00,0x80,0x80,0x46,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x07,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x00,
+0x00,0x0a,0x43,0x6f,0x6d,0x70,0x61,0x72,0x61,0x62,0x6c,0x65,0x00,0x00,0x03,0x3c,
+0x3d,0x3e,0x00,0x00,0x00,0x00,0x20,0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x03,0x02,
+0x00,0x00,0x26,0x00,0x3f,0xff,0x83,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x5a,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0c,0x00,
+0x80,0x00,0x05,0x01,0x00,0x00,0x05,0x00,0x80,0x00,0x43,0x00,0x80,0x00,0xc5,0x00,
+0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x00,0x11,0x01,0x00,0x40,0x20,0x00,
+0x80,0x80,0xb6,0x01,0x00,0x00,0x07,0x00,0x80,0xc0,0xb2,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x03,0x46,0x6f,0x6f,0x00,0x00,0x03,0x6e,
+0x65,0x77,0x00,0x00,0x02,0x3e,0x3d,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,
+0x51,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x08,0x00,0x80,0x00,0x06,0x01,0x00,0x00,
+0x91,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x80,
+0x46,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x03,0x00,0x07,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x00,0x00,0x0a,0x43,0x6f,0x6d,
+0x70,0x61,0x72,0x61,0x62,0x6c,0x65,0x00,0x00,0x03,0x3c,0x3d,0x3e,0x00,0x00,0x00,
+0x00,0x20,0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x03,0x02,0x00,0x00,0x26,0x00,0x3f,
+0xff,0x83,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0xd8,0x00,0x02,0x00,0x05,0x00,0x00,0x00,0x2a,0x01,0x00,0x00,0x05,0x01,0x80,
+0x00,0x05,0x01,0x00,0x00,0x43,0x01,0x00,0x00,0xc5,0x01,0x00,0x00,0x11,0x01,0x00,
+0x40,0x20,0x00,0x80,0x80,0x01,0x01,0x00,0x40,0x01,0x01,0xbf,0xff,0x03,0x02,0x40,
+0x00,0x03,0x01,0x00,0x81,0x20,0x01,0x80,0x00,0x08,0x01,0x00,0xc0,0xb2,0x01,0x40,
+0x03,0x19,0x01,0x00,0x40,0x01,0x01,0xbf,0xff,0x03,0x02,0x3f,0xff,0x03,0x01,0x00,
+0x81,0x20,0x01,0x80,0x00,0x08,0x01,0x00,0xc0,0xb2,0x01,0x40,0x03,0x19,0x01,0x00,
+0x40,0x01,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x03,0x01,0x00,0x81,0x20,0x01,0x80,
+0x00,0x08,0x01,0x00,0xc0,0xb2,0x01,0x40,0x03,0x19,0x01,0x00,0x40,0x01,0x01,0xc0,
+0x00,0x03,0x02,0x3f,0xff,0x03,0x01,0x00,0x81,0x20,0x01,0x80,0x00,0x07,0x01,0x00,
+0xc0,0xb2,0x01,0x40,0x03,0x19,0x01,0x00,0x40,0x01,0x01,0xbf,0xff,0x83,0x02,0x3f,
+0xff,0x83,0x01,0x00,0x81,0x20,0x01,0x80,0x00,0x07,0x01,0x00,0xc0,0xb2,0x01,0x00,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x03,0x46,0x6f,0x6f,0x00,
+0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x08,0x62,0x65,0x74,0x77,0x65,0x65,0x6e,0x3f,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x51,0x00,0x01,0x00,0x03,0x00,0x00,
+0x00,0x08,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x00,0x80,0x00,0xa0,0x00,0x80,
+0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x80,0x46,0x00,0x00,0x00,0x05,0x00,0x00,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x07,0x69,0x6e,0x63,0x6c,
+0x75,0x64,0x65,0x00,0x00,0x0a,0x43,0x6f,0x6d,0x70,0x61,0x72,0x61,0x62,0x6c,0x65,
+0x00,0x00,0x03,0x3c,0x3d,0x3e,0x00,0x00,0x00,0x00,0x1c,0x00,0x03,0x00,0x04,0x00,
+0x00,0x00,0x02,0x02,0x00,0x00,0x26,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x4b,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,
+0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x0a,0x45,0x6e,0x75,
+0x6d,0x65,0x72,0x61,0x62,0x6c,0x65,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,
+0x00,0x02,0x3d,0x3d,0x00,0x00,0x06,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x00,0x00,0x00,
+0x00,0x53,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x0d,0x00,0xc0,0x00,0x03,0x01,0x40,
+0x00,0x83,0x01,0xc0,0x01,0x03,0x00,0x80,0x41,0xb7,0x00,0x80,0x00,0x20,0x00,0xc0,
+0x03,0x19,0x00,0xc0,0x00,0x03,0x01,0x00,0x00,0x08,0x01,0xc0,0x01,0x03,0x00,0x80,
+0x41,0xb7,0x00,0x80,0x00,0x20,0x00,0x80,0x40,0x20,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x61,0x6c,0x6c,0x3f,0x00,0x00,0x01,0x21,
+0x00,0x00,0x00,0x00,0x53,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x0d,0x00,0x80,0x00,
+0x08,0x01,0x00,0x00,0x07,0x01,0x80,0x00,0x08,0x00,0x80,0x41,0xb7,0x00,0x80,0x00,
+0x20,0x00,0xc0,0x03,0x19,0x00,0x80,0x00,0x08,0x01,0x00,0x00,0x08,0x01,0x80,0x00,
+0x08,0x00,0x80,0x41,0xb7,0x00,0x80,0x00,0x20,0x00,0x80,0x40,0x20,0x00,0x80,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x61,0x6e,0x79,0x3f,0x00,
+0x00,0x01,0x21,0x00,0x00,0x00,0x00,0x53,0x00,0x01,0x00,0x05,0x00,0x00,0x00,0x0c,
+0x00,0xc0,0x00,0x03,0x01,0x40,0x00,0x83,0x01,0xc0,0x01,0x03,0x00,0x80,0x41,0xb7,
+0x01,0x00,0x03,0x40,0x00,0x80,0x00,0x21,0x01,0x40,0x00,0x83,0x01,0xc0,0x01,0x83,
+0x02,0x40,0x02,0x83,0x01,0x00,0x81,0xb7,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x07,0x63,0x6f,0x6c,0x6c,0x65,0x63,
+0x74,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x2c,0x00,0x03,0x00,0x05,0x00,
+0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x00,0x40,0x01,0x01,
+0x80,0x00,0xac,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,
+0x01,0x2b,0x00,0x00,0x00,0x00,0x6a,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x11,0x00,
+0xc0,0x00,0x03,0x01,0x40,0x00,0x83,0x01,0xc0,0x01,0x03,0x00,0x80,0x41,0xb7,0x01,
+0x00,0x03,0x40,0x00,0x80,0x00,0x21,0x00,0xc0,0x04,0x99,0x00,0xc0,0x00,0x03,0x01,
+0x40,0x00,0x83,0x01,0xc0,0x01,0x03,0x00,0x80,0x41,0xb7,0x01,0x00,0x00,0x3d,0x01,
+0x80,0x05,0x40,0x00,0x80,0x00,0xa1,0x01,0x00,0x00,0x3d,0x00,0x80,0x40,0xb2,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x10,0x00,0x01,0x61,0x00,0x00,0x00,0x02,0x00,
+0x06,0x64,0x65,0x74,0x65,0x63,0x74,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,
+0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x07,0x00,0x00,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,
+0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0x00,0x03,0x00,0x05,0x00,0x00,0x00,
+0x0e,0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x05,0x01,0xc0,0x00,0x03,0x01,0x80,0xc0,
+0xb7,0x02,0x00,0x03,0x40,0x01,0x80,0x00,0x21,0x01,0x80,0x40,0x01,0x02,0x40,0x00,
+0x03,0x01,0x80,0x40,0xb2,0x01,0xc0,0x01,0x99,0x01,0x80,0x80,0x01,0x02,0x3f,0xff,
+0x83,0x01,0x80,0x40,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x02,0x00,0x0f,0x65,0x61,0x63,0x68,0x5f,0x77,0x69,0x74,0x68,0x5f,0x69,0x6e,0x64,
+0x65,0x78,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x24,0x00,0x04,0x00,0x05,
+0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x26,0x00,0x80,0x40,0x16,0x01,0x00,0x80,0x16,
+0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,
+0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x07,0x00,0xc0,0x00,0x03,0x00,0x80,0x40,0xb7,
+0x00,0x80,0x00,0x20,0x01,0x40,0x00,0x03,0x01,0x00,0x80,0xb7,0x00,0x80,0x40,0xb2,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x07,0x65,0x6e,
+0x74,0x72,0x69,0x65,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x68,0x00,
+0x01,0x00,0x04,0x00,0x00,0x00,0x11,0x00,0xc0,0x00,0x03,0x01,0x40,0x00,0x83,0x01,
+0xc0,0x01,0x03,0x00,0x80,0x41,0xb7,0x01,0x00,0x03,0x40,0x00,0x80,0x00,0x21,0x00,
+0xc0,0x04,0x99,0x00,0xc0,0x00,0x03,0x01,0x40,0x00,0x83,0x01,0xc0,0x01,0x03,0x00,
+0x80,0x41,0xb7,0x01,0x00,0x00,0x3d,0x01,0x80,0x05,0x40,0x00,0x80,0x00,0xa1,0x01,
+0x00,0x00,0x3d,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x10,
+0x00,0x01,0x61,0x00,0x00,0x00,0x02,0x00,0x04,0x66,0x69,0x6e,0x64,0x00,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,
+0x00,0x00,0x07,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x08,0x00,
+0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,
+0x01,0x00,0x0a,0x00,0x00,0x00,0x13,0x00,0xc0,0x00,0x03,0x01,0x40,0x00,0x83,0x01,
+0xc0,0x01,0x03,0x02,0x40,0x01,0x83,0x02,0xc0,0x02,0x03,0x03,0x40,0x02,0x83,0x03,
+0xc0,0x03,0x03,0x04,0x40,0x03,0x83,0x04,0xc0,0x04,0x03,0x00,0x80,0x44,0xb7,0x01,
+0x00,0x03,0x40,0x00,0x80,0x00,0x21,0x01,0x40,0x00,0x83,0x01,0xc0,0x01,0x83,0x02,
+0x40,0x02,0x83,0x02,0xc0,0x03,0x83,0x01,0x00,0x82,0x37,0x00,0x80,0x40,0xb2,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x08,0x66,0x69,0x6e,
+0x64,0x5f,0x61,0x6c,0x6c,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x39,0x00,
+0x03,0x00,0x05,0x00,0x00,0x00,0x07,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,
+0x40,0x00,0x83,0x01,0x80,0x00,0xa0,0x02,0x3f,0xff,0x83,0x01,0x80,0x40,0xb2,0x01,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x25,0x00,0x00,
+0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x70,0x00,0x01,0x00,0x0a,0x00,0x00,0x00,0x14,
+0x00,0xc0,0x00,0x03,0x01,0x40,0x00,0x83,0x01,0xc0,0x01,0x03,0x02,0x40,0x01,0x83,
+0x02,0xc0,0x02,0x03,0x03,0x40,0x02,0x83,0x03,0xc0,0x03,0x03,0x04,0x40,0x03,0x83,
+0x04,0xc0,0x04,0x03,0x00,0x80,0x44,0xb7,0x01,0x40,0x01,0x83,0x01,0xc0,0x02,0x83,
+0x01,0x00,0x80,0x41,0x00,0x80,0x00,0xa0,0x01,0x40,0x01,0x83,0x01,0xc0,0x02,0x03,
+0x02,0x40,0x02,0x83,0x01,0x00,0x81,0xb7,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x67,0x72,0x65,0x70,0x00,0x00,
+0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x8f,0x00,0x01,0x00,0x0a,0x00,0x00,0x00,0x1b,
+0x00,0xc0,0x00,0x03,0x01,0x40,0x00,0x83,0x01,0xc0,0x01,0x03,0x02,0x40,0x01,0x83,
+0x02,0xc0,0x02,0x03,0x03,0x40,0x02,0x83,0x03,0xc0,0x03,0x03,0x04,0x40,0x03,0x83,
+0x04,0xc0,0x04,0x03,0x00,0x80,0x44,0xb7,0x01,0x40,0x02,0x03,0x00,0x80,0x00,0xa0,
+0x00,0xc0,0x06,0x99,0x00,0xc0,0x00,0x03,0x01,0x40,0x00,0x83,0x01,0xc0,0x01,0x03,
+0x02,0x40,0x01,0x83,0x02,0xc0,0x02,0x03,0x03,0x40,0x02,0x83,0x03,0xc0,0x03,0x03,
+0x04,0x40,0x03,0x83,0x04,0xc0,0x04,0x03,0x00,0x80,0x44,0xb7,0x01,0x3f,0xff,0x83,
+0x00,0x80,0x00,0xa0,0x00,0x80,0x40,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x02,0x00,0x08,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x3f,0x00,0x00,
+0x01,0x21,0x00,0x00,0x00,0x00,0x86,0x00,0x01,0x00,0x07,0x00,0x00,0x00,0x19,0x00,
+0xc0,0x00,0x03,0x01,0x40,0x00,0x83,0x01,0xc0,0x01,0x03,0x02,0x40,0x01,0x83,0x02,
+0xc0,0x02,0x03,0x03,0x40,0x02,0x83,0x00,0x80,0x43,0x37,0x01,0x00,0x03,0x40,0x00,
+0x80,0x00,0x21,0x01,0x40,0x0a,0x03,0x00,0x80,0x40,0xb2,0x00,0xc0,0x06,0x19,0x00,
+0xc0,0x00,0x03,0x01,0x40,0x00,0x83,0x01,0xc0,0x01,0x03,0x02,0x40,0x01,0x83,0x02,
+0xc0,0x02,0x03,0x03,0x40,0x02,0x83,0x00,0x80,0x43,0x37,0x01,0x40,0x00,0x03,0x01,
+0x80,0x05,0x40,0x00,0x80,0x00,0xa1,0x01,0x40,0x0a,0x83,0x00,0x80,0x40,0xb2,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x06,0x69,0x6e,0x6a,
+0x65,0x63,0x74,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x2c,0x00,0x04,0x00,
+0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x26,0x02,0x00,0x40,0x01,0x02,0x80,0x80,
+0x01,0x02,0x00,0x00,0xac,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x01,0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0x2c,0x00,0x04,0x00,0x06,0x00,0x00,0x00,
+0x05,0x04,0x00,0x00,0x26,0x02,0x00,0x40,0x01,0x02,0x80,0x80,0x01,0x02,0x00,0x00,
+0xac,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x2b,
+0x00,0x00,0x00,0x00,0x4f,0x00,0x01,0x00,0x05,0x00,0x00,0x00,0x0c,0x00,0xc0,0x00,
+0x03,0x01,0x40,0x00,0x83,0x01,0xc0,0x01,0x03,0x00,0x80,0x41,0xb7,0x01,0x00,0x03,
+0x40,0x00,0x80,0x00,0x21,0x01,0x40,0x00,0x83,0x01,0xc0,0x01,0x83,0x02,0x40,0x02,
+0x83,0x01,0x00,0x81,0xb7,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x02,0x00,0x03,0x6d,0x61,0x70,0x00,0x00,0x02,0x3d,0x3d,0x00,
+0x00,0x00,0x00,0x2c,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,
+0x01,0x80,0x40,0x01,0x02,0x00,0x40,0x01,0x01,0x80,0x00,0xac,0x01,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0x6a,
+0x00,0x02,0x00,0x05,0x00,0x00,0x00,0x0f,0x01,0x00,0x00,0x3d,0x01,0x80,0x00,0xbd,
+0x02,0x00,0x01,0x3d,0x00,0x80,0x81,0xb7,0x01,0x00,0x40,0x01,0x01,0x00,0x00,0x20,
+0x01,0x80,0x01,0x3d,0x01,0x00,0x40,0xb2,0x01,0x40,0x02,0x99,0x01,0x00,0x40,0x01,
+0x01,0x80,0x03,0x40,0x01,0x00,0x00,0x21,0x01,0x80,0x00,0x3d,0x01,0x00,0x40,0xb2,
+0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x03,0x10,0x00,0x03,0x61,0x61,0x61,0x10,0x00,
+0x02,0x62,0x62,0x10,0x00,0x01,0x63,0x00,0x00,0x00,0x02,0x00,0x03,0x6d,0x61,0x78,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x3f,0x00,0x04,0x00,0x06,0x00,0x00,
+0x00,0x07,0x04,0x00,0x00,0x26,0x02,0x00,0x40,0x01,0x02,0x00,0x00,0x20,0x02,0x80,
+0x80,0x01,0x02,0x80,0x00,0x20,0x02,0x00,0x40,0xa0,0x02,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x06,0x6c,0x65,0x6e,0x67,0x74,0x68,0x00,0x00,
+0x03,0x3c,0x3d,0x3e,0x00,0x00,0x00,0x00,0x6a,0x00,0x02,0x00,0x05,0x00,0x00,0x00,
+0x0f,0x01,0x00,0x00,0x3d,0x01,0x80,0x00,0xbd,0x02,0x00,0x01,0x3d,0x00,0x80,0x81,
+0xb7,0x01,0x00,0x40,0x01,0x01,0x00,0x00,0x20,0x01,0x80,0x00,0x3d,0x01,0x00,0x40,
+0xb2,0x01,0x40,0x02,0x99,0x01,0x00,0x40,0x01,0x01,0x80,0x03,0x40,0x01,0x00,0x00,
+0x21,0x01,0x80,0x01,0x3d,0x01,0x00,0x40,0xb2,0x01,0x00,0x00,0x29,0x00,0x00,0x00,
+0x03,0x10,0x00,0x03,0x61,0x61,0x61,0x10,0x00,0x02,0x62,0x62,0x10,0x00,0x01,0x63,
+0x00,0x00,0x00,0x02,0x00,0x03,0x6d,0x69,0x6e,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,
+0x00,0x00,0x3f,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x07,0x04,0x00,0x00,0x26,0x02,
+0x00,0x40,0x01,0x02,0x00,0x00,0x20,0x02,0x80,0x80,0x01,0x02,0x80,0x00,0x20,0x02,
+0x00,0x40,0xa0,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,
+0x06,0x6c,0x65,0x6e,0x67,0x74,0x68,0x00,0x00,0x03,0x3c,0x3d,0x3e,0x00,0x00,0x00,
+0x00,0x8e,0x00,0x01,0x00,0x0a,0x00,0x00,0x00,0x1b,0x00,0xc0,0x00,0x03,0x01,0x40,
+0x00,0x83,0x01,0xc0,0x01,0x03,0x02,0x40,0x01,0x83,0x02,0xc0,0x02,0x03,0x03,0x40,
+0x02,0x83,0x03,0xc0,0x03,0x03,0x04,0x40,0x03,0x83,0x04,0xc0,0x04,0x03,0x00,0x80,
+0x44,0xb7,0x01,0x40,0x02,0x03,0x00,0x80,0x00,0xa0,0x00,0xc0,0x06,0x99,0x00,0xc0,
+0x00,0x03,0x01,0x40,0x00,0x83,0x01,0xc0,0x01,0x03,0x02,0x40,0x01,0x83,0x02,0xc0,
+0x02,0x03,0x03,0x40,0x02,0x83,0x03,0xc0,0x03,0x03,0x04,0x40,0x03,0x83,0x04,0xc0,
+0x04,0x03,0x00,0x80,0x44,0xb7,0x01,0x3f,0xff,0x83,0x00,0x80,0x00,0xa0,0x00,0x80,
+0x40,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x07,
+0x6d,0x65,0x6d,0x62,0x65,0x72,0x3f,0x00,0x00,0x01,0x21,0x00,0x00,0x00,0x00,0x95,
+0x00,0x01,0x00,0x0b,0x00,0x00,0x00,0x1c,0x00,0xbf,0xff,0x83,0x01,0x40,0x00,0x03,
+0x01,0xc0,0x00,0x83,0x02,0x40,0x01,0x03,0x02,0xc0,0x01,0x83,0x03,0x40,0x02,0x03,
+0x03,0xc0,0x02,0x83,0x04,0x40,0x03,0x03,0x04,0xc0,0x03,0x83,0x05,0x40,0x04,0x03,
+0x00,0x80,0x45,0x37,0x01,0x00,0x03,0x40,0x00,0x80,0x00,0x21,0x01,0x3f,0xff,0x83,
+0x01,0xc0,0x00,0x83,0x02,0x40,0x01,0x83,0x02,0xc0,0x02,0x83,0x03,0x40,0x03,0x83,
+0x01,0x00,0x82,0xb7,0x01,0xc0,0x00,0x03,0x02,0x40,0x01,0x03,0x02,0xc0,0x02,0x03,
+0x03,0x40,0x03,0x03,0x03,0xc0,0x04,0x03,0x01,0x80,0xc2,0xb7,0x01,0x00,0x81,0x37,
+0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
+0x00,0x09,0x70,0x61,0x72,0x74,0x69,0x74,0x69,0x6f,0x6e,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x00,0x00,0x39,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x07,0x02,0x00,0x00,
+0x26,0x01,0x80,0x40,0x01,0x02,0x40,0x00,0x83,0x01,0x80,0x00,0xa0,0x02,0x3f,0xff,
+0x83,0x01,0x80,0x40,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x02,0x00,0x01,0x25,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x76,0x00,0x01,
+0x00,0x0b,0x00,0x00,0x00,0x15,0x00,0xbf,0xff,0x83,0x01,0x40,0x00,0x03,0x01,0xc0,
+0x00,0x83,0x02,0x40,0x01,0x03,0x02,0xc0,0x01,0x83,0x03,0x40,0x02,0x03,0x03,0xc0,
+0x02,0x83,0x04,0x40,0x03,0x03,0x04,0xc0,0x03,0x83,0x05,0x40,0x04,0x03,0x00,0x80,
+0x45,0x37,0x01,0x00,0x03,0x40,0x00,0x80,0x00,0x21,0x01,0x40,0x00,0x03,0x01,0xc0,
+0x01,0x03,0x02,0x40,0x02,0x03,0x02,0xc0,0x03,0x03,0x03,0x40,0x04,0x03,0x01,0x00,
+0x82,0xb7,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x02,0x00,0x06,0x72,0x65,0x6a,0x65,0x63,0x74,0x00,0x00,0x02,0x3d,0x3d,0x00,
+0x00,0x00,0x00,0x39,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x07,0x02,0x00,0x00,0x26,
+0x01,0x80,0x40,0x01,0x02,0x40,0x00,0x83,0x01,0x80,0x00,0xa0,0x02,0x3f,0xff,0x83,
+0x01,0x80,0x40,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
+0x00,0x01,0x25,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x6e,0x00,0x01,0x00,
+0x0a,0x00,0x00,0x00,0x13,0x00,0xc0,0x00,0x03,0x01,0x40,0x00,0x83,0x01,0xc0,0x01,
+0x03,0x02,0x40,0x01,0x83,0x02,0xc0,0x02,0x03,0x03,0x40,0x02,0x83,0x03,0xc0,0x03,
+0x03,0x04,0x40,0x03,0x83,0x04,0xc0,0x04,0x03,0x00,0x80,0x44,0xb7,0x01,0x00,0x03,
+0x40,0x00,0x80,0x00,0x21,0x01,0x40,0x00,0x83,0x01,0xc0,0x01,0x83,0x02,0x40,0x02,
+0x83,0x02,0xc0,0x03,0x83,0x01,0x00,0x82,0x37,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x06,0x73,0x65,0x6c,0x65,0x63,
+0x74,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x39,0x00,0x03,0x00,0x05,0x00,
+0x00,0x00,0x07,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x40,0x00,0x83,0x01,
+0x80,0x00,0xa0,0x02,0x3f,0xff,0x83,0x01,0x80,0x40,0xb2,0x01,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x25,0x00,0x00,0x02,0x3d,0x3d,0x00,
+0x00,0x00,0x00,0xac,0x00,0x01,0x00,0x08,0x00,0x00,0x00,0x23,0x00,0xc0,0x03,0x03,
+0x01,0x40,0x01,0x03,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x02,0xc0,0x02,0x83,
+0x03,0x40,0x01,0x83,0x00,0x80,0x43,0x37,0x00,0x80,0x00,0x20,0x01,0x40,0x00,0x03,
+0x01,0xc0,0x00,0x83,0x02,0x40,0x01,0x03,0x02,0xc0,0x01,0x83,0x03,0x40,0x02,0x83,
+0x03,0xc0,0x03,0x03,0x01,0x00,0x83,0x37,0x00,0x80,0x40,0xb2,0x00,0xc0,0x08,0x99,
+0x00,0xc0,0x03,0x03,0x01,0x40,0x01,0x03,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,
+0x02,0xc0,0x02,0x83,0x03,0x40,0x01,0x83,0x00,0x80,0x43,0x37,0x01,0x00,0x03,0x40,
+0x00,0x80,0x00,0x21,0x01,0x40,0x03,0x03,0x01,0xc0,0x02,0x83,0x02,0x40,0x01,0x83,
+0x02,0xc0,0x01,0x03,0x03,0x40,0x00,0x83,0x03,0xc0,0x00,0x03,0x01,0x00,0x83,0x37,
+0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
+0x00,0x04,0x73,0x6f,0x72,0x74,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x2e,
+0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x05,0x04,0x00,0x00,0x26,0x02,0x00,0x80,0x01,
+0x02,0x80,0x40,0x01,0x02,0x00,0x00,0xa0,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x01,0x00,0x03,0x3c,0x3d,0x3e,0x00,0x00,0x00,0x00,0x3c,0x00,0x01,
+0x00,0x03,0x00,0x00,0x00,0x07,0x00,0xc0,0x00,0x03,0x00,0x80,0x40,0xb7,0x00,0x80,
+0x00,0x20,0x01,0x40,0x00,0x03,0x01,0x00,0x80,0xb7,0x00,0x80,0x40,0xb2,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x74,0x6f,0x5f,0x61,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x49,0x00,0x01,0x00,0x03,0x00,0x00,
+0x00,0x05,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,
+0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x09,
+0x45,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,
+0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x43,0x6c,0x61,0x73,0x73,0x00,0x00,
+0x00,0x00,0x4f,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x11,0x00,
+0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x09,0x45,0x78,0x63,0x65,0x70,0x74,0x69,
+0x6f,0x6e,0x00,0x00,0x0a,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,0x73,0x73,0x00,
+0x00,0x02,0x3d,0x3d,0x00,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x00,
+0x00,0x61,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x09,0x01,0x00,0x00,0x11,0x01,0x80,
+0x00,0x3d,0x01,0x00,0x40,0xa0,0x00,0x80,0x80,0x01,0x01,0x00,0x40,0x01,0x01,0x00,
+0x80,0x20,0x01,0x80,0x00,0x11,0x01,0x00,0xc0,0xb2,0x01,0x00,0x00,0x29,0x00,0x00,
+0x00,0x01,0x10,0x00,0x01,0x61,0x00,0x00,0x00,0x04,0x00,0x09,0x45,0x78,0x63,0x65,
+0x70,0x74,0x69,0x6f,0x6e,0x00,0x00,0x09,0x65,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,
+0x6e,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,
+0x00,0x00,0x81,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x11,0x01,0x80,0x00,0x11,0x01,
+0x80,0x40,0x20,0x00,0x80,0xc0,0x01,0x01,0x80,0x00,0x11,0x02,0x00,0x00,0x3d,0x01,
+0x80,0x40,0xa0,0x01,0x00,0xc0,0x01,0x01,0x80,0x40,0x01,0x01,0x80,0x80,0x20,0x02,
+0x00,0x00,0x11,0x01,0x80,0xc0,0xb2,0x01,0xc0,0x02,0x19,0x01,0x80,0x80,0x01,0x01,
+0x80,0x80,0x20,0x02,0x00,0x00,0x11,0x01,0x80,0xc0,0xb2,0x01,0x80,0x00,0x29,0x00,
+0x00,0x00,0x01,0x10,0x00,0x01,0x62,0x00,0x00,0x00,0x04,0x00,0x09,0x45,0x78,0x63,
+0x65,0x70,0x74,0x69,0x6f,0x6e,0x00,0x00,0x09,0x65,0x78,0x63,0x65,0x70,0x74,0x69,
+0x6f,0x6e,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,
+0x00,0x00,0x00,0x63,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x09,0x01,0x00,0x00,0x11,
+0x01,0x80,0x00,0x3d,0x01,0x00,0x40,0xa0,0x00,0x80,0x80,0x01,0x01,0x00,0x40,0x01,
+0x01,0x00,0x80,0x20,0x01,0x80,0x00,0x3d,0x01,0x00,0xc0,0xb2,0x01,0x00,0x00,0x29,
+0x00,0x00,0x00,0x01,0x10,0x00,0x01,0x61,0x00,0x00,0x00,0x04,0x00,0x09,0x45,0x78,
+0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x00,0x00,0x09,0x65,0x78,0x63,0x65,0x70,0x74,
+0x69,0x6f,0x6e,0x00,0x00,0x07,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x00,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x00,0x00,0x60,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x09,0x01,
+0x00,0x00,0x11,0x01,0x80,0x00,0x3d,0x01,0x00,0x40,0xa0,0x00,0x80,0x80,0x01,0x01,
+0x00,0x40,0x01,0x01,0x00,0x80,0x20,0x01,0x80,0x00,0x3d,0x01,0x00,0xc0,0xb2,0x01,
+0x00,0x00,0x29,0x00,0x00,0x00,0x01,0x10,0x00,0x01,0x61,0x00,0x00,0x00,0x04,0x00,
+0x09,0x45,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x00,0x00,0x09,0x65,0x78,0x63,
+0x65,0x70,0x74,0x69,0x6f,0x6e,0x00,0x00,0x04,0x74,0x6f,0x5f,0x73,0x00,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x00,0x00,0x78,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x0b,0x01,
+0x00,0x00,0x11,0x01,0x00,0x40,0x20,0x00,0x80,0x80,0x01,0x01,0x00,0x40,0x01,0x01,
+0x80,0x00,0x3d,0x01,0x00,0x80,0xa0,0x01,0x00,0x40,0x01,0x01,0x00,0xc0,0x20,0x01,
+0x80,0x00,0x3d,0x01,0x01,0x00,0xb2,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x01,0x10,
+0x00,0x01,0x61,0x00,0x00,0x00,0x05,0x00,0x09,0x45,0x78,0x63,0x65,0x70,0x74,0x69,
+0x6f,0x6e,0x00,0x00,0x09,0x65,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x00,0x00,
+0x0a,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x69,0x7a,0x65,0x00,0x00,0x07,0x6d,0x65,
+0x73,0x73,0x61,0x67,0x65,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x7e,0x00,
+0x01,0x00,0x03,0x00,0x00,0x00,0x12,0x00,0x40,0x02,0x9a,0x00,0x80,0x00,0x06,0x01,
+0x00,0x00,0x91,0x01,0x00,0x80,0x20,0x00,0x80,0x00,0xa0,0x00,0x40,0x04,0x97,0x00,
+0x80,0x00,0x1b,0x01,0x00,0x00,0x91,0x01,0x80,0x40,0x01,0x01,0x00,0xc0,0xa0,0x01,
+0x40,0x00,0x98,0x00,0x40,0x01,0x17,0x00,0x80,0x00,0x07,0x00,0x40,0x01,0x97,0x00,
+0x80,0x00,0x1d,0x00,0x80,0x00,0x1c,0x00,0x80,0x00,0x08,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x05,0x72,0x61,0x69,0x73,0x65,0x00,0x00,
+0x0b,0x53,0x63,0x72,0x69,0x70,0x74,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x03,0x6e,
+0x65,0x77,0x00,0x00,0x03,0x3d,0x3d,0x3d,0x00,0x00,0x00,0x00,0x7e,0x00,0x01,0x00,
+0x03,0x00,0x00,0x00,0x12,0x00,0x40,0x02,0x9a,0x00,0x80,0x00,0x06,0x01,0x00,0x00,
+0x91,0x01,0x00,0x80,0x20,0x00,0x80,0x00,0xa0,0x00,0x40,0x04,0x97,0x00,0x80,0x00,
+0x1b,0x01,0x00,0x00,0x91,0x01,0x80,0x40,0x01,0x01,0x00,0xc0,0xa0,0x01,0x40,0x00,
+0x98,0x00,0x40,0x01,0x17,0x00,0x80,0x00,0x07,0x00,0x40,0x01,0x97,0x00,0x80,0x00,
+0x1d,0x00,0x80,0x00,0x1c,0x00,0x80,0x00,0x08,0x00,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x04,0x00,0x05,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x0b,0x53,
+0x79,0x6e,0x74,0x61,0x78,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x03,0x6e,0x65,0x77,
+0x00,0x00,0x03,0x3d,0x3d,0x3d,0x00,0x00,0x00,0x00,0x39,0x00,0x01,0x00,0x03,0x00,
+0x00,0x00,0x07,0x00,0x00,0x00,0x9e,0x00,0xc0,0x00,0x03,0x00,0x80,0x00,0xad,0x00,
+0x80,0x00,0x1f,0x01,0x40,0x00,0x83,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x2b,0x00,0x00,0x02,0x3d,0x3d,0x00,
+0x00,0x00,0x00,0x24,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0xc0,0x00,0x83,
+0x00,0x80,0x01,0x2d,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0x45,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0a,
+0x00,0x00,0x01,0x1e,0x00,0xc0,0x00,0x03,0x00,0x80,0x00,0xad,0x00,0x00,0x00,0x9e,
+0x00,0xc0,0x00,0x83,0x00,0x80,0x01,0x2d,0x01,0x00,0x00,0x1f,0x01,0x40,0x01,0x83,
+0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
+0x00,0x01,0x2b,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x24,0x00,0x01,0x00,
+0x03,0x00,0x00,0x00,0x03,0x00,0xc0,0x01,0x03,0x00,0x80,0x01,0xad,0x01,0x00,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x2b,0x00,0x00,0x00,0x00,
+0x24,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0xc0,0x01,0x83,0x00,0x80,0x02,
+0x2d,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x2b,
+0x00,0x00,0x00,0x00,0x45,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0a,0x00,0x00,0x01,
+0x1e,0x00,0xc0,0x00,0x03,0x00,0x80,0x00,0xad,0x00,0x00,0x00,0x9e,0x00,0xc0,0x00,
+0x83,0x00,0x80,0x01,0x2d,0x01,0x00,0x00,0x1f,0x01,0x40,0x01,0x83,0x00,0x80,0x40,
+0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x2b,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x24,0x00,0x01,0x00,0x03,0x00,0x00,
+0x00,0x03,0x00,0xc0,0x01,0x03,0x00,0x80,0x01,0xad,0x01,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0x34,0x00,0x01,
+0x00,0x03,0x00,0x00,0x00,0x07,0x00,0xc0,0x01,0x83,0x00,0x80,0x02,0x2d,0x00,0x00,
+0x00,0x9e,0x00,0xc0,0x02,0x03,0x00,0x80,0x02,0xad,0x00,0x80,0x00,0x1f,0x01,0x00,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x2b,0x00,0x00,0x00,
+0x00,0x24,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0xc0,0x02,0x83,0x00,0x80,
+0x03,0x2d,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,
+0x2b,0x00,0x00,0x00,0x00,0x4c,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x08,0x00,0x80,
+0x00,0x05,0x01,0x40,0x00,0x03,0x01,0x80,0x03,0x40,0x01,0x00,0x00,0x21,0x01,0x00,
+0x40,0x01,0x01,0x80,0x01,0x11,0x01,0x00,0x40,0xb2,0x01,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x05,0x74,0x69,0x6d,0x65,0x73,0x00,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x08,0x4e,0x69,0x6c,0x43,0x6c,0x61,0x73,0x73,0x00,0x00,0x00,
+0x00,0x76,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x11,0x02,0x00,0x00,0x26,0x00,0x40,
+0x00,0x9a,0x00,0x40,0x04,0x97,0x02,0x00,0x00,0x1b,0x02,0x80,0x00,0x11,0x03,0x01,
+0x00,0x01,0x02,0x80,0x40,0xa0,0x02,0xc0,0x00,0x98,0x00,0x40,0x01,0x17,0x01,0x81,
+0x00,0x01,0x00,0x40,0x01,0x17,0x02,0x00,0x00,0x1d,0x00,0x80,0x00,0x1c,0x02,0x00,
+0xc0,0x01,0x02,0x00,0x80,0x20,0x02,0x00,0x40,0x16,0x02,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x0d,0x53,0x74,0x61,0x6e,0x64,0x61,0x72,0x64,
+0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x03,0x3d,0x3d,0x3d,0x00,0x00,0x05,0x63,0x6c,
+0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x65,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0f,
+0x00,0x80,0x40,0x37,0x00,0x80,0x00,0x0a,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,
+0x00,0x80,0x40,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x04,0xc0,0x00,0x80,0x80,0x46,
+0x00,0x80,0x00,0x06,0x00,0x80,0x80,0x20,0x00,0x80,0x00,0x09,0x01,0x00,0x00,0x05,
+0x01,0x00,0x80,0xb7,0x00,0x80,0xc0,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x04,0x00,0x04,0x24,0x61,0x6e,0x73,0x00,0x00,0x01,0x6d,0x00,0x00,
+0x02,0x6d,0x32,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x25,0x00,0x02,0x00,
+0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x09,0x00,0x00,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x24,0x21,0x00,0x00,0x00,
+0x00,0x30,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x26,0x01,0x40,
+0x00,0x03,0x01,0x80,0x03,0x40,0x01,0x00,0x00,0x21,0x01,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x05,0x74,0x69,0x6d,0x65,0x73,0x00,0x00,0x00,
+0x00,0x28,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x9e,0x00,0x80,
+0x00,0x05,0x00,0x80,0x80,0x29,0x00,0x80,0x00,0x1f,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x01,0x00,0x03,0x00,0x00,
+0x00,0x05,0x00,0x80,0x00,0x09,0x01,0x00,0x00,0x06,0x01,0x00,0x80,0x20,0x00,0x80,
+0x40,0xa0,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x04,
+0x24,0x61,0x6e,0x73,0x00,0x00,0x02,0x3c,0x3c,0x00,0x00,0x01,0x6d,0x00,0x00,0x00,
+0x00,0x61,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0e,0x00,0xbf,0xff,0x83,0x00,0x80,
+0x00,0x0a,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x40,0x46,0x00,0x80,
+0x00,0x48,0x01,0x00,0x0a,0xc0,0x00,0x80,0x80,0x46,0x00,0x80,0x00,0x06,0x00,0x80,
+0x40,0x20,0x00,0x80,0x00,0x09,0x01,0x40,0x03,0x03,0x00,0x80,0xc0,0xb2,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x02,0x24,0x69,0x00,0x00,
+0x01,0x6d,0x00,0x00,0x04,0x69,0x74,0x65,0x72,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,
+0x00,0x00,0x2f,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x26,0x01,
+0x00,0x00,0x06,0x01,0x80,0x03,0x40,0x01,0x00,0x00,0x21,0x01,0x00,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x69,0x74,0x65,0x72,0x00,0x00,0x00,
+0x00,0x51,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0d,0x00,0x00,0x01,0x1e,0x00,0x80,
+0x00,0x09,0x00,0x80,0x40,0xad,0x00,0x80,0x00,0x0a,0x00,0x00,0x00,0x9e,0x00,0x80,
+0x00,0x09,0x00,0x80,0x41,0x2d,0x00,0x80,0x00,0x0a,0x00,0x80,0x40,0x29,0x01,0x00,
+0x00,0x1f,0x00,0xbf,0xff,0x83,0x00,0x80,0x00,0x0a,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x02,0x24,0x69,0x00,0x00,0x01,0x2b,0x00,0x00,
+0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,
+0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2d,0x00,
+0x01,0x00,0x03,0x00,0x00,0x00,0x04,0x00,0x80,0x00,0x09,0x00,0x80,0x42,0x2d,0x00,
+0x80,0x00,0x0a,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,
+0x02,0x24,0x69,0x00,0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0x2b,0x00,0x02,0x00,0x03,
+0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x26,0x01,0x00,0x00,0x2b,0x01,0x00,0x00,0x20,
+0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x63,0x61,
+0x6c,0x6c,0x00,0x00,0x00,0x00,0x4e,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0b,0x00,
+0xbf,0xff,0x83,0x00,0x80,0x00,0x0a,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,
+0x80,0x40,0x46,0x00,0x80,0x00,0x06,0x00,0x80,0x40,0x20,0x00,0x80,0x00,0x09,0x01,
+0x40,0x04,0x83,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x03,0x00,0x02,0x24,0x69,0x00,0x00,0x01,0x6d,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x00,0x00,0x67,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x10,0x00,0x00,0x00,
+0x26,0x00,0x00,0x01,0x1e,0x01,0x00,0x00,0x09,0x01,0x00,0x40,0xad,0x01,0x00,0x00,
+0x0a,0x00,0x00,0x00,0x9e,0x01,0x00,0x00,0x09,0x01,0x00,0x41,0x2d,0x01,0x00,0x00,
+0x0a,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x01,0x00,0x00,0x1f,0x01,0x00,0x00,
+0x06,0x01,0x80,0x01,0x84,0x01,0x00,0x80,0xa0,0x01,0x00,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x04,0x00,0x02,0x24,0x69,0x00,0x00,0x01,0x2b,0x00,0x00,0x01,
+0x70,0x00,0x00,0x03,0x65,0x6e,0x64,0x00,0x00,0x00,0x00,0x2d,0x00,0x01,0x00,0x03,
+0x00,0x00,0x00,0x04,0x00,0x80,0x00,0x09,0x00,0x80,0x41,0xad,0x00,0x80,0x00,0x0a,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x02,0x24,0x69,
+0x00,0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0x2d,0x00,0x01,0x00,0x03,0x00,0x00,0x00,
+0x04,0x00,0x80,0x00,0x09,0x00,0x80,0x42,0x2d,0x00,0x80,0x00,0x0a,0x00,0x80,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x02,0x24,0x69,0x00,0x00,0x01,
+0x2b,0x00,0x00,0x00,0x00,0x73,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x11,0x00,0x40,
+0x01,0x1a,0x00,0xc0,0x00,0x03,0x00,0x40,0x04,0x97,0x00,0x80,0x00,0x1b,0x01,0x00,
+0x00,0x11,0x01,0x80,0x40,0x01,0x01,0x00,0x40,0xa0,0x01,0x40,0x00,0x98,0x00,0x40,
+0x01,0x17,0x00,0xc0,0x00,0x83,0x00,0x40,0x01,0x97,0x00,0x80,0x00,0x1d,0x00,0x80,
+0x00,0x1c,0x00,0xc0,0x01,0x03,0x01,0x40,0x01,0x03,0x00,0x80,0x80,0xb2,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x0d,0x53,0x74,0x61,0x6e,
+0x64,0x61,0x72,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x03,0x3d,0x3d,0x3d,0x00,
+0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x8b,0x00,0x01,0x00,0x03,0x00,0x00,0x00,
+0x16,0x00,0x00,0x00,0x9e,0x00,0x40,0x01,0x9a,0x00,0xc0,0x00,0x03,0x00,0x80,0x00,
+0xad,0x00,0x40,0x05,0x17,0x00,0x80,0x00,0x1b,0x01,0x00,0x00,0x91,0x01,0x80,0x40,
+0x01,0x01,0x00,0x80,0xa0,0x01,0x40,0x00,0x98,0x00,0x40,0x01,0x97,0x00,0xc0,0x00,
+0x83,0x00,0x80,0x01,0x2d,0x00,0x40,0x02,0x17,0x00,0x80,0x00,0x1d,0x00,0x80,0x00,
+0x1c,0x00,0xc0,0x01,0x03,0x00,0x80,0x01,0xad,0x00,0x80,0x00,0x1f,0x01,0x40,0x02,
+0x83,0x00,0x80,0xc0,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x04,0x00,0x01,0x2b,0x00,0x00,0x0d,0x53,0x74,0x61,0x6e,0x64,0x61,0x72,0x64,0x45,
+0x72,0x72,0x6f,0x72,0x00,0x00,0x03,0x3d,0x3d,0x3d,0x00,0x00,0x02,0x3d,0x3d,0x00,
+0x00,0x00,0x00,0x24,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0xc0,0x01,0x83,
+0x00,0x80,0x02,0x2d,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0xcf,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x27,
+0x00,0x00,0x00,0x9e,0x00,0x40,0x0a,0x1a,0x00,0xc0,0x00,0x03,0x00,0x80,0x00,0xad,
+0x00,0x40,0x01,0x9a,0x00,0xc0,0x00,0x83,0x00,0x80,0x01,0x2d,0x00,0x40,0x05,0x17,
+0x00,0x80,0x00,0x1b,0x01,0x00,0x00,0x91,0x01,0x80,0x40,0x01,0x01,0x00,0x80,0xa0,
+0x01,0x40,0x00,0x98,0x00,0x40,0x01,0x97,0x00,0xc0,0x01,0x03,0x00,0x80,0x01,0xad,
+0x00,0x40,0x02,0x17,0x00,0x80,0x00,0x1d,0x00,0x80,0x00,0x1c,0x00,0xc0,0x01,0x83,
+0x00,0x80,0x02,0x2d,0x00,0x40,0x05,0x17,0x00,0x80,0x00,0x1b,0x01,0x00,0x00,0x91,
+0x01,0x80,0x40,0x01,0x01,0x00,0x80,0xa0,0x01,0x40,0x00,0x98,0x00,0x40,0x01,0x97,
+0x00,0xc0,0x02,0x03,0x00,0x80,0x02,0xad,0x00,0x40,0x02,0x17,0x00,0x80,0x00,0x1d,
+0x00,0x80,0x00,0x1c,0x00,0xc0,0x02,0x83,0x00,0x80,0x03,0x2d,0x00,0x80,0x00,0x1f,
+0x01,0x40,0x05,0x83,0x00,0x80,0xc0,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x04,0x00,0x01,0x2b,0x00,0x00,0x0d,0x53,0x74,0x61,0x6e,0x64,0x61,
+0x72,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x03,0x3d,0x3d,0x3d,0x00,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x00,0x00,0x24,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x03,0x00,
+0xc0,0x03,0x03,0x00,0x80,0x03,0xad,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x01,0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0xc9,0x00,0x02,0x00,0x04,0x00,
+0x00,0x00,0x1f,0x00,0x80,0x00,0x04,0x00,0x40,0x08,0x1a,0x00,0x40,0x02,0x1a,0x01,
+0x00,0x00,0x06,0x01,0x80,0x01,0x11,0x01,0x00,0x40,0xa0,0x00,0x40,0x04,0x97,0x01,
+0x00,0x00,0x1b,0x01,0x80,0x01,0x91,0x02,0x00,0x80,0x01,0x01,0x81,0x00,0xa0,0x01,
+0xc0,0x00,0x98,0x00,0x40,0x01,0x17,0x00,0x80,0x02,0x84,0x00,0x40,0x01,0x17,0x01,
+0x00,0x00,0x1d,0x00,0x80,0x00,0x1c,0x00,0x40,0x04,0x17,0x01,0x00,0x00,0x1b,0x01,
+0x80,0x01,0x11,0x02,0x00,0x80,0x01,0x01,0x81,0x00,0xa0,0x01,0xc0,0x00,0x98,0x00,
+0x40,0x00,0x97,0x00,0x40,0x01,0x17,0x01,0x00,0x00,0x1d,0x00,0x80,0x00,0x1c,0x01,
+0x00,0x40,0x01,0x01,0x80,0x00,0x04,0x01,0x01,0x80,0xb2,0x01,0x00,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x02,0x6f,0x6b,0x00,0x00,0x05,0x72,0x61,
+0x69,0x73,0x65,0x00,0x00,0x09,0x45,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x00,
+0x00,0x0d,0x53,0x74,0x61,0x6e,0x64,0x61,0x72,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,
+0x00,0x03,0x3d,0x3d,0x3d,0x00,0x00,0x02,0x6e,0x67,0x00,0x00,0x02,0x3d,0x3d,0x00,
+0x00,0x00,0x00,0xc9,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x1f,0x00,0x80,0x00,0x04,
+0x00,0x40,0x08,0x1a,0x00,0x40,0x02,0x1a,0x01,0x00,0x00,0x06,0x01,0x80,0x01,0x11,
+0x01,0x00,0x40,0xa0,0x00,0x40,0x04,0x97,0x01,0x00,0x00,0x1b,0x01,0x80,0x01,0x91,
+0x02,0x00,0x80,0x01,0x01,0x81,0x00,0xa0,0x01,0xc0,0x00,0x98,0x00,0x40,0x01,0x17,
+0x00,0x80,0x02,0x84,0x00,0x40,0x01,0x17,0x01,0x00,0x00,0x1d,0x00,0x80,0x00,0x1c,
+0x00,0x40,0x04,0x17,0x01,0x00,0x00,0x1b,0x01,0x80,0x01,0x11,0x02,0x00,0x80,0x01,
+0x01,0x81,0x00,0xa0,0x01,0xc0,0x00,0x98,0x00,0x40,0x00,0x97,0x00,0x40,0x01,0x17,
+0x01,0x00,0x00,0x1d,0x00,0x80,0x00,0x1c,0x01,0x00,0x40,0x01,0x01,0x80,0x00,0x04,
+0x01,0x01,0x80,0xb2,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,
+0x00,0x02,0x6f,0x6b,0x00,0x00,0x05,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x09,0x45,
+0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x00,0x00,0x0d,0x53,0x74,0x61,0x6e,0x64,
+0x61,0x72,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x03,0x3d,0x3d,0x3d,0x00,0x00,
+0x02,0x6e,0x67,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0xdd,0x00,0x02,0x00,
+0x04,0x00,0x00,0x00,0x20,0x00,0x80,0x00,0x04,0x00,0x40,0x02,0x1a,0x01,0x00,0x00,
+0x06,0x01,0x80,0x01,0x11,0x01,0x00,0x40,0xa0,0x00,0x40,0x0a,0x17,0x01,0x00,0x00,
+0x1b,0x01,0x80,0x01,0x91,0x02,0x00,0x80,0x01,0x01,0x81,0x00,0xa0,0x01,0xc0,0x02,
+0x98,0x01,0x80,0x02,0x91,0x02,0x00,0x80,0x01,0x01,0x81,0x00,0xa0,0x01,0xc0,0x00,
+0x98,0x00,0x40,0x01,0x17,0x00,0x80,0x00,0x04,0x00,0x40,0x05,0x17,0x01,0x80,0x01,
+0x11,0x02,0x00,0x80,0x01,0x01,0x81,0x00,0xa0,0x01,0xc0,0x00,0x98,0x00,0x40,0x01,
+0x17,0x00,0x80,0x03,0x04,0x00,0x40,0x01,0x97,0x01,0x00,0x00,0x1d,0x00,0x80,0x00,
+0x1c,0x00,0x80,0x00,0x04,0x01,0x00,0x40,0x01,0x01,0x80,0x03,0x04,0x01,0x01,0xc0,
+0xb2,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x02,0x6e,
+0x67,0x00,0x00,0x05,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x0d,0x53,0x74,0x61,0x6e,
+0x64,0x61,0x72,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x09,0x54,0x79,0x70,0x65,
+0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x03,0x3d,0x3d,0x3d,0x00,0x00,0x0d,0x41,0x72,
+0x67,0x75,0x6d,0x65,0x6e,0x74,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x02,0x6f,0x6b,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x32,0x00,0x02,0x00,0x03,0x00,0x00,
+0x00,0x03,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x0f,0x55,0x6e,0x6b,0x6e,0x6f,0x77,0x6e,0x43,
+0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x00,0x00,0x00,0x00,0xa3,0x00,0x02,0x00,0x04,
+0x00,0x00,0x00,0x14,0x00,0x80,0x00,0x04,0x00,0x40,0x02,0x1a,0x01,0x00,0x00,0x06,
+0x01,0x80,0x01,0x04,0x01,0x00,0x40,0xa0,0x00,0x40,0x04,0x97,0x01,0x00,0x00,0x1b,
+0x01,0x80,0x01,0x91,0x02,0x00,0x80,0x01,0x01,0x81,0x00,0xa0,0x01,0xc0,0x00,0x98,
+0x00,0x40,0x01,0x17,0x00,0x80,0x02,0x84,0x00,0x40,0x01,0x17,0x01,0x00,0x00,0x1d,
+0x00,0x80,0x00,0x1c,0x01,0x00,0x40,0x01,0x01,0x80,0x02,0x84,0x01,0x01,0x80,0xb2,
+0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x02,0x6e,0x67,
+0x00,0x00,0x04,0x73,0x65,0x6e,0x64,0x00,0x00,0x10,0x65,0x78,0x63,0x65,0x70,0x74,
+0x69,0x6f,0x6e,0x5f,0x74,0x65,0x73,0x74,0x31,0x34,0x00,0x00,0x0d,0x53,0x74,0x61,
+0x6e,0x64,0x61,0x72,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x03,0x3d,0x3d,0x3d,
+0x00,0x00,0x02,0x6f,0x6b,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x81,0x00,
+0x02,0x00,0x04,0x00,0x00,0x00,0x12,0x00,0x40,0x01,0x1a,0x01,0x00,0x00,0x04,0x00,
+0x40,0x04,0x97,0x01,0x00,0x00,0x1b,0x01,0x80,0x00,0x91,0x02,0x00,0x80,0x01,0x01,
+0x80,0x80,0xa0,0x01,0xc0,0x00,0x98,0x00,0x40,0x01,0x17,0x01,0x00,0x01,0x84,0x00,
+0x40,0x01,0x17,0x01,0x00,0x00,0x1d,0x00,0x80,0x00,0x1c,0x00,0x80,0x80,0x01,0x01,
+0x00,0x40,0x01,0x01,0x80,0x00,0x04,0x01,0x01,0x00,0xb2,0x01,0x00,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x02,0x6f,0x6b,0x00,0x00,0x0d,0x53,0x74,
+0x61,0x6e,0x64,0x61,0x72,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x03,0x3d,0x3d,
+0x3d,0x00,0x00,0x02,0x6e,0x67,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x9b,
+0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x15,0x00,0x40,0x02,0x9a,0x01,0x00,0x00,0x06,
+0x01,0x80,0x00,0x3d,0x01,0x00,0x00,0xa0,0x01,0x00,0x00,0x08,0x00,0x40,0x06,0x97,
+0x01,0x00,0x00,0x1b,0x01,0x80,0x00,0x91,0x02,0x00,0x80,0x01,0x01,0x80,0x80,0xa0,
+0x01,0xc0,0x00,0x98,0x00,0x40,0x03,0x17,0x00,0x80,0x80,0x01,0x01,0x00,0x40,0x01,
+0x01,0x00,0xc0,0x20,0x01,0x80,0x00,0x3d,0x01,0x01,0x00,0xb2,0x00,0x40,0x01,0x17,
+0x01,0x00,0x00,0x1d,0x00,0x80,0x00,0x1c,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x01,
+0x10,0x00,0x03,0x66,0x6f,0x6f,0x00,0x00,0x00,0x05,0x00,0x05,0x72,0x61,0x69,0x73,
+0x65,0x00,0x00,0x0d,0x53,0x74,0x61,0x6e,0x64,0x61,0x72,0x64,0x45,0x72,0x72,0x6f,
+0x72,0x00,0x00,0x03,0x3d,0x3d,0x3d,0x00,0x00,0x07,0x6d,0x65,0x73,0x73,0x61,0x67,
+0x65,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0xbb,0x00,0x01,0x00,0x03,0x00,
+0x00,0x00,0x1c,0x00,0x00,0x00,0x9e,0x00,0x40,0x02,0x1a,0x00,0x80,0x00,0x06,0x01,
+0x00,0x00,0x3d,0x00,0x80,0x00,0xa0,0x00,0x40,0x08,0x17,0x00,0x80,0x00,0x1b,0x01,
+0x00,0x00,0x91,0x01,0x80,0x40,0x01,0x01,0x00,0x80,0xa0,0x01,0x40,0x00,0x98,0x00,
+0x40,0x01,0x17,0x00,0xc0,0x00,0x03,0x00,0x40,0x05,0x17,0x01,0x00,0x01,0x91,0x01,
+0x80,0x40,0x01,0x01,0x00,0x80,0xa0,0x01,0x40,0x00,0x98,0x00,0x40,0x01,0x17,0x00,
+0xc0,0x00,0x83,0x00,0x40,0x01,0x97,0x00,0x80,0x00,0x1d,0x00,0x80,0x00,0x1c,0x00,
+0xc0,0x01,0x03,0x00,0x80,0x00,0x1f,0x01,0x40,0x00,0x83,0x00,0x81,0x00,0xb2,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x10,0x00,0x01,0x61,0x00,0x00,0x00,0x05,0x00,
+0x05,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x0d,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,
+0x74,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x03,0x3d,0x3d,0x3d,0x00,0x00,0x0d,0x53,
+0x74,0x61,0x6e,0x64,0x61,0x72,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x40,
+0x01,0x83,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0xa7,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x1a,0x00,0x00,0x00,0x9e,0x00,0x40,
+0x01,0x1a,0x00,0xbf,0xff,0x83,0x00,0x40,0x08,0x17,0x00,0x80,0x00,0x1b,0x01,0x00,
+0x00,0x11,0x01,0x80,0x40,0x01,0x01,0x00,0x40,0xa0,0x01,0x40,0x00,0x98,0x00,0x40,
+0x01,0x17,0x00,0xc0,0x00,0x03,0x00,0x40,0x05,0x17,0x01,0x00,0x01,0x11,0x01,0x80,
+0x40,0x01,0x01,0x00,0x40,0xa0,0x01,0x40,0x00,0x98,0x00,0x40,0x01,0x17,0x00,0xc0,
+0x00,0x83,0x00,0x40,0x01,0x97,0x00,0x80,0x00,0x1d,0x00,0x80,0x00,0x1c,0x00,0xc0,
+0x01,0x03,0x00,0x80,0x00,0x1f,0x01,0x40,0x01,0x03,0x00,0x80,0xc0,0xb2,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x0d,0x41,0x72,0x67,0x75,
+0x6d,0x65,0x6e,0x74,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x03,0x3d,0x3d,0x3d,0x00,
+0x00,0x0d,0x53,0x74,0x61,0x6e,0x64,0x61,0x72,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,
+0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,
+0x02,0x00,0x40,0x01,0x83,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x67,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x0c,0x00,0x80,0x00,
+0x05,0x01,0x00,0x00,0x05,0x00,0x80,0x00,0x43,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,
+0x11,0x00,0x80,0x40,0x20,0x00,0x80,0x80,0x20,0x01,0x00,0x00,0x07,0x01,0x80,0x00,
+0x07,0x01,0x00,0x81,0x37,0x00,0x80,0xc0,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x04,0x00,0x11,0x43,0x6c,0x61,0x73,0x73,0x34,0x45,0x78,0x63,
+0x65,0x70,0x74,0x69,0x6f,0x6e,0x31,0x39,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,
+0x01,0x61,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x4c,0x00,0x01,0x00,0x02,
+0x00,0x00,0x00,0x0b,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,
+0x00,0x80,0x00,0x48,0x01,0x00,0x04,0xc0,0x00,0x80,0x40,0x46,0x00,0x80,0x00,0x48,
+0x01,0x00,0x08,0xc0,0x00,0x80,0x80,0x46,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x01,0x61,0x00,0x00,0x01,0x62,0x00,
+0x00,0x01,0x7a,0x00,0x00,0x00,0x00,0x93,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x18,
+0x00,0x00,0x00,0x26,0x01,0x80,0x00,0x08,0x01,0x80,0x00,0x0e,0x01,0x00,0xc0,0x01,
+0x00,0x40,0x01,0x9a,0x01,0x80,0x00,0x06,0x01,0x80,0x40,0x20,0x00,0x40,0x05,0x97,
+0x01,0x80,0x00,0x1b,0x02,0x00,0x01,0x11,0x02,0x80,0xc0,0x01,0x02,0x00,0xc0,0xa0,
+0x02,0x40,0x00,0x98,0x00,0x40,0x02,0x17,0x01,0x80,0x00,0x06,0x01,0x81,0x00,0x20,
+0x01,0x00,0xc0,0x01,0x00,0x40,0x01,0x17,0x01,0x80,0x00,0x1d,0x00,0x80,0x00,0x1c,
+0x01,0x80,0x80,0x01,0x02,0x00,0x00,0x0d,0x00,0x00,0xc1,0x37,0x00,0x00,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x02,0x40,0x65,0x00,0x00,0x01,0x62,
+0x00,0x00,0x09,0x54,0x79,0x70,0x65,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x03,0x3d,
+0x3d,0x3d,0x00,0x00,0x01,0x7a,0x00,0x00,0x00,0x00,0x38,0x00,0x02,0x00,0x04,0x00,
+0x00,0x00,0x07,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x9e,0x01,0x40,0x00,0x03,0x01,
+0x80,0x00,0x3d,0x01,0x00,0x00,0xb0,0x00,0x80,0x00,0x1f,0x01,0x00,0x00,0x29,0x00,
+0x00,0x00,0x01,0x10,0x00,0x01,0x62,0x00,0x00,0x00,0x01,0x00,0x01,0x2a,0x00,0x00,
+0x00,0x00,0x2d,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x80,0x00,0x06,0x00,
+0x80,0x00,0x20,0x00,0x80,0x00,0x8e,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x02,0x00,0x01,0x7a,0x00,0x00,0x02,0x40,0x65,0x00,0x00,0x00,0x00,0x20,
+0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x07,
+0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,
+0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x04,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,
+0x00,0x80,0x80,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,
+0x00,0x09,0x45,0x78,0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x00,0x00,0x03,0x6e,0x65,
+0x77,0x00,0x00,0x07,0x69,0x6e,0x73,0x70,0x65,0x63,0x74,0x00,0x00,0x00,0x00,0x4a,
+0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,
+0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x04,0x00,0x0a,0x46,0x61,0x6c,0x73,0x65,0x43,0x6c,0x61,0x73,0x73,
+0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,
+0x43,0x6c,0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x50,0x00,0x01,0x00,0x03,0x00,0x00,
+0x00,0x05,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,
+0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x0a,
+0x46,0x61,0x6c,0x73,0x65,0x43,0x6c,0x61,0x73,0x73,0x00,0x00,0x0a,0x73,0x75,0x70,
+0x65,0x72,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x06,0x4f,
+0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x00,0x00,0x24,0x00,0x01,0x00,0x02,0x00,0x00,
+0x00,0x03,0x00,0x80,0x00,0x08,0x00,0x80,0x00,0x20,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x21,0x00,0x00,0x00,0x00,0x44,0x00,0x01,
+0x00,0x03,0x00,0x00,0x00,0x0a,0x00,0x80,0x00,0x08,0x01,0x00,0x00,0x07,0x00,0x80,
+0x00,0xa0,0x00,0x80,0x40,0x20,0x00,0xc0,0x02,0x19,0x00,0x80,0x00,0x08,0x01,0x00,
+0x00,0x08,0x00,0x80,0x00,0xa0,0x00,0x80,0x40,0x20,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x26,0x00,0x00,0x01,0x21,0x00,0x00,0x00,
+0x00,0x40,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x09,0x00,0x80,0x00,0x08,0x01,0x00,
+0x00,0x07,0x00,0x80,0x00,0xa0,0x00,0xc0,0x02,0x19,0x00,0x80,0x00,0x08,0x01,0x00,
+0x00,0x08,0x00,0x80,0x00,0xa0,0x00,0x80,0x40,0x20,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x5e,0x00,0x00,0x01,0x21,0x00,0x00,0x00,
+0x00,0x3c,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x08,0x00,0x80,
+0x00,0x20,0x01,0x00,0x00,0x3d,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x01,0x10,0x00,0x05,0x66,0x61,0x6c,0x73,0x65,0x00,0x00,0x00,0x02,0x00,0x04,
+0x74,0x6f,0x5f,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x40,0x00,0x01,
+0x00,0x03,0x00,0x00,0x00,0x09,0x00,0x80,0x00,0x08,0x01,0x00,0x00,0x07,0x00,0x80,
+0x00,0xa0,0x00,0xc0,0x02,0x19,0x00,0x80,0x00,0x08,0x01,0x00,0x00,0x08,0x00,0x80,
+0x00,0xa0,0x00,0x80,0x40,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x02,0x00,0x01,0x7c,0x00,0x00,0x01,0x21,0x00,0x00,0x00,0x00,0x45,0x00,0x01,
+0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,
+0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x04,0x00,0x05,0x46,0x6c,0x6f,0x61,0x74,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,
+0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x43,0x6c,0x61,0x73,0x73,0x00,0x00,
+0x00,0x00,0x4c,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x11,0x00,
+0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x05,0x46,0x6c,0x6f,0x61,0x74,0x00,0x00,
+0x0a,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x07,0x4e,0x75,0x6d,0x65,0x72,0x69,0x63,0x00,0x00,0x00,0x00,0xce,0x00,
+0x03,0x00,0x06,0x00,0x00,0x00,0x11,0x01,0x80,0x00,0x02,0x02,0x00,0x00,0x82,0x01,
+0x80,0x00,0xac,0x00,0x80,0xc0,0x01,0x01,0x80,0x01,0x02,0x01,0x80,0x00,0xad,0x01,
+0x00,0xc0,0x01,0x01,0x80,0x00,0x06,0x02,0x00,0x40,0x01,0x02,0x80,0x01,0x02,0x01,
+0x80,0x41,0x20,0x01,0xc0,0x02,0x19,0x01,0x80,0x00,0x06,0x02,0x00,0x80,0x01,0x02,
+0x80,0x01,0x82,0x01,0x80,0x41,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x04,0x06,
+0x00,0x16,0x33,0x2e,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x37,0x39,0x39,0x39,
+0x39,0x39,0x39,0x39,0x65,0x2b,0x30,0x30,0x06,0x00,0x16,0x31,0x2e,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x31,0x65,0x2d,0x30,
+0x39,0x06,0x00,0x16,0x33,0x2e,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x39,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x06,0x00,0x16,0x34,0x2e,0x31,
+0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x38,0x39,0x39,0x39,0x39,0x39,0x39,0x36,0x65,
+0x2b,0x30,0x30,0x00,0x00,0x00,0x02,0x00,0x01,0x2b,0x00,0x00,0x0b,0x63,0x68,0x65,
+0x63,0x6b,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x00,0x00,0x00,0x00,0xe7,0x00,0x03,0x00,
+0x06,0x00,0x00,0x00,0x11,0x01,0x80,0x00,0x02,0x02,0x00,0x00,0x82,0x01,0x80,0x00,
+0xae,0x00,0x80,0xc0,0x01,0x01,0x80,0x01,0x02,0x01,0x80,0x00,0xaf,0x01,0x00,0xc0,
+0x01,0x01,0x80,0x00,0x06,0x02,0x00,0x40,0x01,0x02,0x80,0x01,0x82,0x01,0x80,0x41,
+0x20,0x01,0xc0,0x02,0x19,0x01,0x80,0x00,0x06,0x02,0x00,0x80,0x01,0x02,0x80,0x02,
+0x02,0x01,0x80,0x41,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x05,0x06,0x00,0x16,
+0x33,0x2e,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x39,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x31,0x65,0x2b,0x30,0x30,0x06,0x00,0x16,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x31,0x65,0x2d,0x30,0x39,0x06,
+0x00,0x16,0x35,0x2e,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x38,0x39,0x39,0x39,
+0x39,0x39,0x39,0x36,0x65,0x2b,0x30,0x30,0x06,0x00,0x16,0x33,0x2e,0x31,0x32,0x33,
+0x34,0x35,0x36,0x37,0x38,0x39,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,
+0x30,0x06,0x00,0x16,0x34,0x2e,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x38,0x39,
+0x39,0x39,0x39,0x39,0x39,0x36,0x65,0x2b,0x30,0x30,0x00,0x00,0x00,0x02,0x00,0x01,
+0x2d,0x00,0x00,0x0b,0x63,0x68,0x65,0x63,0x6b,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x00,
+0x00,0x00,0x00,0xa0,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x12,0x01,0x80,0x00,0x02,
+0x02,0x00,0x00,0x02,0x01,0x80,0x00,0xb0,0x00,0x80,0xc0,0x01,0x01,0x80,0x00,0x02,
+0x02,0x40,0x00,0x03,0x01,0x80,0x00,0xb0,0x01,0x00,0xc0,0x01,0x01,0x80,0x00,0x06,
+0x02,0x00,0x40,0x01,0x02,0x80,0x00,0x82,0x01,0x80,0x41,0x20,0x01,0xc0,0x02,0x19,
+0x01,0x80,0x00,0x06,0x02,0x00,0x80,0x01,0x02,0x80,0x00,0x02,0x01,0x80,0x41,0x20,
+0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x02,0x06,0x00,0x16,0x33,0x2e,0x31,0x32,0x35,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,
+0x30,0x06,0x00,0x16,0x39,0x2e,0x37,0x36,0x35,0x36,0x32,0x35,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x00,0x00,0x00,0x02,0x00,0x01,
+0x2a,0x00,0x00,0x0b,0x63,0x68,0x65,0x63,0x6b,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x00,
+0x00,0x00,0x00,0xa0,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x12,0x01,0x80,0x00,0x02,
+0x02,0x00,0x00,0x02,0x01,0x80,0x00,0xb1,0x00,0x80,0xc0,0x01,0x01,0x80,0x00,0x02,
+0x02,0x40,0x00,0x03,0x01,0x80,0x00,0xb1,0x01,0x00,0xc0,0x01,0x01,0x80,0x00,0x06,
+0x02,0x00,0x40,0x01,0x02,0x80,0x00,0x82,0x01,0x80,0x41,0x20,0x01,0xc0,0x02,0x19,
+0x01,0x80,0x00,0x06,0x02,0x00,0x80,0x01,0x02,0x80,0x00,0x02,0x01,0x80,0x41,0x20,
+0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x02,0x06,0x00,0x16,0x33,0x2e,0x31,0x32,0x33,
+0x34,0x35,0x36,0x37,0x38,0x39,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,
+0x30,0x06,0x00,0x16,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x00,0x00,0x00,0x02,0x00,0x01,
+0x2f,0x00,0x00,0x0b,0x63,0x68,0x65,0x63,0x6b,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x00,
+0x00,0x00,0x00,0xb9,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x12,0x01,0x80,0x00,0x02,
+0x02,0x00,0x00,0x02,0x01,0x80,0x00,0xa0,0x00,0x80,0xc0,0x01,0x01,0x80,0x00,0x02,
+0x02,0x40,0x00,0x03,0x01,0x80,0x00,0xa0,0x01,0x00,0xc0,0x01,0x01,0x80,0x00,0x06,
+0x02,0x00,0x40,0x01,0x02,0x80,0x00,0x82,0x01,0x80,0x41,0x20,0x01,0xc0,0x02,0x19,
+0x01,0x80,0x00,0x06,0x02,0x00,0x80,0x01,0x02,0x80,0x01,0x02,0x01,0x80,0x41,0x20,
+0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x03,0x06,0x00,0x16,0x33,0x2e,0x31,0x32,0x35,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,
+0x30,0x06,0x00,0x16,0x30,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x06,0x00,0x16,0x31,0x2e,0x32,
+0x35,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,
+0x2d,0x30,0x31,0x00,0x00,0x00,0x02,0x00,0x01,0x25,0x00,0x00,0x0b,0x63,0x68,0x65,
+0x63,0x6b,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x00,0x00,0x00,0x01,0x0a,0x00,0x06,0x00,
+0x08,0x00,0x00,0x00,0x28,0x03,0x00,0x00,0x02,0x03,0x80,0x00,0x82,0x03,0x00,0x00,
+0xa0,0x00,0x81,0x80,0x01,0x03,0x00,0x00,0x02,0x03,0x80,0x00,0x02,0x03,0x00,0x00,
+0xa0,0x01,0x01,0x80,0x01,0x03,0x00,0x00,0x02,0x03,0x80,0x01,0x02,0x03,0x00,0x00,
+0xa0,0x01,0x81,0x80,0x01,0x03,0x00,0x00,0x02,0x03,0xc0,0x01,0x03,0x03,0x00,0x00,
+0xa0,0x02,0x01,0x80,0x01,0x03,0x00,0x00,0x02,0x03,0xc0,0x01,0x83,0x03,0x00,0x00,
+0xa0,0x02,0x81,0x80,0x01,0x03,0x00,0x40,0x01,0x03,0xc0,0x00,0x03,0x03,0x00,0x40,
+0xb2,0x03,0x40,0x01,0x99,0x03,0x00,0x80,0x01,0x03,0xbf,0xff,0x83,0x03,0x00,0x40,
+0xb2,0x03,0x40,0x01,0x99,0x03,0x00,0xc0,0x01,0x03,0xbf,0xff,0x03,0x03,0x00,0x40,
+0xb2,0x03,0x40,0x01,0x99,0x03,0x01,0x00,0x01,0x03,0xc0,0x00,0x03,0x03,0x00,0x40,
+0xb2,0x03,0x40,0x01,0x99,0x03,0x01,0x40,0x01,0x03,0xbf,0xff,0x03,0x03,0x00,0x40,
+0xb2,0x03,0x00,0x00,0x29,0x00,0x00,0x00,0x03,0x06,0x00,0x16,0x33,0x2e,0x31,0x32,
+0x35,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,
+0x30,0x30,0x06,0x00,0x16,0x33,0x2e,0x31,0x32,0x33,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x32,0x65,0x2b,0x30,0x30,0x06,0x00,0x16,0x33,0x2e,
+0x31,0x32,0x35,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,
+0x65,0x2b,0x30,0x30,0x00,0x00,0x00,0x02,0x00,0x03,0x3c,0x3d,0x3e,0x00,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x00,0x00,0x73,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x09,0x00,
+0x80,0x00,0x02,0x01,0x00,0x00,0x02,0x00,0x80,0x00,0xb2,0x00,0xc0,0x02,0x19,0x00,
+0x80,0x00,0x02,0x01,0x00,0x00,0x82,0x00,0x80,0x00,0xb2,0x00,0x80,0x40,0x20,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x02,0x06,0x00,0x16,0x33,0x2e,0x31,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x31,0x65,0x2b,0x30,0x30,
+0x06,0x00,0x16,0x33,0x2e,0x32,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x32,0x65,0x2b,0x30,0x30,0x00,0x00,0x00,0x02,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x01,0x21,0x00,0x00,0x00,0x00,0xf6,0x00,0x05,0x00,0x07,0x00,0x00,
+0x00,0x1c,0x02,0x80,0x00,0x02,0x02,0x80,0x00,0x20,0x00,0x81,0x40,0x01,0x02,0x80,
+0x00,0x82,0x02,0x80,0x00,0x20,0x01,0x01,0x40,0x01,0x02,0x80,0x01,0x02,0x02,0x80,
+0x00,0x20,0x01,0x81,0x40,0x01,0x02,0x80,0x01,0x82,0x02,0x80,0x00,0x20,0x02,0x01,
+0x40,0x01,0x02,0x80,0x40,0x01,0x03,0x40,0x01,0x83,0x02,0x80,0x40,0xb2,0x02,0xc0,
+0x01,0x99,0x02,0x80,0x80,0x01,0x03,0x40,0x01,0x03,0x02,0x80,0x40,0xb2,0x02,0xc0,
+0x01,0x99,0x02,0x80,0xc0,0x01,0x03,0x3f,0xfe,0x03,0x02,0x80,0x40,0xb2,0x02,0xc0,
+0x01,0x99,0x02,0x81,0x00,0x01,0x03,0x3f,0xfe,0x03,0x02,0x80,0x40,0xb2,0x02,0x80,
+0x00,0x29,0x00,0x00,0x00,0x04,0x06,0x00,0x16,0x33,0x2e,0x31,0x32,0x33,0x34,0x35,
+0x36,0x37,0x38,0x39,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x06,
+0x00,0x16,0x33,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x06,0x00,0x17,0x2d,0x33,0x2e,0x31,0x32,
+0x33,0x34,0x35,0x36,0x37,0x38,0x39,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,
+0x30,0x30,0x06,0x00,0x17,0x2d,0x33,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x00,0x00,0x00,0x02,
+0x00,0x04,0x63,0x65,0x69,0x6c,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x95,
+0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x09,0x00,0x80,0x00,0x02,0x00,0x80,0x00,0x20,
+0x00,0xc0,0x02,0x99,0x00,0x80,0x00,0x82,0x01,0x00,0x01,0x02,0x00,0x80,0x40,0xb1,
+0x00,0x80,0x00,0x20,0x00,0x80,0x80,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x03,
+0x06,0x00,0x16,0x33,0x2e,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x39,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x06,0x00,0x16,0x31,0x2e,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,
+0x30,0x30,0x06,0x00,0x16,0x30,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x00,0x00,0x00,0x03,0x00,
+0x07,0x66,0x69,0x6e,0x69,0x74,0x65,0x3f,0x00,0x00,0x01,0x2f,0x00,0x00,0x01,0x21,
+0x00,0x00,0x00,0x00,0xf7,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0x1c,0x02,0x80,0x00,
+0x02,0x02,0x80,0x00,0x20,0x00,0x81,0x40,0x01,0x02,0x80,0x00,0x82,0x02,0x80,0x00,
+0x20,0x01,0x01,0x40,0x01,0x02,0x80,0x01,0x02,0x02,0x80,0x00,0x20,0x01,0x81,0x40,
+0x01,0x02,0x80,0x01,0x82,0x02,0x80,0x00,0x20,0x02,0x01,0x40,0x01,0x02,0x80,0x40,
+0x01,0x03,0x40,0x01,0x03,0x02,0x80,0x40,0xb2,0x02,0xc0,0x01,0x99,0x02,0x80,0x80,
+0x01,0x03,0x40,0x01,0x03,0x02,0x80,0x40,0xb2,0x02,0xc0,0x01,0x99,0x02,0x80,0xc0,
+0x01,0x03,0x3f,0xfd,0x83,0x02,0x80,0x40,0xb2,0x02,0xc0,0x01,0x99,0x02,0x81,0x00,
+0x01,0x03,0x3f,0xfe,0x03,0x02,0x80,0x40,0xb2,0x02,0x80,0x00,0x29,0x00,0x00,0x00,
+0x04,0x06,0x00,0x16,0x33,0x2e,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x39,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x06,0x00,0x16,0x33,0x2e,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,
+0x2b,0x30,0x30,0x06,0x00,0x17,0x2d,0x33,0x2e,0x31,0x32,0x33,0x34,0x35,0x36,0x37,
+0x38,0x39,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x06,0x00,0x17,
+0x2d,0x33,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x00,0x00,0x00,0x02,0x00,0x05,0x66,0x6c,0x6f,
+0x6f,0x72,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0xf2,0x00,0x04,0x00,0x06,
+0x00,0x00,0x00,0x19,0x02,0x00,0x00,0x02,0x02,0x00,0x00,0x20,0x00,0x81,0x00,0x01,
+0x02,0x00,0x00,0x82,0x02,0x80,0x01,0x02,0x02,0x00,0x40,0xb1,0x02,0x00,0x00,0x20,
+0x01,0x01,0x00,0x01,0x02,0x00,0x01,0x82,0x02,0x80,0x01,0x02,0x02,0x00,0x40,0xb1,
+0x02,0x00,0x00,0x20,0x01,0x81,0x00,0x01,0x02,0x00,0x40,0x01,0x02,0x80,0x00,0x05,
+0x02,0x00,0x80,0xb2,0x02,0x40,0x01,0x99,0x02,0x00,0x80,0x01,0x02,0xc0,0x00,0x03,
+0x02,0x00,0x80,0xb2,0x02,0x40,0x01,0x99,0x02,0x00,0xc0,0x01,0x02,0xbf,0xff,0x03,
+0x02,0x00,0x80,0xb2,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x04,0x06,0x00,0x16,0x33,
+0x2e,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x39,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x65,0x2b,0x30,0x30,0x06,0x00,0x16,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x06,0x00,
+0x16,0x30,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x06,0x00,0x17,0x2d,0x31,0x2e,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,
+0x30,0x00,0x00,0x00,0x03,0x00,0x09,0x69,0x6e,0x66,0x69,0x6e,0x69,0x74,0x65,0x3f,
+0x00,0x00,0x01,0x2f,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x02,0x26,0x00,0x0a,
+0x00,0x0d,0x00,0x00,0x00,0x45,0x05,0x00,0x00,0x02,0x05,0x00,0x00,0x20,0x00,0x82,
+0x80,0x01,0x05,0x00,0x00,0x82,0x05,0x00,0x00,0x20,0x01,0x02,0x80,0x01,0x05,0x00,
+0x01,0x02,0x05,0x00,0x00,0x20,0x01,0x82,0x80,0x01,0x05,0x00,0x01,0x82,0x05,0x00,
+0x00,0x20,0x02,0x02,0x80,0x01,0x05,0x00,0x02,0x02,0x05,0x00,0x00,0x20,0x02,0x82,
+0x80,0x01,0x05,0x00,0x02,0x82,0x05,0xbf,0xff,0x03,0x05,0x00,0x00,0xa0,0x03,0x02,
+0x80,0x01,0x05,0x00,0x03,0x02,0x05,0xbf,0xff,0x83,0x05,0x00,0x00,0xa0,0x03,0x82,
+0x80,0x01,0x05,0x00,0x03,0x02,0x05,0xc0,0x00,0x03,0x05,0x00,0x00,0xa0,0x04,0x02,
+0x80,0x01,0x05,0x00,0x03,0x02,0x05,0xc0,0x01,0x03,0x05,0x00,0x00,0xa0,0x04,0x82,
+0x80,0x01,0x05,0x00,0x40,0x01,0x05,0xc0,0x01,0x03,0x05,0x00,0x40,0xb2,0x05,0x40,
+0x01,0x99,0x05,0x00,0x80,0x01,0x05,0xc0,0x01,0x83,0x05,0x00,0x40,0xb2,0x05,0x40,
+0x01,0x99,0x05,0x00,0xc0,0x01,0x05,0xc0,0x01,0x03,0x05,0x00,0x40,0xb2,0x05,0x40,
+0x01,0x99,0x05,0x01,0x00,0x01,0x05,0xbf,0xfe,0x03,0x05,0x00,0x40,0xb2,0x05,0x40,
+0x01,0x99,0x05,0x01,0x40,0x01,0x05,0xbf,0xfd,0x83,0x05,0x00,0x40,0xb2,0x05,0x40,
+0x01,0x99,0x05,0x01,0x80,0x01,0x05,0xd8,0x1e,0x83,0x05,0x00,0x40,0xb2,0x05,0x40,
+0x01,0x99,0x05,0x01,0xc0,0x01,0x05,0xc0,0x01,0x03,0x05,0x00,0x40,0xb2,0x05,0x40,
+0x02,0x19,0x05,0x00,0x00,0x06,0x05,0x82,0x00,0x01,0x06,0x00,0x03,0x82,0x05,0x00,
+0x81,0x20,0x05,0x40,0x02,0x19,0x05,0x00,0x00,0x06,0x05,0x82,0x40,0x01,0x06,0x00,
+0x04,0x02,0x05,0x00,0x81,0x20,0x05,0x00,0x00,0x29,0x00,0x00,0x00,0x09,0x06,0x00,
+0x16,0x33,0x2e,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x39,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x06,0x00,0x16,0x33,0x2e,0x35,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,
+0x06,0x00,0x16,0x33,0x2e,0x34,0x39,0x39,0x38,0x39,0x39,0x39,0x39,0x39,0x39,0x39,
+0x39,0x39,0x39,0x39,0x38,0x65,0x2b,0x30,0x30,0x06,0x00,0x17,0x2d,0x33,0x2e,0x31,
+0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x39,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,
+0x2b,0x30,0x30,0x06,0x00,0x17,0x2d,0x33,0x2e,0x35,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x06,0x00,0x16,
+0x31,0x2e,0x32,0x33,0x34,0x35,0x36,0x37,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x65,0x2b,0x30,0x34,0x06,0x00,0x16,0x33,0x2e,0x34,0x32,0x33,0x34,0x35,
+0x36,0x37,0x38,0x38,0x39,0x39,0x39,0x39,0x39,0x39,0x38,0x65,0x2b,0x30,0x30,0x06,
+0x00,0x16,0x33,0x2e,0x33,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,0x39,
+0x39,0x39,0x39,0x39,0x65,0x2b,0x30,0x30,0x06,0x00,0x16,0x33,0x2e,0x34,0x32,0x33,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,
+0x30,0x00,0x00,0x00,0x03,0x00,0x05,0x72,0x6f,0x75,0x6e,0x64,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x0b,0x63,0x68,0x65,0x63,0x6b,0x5f,0x66,0x6c,0x6f,0x61,0x74,0x00,
+0x00,0x00,0x00,0x5e,0x00,0x02,0x00,0x05,0x00,0x00,0x00,0x07,0x00,0x80,0x00,0x02,
+0x01,0x00,0x00,0x06,0x01,0x80,0x40,0x01,0x01,0x80,0x40,0x20,0x02,0x00,0x40,0x01,
+0x01,0x00,0x01,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x01,0x06,0x00,0x16,0x33,
+0x2e,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x39,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x65,0x2b,0x30,0x30,0x00,0x00,0x00,0x02,0x00,0x0b,0x63,0x68,0x65,0x63,0x6b,
+0x5f,0x66,0x6c,0x6f,0x61,0x74,0x00,0x00,0x04,0x74,0x6f,0x5f,0x66,0x00,0x00,0x00,
+0x00,0x4d,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x02,0x00,0x80,
+0x00,0x20,0x01,0x40,0x01,0x03,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x01,0x06,0x00,0x16,0x33,0x2e,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x39,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x00,0x00,0x00,0x02,0x00,
+0x04,0x74,0x6f,0x5f,0x69,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x7f,0x00,
+0x01,0x00,0x03,0x00,0x00,0x00,0x0a,0x00,0x80,0x00,0x02,0x00,0x80,0x00,0x20,0x01,
+0x40,0x01,0x03,0x00,0x80,0x40,0xb2,0x00,0xc0,0x02,0x19,0x00,0x80,0x00,0x82,0x00,
+0x80,0x00,0x20,0x01,0x3f,0xfe,0x03,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x02,0x06,0x00,0x16,0x33,0x2e,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,
+0x39,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x06,0x00,0x17,0x2d,
+0x33,0x2e,0x31,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x31,0x65,0x2b,0x30,0x30,0x00,0x00,0x00,0x02,0x00,0x08,0x74,0x72,0x75,0x6e,
+0x63,0x61,0x74,0x65,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x65,0x00,0x01,
+0x00,0x03,0x00,0x00,0x00,0x0d,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,
+0x00,0x08,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x11,0x00,0x80,0xc0,0x20,0x01,0x00,
+0x00,0x07,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x11,0x00,0x80,0xc0,0x20,0x01,0x00,
+0x00,0x08,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x04,0x00,0x02,0x47,0x43,0x00,0x00,0x07,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x06,0x65,0x6e,0x61,0x62,0x6c,0x65,0x00,0x00,
+0x00,0x00,0x54,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x9e,0x00,
+0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x00,0x08,0x00,0x80,0x80,0xb2,0x00,
+0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x00,0x07,0x00,0x80,0x80,0xb2,0x00,
+0x80,0x00,0x1f,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,
+0x02,0x47,0x43,0x00,0x00,0x07,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,0x00,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x00,0x00,0x2e,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x03,0x00,
+0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x02,0x00,0x02,0x47,0x43,0x00,0x00,0x06,0x65,0x6e,0x61,0x62,0x6c,0x65,
+0x00,0x00,0x00,0x00,0x71,0x00,0x02,0x00,0x05,0x00,0x00,0x00,0x0c,0x01,0x00,0x00,
+0x11,0x01,0x00,0x40,0x20,0x00,0x80,0x80,0x01,0x00,0x00,0x00,0x9e,0x01,0x40,0x4a,
+0x83,0x01,0x80,0x00,0x11,0x02,0x00,0x80,0x01,0x01,0x80,0x80,0xa0,0x01,0xc0,0x4a,
+0x83,0x01,0x00,0xc0,0xb2,0x00,0x80,0x00,0x1f,0x01,0x00,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x04,0x00,0x02,0x47,0x43,0x00,0x00,0x0e,0x69,0x6e,0x74,0x65,
+0x72,0x76,0x61,0x6c,0x5f,0x72,0x61,0x74,0x69,0x6f,0x00,0x00,0x0f,0x69,0x6e,0x74,
+0x65,0x72,0x76,0x61,0x6c,0x5f,0x72,0x61,0x74,0x69,0x6f,0x3d,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x00,0x00,0x3f,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x05,0x00,0x80,
+0x40,0x15,0x01,0x00,0x00,0x11,0x01,0x80,0x40,0x01,0x01,0x00,0x40,0xa0,0x01,0x00,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x02,0x47,0x43,0x00,0x00,
+0x0f,0x69,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x5f,0x72,0x61,0x74,0x69,0x6f,0x3d,
+0x00,0x00,0x00,0x00,0x69,0x00,0x02,0x00,0x05,0x00,0x00,0x00,0x0c,0x01,0x00,0x00,
+0x11,0x01,0x00,0x40,0x20,0x00,0x80,0x80,0x01,0x00,0x00,0x00,0x9e,0x01,0x40,0x4a,
+0x83,0x01,0x80,0x00,0x11,0x02,0x00,0x80,0x01,0x01,0x80,0x80,0xa0,0x01,0xc0,0x4a,
+0x83,0x01,0x00,0xc0,0xb2,0x00,0x80,0x00,0x1f,0x01,0x00,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x04,0x00,0x02,0x47,0x43,0x00,0x00,0x0a,0x73,0x74,0x65,0x70,
+0x5f,0x72,0x61,0x74,0x69,0x6f,0x00,0x00,0x0b,0x73,0x74,0x65,0x70,0x5f,0x72,0x61,
+0x74,0x69,0x6f,0x3d,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x3b,0x00,0x01,
+0x00,0x04,0x00,0x00,0x00,0x05,0x00,0x80,0x40,0x15,0x01,0x00,0x00,0x11,0x01,0x80,
+0x40,0x01,0x01,0x00,0x40,0xa0,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x02,0x00,0x02,0x47,0x43,0x00,0x00,0x0b,0x73,0x74,0x65,0x70,0x5f,0x72,0x61,
+0x74,0x69,0x6f,0x3d,0x00,0x00,0x00,0x00,0xa7,0x00,0x02,0x00,0x05,0x00,0x00,0x00,
+0x18,0x01,0x00,0x00,0x11,0x01,0x00,0x40,0x20,0x00,0x80,0x80,0x01,0x00,0x00,0x00,
+0x9e,0x01,0x00,0x00,0x08,0x01,0x80,0x00,0x11,0x02,0x00,0x80,0x01,0x01,0x80,0x80,
+0xa0,0x01,0x80,0x00,0x08,0x01,0x00,0xc0,0xb2,0x01,0x00,0x00,0x07,0x01,0x80,0x00,
+0x11,0x02,0x00,0x80,0x01,0x01,0x80,0x80,0xa0,0x01,0x80,0x00,0x07,0x01,0x00,0xc0,
+0xb2,0x01,0x00,0x00,0x07,0x01,0x80,0x00,0x11,0x02,0x00,0x80,0x01,0x01,0x80,0x80,
+0xa0,0x01,0x80,0x00,0x07,0x01,0x00,0xc0,0xb2,0x00,0x80,0x00,0x1f,0x01,0x00,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x02,0x47,0x43,0x00,0x00,0x11,
+0x67,0x65,0x6e,0x65,0x72,0x61,0x74,0x69,0x6f,0x6e,0x61,0x6c,0x5f,0x6d,0x6f,0x64,
+0x65,0x00,0x00,0x12,0x67,0x65,0x6e,0x65,0x72,0x61,0x74,0x69,0x6f,0x6e,0x61,0x6c,
+0x5f,0x6d,0x6f,0x64,0x65,0x3d,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x42,
+0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x05,0x00,0x80,0x40,0x15,0x01,0x00,0x00,0x11,
+0x01,0x80,0x40,0x01,0x01,0x00,0x40,0xa0,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x02,0x00,0x02,0x47,0x43,0x00,0x00,0x12,0x67,0x65,0x6e,0x65,0x72,
+0x61,0x74,0x69,0x6f,0x6e,0x61,0x6c,0x5f,0x6d,0x6f,0x64,0x65,0x3d,0x00,0x00,0x00,
+0x00,0x44,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x11,0x00,0x80,
+0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x48,0x61,0x73,0x68,0x00,0x00,0x05,0x63,
+0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x43,0x6c,0x61,0x73,
+0x73,0x00,0x00,0x00,0x00,0x4a,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,
+0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x48,0x61,0x73,0x68,
+0x00,0x00,0x0a,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x00,0x00,0x6d,
+0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x11,0x00,0x80,0x00,0x3d,0x01,0x00,0x00,0x3d,
+0x00,0x80,0x40,0xbf,0x01,0x00,0x00,0x3d,0x01,0x80,0x00,0x3d,0x01,0x00,0x80,0xbf,
+0x00,0x80,0x00,0xb2,0x00,0xc0,0x04,0x19,0x00,0x80,0x00,0x3d,0x01,0x00,0x00,0x3d,
+0x00,0x80,0x40,0xbf,0x01,0x00,0x00,0xbd,0x01,0x80,0x00,0xbd,0x01,0x00,0x80,0xbf,
+0x00,0x80,0x00,0xb2,0x00,0x80,0x40,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x02,
+0x10,0x00,0x03,0x61,0x62,0x63,0x10,0x00,0x03,0x63,0x62,0x61,0x00,0x00,0x00,0x02,
+0x00,0x02,0x3d,0x3d,0x00,0x00,0x01,0x21,0x00,0x00,0x00,0x00,0x48,0x00,0x02,0x00,
+0x04,0x00,0x00,0x00,0x09,0x01,0x00,0x00,0x3d,0x01,0x80,0x00,0x3d,0x00,0x80,0x80,
+0xbf,0x01,0x00,0x40,0x01,0x01,0x80,0x00,0x3d,0x01,0x00,0x00,0xa0,0x01,0x80,0x00,
+0x3d,0x01,0x00,0x40,0xb2,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x01,0x10,0x00,0x03,
+0x61,0x62,0x63,0x00,0x00,0x00,0x02,0x00,0x02,0x5b,0x5d,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x00,0x00,0x6f,0x00,0x02,0x00,0x06,0x00,0x00,0x00,0x0e,0x01,0x00,0x00,
+0x11,0x01,0x00,0x40,0x20,0x00,0x80,0x80,0x01,0x01,0x00,0x00,0x3d,0x01,0x80,0x40,
+0x01,0x02,0x00,0x00,0x3d,0x02,0x80,0x80,0x01,0x01,0x80,0x81,0x20,0x01,0x00,0x40,
+0x01,0x01,0x80,0x00,0x3d,0x01,0x00,0xc0,0xa0,0x01,0x80,0x00,0x3d,0x01,0x01,0x00,
+0xb2,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x01,0x10,0x00,0x03,0x61,0x62,0x63,0x00,
+0x00,0x00,0x05,0x00,0x04,0x48,0x61,0x73,0x68,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,
+0x00,0x03,0x5b,0x5d,0x3d,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,0x02,0x3d,0x3d,0x00,
+0x00,0x00,0x00,0x4b,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x09,0x01,0x00,0x00,0x3d,
+0x01,0x80,0x00,0x3d,0x00,0x80,0x80,0xbf,0x01,0x00,0x40,0x01,0x01,0x00,0x00,0x20,
+0x01,0x00,0x40,0x01,0x01,0x80,0xc0,0x3f,0x01,0x00,0x40,0xb2,0x01,0x00,0x00,0x29,
+0x00,0x00,0x00,0x01,0x10,0x00,0x03,0x61,0x62,0x63,0x00,0x00,0x00,0x02,0x00,0x05,
+0x63,0x6c,0x65,0x61,0x72,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0xb6,0x00,
+0x04,0x00,0x06,0x00,0x00,0x00,0x20,0x02,0x00,0x00,0x11,0x02,0x00,0x40,0x20,0x00,
+0x81,0x00,0x01,0x02,0x00,0x00,0x11,0x02,0x80,0x00,0x3d,0x02,0x00,0x40,0xa0,0x01,
+0x01,0x00,0x01,0x02,0x00,0x00,0x11,0x02,0x80,0x03,0x40,0x02,0x00,0x40,0x21,0x01,
+0x81,0x00,0x01,0x02,0x00,0x40,0x01,0x02,0x00,0x80,0x20,0x02,0x80,0x00,0x05,0x02,
+0x00,0xc0,0xb2,0x02,0x40,0x02,0x19,0x02,0x00,0x80,0x01,0x02,0x00,0x80,0x20,0x02,
+0x80,0x00,0x3d,0x02,0x00,0xc0,0xb2,0x02,0x40,0x02,0x19,0x02,0x00,0xc0,0x01,0x02,
+0x00,0x80,0x20,0x02,0x80,0x00,0x05,0x02,0x00,0xc0,0xb2,0x02,0x40,0x02,0x99,0x02,
+0x00,0xc0,0x01,0x02,0x80,0x00,0x3d,0x02,0x00,0x80,0xa0,0x02,0x80,0x00,0x3d,0x02,
+0x00,0xc0,0xb2,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x01,0x10,0x00,0x03,0x61,0x62,
+0x63,0x00,0x00,0x00,0x04,0x00,0x04,0x48,0x61,0x73,0x68,0x00,0x00,0x03,0x6e,0x65,
+0x77,0x00,0x00,0x07,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x00,0x00,0x36,0x00,0x04,0x00,0x08,0x00,0x00,0x00,0x07,0x04,0x00,0x00,
+0x26,0x02,0x00,0x80,0x01,0x02,0x80,0x40,0x01,0x03,0x00,0x80,0x01,0x03,0x81,0x00,
+0x01,0x02,0x80,0x01,0x20,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x01,0x00,0x03,0x5b,0x5d,0x3d,0x00,0x00,0x00,0x00,0x8c,0x00,0x02,0x00,0x05,0x00,
+0x00,0x00,0x13,0x01,0x00,0x00,0x3d,0x01,0x80,0x00,0x3d,0x00,0x80,0x80,0xbf,0x01,
+0x00,0x00,0xbd,0x01,0x80,0x40,0x01,0x02,0x00,0x80,0x01,0x01,0x80,0x00,0xa0,0x01,
+0x00,0x40,0x01,0x01,0x80,0x00,0x3d,0x01,0x00,0x40,0xa0,0x01,0x80,0x00,0x3d,0x01,
+0x00,0x80,0xb2,0x01,0x40,0x02,0x99,0x01,0x00,0x40,0x01,0x01,0x80,0x01,0x3d,0x01,
+0x00,0x40,0xa0,0x01,0x80,0x00,0xbd,0x01,0x00,0x80,0xb2,0x01,0x00,0x00,0x29,0x00,
+0x00,0x00,0x03,0x10,0x00,0x03,0x61,0x62,0x63,0x10,0x00,0x03,0x63,0x62,0x61,0x10,
+0x00,0x08,0x6e,0x6f,0x74,0x65,0x78,0x69,0x73,0x74,0x00,0x00,0x00,0x03,0x00,0x08,
+0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x3d,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x00,0x00,0x8c,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x12,0x01,
+0x80,0x00,0x11,0x01,0x80,0x40,0x20,0x00,0x80,0xc0,0x01,0x01,0x80,0x00,0x11,0x02,
+0x00,0x03,0x40,0x01,0x80,0x40,0x21,0x01,0x00,0xc0,0x01,0x01,0x80,0x40,0x01,0x01,
+0x80,0x80,0x20,0x02,0x00,0x00,0x05,0x01,0x80,0xc0,0xb2,0x01,0xc0,0x02,0x99,0x01,
+0x80,0x80,0x01,0x01,0x80,0x80,0x20,0x01,0x81,0x00,0x20,0x02,0x00,0x02,0x91,0x01,
+0x80,0xc0,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,
+0x04,0x48,0x61,0x73,0x68,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x0c,0x64,0x65,
+0x66,0x61,0x75,0x6c,0x74,0x5f,0x70,0x72,0x6f,0x63,0x00,0x00,0x02,0x3d,0x3d,0x00,
+0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x04,0x50,0x72,0x6f,0x63,0x00,0x00,
+0x00,0x00,0x36,0x00,0x04,0x00,0x08,0x00,0x00,0x00,0x07,0x04,0x00,0x00,0x26,0x02,
+0x00,0x80,0x01,0x02,0x80,0x40,0x01,0x03,0x00,0x80,0x01,0x03,0x81,0x00,0x01,0x02,
+0x80,0x01,0x20,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,
+0x03,0x5b,0x5d,0x3d,0x00,0x00,0x00,0x00,0xc9,0x00,0x05,0x00,0x08,0x00,0x00,0x00,
+0x23,0x02,0x80,0x00,0x3d,0x03,0x00,0x00,0x3d,0x00,0x81,0x40,0xbf,0x02,0x80,0x00,
+0x3d,0x03,0x00,0x00,0x3d,0x01,0x01,0x40,0xbf,0x01,0x80,0x00,0x08,0x02,0x00,0x00,
+0x08,0x02,0x80,0x40,0x01,0x03,0x00,0x00,0x3d,0x02,0x80,0x00,0xa0,0x02,0x80,0x80,
+0x01,0x03,0x00,0x00,0x3d,0x03,0x80,0x03,0x40,0x02,0x80,0x00,0xa1,0x02,0x80,0x80,
+0x01,0x03,0x00,0x00,0x3d,0x03,0x80,0x05,0x40,0x02,0x80,0x00,0xa1,0x02,0x80,0x40,
+0x01,0x03,0x00,0x00,0xbd,0x02,0x80,0x00,0xa0,0x03,0x00,0x00,0x05,0x02,0x80,0x40,
+0xb2,0x02,0xc0,0x02,0x19,0x02,0x80,0x40,0x01,0x03,0x00,0x00,0x3d,0x02,0x80,0x80,
+0xa0,0x02,0x80,0xc0,0x20,0x02,0xc0,0x01,0x19,0x02,0x80,0xc0,0x01,0x02,0x80,0xc0,
+0x20,0x02,0xc0,0x00,0x99,0x02,0x81,0x00,0x01,0x02,0x80,0x00,0x29,0x00,0x00,0x00,
+0x02,0x10,0x00,0x03,0x61,0x62,0x63,0x10,0x00,0x03,0x63,0x62,0x61,0x00,0x00,0x00,
+0x04,0x00,0x06,0x64,0x65,0x6c,0x65,0x74,0x65,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,
+0x08,0x68,0x61,0x73,0x5f,0x6b,0x65,0x79,0x3f,0x00,0x00,0x01,0x21,0x00,0x00,0x00,
+0x00,0x24,0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x04,0x02,0x00,0x00,0x26,0x01,0x80,
+0x00,0x07,0x01,0x80,0xc0,0x16,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x04,0x02,0x00,
+0x00,0x26,0x01,0x80,0x00,0x07,0x01,0x81,0x00,0x16,0x01,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x76,0x00,0x04,0x00,0x06,0x00,0x00,
+0x00,0x10,0x02,0x00,0x00,0x3d,0x02,0x80,0x00,0xbd,0x00,0x81,0x00,0xbf,0x01,0x00,
+0x00,0x05,0x01,0x80,0x00,0x05,0x02,0x00,0x40,0x01,0x02,0x80,0x03,0x40,0x02,0x00,
+0x00,0x21,0x02,0x00,0x80,0x01,0x02,0x80,0x00,0x3d,0x02,0x00,0x40,0xb2,0x02,0x40,
+0x01,0x99,0x02,0x00,0xc0,0x01,0x02,0x80,0x00,0xbd,0x02,0x00,0x40,0xb2,0x02,0x00,
+0x00,0x29,0x00,0x00,0x00,0x02,0x10,0x00,0x07,0x61,0x62,0x63,0x5f,0x6b,0x65,0x79,
+0x10,0x00,0x09,0x61,0x62,0x63,0x5f,0x76,0x61,0x6c,0x75,0x65,0x00,0x00,0x00,0x02,
+0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x24,
+0x00,0x04,0x00,0x05,0x00,0x00,0x00,0x04,0x04,0x00,0x00,0x26,0x00,0x80,0x80,0x16,
+0x01,0x00,0xc0,0x16,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x66,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x0b,0x01,0x80,0x00,0x3d,
+0x02,0x00,0x00,0xbd,0x00,0x80,0xc0,0xbf,0x01,0x00,0x00,0x05,0x01,0x80,0x40,0x01,
+0x02,0x00,0x03,0x40,0x01,0x80,0x00,0x21,0x01,0x80,0x80,0x01,0x02,0x00,0x00,0x3d,
+0x01,0x80,0x40,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x02,0x10,0x00,0x07,0x61,
+0x62,0x63,0x5f,0x6b,0x65,0x79,0x10,0x00,0x09,0x61,0x62,0x63,0x5f,0x76,0x61,0x6c,
+0x75,0x65,0x00,0x00,0x00,0x02,0x00,0x08,0x65,0x61,0x63,0x68,0x5f,0x6b,0x65,0x79,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x20,0x00,0x03,0x00,0x04,0x00,0x00,
+0x00,0x03,0x02,0x00,0x00,0x26,0x00,0x80,0x80,0x16,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x00,0x03,0x00,0x05,0x00,0x00,
+0x00,0x0b,0x01,0x80,0x00,0x3d,0x02,0x00,0x00,0xbd,0x00,0x80,0xc0,0xbf,0x01,0x00,
+0x00,0x05,0x01,0x80,0x40,0x01,0x02,0x00,0x03,0x40,0x01,0x80,0x00,0x21,0x01,0x80,
+0x80,0x01,0x02,0x00,0x00,0xbd,0x01,0x80,0x40,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,
+0x00,0x02,0x10,0x00,0x07,0x61,0x62,0x63,0x5f,0x6b,0x65,0x79,0x10,0x00,0x09,0x61,
+0x62,0x63,0x5f,0x76,0x61,0x6c,0x75,0x65,0x00,0x00,0x00,0x02,0x00,0x0a,0x65,0x61,
+0x63,0x68,0x5f,0x76,0x61,0x6c,0x75,0x65,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,
+0x00,0x20,0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x03,0x02,0x00,0x00,0x26,0x00,0x80,
+0x80,0x16,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x78,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x0d,0x01,0x80,0x00,0x3d,0x02,0x00,
+0x00,0xbd,0x00,0x80,0xc0,0xbf,0x01,0x80,0x00,0x11,0x01,0x80,0x40,0x20,0x01,0x00,
+0xc0,0x01,0x01,0x80,0x40,0x01,0x01,0x80,0x80,0x20,0x01,0x80,0xc0,0x20,0x01,0xc0,
+0x01,0x19,0x01,0x80,0x80,0x01,0x01,0x80,0x80,0x20,0x01,0x80,0x00,0x29,0x00,0x00,
+0x00,0x02,0x10,0x00,0x07,0x61,0x62,0x63,0x5f,0x6b,0x65,0x79,0x10,0x00,0x09,0x61,
+0x62,0x63,0x5f,0x76,0x61,0x6c,0x75,0x65,0x00,0x00,0x00,0x04,0x00,0x04,0x48,0x61,
+0x73,0x68,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x06,0x65,0x6d,0x70,0x74,0x79,
+0x3f,0x00,0x00,0x01,0x21,0x00,0x00,0x00,0x00,0x88,0x00,0x03,0x00,0x05,0x00,0x00,
+0x00,0x0f,0x01,0x80,0x00,0x3d,0x02,0x00,0x00,0xbd,0x00,0x80,0xc0,0xbf,0x01,0x80,
+0x00,0x11,0x01,0x80,0x40,0x20,0x01,0x00,0xc0,0x01,0x01,0x80,0x40,0x01,0x02,0x00,
+0x00,0x3d,0x01,0x80,0x80,0xa0,0x01,0xc0,0x02,0x19,0x01,0x80,0x80,0x01,0x02,0x00,
+0x01,0x3d,0x01,0x80,0x80,0xa0,0x01,0x80,0xc0,0x20,0x01,0x80,0x00,0x29,0x00,0x00,
+0x00,0x03,0x10,0x00,0x07,0x61,0x62,0x63,0x5f,0x6b,0x65,0x79,0x10,0x00,0x09,0x61,
+0x62,0x63,0x5f,0x76,0x61,0x6c,0x75,0x65,0x10,0x00,0x03,0x63,0x62,0x61,0x00,0x00,
+0x00,0x04,0x00,0x04,0x48,0x61,0x73,0x68,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,
+0x08,0x68,0x61,0x73,0x5f,0x6b,0x65,0x79,0x3f,0x00,0x00,0x01,0x21,0x00,0x00,0x00,
+0x00,0x8a,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x0f,0x01,0x80,0x00,0x3d,0x02,0x00,
+0x00,0xbd,0x00,0x80,0xc0,0xbf,0x01,0x80,0x00,0x11,0x01,0x80,0x40,0x20,0x01,0x00,
+0xc0,0x01,0x01,0x80,0x40,0x01,0x02,0x00,0x00,0xbd,0x01,0x80,0x80,0xa0,0x01,0xc0,
+0x02,0x19,0x01,0x80,0x80,0x01,0x02,0x00,0x01,0x3d,0x01,0x80,0x80,0xa0,0x01,0x80,
+0xc0,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x03,0x10,0x00,0x07,0x61,0x62,0x63,
+0x5f,0x6b,0x65,0x79,0x10,0x00,0x09,0x61,0x62,0x63,0x5f,0x76,0x61,0x6c,0x75,0x65,
+0x10,0x00,0x03,0x63,0x62,0x61,0x00,0x00,0x00,0x04,0x00,0x04,0x48,0x61,0x73,0x68,
+0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x0a,0x68,0x61,0x73,0x5f,0x76,0x61,0x6c,
+0x75,0x65,0x3f,0x00,0x00,0x01,0x21,0x00,0x00,0x00,0x00,0x88,0x00,0x03,0x00,0x05,
+0x00,0x00,0x00,0x0f,0x01,0x80,0x00,0x3d,0x02,0x00,0x00,0xbd,0x00,0x80,0xc0,0xbf,
+0x01,0x80,0x00,0x11,0x01,0x80,0x40,0x20,0x01,0x00,0xc0,0x01,0x01,0x80,0x40,0x01,
+0x02,0x00,0x00,0x3d,0x01,0x80,0x80,0xa0,0x01,0xc0,0x02,0x19,0x01,0x80,0x80,0x01,
+0x02,0x00,0x01,0x3d,0x01,0x80,0x80,0xa0,0x01,0x80,0xc0,0x20,0x01,0x80,0x00,0x29,
+0x00,0x00,0x00,0x03,0x10,0x00,0x07,0x61,0x62,0x63,0x5f,0x6b,0x65,0x79,0x10,0x00,
+0x09,0x61,0x62,0x63,0x5f,0x76,0x61,0x6c,0x75,0x65,0x10,0x00,0x03,0x63,0x62,0x61,
+0x00,0x00,0x00,0x04,0x00,0x04,0x48,0x61,0x73,0x68,0x00,0x00,0x03,0x6e,0x65,0x77,
+0x00,0x00,0x08,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x3f,0x00,0x00,0x01,0x21,0x00,
+0x00,0x00,0x00,0xb3,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x1b,0x01,0x80,0x00,0x11,
+0x01,0x80,0x40,0x20,0x00,0x80,0xc0,0x01,0x01,0x80,0x00,0x11,0x02,0x00,0x01,0x04,
+0x01,0x80,0x40,0xa0,0x01,0x00,0xc0,0x01,0x01,0x80,0x40,0x01,0x02,0x00,0x00,0x11,
+0x01,0x80,0xc0,0xa0,0x01,0xc0,0x01,0x99,0x01,0x80,0x40,0x01,0x02,0x01,0x00,0x3f,
+0x01,0x81,0x00,0xb2,0x01,0xc0,0x02,0x99,0x01,0x80,0x40,0x01,0x02,0x00,0x00,0x3d,
+0x01,0x81,0x40,0xa0,0x02,0x00,0x00,0x05,0x01,0x81,0x00,0xb2,0x01,0xc0,0x02,0x99,
+0x01,0x80,0x80,0x01,0x02,0x00,0x00,0x3d,0x01,0x81,0x40,0xa0,0x02,0x00,0x01,0x04,
+0x01,0x81,0x00,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x10,0x00,0x05,0x68,
+0x65,0x6c,0x6c,0x6f,0x00,0x00,0x00,0x06,0x00,0x04,0x48,0x61,0x73,0x68,0x00,0x00,
+0x03,0x6e,0x65,0x77,0x00,0x00,0x09,0x6e,0x6f,0x74,0x5f,0x66,0x6f,0x75,0x6e,0x64,
+0x00,0x00,0x05,0x69,0x73,0x5f,0x61,0x3f,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x02,
+0x5b,0x5d,0x00,0x00,0x00,0x00,0x86,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x0e,0x01,
+0x80,0x00,0x3d,0x02,0x00,0x00,0xbd,0x00,0x80,0xc0,0xbf,0x01,0x80,0x00,0x11,0x01,
+0x80,0x40,0x20,0x02,0x00,0x40,0x01,0x01,0x80,0x80,0xa0,0x01,0x00,0xc0,0x01,0x01,
+0x80,0x80,0x01,0x02,0x00,0x00,0x3d,0x02,0x80,0x00,0xbd,0x02,0x01,0x00,0xbf,0x01,
+0x80,0xc0,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x02,0x10,0x00,0x07,0x61,0x62,
+0x63,0x5f,0x6b,0x65,0x79,0x10,0x00,0x09,0x61,0x62,0x63,0x5f,0x76,0x61,0x6c,0x75,
+0x65,0x00,0x00,0x00,0x04,0x00,0x04,0x48,0x61,0x73,0x68,0x00,0x00,0x03,0x6e,0x65,
+0x77,0x00,0x00,0x0f,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x69,0x7a,0x65,0x5f,0x63,
+0x6f,0x70,0x79,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x84,0x00,0x03,0x00,
+0x05,0x00,0x00,0x00,0x0f,0x01,0x80,0x00,0x3d,0x02,0x00,0x00,0xbd,0x00,0x80,0xc0,
+0xbf,0x01,0x80,0x00,0x11,0x01,0x80,0x40,0x20,0x01,0x00,0xc0,0x01,0x01,0x80,0x40,
+0x01,0x02,0x00,0x00,0x3d,0x01,0x80,0x80,0xa0,0x01,0xc0,0x02,0x19,0x01,0x80,0x80,
+0x01,0x02,0x00,0x01,0x3d,0x01,0x80,0x80,0xa0,0x01,0x80,0xc0,0x20,0x01,0x80,0x00,
+0x29,0x00,0x00,0x00,0x03,0x10,0x00,0x07,0x61,0x62,0x63,0x5f,0x6b,0x65,0x79,0x10,
+0x00,0x09,0x61,0x62,0x63,0x5f,0x76,0x61,0x6c,0x75,0x65,0x10,0x00,0x03,0x63,0x62,
+0x61,0x00,0x00,0x00,0x04,0x00,0x04,0x48,0x61,0x73,0x68,0x00,0x00,0x03,0x6e,0x65,
+0x77,0x00,0x00,0x04,0x6b,0x65,0x79,0x3f,0x00,0x00,0x01,0x21,0x00,0x00,0x00,0x00,
+0x5a,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x09,0x01,0x00,0x00,0x3d,0x01,0x80,0x00,
+0xbd,0x00,0x80,0x80,0xbf,0x01,0x00,0x40,0x01,0x01,0x00,0x00,0x20,0x01,0x80,0x00,
+0x3d,0x01,0x80,0xc0,0xb7,0x01,0x00,0x40,0xb2,0x01,0x00,0x00,0x29,0x00,0x00,0x00,
+0x02,0x10,0x00,0x07,0x61,0x62,0x63,0x5f,0x6b,0x65,0x79,0x10,0x00,0x09,0x61,0x62,
+0x63,0x5f,0x76,0x61,0x6c,0x75,0x65,0x00,0x00,0x00,0x02,0x00,0x04,0x6b,0x65,0x79,
+0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x85,0x00,0x03,0x00,0x05,0x00,
+0x00,0x00,0x10,0x01,0x80,0x00,0x3d,0x02,0x00,0x00,0xbd,0x00,0x80,0xc0,0xbf,0x01,
+0x80,0x00,0x11,0x01,0x80,0x40,0x20,0x01,0x00,0xc0,0x01,0x01,0x80,0x40,0x01,0x01,
+0x80,0x80,0x20,0x02,0x40,0x00,0x03,0x01,0x80,0xc0,0xb2,0x01,0xc0,0x02,0x19,0x01,
+0x80,0x80,0x01,0x01,0x80,0x80,0x20,0x02,0x3f,0xff,0x83,0x01,0x80,0xc0,0xb2,0x01,
+0x80,0x00,0x29,0x00,0x00,0x00,0x02,0x10,0x00,0x07,0x61,0x62,0x63,0x5f,0x6b,0x65,
+0x79,0x10,0x00,0x09,0x61,0x62,0x63,0x5f,0x76,0x61,0x6c,0x75,0x65,0x00,0x00,0x00,
+0x04,0x00,0x04,0x48,0x61,0x73,0x68,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x06,
+0x6c,0x65,0x6e,0x67,0x74,0x68,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x87,
+0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x0f,0x01,0x80,0x00,0x3d,0x02,0x00,0x00,0xbd,
+0x00,0x80,0xc0,0xbf,0x01,0x80,0x00,0x11,0x01,0x80,0x40,0x20,0x01,0x00,0xc0,0x01,
+0x01,0x80,0x40,0x01,0x02,0x00,0x00,0x3d,0x01,0x80,0x80,0xa0,0x01,0xc0,0x02,0x19,
+0x01,0x80,0x80,0x01,0x02,0x00,0x01,0x3d,0x01,0x80,0x80,0xa0,0x01,0x80,0xc0,0x20,
+0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x03,0x10,0x00,0x07,0x61,0x62,0x63,0x5f,0x6b,
+0x65,0x79,0x10,0x00,0x09,0x61,0x62,0x63,0x5f,0x76,0x61,0x6c,0x75,0x65,0x10,0x00,
+0x03,0x63,0x62,0x61,0x00,0x00,0x00,0x04,0x00,0x04,0x48,0x61,0x73,0x68,0x00,0x00,
+0x03,0x6e,0x65,0x77,0x00,0x00,0x07,0x6d,0x65,0x6d,0x62,0x65,0x72,0x3f,0x00,0x00,
+0x01,0x21,0x00,0x00,0x00,0x01,0x05,0x00,0x05,0x00,0x0c,0x00,0x00,0x00,0x27,0x02,
+0x80,0x00,0x3d,0x03,0x00,0x00,0xbd,0x03,0x80,0x01,0x3d,0x04,0x00,0x01,0xbd,0x00,
+0x81,0x41,0x3f,0x02,0x80,0x01,0x3d,0x03,0x00,0x02,0x3d,0x03,0x80,0x02,0xbd,0x04,
+0x00,0x03,0x3d,0x01,0x01,0x41,0x3f,0x02,0x80,0x40,0x01,0x03,0x00,0x80,0x01,0x02,
+0x80,0x00,0xa0,0x01,0x81,0x40,0x01,0x02,0x80,0x40,0x01,0x03,0x00,0x80,0x01,0x03,
+0x80,0x03,0x40,0x02,0x80,0x00,0xa1,0x02,0x01,0x40,0x01,0x02,0x80,0xc0,0x01,0x03,
+0x00,0x00,0x3d,0x03,0x80,0x00,0xbd,0x04,0x00,0x01,0x3d,0x04,0x80,0x02,0x3d,0x05,
+0x00,0x02,0xbd,0x05,0x80,0x03,0x3d,0x03,0x01,0x81,0xbf,0x02,0x80,0x40,0xb2,0x02,
+0xc0,0x04,0x99,0x02,0x81,0x00,0x01,0x03,0x00,0x00,0x3d,0x03,0x80,0x00,0xbd,0x04,
+0x00,0x01,0x3d,0x04,0x80,0x01,0xbd,0x05,0x00,0x02,0xbd,0x05,0x80,0x03,0x3d,0x03,
+0x01,0x81,0xbf,0x02,0x80,0x40,0xb2,0x02,0x80,0x00,0x29,0x00,0x00,0x00,0x07,0x10,
+0x00,0x07,0x61,0x62,0x63,0x5f,0x6b,0x65,0x79,0x10,0x00,0x09,0x61,0x62,0x63,0x5f,
+0x76,0x61,0x6c,0x75,0x65,0x10,0x00,0x07,0x63,0x62,0x61,0x5f,0x6b,0x65,0x79,0x10,
+0x00,0x09,0x63,0x62,0x61,0x5f,0x76,0x61,0x6c,0x75,0x65,0x10,0x00,0x03,0x58,0x58,
+0x58,0x10,0x00,0x07,0x78,0x79,0x7a,0x5f,0x6b,0x65,0x79,0x10,0x00,0x09,0x78,0x79,
+0x7a,0x5f,0x76,0x61,0x6c,0x75,0x65,0x00,0x00,0x00,0x02,0x00,0x05,0x6d,0x65,0x72,
+0x67,0x65,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x1c,0x00,0x05,0x00,0x06,
+0x00,0x00,0x00,0x02,0x06,0x00,0x00,0x26,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x0e,
+0x01,0x80,0x00,0x3d,0x02,0x00,0x00,0xbd,0x00,0x80,0xc0,0xbf,0x01,0x80,0x00,0x11,
+0x01,0x80,0x40,0x20,0x02,0x00,0x40,0x01,0x01,0x80,0x80,0xa0,0x01,0x00,0xc0,0x01,
+0x01,0x80,0x80,0x01,0x02,0x00,0x00,0x3d,0x02,0x80,0x00,0xbd,0x02,0x01,0x00,0xbf,
+0x01,0x80,0xc0,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x02,0x10,0x00,0x07,0x61,
+0x62,0x63,0x5f,0x6b,0x65,0x79,0x10,0x00,0x09,0x61,0x62,0x63,0x5f,0x76,0x61,0x6c,
+0x75,0x65,0x00,0x00,0x00,0x04,0x00,0x04,0x48,0x61,0x73,0x68,0x00,0x00,0x03,0x6e,
+0x65,0x77,0x00,0x00,0x07,0x72,0x65,0x70,0x6c,0x61,0x63,0x65,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x00,0x00,0x9d,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x14,0x01,0x80,
+0x00,0x3d,0x02,0x00,0x00,0xbd,0x02,0x80,0x01,0x3d,0x03,0x00,0x01,0xbd,0x00,0x80,
+0xc1,0x3f,0x01,0x80,0x40,0x01,0x01,0x80,0x00,0x20,0x01,0x00,0xc0,0x01,0x01,0x80,
+0x40,0x01,0x02,0x00,0x00,0x3d,0x02,0x80,0x00,0xbd,0x02,0x01,0x00,0xbf,0x01,0x80,
+0x40,0xb2,0x01,0xc0,0x02,0x99,0x01,0x80,0x80,0x01,0x02,0x00,0x01,0x3d,0x02,0x80,
+0x01,0xbd,0x02,0x01,0x01,0x37,0x01,0x80,0x40,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,
+0x00,0x04,0x10,0x00,0x07,0x61,0x62,0x63,0x5f,0x6b,0x65,0x79,0x10,0x00,0x09,0x61,
+0x62,0x63,0x5f,0x76,0x61,0x6c,0x75,0x65,0x10,0x00,0x07,0x63,0x62,0x61,0x5f,0x6b,
+0x65,0x79,0x10,0x00,0x09,0x63,0x62,0x61,0x5f,0x76,0x61,0x6c,0x75,0x65,0x00,0x00,
+0x00,0x02,0x00,0x05,0x73,0x68,0x69,0x66,0x74,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,
+0x00,0x00,0x83,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x10,0x01,0x80,0x00,0x3d,0x02,
+0x00,0x00,0xbd,0x00,0x80,0xc0,0xbf,0x01,0x80,0x00,0x11,0x01,0x80,0x40,0x20,0x01,
+0x00,0xc0,0x01,0x01,0x80,0x40,0x01,0x01,0x80,0x80,0x20,0x02,0x40,0x00,0x03,0x01,
+0x80,0xc0,0xb2,0x01,0xc0,0x02,0x19,0x01,0x80,0x80,0x01,0x01,0x80,0x80,0x20,0x02,
+0x3f,0xff,0x83,0x01,0x80,0xc0,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x02,0x10,
+0x00,0x07,0x61,0x62,0x63,0x5f,0x6b,0x65,0x79,0x10,0x00,0x09,0x61,0x62,0x63,0x5f,
+0x76,0x61,0x6c,0x75,0x65,0x00,0x00,0x00,0x04,0x00,0x04,0x48,0x61,0x73,0x68,0x00,
+0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x04,0x73,0x69,0x7a,0x65,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x00,0x00,0x6d,0x00,0x02,0x00,0x05,0x00,0x00,0x00,0x0d,0x01,0x00,
+0x00,0x11,0x01,0x00,0x40,0x20,0x00,0x80,0x80,0x01,0x01,0x00,0x40,0x01,0x01,0x80,
+0x00,0x3d,0x02,0x00,0x00,0x3d,0x01,0x00,0x81,0x20,0x01,0x00,0x40,0x01,0x01,0x80,
+0x00,0x3d,0x01,0x00,0xc0,0xa0,0x01,0x80,0x00,0x3d,0x01,0x01,0x00,0xb2,0x01,0x00,
+0x00,0x29,0x00,0x00,0x00,0x01,0x10,0x00,0x03,0x61,0x62,0x63,0x00,0x00,0x00,0x05,
+0x00,0x04,0x48,0x61,0x73,0x68,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x05,0x73,
+0x74,0x6f,0x72,0x65,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,
+0x00,0x00,0x86,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x0f,0x01,0x80,0x00,0x3d,0x02,
+0x00,0x00,0xbd,0x00,0x80,0xc0,0xbf,0x01,0x80,0x00,0x11,0x01,0x80,0x40,0x20,0x01,
+0x00,0xc0,0x01,0x01,0x80,0x40,0x01,0x02,0x00,0x00,0xbd,0x01,0x80,0x80,0xa0,0x01,
+0xc0,0x02,0x19,0x01,0x80,0x80,0x01,0x02,0x00,0x01,0x3d,0x01,0x80,0x80,0xa0,0x01,
+0x80,0xc0,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x03,0x10,0x00,0x07,0x61,0x62,
+0x63,0x5f,0x6b,0x65,0x79,0x10,0x00,0x09,0x61,0x62,0x63,0x5f,0x76,0x61,0x6c,0x75,
+0x65,0x10,0x00,0x03,0x63,0x62,0x61,0x00,0x00,0x00,0x04,0x00,0x04,0x48,0x61,0x73,
+0x68,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x06,0x76,0x61,0x6c,0x75,0x65,0x3f,
+0x00,0x00,0x01,0x21,0x00,0x00,0x00,0x00,0x5c,0x00,0x02,0x00,0x04,0x00,0x00,0x00,
+0x09,0x01,0x00,0x00,0x3d,0x01,0x80,0x00,0xbd,0x00,0x80,0x80,0xbf,0x01,0x00,0x40,
+0x01,0x01,0x00,0x00,0x20,0x01,0x80,0x00,0xbd,0x01,0x80,0xc0,0xb7,0x01,0x00,0x40,
+0xb2,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x02,0x10,0x00,0x07,0x61,0x62,0x63,0x5f,
+0x6b,0x65,0x79,0x10,0x00,0x09,0x61,0x62,0x63,0x5f,0x76,0x61,0x6c,0x75,0x65,0x00,
+0x00,0x00,0x02,0x00,0x06,0x76,0x61,0x6c,0x75,0x65,0x73,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x00,0x00,0xc1,0x00,0x03,0x00,0x0c,0x00,0x00,0x00,0x21,0x01,0x80,0x00,
+0x04,0x02,0x40,0x00,0x03,0x02,0x80,0x00,0x84,0x03,0x40,0x00,0x83,0x03,0x80,0x01,
+0x04,0x04,0x40,0x01,0x03,0x04,0x80,0x01,0x84,0x05,0x40,0x01,0x83,0x00,0x80,0xc2,
+0x3f,0x01,0x80,0x40,0x01,0x02,0x00,0x03,0x40,0x01,0x81,0x00,0x21,0x01,0x00,0xc0,
+0x01,0x01,0x80,0x80,0x01,0x02,0x00,0x00,0x04,0x02,0xc0,0x00,0x03,0x03,0x00,0x01,
+0x04,0x03,0xc0,0x01,0x03,0x02,0x01,0x01,0x3f,0x01,0x81,0x40,0xb2,0x01,0xc0,0x05,
+0x99,0x01,0x80,0x40,0x01,0x02,0x00,0x00,0x04,0x02,0xc0,0x00,0x03,0x03,0x00,0x00,
+0x84,0x03,0xc0,0x00,0x83,0x04,0x00,0x01,0x04,0x04,0xc0,0x01,0x03,0x05,0x00,0x01,
+0x84,0x05,0xc0,0x01,0x83,0x02,0x01,0x02,0x3f,0x01,0x81,0x40,0xb2,0x01,0x80,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x03,0x6f,0x6e,0x65,0x00,0x00,
+0x03,0x74,0x77,0x6f,0x00,0x00,0x05,0x74,0x68,0x72,0x65,0x65,0x00,0x00,0x04,0x66,
+0x6f,0x75,0x72,0x00,0x00,0x06,0x72,0x65,0x6a,0x65,0x63,0x74,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x00,0x00,0x39,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x07,0x04,0x00,
+0x00,0x26,0x02,0x00,0x80,0x01,0x02,0xc0,0x00,0x83,0x02,0x00,0x00,0xa0,0x02,0xbf,
+0xff,0x83,0x02,0x00,0x40,0xb2,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x02,0x00,0x01,0x25,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0xb2,0x00,
+0x03,0x00,0x0b,0x00,0x00,0x00,0x1d,0x01,0x80,0x00,0x04,0x02,0x40,0x00,0x03,0x02,
+0x80,0x00,0x84,0x03,0x40,0x00,0x83,0x03,0x80,0x01,0x04,0x04,0x40,0x01,0x03,0x04,
+0x80,0x01,0x84,0x05,0x40,0x01,0x83,0x00,0x80,0xc2,0x3f,0x01,0x80,0x40,0x01,0x02,
+0x00,0x03,0x40,0x01,0x81,0x00,0x21,0x01,0x00,0xc0,0x01,0x01,0x80,0x80,0x01,0x02,
+0x00,0x00,0x04,0x02,0xc0,0x00,0x03,0x03,0x00,0x01,0x04,0x03,0xc0,0x01,0x03,0x02,
+0x01,0x01,0x3f,0x01,0x81,0x40,0xb2,0x01,0xc0,0x03,0x99,0x01,0x80,0x40,0x01,0x02,
+0x00,0x00,0x04,0x02,0xc0,0x00,0x03,0x03,0x00,0x01,0x04,0x03,0xc0,0x01,0x03,0x02,
+0x01,0x01,0x3f,0x01,0x81,0x40,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x06,0x00,0x03,0x6f,0x6e,0x65,0x00,0x00,0x03,0x74,0x77,0x6f,0x00,0x00,
+0x05,0x74,0x68,0x72,0x65,0x65,0x00,0x00,0x04,0x66,0x6f,0x75,0x72,0x00,0x00,0x07,
+0x72,0x65,0x6a,0x65,0x63,0x74,0x21,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,
+0x39,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x07,0x04,0x00,0x00,0x26,0x02,0x00,0x80,
+0x01,0x02,0xc0,0x00,0x83,0x02,0x00,0x00,0xa0,0x02,0xbf,0xff,0x83,0x02,0x00,0x40,
+0xb2,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x25,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0xc1,0x00,0x03,0x00,0x0c,0x00,0x00,
+0x00,0x21,0x01,0x80,0x00,0x04,0x02,0x40,0x00,0x03,0x02,0x80,0x00,0x84,0x03,0x40,
+0x00,0x83,0x03,0x80,0x01,0x04,0x04,0x40,0x01,0x03,0x04,0x80,0x01,0x84,0x05,0x40,
+0x01,0x83,0x00,0x80,0xc2,0x3f,0x01,0x80,0x40,0x01,0x02,0x00,0x03,0x40,0x01,0x81,
+0x00,0x21,0x01,0x00,0xc0,0x01,0x01,0x80,0x80,0x01,0x02,0x00,0x00,0x84,0x02,0xc0,
+0x00,0x83,0x03,0x00,0x01,0x84,0x03,0xc0,0x01,0x83,0x02,0x01,0x01,0x3f,0x01,0x81,
+0x40,0xb2,0x01,0xc0,0x05,0x99,0x01,0x80,0x40,0x01,0x02,0x00,0x00,0x04,0x02,0xc0,
+0x00,0x03,0x03,0x00,0x00,0x84,0x03,0xc0,0x00,0x83,0x04,0x00,0x01,0x04,0x04,0xc0,
+0x01,0x03,0x05,0x00,0x01,0x84,0x05,0xc0,0x01,0x83,0x02,0x01,0x02,0x3f,0x01,0x81,
+0x40,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x03,
+0x6f,0x6e,0x65,0x00,0x00,0x03,0x74,0x77,0x6f,0x00,0x00,0x05,0x74,0x68,0x72,0x65,
+0x65,0x00,0x00,0x04,0x66,0x6f,0x75,0x72,0x00,0x00,0x06,0x73,0x65,0x6c,0x65,0x63,
+0x74,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x39,0x00,0x04,0x00,0x06,0x00,
+0x00,0x00,0x07,0x04,0x00,0x00,0x26,0x02,0x00,0x80,0x01,0x02,0xc0,0x00,0x83,0x02,
+0x00,0x00,0xa0,0x02,0xbf,0xff,0x83,0x02,0x00,0x40,0xb2,0x02,0x00,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x25,0x00,0x00,0x02,0x3d,0x3d,0x00,
+0x00,0x00,0x00,0xb2,0x00,0x03,0x00,0x0b,0x00,0x00,0x00,0x1d,0x01,0x80,0x00,0x04,
+0x02,0x40,0x00,0x03,0x02,0x80,0x00,0x84,0x03,0x40,0x00,0x83,0x03,0x80,0x01,0x04,
+0x04,0x40,0x01,0x03,0x04,0x80,0x01,0x84,0x05,0x40,0x01,0x83,0x00,0x80,0xc2,0x3f,
+0x01,0x80,0x40,0x01,0x02,0x00,0x03,0x40,0x01,0x81,0x00,0x21,0x01,0x00,0xc0,0x01,
+0x01,0x80,0x80,0x01,0x02,0x00,0x00,0x84,0x02,0xc0,0x00,0x83,0x03,0x00,0x01,0x84,
+0x03,0xc0,0x01,0x83,0x02,0x01,0x01,0x3f,0x01,0x81,0x40,0xb2,0x01,0xc0,0x03,0x99,
+0x01,0x80,0x40,0x01,0x02,0x00,0x00,0x84,0x02,0xc0,0x00,0x83,0x03,0x00,0x01,0x84,
+0x03,0xc0,0x01,0x83,0x02,0x01,0x01,0x3f,0x01,0x81,0x40,0xb2,0x01,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x03,0x6f,0x6e,0x65,0x00,0x00,0x03,
+0x74,0x77,0x6f,0x00,0x00,0x05,0x74,0x68,0x72,0x65,0x65,0x00,0x00,0x04,0x66,0x6f,
+0x75,0x72,0x00,0x00,0x07,0x73,0x65,0x6c,0x65,0x63,0x74,0x21,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x00,0x00,0x39,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x07,0x04,0x00,
+0x00,0x26,0x02,0x00,0x80,0x01,0x02,0xc0,0x00,0x83,0x02,0x00,0x00,0xa0,0x02,0xbf,
+0xff,0x83,0x02,0x00,0x40,0xb2,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x02,0x00,0x01,0x25,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x4a,0x00,
+0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,
+0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x04,0x00,0x0a,0x49,0x6e,0x64,0x65,0x78,0x45,0x72,0x72,0x6f,0x72,0x00,
+0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x43,
+0x6c,0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x57,0x00,0x01,0x00,0x03,0x00,0x00,0x00,
+0x05,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,
+0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x0a,0x49,
+0x6e,0x64,0x65,0x78,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x0a,0x73,0x75,0x70,0x65,
+0x72,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x0d,0x53,0x74,
+0x61,0x6e,0x64,0x61,0x72,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,0x00,0x47,
+0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,
+0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x04,0x00,0x07,0x49,0x6e,0x74,0x65,0x67,0x65,0x72,0x00,0x00,0x05,
+0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x43,0x6c,0x61,
+0x73,0x73,0x00,0x00,0x00,0x00,0x4e,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,
+0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x07,0x49,0x6e,0x74,
+0x65,0x67,0x65,0x72,0x00,0x00,0x0a,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,0x73,
+0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x07,0x4e,0x75,0x6d,0x65,0x72,0x69,0x63,
+0x00,0x00,0x00,0x00,0x8b,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x0f,0x01,0xc0,0x00,
+0x03,0x01,0x80,0x00,0xad,0x00,0x80,0xc0,0x01,0x01,0xc0,0x00,0x03,0x02,0x00,0x00,
+0x02,0x01,0x80,0x00,0xac,0x01,0x00,0xc0,0x01,0x01,0x80,0x40,0x01,0x02,0x40,0x00,
+0x83,0x01,0x80,0x40,0xb2,0x01,0xc0,0x01,0x99,0x01,0x80,0x80,0x01,0x02,0x00,0x00,
+0x82,0x01,0x80,0x40,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x02,0x06,0x00,0x16,
+0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x65,0x2b,0x30,0x30,0x06,0x00,0x16,0x32,0x2e,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x00,
+0x00,0x00,0x02,0x00,0x01,0x2b,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x72,
+0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x0f,0x01,0xc0,0x00,0x83,0x01,0x80,0x00,0xaf,
+0x00,0x80,0xc0,0x01,0x01,0xc0,0x00,0x83,0x02,0x00,0x00,0x02,0x01,0x80,0x00,0xae,
+0x01,0x00,0xc0,0x01,0x01,0x80,0x40,0x01,0x02,0x40,0x00,0x03,0x01,0x80,0x40,0xb2,
+0x01,0xc0,0x01,0x99,0x01,0x80,0x80,0x01,0x02,0x00,0x00,0x02,0x01,0x80,0x40,0xb2,
+0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x06,0x00,0x16,0x31,0x2e,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,
+0x30,0x00,0x00,0x00,0x02,0x00,0x01,0x2d,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,
+0x00,0x76,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x10,0x01,0xc0,0x00,0x03,0x02,0x40,
+0x00,0x03,0x01,0x80,0x00,0xb0,0x00,0x80,0xc0,0x01,0x01,0xc0,0x00,0x03,0x02,0x00,
+0x00,0x02,0x01,0x80,0x00,0xb0,0x01,0x00,0xc0,0x01,0x01,0x80,0x40,0x01,0x02,0x40,
+0x00,0x03,0x01,0x80,0x40,0xb2,0x01,0xc0,0x01,0x99,0x01,0x80,0x80,0x01,0x02,0x00,
+0x00,0x02,0x01,0x80,0x40,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x06,0x00,
+0x16,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x00,0x00,0x00,0x02,0x00,0x01,0x2a,0x00,0x00,
+0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x8f,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x10,
+0x01,0xc0,0x00,0x83,0x02,0x40,0x00,0x03,0x01,0x80,0x00,0xb1,0x00,0x80,0xc0,0x01,
+0x01,0xc0,0x00,0x83,0x02,0x00,0x00,0x02,0x01,0x80,0x00,0xb1,0x01,0x00,0xc0,0x01,
+0x01,0x80,0x40,0x01,0x02,0x40,0x00,0x83,0x01,0x80,0x40,0xb2,0x01,0xc0,0x01,0x99,
+0x01,0x80,0x80,0x01,0x02,0x00,0x00,0x82,0x01,0x80,0x40,0xb2,0x01,0x80,0x00,0x29,
+0x00,0x00,0x00,0x02,0x06,0x00,0x16,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x06,0x00,0x16,
+0x32,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x65,0x2b,0x30,0x30,0x00,0x00,0x00,0x02,0x00,0x01,0x2f,0x00,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x00,0x00,0xaf,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x18,0x02,
+0x40,0x00,0x03,0x02,0xc0,0x00,0x03,0x02,0x00,0x00,0xa0,0x00,0x81,0x00,0x01,0x02,
+0x40,0x00,0x03,0x02,0x80,0x00,0x02,0x02,0x00,0x00,0xa0,0x01,0x01,0x00,0x01,0x02,
+0x40,0x00,0x83,0x02,0xc0,0x01,0x83,0x02,0x00,0x00,0xa0,0x01,0x81,0x00,0x01,0x02,
+0x00,0x40,0x01,0x02,0xbf,0xff,0x83,0x02,0x00,0x40,0xb2,0x02,0x40,0x01,0x99,0x02,
+0x00,0x80,0x01,0x02,0x80,0x00,0x82,0x02,0x00,0x40,0xb2,0x02,0x40,0x01,0x99,0x02,
+0x00,0xc0,0x01,0x02,0xc0,0x00,0x83,0x02,0x00,0x40,0xb2,0x02,0x00,0x00,0x29,0x00,
+0x00,0x00,0x02,0x06,0x00,0x16,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x06,0x00,0x16,0x30,
+0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x65,0x2b,0x30,0x30,0x00,0x00,0x00,0x02,0x00,0x01,0x25,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x00,0x00,0x7f,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x18,0x02,0x40,
+0x00,0x03,0x02,0xbf,0xff,0x83,0x02,0x00,0x00,0xa0,0x00,0x81,0x00,0x01,0x02,0x40,
+0x00,0x03,0x02,0xc0,0x00,0x03,0x02,0x00,0x00,0xa0,0x01,0x01,0x00,0x01,0x02,0x40,
+0x00,0x03,0x02,0xc0,0x00,0x83,0x02,0x00,0x00,0xa0,0x01,0x81,0x00,0x01,0x02,0x00,
+0x40,0x01,0x02,0xc0,0x00,0x03,0x02,0x00,0x40,0xb2,0x02,0x40,0x01,0x99,0x02,0x00,
+0x80,0x01,0x02,0xbf,0xff,0x83,0x02,0x00,0x40,0xb2,0x02,0x40,0x01,0x99,0x02,0x00,
+0xc0,0x01,0x02,0xbf,0xff,0x03,0x02,0x00,0x40,0xb2,0x02,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x03,0x3c,0x3d,0x3e,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x00,0x00,0x59,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x10,0x01,0xc0,0x00,
+0x03,0x02,0x3f,0xff,0x83,0x01,0x80,0x00,0xb2,0x00,0x80,0xc0,0x01,0x01,0xc0,0x00,
+0x03,0x02,0x40,0x00,0x03,0x01,0x80,0x00,0xb2,0x01,0x00,0xc0,0x01,0x01,0x80,0x40,
+0x01,0x02,0x00,0x00,0x08,0x01,0x80,0x00,0xb2,0x01,0xc0,0x01,0x99,0x01,0x80,0x80,
+0x01,0x02,0x00,0x00,0x07,0x01,0x80,0x00,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x45,0x00,0x01,
+0x00,0x03,0x00,0x00,0x00,0x0a,0x00,0xbf,0xff,0x83,0x00,0x80,0x00,0x20,0x01,0x3f,
+0xff,0x03,0x00,0x80,0x40,0xb2,0x00,0xc0,0x02,0x19,0x00,0xc0,0x00,0x83,0x00,0x80,
+0x00,0x20,0x01,0x3f,0xfe,0x03,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x7e,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,
+0x00,0x00,0x35,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x06,0x00,0xc0,0x02,0x03,0x01,
+0x40,0x01,0x03,0x00,0x80,0x00,0xa0,0x01,0x40,0x00,0x03,0x00,0x80,0x40,0xb2,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x26,0x00,0x00,
+0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x35,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x06,
+0x00,0xc0,0x02,0x03,0x01,0x40,0x01,0x03,0x00,0x80,0x00,0xa0,0x01,0x40,0x03,0x03,
+0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
+0x00,0x01,0x7c,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x35,0x00,0x01,0x00,
+0x03,0x00,0x00,0x00,0x06,0x00,0xc0,0x02,0x03,0x01,0x40,0x01,0x03,0x00,0x80,0x00,
+0xa0,0x01,0x40,0x02,0x83,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x5e,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,
+0x00,0x36,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x06,0x00,0xc0,0x0b,0x03,0x01,0x40,
+0x00,0x03,0x00,0x80,0x00,0xa0,0x01,0x40,0x16,0x83,0x00,0x80,0x40,0xb2,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x02,0x3c,0x3c,0x00,0x00,
+0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x36,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x06,
+0x00,0xc0,0x16,0x83,0x01,0x40,0x00,0x03,0x00,0x80,0x00,0xa0,0x01,0x40,0x0b,0x03,
+0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
+0x00,0x02,0x3e,0x3e,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x34,0x00,0x01,
+0x00,0x03,0x00,0x00,0x00,0x05,0x00,0xc0,0x04,0x83,0x00,0x80,0x00,0x20,0x01,0x40,
+0x04,0x83,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x02,0x00,0x04,0x63,0x65,0x69,0x6c,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,
+0x00,0x46,0x00,0x02,0x00,0x05,0x00,0x00,0x00,0x09,0x00,0xbf,0xff,0x83,0x01,0x40,
+0x01,0x03,0x01,0xc0,0x00,0x03,0x02,0x00,0x03,0x40,0x01,0x00,0x00,0xa1,0x01,0x00,
+0x40,0x01,0x01,0xc0,0x02,0x83,0x01,0x00,0x40,0xb2,0x01,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x06,0x64,0x6f,0x77,0x6e,0x74,0x6f,0x00,0x00,
+0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x30,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x06,
+0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x15,0x02,0x00,0x40,0x01,0x01,0x80,0x00,0xac,
+0x01,0x80,0x40,0x16,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0x80,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x18,
+0x02,0x40,0x00,0x03,0x02,0xc0,0x00,0x03,0x02,0x00,0x00,0xa0,0x00,0x81,0x00,0x01,
+0x02,0x40,0x00,0x03,0x02,0xc0,0x00,0x83,0x02,0x00,0x00,0xa0,0x01,0x01,0x00,0x01,
+0x02,0x40,0x00,0x03,0x02,0x80,0x00,0x05,0x02,0x00,0x00,0xa0,0x01,0x81,0x00,0x01,
+0x02,0x00,0x40,0x01,0x02,0x80,0x00,0x07,0x02,0x00,0x40,0xb2,0x02,0x40,0x01,0x99,
+0x02,0x00,0x80,0x01,0x02,0x80,0x00,0x08,0x02,0x00,0x40,0xb2,0x02,0x40,0x01,0x99,
+0x02,0x00,0xc0,0x01,0x02,0x80,0x00,0x08,0x02,0x00,0x40,0xb2,0x02,0x00,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x65,0x71,0x6c,0x3f,0x00,0x00,
+0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x3d,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x07,
+0x01,0x40,0x00,0x03,0x01,0x00,0x00,0x20,0x00,0x80,0x80,0x01,0x01,0x00,0x40,0x01,
+0x01,0xc0,0x00,0x03,0x01,0x00,0x40,0xb2,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x02,0x00,0x05,0x66,0x6c,0x6f,0x6f,0x72,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x00,0x00,0x34,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0xc0,0x00,
+0x03,0x00,0x80,0x00,0x20,0x01,0x40,0x00,0x83,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x6e,0x65,0x78,0x74,0x00,
+0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x35,0x00,0x01,0x00,0x03,0x00,0x00,0x00,
+0x05,0x00,0xc0,0x00,0x03,0x00,0x80,0x00,0x20,0x01,0x40,0x00,0x03,0x00,0x80,0x40,
+0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x05,0x72,
+0x6f,0x75,0x6e,0x64,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x34,0x00,0x01,
+0x00,0x03,0x00,0x00,0x00,0x05,0x00,0xc0,0x00,0x03,0x00,0x80,0x00,0x20,0x01,0x40,
+0x00,0x83,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x02,0x00,0x04,0x73,0x75,0x63,0x63,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,
+0x00,0x41,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x08,0x00,0xbf,0xff,0x83,0x01,0x40,
+0x01,0x03,0x01,0x80,0x03,0x40,0x01,0x00,0x00,0x21,0x01,0x00,0x40,0x01,0x01,0xc0,
+0x01,0x03,0x01,0x00,0x40,0xb2,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x02,0x00,0x05,0x74,0x69,0x6d,0x65,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,
+0x00,0x00,0x28,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x04,0x00,0x80,0x40,0x15,0x00,
+0x80,0x00,0xad,0x00,0x80,0x40,0x16,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x01,0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0x4d,0x00,0x01,0x00,0x03,0x00,
+0x00,0x00,0x05,0x00,0xc0,0x00,0x03,0x00,0x80,0x00,0x20,0x01,0x00,0x00,0x02,0x00,
+0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x06,0x00,0x16,0x31,0x2e,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x65,0x2b,0x30,0x30,0x00,0x00,0x00,0x02,0x00,0x04,0x74,0x6f,0x5f,0x66,0x00,0x00,
+0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x34,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,
+0x00,0xc0,0x00,0x03,0x00,0x80,0x00,0x20,0x01,0x40,0x00,0x03,0x00,0x80,0x40,0xb2,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x74,0x6f,
+0x5f,0x69,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x51,0x00,0x01,0x00,0x03,
+0x00,0x00,0x00,0x0a,0x00,0xc0,0x00,0x03,0x00,0x80,0x00,0x20,0x01,0x00,0x00,0x3d,
+0x00,0x80,0x40,0xb2,0x00,0xc0,0x02,0x19,0x00,0xbf,0xff,0x03,0x00,0x80,0x00,0x20,
+0x01,0x00,0x00,0xbd,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x02,
+0x10,0x00,0x01,0x31,0x10,0x00,0x02,0x2d,0x31,0x00,0x00,0x00,0x02,0x00,0x04,0x74,
+0x6f,0x5f,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x38,0x00,0x01,0x00,
+0x03,0x00,0x00,0x00,0x05,0x00,0xc0,0x00,0x03,0x00,0x80,0x00,0x20,0x01,0x40,0x00,
+0x03,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x02,0x00,0x08,0x74,0x72,0x75,0x6e,0x63,0x61,0x74,0x65,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x00,0x00,0x44,0x00,0x02,0x00,0x05,0x00,0x00,0x00,0x09,0x00,0xbf,0xff,
+0x83,0x01,0x40,0x00,0x03,0x01,0xc0,0x01,0x03,0x02,0x00,0x03,0x40,0x01,0x00,0x00,
+0xa1,0x01,0x00,0x40,0x01,0x01,0xc0,0x02,0x83,0x01,0x00,0x40,0xb2,0x01,0x00,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x75,0x70,0x74,0x6f,0x00,
+0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x30,0x00,0x03,0x00,0x05,0x00,0x00,0x00,
+0x06,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x15,0x02,0x00,0x40,0x01,0x01,0x80,0x00,
+0xac,0x01,0x80,0x40,0x16,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x01,0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0x84,0x00,0x03,0x00,0x07,0x00,0x00,0x00,
+0x19,0x00,0x80,0xc0,0x37,0x01,0x00,0xc0,0x37,0x01,0xc0,0x00,0x03,0x02,0x40,0x01,
+0x03,0x02,0x80,0x03,0x40,0x01,0x80,0x00,0xa1,0x01,0xc0,0x00,0x03,0x02,0x40,0x02,
+0x83,0x02,0xc0,0x00,0x83,0x03,0x00,0x05,0x40,0x01,0x80,0x01,0x21,0x01,0x80,0x40,
+0x01,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,0x83,0x03,0x40,0x01,0x03,0x02,0x01,0x01,
+0xb7,0x01,0x80,0x40,0xb2,0x01,0xc0,0x03,0x19,0x01,0x80,0x80,0x01,0x02,0x40,0x00,
+0x03,0x02,0xc0,0x01,0x03,0x03,0x40,0x02,0x03,0x02,0x01,0x01,0xb7,0x01,0x80,0x40,
+0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x73,
+0x74,0x65,0x70,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x2d,0x00,0x03,0x00,
+0x05,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x15,0x02,0x00,0x40,
+0x01,0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x01,0x00,0x02,0x3c,0x3c,0x00,0x00,0x00,0x00,0x2d,0x00,0x03,0x00,0x05,0x00,0x00,
+0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x80,0x15,0x02,0x00,0x40,0x01,0x01,0x80,
+0x00,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,
+0x3c,0x3c,0x00,0x00,0x00,0x00,0x47,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,
+0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x06,0x4b,0x65,0x72,
+0x6e,0x65,0x6c,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x06,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x00,0x00,0x00,0x00,0xb1,0x00,0x01,
+0x00,0x03,0x00,0x00,0x00,0x19,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,
+0x00,0x46,0x00,0x80,0x00,0x91,0x00,0x80,0x80,0x20,0x01,0x00,0x00,0x08,0x00,0x80,
+0xc0,0xb2,0x00,0xc0,0x02,0x19,0x00,0x80,0x00,0x06,0x00,0x80,0x00,0x20,0x01,0x00,
+0x00,0x3d,0x00,0x80,0xc0,0xb2,0x00,0xc0,0x02,0x99,0x00,0x80,0x00,0x06,0x01,0x00,
+0x05,0x40,0x00,0x80,0x00,0x21,0x01,0x00,0x00,0xbd,0x00,0x80,0xc0,0xb2,0x00,0xc0,
+0x02,0x99,0x00,0x80,0x00,0x06,0x01,0x00,0x07,0x40,0x00,0x80,0x00,0x21,0x01,0x00,
+0x00,0xbd,0x00,0x80,0xc0,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x02,0x10,0x00,
+0x08,0x6e,0x6f,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x10,0x00,0x05,0x62,0x6c,0x6f,0x63,
+0x6b,0x00,0x00,0x00,0x04,0x00,0x06,0x62,0x67,0x5f,0x74,0x72,0x79,0x00,0x00,0x06,
+0x4b,0x65,0x72,0x6e,0x65,0x6c,0x00,0x00,0x0c,0x62,0x6c,0x6f,0x63,0x6b,0x5f,0x67,
+0x69,0x76,0x65,0x6e,0x3f,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x62,0x00,
+0x02,0x00,0x03,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0xa6,0x01,0x00,0x00,0x11,0x01,
+0x00,0x40,0x20,0x01,0x40,0x01,0x99,0x01,0x00,0x00,0x2b,0x01,0x00,0x80,0x20,0x00,
+0x40,0x00,0x97,0x01,0x00,0x00,0x3d,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x01,0x10,
+0x00,0x08,0x6e,0x6f,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x00,0x00,0x00,0x03,0x00,0x06,
+0x4b,0x65,0x72,0x6e,0x65,0x6c,0x00,0x00,0x0c,0x62,0x6c,0x6f,0x63,0x6b,0x5f,0x67,
+0x69,0x76,0x65,0x6e,0x3f,0x00,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,
+0x24,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x3d,0x00,0x00,0x00,
+0x29,0x00,0x00,0x00,0x01,0x10,0x00,0x05,0x62,0x6c,0x6f,0x63,0x6b,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x24,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,
+0x3d,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x01,0x10,0x00,0x05,0x62,0x6c,0x6f,0x63,
+0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5d,0x00,0x01,0x00,0x03,0x00,0x00,0x00,
+0x06,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x00,0x80,0x80,0x20,0x01,0x00,0x02,
+0x11,0x00,0x80,0xc0,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x05,0x00,0x06,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x00,0x00,0x10,0x67,0x6c,0x6f,0x62,
+0x61,0x6c,0x5f,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x73,0x00,0x00,0x05,0x63,
+0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x41,0x72,0x72,0x61,
+0x79,0x00,0x00,0x00,0x00,0x42,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,
+0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x00,0x08,0x00,0x80,0x80,0xb2,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x06,0x4b,0x65,0x72,0x6e,
+0x65,0x6c,0x00,0x00,0x09,0x69,0x74,0x65,0x72,0x61,0x74,0x6f,0x72,0x3f,0x00,0x00,
+0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0xa1,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x18,
+0x01,0x80,0x00,0x11,0x02,0x00,0x03,0x40,0x01,0x80,0x40,0x21,0x00,0x80,0xc0,0x01,
+0x01,0x80,0x00,0x11,0x02,0x00,0x40,0x01,0x01,0x80,0x40,0x21,0x01,0x00,0xc0,0x01,
+0x01,0x80,0x40,0x01,0x01,0x80,0x80,0x20,0x01,0xc0,0x02,0x19,0x01,0x80,0x40,0x01,
+0x01,0x80,0xc0,0x20,0x02,0x00,0x02,0x91,0x01,0x81,0x00,0xb2,0x01,0xc0,0x01,0x19,
+0x01,0x80,0x80,0x01,0x01,0x80,0x80,0x20,0x01,0xc0,0x02,0x19,0x01,0x80,0x80,0x01,
+0x01,0x80,0xc0,0x20,0x02,0x00,0x02,0x91,0x01,0x81,0x00,0xb2,0x01,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x06,0x4b,0x65,0x72,0x6e,0x65,0x6c,
+0x00,0x00,0x06,0x6c,0x61,0x6d,0x62,0x64,0x61,0x00,0x00,0x04,0x63,0x61,0x6c,0x6c,
+0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x04,
+0x50,0x72,0x6f,0x63,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,
+0x02,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x49,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x08,0x00,0xbf,0xff,
+0x83,0x01,0x00,0x00,0x11,0x01,0x80,0x03,0x40,0x01,0x00,0x40,0x21,0x01,0x00,0x40,
+0x01,0x01,0xc0,0x31,0x83,0x01,0x00,0x80,0xb2,0x01,0x00,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x03,0x00,0x06,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x00,0x00,0x04,
+0x6c,0x6f,0x6f,0x70,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x49,0x00,0x01,
+0x00,0x03,0x00,0x00,0x00,0x0b,0x00,0x80,0x40,0x15,0x00,0x80,0x00,0xad,0x00,0x80,
+0x40,0x16,0x00,0x80,0x40,0x15,0x01,0x40,0x31,0x83,0x00,0x80,0x40,0xb2,0x00,0xc0,
+0x01,0x19,0x00,0x80,0x40,0x29,0x00,0x40,0x00,0x97,0x00,0x80,0x00,0x05,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x2b,0x00,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,
+0x00,0x00,0x07,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x07,0x00,
+0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,
+0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x33,0x00,0x03,0x00,0x05,0x00,
+0x00,0x00,0x33,0x00,0x80,0xc0,0x37,0x00,0x40,0x01,0x9a,0x01,0x80,0x00,0x11,0x01,
+0x80,0x40,0x20,0x00,0x40,0x06,0x17,0x01,0x80,0x00,0x1b,0x02,0x00,0x01,0x11,0x02,
+0x80,0xc0,0x01,0x02,0x00,0xc0,0xa0,0x02,0x40,0x00,0x98,0x00,0x40,0x02,0x97,0x01,
+0x00,0xc0,0x01,0x01,0x80,0x40,0x01,0x02,0x00,0x80,0x01,0x01,0x81,0x00,0xa0,0x00,
+0x40,0x01,0x17,0x01,0x80,0x00,0x1d,0x00,0x80,0x00,0x1c,0x00,0x40,0x02,0x9a,0x01,
+0x80,0x00,0x11,0x02,0x00,0x02,0x91,0x02,0x01,0x80,0x20,0x01,0x80,0x40,0xa0,0x00,
+0x40,0x06,0x17,0x01,0x80,0x00,0x1b,0x02,0x00,0x01,0x11,0x02,0x80,0xc0,0x01,0x02,
+0x00,0xc0,0xa0,0x02,0x40,0x00,0x98,0x00,0x40,0x02,0x97,0x01,0x00,0xc0,0x01,0x01,
+0x80,0x40,0x01,0x02,0x00,0x80,0x01,0x01,0x81,0x00,0xa0,0x00,0x40,0x01,0x17,0x01,
+0x80,0x00,0x1d,0x00,0x80,0x00,0x1c,0x01,0x80,0x40,0x01,0x02,0x3f,0xff,0x83,0x01,
+0x81,0xc0,0xa0,0x01,0x82,0x00,0x20,0x02,0x00,0x02,0x91,0x01,0x82,0x40,0xb2,0x01,
+0xc0,0x03,0x19,0x01,0x80,0x40,0x01,0x02,0x40,0x00,0x03,0x01,0x81,0xc0,0xa0,0x01,
+0x82,0x00,0x20,0x02,0x00,0x02,0x91,0x01,0x82,0x40,0xb2,0x01,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x06,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x00,
+0x00,0x05,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x0d,0x53,0x74,0x61,0x6e,0x64,0x61,
+0x72,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x03,0x3d,0x3d,0x3d,0x00,0x00,0x02,
+0x3c,0x3c,0x00,0x00,0x0c,0x52,0x75,0x6e,0x74,0x69,0x6d,0x65,0x45,0x72,0x72,0x6f,
+0x72,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,0x05,0x63,
+0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x4b,0x00,0x01,
+0x00,0x03,0x00,0x00,0x00,0x06,0x00,0x80,0x00,0x06,0x00,0x80,0x00,0x20,0x00,0x80,
+0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x06,0x5f,0x5f,0x69,0x64,0x5f,0x5f,0x00,0x00,
+0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x06,0x46,0x69,
+0x78,0x6e,0x75,0x6d,0x00,0x00,0x00,0x00,0xd5,0x00,0x02,0x00,0x05,0x00,0x00,0x00,
+0x19,0x01,0x00,0x00,0x06,0x01,0x80,0x00,0x84,0x02,0x00,0x03,0x40,0x01,0x00,0x00,
+0xa1,0x00,0x80,0x80,0x01,0x01,0x00,0x40,0x01,0x01,0x00,0x80,0x20,0x01,0x40,0x02,
+0x19,0x01,0x00,0x40,0x01,0x01,0x00,0xc0,0x20,0x01,0x80,0x02,0x91,0x01,0x01,0x00,
+0xb2,0x01,0x40,0x02,0x19,0x01,0x00,0x00,0x06,0x01,0x80,0x03,0x04,0x02,0x00,0x03,
+0x84,0x01,0x00,0x01,0x20,0x01,0x40,0x03,0x19,0x01,0x00,0x00,0x06,0x01,0x80,0x04,
+0x04,0x01,0x00,0x00,0xa0,0x01,0x00,0xc0,0x20,0x01,0x80,0x04,0x91,0x01,0x01,0x00,
+0xb2,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x08,0x5f,
+0x5f,0x73,0x65,0x6e,0x64,0x5f,0x5f,0x00,0x00,0x06,0x6c,0x61,0x6d,0x62,0x64,0x61,
+0x00,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,
+0x00,0x02,0x3d,0x3d,0x00,0x00,0x04,0x50,0x72,0x6f,0x63,0x00,0x00,0x0b,0x72,0x65,
+0x73,0x70,0x6f,0x6e,0x64,0x5f,0x74,0x6f,0x3f,0x00,0x00,0x04,0x6e,0x69,0x6c,0x3f,
+0x00,0x00,0x0e,0x70,0x75,0x62,0x6c,0x69,0x63,0x5f,0x6d,0x65,0x74,0x68,0x6f,0x64,
+0x73,0x00,0x00,0x05,0x41,0x72,0x72,0x61,0x79,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,
+0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa8,0x00,0x01,0x00,0x03,0x00,0x00,
+0x00,0x19,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x80,
+0x00,0x06,0x00,0x80,0x40,0x20,0x01,0x00,0x00,0x08,0x00,0x80,0x80,0xb2,0x00,0xc0,
+0x02,0x19,0x00,0x80,0x00,0x06,0x00,0x80,0x00,0x20,0x01,0x00,0x00,0x3d,0x00,0x80,
+0x80,0xb2,0x00,0xc0,0x02,0x99,0x00,0x80,0x00,0x06,0x01,0x00,0x05,0x40,0x00,0x80,
+0x00,0x21,0x01,0x00,0x00,0xbd,0x00,0x80,0x80,0xb2,0x00,0xc0,0x02,0x99,0x00,0x80,
+0x00,0x06,0x01,0x00,0x07,0x40,0x00,0x80,0x00,0x21,0x01,0x00,0x00,0xbd,0x00,0x80,
+0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x02,0x10,0x00,0x08,0x6e,0x6f,0x20,
+0x62,0x6c,0x6f,0x63,0x6b,0x10,0x00,0x05,0x62,0x6c,0x6f,0x63,0x6b,0x00,0x00,0x00,
+0x03,0x00,0x06,0x62,0x67,0x5f,0x74,0x72,0x79,0x00,0x00,0x0c,0x62,0x6c,0x6f,0x63,
+0x6b,0x5f,0x67,0x69,0x76,0x65,0x6e,0x3f,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,
+0x00,0x59,0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0xa6,0x01,0x00,
+0x00,0x06,0x01,0x00,0x00,0x20,0x01,0x40,0x01,0x99,0x01,0x00,0x00,0x2b,0x01,0x00,
+0x40,0x20,0x00,0x40,0x00,0x97,0x01,0x00,0x00,0x3d,0x01,0x00,0x00,0x29,0x00,0x00,
+0x00,0x01,0x10,0x00,0x08,0x6e,0x6f,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x00,0x00,0x00,
+0x02,0x00,0x0c,0x62,0x6c,0x6f,0x63,0x6b,0x5f,0x67,0x69,0x76,0x65,0x6e,0x3f,0x00,
+0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,0x24,0x00,0x01,0x00,0x02,0x00,
+0x00,0x00,0x02,0x00,0x00,0x00,0x3d,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x01,0x10,
+0x00,0x05,0x62,0x6c,0x6f,0x63,0x6b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,
+0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x3d,0x00,0x00,0x00,0x29,0x00,
+0x00,0x00,0x01,0x10,0x00,0x05,0x62,0x6c,0x6f,0x63,0x6b,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x47,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x11,0x00,
+0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x06,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x00,
+0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x06,0x4d,
+0x6f,0x64,0x75,0x6c,0x65,0x00,0x00,0x00,0x01,0x6f,0x00,0x06,0x00,0x0b,0x00,0x00,
+0x00,0x42,0x03,0x00,0x00,0x05,0x03,0x80,0x00,0x05,0x03,0x00,0x00,0x43,0x03,0x00,
+0x00,0xc5,0x03,0x00,0x00,0x11,0x03,0x00,0x40,0x20,0x00,0x81,0x80,0x01,0x03,0x00,
+0x40,0x01,0x03,0xc0,0x00,0x03,0x03,0x00,0x80,0xa0,0x03,0x00,0x40,0x01,0x03,0x00,
+0xc0,0x20,0x01,0x01,0x80,0x01,0x03,0x00,0x40,0x01,0x03,0x01,0x80,0x47,0x03,0x80,
+0x0a,0xc0,0x03,0x01,0x00,0x46,0x03,0x00,0x40,0x01,0x03,0xc0,0x00,0x83,0x03,0x00,
+0x80,0xa0,0x03,0x00,0x40,0x01,0x03,0x00,0xc0,0x20,0x01,0x81,0x80,0x01,0x03,0x40,
+0x00,0x03,0x03,0x80,0x02,0x84,0x04,0x00,0x00,0x07,0x04,0x80,0x00,0x08,0x05,0x00,
+0x00,0x05,0x02,0x01,0x82,0xb7,0x02,0xbf,0xff,0x83,0x03,0x01,0x00,0x01,0x03,0x80,
+0x0d,0x40,0x03,0x01,0x80,0x21,0x03,0x00,0x40,0x01,0x03,0x01,0xc0,0x20,0x03,0xc0,
+0x00,0x83,0x03,0x02,0x00,0xb2,0x03,0x40,0x02,0x19,0x03,0x00,0x80,0x01,0x03,0x01,
+0xc0,0x20,0x03,0xc0,0x00,0x03,0x03,0x02,0x00,0xb2,0x03,0x40,0x05,0x19,0x03,0x00,
+0xc0,0x01,0x03,0x01,0xc0,0x20,0x03,0xc0,0x00,0x83,0x03,0x02,0x00,0xb2,0x03,0x40,
+0x02,0x99,0x03,0x00,0x40,0x01,0x03,0x80,0x02,0x04,0x03,0x02,0x40,0xa0,0x03,0x80,
+0x00,0x07,0x03,0x02,0x00,0xb2,0x03,0x40,0x02,0x99,0x03,0x00,0x80,0x01,0x03,0x80,
+0x02,0x04,0x03,0x02,0x40,0xa0,0x03,0x80,0x00,0x08,0x03,0x02,0x00,0xb2,0x03,0x40,
+0x02,0x99,0x03,0x00,0xc0,0x01,0x03,0x80,0x02,0x04,0x03,0x02,0x40,0xa0,0x03,0x80,
+0x00,0x07,0x03,0x02,0x00,0xb2,0x03,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x0a,0x00,0x0f,0x4b,0x65,0x72,0x6e,0x65,0x6c,0x43,0x6c,0x6f,0x6e,0x65,0x54,
+0x65,0x73,0x74,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x03,0x73,0x65,0x74,0x00,
+0x00,0x05,0x63,0x6c,0x6f,0x6e,0x65,0x00,0x00,0x04,0x74,0x65,0x73,0x74,0x00,0x00,
+0x03,0x66,0x6f,0x6f,0x00,0x00,0x04,0x65,0x61,0x63,0x68,0x00,0x00,0x03,0x67,0x65,
+0x74,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x0b,0x72,0x65,0x73,0x70,0x6f,0x6e,0x64,
+0x5f,0x74,0x6f,0x3f,0x00,0x00,0x00,0x00,0x59,0x00,0x01,0x00,0x02,0x00,0x00,0x00,
+0x0b,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x80,0x00,
+0x48,0x01,0x00,0x04,0xc0,0x00,0x80,0x40,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x06,
+0xc0,0x00,0x80,0x80,0x46,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x03,0x00,0x0a,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x69,0x7a,
+0x65,0x00,0x00,0x03,0x67,0x65,0x74,0x00,0x00,0x03,0x73,0x65,0x74,0x00,0x00,0x00,
+0x00,0x29,0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x26,0x01,0x3f,
+0xff,0x83,0x01,0x00,0x00,0x0e,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x01,0x00,0x02,0x40,0x76,0x00,0x00,0x00,0x00,0x25,0x00,0x02,0x00,0x03,0x00,
+0x00,0x00,0x03,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x40,0x76,0x00,0x00,0x00,0x00,0x25,
+0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x03,0x02,0x00,0x00,0x26,0x00,0x80,0x00,0x0e,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x40,0x76,
+0x00,0x00,0x00,0x00,0x20,0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+0x26,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x7a,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x12,0x02,0x00,0x00,
+0x26,0x00,0x40,0x01,0x9a,0x01,0x80,0x40,0x01,0x01,0x80,0x00,0x20,0x00,0x40,0x05,
+0x97,0x01,0x80,0x00,0x1b,0x02,0x00,0x00,0x91,0x02,0x80,0xc0,0x01,0x02,0x00,0x80,
+0xa0,0x02,0x40,0x00,0x98,0x00,0x40,0x02,0x17,0x01,0x81,0x40,0x15,0x01,0x80,0xc0,
+0xad,0x01,0x81,0x40,0x16,0x00,0x40,0x01,0x17,0x01,0x80,0x00,0x1d,0x00,0x80,0x00,
+0x1c,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x05,0x63,
+0x6c,0x6f,0x6e,0x65,0x00,0x00,0x09,0x54,0x79,0x70,0x65,0x45,0x72,0x72,0x6f,0x72,
+0x00,0x00,0x03,0x3d,0x3d,0x3d,0x00,0x00,0x01,0x2b,0x00,0x00,0x00,0x01,0x86,0x00,
+0x06,0x00,0x0b,0x00,0x00,0x00,0x47,0x03,0x00,0x00,0x05,0x03,0x80,0x00,0x05,0x03,
+0x00,0x00,0x43,0x03,0x00,0x00,0xc5,0x03,0x00,0x00,0x11,0x03,0x00,0x40,0x20,0x00,
+0x81,0x80,0x01,0x03,0x00,0x40,0x01,0x03,0xc0,0x00,0x03,0x03,0x00,0x80,0xa0,0x03,
+0x00,0x40,0x01,0x03,0x00,0xc0,0x20,0x01,0x01,0x80,0x01,0x03,0x00,0x40,0x01,0x03,
+0x01,0x80,0x47,0x03,0x80,0x0a,0xc0,0x03,0x01,0x00,0x46,0x03,0x00,0x40,0x01,0x03,
+0xc0,0x00,0x83,0x03,0x00,0x80,0xa0,0x03,0x00,0x40,0x01,0x03,0x00,0xc0,0x20,0x01,
+0x81,0x80,0x01,0x03,0x40,0x00,0x03,0x03,0x80,0x02,0x84,0x04,0x00,0x00,0x07,0x04,
+0x80,0x00,0x08,0x05,0x00,0x00,0x05,0x02,0x01,0x82,0xb7,0x02,0xbf,0xff,0x83,0x03,
+0x01,0x00,0x01,0x03,0x80,0x0d,0x40,0x03,0x01,0x80,0x21,0x03,0x01,0x40,0x01,0x03,
+0x81,0x00,0x01,0x03,0x82,0x00,0x20,0x03,0x01,0xc0,0xb2,0x03,0x40,0x02,0x19,0x03,
+0x00,0x40,0x01,0x03,0x02,0x40,0x20,0x03,0xc0,0x00,0x83,0x03,0x01,0xc0,0xb2,0x03,
+0x40,0x02,0x19,0x03,0x00,0x80,0x01,0x03,0x02,0x40,0x20,0x03,0xc0,0x00,0x03,0x03,
+0x01,0xc0,0xb2,0x03,0x40,0x02,0x19,0x03,0x00,0xc0,0x01,0x03,0x02,0x40,0x20,0x03,
+0xc0,0x00,0x83,0x03,0x01,0xc0,0xb2,0x03,0x40,0x02,0x99,0x03,0x00,0x40,0x01,0x03,
+0x80,0x02,0x04,0x03,0x02,0x80,0xa0,0x03,0x80,0x00,0x07,0x03,0x01,0xc0,0xb2,0x03,
+0x40,0x02,0x99,0x03,0x00,0x80,0x01,0x03,0x80,0x02,0x04,0x03,0x02,0x80,0xa0,0x03,
+0x80,0x00,0x08,0x03,0x01,0xc0,0xb2,0x03,0x40,0x02,0x99,0x03,0x00,0xc0,0x01,0x03,
+0x80,0x02,0x04,0x03,0x02,0x80,0xa0,0x03,0x80,0x00,0x08,0x03,0x01,0xc0,0xb2,0x03,
+0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x00,0x0d,0x4b,0x65,0x72,
+0x6e,0x65,0x6c,0x44,0x75,0x70,0x54,0x65,0x73,0x74,0x00,0x00,0x03,0x6e,0x65,0x77,
+0x00,0x00,0x03,0x73,0x65,0x74,0x00,0x00,0x03,0x64,0x75,0x70,0x00,0x00,0x04,0x74,
+0x65,0x73,0x74,0x00,0x00,0x03,0x66,0x6f,0x6f,0x00,0x00,0x04,0x65,0x61,0x63,0x68,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x04,0x73,0x69,0x7a,0x65,0x00,0x00,0x03,0x67,
+0x65,0x74,0x00,0x00,0x0b,0x72,0x65,0x73,0x70,0x6f,0x6e,0x64,0x5f,0x74,0x6f,0x3f,
+0x00,0x00,0x00,0x00,0x59,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x0b,0x00,0x80,0x00,
+0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x04,
+0xc0,0x00,0x80,0x40,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x06,0xc0,0x00,0x80,0x80,
+0x46,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x03,0x00,0x0a,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x69,0x7a,0x65,0x00,0x00,0x03,
+0x67,0x65,0x74,0x00,0x00,0x03,0x73,0x65,0x74,0x00,0x00,0x00,0x00,0x29,0x00,0x02,
+0x00,0x03,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x26,0x01,0x3f,0xff,0x83,0x01,0x00,
+0x00,0x0e,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,
+0x40,0x76,0x00,0x00,0x00,0x00,0x25,0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x03,0x00,
+0x00,0x00,0x26,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x01,0x00,0x02,0x40,0x76,0x00,0x00,0x00,0x00,0x25,0x00,0x03,0x00,0x04,
+0x00,0x00,0x00,0x03,0x02,0x00,0x00,0x26,0x00,0x80,0x00,0x0e,0x00,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x40,0x76,0x00,0x00,0x00,0x00,
+0x20,0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x26,0x00,0x00,0x00,
+0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x78,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x12,0x02,0x00,0x00,0x26,0x00,0x40,0x01,
+0x9a,0x01,0x80,0x40,0x01,0x01,0x80,0x00,0x20,0x00,0x40,0x05,0x97,0x01,0x80,0x00,
+0x1b,0x02,0x00,0x00,0x91,0x02,0x80,0xc0,0x01,0x02,0x00,0x80,0xa0,0x02,0x40,0x00,
+0x98,0x00,0x40,0x02,0x17,0x01,0x81,0x40,0x15,0x01,0x80,0xc0,0xad,0x01,0x81,0x40,
+0x16,0x00,0x40,0x01,0x17,0x01,0x80,0x00,0x1d,0x00,0x80,0x00,0x1c,0x01,0x80,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x03,0x64,0x75,0x70,0x00,0x00,
+0x09,0x54,0x79,0x70,0x65,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x03,0x3d,0x3d,0x3d,
+0x00,0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0xdb,0x00,0x03,0x00,0x05,0x00,0x00,0x00,
+0x1c,0x01,0x80,0x00,0x05,0x02,0x00,0x00,0x05,0x01,0x80,0x00,0x43,0x01,0x80,0x00,
+0xc5,0x01,0x80,0x00,0x05,0x01,0x80,0x40,0x44,0x01,0x80,0x01,0x45,0x01,0x80,0x00,
+0x11,0x01,0x80,0x80,0x20,0x00,0x80,0xc0,0x01,0x01,0x80,0x40,0x01,0x02,0x00,0x00,
+0x91,0x01,0x80,0xc0,0xa0,0x01,0x80,0x00,0x11,0x01,0x80,0x80,0x20,0x01,0x00,0xc0,
+0x01,0x01,0x80,0x40,0x01,0x02,0x00,0x02,0x84,0x01,0x81,0x00,0xa0,0x02,0x00,0x00,
+0x07,0x01,0x81,0x80,0xb2,0x01,0xc0,0x02,0x99,0x01,0x80,0x80,0x01,0x02,0x00,0x02,
+0x84,0x01,0x81,0x00,0xa0,0x02,0x00,0x00,0x08,0x01,0x81,0x80,0xb2,0x01,0x80,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x10,0x54,0x65,0x73,0x74,0x34,
+0x45,0x78,0x74,0x65,0x6e,0x64,0x43,0x6c,0x61,0x73,0x73,0x00,0x00,0x11,0x54,0x65,
+0x73,0x74,0x34,0x45,0x78,0x74,0x65,0x6e,0x64,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x00,
+0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x06,0x65,0x78,0x74,0x65,0x6e,0x64,0x00,0x00,
+0x0b,0x72,0x65,0x73,0x70,0x6f,0x6e,0x64,0x5f,0x74,0x6f,0x3f,0x00,0x00,0x0b,0x74,
+0x65,0x73,0x74,0x5f,0x6d,0x65,0x74,0x68,0x6f,0x64,0x00,0x00,0x02,0x3d,0x3d,0x00,
+0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,
+0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x36,
+0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,
+0x00,0x80,0x00,0x46,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x01,0x00,0x0b,0x74,0x65,0x73,0x74,0x5f,0x6d,0x65,0x74,0x68,0x6f,
+0x64,0x00,0x00,0x00,0x00,0x20,0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,
+0x00,0x26,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x82,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0c,0x00,0x80,
+0x00,0x05,0x00,0x80,0x00,0x44,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x06,0x01,0x00,
+0x00,0x11,0x00,0x80,0x40,0xa0,0x00,0x80,0x00,0x06,0x01,0x00,0x01,0x84,0x00,0x80,
+0x80,0xa0,0x01,0x00,0x00,0x07,0x00,0x81,0x00,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x11,0x54,0x65,0x73,0x74,0x34,0x45,0x78,0x74,
+0x65,0x6e,0x64,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x00,0x00,0x06,0x65,0x78,0x74,0x65,
+0x6e,0x64,0x00,0x00,0x0b,0x72,0x65,0x73,0x70,0x6f,0x6e,0x64,0x5f,0x74,0x6f,0x3f,
+0x00,0x00,0x0b,0x74,0x65,0x73,0x74,0x5f,0x6d,0x65,0x74,0x68,0x6f,0x64,0x00,0x00,
+0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x36,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x05,
+0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x00,0x00,0x05,
+0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x0b,0x74,0x65,
+0x73,0x74,0x5f,0x6d,0x65,0x74,0x68,0x6f,0x64,0x00,0x00,0x00,0x00,0x20,0x00,0x02,
+0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x05,0x00,0x00,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x54,0x00,0x01,
+0x00,0x03,0x00,0x00,0x00,0x06,0x00,0x80,0x00,0x06,0x00,0x80,0x00,0x20,0x00,0x80,
+0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x10,0x67,0x6c,0x6f,0x62,0x61,0x6c,0x5f,0x76,
+0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x73,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x41,0x72,0x72,0x61,0x79,0x00,0x00,0x00,
+0x00,0x38,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x06,0x00,0x80,0x00,0x06,0x00,0x80,
+0x00,0x20,0x01,0x00,0x00,0x06,0x01,0x00,0x00,0x20,0x00,0x80,0x40,0xb2,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x68,0x61,0x73,0x68,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x6b,0x00,0x02,0x00,0x04,0x00,0x00,
+0x00,0x0c,0x01,0x00,0x00,0x06,0x01,0x00,0x00,0x20,0x00,0x80,0x80,0x01,0x01,0x00,
+0x40,0x01,0x01,0x00,0x40,0x20,0x01,0x80,0x01,0x91,0x01,0x00,0x80,0xb2,0x01,0x40,
+0x01,0x99,0x01,0x00,0x40,0x01,0x01,0x80,0x00,0x3d,0x01,0x00,0x80,0xb2,0x01,0x00,
+0x00,0x29,0x00,0x00,0x00,0x01,0x10,0x00,0x04,0x6d,0x61,0x69,0x6e,0x00,0x00,0x00,
+0x04,0x00,0x07,0x69,0x6e,0x73,0x70,0x65,0x63,0x74,0x00,0x00,0x05,0x63,0x6c,0x61,
+0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x06,0x53,0x74,0x72,0x69,0x6e,0x67,
+0x00,0x00,0x00,0x00,0xe5,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x1b,0x01,0x80,0x00,
+0x11,0x01,0x80,0x40,0x20,0x00,0x80,0xc0,0x01,0x01,0x80,0x40,0x01,0x02,0x00,0x03,
+0x40,0x01,0x80,0x80,0x21,0x01,0x80,0x40,0x01,0x01,0x80,0xc0,0x20,0x01,0x00,0xc0,
+0x01,0x01,0x80,0x80,0x01,0x01,0x81,0x00,0x20,0x02,0x00,0x03,0x11,0x01,0x81,0x40,
+0xb2,0x01,0xc0,0x02,0x19,0x01,0x80,0x80,0x01,0x01,0x81,0xc0,0x20,0x02,0x40,0x00,
+0x83,0x01,0x81,0x40,0xb2,0x01,0xc0,0x01,0x99,0x01,0x80,0x80,0x01,0x02,0x00,0x04,
+0x84,0x01,0x82,0x00,0xa0,0x01,0xc0,0x01,0x99,0x01,0x80,0x80,0x01,0x02,0x00,0x05,
+0x04,0x01,0x82,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x0b,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,
+0x00,0x0d,0x69,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x65,0x76,0x61,0x6c,0x00,
+0x00,0x12,0x69,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,0x76,0x61,0x72,0x69,0x61,
+0x62,0x6c,0x65,0x73,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x05,0x41,0x72,0x72,0x61,0x79,0x00,0x00,0x04,0x73,0x69,0x7a,0x65,
+0x00,0x00,0x08,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x3f,0x00,0x00,0x02,0x40,0x61,
+0x00,0x00,0x02,0x40,0x62,0x00,0x00,0x00,0x00,0x32,0x00,0x01,0x00,0x02,0x00,0x00,
+0x00,0x05,0x00,0xc0,0x05,0x03,0x00,0x80,0x00,0x0e,0x00,0xc0,0x05,0x83,0x00,0x80,
+0x00,0x8e,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x02,
+0x40,0x61,0x00,0x00,0x02,0x40,0x62,0x00,0x00,0x00,0x00,0x55,0x00,0x01,0x00,0x03,
+0x00,0x00,0x00,0x09,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x00,0x80,0x00,0xa0,
+0x00,0xc0,0x02,0x19,0x00,0x80,0x00,0x06,0x01,0x00,0x01,0x11,0x00,0x80,0x00,0xa0,
+0x00,0x80,0xc0,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,
+0x00,0x05,0x69,0x73,0x5f,0x61,0x3f,0x00,0x00,0x06,0x4b,0x65,0x72,0x6e,0x65,0x6c,
+0x00,0x00,0x05,0x41,0x72,0x72,0x61,0x79,0x00,0x00,0x01,0x21,0x00,0x00,0x00,0x00,
+0x39,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x06,0x00,0x80,0x00,
+0x20,0x01,0x00,0x00,0x08,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x02,0x00,0x09,0x69,0x74,0x65,0x72,0x61,0x74,0x6f,0x72,0x3f,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x58,0x00,0x01,0x00,0x03,0x00,0x00,
+0x00,0x09,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x00,0x80,0x00,0xa0,0x00,0xc0,
+0x02,0x19,0x00,0x80,0x00,0x06,0x01,0x00,0x01,0x11,0x00,0x80,0x00,0xa0,0x00,0x80,
+0xc0,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x08,
+0x6b,0x69,0x6e,0x64,0x5f,0x6f,0x66,0x3f,0x00,0x00,0x06,0x4b,0x65,0x72,0x6e,0x65,
+0x6c,0x00,0x00,0x05,0x41,0x72,0x72,0x61,0x79,0x00,0x00,0x01,0x21,0x00,0x00,0x00,
+0x00,0x98,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x18,0x01,0x80,0x00,0x06,0x02,0x00,
+0x03,0x40,0x01,0x80,0x00,0x21,0x00,0x80,0xc0,0x01,0x01,0x80,0x00,0x06,0x02,0x00,
+0x40,0x01,0x01,0x80,0x00,0x21,0x01,0x00,0xc0,0x01,0x01,0x80,0x40,0x01,0x01,0x80,
+0x40,0x20,0x01,0xc0,0x02,0x19,0x01,0x80,0x40,0x01,0x01,0x80,0x80,0x20,0x02,0x00,
+0x02,0x11,0x01,0x80,0xc0,0xb2,0x01,0xc0,0x01,0x19,0x01,0x80,0x80,0x01,0x01,0x80,
+0x40,0x20,0x01,0xc0,0x02,0x19,0x01,0x80,0x80,0x01,0x01,0x80,0x80,0x20,0x02,0x00,
+0x02,0x11,0x01,0x80,0xc0,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x05,0x00,0x06,0x6c,0x61,0x6d,0x62,0x64,0x61,0x00,0x00,0x04,0x63,0x61,0x6c,
+0x6c,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,
+0x04,0x50,0x72,0x6f,0x63,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,
+0x00,0x02,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x08,0x00,0xbf,
+0xff,0x83,0x01,0x00,0x00,0x06,0x01,0x80,0x03,0x40,0x01,0x00,0x00,0x21,0x01,0x00,
+0x40,0x01,0x01,0xc0,0x31,0x83,0x01,0x00,0x40,0xb2,0x01,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x6c,0x6f,0x6f,0x70,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x00,0x00,0x49,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0b,0x00,0x80,
+0x40,0x15,0x00,0x80,0x00,0xad,0x00,0x80,0x40,0x16,0x00,0x80,0x40,0x15,0x01,0x40,
+0x31,0x83,0x00,0x80,0x40,0xb2,0x00,0xc0,0x01,0x19,0x00,0x80,0x40,0x29,0x00,0x40,
+0x00,0x97,0x00,0x80,0x00,0x05,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x02,0x00,0x01,0x2b,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x4b,0x00,
+0x01,0x00,0x03,0x00,0x00,0x00,0x06,0x00,0x80,0x00,0x06,0x00,0x80,0x00,0x20,0x00,
+0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x07,0x6d,0x65,0x74,0x68,0x6f,0x64,0x73,
+0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,
+0x41,0x72,0x72,0x61,0x79,0x00,0x00,0x00,0x00,0x34,0x00,0x01,0x00,0x03,0x00,0x00,
+0x00,0x05,0x00,0x80,0x00,0x06,0x00,0x80,0x00,0x20,0x01,0x00,0x00,0x08,0x00,0x80,
+0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,
+0x6e,0x69,0x6c,0x3f,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x4e,0x00,0x01,
+0x00,0x03,0x00,0x00,0x00,0x06,0x00,0x80,0x00,0x06,0x00,0x80,0x00,0x20,0x00,0x80,
+0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x09,0x6f,0x62,0x6a,0x65,0x63,0x74,0x5f,0x69,
+0x64,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,
+0x06,0x46,0x69,0x78,0x6e,0x75,0x6d,0x00,0x00,0x00,0x00,0x53,0x00,0x01,0x00,0x03,
+0x00,0x00,0x00,0x06,0x00,0x80,0x00,0x06,0x00,0x80,0x00,0x20,0x00,0x80,0x40,0x20,
+0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x04,0x00,0x0f,0x70,0x72,0x69,0x76,0x61,0x74,0x65,0x5f,0x6d,0x65,
+0x74,0x68,0x6f,0x64,0x73,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x05,0x41,0x72,0x72,0x61,0x79,0x00,0x00,0x00,0x00,0x55,0x00,
+0x01,0x00,0x03,0x00,0x00,0x00,0x06,0x00,0x80,0x00,0x06,0x00,0x80,0x00,0x20,0x00,
+0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x11,0x70,0x72,0x6f,0x74,0x65,0x63,0x74,
+0x65,0x64,0x5f,0x6d,0x65,0x74,0x68,0x6f,0x64,0x73,0x00,0x00,0x05,0x63,0x6c,0x61,
+0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x41,0x72,0x72,0x61,0x79,0x00,
+0x00,0x00,0x00,0x52,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x06,0x00,0x80,0x00,0x06,
+0x00,0x80,0x00,0x20,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x0e,0x70,0x75,
+0x62,0x6c,0x69,0x63,0x5f,0x6d,0x65,0x74,0x68,0x6f,0x64,0x73,0x00,0x00,0x05,0x63,
+0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x41,0x72,0x72,0x61,
+0x79,0x00,0x00,0x00,0x01,0x2a,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x33,0x00,0x80,
+0xc0,0x37,0x00,0x40,0x01,0x9a,0x01,0x80,0x00,0x06,0x01,0x80,0x00,0x20,0x00,0x40,
+0x06,0x17,0x01,0x80,0x00,0x1b,0x02,0x00,0x00,0x91,0x02,0x80,0xc0,0x01,0x02,0x00,
+0x80,0xa0,0x02,0x40,0x00,0x98,0x00,0x40,0x02,0x97,0x01,0x00,0xc0,0x01,0x01,0x80,
+0x40,0x01,0x02,0x00,0x80,0x01,0x01,0x80,0xc0,0xa0,0x00,0x40,0x01,0x17,0x01,0x80,
+0x00,0x1d,0x00,0x80,0x00,0x1c,0x00,0x40,0x02,0x9a,0x01,0x80,0x00,0x06,0x02,0x00,
+0x02,0x11,0x02,0x01,0x40,0x20,0x01,0x80,0x00,0xa0,0x00,0x40,0x06,0x17,0x01,0x80,
+0x00,0x1b,0x02,0x00,0x00,0x91,0x02,0x80,0xc0,0x01,0x02,0x00,0x80,0xa0,0x02,0x40,
+0x00,0x98,0x00,0x40,0x02,0x97,0x01,0x00,0xc0,0x01,0x01,0x80,0x40,0x01,0x02,0x00,
+0x80,0x01,0x01,0x80,0xc0,0xa0,0x00,0x40,0x01,0x17,0x01,0x80,0x00,0x1d,0x00,0x80,
+0x00,0x1c,0x01,0x80,0x40,0x01,0x02,0x3f,0xff,0x83,0x01,0x81,0x80,0xa0,0x01,0x81,
+0xc0,0x20,0x02,0x00,0x02,0x11,0x01,0x82,0x00,0xb2,0x01,0xc0,0x03,0x19,0x01,0x80,
+0x40,0x01,0x02,0x40,0x00,0x03,0x01,0x81,0x80,0xa0,0x01,0x81,0xc0,0x20,0x02,0x00,
+0x02,0x11,0x01,0x82,0x00,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x09,0x00,0x05,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x0d,0x53,0x74,0x61,0x6e,
+0x64,0x61,0x72,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x03,0x3d,0x3d,0x3d,0x00,
+0x00,0x02,0x3c,0x3c,0x00,0x00,0x0c,0x52,0x75,0x6e,0x74,0x69,0x6d,0x65,0x45,0x72,
+0x72,0x6f,0x72,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,
+0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x8f,
+0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0f,0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x05,
+0x00,0x80,0x00,0x43,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x06,0x01,0x00,0x01,0x04,
+0x00,0x80,0x40,0xa0,0x00,0xc0,0x03,0x19,0x00,0x80,0x00,0x11,0x00,0x80,0xc0,0x20,
+0x01,0x00,0x02,0x04,0x00,0x80,0x40,0xa0,0x01,0x00,0x00,0x08,0x00,0x81,0x40,0xb2,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x0e,0x54,0x65,
+0x73,0x74,0x34,0x52,0x65,0x73,0x70,0x6f,0x6e,0x64,0x54,0x6f,0x00,0x00,0x0b,0x72,
+0x65,0x73,0x70,0x6f,0x6e,0x64,0x5f,0x74,0x6f,0x3f,0x00,0x00,0x04,0x6e,0x69,0x6c,
+0x3f,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x0b,0x74,0x65,0x73,0x74,0x5f,0x6d,
+0x65,0x74,0x68,0x6f,0x64,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x4d,0x00,
+0x01,0x00,0x03,0x00,0x00,0x00,0x07,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,
+0x80,0x00,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x00,0x04,0x00,0x80,0x40,0xa0,0x01,
+0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x0b,0x74,0x65,0x73,
+0x74,0x5f,0x6d,0x65,0x74,0x68,0x6f,0x64,0x00,0x00,0x0c,0x75,0x6e,0x64,0x65,0x66,
+0x5f,0x6d,0x65,0x74,0x68,0x6f,0x64,0x00,0x00,0x00,0x00,0x20,0x00,0x02,0x00,0x03,
+0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd1,0x00,0x02,0x00,0x05,
+0x00,0x00,0x00,0x19,0x01,0x00,0x00,0x06,0x01,0x80,0x00,0x84,0x02,0x00,0x03,0x40,
+0x01,0x00,0x00,0xa1,0x00,0x80,0x80,0x01,0x01,0x00,0x40,0x01,0x01,0x00,0x80,0x20,
+0x01,0x40,0x02,0x19,0x01,0x00,0x40,0x01,0x01,0x00,0xc0,0x20,0x01,0x80,0x02,0x91,
+0x01,0x01,0x00,0xb2,0x01,0x40,0x02,0x19,0x01,0x00,0x00,0x06,0x01,0x80,0x03,0x04,
+0x02,0x00,0x03,0x84,0x01,0x00,0x01,0x20,0x01,0x40,0x03,0x19,0x01,0x00,0x00,0x06,
+0x01,0x80,0x04,0x04,0x01,0x00,0x00,0xa0,0x01,0x00,0xc0,0x20,0x01,0x80,0x04,0x91,
+0x01,0x01,0x00,0xb2,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,
+0x00,0x04,0x73,0x65,0x6e,0x64,0x00,0x00,0x06,0x6c,0x61,0x6d,0x62,0x64,0x61,0x00,
+0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,
+0x02,0x3d,0x3d,0x00,0x00,0x04,0x50,0x72,0x6f,0x63,0x00,0x00,0x0b,0x72,0x65,0x73,
+0x70,0x6f,0x6e,0x64,0x5f,0x74,0x6f,0x3f,0x00,0x00,0x04,0x6e,0x69,0x6c,0x3f,0x00,
+0x00,0x0e,0x70,0x75,0x62,0x6c,0x69,0x63,0x5f,0x6d,0x65,0x74,0x68,0x6f,0x64,0x73,
+0x00,0x00,0x05,0x41,0x72,0x72,0x61,0x79,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,
+0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x00,0x01,0x00,0x03,0x00,0x00,0x00,
+0x06,0x00,0x80,0x00,0x06,0x00,0x80,0x00,0x20,0x00,0x80,0x40,0x20,0x01,0x00,0x01,
+0x91,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x04,0x00,0x11,0x73,0x69,0x6e,0x67,0x6c,0x65,0x74,0x6f,0x6e,0x5f,0x6d,0x65,0x74,
+0x68,0x6f,0x64,0x73,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x05,0x41,0x72,0x72,0x61,0x79,0x00,0x00,0x00,0x00,0x49,0x00,0x01,
+0x00,0x03,0x00,0x00,0x00,0x06,0x00,0x80,0x00,0x06,0x00,0x80,0x00,0x20,0x00,0x80,
+0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x74,0x6f,0x5f,0x73,0x00,0x00,0x05,0x63,
+0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x06,0x53,0x74,0x72,0x69,
+0x6e,0x67,0x00,0x00,0x00,0x00,0x93,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x17,0x00,
+0x80,0x00,0x3d,0x01,0x00,0x40,0x01,0x01,0x80,0x00,0xbd,0x02,0x00,0x40,0x01,0x02,
+0xc0,0x00,0x03,0x02,0x00,0x00,0xa0,0x02,0x80,0x01,0x3d,0x02,0x00,0x40,0xa0,0x02,
+0x80,0x00,0x08,0x02,0x00,0x80,0xb2,0x02,0x40,0x02,0x99,0x02,0x00,0x40,0x01,0x02,
+0x80,0xc0,0x01,0x02,0x00,0x40,0xa0,0x02,0x80,0x00,0x07,0x02,0x00,0x80,0xb2,0x02,
+0x40,0x02,0x99,0x02,0x00,0x80,0x01,0x02,0x80,0x40,0x01,0x02,0x00,0x40,0xa0,0x02,
+0x80,0x00,0x08,0x02,0x00,0x80,0xb2,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x03,0x10,
+0x00,0x05,0x68,0x65,0x6c,0x6c,0x6f,0x10,0x00,0x05,0x77,0x6f,0x72,0x6c,0x64,0x10,
+0x00,0x01,0x65,0x00,0x00,0x00,0x03,0x00,0x02,0x5b,0x5d,0x00,0x00,0x02,0x21,0x3d,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x01,0xdd,0x00,0x01,0x00,0x03,0x00,0x00,
+0x00,0x55,0x00,0xc0,0x00,0x03,0x01,0x40,0x00,0x03,0x00,0x80,0x00,0xb2,0x00,0xc0,
+0x01,0x99,0x00,0xbf,0xff,0x03,0x01,0x3f,0xff,0x03,0x00,0x80,0x00,0xb2,0x00,0xc0,
+0x01,0x99,0x00,0xc0,0x00,0x03,0x01,0x40,0x00,0x03,0x00,0x80,0x00,0xb2,0x00,0xc0,
+0x01,0x99,0x00,0x80,0x00,0x02,0x01,0x00,0x00,0x02,0x00,0x80,0x00,0xb2,0x00,0xc0,
+0x01,0x99,0x00,0x80,0x00,0x82,0x01,0x00,0x00,0x82,0x00,0x80,0x00,0xb2,0x00,0xc0,
+0x01,0x99,0x00,0xc0,0x3f,0x83,0x01,0x40,0x3f,0x83,0x00,0x80,0x00,0xb2,0x00,0xc0,
+0x01,0x99,0x00,0xc0,0x3f,0x83,0x01,0x40,0x3f,0x83,0x00,0x80,0x00,0xb2,0x00,0xc0,
+0x03,0x83,0x01,0x40,0x03,0x83,0x00,0x80,0x00,0xb2,0x00,0xc0,0x01,0x99,0x00,0xc0,
+0x03,0x83,0x01,0x40,0x03,0x83,0x00,0x80,0x00,0xb2,0x00,0xc0,0x01,0x99,0x00,0xc0,
+0x03,0x83,0x01,0x40,0x03,0x83,0x00,0x80,0x00,0xb2,0x00,0xc0,0x7f,0x03,0x01,0x40,
+0x7f,0x03,0x00,0x80,0x00,0xb2,0x00,0xc0,0x01,0x99,0x00,0xc0,0x7f,0x03,0x01,0x40,
+0x7f,0x03,0x00,0x80,0x00,0xb2,0x00,0xc0,0x01,0x99,0x00,0xc1,0xf3,0x03,0x01,0x41,
+0xf3,0x03,0x00,0x80,0x00,0xb2,0x00,0xc0,0x01,0x99,0x00,0xc1,0xf3,0x03,0x01,0x41,
+0xf3,0x03,0x00,0x80,0x00,0xb2,0x00,0xc0,0x01,0x99,0x00,0x80,0x01,0x02,0x01,0x00,
+0x01,0x02,0x00,0x80,0x00,0xb2,0x00,0xc0,0x01,0x99,0x00,0xc0,0x04,0x83,0x01,0x40,
+0x04,0x83,0x00,0x80,0x00,0xb2,0x00,0xc0,0x01,0x99,0x00,0x80,0x01,0x82,0x01,0x00,
+0x01,0x82,0x00,0x80,0x00,0xb2,0x00,0xc0,0x01,0x99,0x00,0x80,0x02,0x02,0x01,0x00,
+0x02,0x02,0x00,0x80,0x00,0xb2,0x00,0xc0,0x01,0x99,0x00,0x80,0x01,0x82,0x01,0x00,
+0x01,0x82,0x00,0x80,0x00,0xb2,0x00,0x80,0x01,0x82,0x01,0x00,0x01,0x82,0x00,0x80,
+0x00,0xb2,0x00,0xc0,0x01,0x99,0x00,0x80,0x02,0x02,0x01,0x00,0x02,0x02,0x00,0x80,
+0x00,0xb2,0x00,0xc0,0x01,0x99,0x00,0x80,0x01,0x82,0x01,0x00,0x01,0x82,0x00,0x80,
+0x00,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x05,0x06,0x00,0x16,0x31,0x2e,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,
+0x2b,0x30,0x30,0x06,0x00,0x17,0x2d,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x03,0x00,0x08,
+0x31,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x06,0x00,0x16,0x31,0x2e,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,
+0x31,0x06,0x00,0x16,0x31,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x31,0x65,0x2d,0x30,0x31,0x00,0x00,0x00,0x01,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x00,0x00,0x57,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0c,0x00,
+0x80,0x00,0x3d,0x01,0x00,0x00,0x3d,0x00,0x80,0x00,0xb2,0x00,0xc0,0x01,0x99,0x00,
+0x80,0x00,0xbd,0x01,0x00,0x00,0xbd,0x00,0x80,0x00,0xb2,0x00,0xc0,0x01,0x99,0x00,
+0x80,0x01,0x3d,0x01,0x00,0x01,0x3d,0x00,0x80,0x00,0xb2,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x03,0x10,0x00,0x03,0x61,0x62,0x63,0x10,0x00,0x01,0x27,0x10,0x00,0x01,
+0x5c,0x00,0x00,0x00,0x01,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x76,0x00,0x02,
+0x00,0x04,0x00,0x00,0x00,0x13,0x00,0x80,0x00,0x3d,0x01,0x00,0x00,0x3d,0x01,0x80,
+0x00,0x3d,0x01,0x00,0x00,0xb2,0x01,0x40,0x01,0x99,0x01,0x00,0x00,0xbd,0x01,0x80,
+0x00,0xbd,0x01,0x00,0x00,0xb2,0x01,0x40,0x01,0x99,0x01,0x00,0x01,0x3d,0x01,0x80,
+0x01,0x3d,0x01,0x00,0x00,0xb2,0x01,0x40,0x02,0x99,0x01,0x00,0x01,0xbd,0x01,0x80,
+0x40,0x01,0x01,0x00,0xc0,0x3e,0x01,0x80,0x00,0x3d,0x01,0x00,0x00,0xb2,0x01,0x00,
+0x00,0x29,0x00,0x00,0x00,0x04,0x10,0x00,0x03,0x61,0x62,0x63,0x10,0x00,0x01,0x22,
+0x10,0x00,0x01,0x5c,0x10,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x3d,0x3d,0x00,
+0x00,0x00,0x00,0xb9,0x00,0x08,0x00,0x0a,0x00,0x00,0x00,0x23,0x00,0x80,0x00,0x3d,
+0x01,0x00,0x00,0x3d,0x01,0x80,0x00,0x3d,0x02,0x00,0x00,0x3d,0x02,0x80,0x00,0x3d,
+0x03,0x00,0x00,0xbd,0x03,0x80,0x01,0x3d,0x04,0x00,0x40,0x01,0x04,0x80,0x00,0x3d,
+0x04,0x00,0x00,0xb2,0x04,0x40,0x01,0x99,0x04,0x00,0x80,0x01,0x04,0x80,0x00,0x3d,
+0x04,0x00,0x00,0xb2,0x04,0x40,0x01,0x99,0x04,0x00,0xc0,0x01,0x04,0x80,0x00,0x3d,
+0x04,0x00,0x00,0xb2,0x04,0x40,0x01,0x99,0x04,0x01,0x00,0x01,0x04,0x80,0x00,0x3d,
+0x04,0x00,0x00,0xb2,0x04,0x40,0x01,0x99,0x04,0x01,0x40,0x01,0x04,0x80,0x00,0x3d,
+0x04,0x00,0x00,0xb2,0x04,0x40,0x01,0x99,0x04,0x01,0x80,0x01,0x04,0x80,0x00,0xbd,
+0x04,0x00,0x00,0xb2,0x04,0x40,0x01,0x99,0x04,0x01,0xc0,0x01,0x04,0x80,0x01,0x3d,
+0x04,0x00,0x00,0xb2,0x04,0x00,0x00,0x29,0x00,0x00,0x00,0x03,0x10,0x00,0x03,0x61,
+0x62,0x63,0x10,0x00,0x04,0x61,0x62,0x2f,0x63,0x10,0x00,0x04,0x23,0x7b,0x61,0x7d,
+0x00,0x00,0x00,0x01,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0xc1,0x00,0x08,0x00,
+0x0a,0x00,0x00,0x00,0x26,0x00,0x80,0x00,0x3d,0x01,0x00,0x00,0x3d,0x01,0x80,0x00,
+0x3d,0x02,0x00,0x00,0x3d,0x02,0x80,0x00,0x3d,0x03,0x00,0x00,0xbd,0x04,0x00,0x01,
+0x3d,0x04,0x80,0x40,0x01,0x04,0x02,0x40,0x3e,0x03,0x82,0x00,0x01,0x04,0x00,0x40,
+0x01,0x04,0x80,0x00,0x3d,0x04,0x00,0x00,0xb2,0x04,0x40,0x01,0x99,0x04,0x00,0x80,
+0x01,0x04,0x80,0x00,0x3d,0x04,0x00,0x00,0xb2,0x04,0x40,0x01,0x99,0x04,0x00,0xc0,
+0x01,0x04,0x80,0x00,0x3d,0x04,0x00,0x00,0xb2,0x04,0x40,0x01,0x99,0x04,0x01,0x00,
+0x01,0x04,0x80,0x00,0x3d,0x04,0x00,0x00,0xb2,0x04,0x40,0x01,0x99,0x04,0x01,0x40,
+0x01,0x04,0x80,0x00,0x3d,0x04,0x00,0x00,0xb2,0x04,0x40,0x01,0x99,0x04,0x01,0x80,
+0x01,0x04,0x80,0x00,0xbd,0x04,0x00,0x00,0xb2,0x04,0x40,0x01,0x99,0x04,0x01,0xc0,
+0x01,0x04,0x80,0x00,0x3d,0x04,0x00,0x00,0xb2,0x04,0x00,0x00,0x29,0x00,0x00,0x00,
+0x03,0x10,0x00,0x03,0x61,0x62,0x63,0x10,0x00,0x04,0x61,0x62,0x2f,0x63,0x10,0x00,
+0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x02,0xc0,0x00,0x0d,
+0x00,0x11,0x00,0x00,0x00,0x6a,0x00,0x80,0x00,0x3d,0x01,0x00,0x00,0xbd,0x06,0x80,
+0x01,0x3d,0x07,0x00,0x01,0xbd,0x07,0x80,0x02,0x3d,0x01,0x83,0x41,0xb7,0x06,0x80,
+0x02,0xbd,0x07,0x40,0x00,0x03,0x07,0x00,0x01,0x2d,0x06,0x83,0x80,0x3e,0x07,0x00,
+0x03,0x3d,0x06,0x83,0x80,0x3e,0x07,0x00,0x03,0xbd,0x06,0x83,0x80,0x3e,0x07,0x00,
+0x04,0x3d,0x06,0x83,0x80,0x3e,0x02,0x03,0x40,0x01,0x06,0x80,0x04,0xbd,0x07,0x00,
+0x05,0x3d,0x06,0x83,0x80,0x3e,0x07,0x00,0x05,0xbd,0x06,0x83,0x80,0x3e,0x02,0x83,
+0x40,0x01,0x06,0x80,0x06,0x3d,0x07,0x00,0x06,0xbd,0x06,0x83,0x80,0x3e,0x07,0x00,
+0x07,0x3d,0x06,0x83,0x80,0x3e,0x07,0x00,0x07,0xbd,0x06,0x83,0x80,0x3e,0x07,0x00,
+0x06,0x3d,0x06,0x83,0x80,0x3e,0x03,0x03,0x40,0x01,0x03,0x80,0x08,0x3d,0x04,0x00,
+0x08,0xbd,0x04,0x80,0x09,0x3d,0x06,0x80,0x09,0xbd,0x07,0x40,0x00,0x03,0x06,0x83,
+0x80,0x3e,0x07,0x00,0x0a,0x3d,0x06,0x83,0x80,0x3e,0x07,0x00,0x09,0xbd,0x07,0xc0,
+0x00,0x83,0x07,0x03,0xc0,0x3e,0x07,0x80,0x0a,0x3d,0x07,0x03,0xc0,0x3e,0x07,0x80,
+0x0a,0xbd,0x05,0x03,0x41,0xb7,0x06,0x80,0x0b,0x3d,0x06,0x80,0x40,0x20,0x05,0x83,
+0x40,0x01,0x06,0x00,0x0b,0xbd,0x06,0x80,0x40,0x01,0x07,0x00,0x00,0x3d,0x06,0x80,
+0x80,0xb2,0x06,0xc0,0x01,0x99,0x06,0x80,0x80,0x01,0x07,0x00,0x00,0xbd,0x06,0x80,
+0x80,0xb2,0x06,0xc0,0x03,0x19,0x06,0x80,0xc0,0x01,0x07,0x00,0x01,0x3d,0x07,0x80,
+0x01,0xbd,0x08,0x00,0x02,0x3d,0x07,0x03,0x81,0xb7,0x06,0x80,0x80,0xb2,0x06,0xc0,
+0x01,0x99,0x06,0x81,0x00,0x01,0x07,0x00,0x0c,0x3d,0x06,0x80,0x80,0xb2,0x06,0xc0,
+0x01,0x99,0x06,0x81,0x40,0x01,0x07,0x00,0x0c,0xbd,0x06,0x80,0x80,0xb2,0x06,0xc0,
+0x01,0x99,0x06,0x81,0x80,0x01,0x07,0x00,0x0d,0x3d,0x06,0x80,0x80,0xb2,0x06,0xc0,
+0x01,0x99,0x06,0x81,0xc0,0x01,0x07,0x00,0x08,0x3d,0x06,0x80,0x80,0xb2,0x06,0xc0,
+0x01,0x99,0x06,0x82,0x00,0x01,0x07,0x00,0x08,0xbd,0x06,0x80,0x80,0xb2,0x06,0xc0,
+0x01,0x99,0x06,0x82,0x40,0x01,0x07,0x00,0x09,0x3d,0x06,0x80,0x80,0xb2,0x06,0xc0,
+0x03,0x19,0x06,0x82,0x80,0x01,0x07,0x00,0x0d,0xbd,0x07,0x80,0x0e,0x3d,0x08,0x00,
+0x0a,0xbd,0x07,0x03,0x81,0xb7,0x06,0x80,0x80,0xb2,0x06,0xc0,0x01,0x99,0x06,0x82,
+0xc0,0x01,0x07,0x40,0x3d,0x03,0x06,0x80,0x80,0xb2,0x06,0xc0,0x01,0x99,0x06,0x83,
+0x00,0x01,0x07,0x00,0x0b,0xbd,0x06,0x80,0x80,0xb2,0x06,0x80,0x00,0x29,0x00,0x00,
+0x00,0x1d,0x10,0x00,0x04,0x61,0x61,0x61,0x0a,0x10,0x00,0x04,0x62,0x62,0x62,0x0a,
+0x10,0x00,0x03,0x63,0x31,0x0a,0x10,0x00,0x04,0x63,0x20,0x32,0x0a,0x10,0x00,0x05,
+0x63,0x20,0x20,0x33,0x0a,0x10,0x00,0x01,0x64,0x10,0x00,0x04,0x44,0x44,0x44,0x0a,
+0x10,0x00,0x03,0x64,0x09,0x0a,0x10,0x00,0x05,0x44,0x44,0x44,0x0a,0x0a,0x10,0x00,
+0x0b,0x65,0x23,0x7b,0x31,0x2b,0x32,0x7d,0x45,0x45,0x45,0x0a,0x10,0x00,0x04,0x65,
+0x5c,0x74,0x0a,0x10,0x00,0x06,0x45,0x45,0x45,0x5c,0x6e,0x0a,0x10,0x00,0x02,0x46,
+0x0a,0x10,0x00,0x02,0x46,0x46,0x10,0x00,0x01,0x66,0x10,0x00,0x04,0x46,0x46,0x46,
+0x0a,0x10,0x00,0x06,0x20,0x20,0x67,0x67,0x67,0x0a,0x10,0x00,0x06,0x20,0x20,0x68,
+0x68,0x68,0x0a,0x10,0x00,0x06,0x20,0x20,0x69,0x69,0x69,0x0a,0x10,0x00,0x03,0x20,
+0x20,0x6a,0x10,0x00,0x02,0x6a,0x0a,0x10,0x00,0x09,0x20,0x20,0x6a,0x23,0x7b,0x33,
+0x7d,0x6a,0x0a,0x10,0x00,0x04,0x31,0x32,0x33,0x0a,0x10,0x00,0x00,0x10,0x00,0x0e,
+0x64,0x33,0x44,0x44,0x44,0x0a,0x64,0x09,0x0a,0x44,0x44,0x44,0x0a,0x0a,0x10,0x00,
+0x15,0x65,0x23,0x7b,0x31,0x2b,0x32,0x7d,0x45,0x45,0x45,0x0a,0x65,0x5c,0x74,0x0a,
+0x45,0x45,0x45,0x5c,0x6e,0x0a,0x10,0x00,0x0b,0x46,0x0a,0x46,0x46,0x66,0x46,0x46,
+0x46,0x0a,0x46,0x0a,0x10,0x00,0x06,0x20,0x20,0x6a,0x31,0x6a,0x0a,0x10,0x00,0x06,
+0x20,0x20,0x6a,0x32,0x6a,0x0a,0x00,0x00,0x00,0x03,0x00,0x01,0x2b,0x00,0x00,0x04,
+0x74,0x6f,0x5f,0x69,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x03,0xaf,0x00,0x0b,
+0x00,0x12,0x00,0x00,0x00,0xb4,0x05,0x80,0x00,0x3d,0x06,0x40,0x00,0x03,0x06,0x00,
+0x01,0x2d,0x05,0x83,0x00,0x3e,0x06,0x00,0x00,0xbd,0x05,0x83,0x00,0x3e,0x06,0x00,
+0x01,0x3d,0x00,0x82,0xc1,0x37,0x05,0x80,0x00,0x3d,0x06,0x00,0x01,0xbd,0x06,0xc0,
+0x00,0x83,0x06,0x80,0x01,0xad,0x06,0x03,0x40,0x3e,0x06,0x80,0x00,0xbd,0x07,0x00,
+0x02,0x3d,0x01,0x02,0xc2,0x37,0x05,0x80,0x01,0xbd,0x06,0x40,0x01,0x03,0x06,0x00,
+0x02,0x2d,0x05,0x83,0x00,0x3e,0x01,0x82,0xc0,0xb7,0x05,0x80,0x01,0xbd,0x06,0x40,
+0x01,0x83,0x06,0x00,0x02,0xad,0x05,0x83,0x00,0x3e,0x02,0x02,0xc0,0xb7,0x02,0x82,
+0xc0,0x37,0x05,0x80,0x02,0xbd,0x06,0x00,0x03,0x3d,0x03,0x02,0xc1,0x37,0x05,0x80,
+0x03,0xbd,0x06,0x00,0x01,0xbd,0x06,0xbf,0xff,0x03,0x06,0x03,0x40,0x3e,0x06,0x80,
+0x04,0x3d,0x06,0x03,0x40,0x3e,0x06,0x80,0x04,0xbd,0x07,0x40,0x00,0x83,0x06,0x83,
+0x80,0x3e,0x03,0x82,0xc1,0xb7,0x05,0x80,0x05,0x3d,0x06,0x00,0x05,0xbd,0x06,0x80,
+0x06,0x3d,0x07,0x00,0x06,0xbd,0x07,0x80,0x07,0x3d,0x08,0x00,0x07,0x3d,0x04,0x02,
+0xc3,0x37,0x05,0x80,0x40,0x01,0x06,0x00,0x07,0xbd,0x06,0x80,0x01,0x3d,0x06,0x03,
+0x01,0x37,0x05,0x80,0x40,0xb2,0x05,0xc0,0x03,0x99,0x05,0x80,0x80,0x01,0x06,0x00,
+0x00,0x3d,0x06,0x80,0x08,0x3d,0x07,0x00,0x00,0xbd,0x07,0x80,0x02,0x3d,0x06,0x03,
+0x02,0x37,0x05,0x80,0x40,0xb2,0x05,0xc0,0x02,0x19,0x05,0x80,0xc0,0x01,0x06,0x00,
+0x08,0xbd,0x06,0x03,0x00,0xb7,0x05,0x80,0x40,0xb2,0x05,0xc0,0x02,0x19,0x05,0x81,
+0x00,0x01,0x06,0x00,0x09,0x3d,0x06,0x03,0x00,0xb7,0x05,0x80,0x40,0xb2,0x05,0xc0,
+0x01,0x99,0x05,0x81,0x40,0x01,0x06,0x03,0x00,0x37,0x05,0x80,0x40,0xb2,0x05,0xc0,
+0x02,0x99,0x05,0x81,0x80,0x01,0x06,0x00,0x02,0xbd,0x06,0x80,0x03,0x3d,0x06,0x03,
+0x01,0x37,0x05,0x80,0x40,0xb2,0x05,0xc0,0x03,0x19,0x05,0x81,0xc0,0x01,0x06,0x00,
+0x03,0xbd,0x06,0x80,0x09,0xbd,0x07,0x00,0x0a,0x3d,0x06,0x03,0x01,0xb7,0x05,0x80,
+0x40,0xb2,0x05,0xc0,0x04,0x99,0x05,0x82,0x00,0x01,0x06,0x00,0x05,0x3d,0x06,0x80,
+0x05,0xbd,0x07,0x00,0x06,0x3d,0x07,0x80,0x06,0xbd,0x08,0x00,0x07,0x3d,0x08,0x80,
+0x07,0x3d,0x06,0x03,0x03,0x37,0x05,0x80,0x40,0xb2,0x04,0x82,0xc0,0x01,0x05,0x80,
+0x0a,0xbd,0x06,0x00,0x01,0x3d,0x00,0x82,0xc1,0x37,0x05,0x80,0x00,0x3d,0x06,0x00,
+0x0b,0x3d,0x06,0x80,0x00,0xbd,0x07,0x00,0x02,0x3d,0x01,0x02,0xc2,0x37,0x05,0x80,
+0x0b,0xbd,0x01,0x82,0xc0,0xb7,0x05,0x80,0x0c,0x3d,0x02,0x02,0xc0,0xb7,0x02,0x82,
+0xc0,0x37,0x05,0x80,0x02,0xbd,0x06,0x00,0x03,0x3d,0x03,0x02,0xc1,0x37,0x05,0x80,
+0x03,0xbd,0x06,0x00,0x0c,0xbd,0x06,0x80,0x0d,0x3d,0x03,0x82,0xc1,0xb7,0x05,0x80,
+0x0d,0xbd,0x06,0x00,0x05,0xbd,0x06,0x80,0x06,0x3d,0x07,0x00,0x07,0x3d,0x07,0x80,
+0x07,0x3d,0x08,0x00,0x0e,0x3d,0x04,0x02,0xc3,0x37,0x05,0x80,0x40,0x01,0x06,0x00,
+0x0a,0xbd,0x06,0x80,0x01,0x3d,0x06,0x03,0x01,0x37,0x05,0x80,0x40,0xb2,0x05,0xc0,
+0x03,0x99,0x05,0x80,0x80,0x01,0x06,0x00,0x00,0x3d,0x06,0x80,0x0b,0x3d,0x07,0x00,
+0x00,0xbd,0x07,0x80,0x02,0x3d,0x06,0x03,0x02,0x37,0x05,0x80,0x40,0xb2,0x05,0xc0,
+0x02,0x19,0x05,0x80,0xc0,0x01,0x06,0x00,0x0b,0xbd,0x06,0x03,0x00,0xb7,0x05,0x80,
+0x40,0xb2,0x05,0xc0,0x02,0x19,0x05,0x81,0x00,0x01,0x06,0x00,0x0c,0x3d,0x06,0x03,
+0x00,0xb7,0x05,0x80,0x40,0xb2,0x05,0xc0,0x01,0x99,0x05,0x81,0x40,0x01,0x06,0x03,
+0x00,0x37,0x05,0x80,0x40,0xb2,0x05,0xc0,0x02,0x99,0x05,0x81,0x80,0x01,0x06,0x00,
+0x02,0xbd,0x06,0x80,0x03,0x3d,0x06,0x03,0x01,0x37,0x05,0x80,0x40,0xb2,0x05,0xc0,
+0x03,0x19,0x05,0x81,0xc0,0x01,0x06,0x00,0x03,0xbd,0x06,0x80,0x0c,0xbd,0x07,0x00,
+0x0d,0x3d,0x06,0x03,0x01,0xb7,0x05,0x80,0x40,0xb2,0x05,0xc0,0x04,0x99,0x05,0x82,
+0x00,0x01,0x06,0x00,0x0d,0xbd,0x06,0x80,0x05,0xbd,0x07,0x00,0x06,0x3d,0x07,0x80,
+0x07,0x3d,0x08,0x00,0x07,0x3d,0x08,0x80,0x0e,0x3d,0x06,0x03,0x03,0x37,0x05,0x80,
+0x40,0xb2,0x05,0x02,0xc0,0x01,0x05,0x82,0x40,0x01,0x05,0xc0,0x00,0x99,0x05,0x82,
+0x80,0x01,0x05,0x80,0x00,0x29,0x00,0x00,0x00,0x1d,0x10,0x00,0x03,0x61,0x62,0x63,
+0x10,0x00,0x03,0x64,0x65,0x66,0x10,0x00,0x02,0x7d,0x67,0x10,0x00,0x00,0x10,0x00,
+0x02,0x28,0x67,0x10,0x00,0x03,0x5b,0x61,0x62,0x10,0x00,0x07,0x63,0x64,0x5d,0x5b,
+0x65,0x66,0x5d,0x10,0x00,0x02,0x61,0x62,0x10,0x00,0x01,0x31,0x10,0x00,0x01,0x32,
+0x10,0x00,0x03,0x61,0x0a,0x62,0x10,0x00,0x08,0x74,0x65,0x73,0x74,0x20,0x61,0x62,
+0x63,0x10,0x00,0x03,0x63,0x0a,0x64,0x10,0x00,0x02,0x78,0x79,0x10,0x00,0x03,0x78,
+0x5c,0x79,0x10,0x00,0x07,0x61,0x62,0x63,0x33,0x64,0x65,0x66,0x10,0x00,0x01,0x35,
+0x10,0x00,0x01,0x37,0x10,0x00,0x01,0x39,0x10,0x00,0x03,0x2d,0x31,0x31,0x10,0x00,
+0x02,0x32,0x32,0x10,0x00,0x0c,0x61,0x62,0x63,0x23,0x7b,0x31,0x2b,0x32,0x7d,0x64,
+0x65,0x66,0x10,0x00,0x06,0x23,0x7b,0x32,0x2b,0x33,0x7d,0x10,0x00,0x06,0x23,0x7b,
+0x33,0x2b,0x34,0x7d,0x10,0x00,0x06,0x23,0x7b,0x34,0x2b,0x35,0x7d,0x10,0x00,0x06,
+0x23,0x7b,0x2d,0x31,0x7d,0x31,0x10,0x00,0x05,0x32,0x23,0x7b,0x32,0x7d,0x10,0x00,
+0x04,0x61,0x5c,0x6e,0x62,0x10,0x00,0x04,0x78,0x5c,0x5c,0x79,0x00,0x00,0x00,0x02,
+0x00,0x01,0x2b,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x03,0xce,0x00,0x0a,0x00,
+0x0f,0x00,0x00,0x00,0xac,0x05,0x00,0x00,0x3d,0x05,0xc0,0x00,0x03,0x05,0x80,0x01,
+0x2d,0x05,0x02,0xc0,0x3e,0x05,0x80,0x00,0xbd,0x05,0x02,0xc0,0x3e,0x05,0x00,0x40,
+0x20,0x05,0x80,0x01,0x3d,0x05,0x80,0x40,0x20,0x00,0x82,0x81,0x37,0x05,0x00,0x00,
+0x3d,0x05,0x00,0x40,0x20,0x05,0x80,0x01,0xbd,0x06,0x40,0x00,0x83,0x06,0x00,0x01,
+0xad,0x05,0x83,0x00,0x3e,0x05,0x80,0x40,0x20,0x06,0x00,0x00,0xbd,0x06,0x00,0x40,
+0x20,0x06,0x80,0x02,0x3d,0x06,0x80,0x40,0x20,0x01,0x02,0x82,0x37,0x05,0x00,0x01,
+0xbd,0x05,0xc0,0x01,0x03,0x05,0x80,0x02,0x2d,0x05,0x02,0xc0,0x3e,0x05,0x00,0x40,
+0x20,0x01,0x82,0x80,0xb7,0x05,0x00,0x01,0xbd,0x05,0xc0,0x01,0x83,0x05,0x80,0x02,
+0xad,0x05,0x02,0xc0,0x3e,0x05,0x00,0x40,0x20,0x02,0x02,0x80,0xb7,0x02,0x82,0x80,
+0x37,0x05,0x00,0x02,0xbd,0x05,0x00,0x40,0x20,0x05,0x80,0x03,0x3d,0x05,0x80,0x40,
+0x20,0x03,0x02,0x81,0x37,0x05,0x00,0x03,0xbd,0x05,0x00,0x40,0x20,0x05,0x80,0x01,
+0xbd,0x06,0x3f,0xff,0x03,0x05,0x83,0x00,0x3e,0x06,0x00,0x04,0x3d,0x05,0x83,0x00,
+0x3e,0x05,0x80,0x40,0x20,0x06,0x00,0x04,0xbd,0x06,0xc0,0x00,0x83,0x06,0x03,0x40,
+0x3e,0x06,0x00,0x40,0x20,0x03,0x82,0x81,0xb7,0x05,0x00,0x40,0x01,0x05,0x80,0x01,
+0x84,0x06,0x00,0x02,0x04,0x05,0x82,0xc1,0x37,0x05,0x00,0x80,0xb2,0x05,0x40,0x03,
+0x99,0x05,0x00,0x80,0x01,0x05,0x80,0x02,0x84,0x06,0x00,0x03,0x04,0x06,0x80,0x03,
+0x84,0x07,0x00,0x04,0x04,0x05,0x82,0xc2,0x37,0x05,0x00,0x80,0xb2,0x05,0x40,0x02,
+0x19,0x05,0x00,0xc0,0x01,0x05,0x80,0x04,0x84,0x05,0x82,0xc0,0xb7,0x05,0x00,0x80,
+0xb2,0x05,0x40,0x02,0x19,0x05,0x01,0x00,0x01,0x05,0x80,0x05,0x04,0x05,0x82,0xc0,
+0xb7,0x05,0x00,0x80,0xb2,0x05,0x40,0x01,0x99,0x05,0x01,0x40,0x01,0x05,0x82,0xc0,
+0x37,0x05,0x00,0x80,0xb2,0x05,0x40,0x02,0x99,0x05,0x01,0x80,0x01,0x05,0x80,0x05,
+0x84,0x06,0x00,0x06,0x04,0x05,0x82,0xc1,0x37,0x05,0x00,0x80,0xb2,0x05,0x40,0x03,
+0x19,0x05,0x01,0xc0,0x01,0x05,0x80,0x06,0x84,0x06,0x00,0x07,0x04,0x06,0x80,0x07,
+0x84,0x05,0x82,0xc1,0xb7,0x05,0x00,0x80,0xb2,0x04,0x02,0x80,0x01,0x05,0x00,0x05,
+0x3d,0x05,0x00,0x40,0x20,0x05,0x80,0x01,0x3d,0x05,0x80,0x40,0x20,0x00,0x82,0x81,
+0x37,0x05,0x00,0x00,0x3d,0x05,0x00,0x40,0x20,0x05,0x80,0x05,0xbd,0x05,0x80,0x40,
+0x20,0x06,0x00,0x00,0xbd,0x06,0x00,0x40,0x20,0x06,0x80,0x02,0x3d,0x06,0x80,0x40,
+0x20,0x01,0x02,0x82,0x37,0x05,0x00,0x06,0x3d,0x05,0x00,0x40,0x20,0x01,0x82,0x80,
+0xb7,0x05,0x00,0x06,0xbd,0x05,0x00,0x40,0x20,0x02,0x02,0x80,0xb7,0x02,0x82,0x80,
+0x37,0x05,0x00,0x02,0xbd,0x05,0x00,0x40,0x20,0x05,0x80,0x03,0x3d,0x05,0x80,0x40,
+0x20,0x03,0x02,0x81,0x37,0x05,0x00,0x03,0xbd,0x05,0x00,0x40,0x20,0x05,0x80,0x07,
+0x3d,0x05,0x80,0x40,0x20,0x06,0x00,0x07,0xbd,0x06,0x00,0x40,0x20,0x03,0x82,0x81,
+0xb7,0x05,0x00,0x40,0x01,0x05,0x80,0x08,0x04,0x06,0x00,0x02,0x04,0x05,0x82,0xc1,
+0x37,0x05,0x00,0x80,0xb2,0x05,0x40,0x03,0x99,0x05,0x00,0x80,0x01,0x05,0x80,0x02,
+0x84,0x06,0x00,0x08,0x84,0x06,0x80,0x03,0x84,0x07,0x00,0x04,0x04,0x05,0x82,0xc2,
+0x37,0x05,0x00,0x80,0xb2,0x05,0x40,0x02,0x19,0x05,0x00,0xc0,0x01,0x05,0x80,0x09,
+0x04,0x05,0x82,0xc0,0xb7,0x05,0x00,0x80,0xb2,0x05,0x40,0x02,0x19,0x05,0x01,0x00,
+0x01,0x05,0x80,0x09,0x84,0x05,0x82,0xc0,0xb7,0x05,0x00,0x80,0xb2,0x05,0x40,0x01,
+0x99,0x05,0x01,0x40,0x01,0x05,0x82,0xc0,0x37,0x05,0x00,0x80,0xb2,0x05,0x40,0x02,
+0x99,0x05,0x01,0x80,0x01,0x05,0x80,0x05,0x84,0x06,0x00,0x06,0x04,0x05,0x82,0xc1,
+0x37,0x05,0x00,0x80,0xb2,0x05,0x40,0x03,0x19,0x05,0x01,0xc0,0x01,0x05,0x80,0x06,
+0x84,0x06,0x00,0x0a,0x04,0x06,0x80,0x0a,0x84,0x05,0x82,0xc1,0xb7,0x05,0x00,0x80,
+0xb2,0x04,0x82,0x80,0x01,0x05,0x02,0x00,0x01,0x05,0x40,0x00,0x99,0x05,0x02,0x40,
+0x01,0x05,0x00,0x00,0x29,0x00,0x00,0x00,0x10,0x10,0x00,0x03,0x61,0x62,0x63,0x10,
+0x00,0x03,0x64,0x65,0x66,0x10,0x00,0x02,0x7d,0x67,0x10,0x00,0x00,0x10,0x00,0x02,
+0x28,0x67,0x10,0x00,0x03,0x5b,0x61,0x62,0x10,0x00,0x07,0x63,0x64,0x5d,0x5b,0x65,
+0x66,0x5d,0x10,0x00,0x02,0x61,0x62,0x10,0x00,0x01,0x31,0x10,0x00,0x01,0x32,0x10,
+0x00,0x0c,0x61,0x62,0x63,0x23,0x7b,0x31,0x2b,0x32,0x7d,0x64,0x65,0x66,0x10,0x00,
+0x06,0x23,0x7b,0x32,0x2b,0x33,0x7d,0x10,0x00,0x06,0x23,0x7b,0x33,0x2b,0x34,0x7d,
+0x10,0x00,0x06,0x23,0x7b,0x34,0x2b,0x35,0x7d,0x10,0x00,0x06,0x23,0x7b,0x2d,0x31,
+0x7d,0x31,0x10,0x00,0x05,0x32,0x23,0x7b,0x32,0x7d,0x00,0x00,0x00,0x16,0x00,0x01,
+0x2b,0x00,0x00,0x06,0x69,0x6e,0x74,0x65,0x72,0x6e,0x00,0x00,0x02,0x3d,0x3d,0x00,
+0x00,0x07,0x61,0x62,0x63,0x33,0x64,0x65,0x66,0x00,0x00,0x02,0x7d,0x67,0x00,0x00,
+0x03,0x61,0x62,0x63,0x00,0x00,0x01,0x35,0x00,0x00,0x03,0x64,0x65,0x66,0x00,0x00,
+0x02,0x28,0x67,0x00,0x00,0x01,0x37,0x00,0x00,0x01,0x39,0x00,0x00,0x03,0x5b,0x61,
+0x62,0x00,0x00,0x07,0x63,0x64,0x5d,0x5b,0x65,0x66,0x5d,0x00,0x00,0x02,0x61,0x62,
+0x00,0x00,0x03,0x2d,0x31,0x31,0x00,0x00,0x02,0x32,0x32,0x00,0x00,0x0c,0x61,0x62,
+0x63,0x23,0x7b,0x31,0x2b,0x32,0x7d,0x64,0x65,0x66,0x00,0x00,0x06,0x23,0x7b,0x32,
+0x2b,0x33,0x7d,0x00,0x00,0x06,0x23,0x7b,0x33,0x2b,0x34,0x7d,0x00,0x00,0x06,0x23,
+0x7b,0x34,0x2b,0x35,0x7d,0x00,0x00,0x06,0x23,0x7b,0x2d,0x31,0x7d,0x31,0x00,0x00,
+0x05,0x32,0x23,0x7b,0x32,0x7d,0x00,0x00,0x00,0x01,0x3a,0x00,0x09,0x00,0x0c,0x00,
+0x00,0x00,0x2f,0x00,0x80,0x00,0x04,0x01,0x00,0x00,0x84,0x04,0x80,0x00,0x3d,0x05,
+0x40,0x00,0x03,0x05,0x00,0x81,0x2d,0x04,0x82,0x80,0x3e,0x05,0x00,0x00,0xbd,0x04,
+0x82,0x80,0x3e,0x04,0x80,0xc0,0x20,0x01,0x82,0x40,0x01,0x02,0x00,0x02,0x04,0x02,
+0x80,0x02,0x84,0x03,0x00,0x03,0x04,0x03,0x80,0x03,0x84,0x04,0x00,0x04,0x04,0x04,
+0x80,0x40,0x01,0x05,0x00,0x00,0x04,0x04,0x82,0x40,0xb2,0x04,0xc0,0x01,0x99,0x04,
+0x80,0x80,0x01,0x05,0x00,0x00,0x84,0x04,0x82,0x40,0xb2,0x04,0xc0,0x01,0x99,0x04,
+0x80,0xc0,0x01,0x05,0x00,0x05,0x04,0x04,0x82,0x40,0xb2,0x04,0xc0,0x01,0x99,0x04,
+0x81,0x00,0x01,0x05,0x00,0x02,0x04,0x04,0x82,0x40,0xb2,0x04,0xc0,0x01,0x99,0x04,
+0x81,0x40,0x01,0x05,0x00,0x02,0x84,0x04,0x82,0x40,0xb2,0x04,0xc0,0x01,0x99,0x04,
+0x81,0x80,0x01,0x05,0x00,0x03,0x04,0x04,0x82,0x40,0xb2,0x04,0xc0,0x01,0x99,0x04,
+0x81,0xc0,0x01,0x05,0x00,0x03,0x84,0x04,0x82,0x40,0xb2,0x04,0xc0,0x01,0x99,0x04,
+0x82,0x00,0x01,0x05,0x00,0x04,0x04,0x04,0x82,0x40,0xb2,0x04,0x80,0x00,0x29,0x00,
+0x00,0x00,0x02,0x10,0x00,0x01,0x61,0x10,0x00,0x01,0x62,0x00,0x00,0x00,0x0b,0x00,
+0x07,0x61,0x73,0x64,0x20,0x71,0x77,0x65,0x00,0x00,0x07,0x66,0x6f,0x6f,0x20,0x62,
+0x61,0x72,0x00,0x00,0x01,0x2b,0x00,0x00,0x06,0x69,0x6e,0x74,0x65,0x72,0x6e,0x00,
+0x00,0x03,0x61,0x73,0x64,0x00,0x00,0x06,0x20,0x66,0x6f,0x6f,0x20,0x29,0x00,0x00,
+0x09,0x61,0x73,0x64,0x20,0x5b,0x0a,0x71,0x77,0x65,0x00,0x00,0x0c,0x66,0x6f,0x6f,
+0x23,0x7b,0x31,0x2b,0x32,0x7d,0x62,0x61,0x72,0x00,0x00,0x09,0x7b,0x66,0x6f,0x6f,
+0x20,0x62,0x61,0x72,0x7d,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x03,0x61,0x33,0x62,
+0x00,0x00,0x00,0x00,0xbf,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x17,0x00,0x40,0x01,
+0x1a,0x00,0x80,0x00,0x4b,0x00,0x40,0x04,0x97,0x01,0x00,0x00,0x1b,0x01,0x80,0x00,
+0x11,0x02,0x00,0x80,0x01,0x01,0x80,0x40,0xa0,0x01,0xc0,0x00,0x98,0x00,0x40,0x01,
+0x17,0x00,0x80,0x80,0x01,0x00,0x40,0x01,0x17,0x01,0x00,0x00,0x1d,0x00,0x80,0x00,
+0x1c,0x01,0x00,0x01,0x11,0x01,0x00,0xc0,0x20,0x01,0x80,0x02,0x91,0x01,0x01,0x00,
+0xb2,0x01,0x40,0x02,0x19,0x01,0x00,0x40,0x01,0x01,0x00,0xc0,0x20,0x01,0x80,0x01,
+0x11,0x01,0x01,0x00,0xb2,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x01,0x10,0x00,0x10,
+0x75,0x6e,0x65,0x78,0x70,0x65,0x63,0x74,0x65,0x64,0x20,0x72,0x65,0x74,0x72,0x79,
+0x00,0x00,0x00,0x06,0x00,0x0d,0x53,0x74,0x61,0x6e,0x64,0x61,0x72,0x64,0x45,0x72,
+0x72,0x6f,0x72,0x00,0x00,0x03,0x3d,0x3d,0x3d,0x00,0x00,0x0e,0x4c,0x6f,0x63,0x61,
+0x6c,0x4a,0x75,0x6d,0x70,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x05,0x63,0x6c,0x61,
+0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x43,0x6c,0x61,0x73,0x73,0x00,
+0x00,0x00,0x00,0x46,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x11,
+0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x06,0x4d,0x6f,0x64,0x75,0x6c,0x65,
+0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,
+0x43,0x6c,0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x4c,0x00,0x01,0x00,0x03,0x00,0x00,
+0x00,0x05,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,
+0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x06,
+0x4d,0x6f,0x64,0x75,0x6c,0x65,0x00,0x00,0x0a,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,
+0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,
+0x74,0x00,0x00,0x00,0x00,0x92,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x10,0x01,0x00,
+0x00,0x11,0x01,0x00,0x40,0x20,0x00,0x80,0x80,0x01,0x01,0x00,0x40,0x01,0x01,0x00,
+0x80,0x20,0x01,0x80,0x02,0x11,0x01,0x00,0xc0,0xb2,0x01,0x40,0x01,0x99,0x01,0x00,
+0x40,0x01,0x01,0x80,0x00,0x11,0x01,0x01,0x40,0xa0,0x01,0x40,0x01,0x99,0x01,0x00,
+0x40,0x01,0x01,0x80,0x03,0x11,0x01,0x01,0x40,0xa0,0x01,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x06,0x53,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,
+0x09,0x61,0x6e,0x63,0x65,0x73,0x74,0x6f,0x72,0x73,0x00,0x00,0x05,0x63,0x6c,0x61,
+0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x41,0x72,0x72,0x61,0x79,0x00,
+0x00,0x08,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x3f,0x00,0x00,0x06,0x4f,0x62,0x6a,
+0x65,0x63,0x74,0x00,0x00,0x00,0x00,0x9a,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0c,
+0x00,0x80,0x00,0x05,0x00,0x80,0x00,0x44,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x05,
+0x00,0x80,0x40,0x44,0x00,0x80,0x01,0xc5,0x00,0x80,0x00,0x91,0x01,0x00,0x01,0x84,
+0x00,0x80,0x80,0xa0,0x01,0x00,0x00,0x91,0x00,0x81,0x00,0xb2,0x00,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x13,0x54,0x65,0x73,0x74,0x34,0x41,
+0x70,0x70,0x65,0x6e,0x64,0x46,0x65,0x61,0x74,0x75,0x72,0x65,0x73,0x00,0x00,0x14,
+0x54,0x65,0x73,0x74,0x34,0x41,0x70,0x70,0x65,0x6e,0x64,0x46,0x65,0x61,0x74,0x75,
+0x72,0x65,0x73,0x32,0x00,0x00,0x09,0x63,0x6f,0x6e,0x73,0x74,0x5f,0x67,0x65,0x74,
+0x00,0x00,0x15,0x43,0x6f,0x6e,0x73,0x74,0x34,0x41,0x70,0x70,0x65,0x6e,0x64,0x46,
+0x65,0x61,0x74,0x75,0x72,0x65,0x73,0x32,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,
+0x00,0x3e,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x06,0x00,0x80,0x00,0x06,0x00,0x80,
+0x40,0x47,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x00,0x00,0x05,0x00,0x00,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x0f,0x61,0x70,0x70,0x65,
+0x6e,0x64,0x5f,0x66,0x65,0x61,0x74,0x75,0x72,0x65,0x73,0x00,0x00,0x00,0x00,0x67,
+0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x06,0x02,0x00,0x00,0x26,0x01,0x80,0x00,0x11,
+0x02,0x00,0x01,0x04,0x02,0x80,0x40,0x01,0x01,0x80,0x41,0x20,0x01,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x14,0x54,0x65,0x73,0x74,0x34,0x41,
+0x70,0x70,0x65,0x6e,0x64,0x46,0x65,0x61,0x74,0x75,0x72,0x65,0x73,0x32,0x00,0x00,
+0x09,0x63,0x6f,0x6e,0x73,0x74,0x5f,0x73,0x65,0x74,0x00,0x00,0x15,0x43,0x6f,0x6e,
+0x73,0x74,0x34,0x41,0x70,0x70,0x65,0x6e,0x64,0x46,0x65,0x61,0x74,0x75,0x72,0x65,
+0x73,0x32,0x00,0x00,0x00,0x00,0x44,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x04,0x00,
+0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x00,0x80,0x00,0xa0,0x01,0x00,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x07,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,
+0x00,0x00,0x13,0x54,0x65,0x73,0x74,0x34,0x41,0x70,0x70,0x65,0x6e,0x64,0x46,0x65,
+0x61,0x74,0x75,0x72,0x65,0x73,0x00,0x00,0x00,0x00,0xeb,0x00,0x02,0x00,0x04,0x00,
+0x00,0x00,0x1f,0x01,0x00,0x00,0x05,0x01,0x80,0x00,0x05,0x01,0x00,0x00,0x43,0x01,
+0x00,0x00,0xc5,0x01,0x00,0x00,0x11,0x01,0x80,0x05,0x40,0x01,0x00,0x40,0x21,0x01,
+0x00,0x00,0x11,0x01,0x00,0x80,0x20,0x00,0x80,0x80,0x01,0x01,0x00,0x00,0x11,0x01,
+0x80,0x09,0x40,0x01,0x00,0x40,0x21,0x01,0xc0,0x05,0x03,0x01,0x00,0xc0,0xb2,0x01,
+0x40,0x02,0x99,0x01,0x00,0x00,0x11,0x01,0x80,0x0b,0x40,0x01,0x00,0x40,0x21,0x01,
+0xc0,0x05,0x83,0x01,0x00,0xc0,0xb2,0x01,0x40,0x02,0x19,0x01,0x00,0x40,0x01,0x01,
+0x01,0x00,0x20,0x01,0x80,0x02,0x91,0x01,0x00,0xc0,0xb2,0x01,0x40,0x01,0x99,0x01,
+0x00,0x40,0x01,0x01,0x80,0x03,0x84,0x01,0x01,0x80,0xa0,0x01,0x00,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x0e,0x54,0x65,0x73,0x74,0x34,0x43,0x6c,
+0x61,0x73,0x73,0x45,0x76,0x61,0x6c,0x00,0x00,0x0a,0x63,0x6c,0x61,0x73,0x73,0x5f,
+0x65,0x76,0x61,0x6c,0x00,0x00,0x10,0x69,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x5f,
+0x6d,0x65,0x74,0x68,0x6f,0x64,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x63,
+0x6c,0x61,0x73,0x73,0x00,0x00,0x05,0x41,0x72,0x72,0x61,0x79,0x00,0x00,0x08,0x69,
+0x6e,0x63,0x6c,0x75,0x64,0x65,0x3f,0x00,0x00,0x07,0x6d,0x65,0x74,0x68,0x6f,0x64,
+0x31,0x00,0x00,0x00,0x00,0x32,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0xc0,
+0x05,0x03,0x00,0x80,0x00,0x0e,0x00,0xc0,0x05,0x83,0x00,0x80,0x00,0x8e,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x02,0x40,0x61,0x00,0x00,
+0x02,0x40,0x62,0x00,0x00,0x00,0x00,0x32,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x05,
+0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x00,0x00,0x05,
+0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x07,0x6d,0x65,
+0x74,0x68,0x6f,0x64,0x31,0x00,0x00,0x00,0x00,0x20,0x00,0x02,0x00,0x03,0x00,0x00,
+0x00,0x03,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,0x00,0x01,0x00,0x02,0x00,0x00,
+0x00,0x02,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x01,0x00,0x02,0x40,0x61,0x00,0x00,0x00,0x00,0x21,0x00,0x01,0x00,0x02,0x00,
+0x00,0x00,0x02,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x01,0x00,0x02,0x40,0x62,0x00,0x00,0x00,0x00,0x98,0x00,0x01,0x00,0x03,
+0x00,0x00,0x00,0x0d,0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x05,0x00,0x80,0x00,0x43,
+0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x11,0x01,0x00,0x01,0x04,0x00,0x80,0x40,0xa0,
+0x00,0xc0,0x02,0x19,0x00,0x80,0x00,0x11,0x01,0x00,0x01,0x84,0x00,0x80,0x40,0xa0,
+0x00,0x81,0x00,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,
+0x00,0x19,0x54,0x65,0x73,0x74,0x34,0x43,0x6c,0x61,0x73,0x73,0x56,0x61,0x72,0x69,
+0x61,0x62,0x6c,0x65,0x44,0x65,0x66,0x69,0x6e,0x65,0x64,0x00,0x00,0x17,0x63,0x6c,
+0x61,0x73,0x73,0x5f,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x5f,0x64,0x65,0x66,
+0x69,0x6e,0x65,0x64,0x3f,0x00,0x00,0x04,0x40,0x40,0x63,0x76,0x00,0x00,0x0c,0x40,
+0x40,0x6e,0x6f,0x65,0x78,0x69,0x73,0x74,0x69,0x6e,0x67,0x00,0x00,0x01,0x21,0x00,
+0x00,0x00,0x00,0x27,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x03,0x00,0xc0,0x31,0x03,
+0x00,0x80,0x00,0x10,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+0x00,0x04,0x40,0x40,0x63,0x76,0x00,0x00,0x00,0x00,0x75,0x00,0x01,0x00,0x03,0x00,
+0x00,0x00,0x0a,0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x05,0x00,0x80,0x00,0x43,0x00,
+0x80,0x00,0xc5,0x00,0x80,0x00,0x11,0x01,0x00,0x01,0x04,0x00,0x80,0x40,0xa0,0x01,
+0x40,0x31,0x03,0x00,0x80,0xc0,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x04,0x00,0x15,0x54,0x65,0x73,0x74,0x34,0x43,0x6c,0x61,0x73,0x73,0x56,
+0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x47,0x65,0x74,0x00,0x00,0x12,0x63,0x6c,0x61,
+0x73,0x73,0x5f,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x5f,0x67,0x65,0x74,0x00,
+0x00,0x04,0x40,0x40,0x63,0x76,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x27,
+0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x03,0x00,0xc0,0x31,0x03,0x00,0x80,0x00,0x10,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,0x40,0x40,
+0x63,0x76,0x00,0x00,0x00,0x01,0x07,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x1d,0x00,
+0x80,0x00,0x05,0x01,0x00,0x00,0x05,0x00,0x80,0x00,0x43,0x00,0x80,0x00,0xc5,0x00,
+0x80,0x00,0x11,0x01,0x00,0x01,0x04,0x01,0xc0,0x31,0x03,0x00,0x80,0x41,0x20,0x00,
+0x80,0x00,0x11,0x01,0x00,0x01,0x84,0x01,0xc0,0x32,0x03,0x00,0x80,0x41,0x20,0x00,
+0x80,0x00,0x11,0x00,0x81,0x00,0x20,0x01,0x00,0x01,0x04,0x00,0x81,0x40,0xa0,0x00,
+0xc0,0x02,0x99,0x00,0x80,0x00,0x11,0x01,0x00,0x01,0x04,0x00,0x81,0x80,0xa0,0x01,
+0x40,0x31,0x03,0x00,0x81,0xc0,0xb2,0x00,0xc0,0x02,0x99,0x00,0x80,0x00,0x11,0x00,
+0x82,0x00,0x20,0x00,0x82,0x40,0x20,0x01,0x40,0x32,0x03,0x00,0x81,0xc0,0xb2,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0x00,0x15,0x54,0x65,0x73,
+0x74,0x34,0x43,0x6c,0x61,0x73,0x73,0x56,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x53,
+0x65,0x74,0x00,0x00,0x12,0x63,0x6c,0x61,0x73,0x73,0x5f,0x76,0x61,0x72,0x69,0x61,
+0x62,0x6c,0x65,0x5f,0x73,0x65,0x74,0x00,0x00,0x04,0x40,0x40,0x63,0x76,0x00,0x00,
+0x05,0x40,0x40,0x66,0x6f,0x6f,0x00,0x00,0x0f,0x63,0x6c,0x61,0x73,0x73,0x5f,0x76,
+0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x73,0x00,0x00,0x08,0x69,0x6e,0x63,0x6c,0x75,
+0x64,0x65,0x3f,0x00,0x00,0x12,0x63,0x6c,0x61,0x73,0x73,0x5f,0x76,0x61,0x72,0x69,
+0x61,0x62,0x6c,0x65,0x5f,0x67,0x65,0x74,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x03,
+0x6e,0x65,0x77,0x00,0x00,0x03,0x66,0x6f,0x6f,0x00,0x00,0x00,0x00,0x3e,0x00,0x01,
+0x00,0x02,0x00,0x00,0x00,0x07,0x00,0xc0,0x31,0x83,0x00,0x80,0x00,0x10,0x00,0x80,
+0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x40,0x46,0x00,0x00,0x00,0x05,0x00,0x00,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x05,0x40,0x40,0x66,0x6f,
+0x6f,0x00,0x00,0x03,0x66,0x6f,0x6f,0x00,0x00,0x00,0x00,0x28,0x00,0x02,0x00,0x03,
+0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x05,0x40,0x40,0x66,0x6f,0x6f,0x00,
+0x00,0x00,0x00,0xbb,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x14,0x00,0x80,0x00,0x05,
+0x01,0x00,0x00,0x05,0x00,0x80,0x00,0x43,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x05,
+0x01,0x00,0x00,0x11,0x00,0x80,0x40,0x43,0x00,0x80,0x01,0x45,0x00,0x80,0x00,0x11,
+0x00,0x80,0x80,0x20,0x01,0x00,0x02,0x04,0x01,0x00,0x80,0xb7,0x00,0x80,0xc0,0xb2,
+0x00,0xc0,0x02,0x99,0x00,0x80,0x00,0x91,0x00,0x80,0x80,0x20,0x01,0x00,0x02,0x84,
+0x01,0x00,0x80,0xb7,0x00,0x80,0xc0,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x06,0x00,0x14,0x54,0x65,0x73,0x74,0x34,0x43,0x6c,0x61,0x73,0x73,
+0x56,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x73,0x31,0x00,0x00,0x14,0x54,0x65,0x73,
+0x74,0x34,0x43,0x6c,0x61,0x73,0x73,0x56,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x73,
+0x32,0x00,0x00,0x0f,0x63,0x6c,0x61,0x73,0x73,0x5f,0x76,0x61,0x72,0x69,0x61,0x62,
+0x6c,0x65,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x06,0x40,0x40,0x76,0x61,0x72,
+0x31,0x00,0x00,0x06,0x40,0x40,0x76,0x61,0x72,0x32,0x00,0x00,0x00,0x00,0x29,0x00,
+0x01,0x00,0x02,0x00,0x00,0x00,0x03,0x00,0xc0,0x00,0x03,0x00,0x80,0x00,0x10,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x06,0x40,0x40,0x76,
+0x61,0x72,0x31,0x00,0x00,0x00,0x00,0x29,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x03,
+0x00,0xc0,0x00,0x83,0x00,0x80,0x00,0x10,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x01,0x00,0x06,0x40,0x40,0x76,0x61,0x72,0x32,0x00,0x00,0x00,0x00,
+0x95,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0c,0x00,0x80,0x00,0x05,0x00,0x80,0x00,
+0x44,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x11,0x01,0x00,0x01,0x04,0x00,0x80,0x40,
+0xa0,0x00,0xc0,0x02,0x19,0x00,0x80,0x00,0x11,0x01,0x00,0x01,0x84,0x00,0x80,0x40,
+0xa0,0x00,0x81,0x00,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x05,0x00,0x11,0x54,0x65,0x73,0x74,0x34,0x43,0x6f,0x6e,0x73,0x74,0x44,0x65,0x66,
+0x69,0x6e,0x65,0x64,0x00,0x00,0x0e,0x63,0x6f,0x6e,0x73,0x74,0x5f,0x64,0x65,0x66,
+0x69,0x6e,0x65,0x64,0x3f,0x00,0x00,0x17,0x43,0x6f,0x6e,0x73,0x74,0x34,0x54,0x65,
+0x73,0x74,0x34,0x43,0x6f,0x6e,0x73,0x74,0x44,0x65,0x66,0x69,0x6e,0x65,0x64,0x00,
+0x00,0x0b,0x4e,0x6f,0x74,0x45,0x78,0x69,0x73,0x74,0x69,0x6e,0x67,0x00,0x00,0x01,
+0x21,0x00,0x00,0x00,0x00,0x3a,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x03,0x00,0x80,
+0x00,0x07,0x00,0x80,0x00,0x12,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x01,0x00,0x17,0x43,0x6f,0x6e,0x73,0x74,0x34,0x54,0x65,0x73,0x74,0x34,0x43,
+0x6f,0x6e,0x73,0x74,0x44,0x65,0x66,0x69,0x6e,0x65,0x64,0x00,0x00,0x00,0x00,0x6f,
+0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x09,0x00,0x80,0x00,0x05,0x00,0x80,0x00,0x44,
+0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x11,0x01,0x00,0x01,0x04,0x00,0x80,0x40,0xa0,
+0x01,0x40,0x14,0x83,0x00,0x80,0xc0,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x04,0x00,0x0d,0x54,0x65,0x73,0x74,0x34,0x43,0x6f,0x6e,0x73,0x74,
+0x47,0x65,0x74,0x00,0x00,0x09,0x63,0x6f,0x6e,0x73,0x74,0x5f,0x67,0x65,0x74,0x00,
+0x00,0x13,0x43,0x6f,0x6e,0x73,0x74,0x34,0x54,0x65,0x73,0x74,0x34,0x43,0x6f,0x6e,
+0x73,0x74,0x47,0x65,0x74,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x36,0x00,
+0x01,0x00,0x02,0x00,0x00,0x00,0x03,0x00,0xc0,0x14,0x83,0x00,0x80,0x00,0x12,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x13,0x43,0x6f,0x6e,
+0x73,0x74,0x34,0x54,0x65,0x73,0x74,0x34,0x43,0x6f,0x6e,0x73,0x74,0x47,0x65,0x74,
+0x00,0x00,0x00,0x00,0x74,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x0a,0x00,0x80,0x00,
+0x05,0x01,0x00,0x00,0x05,0x01,0x00,0x00,0x44,0x01,0x00,0x00,0xc5,0x01,0x00,0x00,
+0x11,0x01,0x80,0x01,0x04,0x01,0x00,0x40,0xa0,0x01,0xc0,0x14,0x83,0x01,0x00,0xc0,
+0xb2,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x11,0x54,
+0x65,0x73,0x74,0x34,0x43,0x6f,0x6e,0x73,0x74,0x4d,0x69,0x73,0x73,0x69,0x6e,0x67,
+0x00,0x00,0x09,0x63,0x6f,0x6e,0x73,0x74,0x5f,0x67,0x65,0x74,0x00,0x00,0x10,0x43,
+0x6f,0x6e,0x73,0x74,0x44,0x6f,0x65,0x73,0x6e,0x74,0x45,0x78,0x69,0x73,0x74,0x00,
+0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x3c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,
+0x06,0x00,0x80,0x00,0x06,0x00,0x80,0x40,0x47,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,
+0x46,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x01,0x00,0x0d,0x63,0x6f,0x6e,0x73,0x74,0x5f,0x6d,0x69,0x73,0x73,0x69,0x6e,0x67,
+0x00,0x00,0x00,0x00,0x20,0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x03,0x02,0x00,0x00,
+0x26,0x00,0x40,0x14,0x83,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x8b,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x0d,0x00,0x80,0x00,
+0x05,0x00,0x80,0x00,0x44,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x11,0x01,0x00,0x01,
+0x04,0x01,0xc0,0x0b,0x03,0x00,0x80,0x41,0x20,0x00,0x80,0x00,0x11,0x01,0x00,0x01,
+0x04,0x00,0x80,0xc0,0xa0,0x01,0x40,0x0b,0x03,0x00,0x81,0x00,0xb2,0x00,0x80,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x0d,0x54,0x65,0x73,0x74,0x34,
+0x43,0x6f,0x6e,0x73,0x74,0x53,0x65,0x74,0x00,0x00,0x09,0x63,0x6f,0x6e,0x73,0x74,
+0x5f,0x73,0x65,0x74,0x00,0x00,0x13,0x43,0x6f,0x6e,0x73,0x74,0x34,0x54,0x65,0x73,
+0x74,0x34,0x43,0x6f,0x6e,0x73,0x74,0x53,0x65,0x74,0x00,0x00,0x09,0x63,0x6f,0x6e,
+0x73,0x74,0x5f,0x67,0x65,0x74,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x36,
+0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x03,0x00,0xc0,0x14,0x83,0x00,0x80,0x00,0x12,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x13,0x43,0x6f,
+0x6e,0x73,0x74,0x34,0x54,0x65,0x73,0x74,0x34,0x43,0x6f,0x6e,0x73,0x74,0x53,0x65,
+0x74,0x00,0x00,0x00,0x00,0x9f,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x15,0x00,0x80,
+0x40,0x37,0x00,0x80,0x00,0x0a,0x00,0x80,0x00,0x05,0x00,0x80,0x40,0x44,0x00,0x80,
+0x00,0xc5,0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x05,0x00,0x80,0x80,0x43,0x00,0x80,
+0x01,0x45,0x00,0x80,0x00,0x91,0x00,0x80,0xc0,0x20,0x01,0x00,0x02,0x84,0x01,0x00,
+0x80,0xb7,0x00,0x81,0x00,0xb2,0x00,0xc0,0x02,0x99,0x00,0x80,0x00,0x09,0x01,0x00,
+0x02,0x84,0x01,0x80,0x03,0x04,0x01,0x00,0x81,0x37,0x00,0x81,0x00,0xb2,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x02,0x24,0x6e,0x00,0x00,
+0x05,0x54,0x65,0x73,0x74,0x41,0x00,0x00,0x05,0x54,0x65,0x73,0x74,0x42,0x00,0x00,
+0x09,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,
+0x00,0x05,0x43,0x6f,0x6e,0x73,0x74,0x00,0x00,0x06,0x43,0x6f,0x6e,0x73,0x74,0x32,
+0x00,0x00,0x00,0x00,0x28,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x03,0x00,0xc0,0x00,
+0x03,0x00,0x80,0x00,0x12,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x01,0x00,0x05,0x43,0x6f,0x6e,0x73,0x74,0x00,0x00,0x00,0x00,0x6f,0x00,0x01,0x00,
+0x03,0x00,0x00,0x00,0x0a,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x00,0x80,0x00,
+0xa0,0x00,0xc0,0x00,0x03,0x00,0x80,0x01,0x12,0x00,0x80,0x00,0x06,0x00,0x80,0xc0,
+0x20,0x00,0x81,0x00,0x20,0x00,0x80,0x02,0x8a,0x00,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x06,0x00,0x07,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x00,0x00,
+0x05,0x54,0x65,0x73,0x74,0x41,0x00,0x00,0x06,0x43,0x6f,0x6e,0x73,0x74,0x32,0x00,
+0x00,0x09,0x63,0x6f,0x6e,0x73,0x74,0x61,0x6e,0x74,0x73,0x00,0x00,0x04,0x73,0x6f,
+0x72,0x74,0x00,0x00,0x02,0x24,0x6e,0x00,0x00,0x00,0x00,0x84,0x00,0x01,0x00,0x03,
+0x00,0x00,0x00,0x0c,0x00,0x80,0x00,0x05,0x00,0x80,0x00,0x44,0x00,0x80,0x00,0xc5,
+0x00,0x80,0x00,0x05,0x00,0x80,0x40,0x44,0x00,0x80,0x01,0x45,0x00,0x80,0x00,0x91,
+0x01,0x00,0x01,0x84,0x00,0x80,0x80,0xa0,0x01,0x40,0x14,0x83,0x00,0x81,0x00,0xb2,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x0c,0x54,0x65,
+0x73,0x74,0x34,0x49,0x6e,0x63,0x6c,0x75,0x64,0x65,0x00,0x00,0x0d,0x54,0x65,0x73,
+0x74,0x34,0x49,0x6e,0x63,0x6c,0x75,0x64,0x65,0x32,0x00,0x00,0x09,0x63,0x6f,0x6e,
+0x73,0x74,0x5f,0x67,0x65,0x74,0x00,0x00,0x0d,0x43,0x6f,0x6e,0x73,0x74,0x34,0x49,
+0x6e,0x63,0x6c,0x75,0x64,0x65,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x30,
+0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x03,0x00,0xc0,0x14,0x83,0x00,0x80,0x00,0x12,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x0d,0x43,0x6f,
+0x6e,0x73,0x74,0x34,0x49,0x6e,0x63,0x6c,0x75,0x64,0x65,0x00,0x00,0x00,0x00,0x3d,
+0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x04,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,
+0x00,0x80,0x00,0xa0,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
+0x00,0x07,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x00,0x00,0x0c,0x54,0x65,0x73,0x74,
+0x34,0x49,0x6e,0x63,0x6c,0x75,0x64,0x65,0x00,0x00,0x00,0x00,0xb5,0x00,0x01,0x00,
+0x03,0x00,0x00,0x00,0x18,0x00,0x80,0x00,0x05,0x00,0x80,0x00,0x44,0x00,0x80,0x00,
+0xc5,0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x05,0x00,0x80,0x40,0x43,0x00,0x80,0x01,
+0x45,0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x91,0x00,0x80,0x80,0x43,0x00,0x80,0x01,
+0xc5,0x00,0x80,0x00,0x91,0x01,0x00,0x00,0x11,0x00,0x80,0xc0,0xa0,0x00,0xc0,0x01,
+0x99,0x00,0x80,0x01,0x11,0x01,0x00,0x00,0x11,0x00,0x80,0xc0,0xa0,0x00,0xc0,0x02,
+0x19,0x00,0x80,0x00,0x11,0x01,0x00,0x00,0x11,0x00,0x80,0xc0,0xa0,0x00,0x81,0x00,
+0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x0d,0x54,
+0x65,0x73,0x74,0x34,0x49,0x6e,0x63,0x6c,0x75,0x64,0x65,0x50,0x00,0x00,0x0e,0x54,
+0x65,0x73,0x74,0x34,0x49,0x6e,0x63,0x6c,0x75,0x64,0x65,0x50,0x32,0x00,0x00,0x0e,
+0x54,0x65,0x73,0x74,0x34,0x49,0x6e,0x63,0x6c,0x75,0x64,0x65,0x50,0x33,0x00,0x00,
+0x08,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x3f,0x00,0x00,0x01,0x21,0x00,0x00,0x00,
+0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x01,
+0x00,0x03,0x00,0x00,0x00,0x04,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x00,0x80,
+0x00,0xa0,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x07,
+0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x00,0x00,0x0d,0x54,0x65,0x73,0x74,0x34,0x49,
+0x6e,0x63,0x6c,0x75,0x64,0x65,0x50,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,
+0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb1,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x12,
+0x00,0x80,0x00,0x05,0x00,0x80,0x00,0x44,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x05,
+0x00,0x80,0x40,0x44,0x00,0x80,0x01,0xc5,0x00,0x80,0x00,0x91,0x01,0x00,0x01,0x84,
+0x00,0x80,0x80,0xa0,0x01,0x40,0x14,0x83,0x00,0x81,0x00,0xb2,0x00,0xc0,0x02,0x99,
+0x00,0x80,0x00,0x91,0x01,0x00,0x02,0x84,0x00,0x80,0x80,0xa0,0x01,0x00,0x00,0x91,
+0x00,0x81,0x00,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,
+0x00,0x0d,0x54,0x65,0x73,0x74,0x34,0x49,0x6e,0x63,0x6c,0x75,0x64,0x65,0x64,0x00,
+0x00,0x0e,0x54,0x65,0x73,0x74,0x34,0x49,0x6e,0x63,0x6c,0x75,0x64,0x65,0x64,0x32,
+0x00,0x00,0x09,0x63,0x6f,0x6e,0x73,0x74,0x5f,0x67,0x65,0x74,0x00,0x00,0x0e,0x43,
+0x6f,0x6e,0x73,0x74,0x34,0x49,0x6e,0x63,0x6c,0x75,0x64,0x65,0x64,0x00,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x0f,0x43,0x6f,0x6e,0x73,0x74,0x34,0x49,0x6e,0x63,0x6c,0x75,
+0x64,0x65,0x64,0x32,0x00,0x00,0x00,0x00,0x50,0x00,0x01,0x00,0x02,0x00,0x00,0x00,
+0x08,0x00,0xc0,0x14,0x83,0x00,0x80,0x00,0x12,0x00,0x80,0x00,0x06,0x00,0x80,0x40,
+0x47,0x01,0x00,0x02,0xc0,0x00,0x80,0x40,0x46,0x00,0x00,0x00,0x05,0x00,0x00,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x0e,0x43,0x6f,0x6e,0x73,0x74,
+0x34,0x49,0x6e,0x63,0x6c,0x75,0x64,0x65,0x64,0x00,0x00,0x08,0x69,0x6e,0x63,0x6c,
+0x75,0x64,0x65,0x64,0x00,0x00,0x00,0x00,0x5a,0x00,0x03,0x00,0x06,0x00,0x00,0x00,
+0x06,0x02,0x00,0x00,0x26,0x01,0x80,0x00,0x11,0x02,0x00,0x01,0x04,0x02,0x80,0x40,
+0x01,0x01,0x80,0x41,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x03,0x00,0x0d,0x54,0x65,0x73,0x74,0x34,0x49,0x6e,0x63,0x6c,0x75,0x64,0x65,0x64,
+0x00,0x00,0x09,0x63,0x6f,0x6e,0x73,0x74,0x5f,0x73,0x65,0x74,0x00,0x00,0x0f,0x43,
+0x6f,0x6e,0x73,0x74,0x34,0x49,0x6e,0x63,0x6c,0x75,0x64,0x65,0x64,0x32,0x00,0x00,
+0x00,0x00,0x3e,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x04,0x00,0x80,0x00,0x06,0x01,
+0x00,0x00,0x91,0x00,0x80,0x00,0xa0,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x02,0x00,0x07,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x00,0x00,0x0d,0x54,
+0x65,0x73,0x74,0x34,0x49,0x6e,0x63,0x6c,0x75,0x64,0x65,0x64,0x00,0x00,0x00,0x00,
+0xbe,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x12,0x01,0x00,0x00,0x05,0x01,0x00,0x00,
+0x44,0x01,0x00,0x00,0xc5,0x01,0x00,0x00,0x05,0x01,0x00,0x40,0x44,0x01,0x00,0x01,
+0x45,0x01,0x00,0x00,0x91,0x01,0x00,0x80,0x20,0x00,0x80,0x80,0x01,0x01,0x00,0x40,
+0x01,0x01,0x00,0xc0,0x20,0x01,0x80,0x02,0x91,0x01,0x01,0x00,0xb2,0x01,0x40,0x01,
+0x99,0x01,0x00,0x40,0x01,0x01,0x80,0x00,0x11,0x01,0x01,0x80,0xa0,0x01,0x00,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x14,0x54,0x65,0x73,0x74,0x34,
+0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x64,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x73,0x00,
+0x00,0x15,0x54,0x65,0x73,0x74,0x34,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x64,0x4d,
+0x6f,0x64,0x75,0x6c,0x65,0x73,0x32,0x00,0x00,0x10,0x69,0x6e,0x63,0x6c,0x75,0x64,
+0x65,0x64,0x5f,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x73,0x00,0x00,0x05,0x63,0x6c,0x61,
+0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x41,0x72,0x72,0x61,0x79,0x00,
+0x00,0x08,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x3f,0x00,0x00,0x00,0x00,0x1c,0x00,
+0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x00,0x01,0x00,0x03,0x00,
+0x00,0x00,0x04,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x00,0x80,0x00,0xa0,0x01,
+0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x07,0x69,0x6e,0x63,
+0x6c,0x75,0x64,0x65,0x00,0x00,0x14,0x54,0x65,0x73,0x74,0x34,0x69,0x6e,0x63,0x6c,
+0x75,0x64,0x65,0x64,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x73,0x00,0x00,0x00,0x01,0x6d,
+0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x30,0x01,0x00,0x00,0x05,0x01,0x00,0x00,0x44,
+0x01,0x00,0x00,0xc5,0x01,0x00,0x00,0x05,0x01,0x80,0x00,0x05,0x01,0x00,0x40,0x43,
+0x01,0x00,0x01,0xc5,0x01,0x00,0x00,0x05,0x01,0x80,0x00,0x91,0x01,0x00,0x80,0x43,
+0x01,0x00,0x02,0xc5,0x01,0x00,0x01,0x11,0x01,0x80,0x00,0x07,0x01,0x00,0xc0,0xa0,
+0x00,0x80,0x80,0x01,0x01,0x00,0x00,0x11,0x01,0x00,0xc0,0x20,0x01,0x80,0x02,0x84,
+0x01,0x80,0xc0,0xb7,0x01,0x01,0x00,0xb2,0x01,0x40,0x03,0x19,0x01,0x00,0x00,0x91,
+0x01,0x80,0x00,0x08,0x01,0x00,0xc0,0xa0,0x01,0x80,0x03,0x04,0x01,0x80,0xc0,0xb7,
+0x01,0x01,0x00,0xb2,0x01,0x40,0x03,0x19,0x01,0x00,0x01,0x11,0x01,0x80,0x00,0x08,
+0x01,0x00,0xc0,0xa0,0x01,0x80,0x03,0x84,0x01,0x80,0xc0,0xb7,0x01,0x01,0x00,0xb2,
+0x01,0x40,0x02,0x19,0x01,0x00,0x40,0x01,0x01,0x02,0x00,0x20,0x01,0x80,0x04,0x91,
+0x01,0x01,0x00,0xb2,0x01,0x40,0x01,0x99,0x01,0x00,0x40,0x01,0x01,0x80,0x03,0x84,
+0x01,0x02,0x80,0xa0,0x01,0x40,0x01,0x99,0x01,0x00,0x40,0x01,0x01,0x80,0x03,0x04,
+0x01,0x02,0x80,0xa0,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,
+0x00,0x15,0x54,0x65,0x73,0x74,0x34,0x49,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x4d,
+0x65,0x74,0x68,0x6f,0x64,0x73,0x41,0x00,0x00,0x15,0x54,0x65,0x73,0x74,0x34,0x49,
+0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x4d,0x65,0x74,0x68,0x6f,0x64,0x73,0x42,0x00,
+0x00,0x15,0x54,0x65,0x73,0x74,0x34,0x49,0x6e,0x73,0x74,0x61,0x6e,0x63,0x65,0x4d,
+0x65,0x74,0x68,0x6f,0x64,0x73,0x43,0x00,0x00,0x10,0x69,0x6e,0x73,0x74,0x61,0x6e,
+0x63,0x65,0x5f,0x6d,0x65,0x74,0x68,0x6f,0x64,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,
+0x00,0x07,0x6d,0x65,0x74,0x68,0x6f,0x64,0x31,0x00,0x00,0x07,0x6d,0x65,0x74,0x68,
+0x6f,0x64,0x32,0x00,0x00,0x07,0x6d,0x65,0x74,0x68,0x6f,0x64,0x33,0x00,0x00,0x05,
+0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x05,0x41,0x72,0x72,0x61,0x79,0x00,0x00,0x08,
+0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x3f,0x00,0x00,0x00,0x00,0x32,0x00,0x01,0x00,
+0x02,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,
+0x46,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x01,0x00,0x07,0x6d,0x65,0x74,0x68,0x6f,0x64,0x31,0x00,0x00,0x00,0x00,0x20,0x00,
+0x02,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x05,0x00,
+0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x00,
+0x01,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,
+0x80,0x00,0x46,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x01,0x00,0x07,0x6d,0x65,0x74,0x68,0x6f,0x64,0x32,0x00,0x00,0x00,0x00,
+0x20,0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x26,0x00,0x00,0x00,
+0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x32,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x48,0x01,0x00,0x02,
+0xc0,0x00,0x80,0x00,0x46,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x01,0x00,0x07,0x6d,0x65,0x74,0x68,0x6f,0x64,0x33,0x00,0x00,
+0x00,0x00,0x20,0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x26,0x00,
+0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0xe3,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x1d,0x00,0x80,0x00,0x05,0x00,
+0x80,0x00,0x44,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x11,0x00,0x80,0x00,0x93,0x01,
+0x00,0x01,0x84,0x00,0x80,0x80,0xa0,0x00,0xc0,0x02,0x19,0x00,0x80,0x00,0x11,0x00,
+0x80,0x02,0x13,0x01,0x00,0x01,0x84,0x00,0x80,0x80,0xa0,0x00,0xc0,0x02,0x19,0x00,
+0x80,0x00,0x11,0x00,0x80,0x02,0x13,0x01,0x00,0x00,0x3d,0x00,0x80,0x80,0xa0,0x00,
+0xc0,0x02,0x19,0x00,0x80,0x00,0x11,0x00,0x80,0x02,0x13,0x01,0x00,0x00,0xbd,0x00,
+0x80,0x80,0xa0,0x00,0xc0,0x02,0x99,0x00,0x80,0x00,0x11,0x00,0x80,0x02,0x13,0x01,
+0x00,0x01,0x3d,0x00,0x80,0x80,0xa0,0x00,0x81,0x40,0x20,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x03,0x10,0x00,0x07,0x6d,0x65,0x74,0x68,0x6f,0x64,0x32,0x10,0x00,0x07,
+0x6d,0x65,0x74,0x68,0x6f,0x64,0x33,0x10,0x00,0x07,0x6d,0x65,0x74,0x68,0x6f,0x64,
+0x34,0x00,0x00,0x00,0x06,0x00,0x12,0x54,0x65,0x73,0x74,0x34,0x4d,0x65,0x74,0x68,
+0x6f,0x64,0x44,0x65,0x66,0x69,0x6e,0x65,0x64,0x00,0x00,0x01,0x41,0x00,0x00,0x0f,
+0x6d,0x65,0x74,0x68,0x6f,0x64,0x5f,0x64,0x65,0x66,0x69,0x6e,0x65,0x64,0x3f,0x00,
+0x00,0x07,0x6d,0x65,0x74,0x68,0x6f,0x64,0x31,0x00,0x00,0x01,0x43,0x00,0x00,0x01,
+0x21,0x00,0x00,0x00,0x00,0x50,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0c,0x00,0x80,
+0x00,0x05,0x00,0x80,0x00,0x44,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x05,0x01,0x00,
+0x00,0x05,0x00,0x80,0x40,0x43,0x00,0x80,0x01,0xc5,0x00,0x80,0x00,0x05,0x01,0x00,
+0x00,0x91,0x00,0x80,0x80,0x43,0x00,0x80,0x02,0xc5,0x01,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x01,0x41,0x00,0x00,0x01,0x42,0x00,0x00,0x01,
+0x43,0x00,0x00,0x00,0x00,0x32,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x80,
+0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x00,0x00,0x05,0x00,0x00,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x07,0x6d,0x65,0x74,0x68,
+0x6f,0x64,0x31,0x00,0x00,0x00,0x00,0x20,0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x03,
+0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x05,
+0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x00,0x00,0x05,
+0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x07,0x6d,0x65,
+0x74,0x68,0x6f,0x64,0x32,0x00,0x00,0x00,0x00,0x20,0x00,0x02,0x00,0x03,0x00,0x00,
+0x00,0x03,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4c,0x00,0x01,0x00,0x03,0x00,0x00,
+0x00,0x08,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x91,0x00,0x80,0x00,0xa0,0x00,0x80,
+0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x80,0x46,0x00,0x00,0x00,0x05,0x00,0x00,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x07,0x69,0x6e,0x63,0x6c,
+0x75,0x64,0x65,0x00,0x00,0x01,0x41,0x00,0x00,0x07,0x6d,0x65,0x74,0x68,0x6f,0x64,
+0x33,0x00,0x00,0x00,0x00,0x20,0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,
+0x00,0x26,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x75,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0f,0x00,0x80,
+0x00,0x05,0x00,0x80,0x00,0x44,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x11,0x01,0x00,
+0x05,0x40,0x00,0x80,0x40,0x21,0x01,0x40,0x05,0x03,0x00,0x80,0x80,0xb2,0x00,0xc0,
+0x02,0x99,0x00,0x80,0x00,0x11,0x01,0x00,0x07,0x40,0x00,0x80,0x40,0x21,0x01,0x40,
+0x05,0x83,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x03,0x00,0x0f,0x54,0x65,0x73,0x74,0x34,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x45,
+0x76,0x61,0x6c,0x00,0x00,0x0b,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x5f,0x65,0x76,0x61,
+0x6c,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x32,0x00,0x01,0x00,0x02,0x00,
+0x00,0x00,0x05,0x00,0xc0,0x05,0x03,0x00,0x80,0x00,0x0e,0x00,0xc0,0x05,0x83,0x00,
+0x80,0x00,0x8e,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,
+0x02,0x40,0x61,0x00,0x00,0x02,0x40,0x62,0x00,0x00,0x00,0x00,0x21,0x00,0x01,0x00,
+0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x40,0x61,0x00,0x00,0x00,0x00,0x21,0x00,0x01,
+0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x40,0x62,0x00,0x00,0x00,0x00,0xb4,0x00,
+0x01,0x00,0x03,0x00,0x00,0x00,0x10,0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x05,0x00,
+0x80,0x00,0x43,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x11,0x01,0x00,0x01,0x04,0x00,
+0x80,0x40,0xa0,0x01,0x40,0x31,0x03,0x00,0x80,0xc0,0xb2,0x00,0xc0,0x02,0x99,0x00,
+0x80,0x00,0x11,0x00,0x81,0x00,0x20,0x01,0x00,0x01,0x04,0x00,0x81,0x40,0xa0,0x00,
+0x81,0x80,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,
+0x18,0x54,0x65,0x73,0x74,0x34,0x52,0x65,0x6d,0x6f,0x76,0x65,0x43,0x6c,0x61,0x73,
+0x73,0x56,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x00,0x00,0x15,0x72,0x65,0x6d,0x6f,
+0x76,0x65,0x5f,0x63,0x6c,0x61,0x73,0x73,0x5f,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,
+0x65,0x00,0x00,0x04,0x40,0x40,0x63,0x76,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x0f,
+0x63,0x6c,0x61,0x73,0x73,0x5f,0x76,0x61,0x72,0x69,0x61,0x62,0x6c,0x65,0x73,0x00,
+0x00,0x08,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x3f,0x00,0x00,0x01,0x21,0x00,0x00,
+0x00,0x00,0x27,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x03,0x00,0xc0,0x31,0x03,0x00,
+0x80,0x00,0x10,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,
+0x04,0x40,0x40,0x63,0x76,0x00,0x00,0x00,0x00,0xf9,0x00,0x03,0x00,0x05,0x00,0x00,
+0x00,0x22,0x01,0x80,0x00,0x05,0x01,0x80,0x00,0x44,0x01,0x80,0x00,0xc5,0x01,0x80,
+0x00,0x11,0x02,0x00,0x05,0x40,0x01,0x80,0x40,0x21,0x00,0x80,0xc0,0x01,0x01,0x00,
+0x00,0x08,0x00,0x40,0x02,0x1a,0x01,0x80,0x00,0x11,0x02,0x00,0x07,0x40,0x01,0x80,
+0x40,0x21,0x00,0x40,0x04,0x97,0x01,0x80,0x00,0x1b,0x02,0x00,0x01,0x11,0x02,0x80,
+0xc0,0x01,0x02,0x00,0xc0,0xa0,0x02,0x40,0x00,0x98,0x00,0x40,0x01,0x17,0x01,0x00,
+0x00,0x07,0x00,0x40,0x01,0x17,0x01,0x80,0x00,0x1d,0x00,0x80,0x00,0x1c,0x01,0x80,
+0x00,0x11,0x02,0x00,0x02,0x84,0x01,0x81,0x00,0xa0,0x01,0x81,0x80,0x20,0x01,0xc0,
+0x01,0x99,0x01,0x80,0x40,0x01,0x02,0x40,0x0b,0x03,0x01,0x81,0xc0,0xb2,0x01,0xc0,
+0x00,0x99,0x01,0x80,0x80,0x01,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x08,0x00,0x10,0x54,0x65,0x73,0x74,0x34,0x52,0x65,0x6d,0x6f,0x76,0x65,0x43,
+0x6f,0x6e,0x73,0x74,0x00,0x00,0x0b,0x6d,0x6f,0x64,0x75,0x6c,0x65,0x5f,0x65,0x76,
+0x61,0x6c,0x00,0x00,0x09,0x4e,0x61,0x6d,0x65,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,
+0x03,0x3d,0x3d,0x3d,0x00,0x00,0x0e,0x63,0x6f,0x6e,0x73,0x74,0x5f,0x64,0x65,0x66,
+0x69,0x6e,0x65,0x64,0x3f,0x00,0x00,0x0d,0x45,0x78,0x69,0x73,0x74,0x69,0x6e,0x67,
+0x43,0x6f,0x6e,0x73,0x74,0x00,0x00,0x01,0x21,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,
+0x00,0x00,0x30,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x03,0x00,0xc0,0x0b,0x03,0x00,
+0x80,0x00,0x12,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,
+0x0d,0x45,0x78,0x69,0x73,0x74,0x69,0x6e,0x67,0x43,0x6f,0x6e,0x73,0x74,0x00,0x00,
+0x00,0x00,0x43,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x04,0x00,0x80,0x00,0x06,0x01,
+0x00,0x00,0x84,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x02,0x00,0x0c,0x72,0x65,0x6d,0x6f,0x76,0x65,0x5f,0x63,0x6f,0x6e,0x73,
+0x74,0x00,0x00,0x0d,0x45,0x78,0x69,0x73,0x74,0x69,0x6e,0x67,0x43,0x6f,0x6e,0x73,
+0x74,0x00,0x00,0x00,0x00,0x46,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x04,0x00,0x80,
+0x00,0x06,0x01,0x00,0x00,0x84,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x0c,0x72,0x65,0x6d,0x6f,0x76,0x65,0x5f,0x63,
+0x6f,0x6e,0x73,0x74,0x00,0x00,0x10,0x4e,0x6f,0x6e,0x45,0x78,0x69,0x73,0x74,0x69,
+0x6e,0x67,0x43,0x6f,0x6e,0x73,0x74,0x00,0x00,0x00,0x00,0xbb,0x00,0x01,0x00,0x03,
+0x00,0x00,0x00,0x15,0x00,0x80,0x00,0x05,0x00,0x80,0x00,0x44,0x00,0x80,0x00,0xc5,
+0x00,0x80,0x00,0x11,0x00,0x80,0x00,0x93,0x01,0x00,0x0d,0x40,0x00,0x80,0x80,0x21,
+0x00,0x80,0x00,0x11,0x00,0x80,0x00,0x93,0x00,0x80,0xc0,0x20,0x01,0x00,0x02,0x84,
+0x00,0x81,0x00,0xa0,0x00,0xc0,0x03,0x99,0x00,0x80,0x00,0x11,0x00,0x80,0x00,0x93,
+0x01,0x00,0x00,0x08,0x00,0x80,0xc0,0xa0,0x01,0x00,0x02,0x84,0x00,0x81,0x00,0xa0,
+0x00,0x81,0x80,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,
+0x00,0x11,0x54,0x65,0x73,0x74,0x34,0x52,0x65,0x6d,0x6f,0x76,0x65,0x4d,0x65,0x74,
+0x68,0x6f,0x64,0x00,0x00,0x05,0x43,0x68,0x69,0x6c,0x64,0x00,0x00,0x0a,0x63,0x6c,
+0x61,0x73,0x73,0x5f,0x65,0x76,0x61,0x6c,0x00,0x00,0x10,0x69,0x6e,0x73,0x74,0x61,
+0x6e,0x63,0x65,0x5f,0x6d,0x65,0x74,0x68,0x6f,0x64,0x73,0x00,0x00,0x08,0x69,0x6e,
+0x63,0x6c,0x75,0x64,0x65,0x3f,0x00,0x00,0x05,0x68,0x65,0x6c,0x6c,0x6f,0x00,0x00,
+0x01,0x21,0x00,0x00,0x00,0x00,0x49,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x09,0x00,
+0x80,0x00,0x05,0x01,0x00,0x00,0x05,0x00,0x80,0x00,0x43,0x00,0x80,0x00,0xc5,0x00,
+0x80,0x00,0x05,0x01,0x00,0x00,0x11,0x00,0x80,0x40,0x43,0x00,0x80,0x01,0xc5,0x01,
+0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x06,0x50,0x61,0x72,
+0x65,0x6e,0x74,0x00,0x00,0x05,0x43,0x68,0x69,0x6c,0x64,0x00,0x00,0x00,0x00,0x30,
+0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,
+0x00,0x80,0x00,0x46,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x01,0x00,0x05,0x68,0x65,0x6c,0x6c,0x6f,0x00,0x00,0x00,0x00,0x20,
+0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x05,
+0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,
+0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,
+0x00,0x80,0x00,0x46,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x01,0x00,0x05,0x68,0x65,0x6c,0x6c,0x6f,0x00,0x00,0x00,0x00,0x20,
+0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x05,
+0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,
+0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x04,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x84,
+0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
+0x00,0x0d,0x72,0x65,0x6d,0x6f,0x76,0x65,0x5f,0x6d,0x65,0x74,0x68,0x6f,0x64,0x00,
+0x00,0x05,0x68,0x65,0x6c,0x6c,0x6f,0x00,0x00,0x00,0x00,0xde,0x00,0x01,0x00,0x03,
+0x00,0x00,0x00,0x1b,0x00,0x80,0x00,0x05,0x00,0x80,0x00,0x44,0x00,0x80,0x00,0xc5,
+0x00,0x80,0x00,0x11,0x00,0x80,0x00,0x93,0x01,0x00,0x0f,0x40,0x00,0x80,0x80,0x21,
+0x00,0x80,0x00,0x11,0x00,0x80,0x01,0x93,0x00,0x81,0x00,0x20,0x01,0x00,0x03,0x04,
+0x00,0x81,0x40,0xa0,0x00,0xc0,0x03,0x19,0x00,0x80,0x00,0x11,0x00,0x80,0x00,0x93,
+0x00,0x81,0x00,0x20,0x01,0x00,0x03,0x04,0x00,0x81,0x40,0xa0,0x00,0x81,0xc0,0x20,
+0x00,0xc0,0x03,0x19,0x00,0x80,0x00,0x11,0x00,0x80,0x04,0x13,0x00,0x81,0x00,0x20,
+0x01,0x00,0x03,0x04,0x00,0x81,0x40,0xa0,0x00,0x81,0xc0,0x20,0x00,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0x00,0x10,0x54,0x65,0x73,0x74,0x34,0x55,
+0x6e,0x64,0x65,0x66,0x4d,0x65,0x74,0x68,0x6f,0x64,0x00,0x00,0x05,0x43,0x68,0x69,
+0x6c,0x64,0x00,0x00,0x0a,0x63,0x6c,0x61,0x73,0x73,0x5f,0x65,0x76,0x61,0x6c,0x00,
+0x00,0x06,0x50,0x61,0x72,0x65,0x6e,0x74,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,
+0x0b,0x72,0x65,0x73,0x70,0x6f,0x6e,0x64,0x5f,0x74,0x6f,0x3f,0x00,0x00,0x05,0x68,
+0x65,0x6c,0x6c,0x6f,0x00,0x00,0x01,0x21,0x00,0x00,0x0a,0x47,0x72,0x61,0x6e,0x64,
+0x43,0x68,0x69,0x6c,0x64,0x00,0x00,0x00,0x00,0x66,0x00,0x01,0x00,0x03,0x00,0x00,
+0x00,0x0d,0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x05,0x00,0x80,0x00,0x43,0x00,0x80,
+0x00,0xc5,0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x11,0x00,0x80,0x40,0x43,0x00,0x80,
+0x01,0xc5,0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x91,0x00,0x80,0x80,0x43,0x00,0x80,
+0x02,0xc5,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x06,
+0x50,0x61,0x72,0x65,0x6e,0x74,0x00,0x00,0x05,0x43,0x68,0x69,0x6c,0x64,0x00,0x00,
+0x0a,0x47,0x72,0x61,0x6e,0x64,0x43,0x68,0x69,0x6c,0x64,0x00,0x00,0x00,0x00,0x30,
+0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,
+0x00,0x80,0x00,0x46,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x01,0x00,0x05,0x68,0x65,0x6c,0x6c,0x6f,0x00,0x00,0x00,0x00,0x20,
+0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x05,
+0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,
+0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,
+0x00,0x80,0x00,0x46,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x01,0x00,0x05,0x68,0x65,0x6c,0x6c,0x6f,0x00,0x00,0x00,0x00,0x20,
+0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x05,
+0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,
+0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x00,0x01,0x00,0x03,
+0x00,0x00,0x00,0x04,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x84,0x00,0x80,0x00,0xa0,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x0c,0x75,0x6e,
+0x64,0x65,0x66,0x5f,0x6d,0x65,0x74,0x68,0x6f,0x64,0x00,0x00,0x05,0x68,0x65,0x6c,
+0x6c,0x6f,0x00,0x00,0x00,0x00,0x66,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x08,0x00,
+0x80,0x00,0x05,0x00,0x80,0x00,0x44,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x11,0x00,
+0x80,0x40,0x20,0x01,0x00,0x00,0x3d,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x01,0x10,0x00,0x10,0x54,0x65,0x73,0x74,0x34,0x74,0x6f,0x5f,0x73,0x4d,
+0x6f,0x64,0x75,0x6c,0x65,0x73,0x00,0x00,0x00,0x03,0x00,0x10,0x54,0x65,0x73,0x74,
+0x34,0x74,0x6f,0x5f,0x73,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x73,0x00,0x00,0x04,0x74,
+0x6f,0x5f,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,
+0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x00,0x01,0x00,0x03,0x00,0x00,0x00,
+0x08,0x00,0x80,0x00,0x05,0x00,0x80,0x00,0x44,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,
+0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x00,0x3d,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,
+0x29,0x00,0x00,0x00,0x01,0x10,0x00,0x10,0x54,0x65,0x73,0x74,0x34,0x74,0x6f,0x5f,
+0x73,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x73,0x00,0x00,0x00,0x03,0x00,0x10,0x54,0x65,
+0x73,0x74,0x34,0x74,0x6f,0x5f,0x73,0x4d,0x6f,0x64,0x75,0x6c,0x65,0x73,0x00,0x00,
+0x07,0x69,0x6e,0x73,0x70,0x65,0x63,0x74,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,
+0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x49,0x00,0x01,
+0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,
+0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x04,0x00,0x09,0x4e,0x61,0x6d,0x65,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x05,
+0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x43,0x6c,0x61,
+0x73,0x73,0x00,0x00,0x00,0x00,0x56,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,
+0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x09,0x4e,0x61,0x6d,
+0x65,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x0a,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,
+0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x0d,0x53,0x74,0x61,0x6e,0x64,
+0x61,0x72,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,0x00,0x60,0x00,0x01,0x00,
+0x03,0x00,0x00,0x00,0x08,0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x05,0x00,0x80,0x00,
+0x43,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x89,0x01,0x00,0x01,0x84,0x00,0x80,0x80,
+0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x09,0x54,
+0x65,0x73,0x74,0x44,0x75,0x6d,0x6d,0x79,0x00,0x00,0x12,0x24,0x74,0x65,0x73,0x74,
+0x5f,0x64,0x75,0x6d,0x6d,0x79,0x5f,0x72,0x65,0x73,0x75,0x6c,0x74,0x00,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x03,0x62,0x61,0x72,0x00,0x00,0x00,0x00,0xb1,0x00,0x02,0x00,
+0x05,0x00,0x00,0x00,0x15,0x00,0x40,0x03,0x1a,0x01,0x00,0x00,0x48,0x01,0x80,0x00,
+0x04,0x02,0x00,0x00,0x84,0x02,0x80,0x00,0x05,0x01,0x00,0x81,0x20,0x00,0x40,0x06,
+0x17,0x01,0x00,0x00,0x1b,0x01,0x80,0x01,0x91,0x02,0x00,0x80,0x01,0x01,0x81,0x00,
+0xa0,0x01,0xc0,0x00,0x98,0x00,0x40,0x02,0x97,0x00,0x80,0x80,0x01,0x01,0x00,0x40,
+0x01,0x01,0x01,0x40,0x20,0x01,0x00,0x03,0x0a,0x00,0x40,0x01,0x17,0x01,0x00,0x00,
+0x1d,0x00,0x80,0x00,0x1c,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x07,0x00,0x03,0x66,0x6f,0x6f,0x00,0x00,0x03,0x62,0x61,0x72,0x00,0x00,0x0c,0x61,
+0x6c,0x69,0x61,0x73,0x5f,0x6d,0x65,0x74,0x68,0x6f,0x64,0x00,0x00,0x09,0x4e,0x61,
+0x6d,0x65,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x03,0x3d,0x3d,0x3d,0x00,0x00,0x04,
+0x6e,0x61,0x6d,0x65,0x00,0x00,0x12,0x24,0x74,0x65,0x73,0x74,0x5f,0x64,0x75,0x6d,
+0x6d,0x79,0x5f,0x72,0x65,0x73,0x75,0x6c,0x74,0x00,0x00,0x00,0x00,0x9e,0x00,0x02,
+0x00,0x05,0x00,0x00,0x00,0x14,0x01,0x00,0x00,0x11,0x01,0x80,0x00,0x3d,0x02,0x00,
+0x01,0x04,0x01,0x00,0x41,0x20,0x00,0x80,0x80,0x01,0x01,0x00,0x40,0x01,0x01,0x00,
+0xc0,0x20,0x01,0x80,0x00,0x11,0x01,0x01,0x00,0xb2,0x01,0x40,0x02,0x19,0x01,0x00,
+0x40,0x01,0x01,0x01,0x40,0x20,0x01,0x80,0x00,0x3d,0x01,0x01,0x00,0xb2,0x01,0x40,
+0x02,0x19,0x01,0x00,0x40,0x01,0x01,0x01,0x80,0x20,0x01,0x80,0x01,0x04,0x01,0x01,
+0x00,0xb2,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x01,0x10,0x00,0x01,0x61,0x00,0x00,
+0x00,0x07,0x00,0x09,0x4e,0x61,0x6d,0x65,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x03,
+0x6e,0x65,0x77,0x00,0x00,0x03,0x66,0x6f,0x6f,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,
+0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x07,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,
+0x00,0x00,0x04,0x6e,0x61,0x6d,0x65,0x00,0x00,0x00,0x00,0x48,0x00,0x01,0x00,0x03,
+0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,
+0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,
+0x00,0x08,0x4e,0x69,0x6c,0x43,0x6c,0x61,0x73,0x73,0x00,0x00,0x05,0x63,0x6c,0x61,
+0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x43,0x6c,0x61,0x73,0x73,0x00,
+0x00,0x00,0x00,0x44,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0a,0x00,0x80,0x00,0x05,
+0x01,0x00,0x00,0x07,0x00,0x80,0x00,0xa0,0x00,0x80,0x40,0x20,0x00,0xc0,0x02,0x19,
+0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x05,0x00,0x80,0x00,0xa0,0x00,0x80,0x40,0x20,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x26,0x00,
+0x00,0x01,0x21,0x00,0x00,0x00,0x00,0x40,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x09,
+0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x07,0x00,0x80,0x00,0xa0,0x00,0xc0,0x02,0x19,
+0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x08,0x00,0x80,0x00,0xa0,0x00,0x80,0x40,0x20,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x5e,0x00,
+0x00,0x01,0x21,0x00,0x00,0x00,0x00,0x40,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x09,
+0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x07,0x00,0x80,0x00,0xa0,0x00,0xc0,0x02,0x19,
+0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x08,0x00,0x80,0x00,0xa0,0x00,0x80,0x40,0x20,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x7c,0x00,
+0x00,0x01,0x21,0x00,0x00,0x00,0x00,0x27,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x03,
+0x00,0x80,0x00,0x05,0x00,0x80,0x00,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x01,0x00,0x04,0x6e,0x69,0x6c,0x3f,0x00,0x00,0x00,0x00,0x37,0x00,
+0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x05,0x00,0x80,0x00,0x20,0x01,
+0x00,0x00,0x3d,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x10,
+0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x74,0x6f,0x5f,0x73,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x00,0x00,0xe5,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x1b,0x00,0x80,
+0x00,0x05,0x00,0x40,0x02,0x1a,0x01,0x80,0x00,0x06,0x02,0x00,0x00,0x3d,0x01,0x80,
+0x00,0xa0,0x00,0x40,0x05,0x17,0x01,0x80,0x00,0x1b,0x02,0x00,0x00,0x91,0x02,0x80,
+0xc0,0x01,0x02,0x00,0x80,0xa0,0x02,0x40,0x00,0x98,0x00,0x40,0x01,0x97,0x01,0x00,
+0xc0,0x01,0x00,0x80,0x80,0x01,0x00,0x40,0x01,0x17,0x01,0x80,0x00,0x1d,0x00,0x80,
+0x00,0x1c,0x01,0x80,0x01,0x91,0x01,0x81,0x00,0x20,0x02,0x00,0x03,0x11,0x01,0x81,
+0x40,0xb2,0x01,0xc0,0x02,0x19,0x01,0x80,0x40,0x01,0x01,0x81,0x00,0x20,0x02,0x00,
+0x01,0x91,0x01,0x81,0x40,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x10,0x00,
+0x00,0x00,0x00,0x00,0x07,0x00,0x24,0x64,0x6f,0x65,0x73,0x4e,0x6f,0x74,0x45,0x78,
+0x69,0x73,0x74,0x41,0x73,0x41,0x4d,0x65,0x74,0x68,0x6f,0x64,0x4e,0x61,0x6d,0x65,
+0x46,0x6f,0x72,0x56,0x65,0x72,0x79,0x53,0x75,0x72,0x65,0x00,0x00,0x0d,0x53,0x74,
+0x61,0x6e,0x64,0x61,0x72,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x03,0x3d,0x3d,
+0x3d,0x00,0x00,0x0d,0x4e,0x6f,0x4d,0x65,0x74,0x68,0x6f,0x64,0x45,0x72,0x72,0x6f,
+0x72,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,
+0x05,0x43,0x6c,0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x56,0x00,0x01,0x00,0x03,0x00,
+0x00,0x00,0x05,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,
+0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,
+0x0d,0x4e,0x6f,0x4d,0x65,0x74,0x68,0x6f,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,
+0x0a,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x09,0x4e,0x61,0x6d,0x65,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,0x00,
+0x47,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x11,0x00,0x80,0x40,
+0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x04,0x00,0x07,0x4e,0x75,0x6d,0x65,0x72,0x69,0x63,0x00,0x00,
+0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x43,0x6c,
+0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x4d,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,
+0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x07,0x4e,0x75,
+0x6d,0x65,0x72,0x69,0x63,0x00,0x00,0x0a,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,
+0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,
+0x00,0x00,0x00,0x00,0x29,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x04,0x00,0xc0,0x00,
+0x03,0x01,0x40,0x00,0x03,0x00,0x80,0x00,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x29,0x00,0x01,
+0x00,0x03,0x00,0x00,0x00,0x04,0x00,0xbf,0xff,0x03,0x01,0x3f,0xff,0x03,0x00,0x80,
+0x00,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x00,0x00,0x60,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0a,0x00,
+0xc0,0x00,0x03,0x00,0x80,0x00,0x20,0x01,0x40,0x00,0x03,0x00,0x80,0x40,0xb2,0x00,
+0xc0,0x02,0x19,0x00,0xbf,0xff,0x03,0x00,0x80,0x00,0x20,0x01,0x00,0x00,0x02,0x00,
+0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x06,0x00,0x16,0x31,0x2e,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x65,0x2b,0x30,0x30,0x00,0x00,0x00,0x02,0x00,0x03,0x61,0x62,0x73,0x00,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x00,0x00,0x68,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x06,0x00,
+0x80,0x00,0x02,0x01,0x40,0x01,0x03,0x00,0x80,0x00,0xa0,0x01,0x00,0x00,0x82,0x00,
+0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x02,0x06,0x00,0x16,0x32,0x2e,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x65,0x2b,0x30,0x30,0x06,0x00,0x16,0x38,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x00,0x00,0x00,
+0x02,0x00,0x02,0x2a,0x2a,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x46,0x00,
+0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,
+0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x04,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x05,0x63,0x6c,
+0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x43,0x6c,0x61,0x73,0x73,
+0x00,0x00,0x00,0x00,0x51,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,
+0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,
+0x74,0x00,0x00,0x0a,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,
+0x02,0x3d,0x3d,0x00,0x00,0x0b,0x42,0x61,0x73,0x69,0x63,0x4f,0x62,0x6a,0x65,0x63,
+0x74,0x00,0x00,0x00,0x00,0x44,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,
+0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x50,0x72,0x6f,0x63,
+0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,
+0x43,0x6c,0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x4a,0x00,0x01,0x00,0x03,0x00,0x00,
+0x00,0x05,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,
+0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,
+0x50,0x72,0x6f,0x63,0x00,0x00,0x0a,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,0x73,
+0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,
+0x00,0x00,0x00,0xcc,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x1e,0x00,0x80,0x00,0x05,
+0x00,0x40,0x01,0x9a,0x02,0x00,0x00,0x11,0x02,0x00,0x40,0x20,0x00,0x40,0x05,0x17,
+0x02,0x00,0x00,0x1b,0x02,0x80,0x01,0x11,0x03,0x01,0x00,0x01,0x02,0x80,0xc0,0xa0,
+0x02,0xc0,0x00,0x98,0x00,0x40,0x01,0x97,0x01,0x01,0x00,0x01,0x00,0x80,0x80,0x01,
+0x00,0x40,0x01,0x17,0x02,0x00,0x00,0x1d,0x00,0x80,0x00,0x1c,0x02,0x00,0x00,0x11,
+0x02,0x80,0x03,0x40,0x02,0x00,0x40,0x21,0x01,0x81,0x00,0x01,0x02,0x00,0x40,0x01,
+0x02,0x01,0x00,0x20,0x02,0x80,0x03,0x11,0x02,0x01,0x40,0xb2,0x02,0x40,0x02,0x19,
+0x02,0x00,0xc0,0x01,0x02,0x01,0x00,0x20,0x02,0x80,0x00,0x11,0x02,0x01,0x40,0xb2,
+0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x04,0x50,0x72,
+0x6f,0x63,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x0d,0x53,0x74,0x61,0x6e,0x64,
+0x61,0x72,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x03,0x3d,0x3d,0x3d,0x00,0x00,
+0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x0d,0x41,0x72,
+0x67,0x75,0x6d,0x65,0x6e,0x74,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,0x00,0x1c,
+0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0x00,0x05,0x00,0x07,
+0x00,0x00,0x00,0x17,0x00,0xbf,0xff,0x83,0x02,0x80,0x00,0x11,0x03,0x00,0x03,0x40,
+0x02,0x80,0x40,0x21,0x01,0x01,0x40,0x01,0x02,0x80,0x80,0x01,0x02,0x80,0x80,0x20,
+0x01,0xbf,0xff,0x83,0x02,0x80,0x00,0x11,0x03,0x00,0x05,0x40,0x02,0x80,0x40,0x21,
+0x02,0x01,0x40,0x01,0x02,0x81,0x00,0x01,0x03,0x40,0x02,0x03,0x02,0x80,0x80,0xa0,
+0x02,0x80,0x40,0x01,0x03,0x40,0x00,0x03,0x02,0x80,0xc0,0xb2,0x02,0xc0,0x01,0x99,
+0x02,0x80,0xc0,0x01,0x03,0x40,0x02,0x03,0x02,0x80,0xc0,0xb2,0x02,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x50,0x72,0x6f,0x63,0x00,0x00,
+0x03,0x6e,0x65,0x77,0x00,0x00,0x02,0x5b,0x5d,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,
+0x00,0x00,0x28,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x04,0x00,0x80,0x40,0x15,0x00,
+0x80,0x00,0xad,0x00,0x80,0x40,0x16,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x01,0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0x30,0x00,0x03,0x00,0x05,0x00,
+0x00,0x00,0x06,0x02,0x00,0x00,0x26,0x01,0x80,0xc0,0x15,0x02,0x00,0x40,0x01,0x01,
+0x80,0x00,0xac,0x01,0x80,0xc0,0x16,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x01,0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0xbe,0x00,0x05,0x00,0x07,0x00,
+0x00,0x00,0x24,0x02,0x80,0x00,0x11,0x03,0x00,0x03,0x40,0x02,0x80,0x40,0x21,0x02,
+0x80,0x80,0x20,0x00,0x81,0x40,0x01,0x02,0x80,0x00,0x11,0x03,0x00,0x05,0x40,0x02,
+0x80,0x40,0x21,0x02,0x80,0x80,0x20,0x01,0x01,0x40,0x01,0x02,0x80,0x00,0x11,0x03,
+0x00,0x07,0x40,0x02,0x80,0x40,0x21,0x02,0x80,0x80,0x20,0x01,0x81,0x40,0x01,0x02,
+0x80,0x00,0x11,0x03,0x00,0x09,0x40,0x02,0x80,0x40,0x21,0x02,0x80,0x80,0x20,0x02,
+0x01,0x40,0x01,0x02,0x80,0x40,0x01,0x03,0x40,0x00,0x83,0x02,0x80,0xc0,0xb2,0x02,
+0xc0,0x01,0x99,0x02,0x80,0x80,0x01,0x03,0x3f,0xfe,0x03,0x02,0x80,0xc0,0xb2,0x02,
+0xc0,0x01,0x99,0x02,0x80,0xc0,0x01,0x03,0x40,0x00,0x03,0x02,0x80,0xc0,0xb2,0x02,
+0xc0,0x01,0x99,0x02,0x81,0x00,0x01,0x03,0x40,0x00,0x03,0x02,0x80,0xc0,0xb2,0x02,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x50,0x72,0x6f,
+0x63,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x05,0x61,0x72,0x69,0x74,0x79,0x00,
+0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x20,0x00,0x04,0x00,0x05,0x00,0x00,0x00,
+0x03,0x04,0x00,0x00,0x26,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x05,0x00,0x06,0x00,0x00,0x00,
+0x03,0x02,0x08,0x40,0x26,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2c,0x00,0x04,0x00,0x05,0x00,0x00,0x00,
+0x06,0x00,0x10,0x40,0x26,0x00,0x40,0x00,0x97,0x00,0x40,0x00,0x97,0x00,0xbf,0xff,
+0x83,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x2c,0x00,0x05,0x00,0x06,0x00,0x00,0x00,0x06,0x02,0x10,0x00,
+0x26,0x00,0x40,0x00,0x97,0x00,0x40,0x00,0x97,0x01,0xbf,0xff,0x83,0x00,0x00,0x00,
+0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x89,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0x17,0x00,0xbf,0xff,0x83,0x02,0x80,0x00,
+0x11,0x03,0x00,0x03,0x40,0x02,0x80,0x40,0x21,0x01,0x01,0x40,0x01,0x02,0x80,0x80,
+0x01,0x02,0x80,0x80,0x20,0x01,0xbf,0xff,0x83,0x02,0x80,0x00,0x11,0x03,0x00,0x05,
+0x40,0x02,0x80,0x40,0x21,0x02,0x01,0x40,0x01,0x02,0x81,0x00,0x01,0x03,0x40,0x02,
+0x03,0x02,0x80,0x80,0xa0,0x02,0x80,0x40,0x01,0x03,0x40,0x00,0x03,0x02,0x80,0xc0,
+0xb2,0x02,0xc0,0x01,0x99,0x02,0x80,0xc0,0x01,0x03,0x40,0x02,0x03,0x02,0x80,0xc0,
+0xb2,0x02,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x04,0x50,
+0x72,0x6f,0x63,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x04,0x63,0x61,0x6c,0x6c,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x28,0x00,0x01,0x00,0x03,0x00,0x00,
+0x00,0x04,0x00,0x80,0x40,0x15,0x00,0x80,0x00,0xad,0x00,0x80,0x40,0x16,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x2b,0x00,0x00,0x00,
+0x00,0x30,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x06,0x02,0x00,0x00,0x26,0x01,0x80,
+0xc0,0x15,0x02,0x00,0x40,0x01,0x01,0x80,0x00,0xac,0x01,0x80,0xc0,0x16,0x01,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x2b,0x00,0x00,0x00,
+0x00,0x45,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x11,0x00,0x80,
+0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x05,0x52,0x61,0x6e,0x67,0x65,0x00,0x00,0x05,
+0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x43,0x6c,0x61,
+0x73,0x73,0x00,0x00,0x00,0x00,0x4b,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,
+0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x05,0x52,0x61,0x6e,
+0x67,0x65,0x00,0x00,0x0a,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,0x73,0x73,0x00,
+0x00,0x02,0x3d,0x3d,0x00,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x00,
+0x00,0x61,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x11,0x00,0xc0,0x00,0x03,0x01,0x40,
+0x04,0x83,0x00,0x80,0x40,0x41,0x01,0x40,0x00,0x03,0x01,0xc0,0x04,0x83,0x01,0x00,
+0x80,0x41,0x00,0x80,0x00,0xb2,0x00,0xc0,0x04,0x19,0x00,0xc0,0x00,0x03,0x01,0x40,
+0x04,0x83,0x00,0x80,0x40,0x41,0x01,0x40,0x00,0x03,0x01,0xc0,0x31,0x83,0x01,0x00,
+0x80,0x41,0x00,0x80,0x00,0xb2,0x00,0x80,0x40,0x20,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x02,0x3d,0x3d,0x00,0x00,0x01,0x21,0x00,0x00,
+0x00,0x00,0x4e,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x0c,0x01,0x40,0x00,0x03,0x01,
+0xc0,0x04,0x83,0x00,0x80,0x80,0x41,0x01,0x00,0x40,0x01,0x01,0xc0,0x02,0x03,0x01,
+0x00,0x00,0xa0,0x01,0x40,0x02,0x19,0x01,0x00,0x40,0x01,0x01,0xc0,0x09,0x83,0x01,
+0x00,0x00,0xa0,0x01,0x00,0x40,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x02,0x00,0x03,0x3d,0x3d,0x3d,0x00,0x00,0x01,0x21,0x00,0x00,0x00,0x00,
+0x3d,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x07,0x00,0xc0,0x00,0x03,0x01,0x40,0x04,
+0x83,0x00,0x80,0x40,0x41,0x00,0x80,0x00,0x20,0x01,0x40,0x00,0x03,0x00,0x80,0x40,
+0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x05,0x62,
+0x65,0x67,0x69,0x6e,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x4c,0x00,0x03,
+0x00,0x05,0x00,0x00,0x00,0x0b,0x01,0xc0,0x00,0x03,0x02,0x40,0x01,0x03,0x00,0x80,
+0xc0,0x41,0x01,0x3f,0xff,0x83,0x01,0x80,0x40,0x01,0x02,0x00,0x03,0x40,0x01,0x80,
+0x00,0x21,0x01,0x80,0x80,0x01,0x02,0x40,0x02,0x83,0x01,0x80,0x40,0xb2,0x01,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x65,0x61,0x63,0x68,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x30,0x00,0x03,0x00,0x05,0x00,0x00,
+0x00,0x06,0x02,0x00,0x00,0x26,0x01,0x80,0x80,0x15,0x02,0x00,0x40,0x01,0x01,0x80,
+0x00,0xac,0x01,0x80,0x80,0x16,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x01,0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0x3b,0x00,0x01,0x00,0x03,0x00,0x00,
+0x00,0x07,0x00,0xc0,0x00,0x03,0x01,0x40,0x04,0x83,0x00,0x80,0x40,0x41,0x00,0x80,
+0x00,0x20,0x01,0x40,0x04,0x83,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x03,0x65,0x6e,0x64,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x00,0x00,0x53,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0b,0x00,0xc0,0x00,
+0x03,0x01,0x40,0x04,0x83,0x00,0x80,0x40,0xc1,0x00,0x80,0x00,0x20,0x00,0xc0,0x02,
+0x99,0x00,0xc0,0x00,0x03,0x01,0x40,0x04,0x83,0x00,0x80,0x40,0x41,0x00,0x80,0x00,
+0x20,0x00,0x80,0x40,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x02,0x00,0x0c,0x65,0x78,0x63,0x6c,0x75,0x64,0x65,0x5f,0x65,0x6e,0x64,0x3f,0x00,
+0x00,0x01,0x21,0x00,0x00,0x00,0x00,0x3d,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x07,
+0x00,0xc0,0x00,0x03,0x01,0x40,0x04,0x83,0x00,0x80,0x40,0x41,0x00,0x80,0x00,0x20,
+0x01,0x40,0x00,0x03,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x02,0x00,0x05,0x66,0x69,0x72,0x73,0x74,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x00,0x00,0x53,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x0c,0x01,0x40,0x00,
+0x03,0x01,0xc0,0x04,0x83,0x00,0x80,0x80,0x41,0x01,0x00,0x40,0x01,0x01,0xc0,0x02,
+0x03,0x01,0x00,0x00,0xa0,0x01,0x40,0x02,0x19,0x01,0x00,0x40,0x01,0x01,0xc0,0x09,
+0x83,0x01,0x00,0x00,0xa0,0x01,0x00,0x40,0x20,0x01,0x00,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x02,0x00,0x08,0x69,0x6e,0x63,0x6c,0x75,0x64,0x65,0x3f,0x00,
+0x00,0x01,0x21,0x00,0x00,0x00,0x00,0xb6,0x00,0x03,0x00,0x07,0x00,0x00,0x00,0x1f,
+0x01,0x80,0x00,0x11,0x02,0x40,0x00,0x03,0x02,0xc0,0x04,0x83,0x03,0x00,0x00,0x07,
+0x01,0x80,0x41,0xa0,0x00,0x80,0xc0,0x01,0x01,0x80,0x00,0x11,0x02,0x40,0x00,0x03,
+0x02,0xc0,0x04,0x83,0x03,0x00,0x00,0x08,0x01,0x80,0x41,0xa0,0x01,0x00,0xc0,0x01,
+0x01,0x80,0x40,0x01,0x02,0x40,0x00,0x03,0x02,0xc0,0x04,0x83,0x02,0x01,0x00,0xc1,
+0x01,0x80,0x80,0xb2,0x01,0xc0,0x01,0x19,0x01,0x80,0x40,0x01,0x01,0x80,0xc0,0x20,
+0x01,0xc0,0x02,0x99,0x01,0x80,0x80,0x01,0x02,0x40,0x00,0x03,0x02,0xc0,0x04,0x83,
+0x02,0x01,0x00,0x41,0x01,0x80,0x80,0xb2,0x01,0xc0,0x01,0x99,0x01,0x80,0x80,0x01,
+0x01,0x80,0xc0,0x20,0x01,0x81,0x00,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x05,0x00,0x05,0x52,0x61,0x6e,0x67,0x65,0x00,0x00,0x03,0x6e,0x65,
+0x77,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x0c,0x65,0x78,0x63,0x6c,0x75,0x64,0x65,
+0x5f,0x65,0x6e,0x64,0x3f,0x00,0x00,0x01,0x21,0x00,0x00,0x00,0x00,0x3c,0x00,0x01,
+0x00,0x03,0x00,0x00,0x00,0x07,0x00,0xc0,0x00,0x03,0x01,0x40,0x04,0x83,0x00,0x80,
+0x40,0x41,0x00,0x80,0x00,0x20,0x01,0x40,0x04,0x83,0x00,0x80,0x40,0xb2,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x6c,0x61,0x73,0x74,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x52,0x00,0x02,0x00,0x04,0x00,0x00,
+0x00,0x0c,0x01,0x40,0x00,0x03,0x01,0xc0,0x04,0x83,0x00,0x80,0x80,0x41,0x01,0x00,
+0x40,0x01,0x01,0xc0,0x02,0x03,0x01,0x00,0x00,0xa0,0x01,0x40,0x02,0x19,0x01,0x00,
+0x40,0x01,0x01,0xc0,0x09,0x83,0x01,0x00,0x00,0xa0,0x01,0x00,0x40,0x20,0x01,0x00,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x07,0x6d,0x65,0x6d,0x62,
+0x65,0x72,0x3f,0x00,0x00,0x01,0x21,0x00,0x00,0x00,0x00,0x4a,0x00,0x01,0x00,0x03,
+0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,
+0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,
+0x00,0x0a,0x52,0x61,0x6e,0x67,0x65,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x05,0x63,
+0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x43,0x6c,0x61,0x73,
+0x73,0x00,0x00,0x00,0x00,0x57,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,
+0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x0a,0x52,0x61,0x6e,0x67,
+0x65,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x0a,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,
+0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x0d,0x53,0x74,0x61,0x6e,0x64,
+0x61,0x72,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x00,0x00,0x4c,0x00,0x01,0x00,
+0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x01,
+0x91,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x04,0x00,0x0c,0x52,0x75,0x6e,0x74,0x69,0x6d,0x65,0x45,0x72,0x72,0x6f,0x72,0x00,
+0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x43,
+0x6c,0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x4d,0x00,0x01,0x00,0x03,0x00,0x00,0x00,
+0x05,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,
+0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x0d,0x53,
+0x74,0x61,0x6e,0x64,0x61,0x72,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x05,0x63,
+0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x43,0x6c,0x61,0x73,
+0x73,0x00,0x00,0x00,0x00,0x56,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,
+0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x0d,0x53,0x74,0x61,0x6e,
+0x64,0x61,0x72,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x0a,0x73,0x75,0x70,0x65,
+0x72,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x09,0x45,0x78,
+0x63,0x65,0x70,0x74,0x69,0x6f,0x6e,0x00,0x00,0x00,0x00,0x46,0x00,0x01,0x00,0x03,
+0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,
+0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,
+0x00,0x06,0x53,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x43,0x6c,0x61,0x73,0x73,0x00,0x00,0x00,
+0x00,0x4c,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x11,0x00,0x80,
+0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x06,0x53,0x74,0x72,0x69,0x6e,0x67,0x00,0x00,
+0x0a,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x00,0x00,0x41,0x00,0x01,
+0x00,0x03,0x00,0x00,0x00,0x06,0x00,0x80,0x00,0x3d,0x01,0x40,0x02,0x03,0x00,0x80,
+0x00,0xb0,0x01,0x00,0x00,0xbd,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x02,0x10,0x00,0x01,0x61,0x10,0x00,0x05,0x61,0x61,0x61,0x61,0x61,0x00,0x00,
+0x00,0x02,0x00,0x01,0x2a,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x42,0x00,
+0x01,0x00,0x03,0x00,0x00,0x00,0x06,0x00,0x80,0x00,0x3d,0x01,0x00,0x00,0xbd,0x00,
+0x80,0x00,0xac,0x01,0x00,0x01,0x3d,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x03,0x10,0x00,0x01,0x61,0x10,0x00,0x01,0x62,0x10,0x00,0x02,0x61,0x62,
+0x00,0x00,0x00,0x02,0x00,0x01,0x2b,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,
+0xda,0x00,0x06,0x00,0x08,0x00,0x00,0x00,0x28,0x03,0x00,0x00,0x3d,0x03,0x80,0x00,
+0x3d,0x03,0x00,0x00,0xa0,0x00,0x81,0x80,0x01,0x03,0x00,0x00,0x3d,0x03,0x80,0x00,
+0xbd,0x03,0x00,0x00,0xa0,0x01,0x01,0x80,0x01,0x03,0x00,0x00,0xbd,0x03,0x80,0x00,
+0x3d,0x03,0x00,0x00,0xa0,0x01,0x81,0x80,0x01,0x03,0x00,0x01,0x3d,0x03,0x80,0x01,
+0xbd,0x03,0x00,0x00,0xa0,0x02,0x01,0x80,0x01,0x03,0x00,0x01,0xbd,0x03,0x80,0x01,
+0x3d,0x03,0x00,0x00,0xa0,0x02,0x81,0x80,0x01,0x03,0x00,0x40,0x01,0x03,0xbf,0xff,
+0x83,0x03,0x00,0x40,0xb2,0x03,0x40,0x01,0x99,0x03,0x00,0x80,0x01,0x03,0xbf,0xff,
+0x03,0x03,0x00,0x40,0xb2,0x03,0x40,0x01,0x99,0x03,0x00,0xc0,0x01,0x03,0xc0,0x00,
+0x03,0x03,0x00,0x40,0xb2,0x03,0x40,0x01,0x99,0x03,0x01,0x00,0x01,0x03,0xbf,0xff,
+0x03,0x03,0x00,0x40,0xb2,0x03,0x40,0x01,0x99,0x03,0x01,0x40,0x01,0x03,0xc0,0x00,
+0x03,0x03,0x00,0x40,0xb2,0x03,0x00,0x00,0x29,0x00,0x00,0x00,0x04,0x10,0x00,0x00,
+0x10,0x00,0x09,0x6e,0x6f,0x74,0x20,0x65,0x6d,0x70,0x74,0x79,0x10,0x00,0x03,0x61,
+0x62,0x63,0x10,0x00,0x03,0x63,0x62,0x61,0x00,0x00,0x00,0x02,0x00,0x03,0x3c,0x3d,
+0x3e,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x4d,0x00,0x01,0x00,0x03,0x00,
+0x00,0x00,0x09,0x00,0x80,0x00,0x3d,0x01,0x00,0x00,0x3d,0x00,0x80,0x00,0xb2,0x00,
+0xc0,0x02,0x19,0x00,0x80,0x00,0x3d,0x01,0x00,0x00,0xbd,0x00,0x80,0x00,0xb2,0x00,
+0x80,0x40,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x02,0x10,0x00,0x03,0x61,0x62,
+0x63,0x10,0x00,0x03,0x63,0x62,0x61,0x00,0x00,0x00,0x02,0x00,0x02,0x3d,0x3d,0x00,
+0x00,0x01,0x21,0x00,0x00,0x00,0x01,0xad,0x00,0x0c,0x00,0x0f,0x00,0x00,0x00,0x5d,
+0x06,0x00,0x00,0x3d,0x06,0xbf,0xff,0x83,0x06,0x00,0x00,0xa0,0x00,0x83,0x00,0x01,
+0x06,0x00,0x00,0x3d,0x06,0xbf,0xff,0x03,0x06,0x00,0x00,0xa0,0x01,0x03,0x00,0x01,
+0x06,0x00,0x00,0x3d,0x06,0xc0,0x04,0x83,0x06,0x00,0x00,0xa0,0x01,0x83,0x00,0x01,
+0x06,0x00,0x00,0x3d,0x06,0xbf,0xfa,0x83,0x06,0x00,0x00,0xa0,0x02,0x03,0x00,0x01,
+0x06,0x00,0x00,0x3d,0x06,0xbf,0xff,0x83,0x07,0x3f,0xff,0x03,0x06,0x00,0x01,0x20,
+0x02,0x83,0x00,0x01,0x06,0x00,0x00,0x3d,0x06,0xc0,0x04,0x83,0x07,0x3f,0xff,0x83,
+0x06,0x00,0x01,0x20,0x03,0x03,0x00,0x01,0x06,0x00,0x00,0x3d,0x06,0xbf,0xfa,0x83,
+0x07,0x3f,0xff,0x83,0x06,0x00,0x01,0x20,0x03,0x83,0x00,0x01,0x06,0x00,0x00,0x3d,
+0x06,0xbf,0xff,0x83,0x07,0x3f,0xff,0x83,0x06,0x00,0x01,0x20,0x04,0x03,0x00,0x01,
+0x06,0x00,0x00,0x3d,0x06,0xc0,0x00,0x03,0x07,0x40,0x00,0x83,0x06,0x00,0x01,0x20,
+0x04,0x83,0x00,0x01,0x06,0x00,0x00,0x3d,0x06,0x80,0x00,0xbd,0x06,0x00,0x00,0xa0,
+0x05,0x03,0x00,0x01,0x06,0x00,0x00,0x3d,0x06,0x80,0x01,0x3d,0x06,0x00,0x00,0xa0,
+0x05,0x83,0x00,0x01,0x06,0x00,0x40,0x01,0x06,0x80,0x01,0xbd,0x06,0x00,0x40,0xb2,
+0x06,0x40,0x01,0x99,0x06,0x00,0x80,0x01,0x06,0x80,0x02,0x3d,0x06,0x00,0x40,0xb2,
+0x06,0x40,0x01,0x99,0x06,0x00,0xc0,0x01,0x06,0x80,0x00,0x05,0x06,0x00,0x40,0xb2,
+0x06,0x40,0x01,0x99,0x06,0x01,0x00,0x01,0x06,0x80,0x00,0x05,0x06,0x00,0x40,0xb2,
+0x06,0x40,0x01,0x99,0x06,0x01,0x40,0x01,0x06,0x80,0x00,0x05,0x06,0x00,0x40,0xb2,
+0x06,0x40,0x01,0x99,0x06,0x01,0x80,0x01,0x06,0x80,0x00,0x05,0x06,0x00,0x40,0xb2,
+0x06,0x40,0x01,0x99,0x06,0x01,0xc0,0x01,0x06,0x80,0x00,0x05,0x06,0x00,0x40,0xb2,
+0x06,0x40,0x01,0x99,0x06,0x02,0x00,0x01,0x06,0x80,0x02,0xbd,0x06,0x00,0x40,0xb2,
+0x06,0x40,0x01,0x99,0x06,0x02,0x40,0x01,0x06,0x80,0x00,0xbd,0x06,0x00,0x40,0xb2,
+0x06,0x40,0x01,0x99,0x06,0x02,0x80,0x01,0x06,0x80,0x00,0xbd,0x06,0x00,0x40,0xb2,
+0x06,0x40,0x01,0x99,0x06,0x02,0xc0,0x01,0x06,0x80,0x00,0x05,0x06,0x00,0x40,0xb2,
+0x06,0x00,0x00,0x29,0x00,0x00,0x00,0x06,0x10,0x00,0x03,0x61,0x62,0x63,0x10,0x00,
+0x02,0x62,0x63,0x10,0x00,0x02,0x58,0x58,0x10,0x00,0x01,0x61,0x10,0x00,0x01,0x63,
+0x10,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x02,0x5b,0x5d,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x00,0x03,0x09,0x00,0x13,0x00,0x16,0x00,0x00,0x00,0xb4,0x09,0x80,0x00,
+0x3d,0x0a,0x40,0x00,0x03,0x0a,0xbf,0xff,0x83,0x0a,0x05,0x00,0x41,0x09,0x80,0x00,
+0xa0,0x00,0x84,0xc0,0x01,0x09,0x80,0x00,0x3d,0x0a,0x40,0x00,0x03,0x0a,0xc0,0x00,
+0x03,0x0a,0x05,0x00,0x41,0x09,0x80,0x00,0xa0,0x01,0x04,0xc0,0x01,0x09,0x80,0x00,
+0x3d,0x0a,0x40,0x00,0x03,0x0a,0xc0,0x00,0x83,0x0a,0x05,0x00,0x41,0x09,0x80,0x00,
+0xa0,0x01,0x84,0xc0,0x01,0x09,0x80,0x00,0x3d,0x0a,0x40,0x00,0x03,0x0a,0xc0,0x01,
+0x03,0x0a,0x05,0x00,0x41,0x09,0x80,0x00,0xa0,0x02,0x04,0xc0,0x01,0x09,0x80,0x00,
+0x3d,0x0a,0x40,0x00,0x03,0x0a,0xc0,0x01,0x83,0x0a,0x05,0x00,0x41,0x09,0x80,0x00,
+0xa0,0x02,0x84,0xc0,0x01,0x09,0x80,0x00,0x3d,0x0a,0x3f,0xff,0x83,0x0a,0xbf,0xfe,
+0x83,0x0a,0x05,0x00,0x41,0x09,0x80,0x00,0xa0,0x03,0x04,0xc0,0x01,0x09,0x80,0x00,
+0x3d,0x0a,0x3f,0xfe,0x83,0x0a,0xc0,0x01,0x03,0x0a,0x05,0x00,0x41,0x09,0x80,0x00,
+0xa0,0x03,0x84,0xc0,0x01,0x09,0x80,0x00,0x3d,0x0a,0x40,0x01,0x03,0x0a,0xc0,0x01,
+0x83,0x0a,0x05,0x00,0x41,0x09,0x80,0x00,0xa0,0x04,0x04,0xc0,0x01,0x09,0x80,0x00,
+0x3d,0x0a,0x40,0x01,0x83,0x0a,0xc0,0x02,0x03,0x0a,0x05,0x00,0x41,0x09,0x80,0x00,
+0xa0,0x04,0x84,0xc0,0x01,0x09,0x80,0x00,0x3d,0x0a,0x40,0x00,0x03,0x0a,0xbf,0xff,
+0x83,0x0a,0x05,0x00,0xc1,0x09,0x80,0x00,0xa0,0x05,0x04,0xc0,0x01,0x09,0x80,0x00,
+0x3d,0x0a,0x40,0x00,0x03,0x0a,0xc0,0x00,0x03,0x0a,0x05,0x00,0xc1,0x09,0x80,0x00,
+0xa0,0x05,0x84,0xc0,0x01,0x09,0x80,0x00,0x3d,0x0a,0x40,0x00,0x03,0x0a,0xc0,0x00,
+0x83,0x0a,0x05,0x00,0xc1,0x09,0x80,0x00,0xa0,0x06,0x04,0xc0,0x01,0x09,0x80,0x00,
+0x3d,0x0a,0x40,0x00,0x03,0x0a,0xc0,0x01,0x03,0x0a,0x05,0x00,0xc1,0x09,0x80,0x00,
+0xa0,0x06,0x84,0xc0,0x01,0x09,0x80,0x00,0x3d,0x0a,0x40,0x00,0x03,0x0a,0xc0,0x01,
+0x83,0x0a,0x05,0x00,0xc1,0x09,0x80,0x00,0xa0,0x07,0x04,0xc0,0x01,0x09,0x80,0x00,
+0x3d,0x0a,0x3f,0xff,0x83,0x0a,0xbf,0xfe,0x83,0x0a,0x05,0x00,0xc1,0x09,0x80,0x00,
+0xa0,0x07,0x84,0xc0,0x01,0x09,0x80,0x00,0x3d,0x0a,0x3f,0xfe,0x83,0x0a,0xc0,0x01,
+0x03,0x0a,0x05,0x00,0xc1,0x09,0x80,0x00,0xa0,0x08,0x04,0xc0,0x01,0x09,0x80,0x00,
+0x3d,0x0a,0x40,0x01,0x03,0x0a,0xc0,0x01,0x83,0x0a,0x05,0x00,0xc1,0x09,0x80,0x00,
+0xa0,0x08,0x84,0xc0,0x01,0x09,0x80,0x00,0x3d,0x0a,0x40,0x01,0x83,0x0a,0xc0,0x02,
+0x03,0x0a,0x05,0x00,0xc1,0x09,0x80,0x00,0xa0,0x09,0x04,0xc0,0x01,0x09,0x80,0x40,
+0x01,0x0a,0x00,0x00,0xbd,0x09,0x80,0x40,0xb2,0x09,0xc0,0x01,0x99,0x09,0x80,0x80,
+0x01,0x0a,0x00,0x01,0x3d,0x09,0x80,0x40,0xb2,0x09,0xc0,0x01,0x99,0x09,0x80,0xc0,
+0x01,0x0a,0x00,0x01,0xbd,0x09,0x80,0x40,0xb2,0x09,0xc0,0x01,0x99,0x09,0x81,0x00,
+0x01,0x0a,0x00,0x01,0xbd,0x09,0x80,0x40,0xb2,0x09,0xc0,0x01,0x99,0x09,0x81,0x40,
+0x01,0x0a,0x00,0x01,0xbd,0x09,0x80,0x40,0xb2,0x09,0xc0,0x01,0x99,0x09,0x81,0x80,
+0x01,0x0a,0x00,0x02,0x3d,0x09,0x80,0x40,0xb2,0x09,0xc0,0x01,0x99,0x09,0x81,0xc0,
+0x01,0x0a,0x00,0x01,0xbd,0x09,0x80,0x40,0xb2,0x09,0xc0,0x01,0x99,0x09,0x82,0x00,
+0x01,0x0a,0x00,0x00,0xbd,0x09,0x80,0x40,0xb2,0x09,0xc0,0x01,0x99,0x09,0x84,0x80,
+0x01,0x0a,0x00,0x00,0x05,0x09,0x80,0x40,0xb2,0x09,0xc0,0x01,0x99,0x09,0x82,0x80,
+0x01,0x0a,0x00,0x00,0xbd,0x09,0x80,0x40,0xb2,0x09,0xc0,0x01,0x99,0x09,0x82,0xc0,
+0x01,0x0a,0x00,0x00,0xbd,0x09,0x80,0x40,0xb2,0x09,0xc0,0x01,0x99,0x09,0x83,0x00,
+0x01,0x0a,0x00,0x01,0x3d,0x09,0x80,0x40,0xb2,0x09,0xc0,0x01,0x99,0x09,0x83,0x40,
+0x01,0x0a,0x00,0x01,0xbd,0x09,0x80,0x40,0xb2,0x09,0xc0,0x01,0x99,0x09,0x83,0x80,
+0x01,0x0a,0x00,0x01,0xbd,0x09,0x80,0x40,0xb2,0x09,0xc0,0x01,0x99,0x09,0x83,0xc0,
+0x01,0x0a,0x00,0x02,0xbd,0x09,0x80,0x40,0xb2,0x09,0xc0,0x01,0x99,0x09,0x84,0x00,
+0x01,0x0a,0x00,0x01,0xbd,0x09,0x80,0x40,0xb2,0x09,0xc0,0x01,0x99,0x09,0x84,0x40,
+0x01,0x0a,0x00,0x00,0xbd,0x09,0x80,0x40,0xb2,0x09,0xc0,0x01,0x99,0x09,0x84,0x80,
+0x01,0x0a,0x00,0x00,0x05,0x09,0x80,0x40,0xb2,0x09,0x80,0x00,0x29,0x00,0x00,0x00,
+0x06,0x10,0x00,0x03,0x61,0x62,0x63,0x10,0x00,0x00,0x10,0x00,0x01,0x62,0x10,0x00,
+0x02,0x62,0x63,0x10,0x00,0x02,0x61,0x62,0x10,0x00,0x01,0x61,0x00,0x00,0x00,0x02,
+0x00,0x02,0x5b,0x5d,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x62,0x00,0x02,
+0x00,0x04,0x00,0x00,0x00,0x0c,0x00,0x80,0x00,0x3d,0x01,0x00,0x40,0x01,0x01,0x00,
+0x00,0x20,0x01,0x00,0x40,0x01,0x01,0x80,0x00,0x3d,0x01,0x00,0x40,0xb2,0x01,0x40,
+0x02,0x19,0x01,0x00,0x00,0x3d,0x01,0x00,0x00,0x20,0x01,0x80,0x00,0xbd,0x01,0x00,
+0x40,0xb2,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x02,0x10,0x00,0x03,0x61,0x62,0x63,
+0x10,0x00,0x03,0x41,0x62,0x63,0x00,0x00,0x00,0x02,0x00,0x0a,0x63,0x61,0x70,0x69,
+0x74,0x61,0x6c,0x69,0x7a,0x65,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x4f,
+0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x07,0x00,0x80,0x00,0x3d,0x01,0x00,0x40,0x01,
+0x01,0x00,0x00,0x20,0x01,0x00,0x40,0x01,0x01,0x80,0x00,0xbd,0x01,0x00,0x40,0xb2,
+0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x02,0x10,0x00,0x03,0x61,0x62,0x63,0x10,0x00,
+0x03,0x41,0x62,0x63,0x00,0x00,0x00,0x02,0x00,0x0b,0x63,0x61,0x70,0x69,0x74,0x61,
+0x6c,0x69,0x7a,0x65,0x21,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0xf0,0x00,
+0x07,0x00,0x09,0x00,0x00,0x00,0x2b,0x03,0x80,0x00,0x3d,0x03,0x80,0x00,0x20,0x00,
+0x81,0xc0,0x01,0x03,0x80,0x00,0xbd,0x03,0x80,0x00,0x20,0x01,0x01,0xc0,0x01,0x03,
+0x80,0x01,0x3d,0x03,0x80,0x00,0x20,0x01,0x81,0xc0,0x01,0x03,0x80,0x01,0xbd,0x03,
+0x80,0x00,0x20,0x02,0x01,0xc0,0x01,0x03,0x80,0x02,0x3d,0x04,0x00,0x02,0xbd,0x03,
+0x80,0x00,0xa0,0x02,0x81,0xc0,0x01,0x03,0x00,0x01,0x3d,0x03,0x81,0x80,0x01,0x03,
+0x80,0x00,0x20,0x03,0x80,0x40,0x01,0x04,0x00,0x00,0x3d,0x03,0x80,0x40,0xb2,0x03,
+0xc0,0x01,0x99,0x03,0x80,0x80,0x01,0x04,0x00,0x00,0xbd,0x03,0x80,0x40,0xb2,0x03,
+0xc0,0x01,0x99,0x03,0x80,0xc0,0x01,0x04,0x00,0x00,0x3d,0x03,0x80,0x40,0xb2,0x03,
+0xc0,0x01,0x99,0x03,0x81,0x00,0x01,0x04,0x00,0x01,0x3d,0x03,0x80,0x40,0xb2,0x03,
+0xc0,0x01,0x99,0x03,0x81,0x40,0x01,0x04,0x00,0x00,0x3d,0x03,0x80,0x40,0xb2,0x03,
+0xc0,0x01,0x99,0x03,0x81,0x80,0x01,0x04,0x00,0x01,0x3d,0x03,0x80,0x40,0xb2,0x03,
+0x80,0x00,0x29,0x00,0x00,0x00,0x06,0x10,0x00,0x03,0x61,0x62,0x63,0x10,0x00,0x00,
+0x10,0x00,0x04,0x61,0x62,0x63,0x0a,0x10,0x00,0x05,0x61,0x62,0x63,0x0a,0x0a,0x10,
+0x00,0x04,0x61,0x62,0x63,0x09,0x10,0x00,0x01,0x09,0x00,0x00,0x00,0x02,0x00,0x05,
+0x63,0x68,0x6f,0x6d,0x70,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0xd5,0x00,
+0x06,0x00,0x08,0x00,0x00,0x00,0x24,0x00,0x80,0x00,0x3d,0x01,0x00,0x00,0xbd,0x01,
+0x80,0x01,0x3d,0x02,0x00,0x01,0xbd,0x02,0x80,0x02,0x3d,0x03,0x00,0x40,0x01,0x03,
+0x00,0x00,0x20,0x03,0x00,0x80,0x01,0x03,0x00,0x00,0x20,0x03,0x00,0xc0,0x01,0x03,
+0x00,0x00,0x20,0x03,0x01,0x00,0x01,0x03,0x00,0x00,0x20,0x03,0x01,0x40,0x01,0x03,
+0x80,0x02,0xbd,0x03,0x00,0x00,0xa0,0x03,0x00,0x40,0x01,0x03,0x80,0x00,0x3d,0x03,
+0x00,0x40,0xb2,0x03,0x40,0x01,0x99,0x03,0x00,0x80,0x01,0x03,0x80,0x00,0xbd,0x03,
+0x00,0x40,0xb2,0x03,0x40,0x01,0x99,0x03,0x00,0xc0,0x01,0x03,0x80,0x00,0x3d,0x03,
+0x00,0x40,0xb2,0x03,0x40,0x01,0x99,0x03,0x01,0x00,0x01,0x03,0x80,0x01,0x3d,0x03,
+0x00,0x40,0xb2,0x03,0x40,0x01,0x99,0x03,0x01,0x40,0x01,0x03,0x80,0x00,0x3d,0x03,
+0x00,0x40,0xb2,0x03,0x00,0x00,0x29,0x00,0x00,0x00,0x06,0x10,0x00,0x03,0x61,0x62,
+0x63,0x10,0x00,0x00,0x10,0x00,0x04,0x61,0x62,0x63,0x0a,0x10,0x00,0x05,0x61,0x62,
+0x63,0x0a,0x0a,0x10,0x00,0x04,0x61,0x62,0x63,0x09,0x10,0x00,0x01,0x09,0x00,0x00,
+0x00,0x02,0x00,0x06,0x63,0x68,0x6f,0x6d,0x70,0x21,0x00,0x00,0x02,0x3d,0x3d,0x00,
+0x00,0x00,0x00,0x82,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x15,0x02,0x00,0x00,0x3d,
+0x02,0x00,0x00,0x20,0x00,0x81,0x00,0x01,0x02,0x00,0x00,0xbd,0x02,0x00,0x00,0x20,
+0x01,0x01,0x00,0x01,0x01,0x80,0x00,0xbd,0x02,0x00,0xc0,0x01,0x02,0x00,0x00,0x20,
+0x02,0x00,0x40,0x01,0x02,0x80,0x00,0x3d,0x02,0x00,0x40,0xb2,0x02,0x40,0x01,0x99,
+0x02,0x00,0x80,0x01,0x02,0x80,0x01,0x3d,0x02,0x00,0x40,0xb2,0x02,0x40,0x01,0x99,
+0x02,0x00,0xc0,0x01,0x02,0x80,0x00,0xbd,0x02,0x00,0x40,0xb2,0x02,0x00,0x00,0x29,
+0x00,0x00,0x00,0x03,0x10,0x00,0x00,0x10,0x00,0x03,0x61,0x62,0x63,0x10,0x00,0x02,
+0x61,0x62,0x00,0x00,0x00,0x02,0x00,0x04,0x63,0x68,0x6f,0x70,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x00,0x00,0x67,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x0e,0x00,0x80,
+0x00,0x3d,0x01,0x00,0x00,0xbd,0x01,0x80,0x40,0x01,0x01,0x80,0x00,0x20,0x01,0x80,
+0x80,0x01,0x01,0x80,0x00,0x20,0x01,0x80,0x40,0x01,0x02,0x00,0x00,0x3d,0x01,0x80,
+0x40,0xb2,0x01,0xc0,0x01,0x99,0x01,0x80,0x80,0x01,0x02,0x00,0x01,0x3d,0x01,0x80,
+0x40,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x03,0x10,0x00,0x00,0x10,0x00,0x03,
+0x61,0x62,0x63,0x10,0x00,0x02,0x61,0x62,0x00,0x00,0x00,0x02,0x00,0x05,0x63,0x68,
+0x6f,0x70,0x21,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x68,0x00,0x03,0x00,
+0x05,0x00,0x00,0x00,0x0e,0x01,0x80,0x00,0x3d,0x01,0x80,0x00,0x20,0x00,0x80,0xc0,
+0x01,0x01,0x00,0x00,0x3d,0x01,0x80,0x80,0x01,0x01,0x80,0x00,0x20,0x01,0x80,0x40,
+0x01,0x02,0x00,0x00,0xbd,0x01,0x80,0x40,0xb2,0x01,0xc0,0x01,0x99,0x01,0x80,0x80,
+0x01,0x02,0x00,0x00,0x3d,0x01,0x80,0x40,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,
+0x02,0x10,0x00,0x03,0x41,0x42,0x43,0x10,0x00,0x03,0x61,0x62,0x63,0x00,0x00,0x00,
+0x02,0x00,0x08,0x64,0x6f,0x77,0x6e,0x63,0x61,0x73,0x65,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x00,0x00,0x4d,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x07,0x00,0x80,0x00,
+0x3d,0x01,0x00,0x40,0x01,0x01,0x00,0x00,0x20,0x01,0x00,0x40,0x01,0x01,0x80,0x00,
+0xbd,0x01,0x00,0x40,0xb2,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x02,0x10,0x00,0x03,
+0x41,0x42,0x43,0x10,0x00,0x03,0x61,0x62,0x63,0x00,0x00,0x00,0x02,0x00,0x09,0x64,
+0x6f,0x77,0x6e,0x63,0x61,0x73,0x65,0x21,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,
+0x00,0xa7,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x0d,0x00,0x80,0x00,0x3d,0x02,0x00,
+0x00,0xbd,0x02,0x80,0x01,0x3d,0x03,0x00,0x01,0xbd,0x01,0x01,0x01,0xb7,0x01,0x81,
+0x00,0x37,0x02,0x00,0x40,0x01,0x02,0x80,0x03,0x40,0x02,0x00,0x00,0x21,0x02,0x00,
+0x80,0x01,0x02,0x80,0xc0,0x01,0x02,0x00,0x40,0xb2,0x02,0x00,0x00,0x29,0x00,0x00,
+0x00,0x04,0x10,0x00,0x21,0x66,0x69,0x72,0x73,0x74,0x20,0x6c,0x69,0x6e,0x65,0x0a,
+0x73,0x65,0x63,0x6f,0x6e,0x64,0x20,0x6c,0x69,0x6e,0x65,0x0a,0x74,0x68,0x69,0x72,
+0x64,0x20,0x6c,0x69,0x6e,0x65,0x10,0x00,0x0b,0x66,0x69,0x72,0x73,0x74,0x20,0x6c,
+0x69,0x6e,0x65,0x0a,0x10,0x00,0x0c,0x73,0x65,0x63,0x6f,0x6e,0x64,0x20,0x6c,0x69,
+0x6e,0x65,0x0a,0x10,0x00,0x0a,0x74,0x68,0x69,0x72,0x64,0x20,0x6c,0x69,0x6e,0x65,
+0x00,0x00,0x00,0x02,0x00,0x09,0x65,0x61,0x63,0x68,0x5f,0x6c,0x69,0x6e,0x65,0x00,
+0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x2d,0x00,0x03,0x00,0x05,0x00,0x00,0x00,
+0x05,0x02,0x00,0x00,0x26,0x01,0x80,0xc0,0x15,0x02,0x00,0x40,0x01,0x01,0x80,0x00,
+0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x3c,
+0x3c,0x00,0x00,0x00,0x00,0x54,0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x09,0x00,0x80,
+0x00,0x3d,0x01,0x00,0x00,0xbd,0x01,0x80,0x40,0x01,0x01,0x80,0x00,0x20,0x01,0xc0,
+0x01,0x99,0x01,0x80,0x80,0x01,0x01,0x80,0x00,0x20,0x01,0x80,0x40,0x20,0x01,0x80,
+0x00,0x29,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x10,0x00,0x09,0x6e,0x6f,0x74,0x20,
+0x65,0x6d,0x70,0x74,0x79,0x00,0x00,0x00,0x02,0x00,0x06,0x65,0x6d,0x70,0x74,0x79,
+0x3f,0x00,0x00,0x01,0x21,0x00,0x00,0x00,0x00,0x4f,0x00,0x01,0x00,0x03,0x00,0x00,
+0x00,0x09,0x00,0x80,0x00,0x3d,0x01,0x00,0x00,0x3d,0x00,0x80,0x00,0xa0,0x00,0xc0,
+0x02,0x19,0x00,0x80,0x00,0x3d,0x01,0x00,0x00,0xbd,0x00,0x80,0x00,0xa0,0x00,0x80,
+0x40,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x02,0x10,0x00,0x03,0x61,0x62,0x63,
+0x10,0x00,0x03,0x63,0x62,0x61,0x00,0x00,0x00,0x02,0x00,0x04,0x65,0x71,0x6c,0x3f,
+0x00,0x00,0x01,0x21,0x00,0x00,0x00,0x02,0x19,0x00,0x01,0x00,0x06,0x00,0x00,0x00,
+0x3f,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x3d,0x01,0x80,0x00,0xbd,0x02,0x00,0x01,
+0x3d,0x02,0x80,0x01,0xbd,0x01,0x80,0x41,0x20,0x02,0x00,0x02,0x3d,0x00,0x80,0x01,
+0xa0,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x3d,0x01,0x80,0x00,0xbd,0x02,0x00,0x01,
+0x3d,0x02,0x80,0x03,0x40,0x01,0x80,0x40,0xa1,0x02,0x00,0x02,0xbd,0x00,0x80,0x01,
+0xa0,0x00,0x80,0x00,0x06,0x01,0x00,0x03,0x3d,0x01,0x80,0x03,0xbd,0x02,0x00,0x04,
+0x3d,0x02,0x80,0x04,0xbd,0x01,0x80,0x41,0x20,0x02,0x00,0x05,0x3d,0x00,0x80,0x01,
+0xa0,0x00,0x80,0x00,0x06,0x01,0x00,0x03,0x3d,0x01,0x80,0x03,0xbd,0x02,0x00,0x04,
+0x3d,0x02,0x80,0x05,0x40,0x01,0x80,0x40,0xa1,0x02,0x00,0x05,0xbd,0x00,0x80,0x01,
+0xa0,0x00,0x80,0x00,0x06,0x01,0x00,0x06,0x3d,0x01,0x80,0x06,0xbd,0x02,0x00,0x07,
+0x3d,0x02,0x80,0x07,0xbd,0x01,0x80,0x41,0x20,0x02,0x00,0x08,0x3d,0x00,0x80,0x01,
+0xa0,0x00,0x80,0x00,0x06,0x01,0x00,0x06,0x3d,0x01,0x80,0x06,0xbd,0x02,0x00,0x07,
+0x3d,0x02,0x80,0x07,0x40,0x01,0x80,0x40,0xa1,0x02,0x00,0x08,0xbd,0x00,0x80,0x01,
+0xa0,0x00,0x80,0x00,0x06,0x01,0x00,0x09,0x3d,0x01,0x80,0x09,0xbd,0x02,0x00,0x09,
+0xbd,0x02,0x80,0x09,0x3d,0x01,0x80,0x41,0x20,0x00,0x80,0x01,0x20,0x00,0x80,0x00,
+0x06,0x01,0x00,0x09,0x3d,0x01,0x80,0x09,0xbd,0x02,0x00,0x09,0xbd,0x02,0x80,0x09,
+0x40,0x01,0x80,0x40,0xa1,0x00,0x80,0x01,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,
+0x14,0x10,0x00,0x06,0x61,0x42,0x63,0x61,0x42,0x63,0x10,0x00,0x06,0x61,0x62,0x63,
+0x61,0x62,0x63,0x10,0x00,0x01,0x62,0x10,0x00,0x01,0x42,0x10,0x00,0x12,0x67,0x73,
+0x75,0x62,0x20,0x77,0x69,0x74,0x68,0x6f,0x75,0x74,0x20,0x62,0x6c,0x6f,0x63,0x6b,
+0x10,0x00,0x0f,0x67,0x73,0x75,0x62,0x20,0x77,0x69,0x74,0x68,0x20,0x62,0x6c,0x6f,
+0x63,0x6b,0x10,0x00,0x05,0x24,0x61,0x24,0x61,0x24,0x10,0x00,0x05,0x23,0x61,0x23,
+0x61,0x23,0x10,0x00,0x01,0x23,0x10,0x00,0x01,0x24,0x10,0x00,0x0f,0x6d,0x72,0x75,
+0x62,0x79,0x2f,0x6d,0x72,0x75,0x62,0x79,0x23,0x38,0x34,0x37,0x10,0x00,0x1a,0x6d,
+0x72,0x75,0x62,0x79,0x2f,0x6d,0x72,0x75,0x62,0x79,0x23,0x38,0x34,0x37,0x20,0x77,
+0x69,0x74,0x68,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x10,0x00,0x05,0x24,0x24,0x61,0x24,
+0x24,0x10,0x00,0x05,0x23,0x23,0x61,0x23,0x23,0x10,0x00,0x02,0x23,0x23,0x10,0x00,
+0x02,0x24,0x24,0x10,0x00,0x1c,0x6d,0x72,0x75,0x62,0x79,0x2f,0x6d,0x72,0x75,0x62,
+0x79,0x23,0x38,0x34,0x37,0x20,0x61,0x6e,0x6f,0x74,0x68,0x65,0x72,0x20,0x63,0x61,
+0x73,0x65,0x10,0x00,0x27,0x6d,0x72,0x75,0x62,0x79,0x2f,0x6d,0x72,0x75,0x62,0x79,
+0x23,0x38,0x34,0x37,0x20,0x61,0x6e,0x6f,0x74,0x68,0x65,0x72,0x20,0x63,0x61,0x73,
+0x65,0x20,0x77,0x69,0x74,0x68,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x10,0x00,0x01,0x41,
+0x10,0x00,0x01,0x61,0x00,0x00,0x00,0x02,0x00,0x0c,0x61,0x73,0x73,0x65,0x72,0x74,
+0x5f,0x65,0x71,0x75,0x61,0x6c,0x00,0x00,0x04,0x67,0x73,0x75,0x62,0x00,0x00,0x00,
+0x00,0x31,0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x04,0x02,0x00,0x00,0x26,0x01,0x80,
+0x40,0x01,0x01,0x80,0x00,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x01,0x00,0x0a,0x63,0x61,0x70,0x69,0x74,0x61,0x6c,0x69,0x7a,0x65,0x00,0x00,
+0x00,0x00,0x24,0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x03,0x02,0x00,0x00,0x26,0x00,
+0x00,0x00,0x3d,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x01,0x10,0x00,0x01,0x24,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x03,0x02,
+0x00,0x00,0x26,0x00,0x00,0x00,0x3d,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x01,0x10,
+0x00,0x02,0x24,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x00,0x03,0x00,0x04,
+0x00,0x00,0x00,0x04,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x01,0x80,0x00,0x20,
+0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x0a,0x63,0x61,
+0x70,0x69,0x74,0x61,0x6c,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,0x83,0x00,0x03,0x00,
+0x06,0x00,0x00,0x00,0x12,0x00,0x80,0x00,0x3d,0x01,0x80,0x40,0x01,0x02,0x00,0x00,
+0xbd,0x02,0x80,0x01,0x3d,0x01,0x80,0x01,0x20,0x01,0x00,0x00,0x3d,0x01,0x80,0x80,
+0x01,0x02,0x00,0x00,0xbd,0x02,0x80,0x03,0x40,0x01,0x80,0x00,0xa1,0x01,0x80,0x40,
+0x01,0x02,0x00,0x01,0xbd,0x01,0x80,0x40,0xb2,0x01,0xc0,0x01,0x99,0x01,0x80,0x80,
+0x01,0x02,0x00,0x01,0xbd,0x01,0x80,0x40,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,
+0x04,0x10,0x00,0x06,0x61,0x62,0x63,0x61,0x62,0x63,0x10,0x00,0x01,0x62,0x10,0x00,
+0x01,0x42,0x10,0x00,0x06,0x61,0x42,0x63,0x61,0x42,0x63,0x00,0x00,0x00,0x02,0x00,
+0x05,0x67,0x73,0x75,0x62,0x21,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x31,
+0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x04,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,
+0x01,0x80,0x00,0x20,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+0x00,0x0a,0x63,0x61,0x70,0x69,0x74,0x61,0x6c,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,
+0x42,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x07,0x00,0x80,0x00,0x3d,0x01,0x00,0x40,
+0x01,0x01,0x00,0x00,0x20,0x01,0x80,0x00,0x3d,0x01,0x80,0x00,0x20,0x01,0x00,0x40,
+0xb2,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x01,0x10,0x00,0x03,0x61,0x62,0x63,0x00,
+0x00,0x00,0x02,0x00,0x04,0x68,0x61,0x73,0x68,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,
+0x00,0x00,0x79,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x12,0x00,0x80,0x00,0x3d,0x01,
+0x40,0x30,0x03,0x00,0x80,0x00,0xa0,0x00,0xc0,0x02,0x19,0x00,0x80,0x00,0x3d,0x01,
+0x40,0x31,0x83,0x00,0x80,0x00,0xa0,0x00,0x80,0x40,0x20,0x00,0xc0,0x01,0x99,0x00,
+0x80,0x00,0x3d,0x01,0x00,0x00,0xbd,0x00,0x80,0x00,0xa0,0x00,0xc0,0x02,0x19,0x00,
+0x80,0x00,0x3d,0x01,0x00,0x01,0x3d,0x00,0x80,0x00,0xa0,0x00,0x80,0x40,0x20,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x03,0x10,0x00,0x03,0x61,0x62,0x63,0x10,0x00,0x01,
+0x61,0x10,0x00,0x01,0x64,0x00,0x00,0x00,0x02,0x00,0x08,0x69,0x6e,0x63,0x6c,0x75,
+0x64,0x65,0x3f,0x00,0x00,0x01,0x21,0x00,0x00,0x00,0x00,0x84,0x00,0x01,0x00,0x04,
+0x00,0x00,0x00,0x13,0x00,0x80,0x00,0x3d,0x01,0x00,0x00,0xbd,0x00,0x80,0x00,0xa0,
+0x01,0x3f,0xff,0x83,0x00,0x80,0x40,0xb2,0x00,0xc0,0x02,0x99,0x00,0x80,0x00,0x3d,
+0x01,0x00,0x01,0x3d,0x00,0x80,0x00,0xa0,0x01,0x00,0x00,0x05,0x00,0x80,0x40,0xb2,
+0x00,0xc0,0x03,0x19,0x00,0x80,0x01,0xbd,0x01,0x00,0x00,0xbd,0x01,0xc0,0x00,0x03,
+0x00,0x80,0x01,0x20,0x01,0x40,0x01,0x03,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,
+0x00,0x00,0x00,0x04,0x10,0x00,0x03,0x61,0x62,0x63,0x10,0x00,0x01,0x61,0x10,0x00,
+0x01,0x64,0x10,0x00,0x06,0x61,0x62,0x63,0x61,0x62,0x63,0x00,0x00,0x00,0x02,0x00,
+0x05,0x69,0x6e,0x64,0x65,0x78,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x4f,
+0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x08,0x00,0x80,0x00,0x3d,0x01,0x00,0x40,0x01,
+0x01,0x80,0x00,0xbd,0x01,0x00,0x00,0xa0,0x01,0x00,0x40,0x01,0x01,0x80,0x00,0xbd,
+0x01,0x00,0x40,0xb2,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x10,
+0x00,0x03,0x61,0x62,0x63,0x00,0x00,0x00,0x02,0x00,0x0a,0x69,0x6e,0x69,0x74,0x69,
+0x61,0x6c,0x69,0x7a,0x65,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x54,0x00,
+0x02,0x00,0x04,0x00,0x00,0x00,0x08,0x00,0x80,0x00,0x3d,0x01,0x00,0x40,0x01,0x01,
+0x80,0x00,0xbd,0x01,0x00,0x00,0xa0,0x01,0x00,0x40,0x01,0x01,0x80,0x00,0xbd,0x01,
+0x00,0x40,0xb2,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x10,0x00,
+0x03,0x61,0x62,0x63,0x00,0x00,0x00,0x02,0x00,0x0f,0x69,0x6e,0x69,0x74,0x69,0x61,
+0x6c,0x69,0x7a,0x65,0x5f,0x63,0x6f,0x70,0x79,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,
+0x00,0x00,0x42,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x3d,0x00,
+0x80,0x00,0x20,0x01,0x00,0x01,0x04,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x01,0x10,0x00,0x03,0x61,0x62,0x63,0x00,0x00,0x00,0x03,0x00,0x06,0x69,
+0x6e,0x74,0x65,0x72,0x6e,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x03,0x61,0x62,0x63,
+0x00,0x00,0x00,0x00,0x3c,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,
+0x3d,0x00,0x80,0x00,0x20,0x01,0x40,0x01,0x03,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,
+0x29,0x00,0x00,0x00,0x01,0x10,0x00,0x03,0x61,0x62,0x63,0x00,0x00,0x00,0x02,0x00,
+0x06,0x6c,0x65,0x6e,0x67,0x74,0x68,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,
+0x4c,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x08,0x00,0x80,0x00,0x3d,0x01,0x00,0x40,
+0x01,0x01,0x80,0x00,0xbd,0x01,0x00,0x00,0xa0,0x01,0x00,0x40,0x01,0x01,0x80,0x00,
+0xbd,0x01,0x00,0x40,0xb2,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x02,0x10,0x00,0x00,
+0x10,0x00,0x03,0x61,0x62,0x63,0x00,0x00,0x00,0x02,0x00,0x07,0x72,0x65,0x70,0x6c,
+0x61,0x63,0x65,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x5f,0x00,0x02,0x00,
+0x04,0x00,0x00,0x00,0x0c,0x00,0x80,0x00,0x3d,0x01,0x00,0x40,0x01,0x01,0x00,0x00,
+0x20,0x01,0x00,0x40,0x01,0x01,0x80,0x00,0x3d,0x01,0x00,0x40,0xb2,0x01,0x40,0x02,
+0x19,0x01,0x00,0x00,0x3d,0x01,0x00,0x00,0x20,0x01,0x80,0x00,0xbd,0x01,0x00,0x40,
+0xb2,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x02,0x10,0x00,0x03,0x61,0x62,0x63,0x10,
+0x00,0x03,0x63,0x62,0x61,0x00,0x00,0x00,0x02,0x00,0x07,0x72,0x65,0x76,0x65,0x72,
+0x73,0x65,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x60,0x00,0x02,0x00,0x04,
+0x00,0x00,0x00,0x0c,0x00,0x80,0x00,0x3d,0x01,0x00,0x40,0x01,0x01,0x00,0x00,0x20,
+0x01,0x00,0x40,0x01,0x01,0x80,0x00,0xbd,0x01,0x00,0x40,0xb2,0x01,0x40,0x02,0x19,
+0x01,0x00,0x00,0x3d,0x01,0x00,0x00,0x20,0x01,0x80,0x00,0xbd,0x01,0x00,0x40,0xb2,
+0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x02,0x10,0x00,0x03,0x61,0x62,0x63,0x10,0x00,
+0x03,0x63,0x62,0x61,0x00,0x00,0x00,0x02,0x00,0x08,0x72,0x65,0x76,0x65,0x72,0x73,
+0x65,0x21,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0xa1,0x00,0x01,0x00,0x04,
+0x00,0x00,0x00,0x1a,0x00,0x80,0x00,0x3d,0x01,0x00,0x00,0xbd,0x00,0x80,0x00,0xa0,
+0x01,0x3f,0xff,0x83,0x00,0x80,0x40,0xb2,0x00,0xc0,0x02,0x99,0x00,0x80,0x00,0x3d,
+0x01,0x00,0x01,0x3d,0x00,0x80,0x00,0xa0,0x01,0x00,0x00,0x05,0x00,0x80,0x40,0xb2,
+0x00,0xc0,0x03,0x19,0x00,0x80,0x01,0xbd,0x01,0x00,0x00,0xbd,0x01,0xc0,0x00,0x03,
+0x00,0x80,0x01,0x20,0x01,0x3f,0xff,0x83,0x00,0x80,0x40,0xb2,0x00,0xc0,0x03,0x19,
+0x00,0x80,0x01,0xbd,0x01,0x00,0x00,0xbd,0x01,0xc0,0x01,0x83,0x00,0x80,0x01,0x20,
+0x01,0x40,0x01,0x03,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x04,
+0x10,0x00,0x03,0x61,0x62,0x63,0x10,0x00,0x01,0x61,0x10,0x00,0x01,0x64,0x10,0x00,
+0x06,0x61,0x62,0x63,0x61,0x62,0x63,0x00,0x00,0x00,0x02,0x00,0x06,0x72,0x69,0x6e,
+0x64,0x65,0x78,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x3a,0x00,0x01,0x00,
+0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x3d,0x00,0x80,0x00,0x20,0x01,0x40,0x01,
+0x03,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x10,0x00,0x03,
+0x61,0x62,0x63,0x00,0x00,0x00,0x02,0x00,0x04,0x73,0x69,0x7a,0x65,0x00,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x00,0x01,0xd4,0x00,0x0d,0x00,0x10,0x00,0x00,0x00,0x65,0x06,
+0x80,0x00,0x3d,0x07,0x3f,0xff,0x83,0x06,0x80,0x00,0xa0,0x00,0x83,0x40,0x01,0x06,
+0x80,0x00,0x3d,0x07,0x3f,0xff,0x03,0x06,0x80,0x00,0xa0,0x01,0x03,0x40,0x01,0x06,
+0x80,0x00,0x3d,0x07,0x40,0x04,0x83,0x06,0x80,0x00,0xa0,0x01,0x83,0x40,0x01,0x06,
+0x80,0x00,0x3d,0x07,0x3f,0xfa,0x83,0x06,0x80,0x00,0xa0,0x02,0x03,0x40,0x01,0x06,
+0x80,0x00,0x3d,0x07,0x3f,0xff,0x83,0x07,0xbf,0xff,0x03,0x06,0x80,0x01,0x20,0x02,
+0x83,0x40,0x01,0x06,0x80,0x00,0x3d,0x07,0x40,0x04,0x83,0x07,0xbf,0xff,0x83,0x06,
+0x80,0x01,0x20,0x03,0x03,0x40,0x01,0x06,0x80,0x00,0x3d,0x07,0x3f,0xfa,0x83,0x07,
+0xbf,0xff,0x83,0x06,0x80,0x01,0x20,0x03,0x83,0x40,0x01,0x06,0x80,0x00,0x3d,0x07,
+0x3f,0xff,0x83,0x07,0xbf,0xff,0x83,0x06,0x80,0x01,0x20,0x04,0x03,0x40,0x01,0x06,
+0x80,0x00,0x3d,0x07,0x40,0x00,0x03,0x07,0xc0,0x00,0x83,0x06,0x80,0x01,0x20,0x04,
+0x83,0x40,0x01,0x06,0x82,0x40,0x01,0x07,0x3f,0xff,0x83,0x06,0x80,0x00,0xa0,0x05,
+0x03,0x40,0x01,0x06,0x80,0x00,0x3d,0x07,0x00,0x00,0xbd,0x06,0x80,0x00,0xa0,0x05,
+0x83,0x40,0x01,0x06,0x80,0x00,0x3d,0x07,0x00,0x01,0x3d,0x06,0x80,0x00,0xa0,0x06,
+0x03,0x40,0x01,0x06,0x80,0x40,0x01,0x07,0x00,0x01,0xbd,0x06,0x80,0x40,0xb2,0x06,
+0xc0,0x01,0x99,0x06,0x80,0x80,0x01,0x07,0x00,0x02,0x3d,0x06,0x80,0x40,0xb2,0x06,
+0xc0,0x01,0x99,0x06,0x80,0xc0,0x01,0x07,0x00,0x00,0x05,0x06,0x80,0x40,0xb2,0x06,
+0xc0,0x01,0x99,0x06,0x81,0x00,0x01,0x07,0x00,0x00,0x05,0x06,0x80,0x40,0xb2,0x06,
+0xc0,0x01,0x99,0x06,0x81,0x40,0x01,0x07,0x00,0x00,0x05,0x06,0x80,0x40,0xb2,0x06,
+0xc0,0x01,0x99,0x06,0x81,0x80,0x01,0x07,0x00,0x00,0x05,0x06,0x80,0x40,0xb2,0x06,
+0xc0,0x01,0x99,0x06,0x81,0xc0,0x01,0x07,0x00,0x00,0x05,0x06,0x80,0x40,0xb2,0x06,
+0xc0,0x01,0x99,0x06,0x82,0x00,0x01,0x07,0x00,0x02,0xbd,0x06,0x80,0x40,0xb2,0x06,
+0xc0,0x01,0x99,0x06,0x82,0x40,0x01,0x07,0x00,0x00,0xbd,0x06,0x80,0x40,0xb2,0x06,
+0xc0,0x01,0x99,0x06,0x82,0x80,0x01,0x07,0x00,0x03,0x3d,0x06,0x80,0x40,0xb2,0x06,
+0xc0,0x01,0x99,0x06,0x82,0xc0,0x01,0x07,0x00,0x00,0xbd,0x06,0x80,0x40,0xb2,0x06,
+0xc0,0x01,0x99,0x06,0x83,0x00,0x01,0x07,0x00,0x00,0x05,0x06,0x80,0x40,0xb2,0x06,
+0x80,0x00,0x29,0x00,0x00,0x00,0x07,0x10,0x00,0x03,0x61,0x62,0x63,0x10,0x00,0x02,
+0x62,0x63,0x10,0x00,0x02,0x58,0x58,0x10,0x00,0x01,0x61,0x10,0x00,0x01,0x63,0x10,
+0x00,0x00,0x10,0x00,0x01,0x62,0x00,0x00,0x00,0x02,0x00,0x05,0x73,0x6c,0x69,0x63,
+0x65,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0xeb,0x00,0x01,0x00,0x07,0x00,
+0x00,0x00,0x25,0x00,0x80,0x00,0x3d,0x00,0x80,0x00,0x20,0x01,0x00,0x00,0xbd,0x01,
+0x80,0x00,0xbd,0x02,0x00,0x00,0xbd,0x01,0x00,0x81,0xb7,0x00,0x80,0x40,0xb2,0x00,
+0xc0,0x05,0x19,0x00,0x80,0x01,0x3d,0x01,0x00,0x01,0xbd,0x00,0x80,0x00,0xa0,0x01,
+0x00,0x02,0x3d,0x01,0x80,0x02,0xbd,0x02,0x00,0x03,0x3d,0x02,0x80,0x03,0xbd,0x03,
+0x00,0x04,0x3d,0x01,0x00,0x82,0xb7,0x00,0x80,0x40,0xb2,0x00,0xc0,0x04,0x19,0x00,
+0x80,0x00,0x3d,0x01,0x00,0x00,0x05,0x00,0x80,0x00,0xa0,0x01,0x00,0x00,0xbd,0x01,
+0x80,0x00,0xbd,0x02,0x00,0x00,0xbd,0x01,0x00,0x81,0xb7,0x00,0x80,0x40,0xb2,0x00,
+0xc0,0x04,0x19,0x00,0x80,0x00,0xbd,0x01,0x00,0x03,0xbd,0x00,0x80,0x00,0xa0,0x01,
+0x00,0x02,0x3d,0x01,0x80,0x02,0xbd,0x02,0x00,0x03,0x3d,0x01,0x00,0x81,0xb7,0x00,
+0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x09,0x10,0x00,0x0b,0x61,0x62,
+0x63,0x20,0x61,0x62,0x63,0x20,0x61,0x62,0x63,0x10,0x00,0x03,0x61,0x62,0x63,0x10,
+0x00,0x08,0x61,0x2c,0x62,0x2c,0x63,0x2c,0x2c,0x64,0x10,0x00,0x01,0x2c,0x10,0x00,
+0x01,0x61,0x10,0x00,0x01,0x62,0x10,0x00,0x01,0x63,0x10,0x00,0x00,0x10,0x00,0x01,
+0x64,0x00,0x00,0x00,0x02,0x00,0x05,0x73,0x70,0x6c,0x69,0x74,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x00,0x00,0xa1,0x00,0x01,0x00,0x04,0x00,0x00,0x00,0x15,0x00,0x80,
+0x00,0x3d,0x01,0x00,0x00,0xbd,0x01,0x80,0x01,0x3d,0x00,0x80,0x01,0x20,0x01,0x00,
+0x01,0xbd,0x00,0x80,0x40,0xb2,0x00,0xc0,0x03,0x19,0x00,0x80,0x00,0x3d,0x01,0x00,
+0x00,0xbd,0x01,0x80,0x03,0x40,0x00,0x80,0x00,0xa1,0x01,0x00,0x01,0xbd,0x00,0x80,
+0x40,0xb2,0x00,0xc0,0x03,0x19,0x00,0x80,0x02,0x3d,0x01,0x00,0x02,0xbd,0x01,0x80,
+0x03,0x3d,0x00,0x80,0x01,0x20,0x01,0x00,0x03,0xbd,0x00,0x80,0x40,0xb2,0x00,0x80,
+0x00,0x29,0x00,0x00,0x00,0x08,0x10,0x00,0x06,0x61,0x62,0x63,0x61,0x62,0x63,0x10,
+0x00,0x01,0x62,0x10,0x00,0x01,0x42,0x10,0x00,0x06,0x61,0x42,0x63,0x61,0x62,0x63,
+0x10,0x00,0x03,0x61,0x61,0x23,0x10,0x00,0x01,0x23,0x10,0x00,0x01,0x24,0x10,0x00,
+0x03,0x61,0x61,0x24,0x00,0x00,0x00,0x02,0x00,0x03,0x73,0x75,0x62,0x00,0x00,0x02,
+0x3d,0x3d,0x00,0x00,0x00,0x00,0x31,0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x04,0x02,
+0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x01,0x80,0x00,0x20,0x01,0x80,0x00,0x29,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x0a,0x63,0x61,0x70,0x69,0x74,0x61,0x6c,
+0x69,0x7a,0x65,0x00,0x00,0x00,0x00,0x82,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x12,
+0x00,0x80,0x00,0x3d,0x01,0x80,0x40,0x01,0x02,0x00,0x00,0xbd,0x02,0x80,0x01,0x3d,
+0x01,0x80,0x01,0x20,0x01,0x00,0x00,0x3d,0x01,0x80,0x80,0x01,0x02,0x00,0x00,0xbd,
+0x02,0x80,0x03,0x40,0x01,0x80,0x00,0xa1,0x01,0x80,0x40,0x01,0x02,0x00,0x01,0xbd,
+0x01,0x80,0x40,0xb2,0x01,0xc0,0x01,0x99,0x01,0x80,0x80,0x01,0x02,0x00,0x01,0xbd,
+0x01,0x80,0x40,0xb2,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x04,0x10,0x00,0x06,0x61,
+0x62,0x63,0x61,0x62,0x63,0x10,0x00,0x01,0x62,0x10,0x00,0x01,0x42,0x10,0x00,0x06,
+0x61,0x42,0x63,0x61,0x62,0x63,0x00,0x00,0x00,0x02,0x00,0x04,0x73,0x75,0x62,0x21,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x31,0x00,0x03,0x00,0x04,0x00,0x00,
+0x00,0x04,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x01,0x01,0x80,0x00,0x20,0x01,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x0a,0x63,0x61,0x70,0x69,
+0x74,0x61,0x6c,0x69,0x7a,0x65,0x00,0x00,0x00,0x00,0xbd,0x00,0x05,0x00,0x07,0x00,
+0x00,0x00,0x1e,0x02,0x80,0x00,0x3d,0x02,0x80,0x00,0x20,0x00,0x81,0x40,0x01,0x02,
+0x80,0x00,0xbd,0x02,0x80,0x00,0x20,0x01,0x01,0x40,0x01,0x02,0x80,0x01,0x3d,0x03,
+0x40,0x07,0x83,0x02,0x80,0x00,0xa0,0x01,0x81,0x40,0x01,0x02,0x80,0x01,0xbd,0x03,
+0x40,0x00,0x83,0x02,0x80,0x00,0xa0,0x02,0x01,0x40,0x01,0x02,0x80,0x40,0x01,0x03,
+0x3f,0xff,0x83,0x02,0x80,0x40,0xb2,0x02,0xc0,0x01,0x99,0x02,0x80,0x80,0x01,0x03,
+0x00,0x02,0x02,0x02,0x80,0x40,0xb2,0x02,0xc0,0x01,0x99,0x02,0x80,0xc0,0x01,0x03,
+0x40,0x04,0x83,0x02,0x80,0x40,0xb2,0x02,0xc0,0x01,0x99,0x02,0x81,0x00,0x01,0x03,
+0x40,0x01,0x83,0x02,0x80,0x40,0xb2,0x02,0x80,0x00,0x29,0x00,0x00,0x00,0x05,0x10,
+0x00,0x00,0x10,0x00,0x09,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x39,0x10,0x00,
+0x01,0x61,0x10,0x00,0x03,0x31,0x30,0x30,0x03,0x00,0x09,0x31,0x32,0x33,0x34,0x35,
+0x36,0x37,0x38,0x39,0x00,0x00,0x00,0x02,0x00,0x04,0x74,0x6f,0x5f,0x69,0x00,0x00,
+0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0xf0,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x18,
+0x02,0x00,0x00,0x3d,0x02,0x00,0x00,0x20,0x00,0x81,0x00,0x01,0x02,0x00,0x00,0xbd,
+0x02,0x00,0x00,0x20,0x01,0x01,0x00,0x01,0x02,0x00,0x01,0x3d,0x02,0x00,0x00,0x20,
+0x01,0x81,0x00,0x01,0x02,0x00,0x00,0x06,0x02,0x80,0x40,0x01,0x03,0x00,0x01,0x82,
+0x02,0x00,0x41,0x20,0x02,0x40,0x02,0x19,0x02,0x00,0x00,0x06,0x02,0x80,0x80,0x01,
+0x03,0x00,0x02,0x02,0x02,0x00,0x41,0x20,0x02,0x40,0x02,0x19,0x02,0x00,0x00,0x06,
+0x02,0x80,0xc0,0x01,0x03,0x00,0x02,0x82,0x02,0x00,0x41,0x20,0x02,0x00,0x00,0x29,
+0x00,0x00,0x00,0x06,0x10,0x00,0x00,0x10,0x00,0x09,0x31,0x32,0x33,0x34,0x35,0x36,
+0x37,0x38,0x39,0x10,0x00,0x0a,0x31,0x32,0x33,0x34,0x35,0x2e,0x36,0x37,0x38,0x39,
+0x06,0x00,0x16,0x30,0x2e,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x06,0x00,0x16,0x31,0x2e,0x32,0x33,
+0x34,0x35,0x36,0x37,0x38,0x39,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x65,0x2b,
+0x30,0x38,0x06,0x00,0x16,0x31,0x2e,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x39,0x30,
+0x30,0x30,0x30,0x30,0x30,0x30,0x31,0x65,0x2b,0x30,0x34,0x00,0x00,0x00,0x02,0x00,
+0x04,0x74,0x6f,0x5f,0x66,0x00,0x00,0x0b,0x63,0x68,0x65,0x63,0x6b,0x5f,0x66,0x6c,
+0x6f,0x61,0x74,0x00,0x00,0x00,0x00,0x3a,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,
+0x00,0x80,0x00,0x3d,0x00,0x80,0x00,0x20,0x01,0x00,0x00,0x3d,0x00,0x80,0x40,0xb2,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x10,0x00,0x03,0x61,0x62,0x63,0x00,0x00,
+0x00,0x02,0x00,0x04,0x74,0x6f,0x5f,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,
+0x00,0x42,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x3d,0x00,0x80,
+0x00,0x20,0x01,0x00,0x01,0x04,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x01,0x10,0x00,0x03,0x61,0x62,0x63,0x00,0x00,0x00,0x03,0x00,0x06,0x74,0x6f,
+0x5f,0x73,0x79,0x6d,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x03,0x61,0x62,0x63,0x00,
+0x00,0x00,0x00,0x66,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x0e,0x01,0x80,0x00,0x3d,
+0x01,0x80,0x00,0x20,0x00,0x80,0xc0,0x01,0x01,0x00,0x00,0x3d,0x01,0x80,0x80,0x01,
+0x01,0x80,0x00,0x20,0x01,0x80,0x40,0x01,0x02,0x00,0x00,0xbd,0x01,0x80,0x40,0xb2,
+0x01,0xc0,0x01,0x99,0x01,0x80,0x80,0x01,0x02,0x00,0x00,0x3d,0x01,0x80,0x40,0xb2,
+0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x02,0x10,0x00,0x03,0x61,0x62,0x63,0x10,0x00,
+0x03,0x41,0x42,0x43,0x00,0x00,0x00,0x02,0x00,0x06,0x75,0x70,0x63,0x61,0x73,0x65,
+0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x4b,0x00,0x02,0x00,0x04,0x00,0x00,
+0x00,0x07,0x00,0x80,0x00,0x3d,0x01,0x00,0x40,0x01,0x01,0x00,0x00,0x20,0x01,0x00,
+0x40,0x01,0x01,0x80,0x00,0xbd,0x01,0x00,0x40,0xb2,0x01,0x00,0x00,0x29,0x00,0x00,
+0x00,0x02,0x10,0x00,0x03,0x61,0x62,0x63,0x10,0x00,0x03,0x41,0x42,0x43,0x00,0x00,
+0x00,0x02,0x00,0x07,0x75,0x70,0x63,0x61,0x73,0x65,0x21,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x00,0x00,0x7c,0x00,0x02,0x00,0x04,0x00,0x00,0x00,0x0c,0x01,0x00,0x00,
+0x3d,0x01,0xc0,0x0f,0x83,0x01,0x00,0x00,0xb0,0x00,0x80,0x80,0x01,0x01,0x00,0x00,
+0xbd,0x01,0x80,0x40,0x01,0x01,0x00,0xc0,0x3e,0x01,0x80,0x01,0x3d,0x01,0x00,0xc0,
+0x3e,0x01,0x80,0x01,0xbd,0x01,0x00,0x40,0xb2,0x01,0x00,0x00,0x29,0x00,0x00,0x00,
+0x04,0x10,0x00,0x01,0x41,0x10,0x00,0x00,0x10,0x00,0x01,0x3a,0x10,0x00,0x21,0x41,
+0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,
+0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x3a,
+0x00,0x00,0x00,0x02,0x00,0x01,0x2a,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,
+0x26,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x3d,0x00,0x00,0x00,
+0x29,0x00,0x00,0x00,0x01,0x10,0x00,0x07,0x71,0x71,0x71,0x00,0x70,0x70,0x70,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x7d,0x00,0x05,0x00,0x0a,0x00,0x00,0x00,0x14,0x00,
+0x80,0x00,0x3d,0x02,0xc0,0x33,0x83,0x03,0x40,0x32,0x03,0x03,0xc0,0x35,0x83,0x04,
+0x40,0x35,0x83,0x04,0xc0,0x37,0x03,0x01,0x01,0x42,0xb7,0x01,0x80,0x00,0xbd,0x02,
+0xc0,0x7f,0x03,0x02,0x01,0x40,0xb7,0x02,0x80,0x40,0x01,0x02,0x80,0x00,0x20,0x03,
+0x00,0x80,0x01,0x02,0x80,0x40,0xb2,0x02,0xc0,0x02,0x19,0x02,0x80,0xc0,0x01,0x02,
+0x80,0x00,0x20,0x03,0x01,0x00,0x01,0x02,0x80,0x40,0xb2,0x02,0x80,0x00,0x29,0x00,
+0x00,0x00,0x02,0x10,0x00,0x05,0x68,0x65,0x6c,0x6c,0x6f,0x10,0x00,0x01,0xff,0x00,
+0x00,0x00,0x02,0x00,0x05,0x62,0x79,0x74,0x65,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,
+0x00,0x00,0x00,0x69,0x00,0x04,0x00,0x09,0x00,0x00,0x00,0x0f,0x00,0x80,0x00,0x3d,
+0x02,0x40,0x33,0x83,0x02,0xc0,0x32,0x03,0x03,0x40,0x35,0x83,0x03,0xc0,0x35,0x83,
+0x04,0x40,0x37,0x03,0x01,0x01,0x02,0xb7,0x01,0x81,0x00,0x37,0x02,0x00,0x40,0x01,
+0x02,0x80,0x03,0x40,0x02,0x00,0x00,0x21,0x02,0x00,0x80,0x01,0x02,0x80,0xc0,0x01,
+0x02,0x00,0x40,0xb2,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x01,0x10,0x00,0x05,0x68,
+0x65,0x6c,0x6c,0x6f,0x00,0x00,0x00,0x02,0x00,0x09,0x65,0x61,0x63,0x68,0x5f,0x62,
+0x79,0x74,0x65,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x2d,0x00,0x03,0x00,
+0x05,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0xc0,0x15,0x02,0x00,0x40,
+0x01,0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x01,0x00,0x02,0x3c,0x3c,0x00,0x00,0x00,0x00,0x46,0x00,0x01,0x00,0x03,0x00,0x00,
+0x00,0x05,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,
+0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x06,
+0x53,0x79,0x6d,0x62,0x6f,0x6c,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,
+0x02,0x3d,0x3d,0x00,0x00,0x05,0x43,0x6c,0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x4c,
+0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,
+0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x04,0x00,0x06,0x53,0x79,0x6d,0x62,0x6f,0x6c,0x00,0x00,0x0a,0x73,
+0x75,0x70,0x65,0x72,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,
+0x06,0x4f,0x62,0x6a,0x65,0x63,0x74,0x00,0x00,0x00,0x00,0x4e,0x00,0x01,0x00,0x03,
+0x00,0x00,0x00,0x09,0x00,0x80,0x00,0x04,0x01,0x00,0x00,0x04,0x00,0x80,0x40,0xa0,
+0x00,0xc0,0x02,0x19,0x00,0x80,0x00,0x04,0x01,0x00,0x01,0x04,0x00,0x80,0x40,0xa0,
+0x00,0x80,0xc0,0x20,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,
+0x00,0x03,0x61,0x62,0x63,0x00,0x00,0x03,0x3d,0x3d,0x3d,0x00,0x00,0x03,0x63,0x62,
+0x61,0x00,0x00,0x01,0x21,0x00,0x00,0x00,0x00,0x43,0x00,0x01,0x00,0x03,0x00,0x00,
+0x00,0x05,0x00,0x80,0x00,0x04,0x00,0x80,0x40,0x20,0x01,0x00,0x00,0x3d,0x00,0x80,
+0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x10,0x00,0x03,0x61,0x62,0x63,
+0x00,0x00,0x00,0x03,0x00,0x03,0x61,0x62,0x63,0x00,0x00,0x07,0x69,0x64,0x32,0x6e,
+0x61,0x6d,0x65,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x40,0x00,0x01,0x00,
+0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x04,0x00,0x80,0x40,0x20,0x01,0x00,0x00,
+0x3d,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x10,0x00,0x03,
+0x61,0x62,0x63,0x00,0x00,0x00,0x03,0x00,0x03,0x61,0x62,0x63,0x00,0x00,0x04,0x74,
+0x6f,0x5f,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x3c,0x00,0x01,0x00,
+0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x04,0x00,0x80,0x40,0x20,0x01,0x00,0x00,
+0x04,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x03,0x00,0x03,0x61,0x62,0x63,0x00,0x00,0x06,0x74,0x6f,0x5f,0x73,0x79,0x6d,0x00,
+0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x01,0x0b,0x00,0x03,0x00,0x07,0x00,0x00,0x00,
+0x2d,0x00,0x80,0x00,0x08,0x00,0x40,0x01,0x9a,0x02,0x00,0x01,0xa5,0x01,0x80,0x3f,
+0xa4,0x00,0x40,0x04,0x97,0x01,0x80,0x00,0x1b,0x02,0x00,0x00,0x11,0x02,0x80,0xc0,
+0x01,0x02,0x00,0x40,0xa0,0x02,0x40,0x00,0x98,0x00,0x40,0x01,0x17,0x00,0x80,0x00,
+0x07,0x00,0x40,0x01,0x17,0x01,0x80,0x00,0x1d,0x00,0x80,0x00,0x1c,0x01,0x80,0x00,
+0x05,0x02,0x00,0x00,0x05,0x01,0x80,0x80,0x43,0x01,0x80,0x00,0xc5,0x01,0x80,0x00,
+0x05,0x02,0x00,0x01,0x11,0x01,0x80,0xc0,0x43,0x01,0x80,0x02,0x45,0x01,0x80,0x01,
+0x91,0x01,0x81,0x00,0x20,0x01,0x00,0xc0,0x01,0x01,0x80,0x40,0x01,0x01,0xc0,0x01,
+0x99,0x01,0x80,0x80,0x01,0x01,0x81,0x40,0x20,0x00,0x80,0xc0,0x01,0x01,0x80,0x40,
+0x01,0x01,0xc0,0x05,0x99,0x01,0x80,0x80,0x01,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,
+0x83,0x03,0x40,0x01,0x03,0x01,0x81,0x81,0xa0,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,
+0x83,0x03,0x40,0x01,0x03,0x02,0x01,0x01,0xb7,0x01,0x81,0xc0,0xb2,0x00,0x80,0xc0,
+0x01,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x0d,0x4e,
+0x6f,0x4d,0x65,0x74,0x68,0x6f,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x03,0x3d,
+0x3d,0x3d,0x00,0x00,0x08,0x53,0x75,0x70,0x65,0x72,0x46,0x6f,0x6f,0x00,0x00,0x08,
+0x53,0x75,0x70,0x65,0x72,0x42,0x61,0x72,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,
+0x03,0x66,0x6f,0x6f,0x00,0x00,0x03,0x62,0x61,0x72,0x00,0x00,0x02,0x3d,0x3d,0x00,
+0x00,0x00,0x00,0x40,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x08,0x00,0x80,0x00,0x48,
+0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x04,0xc0,
+0x00,0x80,0x40,0x46,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x02,0x00,0x03,0x66,0x6f,0x6f,0x00,0x00,0x03,0x62,0x61,0x72,0x00,
+0x00,0x00,0x00,0x20,0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x26,
+0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x1c,0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x02,0x00,0x08,0x00,0x26,
+0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,
+0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x08,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,
+0x00,0x80,0x00,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x04,0xc0,0x00,0x80,0x40,0x46,
+0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
+0x00,0x03,0x66,0x6f,0x6f,0x00,0x00,0x03,0x62,0x61,0x72,0x00,0x00,0x00,0x00,0x24,
+0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x04,0x00,0x00,0x00,0x26,0x01,0x80,0x00,0x25,
+0x01,0x00,0x3f,0xa4,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x30,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x07,0x00,0x08,0x00,0x26,
+0x02,0x01,0x00,0x37,0x02,0x80,0x40,0x01,0x02,0x01,0x40,0x38,0x02,0x80,0x00,0x05,
+0x01,0x80,0x3f,0xa4,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x72,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x10,0x00,0x40,0x01,0x9a,
+0x00,0x80,0x01,0xab,0x00,0x80,0x00,0x20,0x00,0x40,0x04,0x97,0x00,0x80,0x00,0x1b,
+0x01,0x00,0x00,0x91,0x01,0x80,0x40,0x01,0x01,0x00,0x80,0xa0,0x01,0x40,0x00,0x98,
+0x00,0x40,0x01,0x17,0x00,0x80,0x00,0x07,0x00,0x40,0x01,0x97,0x00,0x80,0x00,0x1d,
+0x00,0x80,0x00,0x1c,0x00,0x80,0x00,0x08,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x03,0x00,0x04,0x63,0x61,0x6c,0x6c,0x00,0x00,0x0e,0x4c,0x6f,0x63,
+0x61,0x6c,0x4a,0x75,0x6d,0x70,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x03,0x3d,0x3d,
+0x3d,0x00,0x00,0x00,0x00,0x75,0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x16,0x02,0x00,
+0x40,0x01,0x02,0x40,0x00,0x98,0x00,0xc0,0x00,0x03,0x02,0x00,0x80,0x01,0x02,0x40,
+0x00,0x99,0x01,0x40,0x00,0x03,0x01,0xc0,0x00,0x03,0x02,0x00,0xc0,0x01,0x02,0x00,
+0x01,0x2d,0x01,0x81,0x00,0x01,0x02,0x00,0x40,0x01,0x02,0xc0,0x00,0x03,0x02,0x00,
+0x40,0xb2,0x02,0x40,0x01,0x99,0x02,0x00,0x80,0x01,0x02,0x80,0x00,0x05,0x02,0x00,
+0x40,0xb2,0x02,0x40,0x01,0x99,0x02,0x00,0xc0,0x01,0x02,0xc0,0x01,0x03,0x02,0x00,
+0x40,0xb2,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,
+0x2b,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x93,0x00,0x01,0x00,0x03,0x00,
+0x00,0x00,0x0f,0x00,0x80,0x00,0x05,0x00,0x80,0x00,0x44,0x00,0x80,0x00,0xc5,0x00,
+0x80,0x00,0x11,0x00,0x80,0x00,0x93,0x01,0x00,0x00,0x3d,0x00,0x80,0x80,0xb2,0x00,
+0xc0,0x03,0x19,0x00,0x80,0x00,0x11,0x00,0x80,0x01,0x93,0x00,0x81,0x00,0x20,0x00,
+0x81,0x40,0x20,0x01,0x00,0x00,0x3d,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,
+0x00,0x00,0x01,0x10,0x00,0x0b,0x68,0x65,0x6c,0x6c,0x6f,0x20,0x77,0x6f,0x72,0x6c,
+0x64,0x00,0x00,0x00,0x06,0x00,0x0c,0x53,0x79,0x6e,0x74,0x61,0x78,0x34,0x43,0x6f,
+0x6e,0x73,0x74,0x00,0x00,0x06,0x43,0x4f,0x4e,0x53,0x54,0x31,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x06,0x43,0x6f,0x6e,0x73,0x74,0x32,0x00,0x00,0x03,0x6e,0x65,0x77,
+0x00,0x00,0x06,0x63,0x6f,0x6e,0x73,0x74,0x31,0x00,0x00,0x00,0x00,0x50,0x00,0x01,
+0x00,0x03,0x00,0x00,0x00,0x07,0x00,0x80,0x00,0x3d,0x00,0x80,0x00,0x12,0x00,0x80,
+0x00,0x05,0x01,0x00,0x00,0x05,0x00,0x80,0x40,0x43,0x00,0x80,0x00,0xc5,0x01,0x00,
+0x00,0x29,0x00,0x00,0x00,0x01,0x10,0x00,0x0b,0x68,0x65,0x6c,0x6c,0x6f,0x20,0x77,
+0x6f,0x72,0x6c,0x64,0x00,0x00,0x00,0x02,0x00,0x06,0x43,0x4f,0x4e,0x53,0x54,0x31,
+0x00,0x00,0x06,0x43,0x6f,0x6e,0x73,0x74,0x32,0x00,0x00,0x00,0x00,0x31,0x00,0x01,
+0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,
+0x00,0x46,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x01,0x00,0x06,0x63,0x6f,0x6e,0x73,0x74,0x31,0x00,0x00,0x00,0x00,0x29,0x00,
+0x02,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x11,0x00,
+0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x06,0x43,0x4f,0x4e,
+0x53,0x54,0x31,0x00,0x00,0x00,0x00,0x6d,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x0a,
+0x00,0x80,0x00,0x05,0x00,0x80,0x00,0x44,0x00,0x80,0x00,0xc5,0x00,0x80,0x00,0x11,
+0x00,0x80,0x00,0x93,0x00,0x80,0x80,0x20,0x00,0x80,0xc0,0x20,0x01,0x40,0x00,0x03,
+0x00,0x81,0x00,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,
+0x00,0x1b,0x53,0x79,0x6e,0x74,0x61,0x78,0x34,0x41,0x62,0x62,0x72,0x56,0x61,0x72,
+0x41,0x73,0x67,0x6e,0x41,0x73,0x52,0x65,0x74,0x75,0x72,0x6e,0x73,0x00,0x00,0x01,
+0x41,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x01,0x62,0x00,0x00,0x02,0x3d,0x3d,
+0x00,0x00,0x00,0x00,0x2c,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,
+0x05,0x01,0x00,0x00,0x05,0x00,0x80,0x00,0x43,0x00,0x80,0x00,0xc5,0x01,0x00,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x41,0x00,0x00,0x00,0x00,
+0x2c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x48,0x01,0x00,0x02,
+0xc0,0x00,0x80,0x00,0x46,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x62,0x00,0x00,0x00,0x00,0x31,0x00,0x02,0x00,
+0x03,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x26,0x01,0x00,0x00,0x0d,0x01,0x40,0x01,
+0x18,0x01,0x40,0x00,0x03,0x01,0x00,0x00,0x0e,0x01,0x00,0x00,0x29,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x01,0x00,0x02,0x40,0x63,0x00,0x00,0x00,0x00,0x49,0x00,0x01,
+0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,
+0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x04,0x00,0x09,0x54,0x72,0x75,0x65,0x43,0x6c,0x61,0x73,0x73,0x00,0x00,0x05,
+0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x05,0x43,0x6c,0x61,
+0x73,0x73,0x00,0x00,0x00,0x00,0x4f,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,
+0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,
+0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x09,0x54,0x72,0x75,
+0x65,0x43,0x6c,0x61,0x73,0x73,0x00,0x00,0x0a,0x73,0x75,0x70,0x65,0x72,0x63,0x6c,
+0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x06,0x4f,0x62,0x6a,0x65,0x63,
+0x74,0x00,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,
+0x00,0x07,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x40,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x09,0x00,0x80,0x00,0x07,0x01,0x00,
+0x00,0x07,0x00,0x80,0x00,0xa0,0x00,0xc0,0x02,0x19,0x00,0x80,0x00,0x07,0x01,0x00,
+0x00,0x08,0x00,0x80,0x00,0xa0,0x00,0x80,0x40,0x20,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x26,0x00,0x00,0x01,0x21,0x00,0x00,0x00,
+0x00,0x40,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x09,0x00,0x80,0x00,0x07,0x01,0x00,
+0x00,0x07,0x00,0x80,0x00,0xa0,0x00,0x80,0x40,0x20,0x00,0xc0,0x01,0x99,0x00,0x80,
+0x00,0x07,0x01,0x00,0x00,0x08,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x5e,0x00,0x00,0x01,0x21,0x00,0x00,0x00,
+0x00,0x3b,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x07,0x00,0x80,
+0x00,0x20,0x01,0x00,0x00,0x3d,0x00,0x80,0x40,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,
+0x00,0x01,0x10,0x00,0x04,0x74,0x72,0x75,0x65,0x00,0x00,0x00,0x02,0x00,0x04,0x74,
+0x6f,0x5f,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,0x00,0x00,0x00,0x38,0x00,0x01,0x00,
+0x03,0x00,0x00,0x00,0x08,0x00,0x80,0x00,0x07,0x01,0x00,0x00,0x07,0x00,0x80,0x00,
+0xa0,0x00,0xc0,0x01,0x99,0x00,0x80,0x00,0x07,0x01,0x00,0x00,0x08,0x00,0x80,0x00,
+0xa0,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x7c,
+0x00,0x00,0x00,0x00,0x49,0x00,0x01,0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,
+0x11,0x00,0x80,0x40,0x20,0x01,0x00,0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,
+0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x09,0x54,0x79,0x70,0x65,0x45,
+0x72,0x72,0x6f,0x72,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,
+0x3d,0x00,0x00,0x05,0x43,0x6c,0x61,0x73,0x73,0x00,0x00,0x00,0x00,0x56,0x00,0x01,
+0x00,0x03,0x00,0x00,0x00,0x05,0x00,0x80,0x00,0x11,0x00,0x80,0x40,0x20,0x01,0x00,
+0x01,0x91,0x00,0x80,0x80,0xb2,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x04,0x00,0x09,0x54,0x79,0x70,0x65,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x0a,
+0x73,0x75,0x70,0x65,0x72,0x63,0x6c,0x61,0x73,0x73,0x00,0x00,0x02,0x3d,0x3d,0x00,
+0x00,0x0d,0x53,0x74,0x61,0x6e,0x64,0x61,0x72,0x64,0x45,0x72,0x72,0x6f,0x72,0x00,
+0x45,0x4e,0x44,0x00,0x00,0x00,0x00,0x08,
+};
+void GENERATED_TMP_mrb_mruby_sprintf_gem_test(mrb_state *mrb);
+void GENERATED_TMP_mrb_mruby_print_gem_test(mrb_state *mrb);
+void GENERATED_TMP_mrb_mruby_math_gem_test(mrb_state *mrb);
+void GENERATED_TMP_mrb_mruby_time_gem_test(mrb_state *mrb);
+void GENERATED_TMP_mrb_mruby_struct_gem_test(mrb_state *mrb);
+void GENERATED_TMP_mrb_mruby_enum_ext_gem_test(mrb_state *mrb);
+void GENERATED_TMP_mrb_mruby_string_ext_gem_test(mrb_state *mrb);
+void GENERATED_TMP_mrb_mruby_numeric_ext_gem_test(mrb_state *mrb);
+void GENERATED_TMP_mrb_mruby_array_ext_gem_test(mrb_state *mrb);
+void GENERATED_TMP_mrb_mruby_hash_ext_gem_test(mrb_state *mrb);
+void GENERATED_TMP_mrb_mruby_range_ext_gem_test(mrb_state *mrb);
+void GENERATED_TMP_mrb_mruby_proc_ext_gem_test(mrb_state *mrb);
+void GENERATED_TMP_mrb_mruby_random_gem_test(mrb_state *mrb);
+void GENERATED_TMP_mrb_mruby_numeric_array_gem_test(mrb_state *mrb);
+void GENERATED_TMP_mrb_mruby_bin_mirb_gem_test(mrb_state *mrb);
+void GENERATED_TMP_mrb_mruby_bin_mruby_gem_test(mrb_state *mrb);
+void GENERATED_TMP_mrb_mruby_bin_hpcmrb_gem_test(mrb_state *mrb);
+void mrbgemtest_init(mrb_state* mrb) {
+    GENERATED_TMP_mrb_mruby_sprintf_gem_test(mrb);
+    GENERATED_TMP_mrb_mruby_print_gem_test(mrb);
+    GENERATED_TMP_mrb_mruby_math_gem_test(mrb);
+    GENERATED_TMP_mrb_mruby_time_gem_test(mrb);
+    GENERATED_TMP_mrb_mruby_struct_gem_test(mrb);
+    GENERATED_TMP_mrb_mruby_enum_ext_gem_test(mrb);
+    GENERATED_TMP_mrb_mruby_string_ext_gem_test(mrb);
+    GENERATED_TMP_mrb_mruby_numeric_ext_gem_test(mrb);
+    GENERATED_TMP_mrb_mruby_array_ext_gem_test(mrb);
+    GENERATED_TMP_mrb_mruby_hash_ext_gem_test(mrb);
+    GENERATED_TMP_mrb_mruby_range_ext_gem_test(mrb);
+    GENERATED_TMP_mrb_mruby_proc_ext_gem_test(mrb);
+    GENERATED_TMP_mrb_mruby_random_gem_test(mrb);
+    GENERATED_TMP_mrb_mruby_numeric_array_gem_test(mrb);
+    GENERATED_TMP_mrb_mruby_bin_mirb_gem_test(mrb);
+    GENERATED_TMP_mrb_mruby_bin_mruby_gem_test(mrb);
+    GENERATED_TMP_mrb_mruby_bin_hpcmrb_gem_test(mrb);
+}
@@ -0,0 +1,2459 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+#define T_Scene 1001
+typedef struct {
+	int type;
+	mrb_value plane;
+	mrb_value spheres;
+} cScene;
+
+#define T_Isect 1002
+typedef struct {
+	int type;
+	mrb_value n;
+	mrb_value pl;
+	mrb_value hit;
+	mrb_value t;
+} cIsect;
+
+#define T_Ray 1003
+typedef struct {
+	int type;
+	mrb_value dir;
+	mrb_value org;
+} cRay;
+
+#define T_Plane 1004
+typedef struct {
+	int type;
+	mrb_value n;
+	mrb_value p;
+} cPlane;
+
+#define T_Sphere 1005
+typedef struct {
+	int type;
+	double radius;
+	mrb_value center;
+} cSphere;
+
+#define T_Vec 1006
+typedef struct {
+	int type;
+	mrb_value z;
+	mrb_value y;
+	mrb_value x;
+} cVec;
+
+#define T_Rand 1007
+typedef struct {
+	int type;
+} cRand;
+mrb_int T_Rand__w;
+mrb_int T_Rand__z;
+mrb_int T_Rand__y;
+mrb_int T_Rand__x;
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	case T_Scene:
+		mrb_gc_mark_value(mrb, ((cScene *)p)->plane);
+		mrb_gc_mark_value(mrb, ((cScene *)p)->spheres);
+		break;
+	case T_Isect:
+		mrb_gc_mark_value(mrb, ((cIsect *)p)->n);
+		mrb_gc_mark_value(mrb, ((cIsect *)p)->pl);
+		mrb_gc_mark_value(mrb, ((cIsect *)p)->t);
+		break;
+	case T_Ray:
+		mrb_gc_mark_value(mrb, ((cRay *)p)->dir);
+		mrb_gc_mark_value(mrb, ((cRay *)p)->org);
+		break;
+	case T_Plane:
+		mrb_gc_mark_value(mrb, ((cPlane *)p)->n);
+		mrb_gc_mark_value(mrb, ((cPlane *)p)->p);
+		break;
+	case T_Sphere:
+		mrb_gc_mark_value(mrb, ((cSphere *)p)->center);
+		break;
+	case T_Vec:
+		mrb_gc_mark_value(mrb, ((cVec *)p)->z);
+		mrb_gc_mark_value(mrb, ((cVec *)p)->y);
+		mrb_gc_mark_value(mrb, ((cVec *)p)->x);
+		break;
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+mrb_value
+clamp_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+otherBasis_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);
+mrb_value
+rand_0(int val, mrb_value __self__);
+mrb_value
+x_set_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+y_set_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+z_set_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+x_0(int val, mrb_value __self__);
+mrb_value
+y_0(int val, mrb_value __self__);
+mrb_value
+z_0(int val, mrb_value __self__);
+mrb_value
+vadd_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+vsub_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+vcross_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+vdot_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+vlength_0(int val, mrb_value __self__);
+mrb_value
+vnormalize_0(int val, mrb_value __self__);
+mrb_value
+center_0(int val, mrb_value __self__);
+mrb_value
+radius_0(int val, mrb_value __self__);
+mrb_value
+intersect_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);
+mrb_value
+org_0(int val, mrb_value __self__);
+mrb_value
+org_set_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+dir_0(int val, mrb_value __self__);
+mrb_value
+dir_set_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+t_0(int val, mrb_value __self__);
+mrb_value
+t_set_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+hit_0(int val, mrb_value __self__);
+mrb_value
+hit_set_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+pl_0(int val, mrb_value __self__);
+mrb_value
+pl_set_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+n_0(int val, mrb_value __self__);
+mrb_value
+n_set_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+ambient_occlusion_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+render_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);
+
+static mrb_value
+Scene_render(mrb_value __self__, mrb_value w, mrb_value h, mrb_value nsubsamples);
+static mrb_value
+Scene_ambient_occlusion(mrb_value __self__, mrb_value isect);
+static mrb_value
+Scene_initialize(mrb_value __self__);
+static mrb_int
+Scene_render__c24(mrb_value __self__, mrb_int w, mrb_int h, mrb_int nsubsamples);
+static mrb_value
+Scene_initialize__c21(mrb_value __self__);
+static mrb_value
+Scene_new__c21(mrb_value __self__);
+static mrb_value
+Scene_ambient_occlusion__c20(mrb_value __self__, mrb_value isect);
+static mrb_value
+Isect_n_set(mrb_value __self__, mrb_value v);
+static mrb_value
+Isect_n(mrb_value __self__);
+static mrb_value
+Isect_pl_set(mrb_value __self__, mrb_value v);
+static mrb_value
+Isect_pl(mrb_value __self__);
+static mrb_value
+Isect_hit_set(mrb_value __self__, mrb_value v);
+static mrb_value
+Isect_hit(mrb_value __self__);
+static mrb_value
+Isect_t_set(mrb_value __self__, mrb_value v);
+static mrb_value
+Isect_t(mrb_value __self__);
+static mrb_value
+Isect_initialize(mrb_value __self__);
+static mrb_value
+Isect_pl__c18(mrb_value __self__);
+static mrb_value
+Isect_n__c16(mrb_value __self__);
+static mrb_value
+Isect_hit__c15(mrb_value __self__);
+static mrb_value
+Isect_initialize__c14(mrb_value __self__);
+static mrb_value
+Isect_new__c14(mrb_value __self__);
+static mrb_value
+Ray_dir_set(mrb_value __self__, mrb_value v);
+static mrb_value
+Ray_dir(mrb_value __self__);
+static mrb_value
+Ray_org_set(mrb_value __self__, mrb_value v);
+static mrb_value
+Ray_org(mrb_value __self__);
+static mrb_value
+Ray_initialize(mrb_value __self__, mrb_value org, mrb_value dir);
+static mrb_value
+Ray_initialize__c19(mrb_value __self__, mrb_value org, mrb_value dir);
+static mrb_value
+Ray_new__c19(mrb_value __self__, mrb_value org, mrb_value dir);
+static mrb_value
+Plane_intersect(mrb_value __self__, mrb_value ray, mrb_value isect);
+static mrb_value
+Plane_initialize(mrb_value __self__, mrb_value p, mrb_value n);
+static mrb_value
+Plane_initialize__c12(mrb_value __self__, mrb_value p, mrb_value n);
+static mrb_value
+Plane_new__c12(mrb_value __self__, mrb_value p, mrb_value n);
+static mrb_value
+Sphere_intersect(mrb_value __self__, mrb_value ray, mrb_value isect);
+static mrb_value
+Sphere_radius(mrb_value __self__);
+static mrb_value
+Sphere_center(mrb_value __self__);
+static mrb_value
+Sphere_initialize(mrb_value __self__, mrb_value center, mrb_value radius);
+static double
+Sphere_initialize__c11(mrb_value __self__, mrb_value center, double radius);
+static mrb_value
+Sphere_new__c11(mrb_value __self__, mrb_value center, double radius);
+static mrb_value
+Vec_vnormalize(mrb_value __self__);
+static mrb_value
+Vec_vlength(mrb_value __self__);
+static mrb_value
+Vec_vdot(mrb_value __self__, mrb_value b);
+static mrb_value
+Vec_vcross(mrb_value __self__, mrb_value b);
+static mrb_value
+Vec_vsub(mrb_value __self__, mrb_value b);
+static mrb_value
+Vec_vadd(mrb_value __self__, mrb_value b);
+static mrb_value
+Vec_z(mrb_value __self__);
+static mrb_value
+Vec_y(mrb_value __self__);
+static mrb_value
+Vec_x(mrb_value __self__);
+static mrb_value
+Vec_z_set(mrb_value __self__, mrb_value v);
+static mrb_value
+Vec_y_set(mrb_value __self__, mrb_value v);
+static mrb_value
+Vec_x_set(mrb_value __self__, mrb_value v);
+static mrb_value
+Vec_initialize(mrb_value __self__, mrb_value x, mrb_value y, mrb_value z);
+static mrb_value
+Vec_vnormalize__c22(mrb_value __self__);
+static mrb_value
+Vec_initialize__c10(mrb_value __self__, double x, double y, double z);
+static mrb_value
+Vec_new__c10(mrb_value __self__, double x, double y, double z);
+static mrb_value
+Vec_vdot__c9(mrb_value __self__, mrb_value b);
+static mrb_value
+Vec_z_set__c8(mrb_value __self__, mrb_value v);
+static mrb_value
+Vec_y_set__c7(mrb_value __self__, mrb_value v);
+static mrb_value
+Vec_x_set__c6(mrb_value __self__, mrb_value v);
+static double
+Vec_vlength__c5(mrb_value __self__);
+static mrb_value
+Vec_initialize__c4(mrb_value __self__, mrb_value x, mrb_value y, mrb_value z);
+static mrb_value
+Vec_new__c4(mrb_value __self__, mrb_value x, mrb_value y, mrb_value z);
+static mrb_value
+Vec_z__c3(mrb_value __self__);
+static mrb_value
+Vec_y__c2(mrb_value __self__);
+static mrb_value
+Vec_x__c1(mrb_value __self__);
+static mrb_value
+Rand_rand(mrb_value __self__);
+static double
+Rand_rand__c13(mrb_value __self__);
+static mrb_value
+otherBasis(mrb_value __self__, mrb_value basis, mrb_value n);
+static mrb_value
+clamp(mrb_value __self__, mrb_value f);
+static mrb_value
+clamp__c23(mrb_value __self__, mrb_value f);
+static mrb_value
+otherBasis__c17(mrb_value __self__, mrb_value basis, mrb_value n);
+mrb_value Math;
+mrb_sym __i_plane;
+mrb_sym __i_spheres;
+mrb_sym __i_n;
+mrb_sym __i_pl;
+mrb_sym __i_hit;
+mrb_sym __i_t;
+mrb_sym __i_dir;
+mrb_sym __i_org;
+mrb_sym __i_n;
+mrb_sym __i_p;
+mrb_sym __i_radius;
+mrb_sym __i_center;
+mrb_sym __i_z;
+mrb_sym __i_y;
+mrb_sym __i_x;
+mrb_sym __i_w;
+mrb_sym __i_z;
+mrb_sym __i_y;
+mrb_sym __i_x;
+
+void
+init_global_syms(mrb_state * mrb)
+{
+	__i_plane = mrb_intern(mrb, "plane");
+	__i_spheres = mrb_intern(mrb, "spheres");
+	__i_n = mrb_intern(mrb, "n");
+	__i_pl = mrb_intern(mrb, "pl");
+	__i_hit = mrb_intern(mrb, "hit");
+	__i_t = mrb_intern(mrb, "t");
+	__i_dir = mrb_intern(mrb, "dir");
+	__i_org = mrb_intern(mrb, "org");
+	__i_n = mrb_intern(mrb, "n");
+	__i_p = mrb_intern(mrb, "p");
+	__i_radius = mrb_intern(mrb, "radius");
+	__i_center = mrb_intern(mrb, "center");
+	__i_z = mrb_intern(mrb, "z");
+	__i_y = mrb_intern(mrb, "y");
+	__i_x = mrb_intern(mrb, "x");
+	__i_w = mrb_intern(mrb, "w");
+	__i_z = mrb_intern(mrb, "z");
+	__i_y = mrb_intern(mrb, "y");
+	__i_x = mrb_intern(mrb, "x");
+	Math = mrb_const_get(mrb, mrb_obj_value(mrb->object_class), mrb_intern(mrb, "Math"));
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void Scene_init(mrb_value __self__);
+void Isect_init(mrb_value __self__);
+void Ray_init(mrb_value __self__);
+void Plane_init(mrb_value __self__);
+void Sphere_init(mrb_value __self__);
+void Vec_init(mrb_value __self__);
+void Rand_init(mrb_value __self__);
+static const mrb_int IMAGE_WIDTH = 256;
+static const mrb_int IMAGE_HEIGHT = 256;
+static const mrb_int NSUBSAMPLES = 2;
+static const mrb_int NAO_SAMPLES = 8;
+static const mrb_int BNUM = 536870912;
+static const double BNUMF = 536870912;
+mrb_value Rand;
+mrb_value Vec;
+mrb_value Sphere;
+mrb_value Plane;
+mrb_value Ray;
+mrb_value Isect;
+mrb_value Scene;
+void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { &Rand, &Vec, &Sphere, &Plane, &Ray, &Isect, &Scene };
+	static mrb_shadow_frame __global_frame;
+	__global_frame.prev = mrb->shadow_frames;
+	__global_frame.len = sizeof(__global_roots) / sizeof(__global_roots[0]);
+	__global_frame.roots = __global_roots;
+	mrb->shadow_frames = &__global_frame;
+	Rand = mrb_obj_value(mrb_define_class(mrb, "Rand", mrb->object_class));
+	Rand_init(Rand);
+	Vec = mrb_obj_value(mrb_define_class(mrb, "Vec", mrb->object_class));
+	Vec_init(Vec);
+	Sphere = mrb_obj_value(mrb_define_class(mrb, "Sphere", mrb->object_class));
+	Sphere_init(Sphere);
+	Plane = mrb_obj_value(mrb_define_class(mrb, "Plane", mrb->object_class));
+	Plane_init(Plane);
+	Ray = mrb_obj_value(mrb_define_class(mrb, "Ray", mrb->object_class));
+	Ray_init(Ray);
+	Isect = mrb_obj_value(mrb_define_class(mrb, "Isect", mrb->object_class));
+	Isect_init(Isect);
+	Scene = mrb_obj_value(mrb_define_class(mrb, "Scene", mrb->object_class));
+	Scene_init(Scene);
+	(hpc_output_write("P6\n", 3), mrb_nil_value());
+	(hpc_output_int(256), hpc_output_write(" ", 1), hpc_output_int(256), hpc_output_write("\n", 1), mrb_nil_value());
+	(hpc_output_write("255\n", 4), mrb_nil_value());
+	Scene_render__c24(Scene_new__c21(Scene), 256, 256, 2);
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+	if (c == (struct RClass *)mrb_obj_ptr(Isect)) {
+		cIsect *sval;
+		Data_Make_Struct(mrb, c, cIsect, &hpc_data_type, sval, data);
+		sval->type = T_Isect;
+		obj = mrb_obj_value(data);
+		Isect_initialize(obj);
+} else 	if (c == (struct RClass *)mrb_obj_ptr(Scene)) {
+		cScene *sval;
+		Data_Make_Struct(mrb, c, cScene, &hpc_data_type, sval, data);
+		sval->type = T_Scene;
+		obj = mrb_obj_value(data);
+		Scene_initialize(obj);
+} else {
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+	if (c == (struct RClass *)mrb_obj_ptr(Sphere)) {
+		cSphere *sval;
+		Data_Make_Struct(mrb, c, cSphere, &hpc_data_type, sval, data);
+		sval->type = T_Sphere;
+		obj = mrb_obj_value(data);
+		Sphere_initialize(obj, arg0, arg1);
+} else 	if (c == (struct RClass *)mrb_obj_ptr(Plane)) {
+		cPlane *sval;
+		Data_Make_Struct(mrb, c, cPlane, &hpc_data_type, sval, data);
+		sval->type = T_Plane;
+		obj = mrb_obj_value(data);
+		Plane_initialize(obj, arg0, arg1);
+} else 	if (c == (struct RClass *)mrb_obj_ptr(Ray)) {
+		cRay *sval;
+		Data_Make_Struct(mrb, c, cRay, &hpc_data_type, sval, data);
+		sval->type = T_Ray;
+		obj = mrb_obj_value(data);
+		Ray_initialize(obj, arg0, arg1);
+} else {
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+	if (c == (struct RClass *)mrb_obj_ptr(Vec)) {
+		cVec *sval;
+		Data_Make_Struct(mrb, c, cVec, &hpc_data_type, sval, data);
+		sval->type = T_Vec;
+		obj = mrb_obj_value(data);
+		Vec_initialize(obj, arg0, arg1, arg2);
+} else {
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+void
+Scene_init(mrb_value __self__)
+{
+}
+
+void
+Isect_init(mrb_value __self__)
+{
+}
+
+void
+Ray_init(mrb_value __self__)
+{
+}
+
+void
+Plane_init(mrb_value __self__)
+{
+}
+
+void
+Sphere_init(mrb_value __self__)
+{
+}
+
+void
+Vec_init(mrb_value __self__)
+{
+}
+
+void
+Rand_init(mrb_value __self__)
+{
+	T_Rand__x = 123456789;
+	T_Rand__y = 362436069;
+	T_Rand__z = 521288629;
+	T_Rand__w = 88675123;
+}
+
+static mrb_value
+Scene_render(mrb_value __self__, mrb_value w, mrb_value h, mrb_value nsubsamples)
+{
+	cScene *data;
+	*(void**)&data = DATA_PTR(__self__);
+	mrb_value cnt;
+	mrb_value nsf = mrb_nil_value();
+	mrb_value *__roots1[] = { &nsf };
+	HPC_FRAME_PUSH(__frame1, __roots1);
+
+	cnt = mrb_fixnum_value(0);
+	nsf = to_f_0(1, nsubsamples);
+	{
+		{
+			mrb_int __y = 0;
+			mrb_int __y_last = mrb_fixnum(h);
+			for (; __y < __y_last; ++__y) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int y = __y;
+				{
+					{
+						double __tmp_165 = ((mrb_float)y);
+
+						{
+							mrb_int __x = 0;
+							mrb_int __x_last = mrb_fixnum(w);
+							for (; __x < __x_last; ++__x) {
+								int ai = mrb_gc_arena_save(mrb);
+								mrb_int x = __x;
+								mrb_value rad__x = mrb_nil_value();
+								mrb_value rad__y = mrb_nil_value();
+								mrb_value rad__z = mrb_nil_value();
+								mrb_value r = mrb_nil_value();
+								mrb_value g = mrb_nil_value();
+								mrb_value b = mrb_nil_value();
+								mrb_value *__roots2[] = { &rad__x, &rad__y, &rad__z, &r, &g, &b };
+								HPC_FRAME_PUSH(__frame2, __roots2);
+
+								rad__x = mrb_float_value(0.0);
+								rad__y = mrb_float_value(0.0);
+								rad__z = mrb_float_value(0.0);
+								{
+									{
+										double __tmp_163 = ((mrb_float)x);
+
+										{
+											mrb_int __v = 0;
+											mrb_int __v_last = mrb_fixnum(nsubsamples);
+											for (; __v < __v_last; ++__v) {
+												int ai = mrb_gc_arena_save(mrb);
+												mrb_int v = __v;
+												{
+													{
+														double __tmp_160 = ((mrb_float)v);
+
+														{
+															mrb_int __u = 0;
+															mrb_int __u_last = mrb_fixnum(nsubsamples);
+															for (; __u < __u_last; ++__u) {
+																int ai = mrb_gc_arena_save(mrb);
+																mrb_int u = __u;
+																mrb_value wf = mrb_nil_value();
+																mrb_value hf = mrb_nil_value();
+																double xf;
+																double yf;
+																double uf;
+																double vf;
+																mrb_value px = mrb_nil_value();
+																mrb_value py = mrb_nil_value();
+																mrb_value eye = mrb_nil_value();
+																mrb_value ray = mrb_nil_value();
+																mrb_value isect = mrb_nil_value();
+																mrb_value col = mrb_nil_value();
+																mrb_value *__roots3[] = { &wf, &hf, &px, &py, &eye, &ray, &isect, &col };
+																HPC_FRAME_PUSH(__frame3, __roots3);
+
+																cnt = num_add_1(1, cnt, mrb_fixnum_value(1));
+																wf = to_f_0(1, w);
+																hf = to_f_0(1, h);
+																xf = __tmp_163;
+																yf = __tmp_165;
+																uf = ((mrb_float)u);
+																vf = __tmp_160;
+																px = num_div_1(1, num_sub_1(1, num_add_1(1, mrb_float_value(xf), num_div_1(1, mrb_float_value(uf), nsf)), num_div_1(1, wf, mrb_float_value(2.0))), num_div_1(1, wf, mrb_float_value(2.0)));
+																py = num_div_1(1, num_uminus_0(1, num_sub_1(1, num_add_1(1, mrb_float_value(yf), num_div_1(1, mrb_float_value(vf), nsf)), num_div_1(1, hf, mrb_float_value(2.0)))), num_div_1(1, hf, mrb_float_value(2.0)));
+																eye = vnormalize_0(1, mrb_funcall(mrb, Vec, "new", 3, px, py, mrb_float_value((-1.0))));
+																ray = mrb_funcall(mrb, Ray, "new", 2, Vec_new__c10(Vec, 0.0, 0.0, 0.0), eye);
+																isect = Isect_new__c14(Isect);
+																intersect_2(0, hpc_ary_vref(data->spheres, 0), ray, isect);
+																intersect_2(0, hpc_ary_vref(data->spheres, 1), ray, isect);
+																intersect_2(0, hpc_ary_vref(data->spheres, 2), ray, isect);
+																intersect_2(0, data->plane, ray, isect);
+																if ( mrb_bool(((cIsect *)DATA_PTR(isect))->hit) )
+																{
+																	col = Scene_ambient_occlusion__c20(__self__, isect);
+																	rad__x = num_add_1(1, rad__x, ((cVec *)DATA_PTR(col))->x);
+																	rad__y = num_add_1(1, rad__y, ((cVec *)DATA_PTR(col))->y);
+																	rad__z = num_add_1(1, rad__z, ((cVec *)DATA_PTR(col))->z);
+																}
+																HPC_FRAME_POP(__frame3);
+																mrb_gc_arena_restore(mrb, ai);
+															}
+														}
+													}
+												}
+												mrb_gc_arena_restore(mrb, ai);
+											}
+										}
+									}
+								}
+								r = num_div_1(1, rad__x, num_mul_1(1, nsf, nsf));
+								g = num_div_1(1, rad__y, num_mul_1(1, nsf, nsf));
+								b = num_div_1(1, rad__z, num_mul_1(1, nsf, nsf));
+								print_1(0, __self__, chr_0(1, clamp_1(1, __self__, r)));
+								print_1(0, __self__, chr_0(1, clamp_1(1, __self__, g)));
+								print_1(0, __self__, chr_0(1, clamp_1(1, __self__, b)));
+								HPC_FRAME_POP(__frame2);
+								mrb_gc_arena_restore(mrb, ai);
+							}
+						}
+					}
+				}
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+		{
+			mrb_value __ret = h;
+			HPC_FRAME_POP(__frame1);
+			return __ret;
+		}
+	}
+	HPC_FRAME_POP(__frame1);
+}
+
+static mrb_value
+Scene_ambient_occlusion(mrb_value __self__, mrb_value isect)
+{
+	cScene *data;
+	*(void**)&data = DATA_PTR(__self__);
+	mrb_value basis = mrb_nil_value();
+	mrb_int ntheta;
+	mrb_int nphi;
+	double eps;
+	double occlusion;
+	mrb_value p0 = mrb_nil_value();
+	mrb_value *__roots4[] = { &basis, &p0 };
+	HPC_FRAME_PUSH(__frame4, __roots4);
+
+	basis = mrb_funcall(mrb, mrb_obj_value(mrb->array_class), "new", 1, mrb_fixnum_value(3));
+	otherBasis_2(0, __self__, basis, n_0(1, isect));
+	ntheta = 8;
+	nphi = 8;
+	eps = 0.0001;
+	occlusion = 0.0;
+	p0 = mrb_funcall(mrb, Vec, "new", 3, num_add_1(1, x_0(1, pl_0(1, isect)), num_mul_1(1, mrb_float_value(0.0001), x_0(1, n_0(1, isect)))), num_add_1(1, y_0(1, pl_0(1, isect)), num_mul_1(1, mrb_float_value(0.0001), y_0(1, n_0(1, isect)))), num_add_1(1, z_0(1, pl_0(1, isect)), num_mul_1(1, mrb_float_value(0.0001), z_0(1, n_0(1, isect)))));
+	{
+		mrb_int __tmp_131 = 8;
+
+		{
+			mrb_int __j = 0;
+			mrb_int __j_last = 8;
+			for (; __j < __j_last; ++__j) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int j = __j;
+				{
+					mrb_int __tmp_136 = 8;
+
+					{
+						mrb_int __i = 0;
+						mrb_int __i_last = 8;
+						for (; __i < __i_last; ++__i) {
+							int ai = mrb_gc_arena_save(mrb);
+							mrb_int i = __i;
+							double r;
+							double phi;
+							double x;
+							double y;
+							double z;
+							mrb_value rx = mrb_nil_value();
+							mrb_value ry = mrb_nil_value();
+							mrb_value rz = mrb_nil_value();
+							mrb_value raydir = mrb_nil_value();
+							mrb_value ray = mrb_nil_value();
+							mrb_value occisect = mrb_nil_value();
+							mrb_value *__roots5[] = { &rx, &ry, &rz, &raydir, &ray, &occisect };
+							HPC_FRAME_PUSH(__frame5, __roots5);
+
+							r = Rand_rand__c13(Rand);
+							phi = (6.2831853000000004 * Rand_rand__c13(Rand));
+							x = (cos(phi) * sqrt((1.0 - r)));
+							y = (sin(phi) * sqrt((1.0 - r)));
+							z = sqrt(r);
+							rx = num_add_1(1, num_add_1(1, num_mul_1(1, mrb_float_value(x), x_0(1, hpc_ary_vref(basis, 0))), num_mul_1(1, mrb_float_value(y), x_0(1, hpc_ary_vref(basis, 1)))), num_mul_1(1, mrb_float_value(z), x_0(1, hpc_ary_vref(basis, 2))));
+							ry = num_add_1(1, num_add_1(1, num_mul_1(1, mrb_float_value(x), y_0(1, hpc_ary_vref(basis, 0))), num_mul_1(1, mrb_float_value(y), y_0(1, hpc_ary_vref(basis, 1)))), num_mul_1(1, mrb_float_value(z), y_0(1, hpc_ary_vref(basis, 2))));
+							rz = num_add_1(1, num_add_1(1, num_mul_1(1, mrb_float_value(x), z_0(1, hpc_ary_vref(basis, 0))), num_mul_1(1, mrb_float_value(y), z_0(1, hpc_ary_vref(basis, 1)))), num_mul_1(1, mrb_float_value(z), z_0(1, hpc_ary_vref(basis, 2))));
+							raydir = Vec_new__c4(Vec, rx, ry, rz);
+							ray = mrb_funcall(mrb, Ray, "new", 2, p0, raydir);
+							occisect = Isect_new__c14(Isect);
+							intersect_2(0, hpc_ary_vref(data->spheres, 0), ray, occisect);
+							intersect_2(0, hpc_ary_vref(data->spheres, 1), ray, occisect);
+							intersect_2(0, hpc_ary_vref(data->spheres, 2), ray, occisect);
+							intersect_2(0, data->plane, ray, occisect);
+							if ( mrb_bool(((cIsect *)DATA_PTR(occisect))->hit) )
+							{
+								occlusion = (occlusion + 1.0);
+							}
+							HPC_FRAME_POP(__frame5);
+							mrb_gc_arena_restore(mrb, ai);
+						}
+					}
+				}
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	occlusion = ((64.0 - occlusion) / 64.0);
+	{
+		mrb_value __ret = Vec_new__c10(Vec, occlusion, occlusion, occlusion);
+		HPC_FRAME_POP(__frame4);
+		return __ret;
+	}
+}
+
+static mrb_value
+Scene_initialize(mrb_value __self__)
+{
+	cScene *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->spheres = mrb_funcall(mrb, mrb_obj_value(mrb->array_class), "new", 0);
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->spheres);
+	hpc_ary_aset_2(0, data->spheres, mrb_fixnum_value(0), Sphere_new__c11(Sphere, Vec_new__c10(Vec, (-2.0), 0.0, (-3.5)), 0.5));
+	hpc_ary_aset_2(0, data->spheres, mrb_fixnum_value(1), Sphere_new__c11(Sphere, Vec_new__c10(Vec, (-0.5), 0.0, (-3.0)), 0.5));
+	hpc_ary_aset_2(0, data->spheres, mrb_fixnum_value(2), Sphere_new__c11(Sphere, Vec_new__c10(Vec, 1.0, 0.0, (-2.2)), 0.5));
+	data->plane = Plane_new__c12(Plane, Vec_new__c10(Vec, 0.0, (-0.5), 0.0), Vec_new__c10(Vec, 0.0, 1.0, 0.0));
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->plane);
+	return data->plane;
+}
+
+static mrb_int
+Scene_render__c24(mrb_value __self__, mrb_int w, mrb_int h, mrb_int nsubsamples)
+{
+	cScene *data;
+	*(void**)&data = DATA_PTR(__self__);
+	mrb_value cnt;
+	double nsf;
+
+	cnt = mrb_fixnum_value(0);
+	nsf = ((mrb_float)nsubsamples);
+	{
+		{
+			double __tmp_181 = (nsf * nsf);
+			double __tmp_182 = ((mrb_float)w);
+			double __tmp_183 = ((mrb_float)h);
+
+			{
+				mrb_int __y = 0;
+				mrb_int __y_last = h;
+				for (; __y < __y_last; ++__y) {
+					int ai = mrb_gc_arena_save(mrb);
+					mrb_int y = __y;
+					{
+						{
+							double __tmp_178 = ((mrb_float)y);
+
+							{
+								mrb_int __x = 0;
+								mrb_int __x_last = w;
+								for (; __x < __x_last; ++__x) {
+									int ai = mrb_gc_arena_save(mrb);
+									mrb_int x = __x;
+									mrb_value rad__x = mrb_nil_value();
+									mrb_value rad__y = mrb_nil_value();
+									mrb_value rad__z = mrb_nil_value();
+									mrb_value r = mrb_nil_value();
+									mrb_value g = mrb_nil_value();
+									mrb_value b = mrb_nil_value();
+									mrb_value *__roots6[] = { &rad__x, &rad__y, &rad__z, &r, &g, &b };
+									HPC_FRAME_PUSH(__frame6, __roots6);
+
+									rad__x = mrb_float_value(0.0);
+									rad__y = mrb_float_value(0.0);
+									rad__z = mrb_float_value(0.0);
+									{
+										{
+											double __tmp_175 = ((mrb_float)x);
+
+											{
+												mrb_int __v = 0;
+												mrb_int __v_last = nsubsamples;
+												for (; __v < __v_last; ++__v) {
+													int ai = mrb_gc_arena_save(mrb);
+													mrb_int v = __v;
+													{
+														{
+															double __tmp_168 = ((mrb_float)v);
+
+															{
+																mrb_int __u = 0;
+																mrb_int __u_last = nsubsamples;
+																for (; __u < __u_last; ++__u) {
+																	int ai = mrb_gc_arena_save(mrb);
+																	mrb_int u = __u;
+																	double wf;
+																	double hf;
+																	double xf;
+																	double yf;
+																	double uf;
+																	double vf;
+																	double px;
+																	double py;
+																	mrb_value eye = mrb_nil_value();
+																	mrb_value ray = mrb_nil_value();
+																	mrb_value isect = mrb_nil_value();
+																	mrb_value col = mrb_nil_value();
+																	mrb_value *__roots7[] = { &eye, &ray, &isect, &col };
+																	HPC_FRAME_PUSH(__frame7, __roots7);
+
+																	cnt = num_add_1(1, cnt, mrb_fixnum_value(1));
+																	wf = __tmp_182;
+																	hf = __tmp_183;
+																	xf = __tmp_175;
+																	yf = __tmp_178;
+																	uf = ((mrb_float)u);
+																	vf = __tmp_168;
+																	{
+																		double __tmp_166 = (wf / 2.0);
+
+																		px = (((xf + (uf / nsf)) - __tmp_166) / __tmp_166);
+																	}
+																	{
+																		double __tmp_167 = (hf / 2.0);
+
+																		py = ((-((yf + (vf / nsf)) - __tmp_167)) / __tmp_167);
+																	}
+																	eye = Vec_vnormalize__c22(Vec_new__c10(Vec, px, py, (-1.0)));
+																	ray = Ray_new__c19(Ray, Vec_new__c10(Vec, 0.0, 0.0, 0.0), eye);
+																	isect = Isect_new__c14(Isect);
+																	intersect_2(0, hpc_ary_vref(data->spheres, 0), ray, isect);
+																	intersect_2(0, hpc_ary_vref(data->spheres, 1), ray, isect);
+																	intersect_2(0, hpc_ary_vref(data->spheres, 2), ray, isect);
+																	intersect_2(0, data->plane, ray, isect);
+																	if ( mrb_bool(((cIsect *)DATA_PTR(isect))->hit) )
+																	{
+																		col = Scene_ambient_occlusion__c20(__self__, isect);
+																		rad__x = num_add_1(1, rad__x, ((cVec *)DATA_PTR(col))->x);
+																		rad__y = num_add_1(1, rad__y, ((cVec *)DATA_PTR(col))->y);
+																		rad__z = num_add_1(1, rad__z, ((cVec *)DATA_PTR(col))->z);
+																	}
+																	HPC_FRAME_POP(__frame7);
+																	mrb_gc_arena_restore(mrb, ai);
+																}
+															}
+														}
+													}
+													mrb_gc_arena_restore(mrb, ai);
+												}
+											}
+										}
+									}
+									r = num_div_1(1, rad__x, mrb_float_value(__tmp_181));
+									g = num_div_1(1, rad__y, mrb_float_value(__tmp_181));
+									b = num_div_1(1, rad__z, mrb_float_value(__tmp_181));
+									print_1(0, __self__, chr_0(1, clamp__c23(__self__, r)));
+									print_1(0, __self__, chr_0(1, clamp__c23(__self__, g)));
+									print_1(0, __self__, chr_0(1, clamp__c23(__self__, b)));
+									HPC_FRAME_POP(__frame6);
+									mrb_gc_arena_restore(mrb, ai);
+								}
+							}
+						}
+					}
+					mrb_gc_arena_restore(mrb, ai);
+				}
+			}
+		}
+		return h;
+	}
+}
+
+static mrb_value
+Scene_initialize__c21(mrb_value __self__)
+{
+	cScene *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->spheres = mrb_funcall(mrb, mrb_obj_value(mrb->array_class), "new", 0);
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->spheres);
+	hpc_ary_aset_2(0, data->spheres, mrb_fixnum_value(0), Sphere_new__c11(Sphere, Vec_new__c10(Vec, (-2.0), 0.0, (-3.5)), 0.5));
+	hpc_ary_aset_2(0, data->spheres, mrb_fixnum_value(1), Sphere_new__c11(Sphere, Vec_new__c10(Vec, (-0.5), 0.0, (-3.0)), 0.5));
+	hpc_ary_aset_2(0, data->spheres, mrb_fixnum_value(2), Sphere_new__c11(Sphere, Vec_new__c10(Vec, 1.0, 0.0, (-2.2)), 0.5));
+	data->plane = Plane_new__c12(Plane, Vec_new__c10(Vec, 0.0, (-0.5), 0.0), Vec_new__c10(Vec, 0.0, 1.0, 0.0));
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->plane);
+	return data->plane;
+}
+
+static mrb_value
+Scene_new__c21(mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	cScene *sval;
+	Data_Make_Struct(mrb, mrb_class_ptr(__self__), cScene, &hpc_data_type, sval, data);
+	sval->type = T_Scene;
+	obj = mrb_obj_value(data);
+	Scene_initialize__c21(obj);
+	return obj;
+}
+
+static mrb_value
+Scene_ambient_occlusion__c20(mrb_value __self__, mrb_value isect)
+{
+	cScene *data;
+	*(void**)&data = DATA_PTR(__self__);
+	mrb_value basis = mrb_nil_value();
+	mrb_int ntheta;
+	mrb_int nphi;
+	double eps;
+	double occlusion;
+	mrb_value p0 = mrb_nil_value();
+	mrb_value *__roots8[] = { &basis, &p0 };
+	HPC_FRAME_PUSH(__frame8, __roots8);
+
+	basis = mrb_funcall(mrb, mrb_obj_value(mrb->array_class), "new", 1, mrb_fixnum_value(3));
+	otherBasis__c17(__self__, basis, ((cIsect *)DATA_PTR(isect))->n);
+	ntheta = 8;
+	nphi = 8;
+	eps = 0.0001;
+	occlusion = 0.0;
+	p0 = Vec_new__c4(Vec, num_add_1(1, ((cVec *)DATA_PTR(((cIsect *)DATA_PTR(isect))->pl))->x, num_mul_1(1, mrb_float_value(0.0001), x_0(1, ((cIsect *)DATA_PTR(isect))->n))), num_add_1(1, ((cVec *)DATA_PTR(((cIsect *)DATA_PTR(isect))->pl))->y, num_mul_1(1, mrb_float_value(0.0001), y_0(1, ((cIsect *)DATA_PTR(isect))->n))), num_add_1(1, ((cVec *)DATA_PTR(((cIsect *)DATA_PTR(isect))->pl))->z, num_mul_1(1, mrb_float_value(0.0001), z_0(1, ((cIsect *)DATA_PTR(isect))->n))));
+	{
+		mrb_int __tmp_141 = 8;
+
+		{
+			mrb_int __j = 0;
+			mrb_int __j_last = 8;
+			for (; __j < __j_last; ++__j) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int j = __j;
+				{
+					mrb_int __tmp_143 = 8;
+
+					{
+						mrb_int __i = 0;
+						mrb_int __i_last = 8;
+						for (; __i < __i_last; ++__i) {
+							int ai = mrb_gc_arena_save(mrb);
+							mrb_int i = __i;
+							double r;
+							double phi;
+							double x;
+							double y;
+							double z;
+							mrb_value rx = mrb_nil_value();
+							mrb_value ry = mrb_nil_value();
+							mrb_value rz = mrb_nil_value();
+							mrb_value raydir = mrb_nil_value();
+							mrb_value ray = mrb_nil_value();
+							mrb_value occisect = mrb_nil_value();
+							mrb_value *__roots9[] = { &rx, &ry, &rz, &raydir, &ray, &occisect };
+							HPC_FRAME_PUSH(__frame9, __roots9);
+
+							r = Rand_rand__c13(Rand);
+							phi = (6.2831853000000004 * Rand_rand__c13(Rand));
+							x = (cos(phi) * sqrt((1.0 - r)));
+							y = (sin(phi) * sqrt((1.0 - r)));
+							z = sqrt(r);
+							rx = num_add_1(1, num_add_1(1, num_mul_1(1, mrb_float_value(x), x_0(1, hpc_ary_vref(basis, 0))), num_mul_1(1, mrb_float_value(y), x_0(1, hpc_ary_vref(basis, 1)))), num_mul_1(1, mrb_float_value(z), x_0(1, hpc_ary_vref(basis, 2))));
+							ry = num_add_1(1, num_add_1(1, num_mul_1(1, mrb_float_value(x), y_0(1, hpc_ary_vref(basis, 0))), num_mul_1(1, mrb_float_value(y), y_0(1, hpc_ary_vref(basis, 1)))), num_mul_1(1, mrb_float_value(z), y_0(1, hpc_ary_vref(basis, 2))));
+							rz = num_add_1(1, num_add_1(1, num_mul_1(1, mrb_float_value(x), z_0(1, hpc_ary_vref(basis, 0))), num_mul_1(1, mrb_float_value(y), z_0(1, hpc_ary_vref(basis, 1)))), num_mul_1(1, mrb_float_value(z), z_0(1, hpc_ary_vref(basis, 2))));
+							raydir = Vec_new__c4(Vec, rx, ry, rz);
+							ray = Ray_new__c19(Ray, p0, raydir);
+							occisect = Isect_new__c14(Isect);
+							intersect_2(0, hpc_ary_vref(data->spheres, 0), ray, occisect);
+							intersect_2(0, hpc_ary_vref(data->spheres, 1), ray, occisect);
+							intersect_2(0, hpc_ary_vref(data->spheres, 2), ray, occisect);
+							intersect_2(0, data->plane, ray, occisect);
+							if ( mrb_bool(((cIsect *)DATA_PTR(occisect))->hit) )
+							{
+								occlusion = (occlusion + 1.0);
+							}
+							HPC_FRAME_POP(__frame9);
+							mrb_gc_arena_restore(mrb, ai);
+						}
+					}
+				}
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	occlusion = ((64.0 - occlusion) / 64.0);
+	{
+		mrb_value __ret = Vec_new__c10(Vec, occlusion, occlusion, occlusion);
+		HPC_FRAME_POP(__frame8);
+		return __ret;
+	}
+}
+
+static mrb_value
+Isect_n_set(mrb_value __self__, mrb_value v)
+{
+	cIsect *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->n = v;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->n);
+	return data->n;
+}
+
+static mrb_value
+Isect_n(mrb_value __self__)
+{
+	cIsect *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->n;
+}
+
+static mrb_value
+Isect_pl_set(mrb_value __self__, mrb_value v)
+{
+	cIsect *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->pl = v;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->pl);
+	return data->pl;
+}
+
+static mrb_value
+Isect_pl(mrb_value __self__)
+{
+	cIsect *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->pl;
+}
+
+static mrb_value
+Isect_hit_set(mrb_value __self__, mrb_value v)
+{
+	cIsect *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->hit = v;
+	return data->hit;
+}
+
+static mrb_value
+Isect_hit(mrb_value __self__)
+{
+	cIsect *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->hit;
+}
+
+static mrb_value
+Isect_t_set(mrb_value __self__, mrb_value v)
+{
+	cIsect *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->t = v;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->t);
+	return data->t;
+}
+
+static mrb_value
+Isect_t(mrb_value __self__)
+{
+	cIsect *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->t;
+}
+
+static mrb_value
+Isect_initialize(mrb_value __self__)
+{
+	cIsect *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->t = mrb_float_value(10000000.0);
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->t);
+	data->hit = mrb_false_value();
+	data->pl = Vec_new__c10(Vec, 0.0, 0.0, 0.0);
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->pl);
+	data->n = Vec_new__c10(Vec, 0.0, 0.0, 0.0);
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->n);
+	return data->n;
+}
+
+static mrb_value
+Isect_pl__c18(mrb_value __self__)
+{
+	cIsect *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->pl;
+}
+
+static mrb_value
+Isect_n__c16(mrb_value __self__)
+{
+	cIsect *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->n;
+}
+
+static mrb_value
+Isect_hit__c15(mrb_value __self__)
+{
+	cIsect *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->hit;
+}
+
+static mrb_value
+Isect_initialize__c14(mrb_value __self__)
+{
+	cIsect *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->t = mrb_float_value(10000000.0);
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->t);
+	data->hit = mrb_false_value();
+	data->pl = Vec_new__c10(Vec, 0.0, 0.0, 0.0);
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->pl);
+	data->n = Vec_new__c10(Vec, 0.0, 0.0, 0.0);
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->n);
+	return data->n;
+}
+
+static mrb_value
+Isect_new__c14(mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	cIsect *sval;
+	Data_Make_Struct(mrb, mrb_class_ptr(__self__), cIsect, &hpc_data_type, sval, data);
+	sval->type = T_Isect;
+	obj = mrb_obj_value(data);
+	Isect_initialize__c14(obj);
+	return obj;
+}
+
+static mrb_value
+Ray_dir_set(mrb_value __self__, mrb_value v)
+{
+	cRay *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->dir = v;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->dir);
+	return data->dir;
+}
+
+static mrb_value
+Ray_dir(mrb_value __self__)
+{
+	cRay *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->dir;
+}
+
+static mrb_value
+Ray_org_set(mrb_value __self__, mrb_value v)
+{
+	cRay *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->org = v;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->org);
+	return data->org;
+}
+
+static mrb_value
+Ray_org(mrb_value __self__)
+{
+	cRay *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->org;
+}
+
+static mrb_value
+Ray_initialize(mrb_value __self__, mrb_value org, mrb_value dir)
+{
+	cRay *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->org = org;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->org);
+	data->dir = dir;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->dir);
+	return data->dir;
+}
+
+static mrb_value
+Ray_initialize__c19(mrb_value __self__, mrb_value org, mrb_value dir)
+{
+	cRay *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->org = org;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->org);
+	data->dir = dir;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->dir);
+	return data->dir;
+}
+
+static mrb_value
+Ray_new__c19(mrb_value __self__, mrb_value org, mrb_value dir)
+{
+	mrb_value obj;
+	struct RData * data;
+	cRay *sval;
+	Data_Make_Struct(mrb, mrb_class_ptr(__self__), cRay, &hpc_data_type, sval, data);
+	sval->type = T_Ray;
+	obj = mrb_obj_value(data);
+	Ray_initialize__c19(obj, org, dir);
+	return obj;
+}
+
+static mrb_value
+Plane_intersect(mrb_value __self__, mrb_value ray, mrb_value isect)
+{
+	cPlane *data;
+	*(void**)&data = DATA_PTR(__self__);
+	mrb_value d = mrb_nil_value();
+	mrb_value v = mrb_nil_value();
+	mrb_value v0 = mrb_nil_value();
+	mrb_value t = mrb_nil_value();
+	mrb_value *__roots10[] = { &d, &v, &v0, &t };
+	HPC_FRAME_PUSH(__frame10, __roots10);
+
+	d = num_uminus_0(1, Vec_vdot__c9(data->p, data->n));
+	v = vdot_1(1, Ray_dir(ray), data->n);
+	v0 = v;
+	if ( mrb_bool(num_lt_1(1, v, mrb_float_value(0.0))) )
+	{
+		v0 = num_uminus_0(1, v);
+	}
+	if ( mrb_bool(num_lt_1(1, v0, mrb_float_value(1.0e-17))) )
+	{
+		{
+			HPC_FRAME_POP(__frame10);
+			return mrb_nil_value();
+		}
+	}
+	t = num_div_1(1, num_uminus_0(1, num_add_1(1, vdot_1(1, Ray_org(ray), data->n), d)), v);
+	if ( mrb_bool(( (mrb_bool(num_gt_1(1, t, mrb_float_value(0.0)))) ? num_lt_1(1, t, Isect_t(isect)) : num_gt_1(1, t, mrb_float_value(0.0)) )) )
+	{
+		Isect_hit_set(isect, mrb_true_value());
+		Isect_t_set(isect, t);
+		Isect_n_set(isect, data->n);
+		{
+			mrb_value __ret = Isect_pl_set(isect, Vec_new__c4(Vec, num_add_1(1, x_0(1, Ray_org(ray)), num_mul_1(1, t, x_0(1, Ray_dir(ray)))), num_add_1(1, y_0(1, Ray_org(ray)), num_mul_1(1, t, y_0(1, Ray_dir(ray)))), num_add_1(1, z_0(1, Ray_org(ray)), num_mul_1(1, t, z_0(1, Ray_dir(ray))))));
+			HPC_FRAME_POP(__frame10);
+			return __ret;
+		}
+	}
+	else	{
+		HPC_FRAME_POP(__frame10);
+		return mrb_nil_value();
+	}
+	HPC_FRAME_POP(__frame10);
+}
+
+static mrb_value
+Plane_initialize(mrb_value __self__, mrb_value p, mrb_value n)
+{
+	cPlane *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->p = p;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->p);
+	data->n = n;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->n);
+	return data->n;
+}
+
+static mrb_value
+Plane_initialize__c12(mrb_value __self__, mrb_value p, mrb_value n)
+{
+	cPlane *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->p = p;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->p);
+	data->n = n;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->n);
+	return data->n;
+}
+
+static mrb_value
+Plane_new__c12(mrb_value __self__, mrb_value p, mrb_value n)
+{
+	mrb_value obj;
+	struct RData * data;
+	cPlane *sval;
+	Data_Make_Struct(mrb, mrb_class_ptr(__self__), cPlane, &hpc_data_type, sval, data);
+	sval->type = T_Plane;
+	obj = mrb_obj_value(data);
+	Plane_initialize__c12(obj, p, n);
+	return obj;
+}
+
+static mrb_value
+Sphere_intersect(mrb_value __self__, mrb_value ray, mrb_value isect)
+{
+	cSphere *data;
+	*(void**)&data = DATA_PTR(__self__);
+	mrb_value rs = mrb_nil_value();
+	mrb_value b = mrb_nil_value();
+	mrb_value c = mrb_nil_value();
+	mrb_value d = mrb_nil_value();
+	mrb_value t = mrb_nil_value();
+	mrb_value n = mrb_nil_value();
+	mrb_value *__roots11[] = { &rs, &b, &c, &d, &t, &n };
+	HPC_FRAME_PUSH(__frame11, __roots11);
+
+	rs = vsub_1(1, Ray_org(ray), data->center);
+	b = vdot_1(1, rs, Ray_dir(ray));
+	c = num_sub_1(1, vdot_1(1, rs, rs), mrb_float_value((data->radius * data->radius)));
+	d = num_sub_1(1, num_mul_1(1, b, b), c);
+	if ( mrb_bool(num_gt_1(1, d, mrb_float_value(0.0))) )
+	{
+		t = num_sub_1(1, num_uminus_0(1, b), sqrt_1(1, Math, d));
+		if ( mrb_bool(( (mrb_bool(num_gt_1(1, t, mrb_float_value(0.0)))) ? num_lt_1(1, t, Isect_t(isect)) : num_gt_1(1, t, mrb_float_value(0.0)) )) )
+		{
+			Isect_t_set(isect, t);
+			Isect_hit_set(isect, mrb_true_value());
+			Isect_pl_set(isect, Vec_new__c4(Vec, num_add_1(1, x_0(1, Ray_org(ray)), num_mul_1(1, x_0(1, Ray_dir(ray)), t)), num_add_1(1, y_0(1, Ray_org(ray)), num_mul_1(1, y_0(1, Ray_dir(ray)), t)), num_add_1(1, z_0(1, Ray_org(ray)), num_mul_1(1, z_0(1, Ray_dir(ray)), t))));
+			n = vsub_1(1, Isect_pl(isect), data->center);
+			{
+				mrb_value __ret = Isect_n_set(isect, vnormalize_0(1, n));
+				HPC_FRAME_POP(__frame11);
+				return __ret;
+			}
+		}
+		else		{
+			HPC_FRAME_POP(__frame11);
+			return mrb_nil_value();
+		}
+	}
+	else	{
+		HPC_FRAME_POP(__frame11);
+		return mrb_nil_value();
+	}
+	HPC_FRAME_POP(__frame11);
+}
+
+static mrb_value
+Sphere_radius(mrb_value __self__)
+{
+	cSphere *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return mrb_float_value(data->radius);
+}
+
+static mrb_value
+Sphere_center(mrb_value __self__)
+{
+	cSphere *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->center;
+}
+
+static mrb_value
+Sphere_initialize(mrb_value __self__, mrb_value center, mrb_value radius)
+{
+	cSphere *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->center = center;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->center);
+	data->radius = hpc_to_float(radius);
+	return mrb_float_value(data->radius);
+}
+
+static double
+Sphere_initialize__c11(mrb_value __self__, mrb_value center, double radius)
+{
+	cSphere *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->center = center;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->center);
+	data->radius = radius;
+	return data->radius;
+}
+
+static mrb_value
+Sphere_new__c11(mrb_value __self__, mrb_value center, double radius)
+{
+	mrb_value obj;
+	struct RData * data;
+	cSphere *sval;
+	Data_Make_Struct(mrb, mrb_class_ptr(__self__), cSphere, &hpc_data_type, sval, data);
+	sval->type = T_Sphere;
+	obj = mrb_obj_value(data);
+	Sphere_initialize__c11(obj, center, radius);
+	return obj;
+}
+
+static mrb_value
+Vec_vnormalize(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	double len;
+	mrb_value v = mrb_nil_value();
+	mrb_value *__roots12[] = { &v };
+	HPC_FRAME_PUSH(__frame12, __roots12);
+
+	len = Vec_vlength__c5(__self__);
+	v = Vec_new__c4(Vec, data->x, data->y, data->z);
+	if ( len > 1.0e-17 )
+	{
+		((cVec *)DATA_PTR(v))->x = num_div_1(1, ((cVec *)DATA_PTR(v))->x, mrb_float_value(len));
+		mrb_field_write_barrier_value(mrb, mrb_basic_ptr(v), ((cVec *)DATA_PTR(v))->x);
+		((cVec *)DATA_PTR(v))->y = num_div_1(1, ((cVec *)DATA_PTR(v))->y, mrb_float_value(len));
+		mrb_field_write_barrier_value(mrb, mrb_basic_ptr(v), ((cVec *)DATA_PTR(v))->y);
+		((cVec *)DATA_PTR(v))->z = num_div_1(1, ((cVec *)DATA_PTR(v))->z, mrb_float_value(len));
+		mrb_field_write_barrier_value(mrb, mrb_basic_ptr(v), ((cVec *)DATA_PTR(v))->z);
+	}
+	{
+		mrb_value __ret = v;
+		HPC_FRAME_POP(__frame12);
+		return __ret;
+	}
+}
+
+static mrb_value
+Vec_vlength(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return sqrt_1(1, Math, num_add_1(1, num_add_1(1, num_mul_1(1, data->x, data->x), num_mul_1(1, data->y, data->y)), num_mul_1(1, data->z, data->z)));
+}
+
+static mrb_value
+Vec_vdot(mrb_value __self__, mrb_value b)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	mrb_value r = mrb_nil_value();
+	mrb_value *__roots13[] = { &r };
+	HPC_FRAME_PUSH(__frame13, __roots13);
+
+	r = num_add_1(1, num_add_1(1, num_mul_1(1, data->x, x_0(1, b)), num_mul_1(1, data->y, y_0(1, b))), num_mul_1(1, data->z, z_0(1, b)));
+	{
+		mrb_value __ret = r;
+		HPC_FRAME_POP(__frame13);
+		return __ret;
+	}
+}
+
+static mrb_value
+Vec_vcross(mrb_value __self__, mrb_value b)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return Vec_new__c4(Vec, num_sub_1(1, num_mul_1(1, data->y, z_0(1, b)), num_mul_1(1, data->z, y_0(1, b))), num_sub_1(1, num_mul_1(1, data->z, x_0(1, b)), num_mul_1(1, data->x, z_0(1, b))), num_sub_1(1, num_mul_1(1, data->x, y_0(1, b)), num_mul_1(1, data->y, x_0(1, b))));
+}
+
+static mrb_value
+Vec_vsub(mrb_value __self__, mrb_value b)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return Vec_new__c4(Vec, num_sub_1(1, data->x, ((cVec *)DATA_PTR(b))->x), num_sub_1(1, data->y, ((cVec *)DATA_PTR(b))->y), num_sub_1(1, data->z, ((cVec *)DATA_PTR(b))->z));
+}
+
+static mrb_value
+Vec_vadd(mrb_value __self__, mrb_value b)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return mrb_funcall(mrb, Vec, "new", 3, num_add_1(1, data->x, x_0(1, b)), num_add_1(1, data->y, y_0(1, b)), num_add_1(1, data->z, z_0(1, b)));
+}
+
+static mrb_value
+Vec_z(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->z;
+}
+
+static mrb_value
+Vec_y(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->y;
+}
+
+static mrb_value
+Vec_x(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->x;
+}
+
+static mrb_value
+Vec_z_set(mrb_value __self__, mrb_value v)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->z = v;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->z);
+	return data->z;
+}
+
+static mrb_value
+Vec_y_set(mrb_value __self__, mrb_value v)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->y = v;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->y);
+	return data->y;
+}
+
+static mrb_value
+Vec_x_set(mrb_value __self__, mrb_value v)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->x = v;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->x);
+	return data->x;
+}
+
+static mrb_value
+Vec_initialize(mrb_value __self__, mrb_value x, mrb_value y, mrb_value z)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->x = x;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->x);
+	data->y = y;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->y);
+	data->z = z;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->z);
+	return data->z;
+}
+
+static mrb_value
+Vec_vnormalize__c22(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	double len;
+	mrb_value v = mrb_nil_value();
+	mrb_value *__roots14[] = { &v };
+	HPC_FRAME_PUSH(__frame14, __roots14);
+
+	len = Vec_vlength__c5(__self__);
+	v = Vec_new__c4(Vec, data->x, data->y, data->z);
+	if ( len > 1.0e-17 )
+	{
+		((cVec *)DATA_PTR(v))->x = num_div_1(1, ((cVec *)DATA_PTR(v))->x, mrb_float_value(len));
+		mrb_field_write_barrier_value(mrb, mrb_basic_ptr(v), ((cVec *)DATA_PTR(v))->x);
+		((cVec *)DATA_PTR(v))->y = num_div_1(1, ((cVec *)DATA_PTR(v))->y, mrb_float_value(len));
+		mrb_field_write_barrier_value(mrb, mrb_basic_ptr(v), ((cVec *)DATA_PTR(v))->y);
+		((cVec *)DATA_PTR(v))->z = num_div_1(1, ((cVec *)DATA_PTR(v))->z, mrb_float_value(len));
+		mrb_field_write_barrier_value(mrb, mrb_basic_ptr(v), ((cVec *)DATA_PTR(v))->z);
+	}
+	{
+		mrb_value __ret = v;
+		HPC_FRAME_POP(__frame14);
+		return __ret;
+	}
+}
+
+static mrb_value
+Vec_initialize__c10(mrb_value __self__, double x, double y, double z)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->x = mrb_float_value(x);
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->x);
+	data->y = mrb_float_value(y);
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->y);
+	data->z = mrb_float_value(z);
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->z);
+	return data->z;
+}
+
+static mrb_value
+Vec_new__c10(mrb_value __self__, double x, double y, double z)
+{
+	mrb_value obj;
+	struct RData * data;
+	cVec *sval;
+	Data_Make_Struct(mrb, mrb_class_ptr(__self__), cVec, &hpc_data_type, sval, data);
+	sval->type = T_Vec;
+	obj = mrb_obj_value(data);
+	Vec_initialize__c10(obj, x, y, z);
+	return obj;
+}
+
+static mrb_value
+Vec_vdot__c9(mrb_value __self__, mrb_value b)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	mrb_value r = mrb_nil_value();
+	mrb_value *__roots15[] = { &r };
+	HPC_FRAME_PUSH(__frame15, __roots15);
+
+	r = num_add_1(1, num_add_1(1, num_mul_1(1, data->x, ((cVec *)DATA_PTR(b))->x), num_mul_1(1, data->y, ((cVec *)DATA_PTR(b))->y)), num_mul_1(1, data->z, ((cVec *)DATA_PTR(b))->z));
+	{
+		mrb_value __ret = r;
+		HPC_FRAME_POP(__frame15);
+		return __ret;
+	}
+}
+
+static mrb_value
+Vec_z_set__c8(mrb_value __self__, mrb_value v)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->z = v;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->z);
+	return data->z;
+}
+
+static mrb_value
+Vec_y_set__c7(mrb_value __self__, mrb_value v)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->y = v;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->y);
+	return data->y;
+}
+
+static mrb_value
+Vec_x_set__c6(mrb_value __self__, mrb_value v)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->x = v;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->x);
+	return data->x;
+}
+
+static double
+Vec_vlength__c5(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return mrb_float(sqrt_1(1, Math, num_add_1(1, num_add_1(1, num_mul_1(1, data->x, data->x), num_mul_1(1, data->y, data->y)), num_mul_1(1, data->z, data->z))));
+}
+
+static mrb_value
+Vec_initialize__c4(mrb_value __self__, mrb_value x, mrb_value y, mrb_value z)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->x = x;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->x);
+	data->y = y;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->y);
+	data->z = z;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->z);
+	return data->z;
+}
+
+static mrb_value
+Vec_new__c4(mrb_value __self__, mrb_value x, mrb_value y, mrb_value z)
+{
+	mrb_value obj;
+	struct RData * data;
+	cVec *sval;
+	Data_Make_Struct(mrb, mrb_class_ptr(__self__), cVec, &hpc_data_type, sval, data);
+	sval->type = T_Vec;
+	obj = mrb_obj_value(data);
+	Vec_initialize__c4(obj, x, y, z);
+	return obj;
+}
+
+static mrb_value
+Vec_z__c3(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->z;
+}
+
+static mrb_value
+Vec_y__c2(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->y;
+}
+
+static mrb_value
+Vec_x__c1(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->x;
+}
+
+static mrb_value
+Rand_rand(mrb_value __self__)
+{
+	mrb_int x;
+	mrb_int t;
+	mrb_int w;
+
+	x = T_Rand__x;
+	t = (x ^ hpc_lshift_int((x & 0xfffff), 11));
+	w = T_Rand__w;
+	mrb_int __tmp_128 = T_Rand__y;
+	mrb_int __tmp_129 = T_Rand__z;
+	mrb_int __tmp_130 = w;
+	T_Rand__x = __tmp_128;
+	T_Rand__y = __tmp_129;
+	T_Rand__z = __tmp_130;
+	T_Rand__w = ((w ^ hpc_rshift_int(w, 19)) ^ (t ^ hpc_rshift_int(t, 8)));
+	return mrb_float_value((((mrb_float)hpc_mod_int(T_Rand__w, 536870912)) / 536870912.0));
+}
+
+static double
+Rand_rand__c13(mrb_value __self__)
+{
+	mrb_int x;
+	mrb_int t;
+	mrb_int w;
+
+	x = T_Rand__x;
+	t = (x ^ hpc_lshift_int((x & 0xfffff), 11));
+	w = T_Rand__w;
+	mrb_int __tmp_133 = T_Rand__y;
+	mrb_int __tmp_134 = T_Rand__z;
+	mrb_int __tmp_135 = w;
+	T_Rand__x = __tmp_133;
+	T_Rand__y = __tmp_134;
+	T_Rand__z = __tmp_135;
+	T_Rand__w = ((w ^ hpc_rshift_int(w, 19)) ^ (t ^ hpc_rshift_int(t, 8)));
+	return (((mrb_float)hpc_mod_int(T_Rand__w, 536870912)) / 536870912.0);
+}
+
+static mrb_value
+otherBasis(mrb_value __self__, mrb_value basis, mrb_value n)
+{
+	hpc_ary_aset_2(0, basis, mrb_fixnum_value(2), mrb_funcall(mrb, Vec, "new", 3, x_0(1, n), y_0(1, n), z_0(1, n)));
+	hpc_ary_aset_2(0, basis, mrb_fixnum_value(1), Vec_new__c10(Vec, 0.0, 0.0, 0.0));
+	if ( mrb_bool(( (mrb_bool(num_lt_1(1, x_0(1, n), mrb_float_value(0.6)))) ? num_gt_1(1, x_0(1, n), mrb_float_value((-0.6))) : num_lt_1(1, x_0(1, n), mrb_float_value(0.6)) )) )
+	{
+		x_set_1(0, hpc_ary_aget_1(1, basis, mrb_fixnum_value(1)), mrb_float_value(1.0));
+	}
+	else	if ( mrb_bool(( (mrb_bool(num_lt_1(1, y_0(1, n), mrb_float_value(0.6)))) ? num_gt_1(1, y_0(1, n), mrb_float_value((-0.6))) : num_lt_1(1, y_0(1, n), mrb_float_value(0.6)) )) )
+	{
+		y_set_1(0, hpc_ary_aget_1(1, basis, mrb_fixnum_value(1)), mrb_float_value(1.0));
+	}
+	else	if ( mrb_bool(( (mrb_bool(num_lt_1(1, z_0(1, n), mrb_float_value(0.6)))) ? num_gt_1(1, z_0(1, n), mrb_float_value((-0.6))) : num_lt_1(1, z_0(1, n), mrb_float_value(0.6)) )) )
+	{
+		z_set_1(0, hpc_ary_aget_1(1, basis, mrb_fixnum_value(1)), mrb_float_value(1.0));
+	}
+	else	{
+		x_set_1(0, hpc_ary_aget_1(1, basis, mrb_fixnum_value(1)), mrb_float_value(1.0));
+	}
+	hpc_ary_aset_2(0, basis, mrb_fixnum_value(0), vcross_1(1, hpc_ary_aget_1(1, basis, mrb_fixnum_value(1)), hpc_ary_aget_1(1, basis, mrb_fixnum_value(2))));
+	hpc_ary_aset_2(0, basis, mrb_fixnum_value(0), vnormalize_0(1, hpc_ary_aget_1(1, basis, mrb_fixnum_value(0))));
+	hpc_ary_aset_2(0, basis, mrb_fixnum_value(1), vcross_1(1, hpc_ary_aget_1(1, basis, mrb_fixnum_value(2)), hpc_ary_aget_1(1, basis, mrb_fixnum_value(0))));
+	return hpc_ary_aset_2(1, basis, mrb_fixnum_value(1), vnormalize_0(1, hpc_ary_aget_1(1, basis, mrb_fixnum_value(1))));
+}
+
+static mrb_value
+clamp(mrb_value __self__, mrb_value f)
+{
+	double i;
+
+	i = hpc_to_float(num_mul_1(1, f, mrb_float_value(255.5)));
+	if ( i > 255.0 )
+	{
+		i = 255.0;
+	}
+	if ( i < 0.0 )
+	{
+		i = 0.0;
+	}
+	return mrb_fixnum_value(((mrb_int)i));
+}
+
+static mrb_value
+clamp__c23(mrb_value __self__, mrb_value f)
+{
+	mrb_value i = mrb_nil_value();
+	mrb_value *__roots16[] = { &i };
+	HPC_FRAME_PUSH(__frame16, __roots16);
+
+	i = num_mul_1(1, f, mrb_float_value(255.5));
+	if ( mrb_bool(num_gt_1(1, i, mrb_float_value(255.0))) )
+	{
+		i = mrb_float_value(255.0);
+	}
+	if ( mrb_bool(num_lt_1(1, i, mrb_float_value(0.0))) )
+	{
+		i = mrb_float_value(0.0);
+	}
+	{
+		mrb_value __ret = to_i_0(1, i);
+		HPC_FRAME_POP(__frame16);
+		return __ret;
+	}
+}
+
+static mrb_value
+otherBasis__c17(mrb_value __self__, mrb_value basis, mrb_value n)
+{
+	hpc_ary_aset_2(0, basis, mrb_fixnum_value(2), Vec_new__c4(Vec, x_0(1, n), y_0(1, n), z_0(1, n)));
+	hpc_ary_aset_2(0, basis, mrb_fixnum_value(1), Vec_new__c10(Vec, 0.0, 0.0, 0.0));
+	if ( mrb_bool(( (mrb_bool(num_lt_1(1, x_0(1, n), mrb_float_value(0.6)))) ? num_gt_1(1, x_0(1, n), mrb_float_value((-0.6))) : num_lt_1(1, x_0(1, n), mrb_float_value(0.6)) )) )
+	{
+		x_set_1(0, hpc_ary_vref(basis, 1), mrb_float_value(1.0));
+	}
+	else	if ( mrb_bool(( (mrb_bool(num_lt_1(1, y_0(1, n), mrb_float_value(0.6)))) ? num_gt_1(1, y_0(1, n), mrb_float_value((-0.6))) : num_lt_1(1, y_0(1, n), mrb_float_value(0.6)) )) )
+	{
+		y_set_1(0, hpc_ary_vref(basis, 1), mrb_float_value(1.0));
+	}
+	else	if ( mrb_bool(( (mrb_bool(num_lt_1(1, z_0(1, n), mrb_float_value(0.6)))) ? num_gt_1(1, z_0(1, n), mrb_float_value((-0.6))) : num_lt_1(1, z_0(1, n), mrb_float_value(0.6)) )) )
+	{
+		z_set_1(0, hpc_ary_vref(basis, 1), mrb_float_value(1.0));
+	}
+	else	{
+		x_set_1(0, hpc_ary_vref(basis, 1), mrb_float_value(1.0));
+	}
+	hpc_ary_aset_2(0, basis, mrb_fixnum_value(0), vcross_1(1, hpc_ary_vref(basis, 1), hpc_ary_vref(basis, 2)));
+	hpc_ary_aset_2(0, basis, mrb_fixnum_value(0), vnormalize_0(1, hpc_ary_vref(basis, 0)));
+	hpc_ary_aset_2(0, basis, mrb_fixnum_value(1), vcross_1(1, hpc_ary_vref(basis, 2), hpc_ary_vref(basis, 0)));
+	return hpc_ary_aset_2(1, basis, mrb_fixnum_value(1), vnormalize_0(1, hpc_ary_vref(basis, 1)));
+}
+
+mrb_value
+clamp_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	return clamp(__self__, arg0);
+}mrb_value
+otherBasis_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	return otherBasis(__self__, arg0, arg1);
+}mrb_value
+rand_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+	if (hpc_class_eq(__self__, Rand)) {
+		result = Rand_rand(__self__);
+	} else {
+		switch (hpc_type_of(__self__)) {
+		default:
+			result = mrb_funcall(mrb, __self__, "rand", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+x_set_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Vec:
+			result = Vec_x_set(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "x=", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+y_set_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Vec:
+			result = Vec_y_set(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "y=", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+z_set_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Vec:
+			result = Vec_z_set(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "z=", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+x_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Vec:
+			result = Vec_x(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "x", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+y_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Vec:
+			result = Vec_y(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "y", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+z_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Vec:
+			result = Vec_z(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "z", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+vadd_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Vec:
+			result = Vec_vadd(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "vadd", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+vsub_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Vec:
+			result = Vec_vsub(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "vsub", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+vcross_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Vec:
+			result = Vec_vcross(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "vcross", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+vdot_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Vec:
+			result = Vec_vdot(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "vdot", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+vlength_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Vec:
+			result = Vec_vlength(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "vlength", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+vnormalize_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Vec:
+			result = Vec_vnormalize(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "vnormalize", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+center_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Sphere:
+			result = Sphere_center(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "center", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+radius_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Sphere:
+			result = Sphere_radius(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "radius", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+intersect_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Sphere:
+			result = Sphere_intersect(__self__, arg0, arg1);
+			break;
+		case T_Plane:
+			result = Plane_intersect(__self__, arg0, arg1);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "intersect", 2, arg0, arg1);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+org_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Ray:
+			result = Ray_org(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "org", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+org_set_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Ray:
+			result = Ray_org_set(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "org=", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+dir_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Ray:
+			result = Ray_dir(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "dir", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+dir_set_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Ray:
+			result = Ray_dir_set(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "dir=", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+t_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Isect:
+			result = Isect_t(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "t", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+t_set_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Isect:
+			result = Isect_t_set(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "t=", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+hit_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Isect:
+			result = Isect_hit(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "hit", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+hit_set_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Isect:
+			result = Isect_hit_set(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "hit=", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+pl_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Isect:
+			result = Isect_pl(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "pl", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+pl_set_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Isect:
+			result = Isect_pl_set(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "pl=", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+n_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Isect:
+			result = Isect_n(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "n", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+n_set_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Isect:
+			result = Isect_n_set(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "n=", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+ambient_occlusion_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Scene:
+			result = Scene_ambient_occlusion(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "ambient_occlusion", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+render_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Scene:
+			result = Scene_render(__self__, arg0, arg1, arg2);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "render", 3, arg0, arg1, arg2);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
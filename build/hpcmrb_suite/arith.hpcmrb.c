@@ -0,0 +1,133 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+
+mrb_value Math;
+
+void
+init_global_syms(mrb_state * mrb)
+{
+	Math = mrb_const_get(mrb, mrb_obj_value(mrb->object_class), mrb_intern(mrb, "Math"));
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { NULL };
+	(hpc_output_int(3), hpc_output_write("\n", 1), mrb_nil_value());
+	(hpc_output_int(3), hpc_output_write("\n", 1), mrb_nil_value());
+	(hpc_output_int(6), hpc_output_write("\n", 1), mrb_nil_value());
+	puts_1(0, __self__, mrb_float_value(3.0));
+	puts_1(0, __self__, mrb_bool_value(4 == 4));
+	puts_1(0, __self__, mrb_bool_value(3 < 4));
+	puts_1(0, __self__, mrb_bool_value(3 <= 4));
+	puts_1(0, __self__, mrb_bool_value(5 > 3));
+	puts_1(0, __self__, mrb_bool_value(5 >= 3));
+	puts_1(0, __self__, mrb_float_value(2.2360679774997898));
+	puts_1(0, __self__, mrb_float_value(0.67487576007126715));
+	puts_1(0, __self__, mrb_float_value(0.69613523862735671));
+	(hpc_output_int(3), hpc_output_write("\n", 1), mrb_nil_value());
+	puts_1(0, __self__, mrb_float_value(3.0));
+	puts_1(0, __self__, chr_0(1, mrb_fixnum_value(65)));
+	(hpc_output_int(3), hpc_output_write("\n", 1), mrb_nil_value());
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
@@ -0,0 +1,262 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+
+
+void
+init_global_syms(mrb_state * mrb)
+{
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { NULL };
+	mrb_value a = mrb_nil_value();
+	mrb_value b = mrb_nil_value();
+	mrb_value s = mrb_nil_value();
+	mrb_value c = mrb_nil_value();
+	mrb_value t = mrb_nil_value();
+	mrb_value n;
+	mrb_value *__roots1[] = { &a, &b, &s, &c, &t };
+	HPC_FRAME_PUSH(__frame1, __roots1);
+
+	a = mrb_funcall(mrb, mrb_obj_value(mrb->array_class), "new", 0);
+	b = mrb_funcall(mrb, mrb_obj_value(mrb->array_class), "new", 0);
+	{
+		mrb_int __tmp_0 = 10;
+
+		if ( mrb_bool(hpc_ary_inplace_p_2(1, a, mrb_fixnum_value(0), mrb_fixnum_value(10))) )
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 10;
+			mrb_int __i_first = __i;
+#pragma omp parallel for if (hpc_ary_writable(a, __i_first, __i_last))
+			for (__i = __i_first; __i < __i_last; ++__i) {
+				mrb_int i = __i;
+				hpc_ary_fset(a, i, (((mrb_float)i) * 0.5));
+			}
+		}
+		else		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 10;
+			mrb_int __i_first = __i;
+#pragma omp parallel for if (hpc_ary_writable(a, __i_first, __i_last))
+			for (__i = __i_first; __i < __i_last; ++__i) {
+				mrb_int i = __i;
+				hpc_ary_aset_2(1, a, mrb_fixnum_value(i), mrb_float_value((((mrb_float)i) * 0.5)));
+			}
+		}
+	}
+	{
+		mrb_int __tmp_1 = mrb_fixnum(hpc_ary_len_0(1, a));
+
+		if ( mrb_bool(( (mrb_bool(hpc_ary_float_p_2(1, a, mrb_fixnum_value(0), mrb_fixnum_value(__tmp_1)))) ? hpc_ary_inplace_p_2(1, b, mrb_fixnum_value(0), mrb_fixnum_value(__tmp_1)) : mrb_false_value() )) )
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = __tmp_1;
+			mrb_int __i_first = __i;
+#pragma omp parallel for if (hpc_ary_writable(b, __i_first, __i_last))
+			for (__i = __i_first; __i < __i_last; ++__i) {
+				mrb_int i = __i;
+				hpc_ary_fset(b, i, hpc_ary_fref(a, i));
+			}
+		}
+		else		{
+			mrb_int __i = 0;
+			mrb_int __i_last = __tmp_1;
+			mrb_int __i_first = __i;
+#pragma omp parallel for if (hpc_ary_writable(b, __i_first, __i_last))
+			for (__i = __i_first; __i < __i_last; ++__i) {
+				mrb_int i = __i;
+				hpc_ary_aset_2(1, b, mrb_fixnum_value(i), hpc_ary_uref(a, i));
+			}
+		}
+	}
+	puts_1(0, __self__, hpc_ary_vref(b, 9));
+	s = mrb_float_value(0.0);
+	{
+		mrb_value __tmp_2 = a;
+		mrb_int __tmp_3 = 0;
+		mrb_value *__roots2[] = { &__tmp_2 };
+		HPC_FRAME_PUSH(__frame2, __roots2);
+
+		while (__tmp_3 < mrb_fixnum(hpc_ary_len_0(1, __tmp_2))) {
+			int ai = mrb_gc_arena_save(mrb);
+			{
+				{
+					mrb_value x = hpc_ary_uref(__tmp_2, __tmp_3);
+					mrb_value *__roots3[] = { &x };
+					HPC_FRAME_PUSH(__frame3, __roots3);
+
+					s = num_add_1(1, s, x);
+					HPC_FRAME_POP(__frame3);
+				}
+				__tmp_3 = (__tmp_3 + 1);
+			}
+			mrb_gc_arena_restore(mrb, ai);
+		}
+		HPC_FRAME_POP(__frame2);
+	}
+	puts_1(0, __self__, s);
+	c = ({
+		mrb_value __tmp_4 = a;
+		mrb_int __tmp_5 = 0;
+		mrb_value __tmp_6 = hpc_ary_new_0(1, __tmp_4);
+		mrb_value *__roots4[] = { &__tmp_4, &__tmp_6 };
+		HPC_FRAME_PUSH(__frame4, __roots4);
+		while (__tmp_5 < mrb_fixnum(hpc_ary_len_0(1, __tmp_4))) {
+			int ai = mrb_gc_arena_save(mrb);
+			{
+				{
+					mrb_value x = hpc_ary_uref(__tmp_4, __tmp_5);
+					mrb_value *__roots5[] = { &x };
+					HPC_FRAME_PUSH(__frame5, __roots5);
+
+					hpc_ary_aset_2(0, __tmp_6, mrb_fixnum_value(__tmp_5), num_mul_1(1, x, mrb_fixnum_value(2)));
+					HPC_FRAME_POP(__frame5);
+				}
+				__tmp_5 = (__tmp_5 + 1);
+			}
+			mrb_gc_arena_restore(mrb, ai);
+		}
+		mrb_value __val4 = __tmp_6;
+		HPC_FRAME_POP(__frame4);
+		__val4;
+	});
+	puts_1(0, __self__, hpc_ary_vref(c, 3));
+	t = mrb_float_value(0.0);
+	{
+		mrb_int __tmp_7 = mrb_fixnum(hpc_ary_len_0(1, a));
+
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = __tmp_7;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				t = num_add_1(1, t, num_mul_1(1, hpc_ary_vref(a, i), hpc_ary_vref(c, i)));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	puts_1(0, __self__, t);
+	puts_1(0, __self__, hpc_ary_vref(a, 20));
+	puts_1(0, __self__, hpc_ary_vref(a, (-1)));
+	n = mrb_fixnum_value((mrb_fixnum(hpc_ary_len_0(1, a)) - 3));
+	{
+		mrb_value __tmp_8 = n;
+
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = mrb_fixnum(__tmp_8);
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				puts_1(0, __self__, hpc_ary_aget_1(1, a, hpc_int_add(i, 2)));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	HPC_FRAME_POP(__frame1);
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
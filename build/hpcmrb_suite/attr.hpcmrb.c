@@ -0,0 +1,607 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+#define T_Size 1001
+typedef struct {
+	int type;
+	mrb_int x;
+} cSize;
+
+#define T_Point 1002
+typedef struct {
+	int type;
+	mrb_int label;
+	mrb_value norm2;
+	mrb_value y;
+	mrb_value x;
+} cPoint;
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+mrb_value
+x_set_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+y_0(int val, mrb_value __self__);
+mrb_value
+y_set_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+norm2_0(int val, mrb_value __self__);
+mrb_value
+label_set_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+label_plus_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+x_0(int val, mrb_value __self__);
+
+static mrb_value
+Size_initialize(mrb_value __self__, mrb_value x);
+static mrb_value
+Size_x(mrb_value __self__);
+static mrb_int
+Size_initialize__c9(mrb_value __self__, mrb_int x);
+static mrb_value
+Size_new__c9(mrb_value __self__, mrb_int x);
+static mrb_value
+Point_label_plus(mrb_value __self__, mrb_value n);
+static mrb_value
+Point_initialize(mrb_value __self__, mrb_value x, mrb_value y);
+static mrb_value
+Point_label_set(mrb_value __self__, mrb_value label);
+static mrb_value
+Point_norm2(mrb_value __self__);
+static mrb_value
+Point_y_set(mrb_value __self__, mrb_value y);
+static mrb_value
+Point_y(mrb_value __self__);
+static mrb_value
+Point_x_set(mrb_value __self__, mrb_value x);
+static mrb_value
+Point_x(mrb_value __self__);
+static mrb_int
+Point_initialize__c8(mrb_value __self__, mrb_int x, mrb_int y);
+static mrb_value
+Point_new__c8(mrb_value __self__, mrb_int x, mrb_int y);
+static mrb_value
+Point_label_plus__c7(mrb_value __self__, mrb_int n);
+static mrb_value
+Point_norm2__c6(mrb_value __self__);
+static mrb_int
+Point_label_set__c5(mrb_value __self__, mrb_int label);
+static mrb_value
+Point_x_set__c4(mrb_value __self__, mrb_value x);
+static mrb_value
+Point_y__c3(mrb_value __self__);
+static mrb_value
+Point_x__c2(mrb_value __self__);
+static mrb_int
+Point_initialize__c1(mrb_value __self__, double x, double y);
+static mrb_value
+Point_new__c1(mrb_value __self__, double x, double y);
+mrb_sym __i_x;
+mrb_sym __i_label;
+mrb_sym __i_norm2;
+mrb_sym __i_y;
+mrb_sym __i_x;
+
+void
+init_global_syms(mrb_state * mrb)
+{
+	__i_x = mrb_intern(mrb, "x");
+	__i_label = mrb_intern(mrb, "label");
+	__i_norm2 = mrb_intern(mrb, "norm2");
+	__i_y = mrb_intern(mrb, "y");
+	__i_x = mrb_intern(mrb, "x");
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void Size_init(mrb_value __self__);
+void Point_init(mrb_value __self__);
+mrb_value Point;
+mrb_value Size;
+void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { &Point, &Size };
+	static mrb_shadow_frame __global_frame;
+	__global_frame.prev = mrb->shadow_frames;
+	__global_frame.len = sizeof(__global_roots) / sizeof(__global_roots[0]);
+	__global_frame.roots = __global_roots;
+	mrb->shadow_frames = &__global_frame;
+	mrb_value pt = mrb_nil_value();
+	mrb_value o = mrb_nil_value();
+	mrb_value *__roots1[] = { &pt, &o };
+	HPC_FRAME_PUSH(__frame1, __roots1);
+
+	Point = mrb_obj_value(mrb_define_class(mrb, "Point", mrb->object_class));
+	Point_init(Point);
+	Size = mrb_obj_value(mrb_define_class(mrb, "Size", mrb->object_class));
+	Size_init(Size);
+	pt = Point_new__c1(Point, 1.5, (-2.0));
+	((cPoint *)DATA_PTR(pt))->x = num_add_1(1, ((cPoint *)DATA_PTR(pt))->x, ((cPoint *)DATA_PTR(pt))->y);
+	((cPoint *)DATA_PTR(pt))->label = 3;
+	puts_1(0, __self__, ((cPoint *)DATA_PTR(pt))->x);
+	puts_1(0, __self__, ((cPoint *)DATA_PTR(pt))->norm2);
+	puts_1(0, __self__, Point_label_plus__c7(pt, 4));
+	o = Point_new__c8(Point, 1, 2);
+	{
+		mrb_int __tmp_1 = 2;
+
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 2;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				puts_1(0, __self__, x_0(1, o));
+				o = Size_new__c9(Size, 10);
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	HPC_FRAME_POP(__frame1);
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+	if (c == (struct RClass *)mrb_obj_ptr(Size)) {
+		cSize *sval;
+		Data_Make_Struct(mrb, c, cSize, &hpc_data_type, sval, data);
+		sval->type = T_Size;
+		obj = mrb_obj_value(data);
+		Size_initialize(obj, arg0);
+} else {
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+	if (c == (struct RClass *)mrb_obj_ptr(Point)) {
+		cPoint *sval;
+		Data_Make_Struct(mrb, c, cPoint, &hpc_data_type, sval, data);
+		sval->type = T_Point;
+		obj = mrb_obj_value(data);
+		Point_initialize(obj, arg0, arg1);
+} else {
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+void
+Size_init(mrb_value __self__)
+{
+}
+
+void
+Point_init(mrb_value __self__)
+{
+}
+
+static mrb_value
+Size_initialize(mrb_value __self__, mrb_value x)
+{
+	cSize *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->x = mrb_fixnum(x);
+	return mrb_fixnum_value(data->x);
+}
+
+static mrb_value
+Size_x(mrb_value __self__)
+{
+	cSize *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return mrb_fixnum_value(data->x);
+}
+
+static mrb_int
+Size_initialize__c9(mrb_value __self__, mrb_int x)
+{
+	cSize *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->x = x;
+	return data->x;
+}
+
+static mrb_value
+Size_new__c9(mrb_value __self__, mrb_int x)
+{
+	mrb_value obj;
+	struct RData * data;
+	cSize *sval;
+	Data_Make_Struct(mrb, mrb_class_ptr(__self__), cSize, &hpc_data_type, sval, data);
+	sval->type = T_Size;
+	obj = mrb_obj_value(data);
+	Size_initialize__c9(obj, x);
+	return obj;
+}
+
+static mrb_value
+Point_label_plus(mrb_value __self__, mrb_value n)
+{
+	cPoint *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return num_add_1(1, mrb_fixnum_value(data->label), n);
+}
+
+static mrb_value
+Point_initialize(mrb_value __self__, mrb_value x, mrb_value y)
+{
+	cPoint *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->x = x;
+	data->y = y;
+	data->norm2 = num_add_1(1, num_mul_1(1, x, x), num_mul_1(1, y, y));
+	data->label = 0;
+	return mrb_fixnum_value(data->label);
+}
+
+static mrb_value
+Point_label_set(mrb_value __self__, mrb_value label)
+{
+	cPoint *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->label = mrb_fixnum(label);
+	return mrb_fixnum_value(data->label);
+}
+
+static mrb_value
+Point_norm2(mrb_value __self__)
+{
+	cPoint *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->norm2;
+}
+
+static mrb_value
+Point_y_set(mrb_value __self__, mrb_value y)
+{
+	cPoint *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->y = y;
+	return data->y;
+}
+
+static mrb_value
+Point_y(mrb_value __self__)
+{
+	cPoint *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->y;
+}
+
+static mrb_value
+Point_x_set(mrb_value __self__, mrb_value x)
+{
+	cPoint *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->x = x;
+	return data->x;
+}
+
+static mrb_value
+Point_x(mrb_value __self__)
+{
+	cPoint *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->x;
+}
+
+static mrb_int
+Point_initialize__c8(mrb_value __self__, mrb_int x, mrb_int y)
+{
+	cPoint *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->x = mrb_fixnum_value(x);
+	data->y = mrb_fixnum_value(y);
+	data->norm2 = num_add_1(1, hpc_int_mul(x, x), hpc_int_mul(y, y));
+	data->label = 0;
+	return data->label;
+}
+
+static mrb_value
+Point_new__c8(mrb_value __self__, mrb_int x, mrb_int y)
+{
+	mrb_value obj;
+	struct RData * data;
+	cPoint *sval;
+	Data_Make_Struct(mrb, mrb_class_ptr(__self__), cPoint, &hpc_data_type, sval, data);
+	sval->type = T_Point;
+	obj = mrb_obj_value(data);
+	Point_initialize__c8(obj, x, y);
+	return obj;
+}
+
+static mrb_value
+Point_label_plus__c7(mrb_value __self__, mrb_int n)
+{
+	cPoint *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return hpc_int_add(data->label, n);
+}
+
+static mrb_value
+Point_norm2__c6(mrb_value __self__)
+{
+	cPoint *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->norm2;
+}
+
+static mrb_int
+Point_label_set__c5(mrb_value __self__, mrb_int label)
+{
+	cPoint *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->label = label;
+	return data->label;
+}
+
+static mrb_value
+Point_x_set__c4(mrb_value __self__, mrb_value x)
+{
+	cPoint *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->x = x;
+	return data->x;
+}
+
+static mrb_value
+Point_y__c3(mrb_value __self__)
+{
+	cPoint *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->y;
+}
+
+static mrb_value
+Point_x__c2(mrb_value __self__)
+{
+	cPoint *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->x;
+}
+
+static mrb_int
+Point_initialize__c1(mrb_value __self__, double x, double y)
+{
+	cPoint *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->x = mrb_float_value(x);
+	data->y = mrb_float_value(y);
+	data->norm2 = mrb_float_value(((x * x) + (y * y)));
+	data->label = 0;
+	return data->label;
+}
+
+static mrb_value
+Point_new__c1(mrb_value __self__, double x, double y)
+{
+	mrb_value obj;
+	struct RData * data;
+	cPoint *sval;
+	Data_Make_Struct(mrb, mrb_class_ptr(__self__), cPoint, &hpc_data_type, sval, data);
+	sval->type = T_Point;
+	obj = mrb_obj_value(data);
+	Point_initialize__c1(obj, x, y);
+	return obj;
+}
+
+mrb_value
+x_set_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Point:
+			result = Point_x_set(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "x=", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+y_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Point:
+			result = Point_y(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "y", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+y_set_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Point:
+			result = Point_y_set(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "y=", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+norm2_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Point:
+			result = Point_norm2(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "norm2", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+label_set_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Point:
+			result = Point_label_set(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "label=", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+label_plus_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Point:
+			result = Point_label_plus(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "label_plus", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+x_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Point:
+			result = Point_x(__self__);
+			break;
+		case T_Size:
+			result = Size_x(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "x", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
@@ -0,0 +1,181 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "mruby/dump.h"
+#include "mruby/proc.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+
+static void
+hpc_vm_init(mrb_state *mrb);
+
+static void
+hpc_vm_main(mrb_state *mrb);
+
+
+void
+init_global_syms(mrb_state * mrb)
+{
+	hpc_vm_init(mrb);
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { NULL };
+	hpc_vm_main(mrb);
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+
+#include <stdint.h>
+const uint8_t hpc_vm_irep[] = {
+0x52,0x49,0x54,0x45,0x30,0x30,0x30,0x31,0x3f,0x22,0x00,0x00,0x01,0x57,0x4d,0x41,
+0x54,0x5a,0x30,0x30,0x30,0x30,0x49,0x52,0x45,0x50,0x00,0x00,0x00,0x77,0x30,0x30,
+0x30,0x30,0x00,0x02,0x00,0xd8,0x00,0x00,0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,
+0x00,0x02,0x00,0x80,0x00,0x05,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x4b,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x0b,0x00,0xc0,
+0x01,0x03,0x01,0x40,0x01,0x83,0x00,0x40,0x02,0x17,0x01,0x80,0x40,0x01,0x02,0x00,
+0x80,0x01,0x01,0x80,0x00,0xac,0x00,0x80,0x00,0x3d,0x01,0xc0,0x00,0x03,0x01,0xbf,
+0xfd,0x18,0x01,0x80,0x00,0x05,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0x01,0x10,0x00,
+0x04,0x68,0x6f,0x67,0x65,0x00,0x00,0x00,0x01,0x00,0x01,0x2b,0x00,0x4c,0x49,0x4e,
+0x45,0x00,0x00,0x00,0xc2,0x00,0x02,0x00,0xd8,0x00,0x00,0x00,0x52,0x00,0x44,0x2f,
+0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,
+0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,
+0x72,0x62,0x2f,0x74,0x65,0x73,0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x63,0x68,0x61,
+0x6e,0x67,0x65,0x5f,0x74,0x79,0x70,0x65,0x5f,0x69,0x6e,0x5f,0x6c,0x6f,0x6f,0x70,
+0x2e,0x72,0x62,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0x00,
+0x44,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,
+0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,
+0x63,0x6d,0x72,0x62,0x2f,0x74,0x65,0x73,0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x63,
+0x68,0x61,0x6e,0x67,0x65,0x5f,0x74,0x79,0x70,0x65,0x5f,0x69,0x6e,0x5f,0x6c,0x6f,
+0x6f,0x70,0x2e,0x72,0x62,0x00,0x00,0x00,0x0b,0x00,0x01,0x00,0x02,0x00,0x06,0x00,
+0x04,0x00,0x04,0x00,0x04,0x00,0x05,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x45,
+0x4e,0x44,0x00,0x00,0x00,0x00,0x08,
+};
+
+static size_t hpc_vm_base;
+
+static void
+hpc_vm_main(mrb_state *mrb)
+{
+	mrb_run(mrb, mrb_proc_new(mrb, mrb->irep[hpc_vm_base + 1]), mrb_top_self(mrb));
+	if (mrb->exc)
+		mrb_exc_raise(mrb, mrb_obj_value(mrb->exc));
+}
+
+static void
+hpc_vm_init(mrb_state *mrb)
+{
+	struct RClass *c;
+	size_t n = mrb->irep_len;
+
+	if (mrb_read_irep(mrb, hpc_vm_irep) < 0) {
+		fputs("cannot load the methods left to the VM\n", stderr);
+		exit(EXIT_FAILURE);
+	}
+	hpc_vm_base = n;
+	mrb_run(mrb, mrb_proc_new(mrb, mrb->irep[n]), mrb_top_self(mrb));
+	if (mrb->exc) {
+		mrb_p(mrb, mrb_obj_value(mrb->exc));
+		exit(EXIT_FAILURE);
+	}
+	c = mrb->object_class;
+}
+
+
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
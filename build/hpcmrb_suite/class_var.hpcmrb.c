@@ -0,0 +1,457 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+#define T_Counter 1001
+typedef struct {
+	int type;
+} cCounter;
+mrb_value T_Counter__last;
+mrb_value T_Counter__name;
+mrb_value T_Counter__count;
+
+#define T_Xorshift 1002
+typedef struct {
+	int type;
+} cXorshift;
+double T_Xorshift__scale;
+mrb_int T_Xorshift__w;
+mrb_int T_Xorshift__z;
+mrb_int T_Xorshift__y;
+mrb_int T_Xorshift__x;
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+mrb_value
+next_0(int val, mrb_value __self__);
+mrb_value
+scaled_0(int val, mrb_value __self__);
+mrb_value
+bump_0(int val, mrb_value __self__);
+mrb_value
+remember_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+report_0(int val, mrb_value __self__);
+
+static mrb_value
+Counter_report(mrb_value __self__);
+static mrb_value
+Counter_remember(mrb_value __self__, mrb_value v);
+static mrb_value
+Counter_bump(mrb_value __self__);
+static mrb_value
+Counter_report__c5(mrb_value __self__);
+static mrb_value
+Counter_remember__c4(mrb_value __self__, mrb_int v);
+static mrb_value
+Counter_bump__c3(mrb_value __self__);
+static mrb_value
+Xorshift_scaled(mrb_value __self__);
+static mrb_value
+Xorshift_next(mrb_value __self__);
+static mrb_value
+Xorshift_scaled__c2(mrb_value __self__);
+static mrb_value
+Xorshift_next__c1(mrb_value __self__);
+mrb_sym __i_last;
+mrb_sym __i_name;
+mrb_sym __i_count;
+mrb_sym __i_scale;
+mrb_sym __i_w;
+mrb_sym __i_z;
+mrb_sym __i_y;
+mrb_sym __i_x;
+
+void
+init_global_syms(mrb_state * mrb)
+{
+	__i_last = mrb_intern(mrb, "last");
+	__i_name = mrb_intern(mrb, "name");
+	__i_count = mrb_intern(mrb, "count");
+	__i_scale = mrb_intern(mrb, "scale");
+	__i_w = mrb_intern(mrb, "w");
+	__i_z = mrb_intern(mrb, "z");
+	__i_y = mrb_intern(mrb, "y");
+	__i_x = mrb_intern(mrb, "x");
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void Counter_init(mrb_value __self__);
+void Xorshift_init(mrb_value __self__);
+mrb_value MASK;
+mrb_value Xorshift;
+mrb_value Counter;
+void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { &MASK, &Xorshift, &Counter, &T_Counter__name };
+	static mrb_shadow_frame __global_frame;
+	__global_frame.prev = mrb->shadow_frames;
+	__global_frame.len = sizeof(__global_roots) / sizeof(__global_roots[0]);
+	__global_frame.roots = __global_roots;
+	mrb->shadow_frames = &__global_frame;
+	mrb_value c = mrb_nil_value();
+	mrb_value *__roots1[] = { &c };
+	HPC_FRAME_PUSH(__frame1, __roots1);
+
+	Xorshift = mrb_obj_value(mrb_define_class(mrb, "Xorshift", mrb->object_class));
+	Xorshift_init(Xorshift);
+	Counter = mrb_obj_value(mrb_define_class(mrb, "Counter", mrb->object_class));
+	Counter_init(Counter);
+	{
+		mrb_int __tmp_22 = 5;
+
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 5;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				puts_1(0, __self__, Xorshift_next__c1(Xorshift));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	puts_1(0, __self__, Xorshift_scaled__c2(Xorshift));
+	c = mrb_funcall(mrb, Counter, "new", 0);
+	{
+		mrb_int __tmp_23 = 3;
+
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 3;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				Counter_bump__c3(c);
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	Counter_remember__c4(c, 7);
+	puts_1(0, __self__, Counter_report__c5(c));
+	HPC_FRAME_POP(__frame1);
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+void
+Counter_init(mrb_value __self__)
+{
+	T_Counter__count = mrb_fixnum_value(0);
+	T_Counter__name = mrb_str_new(mrb, "counter", 7);
+}
+
+void
+Xorshift_init(mrb_value __self__)
+{
+	T_Xorshift__x = 123456789;
+	T_Xorshift__y = 362436069;
+	T_Xorshift__z = 521288629;
+	T_Xorshift__w = 88675123;
+	T_Xorshift__scale = 0.5;
+	MASK = mrb_fixnum_value(65535);
+}
+
+static mrb_value
+Counter_report(mrb_value __self__)
+{
+	cCounter *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return num_add_1(1, num_add_1(1, num_add_1(1, ({
+		mrb_value __s = mrb_str_buf_new(mrb, 1);
+		mrb_str_concat(mrb, __s, T_Counter__name);
+		mrb_str_cat(mrb, __s, " ", 1);
+		__s;
+	}), to_s_0(1, T_Counter__count)), mrb_str_new(mrb, " ", 1)), to_s_0(1, T_Counter__last));
+}
+
+static mrb_value
+Counter_remember(mrb_value __self__, mrb_value v)
+{
+	cCounter *data;
+	*(void**)&data = DATA_PTR(__self__);
+	T_Counter__last = v;
+	return T_Counter__last;
+}
+
+static mrb_value
+Counter_bump(mrb_value __self__)
+{
+	cCounter *data;
+	*(void**)&data = DATA_PTR(__self__);
+	T_Counter__count = num_add_1(1, T_Counter__count, mrb_fixnum_value(1));
+	return T_Counter__count;
+}
+
+static mrb_value
+Counter_report__c5(mrb_value __self__)
+{
+	cCounter *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return num_add_1(1, num_add_1(1, num_add_1(1, ({
+		mrb_value __s = mrb_str_buf_new(mrb, 1);
+		mrb_str_concat(mrb, __s, T_Counter__name);
+		mrb_str_cat(mrb, __s, " ", 1);
+		__s;
+	}), to_s_0(1, T_Counter__count)), mrb_str_new(mrb, " ", 1)), to_s_0(1, T_Counter__last));
+}
+
+static mrb_value
+Counter_remember__c4(mrb_value __self__, mrb_int v)
+{
+	cCounter *data;
+	*(void**)&data = DATA_PTR(__self__);
+	T_Counter__last = mrb_fixnum_value(v);
+	return T_Counter__last;
+}
+
+static mrb_value
+Counter_bump__c3(mrb_value __self__)
+{
+	cCounter *data;
+	*(void**)&data = DATA_PTR(__self__);
+	T_Counter__count = num_add_1(1, T_Counter__count, mrb_fixnum_value(1));
+	return T_Counter__count;
+}
+
+static mrb_value
+Xorshift_scaled(mrb_value __self__)
+{
+	T_Xorshift__scale = (T_Xorshift__scale * 1.5);
+	return num_mul_1(1, Xorshift_next__c1(__self__), mrb_float_value(T_Xorshift__scale));
+}
+
+static mrb_value
+Xorshift_next(mrb_value __self__)
+{
+	mrb_int x;
+	mrb_int t;
+	mrb_int w;
+
+	x = T_Xorshift__x;
+	t = (x ^ hpc_lshift_int((x & 0xfffff), 11));
+	w = T_Xorshift__w;
+	mrb_int __tmp_16 = T_Xorshift__y;
+	mrb_int __tmp_17 = T_Xorshift__z;
+	mrb_int __tmp_18 = w;
+	T_Xorshift__x = __tmp_16;
+	T_Xorshift__y = __tmp_17;
+	T_Xorshift__z = __tmp_18;
+	T_Xorshift__w = ((w ^ hpc_rshift_int(w, 19)) ^ (t ^ hpc_rshift_int(t, 8)));
+	return num_and_1(1, mrb_fixnum_value(T_Xorshift__w), MASK);
+}
+
+static mrb_value
+Xorshift_scaled__c2(mrb_value __self__)
+{
+	T_Xorshift__scale = (T_Xorshift__scale * 1.5);
+	return num_mul_1(1, Xorshift_next__c1(__self__), mrb_float_value(T_Xorshift__scale));
+}
+
+static mrb_value
+Xorshift_next__c1(mrb_value __self__)
+{
+	mrb_int x;
+	mrb_int t;
+	mrb_int w;
+
+	x = T_Xorshift__x;
+	t = (x ^ hpc_lshift_int((x & 0xfffff), 11));
+	w = T_Xorshift__w;
+	mrb_int __tmp_19 = T_Xorshift__y;
+	mrb_int __tmp_20 = T_Xorshift__z;
+	mrb_int __tmp_21 = w;
+	T_Xorshift__x = __tmp_19;
+	T_Xorshift__y = __tmp_20;
+	T_Xorshift__z = __tmp_21;
+	T_Xorshift__w = ((w ^ hpc_rshift_int(w, 19)) ^ (t ^ hpc_rshift_int(t, 8)));
+	return num_and_1(1, mrb_fixnum_value(T_Xorshift__w), MASK);
+}
+
+mrb_value
+next_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+	if (hpc_class_eq(__self__, Xorshift)) {
+		result = Xorshift_next(__self__);
+	} else {
+		switch (hpc_type_of(__self__)) {
+		default:
+			result = mrb_funcall(mrb, __self__, "next", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+scaled_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+	if (hpc_class_eq(__self__, Xorshift)) {
+		result = Xorshift_scaled(__self__);
+	} else {
+		switch (hpc_type_of(__self__)) {
+		default:
+			result = mrb_funcall(mrb, __self__, "scaled", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+bump_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Counter:
+			result = Counter_bump(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "bump", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+remember_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Counter:
+			result = Counter_remember(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "remember", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+report_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Counter:
+			result = Counter_report(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "report", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
@@ -0,0 +1,571 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+#define T_Vec 1001
+typedef struct {
+	int type;
+	double z;
+	double y;
+	double x;
+} cVec;
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+mrb_value
+scale_4(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2, mrb_value arg3);
+mrb_value
+poly_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+x_0(int val, mrb_value __self__);
+mrb_value
+y_0(int val, mrb_value __self__);
+mrb_value
+z_0(int val, mrb_value __self__);
+mrb_value
+vcross_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+norm2_0(int val, mrb_value __self__);
+
+static mrb_value
+Vec_norm2(mrb_value __self__);
+static mrb_value
+Vec_vcross(mrb_value __self__, mrb_value b);
+static mrb_value
+Vec_z(mrb_value __self__);
+static mrb_value
+Vec_y(mrb_value __self__);
+static mrb_value
+Vec_x(mrb_value __self__);
+static mrb_value
+Vec_initialize(mrb_value __self__, mrb_value x, mrb_value y, mrb_value z);
+static double
+Vec_norm2__c6(mrb_value __self__);
+static mrb_value
+Vec_vcross__c5(mrb_value __self__, mrb_value b);
+static double
+Vec_initialize__c4(mrb_value __self__, double x, double y, double z);
+static mrb_value
+Vec_new__c4(mrb_value __self__, double x, double y, double z);
+static double
+Vec_z__c3(mrb_value __self__);
+static double
+Vec_y__c2(mrb_value __self__);
+static double
+Vec_x__c1(mrb_value __self__);
+static mrb_value
+poly(mrb_value __self__, mrb_value x);
+static mrb_value
+scale(mrb_value __self__, mrb_value a, mrb_value n, mrb_value s, mrb_value t);
+static double
+poly__c9(mrb_value __self__, double x);
+static mrb_value
+poly__c8(mrb_value __self__, mrb_int x);
+static mrb_value
+scale__c7(mrb_value __self__, mrb_value a, mrb_int n, double s, double t);
+mrb_sym __i_z;
+mrb_sym __i_y;
+mrb_sym __i_x;
+
+void
+init_global_syms(mrb_state * mrb)
+{
+	__i_z = mrb_intern(mrb, "z");
+	__i_y = mrb_intern(mrb, "y");
+	__i_x = mrb_intern(mrb, "x");
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void Vec_init(mrb_value __self__);
+mrb_value Vec;
+void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { &Vec };
+	static mrb_shadow_frame __global_frame;
+	__global_frame.prev = mrb->shadow_frames;
+	__global_frame.len = sizeof(__global_roots) / sizeof(__global_roots[0]);
+	__global_frame.roots = __global_roots;
+	mrb->shadow_frames = &__global_frame;
+	mrb_value v = mrb_nil_value();
+	mrb_value a = mrb_nil_value();
+	mrb_value *__roots1[] = { &v, &a };
+	HPC_FRAME_PUSH(__frame1, __roots1);
+
+	Vec = mrb_obj_value(mrb_define_class(mrb, "Vec", mrb->object_class));
+	Vec_init(Vec);
+	v = Vec_vcross__c5(Vec_new__c4(Vec, 1.0, 2.0, 3.0), Vec_new__c4(Vec, 4.0, 5.0, 6.0));
+	puts_1(0, __self__, mrb_float_value(((cVec *)DATA_PTR(v))->x));
+	puts_1(0, __self__, mrb_float_value(((cVec *)DATA_PTR(v))->y));
+	puts_1(0, __self__, mrb_float_value(((cVec *)DATA_PTR(v))->z));
+	puts_1(0, __self__, mrb_float_value(Vec_norm2__c6(v)));
+	a = mrb_funcall(mrb, mrb_obj_value(mrb->array_class), "new", 0);
+	{
+		mrb_int __tmp_4 = 3;
+
+		if ( mrb_bool(hpc_ary_inplace_p_2(1, a, mrb_fixnum_value(0), mrb_fixnum_value(3))) )
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 3;
+			mrb_int __i_first = __i;
+#pragma omp parallel for if (hpc_ary_writable(a, __i_first, __i_last))
+			for (__i = __i_first; __i < __i_last; ++__i) {
+				mrb_int i = __i;
+				hpc_ary_fset(a, i, (((mrb_float)i) + 1.0));
+			}
+		}
+		else		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 3;
+			mrb_int __i_first = __i;
+#pragma omp parallel for if (hpc_ary_writable(a, __i_first, __i_last))
+			for (__i = __i_first; __i < __i_last; ++__i) {
+				mrb_int i = __i;
+				hpc_ary_aset_2(1, a, mrb_fixnum_value(i), mrb_float_value((((mrb_float)i) + 1.0)));
+			}
+		}
+	}
+	puts_1(0, __self__, hpc_ary_vref(scale__c7(__self__, a, 3, 2.0, 0.5), 2));
+	puts_1(0, __self__, poly__c8(__self__, 3));
+	puts_1(0, __self__, mrb_float_value(poly__c9(__self__, 1.5)));
+	HPC_FRAME_POP(__frame1);
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+	if (c == (struct RClass *)mrb_obj_ptr(Vec)) {
+		cVec *sval;
+		Data_Make_Struct(mrb, c, cVec, &hpc_data_type, sval, data);
+		sval->type = T_Vec;
+		obj = mrb_obj_value(data);
+		Vec_initialize(obj, arg0, arg1, arg2);
+} else {
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+void
+Vec_init(mrb_value __self__)
+{
+}
+
+static mrb_value
+Vec_norm2(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	{
+		double __tmp_6 = ((cVec *)DATA_PTR(__self__))->z;
+		double __tmp_7 = ((cVec *)DATA_PTR(__self__))->y;
+		double __tmp_8 = ((cVec *)DATA_PTR(__self__))->x;
+
+		return mrb_float_value((((__tmp_8 * __tmp_8) + (__tmp_7 * __tmp_7)) + (__tmp_6 * __tmp_6)));
+	}
+}
+
+static mrb_value
+Vec_vcross(mrb_value __self__, mrb_value b)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return mrb_funcall(mrb, Vec, "new", 3, num_sub_1(1, num_mul_1(1, mrb_float_value(data->y), z_0(1, b)), num_mul_1(1, mrb_float_value(data->z), y_0(1, b))), num_sub_1(1, num_mul_1(1, mrb_float_value(data->z), x_0(1, b)), num_mul_1(1, mrb_float_value(data->x), z_0(1, b))), num_sub_1(1, num_mul_1(1, mrb_float_value(data->x), y_0(1, b)), num_mul_1(1, mrb_float_value(data->y), x_0(1, b))));
+}
+
+static mrb_value
+Vec_z(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return mrb_float_value(data->z);
+}
+
+static mrb_value
+Vec_y(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return mrb_float_value(data->y);
+}
+
+static mrb_value
+Vec_x(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return mrb_float_value(data->x);
+}
+
+static mrb_value
+Vec_initialize(mrb_value __self__, mrb_value x, mrb_value y, mrb_value z)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->x = hpc_to_float(x);
+	data->y = hpc_to_float(y);
+	data->z = hpc_to_float(z);
+	return mrb_float_value(data->z);
+}
+
+static double
+Vec_norm2__c6(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	{
+		double __tmp_9 = ((cVec *)DATA_PTR(__self__))->z;
+		double __tmp_10 = ((cVec *)DATA_PTR(__self__))->y;
+		double __tmp_11 = ((cVec *)DATA_PTR(__self__))->x;
+
+		return (((__tmp_11 * __tmp_11) + (__tmp_10 * __tmp_10)) + (__tmp_9 * __tmp_9));
+	}
+}
+
+static mrb_value
+Vec_vcross__c5(mrb_value __self__, mrb_value b)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	{
+		double __tmp_12 = ((cVec *)DATA_PTR(b))->x;
+		double __tmp_13 = ((cVec *)DATA_PTR(b))->y;
+		double __tmp_14 = ((cVec *)DATA_PTR(b))->z;
+
+		return Vec_new__c4(Vec, ((data->y * __tmp_14) - (data->z * __tmp_13)), ((data->z * __tmp_12) - (data->x * __tmp_14)), ((data->x * __tmp_13) - (data->y * __tmp_12)));
+	}
+}
+
+static double
+Vec_initialize__c4(mrb_value __self__, double x, double y, double z)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->x = x;
+	data->y = y;
+	data->z = z;
+	return data->z;
+}
+
+static mrb_value
+Vec_new__c4(mrb_value __self__, double x, double y, double z)
+{
+	mrb_value obj;
+	struct RData * data;
+	cVec *sval;
+	Data_Make_Struct(mrb, mrb_class_ptr(__self__), cVec, &hpc_data_type, sval, data);
+	sval->type = T_Vec;
+	obj = mrb_obj_value(data);
+	Vec_initialize__c4(obj, x, y, z);
+	return obj;
+}
+
+static double
+Vec_z__c3(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->z;
+}
+
+static double
+Vec_y__c2(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->y;
+}
+
+static double
+Vec_x__c1(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->x;
+}
+
+static mrb_value
+poly(mrb_value __self__, mrb_value x)
+{
+	mrb_value y = mrb_nil_value();
+	mrb_value *__roots2[] = { &y };
+	HPC_FRAME_PUSH(__frame2, __roots2);
+
+	y = x;
+	{
+		mrb_value __ret = num_mul_1(1, num_add_1(1, num_mul_1(1, y, y), mrb_fixnum_value(1)), num_add_1(1, num_mul_1(1, y, y), mrb_fixnum_value(1)));
+		HPC_FRAME_POP(__frame2);
+		return __ret;
+	}
+}
+
+static mrb_value
+scale(mrb_value __self__, mrb_value a, mrb_value n, mrb_value s, mrb_value t)
+{
+	{
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = mrb_fixnum(n);
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				hpc_ary_aset_2(0, a, mrb_fixnum_value(i), num_add_1(1, num_mul_1(1, hpc_ary_aget_1(1, a, mrb_fixnum_value(i)), num_mul_1(1, s, t)), n));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	return a;
+}
+
+static double
+poly__c9(mrb_value __self__, double x)
+{
+	double y;
+
+	y = x;
+	{
+		double __tmp_15 = ((y * y) + ((mrb_float)1));
+
+		return (__tmp_15 * __tmp_15);
+	}
+}
+
+static mrb_value
+poly__c8(mrb_value __self__, mrb_int x)
+{
+	mrb_int y;
+
+	y = x;
+	{
+		mrb_value __tmp_16 = num_add_1(1, hpc_int_mul(y, y), mrb_fixnum_value(1));
+
+		return num_mul_1(1, __tmp_16, __tmp_16);
+	}
+}
+
+static mrb_value
+scale__c7(mrb_value __self__, mrb_value a, mrb_int n, double s, double t)
+{
+	{
+		if ( mrb_bool(hpc_ary_float_p_2(1, a, mrb_fixnum_value(0), mrb_fixnum_value(n))) )
+		{
+			double __tmp_17 = (s * t);
+
+			{
+				mrb_int __i = 0;
+				mrb_int __i_last = n;
+				mrb_int __i_first = __i;
+#pragma omp parallel for if (hpc_ary_writable(a, __i_first, __i_last))
+				for (__i = __i_first; __i < __i_last; ++__i) {
+					mrb_int i = __i;
+					hpc_ary_fset(a, i, ((hpc_ary_fref(a, i) * __tmp_17) + ((mrb_float)n)));
+				}
+			}
+		}
+		else		{
+			double __tmp_18 = (s * t);
+
+			{
+				mrb_int __i = 0;
+				mrb_int __i_last = n;
+				for (; __i < __i_last; ++__i) {
+					int ai = mrb_gc_arena_save(mrb);
+					mrb_int i = __i;
+					hpc_ary_aset_2(0, a, mrb_fixnum_value(i), num_add_1(1, num_mul_1(1, hpc_ary_vref(a, i), mrb_float_value(__tmp_18)), mrb_fixnum_value(n)));
+					mrb_gc_arena_restore(mrb, ai);
+				}
+			}
+		}
+	}
+	return a;
+}
+
+mrb_value
+scale_4(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2, mrb_value arg3)
+{
+	return scale(__self__, arg0, arg1, arg2, arg3);
+}mrb_value
+poly_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	return poly(__self__, arg0);
+}mrb_value
+x_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Vec:
+			result = Vec_x(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "x", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+y_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Vec:
+			result = Vec_y(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "y", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+z_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Vec:
+			result = Vec_z(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "z", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+vcross_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Vec:
+			result = Vec_vcross(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "vcross", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+norm2_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Vec:
+			result = Vec_norm2(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "norm2", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
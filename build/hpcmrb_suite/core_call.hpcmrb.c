@@ -0,0 +1,249 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+mrb_value
+square_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+class_of_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+size_of_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+shout_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+between_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);
+
+static mrb_value
+between(mrb_value __self__, mrb_value x, mrb_value lo, mrb_value hi);
+static mrb_value
+shout(mrb_value __self__, mrb_value s);
+static mrb_value
+size_of(mrb_value __self__, mrb_value s);
+static mrb_value
+class_of(mrb_value __self__, mrb_value a);
+static mrb_value
+square(mrb_value __self__, mrb_value x);
+static mrb_value
+between__c7(mrb_value __self__, mrb_int x, mrb_int lo, mrb_int hi);
+static mrb_value
+shout__c6(mrb_value __self__, mrb_value s);
+static mrb_value
+size_of__c5(mrb_value __self__, mrb_value s);
+static mrb_value
+class_of__c4(mrb_value __self__, double a);
+static mrb_value
+class_of__c3(mrb_value __self__, mrb_int a);
+static mrb_value
+square__c2(mrb_value __self__, double x);
+static mrb_value
+square__c1(mrb_value __self__, mrb_int x);
+
+void
+init_global_syms(mrb_state * mrb)
+{
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { NULL };
+	puts_1(0, __self__, square__c1(__self__, 7));
+	puts_1(0, __self__, square__c2(__self__, 1.5));
+	puts_1(0, __self__, class_of__c3(__self__, 1));
+	puts_1(0, __self__, class_of__c4(__self__, 2.5));
+	puts_1(0, __self__, size_of__c5(__self__, mrb_str_new(mrb, "hello", 5)));
+	puts_1(0, __self__, shout__c6(__self__, mrb_str_new(mrb, "hpc", 3)));
+	puts_1(0, __self__, between__c7(__self__, 3, 1, 5));
+	puts_1(0, __self__, between__c7(__self__, 9, 1, 5));
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+static mrb_value
+between(mrb_value __self__, mrb_value x, mrb_value lo, mrb_value hi)
+{
+	return mrb_funcall(mrb, x, "between?", 2, lo, hi);
+}
+
+static mrb_value
+shout(mrb_value __self__, mrb_value s)
+{
+	return mrb_funcall(mrb, s, "upcase", 0);
+}
+
+static mrb_value
+size_of(mrb_value __self__, mrb_value s)
+{
+	return mrb_funcall(mrb, s, "length", 0);
+}
+
+static mrb_value
+class_of(mrb_value __self__, mrb_value a)
+{
+	return mrb_funcall(mrb, a, "class", 0);
+}
+
+static mrb_value
+square(mrb_value __self__, mrb_value x)
+{
+	return mrb_funcall(mrb, x, "**", 1, mrb_fixnum_value(2));
+}
+
+static mrb_value
+between__c7(mrb_value __self__, mrb_int x, mrb_int lo, mrb_int hi)
+{
+	return mrb_funcall(mrb, mrb_fixnum_value(x), "between?", 2, mrb_fixnum_value(lo), mrb_fixnum_value(hi));
+}
+
+static mrb_value
+shout__c6(mrb_value __self__, mrb_value s)
+{
+	return mrb_funcall(mrb, s, "upcase", 0);
+}
+
+static mrb_value
+size_of__c5(mrb_value __self__, mrb_value s)
+{
+	return mrb_funcall(mrb, s, "length", 0);
+}
+
+static mrb_value
+class_of__c4(mrb_value __self__, double a)
+{
+	return mrb_funcall(mrb, mrb_float_value(a), "class", 0);
+}
+
+static mrb_value
+class_of__c3(mrb_value __self__, mrb_int a)
+{
+	return mrb_funcall(mrb, mrb_fixnum_value(a), "class", 0);
+}
+
+static mrb_value
+square__c2(mrb_value __self__, double x)
+{
+	return mrb_funcall(mrb, mrb_float_value(x), "**", 1, mrb_fixnum_value(2));
+}
+
+static mrb_value
+square__c1(mrb_value __self__, mrb_int x)
+{
+	return mrb_funcall(mrb, mrb_fixnum_value(x), "**", 1, mrb_fixnum_value(2));
+}
+
+mrb_value
+square_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	return square(__self__, arg0);
+}mrb_value
+class_of_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	return class_of(__self__, arg0);
+}mrb_value
+size_of_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	return size_of(__self__, arg0);
+}mrb_value
+shout_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	return shout(__self__, arg0);
+}mrb_value
+between_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	return between(__self__, arg0, arg1, arg2);
+}
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
@@ -0,0 +1,387 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+#define T_Shapes 1001
+typedef struct {
+	int type;
+} cShapes;
+
+#define T_Circle 1002
+typedef struct {
+	int type;
+	double r;
+} cCircle;
+
+#define T_Square 1003
+typedef struct {
+	int type;
+	double a;
+} cSquare;
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+mrb_value
+scale_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+area_0(int val, mrb_value __self__);
+
+static mrb_value
+Shapes_area(mrb_value __self__);
+static double
+Shapes_area__c3(mrb_value __self__);
+static mrb_value
+Circle_scale(mrb_value __self__, mrb_value k);
+static mrb_value
+Circle_area(mrb_value __self__);
+static mrb_value
+Circle_initialize(mrb_value __self__, mrb_value r);
+static double
+Circle_initialize__c2(mrb_value __self__, double r);
+static mrb_value
+Circle_new__c2(mrb_value __self__, double r);
+static mrb_value
+Square_scale(mrb_value __self__, mrb_value k);
+static mrb_value
+Square_area(mrb_value __self__);
+static mrb_value
+Square_initialize(mrb_value __self__, mrb_value a);
+static double
+Square_initialize__c1(mrb_value __self__, double a);
+static mrb_value
+Square_new__c1(mrb_value __self__, double a);
+mrb_sym __i_r;
+mrb_sym __i_a;
+
+void
+init_global_syms(mrb_state * mrb)
+{
+	__i_r = mrb_intern(mrb, "r");
+	__i_a = mrb_intern(mrb, "a");
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void Shapes_init(mrb_value __self__);
+void Circle_init(mrb_value __self__);
+void Square_init(mrb_value __self__);
+mrb_value Square;
+mrb_value Circle;
+mrb_value Shapes;
+void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { &Square, &Circle, &Shapes };
+	static mrb_shadow_frame __global_frame;
+	__global_frame.prev = mrb->shadow_frames;
+	__global_frame.len = sizeof(__global_roots) / sizeof(__global_roots[0]);
+	__global_frame.roots = __global_roots;
+	mrb->shadow_frames = &__global_frame;
+	mrb_value shapes = mrb_nil_value();
+	mrb_value total = mrb_nil_value();
+	mrb_value *__roots1[] = { &shapes, &total };
+	HPC_FRAME_PUSH(__frame1, __roots1);
+
+	Square = mrb_obj_value(mrb_define_class(mrb, "Square", mrb->object_class));
+	Square_init(Square);
+	Circle = mrb_obj_value(mrb_define_class(mrb, "Circle", mrb->object_class));
+	Circle_init(Circle);
+	Shapes = mrb_obj_value(mrb_define_class(mrb, "Shapes", mrb->object_class));
+	Shapes_init(Shapes);
+	shapes = mrb_funcall(mrb, mrb_obj_value(mrb->array_class), "new", 0);
+	hpc_ary_aset_2(0, shapes, mrb_fixnum_value(0), Square_new__c1(Square, 2.0));
+	hpc_ary_aset_2(0, shapes, mrb_fixnum_value(1), Circle_new__c2(Circle, 1.0));
+	hpc_ary_aset_2(0, shapes, mrb_fixnum_value(2), Square_new__c1(Square, 3.0));
+	total = mrb_float_value(0.0);
+	{
+		mrb_int __tmp_1 = 3;
+
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 3;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				total = num_add_1(1, num_add_1(1, total, area_0(1, hpc_ary_vref(shapes, i))), area_0(1, scale_1(1, hpc_ary_vref(shapes, i), mrb_float_value(2.0))));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	puts_1(0, __self__, total);
+	puts_1(0, __self__, mrb_float_value(Shapes_area__c3(Shapes)));
+	HPC_FRAME_POP(__frame1);
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+	if (c == (struct RClass *)mrb_obj_ptr(Square)) {
+		cSquare *sval;
+		Data_Make_Struct(mrb, c, cSquare, &hpc_data_type, sval, data);
+		sval->type = T_Square;
+		obj = mrb_obj_value(data);
+		Square_initialize(obj, arg0);
+} else 	if (c == (struct RClass *)mrb_obj_ptr(Circle)) {
+		cCircle *sval;
+		Data_Make_Struct(mrb, c, cCircle, &hpc_data_type, sval, data);
+		sval->type = T_Circle;
+		obj = mrb_obj_value(data);
+		Circle_initialize(obj, arg0);
+} else {
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+void
+Shapes_init(mrb_value __self__)
+{
+}
+
+void
+Circle_init(mrb_value __self__)
+{
+}
+
+void
+Square_init(mrb_value __self__)
+{
+}
+
+static mrb_value
+Shapes_area(mrb_value __self__)
+{
+	return mrb_float_value(0.0);
+}
+
+static double
+Shapes_area__c3(mrb_value __self__)
+{
+	return 0.0;
+}
+
+static mrb_value
+Circle_scale(mrb_value __self__, mrb_value k)
+{
+	cCircle *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return Circle_new__c2(Circle, (data->r * mrb_float(k)));
+}
+
+static mrb_value
+Circle_area(mrb_value __self__)
+{
+	cCircle *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return mrb_float_value(((3.0 * data->r) * data->r));
+}
+
+static mrb_value
+Circle_initialize(mrb_value __self__, mrb_value r)
+{
+	cCircle *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->r = hpc_to_float(r);
+	return mrb_float_value(data->r);
+}
+
+static double
+Circle_initialize__c2(mrb_value __self__, double r)
+{
+	cCircle *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->r = r;
+	return data->r;
+}
+
+static mrb_value
+Circle_new__c2(mrb_value __self__, double r)
+{
+	mrb_value obj;
+	struct RData * data;
+	cCircle *sval;
+	Data_Make_Struct(mrb, mrb_class_ptr(__self__), cCircle, &hpc_data_type, sval, data);
+	sval->type = T_Circle;
+	obj = mrb_obj_value(data);
+	Circle_initialize__c2(obj, r);
+	return obj;
+}
+
+static mrb_value
+Square_scale(mrb_value __self__, mrb_value k)
+{
+	cSquare *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return Square_new__c1(Square, (data->a * mrb_float(k)));
+}
+
+static mrb_value
+Square_area(mrb_value __self__)
+{
+	cSquare *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return mrb_float_value((data->a * data->a));
+}
+
+static mrb_value
+Square_initialize(mrb_value __self__, mrb_value a)
+{
+	cSquare *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->a = hpc_to_float(a);
+	return mrb_float_value(data->a);
+}
+
+static double
+Square_initialize__c1(mrb_value __self__, double a)
+{
+	cSquare *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->a = a;
+	return data->a;
+}
+
+static mrb_value
+Square_new__c1(mrb_value __self__, double a)
+{
+	mrb_value obj;
+	struct RData * data;
+	cSquare *sval;
+	Data_Make_Struct(mrb, mrb_class_ptr(__self__), cSquare, &hpc_data_type, sval, data);
+	sval->type = T_Square;
+	obj = mrb_obj_value(data);
+	Square_initialize__c1(obj, a);
+	return obj;
+}
+
+mrb_value
+scale_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Square:
+			result = Square_scale(__self__, arg0);
+			break;
+		case T_Circle:
+			result = Circle_scale(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "scale", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+area_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+	if (hpc_class_eq(__self__, Shapes)) {
+		result = Shapes_area(__self__);
+	} else {
+		switch (hpc_type_of(__self__)) {
+		case T_Square:
+			result = Square_area(__self__);
+			break;
+		case T_Circle:
+			result = Circle_area(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "area", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
@@ -0,0 +1,152 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+mrb_value
+fib_1(int val, mrb_value __self__, mrb_value arg0);
+
+static mrb_value
+fib(mrb_value __self__, mrb_value n);
+static mrb_value
+fib__c1(mrb_value __self__, mrb_value n);
+static mrb_value
+fib__c2(mrb_value __self__, mrb_int n);
+
+void
+init_global_syms(mrb_state * mrb)
+{
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { NULL };
+	puts_1(0, __self__, fib__c2(__self__, 39));
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+static mrb_value
+fib(mrb_value __self__, mrb_value n)
+{
+	if ( hpc_to_float(n) < ((mrb_float)2) )
+	return n;
+	return num_add_1(1, fib_1(1, __self__, num_sub_1(1, n, mrb_fixnum_value(2))), fib_1(1, __self__, num_sub_1(1, n, mrb_fixnum_value(1))));
+}
+
+static mrb_value
+fib__c1(mrb_value __self__, mrb_value n)
+{
+	if ( hpc_to_float(n) < ((mrb_float)2) )
+	return n;
+	return num_add_1(1, fib_1(1, __self__, num_sub_1(1, n, mrb_fixnum_value(2))), fib_1(1, __self__, num_sub_1(1, n, mrb_fixnum_value(1))));
+}
+
+static mrb_value
+fib__c2(mrb_value __self__, mrb_int n)
+{
+	if ( n < 2 )
+	return mrb_fixnum_value(n);
+	return num_add_1(1, fib__c1(__self__, hpc_int_sub(n, 2)), fib__c1(__self__, hpc_int_sub(n, 1)));
+}
+
+mrb_value
+fib_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	return fib(__self__, arg0);
+}
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
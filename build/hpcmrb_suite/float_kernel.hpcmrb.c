@@ -0,0 +1,269 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+
+
+void
+init_global_syms(mrb_state * mrb)
+{
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { NULL };
+	mrb_int n;
+	mrb_value x = mrb_nil_value();
+	mrb_value y = mrb_nil_value();
+	double a;
+	mrb_value s = mrb_nil_value();
+	mrb_value z = mrb_nil_value();
+	mrb_value *__roots1[] = { &x, &y, &s, &z };
+	HPC_FRAME_PUSH(__frame1, __roots1);
+
+	n = 100;
+	x = mrb_funcall(mrb, mrb_obj_value(mrb->array_class), "new", 1, mrb_fixnum_value(100));
+	y = mrb_funcall(mrb, mrb_obj_value(mrb->array_class), "new", 1, mrb_fixnum_value(100));
+	{
+		mrb_int __tmp_0 = 100;
+
+		if ( mrb_bool(( (mrb_bool(hpc_ary_inplace_p_2(1, y, mrb_fixnum_value(0), mrb_fixnum_value(100)))) ? hpc_ary_inplace_p_2(1, x, mrb_fixnum_value(0), mrb_fixnum_value(100)) : mrb_false_value() )) )
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 100;
+			mrb_int __i_first = __i;
+#pragma omp parallel for if (hpc_ary_writable(y, __i_first, __i_last) && hpc_ary_writable(x, __i_first, __i_last))
+			for (__i = __i_first; __i < __i_last; ++__i) {
+				mrb_int i = __i;
+				hpc_ary_fset(x, i, (((mrb_float)i) * 0.25));
+				hpc_ary_fset(y, i, (1.0 - (((mrb_float)i) * 0.5)));
+			}
+		}
+		else		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 100;
+			mrb_int __i_first = __i;
+#pragma omp parallel for if (hpc_ary_writable(y, __i_first, __i_last) && hpc_ary_writable(x, __i_first, __i_last))
+			for (__i = __i_first; __i < __i_last; ++__i) {
+				mrb_int i = __i;
+				hpc_ary_aset_2(1, x, mrb_fixnum_value(i), mrb_float_value((((mrb_float)i) * 0.25)));
+				hpc_ary_aset_2(1, y, mrb_fixnum_value(i), mrb_float_value((1.0 - (((mrb_float)i) * 0.5))));
+			}
+		}
+	}
+	a = 2.5;
+	{
+		mrb_int __tmp_1 = 100;
+
+		if ( mrb_bool(( (mrb_bool(hpc_ary_float_p_2(1, x, mrb_fixnum_value(0), mrb_fixnum_value(100)))) ? hpc_ary_float_p_2(1, y, mrb_fixnum_value(0), mrb_fixnum_value(100)) : mrb_false_value() )) )
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 100;
+			mrb_int __i_first = __i;
+#pragma omp parallel for if (hpc_ary_writable(y, __i_first, __i_last))
+			for (__i = __i_first; __i < __i_last; ++__i) {
+				mrb_int i = __i;
+				hpc_ary_fset(y, i, ((2.5 * hpc_ary_fref(x, i)) + hpc_ary_fref(y, i)));
+			}
+		}
+		else		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 100;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				hpc_ary_aset_2(0, y, mrb_fixnum_value(i), num_add_1(1, num_mul_1(1, mrb_float_value(2.5), hpc_ary_vref(x, i)), hpc_ary_vref(y, i)));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	puts_1(0, __self__, hpc_ary_vref(y, 0));
+	puts_1(0, __self__, hpc_ary_vref(y, 99));
+	s = mrb_float_value(0.0);
+	{
+		mrb_int __tmp_2 = 0;
+		mrb_int __tmp_3 = (99 + 1);
+
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = __tmp_3;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				s = num_add_1(1, s, num_mul_1(1, hpc_ary_vref(x, i), hpc_ary_vref(y, i)));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	puts_1(0, __self__, s);
+	hpc_ary_aset_2(0, x, mrb_fixnum_value(50), mrb_fixnum_value(1));
+	{
+		mrb_int __tmp_4 = 100;
+
+		if ( mrb_bool(( (mrb_bool(hpc_ary_float_p_2(1, x, mrb_fixnum_value(0), mrb_fixnum_value(100)))) ? hpc_ary_inplace_p_2(1, y, mrb_fixnum_value(0), mrb_fixnum_value(100)) : mrb_false_value() )) )
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 100;
+			mrb_int __i_first = __i;
+#pragma omp parallel for if (hpc_ary_writable(y, __i_first, __i_last))
+			for (__i = __i_first; __i < __i_last; ++__i) {
+				mrb_int i = __i;
+				hpc_ary_fset(y, i, (hpc_ary_fref(x, i) * ((mrb_float)2)));
+			}
+		}
+		else		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 100;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				hpc_ary_aset_2(0, y, mrb_fixnum_value(i), num_mul_1(1, hpc_ary_vref(x, i), mrb_fixnum_value(2)));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	puts_1(0, __self__, hpc_ary_vref(y, 49));
+	puts_1(0, __self__, hpc_ary_vref(y, 50));
+	z = mrb_funcall(mrb, mrb_obj_value(mrb->array_class), "new", 1, mrb_fixnum_value(100));
+	{
+		mrb_int __tmp_5 = 100;
+
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 100;
+			mrb_int __i_first = __i;
+#pragma omp parallel for if (hpc_ary_writable(z, __i_first, __i_last))
+			for (__i = __i_first; __i < __i_last; ++__i) {
+				mrb_int i = __i;
+				hpc_ary_aset_2(1, z, mrb_fixnum_value(i), mrb_fixnum_value(i));
+			}
+		}
+	}
+	{
+		mrb_int __tmp_6 = 100;
+
+		if ( mrb_bool(( (mrb_bool(hpc_ary_float_p_2(1, z, mrb_fixnum_value(0), mrb_fixnum_value(100)))) ? hpc_ary_float_p_2(1, y, mrb_fixnum_value(0), mrb_fixnum_value(100)) : mrb_false_value() )) )
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 100;
+			mrb_int __i_first = __i;
+#pragma omp parallel for if (hpc_ary_writable(y, __i_first, __i_last))
+			for (__i = __i_first; __i < __i_last; ++__i) {
+				mrb_int i = __i;
+				hpc_ary_fset(y, i, (hpc_ary_fref(y, i) + hpc_ary_fref(z, i)));
+			}
+		}
+		else		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 100;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				hpc_ary_aset_2(0, y, mrb_fixnum_value(i), num_add_1(1, hpc_ary_vref(y, i), hpc_ary_vref(z, i)));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	puts_1(0, __self__, hpc_ary_vref(y, 99));
+	HPC_FRAME_POP(__frame1);
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
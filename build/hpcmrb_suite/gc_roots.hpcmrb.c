@@ -0,0 +1,617 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+#define T_Chain 1001
+typedef struct {
+	int type;
+	mrb_value head;
+} cChain;
+
+#define T_Node 1002
+typedef struct {
+	int type;
+	mrb_value nxt;
+	mrb_value v;
+} cNode;
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	case T_Chain:
+		mrb_gc_mark_value(mrb, ((cChain *)p)->head);
+		break;
+	case T_Node:
+		mrb_gc_mark_value(mrb, ((cNode *)p)->nxt);
+		mrb_gc_mark_value(mrb, ((cNode *)p)->v);
+		break;
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+mrb_value
+names_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+v_0(int val, mrb_value __self__);
+mrb_value
+nxt_0(int val, mrb_value __self__);
+mrb_value
+build_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+total_1(int val, mrb_value __self__, mrb_value arg0);
+
+static mrb_value
+Chain_total(mrb_value __self__, mrb_value n);
+static mrb_value
+Chain_build(mrb_value __self__, mrb_value n);
+static mrb_value
+Chain_initialize(mrb_value __self__);
+static mrb_value
+Chain_total__c9(mrb_value __self__, mrb_int n);
+static mrb_int
+Chain_build__c7(mrb_value __self__, mrb_int n);
+static mrb_value
+Chain_initialize__c6(mrb_value __self__);
+static mrb_value
+Chain_new__c6(mrb_value __self__);
+static mrb_value
+Node_total(mrb_value __self__, mrb_value k);
+static mrb_value
+Node_nxt(mrb_value __self__);
+static mrb_value
+Node_v(mrb_value __self__);
+static mrb_value
+Node_initialize(mrb_value __self__, mrb_value v, mrb_value nxt);
+static mrb_value
+Node_total__c8(mrb_value __self__, mrb_int k);
+static mrb_value
+Node_initialize__c4(mrb_value __self__, mrb_value v, mrb_value nxt);
+static mrb_value
+Node_new__c4(mrb_value __self__, mrb_value v, mrb_value nxt);
+static mrb_value
+Node_total__c3(mrb_value __self__, mrb_value k);
+static mrb_value
+Node_initialize__c2(mrb_value __self__, mrb_value v, mrb_value nxt);
+static mrb_value
+Node_new__c2(mrb_value __self__, mrb_value v, mrb_value nxt);
+static mrb_value
+Node_initialize__c1(mrb_value __self__, mrb_value v, mrb_int nxt);
+static mrb_value
+Node_new__c1(mrb_value __self__, mrb_value v, mrb_int nxt);
+static mrb_value
+names(mrb_value __self__, mrb_value n);
+static mrb_int
+names__c5(mrb_value __self__, mrb_int n);
+mrb_sym __i_head;
+mrb_sym __i_nxt;
+mrb_sym __i_v;
+
+void
+init_global_syms(mrb_state * mrb)
+{
+	__i_head = mrb_intern(mrb, "head");
+	__i_nxt = mrb_intern(mrb, "nxt");
+	__i_v = mrb_intern(mrb, "v");
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void Chain_init(mrb_value __self__);
+void Node_init(mrb_value __self__);
+mrb_value Node;
+mrb_value Chain;
+mrb_value G_names;
+void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { &Node, &Chain, &G_names };
+	static mrb_shadow_frame __global_frame;
+	__global_frame.prev = mrb->shadow_frames;
+	__global_frame.len = sizeof(__global_roots) / sizeof(__global_roots[0]);
+	__global_frame.roots = __global_roots;
+	mrb->shadow_frames = &__global_frame;
+	mrb_value c = mrb_nil_value();
+	mrb_value *__roots1[] = { &c };
+	HPC_FRAME_PUSH(__frame1, __roots1);
+
+	Node = mrb_obj_value(mrb_define_class(mrb, "Node", mrb->object_class));
+	Node_init(Node);
+	Chain = mrb_obj_value(mrb_define_class(mrb, "Chain", mrb->object_class));
+	Chain_init(Chain);
+	names__c5(__self__, 3000);
+	c = Chain_new__c6(Chain);
+	Chain_build__c7(c, 5000);
+	puts_1(0, __self__, Chain_total__c9(c, 50));
+	puts_1(0, __self__, v_0(1, G_names));
+	puts_1(0, __self__, v_0(1, nxt_0(1, nxt_0(1, G_names))));
+	HPC_FRAME_POP(__frame1);
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+	if (c == (struct RClass *)mrb_obj_ptr(Chain)) {
+		cChain *sval;
+		Data_Make_Struct(mrb, c, cChain, &hpc_data_type, sval, data);
+		sval->type = T_Chain;
+		obj = mrb_obj_value(data);
+		Chain_initialize(obj);
+} else {
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+	if (c == (struct RClass *)mrb_obj_ptr(Node)) {
+		cNode *sval;
+		Data_Make_Struct(mrb, c, cNode, &hpc_data_type, sval, data);
+		sval->type = T_Node;
+		obj = mrb_obj_value(data);
+		Node_initialize(obj, arg0, arg1);
+} else {
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+void
+Chain_init(mrb_value __self__)
+{
+}
+
+void
+Node_init(mrb_value __self__)
+{
+}
+
+static mrb_value
+Chain_total(mrb_value __self__, mrb_value n)
+{
+	cChain *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return Node_total__c3(data->head, n);
+}
+
+static mrb_value
+Chain_build(mrb_value __self__, mrb_value n)
+{
+	cChain *data;
+	*(void**)&data = DATA_PTR(__self__);
+	{
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = mrb_fixnum(n);
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				data->head = Node_new__c2(Node, ({
+					mrb_value __s = mrb_str_buf_new(mrb, 22);
+					hpc_str_cat_int(__s, i);
+					mrb_str_cat(mrb, __s, "!", 1);
+					__s;
+				}), data->head);
+				mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->head);
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+		return n;
+	}
+}
+
+static mrb_value
+Chain_initialize(mrb_value __self__)
+{
+	cChain *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->head = Node_new__c1(Node, mrb_str_new(mrb, "", 0), 0);
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->head);
+	return data->head;
+}
+
+static mrb_value
+Chain_total__c9(mrb_value __self__, mrb_int n)
+{
+	cChain *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return Node_total__c8(data->head, n);
+}
+
+static mrb_int
+Chain_build__c7(mrb_value __self__, mrb_int n)
+{
+	cChain *data;
+	*(void**)&data = DATA_PTR(__self__);
+	{
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = n;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				data->head = Node_new__c2(Node, ({
+					mrb_value __s = mrb_str_buf_new(mrb, 22);
+					hpc_str_cat_int(__s, i);
+					mrb_str_cat(mrb, __s, "!", 1);
+					__s;
+				}), data->head);
+				mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->head);
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+		return n;
+	}
+}
+
+static mrb_value
+Chain_initialize__c6(mrb_value __self__)
+{
+	cChain *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->head = Node_new__c1(Node, mrb_str_new(mrb, "", 0), 0);
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->head);
+	return data->head;
+}
+
+static mrb_value
+Chain_new__c6(mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	cChain *sval;
+	Data_Make_Struct(mrb, mrb_class_ptr(__self__), cChain, &hpc_data_type, sval, data);
+	sval->type = T_Chain;
+	obj = mrb_obj_value(data);
+	Chain_initialize__c6(obj);
+	return obj;
+}
+
+static mrb_value
+Node_total(mrb_value __self__, mrb_value k)
+{
+	cNode *data;
+	*(void**)&data = DATA_PTR(__self__);
+	if ( hpc_to_float(k) == ((mrb_float)0) )
+	{
+		return data->v;
+	}
+	else	{
+		return num_add_1(1, data->v, total_1(1, data->nxt, num_sub_1(1, k, mrb_fixnum_value(1))));
+	}
+}
+
+static mrb_value
+Node_nxt(mrb_value __self__)
+{
+	cNode *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->nxt;
+}
+
+static mrb_value
+Node_v(mrb_value __self__)
+{
+	cNode *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->v;
+}
+
+static mrb_value
+Node_initialize(mrb_value __self__, mrb_value v, mrb_value nxt)
+{
+	cNode *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->v = v;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->v);
+	data->nxt = nxt;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->nxt);
+	return data->nxt;
+}
+
+static mrb_value
+Node_total__c8(mrb_value __self__, mrb_int k)
+{
+	cNode *data;
+	*(void**)&data = DATA_PTR(__self__);
+	if ( k == 0 )
+	{
+		return data->v;
+	}
+	else	{
+		return num_add_1(1, data->v, total_1(1, data->nxt, hpc_int_sub(k, 1)));
+	}
+}
+
+static mrb_value
+Node_initialize__c4(mrb_value __self__, mrb_value v, mrb_value nxt)
+{
+	cNode *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->v = v;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->v);
+	data->nxt = nxt;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->nxt);
+	return data->nxt;
+}
+
+static mrb_value
+Node_new__c4(mrb_value __self__, mrb_value v, mrb_value nxt)
+{
+	mrb_value obj;
+	struct RData * data;
+	cNode *sval;
+	Data_Make_Struct(mrb, mrb_class_ptr(__self__), cNode, &hpc_data_type, sval, data);
+	sval->type = T_Node;
+	obj = mrb_obj_value(data);
+	Node_initialize__c4(obj, v, nxt);
+	return obj;
+}
+
+static mrb_value
+Node_total__c3(mrb_value __self__, mrb_value k)
+{
+	cNode *data;
+	*(void**)&data = DATA_PTR(__self__);
+	if ( hpc_to_float(k) == ((mrb_float)0) )
+	{
+		return data->v;
+	}
+	else	{
+		return num_add_1(1, data->v, total_1(1, data->nxt, num_sub_1(1, k, mrb_fixnum_value(1))));
+	}
+}
+
+static mrb_value
+Node_initialize__c2(mrb_value __self__, mrb_value v, mrb_value nxt)
+{
+	cNode *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->v = v;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->v);
+	data->nxt = nxt;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->nxt);
+	return data->nxt;
+}
+
+static mrb_value
+Node_new__c2(mrb_value __self__, mrb_value v, mrb_value nxt)
+{
+	mrb_value obj;
+	struct RData * data;
+	cNode *sval;
+	Data_Make_Struct(mrb, mrb_class_ptr(__self__), cNode, &hpc_data_type, sval, data);
+	sval->type = T_Node;
+	obj = mrb_obj_value(data);
+	Node_initialize__c2(obj, v, nxt);
+	return obj;
+}
+
+static mrb_value
+Node_initialize__c1(mrb_value __self__, mrb_value v, mrb_int nxt)
+{
+	cNode *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->v = v;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->v);
+	data->nxt = mrb_fixnum_value(nxt);
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->nxt);
+	return data->nxt;
+}
+
+static mrb_value
+Node_new__c1(mrb_value __self__, mrb_value v, mrb_int nxt)
+{
+	mrb_value obj;
+	struct RData * data;
+	cNode *sval;
+	Data_Make_Struct(mrb, mrb_class_ptr(__self__), cNode, &hpc_data_type, sval, data);
+	sval->type = T_Node;
+	obj = mrb_obj_value(data);
+	Node_initialize__c1(obj, v, nxt);
+	return obj;
+}
+
+static mrb_value
+names(mrb_value __self__, mrb_value n)
+{
+	G_names = Node_new__c1(Node, mrb_str_new(mrb, "root", 4), 0);
+	{
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = mrb_fixnum(n);
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				G_names = Node_new__c4(Node, ({
+					mrb_value __s = mrb_str_buf_new(mrb, 22);
+					mrb_str_cat(mrb, __s, "n", 1);
+					hpc_str_cat_int(__s, i);
+					__s;
+				}), G_names);
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+		return n;
+	}
+}
+
+static mrb_int
+names__c5(mrb_value __self__, mrb_int n)
+{
+	G_names = Node_new__c1(Node, mrb_str_new(mrb, "root", 4), 0);
+	{
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = n;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				G_names = Node_new__c4(Node, ({
+					mrb_value __s = mrb_str_buf_new(mrb, 22);
+					mrb_str_cat(mrb, __s, "n", 1);
+					hpc_str_cat_int(__s, i);
+					__s;
+				}), G_names);
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+		return n;
+	}
+}
+
+mrb_value
+names_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	return names(__self__, arg0);
+}mrb_value
+v_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Node:
+			result = Node_v(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "v", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+nxt_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Node:
+			result = Node_nxt(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "nxt", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+build_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Chain:
+			result = Chain_build(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "build", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+total_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Node:
+			result = Node_total(__self__, arg0);
+			break;
+		case T_Chain:
+			result = Chain_total(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "total", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
@@ -0,0 +1,409 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "mruby/dump.h"
+#include "mruby/proc.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+mrb_value
+multi_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+maxi_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);
+mrb_value
+opt_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);
+mrb_value
+pick_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+sel_1(int val, mrb_value __self__, mrb_value arg0);
+
+static void
+hpc_vm_init(mrb_state *mrb);
+
+static mrb_value
+sel(mrb_value __self__, mrb_value a);
+static mrb_value
+pick(mrb_value __self__, mrb_value a);
+static mrb_value
+opt(mrb_value __self__, mrb_value a, mrb_value c);
+static mrb_value
+maxi(mrb_value __self__, mrb_value a, mrb_value b);
+static mrb_value
+sel__c5(mrb_value __self__, mrb_int a);
+static mrb_value
+pick__c4(mrb_value __self__, mrb_int a);
+static mrb_value
+opt__c3(mrb_value __self__, mrb_int a, mrb_value c);
+static mrb_value
+opt__c2(mrb_value __self__, mrb_int a, mrb_value c);
+static mrb_value
+maxi__c1(mrb_value __self__, mrb_int a, mrb_int b);
+
+void
+init_global_syms(mrb_state * mrb)
+{
+	hpc_vm_init(mrb);
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { NULL };
+	mrb_int x;
+	mrb_int y;
+
+	puts_1(0, __self__, maxi__c1(__self__, 3, 4));
+	puts_1(0, __self__, maxi__c1(__self__, 7, 1));
+	mrb_funcall(mrb, __self__, "p", 1, opt__c2(__self__, 3, mrb_true_value()));
+	mrb_funcall(mrb, __self__, "p", 1, opt__c3(__self__, 3, mrb_false_value()));
+	puts_1(0, __self__, pick__c4(__self__, 3));
+	puts_1(0, __self__, pick__c4(__self__, 1));
+	puts_1(0, __self__, sel__c5(__self__, 7));
+	puts_1(0, __self__, sel__c5(__self__, 2));
+	puts_1(0, __self__, sel__c5(__self__, (-1)));
+	x = 3;
+	y = mrb_fixnum(( (3 > 2) ? mrb_fixnum_value(1) : mrb_fixnum_value(2) ));
+	(hpc_output_int(y), hpc_output_write("\n", 1), mrb_nil_value());
+	puts_1(0, __self__, ( (3 > 5) ? mrb_str_new(mrb, "a", 1) : mrb_str_new(mrb, "b", 1) ));
+	puts_1(0, __self__, mrb_funcall(mrb, __self__, "multi", 1, mrb_fixnum_value(4)));
+	puts_1(0, __self__, mrb_funcall(mrb, __self__, "multi", 1, mrb_fixnum_value((-4))));
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+static mrb_value
+sel(mrb_value __self__, mrb_value a)
+{
+	mrb_value z = mrb_nil_value();
+	mrb_value *__roots1[] = { &z };
+	HPC_FRAME_PUSH(__frame1, __roots1);
+
+	z = ( (mrb_bool(num_gt_1(1, a, mrb_fixnum_value(0)))) ? ( (mrb_bool(num_gt_1(1, a, mrb_fixnum_value(5)))) ? mrb_str_new(mrb, "big", 3) : mrb_str_new(mrb, "small", 5) ) : mrb_str_new(mrb, "neg", 3) );
+	{
+		mrb_value __ret = z;
+		HPC_FRAME_POP(__frame1);
+		return __ret;
+	}
+}
+
+static mrb_value
+pick(mrb_value __self__, mrb_value a)
+{
+	mrb_value y = mrb_nil_value();
+	mrb_value *__roots2[] = { &y };
+	HPC_FRAME_PUSH(__frame2, __roots2);
+
+	y = ( (mrb_bool(num_gt_1(1, a, mrb_fixnum_value(2)))) ? num_mul_1(1, a, mrb_fixnum_value(3)) : num_add_1(1, a, mrb_float_value(0.5)) );
+	{
+		mrb_value __ret = y;
+		HPC_FRAME_POP(__frame2);
+		return __ret;
+	}
+}
+
+static mrb_value
+opt(mrb_value __self__, mrb_value a, mrb_value c)
+{
+	mrb_value x = mrb_nil_value();
+	mrb_value *__roots3[] = { &x };
+	HPC_FRAME_PUSH(__frame3, __roots3);
+
+	x = (( (mrb_bool(c)) ? a : mrb_nil_value() ));
+	{
+		mrb_value __ret = x;
+		HPC_FRAME_POP(__frame3);
+		return __ret;
+	}
+}
+
+static mrb_value
+maxi(mrb_value __self__, mrb_value a, mrb_value b)
+{
+	mrb_value x = mrb_nil_value();
+	mrb_value *__roots4[] = { &x };
+	HPC_FRAME_PUSH(__frame4, __roots4);
+
+	x = ( (mrb_bool(num_gt_1(1, a, b))) ? a : b );
+	{
+		mrb_value __ret = num_mul_1(1, x, mrb_fixnum_value(2));
+		HPC_FRAME_POP(__frame4);
+		return __ret;
+	}
+}
+
+static mrb_value
+sel__c5(mrb_value __self__, mrb_int a)
+{
+	mrb_value z = mrb_nil_value();
+	mrb_value *__roots5[] = { &z };
+	HPC_FRAME_PUSH(__frame5, __roots5);
+
+	z = ( (a > 0) ? ( (a > 5) ? mrb_str_new(mrb, "big", 3) : mrb_str_new(mrb, "small", 5) ) : mrb_str_new(mrb, "neg", 3) );
+	{
+		mrb_value __ret = z;
+		HPC_FRAME_POP(__frame5);
+		return __ret;
+	}
+}
+
+static mrb_value
+pick__c4(mrb_value __self__, mrb_int a)
+{
+	mrb_value y;
+
+	y = ( (a > 2) ? hpc_int_mul(a, 3) : mrb_float_value((((mrb_float)a) + 0.5)) );
+	return y;
+}
+
+static mrb_value
+opt__c3(mrb_value __self__, mrb_int a, mrb_value c)
+{
+	mrb_value x;
+
+	x = (( (mrb_bool(c)) ? mrb_fixnum_value(a) : mrb_nil_value() ));
+	return x;
+}
+
+static mrb_value
+opt__c2(mrb_value __self__, mrb_int a, mrb_value c)
+{
+	mrb_value x;
+
+	x = (( (mrb_bool(c)) ? mrb_fixnum_value(a) : mrb_nil_value() ));
+	return x;
+}
+
+static mrb_value
+maxi__c1(mrb_value __self__, mrb_int a, mrb_int b)
+{
+	mrb_int x;
+
+	x = mrb_fixnum(( (a > b) ? mrb_fixnum_value(a) : mrb_fixnum_value(b) ));
+	return hpc_int_mul(x, 2);
+}
+
+mrb_value
+multi_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		default:
+			result = mrb_funcall(mrb, __self__, "multi", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+maxi_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	return maxi(__self__, arg0, arg1);
+}mrb_value
+opt_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	return opt(__self__, arg0, arg1);
+}mrb_value
+pick_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	return pick(__self__, arg0);
+}mrb_value
+sel_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	return sel(__self__, arg0);
+}
+#include <stdint.h>
+const uint8_t hpc_vm_irep[] = {
+0x52,0x49,0x54,0x45,0x30,0x30,0x30,0x31,0xb9,0xae,0x00,0x00,0x01,0x74,0x4d,0x41,
+0x54,0x5a,0x30,0x30,0x30,0x30,0x49,0x52,0x45,0x50,0x00,0x00,0x00,0x9c,0x30,0x30,
+0x30,0x30,0x00,0x02,0x00,0xd8,0x00,0x00,0x00,0x30,0x00,0x01,0x00,0x02,0x00,0x00,
+0x00,0x05,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x80,
+0x00,0x05,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x05,
+0x6d,0x75,0x6c,0x74,0x69,0x00,0x00,0x00,0x00,0x5c,0x00,0x05,0x00,0x07,0x00,0x00,
+0x00,0x0f,0x02,0x00,0x00,0x26,0x02,0x80,0x40,0x01,0x03,0x3f,0xff,0x83,0x02,0x80,
+0x00,0xb5,0x02,0xc0,0x03,0x99,0x02,0x80,0x40,0x01,0x03,0x40,0x00,0x83,0x02,0x80,
+0x40,0xb0,0x02,0x01,0x40,0x01,0x02,0x81,0x00,0x01,0x02,0x80,0x80,0xad,0x00,0x40,
+0x00,0x97,0x02,0xbf,0xff,0x83,0x01,0x81,0x40,0x01,0x01,0x80,0x00,0x29,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x01,0x3e,0x00,0x00,0x01,0x2a,0x00,0x00,0x01,
+0x2b,0x00,0x4c,0x49,0x4e,0x45,0x00,0x00,0x00,0xba,0x00,0x02,0x00,0xd8,0x00,0x00,
+0x00,0x4d,0x00,0x39,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,
+0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x62,0x69,0x6e,
+0x2d,0x68,0x70,0x63,0x6d,0x72,0x62,0x2f,0x74,0x65,0x73,0x74,0x63,0x61,0x73,0x65,
+0x73,0x2f,0x69,0x66,0x5f,0x76,0x61,0x6c,0x75,0x65,0x2e,0x72,0x62,0x00,0x00,0x00,
+0x05,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x00,0x00,0x61,0x00,
+0x39,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,
+0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,
+0x63,0x6d,0x72,0x62,0x2f,0x74,0x65,0x73,0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x69,
+0x66,0x5f,0x76,0x61,0x6c,0x75,0x65,0x2e,0x72,0x62,0x00,0x00,0x00,0x0f,0x00,0x23,
+0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x1d,
+0x00,0x1e,0x00,0x1e,0x00,0x1e,0x00,0x20,0x00,0x20,0x00,0x22,0x45,0x4e,0x44,0x00,
+0x00,0x00,0x00,0x08,
+};
+
+static mrb_value
+sel__vm(mrb_state *mrb, mrb_value self)
+{
+	mrb_value *argv;
+	int argc;
+
+	mrb_get_args(mrb, "*", &argv, &argc);
+	if (argc != 1)
+		mrb_raisef(mrb, E_ARGUMENT_ERROR, "wrong number of arguments (%S for 1)", mrb_fixnum_value(argc));
+	return sel(self, argv[0]);
+}
+
+static mrb_value
+pick__vm(mrb_state *mrb, mrb_value self)
+{
+	mrb_value *argv;
+	int argc;
+
+	mrb_get_args(mrb, "*", &argv, &argc);
+	if (argc != 1)
+		mrb_raisef(mrb, E_ARGUMENT_ERROR, "wrong number of arguments (%S for 1)", mrb_fixnum_value(argc));
+	return pick(self, argv[0]);
+}
+
+static mrb_value
+opt__vm(mrb_state *mrb, mrb_value self)
+{
+	mrb_value *argv;
+	int argc;
+
+	mrb_get_args(mrb, "*", &argv, &argc);
+	if (argc != 2)
+		mrb_raisef(mrb, E_ARGUMENT_ERROR, "wrong number of arguments (%S for 2)", mrb_fixnum_value(argc));
+	return opt(self, argv[0], argv[1]);
+}
+
+static mrb_value
+maxi__vm(mrb_state *mrb, mrb_value self)
+{
+	mrb_value *argv;
+	int argc;
+
+	mrb_get_args(mrb, "*", &argv, &argc);
+	if (argc != 2)
+		mrb_raisef(mrb, E_ARGUMENT_ERROR, "wrong number of arguments (%S for 2)", mrb_fixnum_value(argc));
+	return maxi(self, argv[0], argv[1]);
+}
+
+static void
+hpc_vm_init(mrb_state *mrb)
+{
+	struct RClass *c;
+	size_t n = mrb->irep_len;
+
+	if (mrb_read_irep(mrb, hpc_vm_irep) < 0) {
+		fputs("cannot load the methods left to the VM\n", stderr);
+		exit(EXIT_FAILURE);
+	}
+	mrb_run(mrb, mrb_proc_new(mrb, mrb->irep[n]), mrb_top_self(mrb));
+	if (mrb->exc) {
+		mrb_p(mrb, mrb_obj_value(mrb->exc));
+		exit(EXIT_FAILURE);
+	}
+	c = mrb->object_class;
+	mrb_define_method(mrb, c, "sel", sel__vm, ARGS_ANY());
+	mrb_define_method(mrb, c, "pick", pick__vm, ARGS_ANY());
+	mrb_define_method(mrb, c, "opt", opt__vm, ARGS_ANY());
+	mrb_define_method(mrb, c, "maxi", maxi__vm, ARGS_ANY());
+}
+
+
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
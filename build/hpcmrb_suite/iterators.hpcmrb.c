@@ -0,0 +1,624 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+#define T_Grid 1001
+typedef struct {
+	int type;
+} cGrid;
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+mrb_value
+sum_upto_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+twice_0(int val, mrb_value __self__);
+mrb_value
+each_pair_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+each_cell_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);
+
+static mrb_value
+Grid_each_cell(mrb_value __self__, mrb_value w, mrb_value h);
+static mrb_value
+each_pair(mrb_value __self__, mrb_value n);
+static mrb_value
+twice(mrb_value __self__);
+static mrb_value
+sum_upto(mrb_value __self__, mrb_value n);
+static mrb_value
+sum_upto__c1(mrb_value __self__, mrb_int n);
+
+void
+init_global_syms(mrb_state * mrb)
+{
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void Grid_init(mrb_value __self__);
+mrb_value Grid;
+void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { &Grid };
+	static mrb_shadow_frame __global_frame;
+	__global_frame.prev = mrb->shadow_frames;
+	__global_frame.len = sizeof(__global_roots) / sizeof(__global_roots[0]);
+	__global_frame.roots = __global_roots;
+	mrb->shadow_frames = &__global_frame;
+	mrb_value t;
+	mrb_int x;
+	mrb_value a = mrb_nil_value();
+	mrb_value s = mrb_nil_value();
+	mrb_value b = mrb_nil_value();
+	mrb_int i;
+	mrb_value total;
+	mrb_value r;
+	mrb_value cells;
+	mrb_int v;
+	mrb_value *__roots1[] = { &a, &s, &b };
+	HPC_FRAME_PUSH(__frame1, __roots1);
+
+	puts_1(0, __self__, sum_upto__c1(__self__, 10));
+	t = mrb_fixnum_value(0);
+	{
+		mrb_int __tmp_6 = 3;
+
+		{
+			mrb_int ____tmp_7 = 0;
+			mrb_int ____tmp_7_last = 3;
+			for (; ____tmp_7 < ____tmp_7_last; ++____tmp_7) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int __tmp_7 = ____tmp_7;
+				t = num_add_1(1, t, mrb_fixnum_value(1));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	puts_1(0, __self__, t);
+	x = mrb_fixnum(({
+		mrb_int __tmp_8 = 5;
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 5;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				t = num_add_1(1, t, mrb_fixnum_value(i));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+		mrb_fixnum_value(5);
+	}));
+	(hpc_output_int(5), hpc_output_write("\n", 1), mrb_nil_value());
+	{
+		mrb_int __tmp_10 = 1;
+
+		{
+			mrb_int ____tmp_9 = 0;
+			mrb_int ____tmp_9_last = (((10 - 1) + 3) / 3);
+			for (; ____tmp_9 < ____tmp_9_last; ++____tmp_9) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int __tmp_9 = ____tmp_9;
+				mrb_int i = (1 + (__tmp_9 * 3));
+
+				(hpc_output_int(i), hpc_output_write("\n", 1), mrb_nil_value());
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	{
+		mrb_int __tmp_11 = 1;
+		double __tmp_12 = 2.0;
+		double __tmp_13 = 0.25;
+		double __tmp_14 = 1.0;
+
+		while (__tmp_14 <= 2.0) {
+			int ai = mrb_gc_arena_save(mrb);
+			{
+				{
+					double f = __tmp_14;
+
+					puts_1(0, __self__, mrb_float_value(f));
+				}
+				__tmp_14 = (__tmp_14 + 0.25);
+			}
+			mrb_gc_arena_restore(mrb, ai);
+		}
+	}
+	a = mrb_funcall(mrb, mrb_obj_value(mrb->array_class), "new", 0);
+	hpc_ary_aset_2(0, a, mrb_fixnum_value(0), mrb_fixnum_value(3));
+	hpc_ary_aset_2(0, a, mrb_fixnum_value(1), mrb_fixnum_value(4));
+	hpc_ary_aset_2(0, a, mrb_fixnum_value(2), mrb_fixnum_value(5));
+	s = mrb_fixnum_value(0);
+	{
+		mrb_value __tmp_15 = a;
+		mrb_int __tmp_16 = 0;
+		mrb_value *__roots2[] = { &__tmp_15 };
+		HPC_FRAME_PUSH(__frame2, __roots2);
+
+		while (__tmp_16 < mrb_fixnum(hpc_ary_len_0(1, __tmp_15))) {
+			int ai = mrb_gc_arena_save(mrb);
+			{
+				{
+					mrb_value e = hpc_ary_uref(__tmp_15, __tmp_16);
+					mrb_value *__roots3[] = { &e };
+					HPC_FRAME_PUSH(__frame3, __roots3);
+
+					s = num_add_1(1, s, e);
+					HPC_FRAME_POP(__frame3);
+				}
+				__tmp_16 = (__tmp_16 + 1);
+			}
+			mrb_gc_arena_restore(mrb, ai);
+		}
+		HPC_FRAME_POP(__frame2);
+	}
+	puts_1(0, __self__, s);
+	{
+		mrb_value __tmp_17 = a;
+		mrb_int __tmp_18 = 0;
+		mrb_value *__roots4[] = { &__tmp_17 };
+		HPC_FRAME_PUSH(__frame4, __roots4);
+
+		while (__tmp_18 < mrb_fixnum(hpc_ary_len_0(1, __tmp_17))) {
+			int ai = mrb_gc_arena_save(mrb);
+			{
+				{
+					mrb_value e = hpc_ary_uref(__tmp_17, __tmp_18);
+					mrb_int i = __tmp_18;
+					mrb_value *__roots5[] = { &e };
+					HPC_FRAME_PUSH(__frame5, __roots5);
+
+					puts_1(0, __self__, num_mul_1(1, e, mrb_fixnum_value(i)));
+					HPC_FRAME_POP(__frame5);
+				}
+				__tmp_18 = (__tmp_18 + 1);
+			}
+			mrb_gc_arena_restore(mrb, ai);
+		}
+		HPC_FRAME_POP(__frame4);
+	}
+	b = ({
+		mrb_value __tmp_19 = a;
+		mrb_int __tmp_20 = 0;
+		mrb_value __tmp_21 = hpc_ary_new_0(1, __tmp_19);
+		mrb_value *__roots6[] = { &__tmp_19, &__tmp_21 };
+		HPC_FRAME_PUSH(__frame6, __roots6);
+		while (__tmp_20 < mrb_fixnum(hpc_ary_len_0(1, __tmp_19))) {
+			int ai = mrb_gc_arena_save(mrb);
+			{
+				{
+					mrb_value e = hpc_ary_uref(__tmp_19, __tmp_20);
+					mrb_value *__roots7[] = { &e };
+					HPC_FRAME_PUSH(__frame7, __roots7);
+
+					hpc_ary_aset_2(0, __tmp_21, mrb_fixnum_value(__tmp_20), num_mul_1(1, e, mrb_fixnum_value(2)));
+					HPC_FRAME_POP(__frame7);
+				}
+				__tmp_20 = (__tmp_20 + 1);
+			}
+			mrb_gc_arena_restore(mrb, ai);
+		}
+		mrb_value __val6 = __tmp_21;
+		HPC_FRAME_POP(__frame6);
+		__val6;
+	});
+	puts_1(0, __self__, hpc_ary_vref(b, 2));
+	puts_1(0, __self__, hpc_ary_vref(({
+		mrb_value __tmp_22 = a;
+		mrb_int __tmp_23 = 0;
+		mrb_value __tmp_24 = hpc_ary_new_0(1, __tmp_22);
+		mrb_value *__roots8[] = { &__tmp_22, &__tmp_24 };
+		HPC_FRAME_PUSH(__frame8, __roots8);
+		while (__tmp_23 < mrb_fixnum(hpc_ary_len_0(1, __tmp_22))) {
+			int ai = mrb_gc_arena_save(mrb);
+			{
+				{
+					mrb_value e = hpc_ary_uref(__tmp_22, __tmp_23);
+					mrb_value *__roots9[] = { &e };
+					HPC_FRAME_PUSH(__frame9, __roots9);
+
+					hpc_ary_aset_2(0, __tmp_24, mrb_fixnum_value(__tmp_23), num_add_1(1, e, mrb_fixnum_value(1)));
+					HPC_FRAME_POP(__frame9);
+				}
+				__tmp_23 = (__tmp_23 + 1);
+			}
+			mrb_gc_arena_restore(mrb, ai);
+		}
+		mrb_value __val8 = __tmp_24;
+		HPC_FRAME_POP(__frame8);
+		__val8;
+	}), 0));
+	Grid = mrb_obj_value(mrb_define_class(mrb, "Grid", mrb->object_class));
+	Grid_init(Grid);
+	i = 100;
+	{
+		mrb_value __tmp_28 = mrb_nil_value();
+		mrb_value *__roots10[] = { &__tmp_28 };
+		HPC_FRAME_PUSH(__frame10, __roots10);
+
+		{
+			{
+				mrb_value __tmp_29__31 = mrb_nil_value();
+				mrb_value *__roots11[] = { &__tmp_29__31 };
+				HPC_FRAME_PUSH(__frame11, __roots11);
+
+				{
+					mrb_int x = 1;
+
+					__tmp_29__31 = (hpc_output_int(101), hpc_output_write("\n", 1), mrb_nil_value());
+				}
+				HPC_FRAME_POP(__frame11);
+			}
+			{
+				mrb_value __tmp_30__31 = mrb_nil_value();
+				mrb_value *__roots12[] = { &__tmp_30__31 };
+				HPC_FRAME_PUSH(__frame12, __roots12);
+
+				{
+					mrb_int x = 2;
+
+					__tmp_30__31 = (hpc_output_int(102), hpc_output_write("\n", 1), mrb_nil_value());
+				}
+				__tmp_28 = __tmp_30__31;
+				HPC_FRAME_POP(__frame12);
+			}
+		}
+		HPC_FRAME_POP(__frame10);
+	}
+	total = mrb_fixnum_value(0);
+	r = ({
+		mrb_value __tmp_32;
+		{
+			mrb_int n__39 = 4;
+			mrb_value i__39;
+
+			i__39 = mrb_fixnum_value(0);
+			{
+				{
+					mrb_int __k__39 = 0;
+					mrb_int __k__39_last = n__39;
+					for (; __k__39 < __k__39_last; ++__k__39) {
+						int ai = mrb_gc_arena_save(mrb);
+						mrb_int k__39 = __k__39;
+						i__39 = num_add_1(1, i__39, mrb_fixnum_value(k__39));
+						{
+							mrb_value __tmp_38__39;
+
+							{
+								mrb_value s = i__39;
+
+								total = num_add_1(1, total, num_mul_1(1, mrb_fixnum_value(k__39), s));
+								__tmp_38__39 = total;
+							}
+						}
+						mrb_gc_arena_restore(mrb, ai);
+					}
+				}
+			}
+			__tmp_32 = i__39;
+		}
+		__tmp_32;
+	});
+	puts_1(0, __self__, total);
+	puts_1(0, __self__, r);
+	cells = mrb_fixnum_value(0);
+	{
+		mrb_int __tmp_40;
+
+		{
+			mrb_int h__47 = 2;
+			mrb_int w__47 = 3;
+
+			{
+				{
+					mrb_int __y__47 = 0;
+					mrb_int __y__47_last = h__47;
+					for (; __y__47 < __y__47_last; ++__y__47) {
+						int ai = mrb_gc_arena_save(mrb);
+						mrb_int y__47 = __y__47;
+						{
+							{
+								mrb_int __tmp_52 = (y__47 * 10);
+
+								{
+									mrb_int __x__47 = 0;
+									mrb_int __x__47_last = w__47;
+									for (; __x__47 < __x__47_last; ++__x__47) {
+										int ai = mrb_gc_arena_save(mrb);
+										mrb_int x__47 = __x__47;
+										{
+											mrb_value __tmp_46__47;
+
+											{
+												mrb_int x = x__47;
+
+												cells = num_add_1(1, num_add_1(1, cells, mrb_fixnum_value(x)), mrb_fixnum_value(__tmp_52));
+												__tmp_46__47 = cells;
+											}
+										}
+										mrb_gc_arena_restore(mrb, ai);
+									}
+								}
+							}
+						}
+						mrb_gc_arena_restore(mrb, ai);
+					}
+				}
+				__tmp_40 = h__47;
+			}
+		}
+	}
+	puts_1(0, __self__, cells);
+	v = mrb_fixnum(({
+		mrb_int __tmp_48;
+		{
+			{
+				mrb_int __tmp_49__51;
+
+				{
+					mrb_int x = 1;
+
+					__tmp_49__51 = 3;
+				}
+			}
+			{
+				mrb_int __tmp_50__51;
+
+				{
+					mrb_int x = 2;
+
+					__tmp_50__51 = 6;
+				}
+				__tmp_48 = 6;
+			}
+		}
+		mrb_fixnum_value(6);
+	}));
+	(hpc_output_int(6), hpc_output_write("\n", 1), mrb_nil_value());
+	HPC_FRAME_POP(__frame1);
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+void
+Grid_init(mrb_value __self__)
+{
+}
+
+static mrb_value
+Grid_each_cell(mrb_value __self__, mrb_value w, mrb_value h)
+{
+	mrb_value __block__ = hpc_take_block();
+	{
+		{
+			mrb_int __y = 0;
+			mrb_int __y_last = mrb_fixnum(h);
+			for (; __y < __y_last; ++__y) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int y = __y;
+				{
+					{
+						mrb_int __x = 0;
+						mrb_int __x_last = mrb_fixnum(w);
+						for (; __x < __x_last; ++__x) {
+							int ai = mrb_gc_arena_save(mrb);
+							mrb_int x = __x;
+							hpc_yield(__block__, 2, (mrb_value[]){mrb_fixnum_value(x), mrb_fixnum_value(y)});
+							mrb_gc_arena_restore(mrb, ai);
+						}
+					}
+				}
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+		return h;
+	}
+}
+
+static mrb_value
+each_pair(mrb_value __self__, mrb_value n)
+{
+	mrb_value __block__ = hpc_take_block();
+	mrb_value i;
+
+	i = mrb_fixnum_value(0);
+	{
+		{
+			mrb_int __k = 0;
+			mrb_int __k_last = mrb_fixnum(n);
+			for (; __k < __k_last; ++__k) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int k = __k;
+				i = num_add_1(1, i, mrb_fixnum_value(k));
+				hpc_yield(__block__, 2, (mrb_value[]){mrb_fixnum_value(k), i});
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	return i;
+}
+
+static mrb_value
+twice(mrb_value __self__)
+{
+	mrb_value __block__ = hpc_take_block();
+	hpc_yield(__block__, 1, (mrb_value[]){mrb_fixnum_value(1)});
+	return hpc_yield(__block__, 1, (mrb_value[]){mrb_fixnum_value(2)});
+}
+
+static mrb_value
+sum_upto(mrb_value __self__, mrb_value n)
+{
+	mrb_value s;
+
+	s = mrb_fixnum_value(0);
+	{
+		mrb_int __tmp_0 = 1;
+		mrb_int __tmp_2 = 1;
+		mrb_value __tmp_3 = mrb_fixnum_value(1);
+
+		while (mrb_bool(num_le_1(1, __tmp_3, n))) {
+			int ai = mrb_gc_arena_save(mrb);
+			{
+				{
+					mrb_value i = __tmp_3;
+
+					s = num_add_1(1, s, i);
+				}
+				__tmp_3 = num_add_1(1, __tmp_3, mrb_fixnum_value(1));
+			}
+			mrb_gc_arena_restore(mrb, ai);
+		}
+	}
+	return s;
+}
+
+static mrb_value
+sum_upto__c1(mrb_value __self__, mrb_int n)
+{
+	mrb_value s;
+
+	s = mrb_fixnum_value(0);
+	{
+		mrb_int __tmp_4 = 1;
+		mrb_int __tmp_5 = (n + 1);
+
+		{
+			mrb_int __i = 1;
+			mrb_int __i_last = __tmp_5;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				s = num_add_1(1, s, mrb_fixnum_value(i));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	return s;
+}
+
+mrb_value
+sum_upto_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	return sum_upto(__self__, arg0);
+}mrb_value
+twice_0(int val, mrb_value __self__)
+{
+	return twice(__self__);
+}mrb_value
+each_pair_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	return each_pair(__self__, arg0);
+}mrb_value
+each_cell_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+	if (hpc_class_eq(__self__, Grid)) {
+		result = Grid_each_cell(__self__, arg0, arg1);
+	} else {
+		switch (hpc_type_of(__self__)) {
+		default:
+			result = mrb_funcall(mrb, __self__, "each_cell", 2, arg0, arg1);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
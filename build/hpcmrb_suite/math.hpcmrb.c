@@ -0,0 +1,195 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+mrb_value
+norm_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);
+mrb_value
+polar_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);
+
+static mrb_value
+polar(mrb_value __self__, mrb_value r, mrb_value t);
+static mrb_value
+norm(mrb_value __self__, mrb_value x, mrb_value y);
+static double
+polar__c3(mrb_value __self__, double r, double t);
+static double
+norm__c2(mrb_value __self__, mrb_int x, mrb_int y);
+static double
+norm__c1(mrb_value __self__, double x, double y);
+mrb_value Math;
+
+void
+init_global_syms(mrb_state * mrb)
+{
+	Math = mrb_const_get(mrb, mrb_obj_value(mrb->object_class), mrb_intern(mrb, "Math"));
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { NULL };
+	double s;
+
+	puts_1(0, __self__, mrb_float_value(norm__c1(__self__, 3.0, 4.0)));
+	puts_1(0, __self__, mrb_float_value(norm__c2(__self__, 1, 2)));
+	puts_1(0, __self__, mrb_float_value(polar__c3(__self__, 2.0, 0.5)));
+	puts_1(0, __self__, mrb_float_value(0.46364760900080609));
+	puts_1(0, __self__, mrb_float_value(5.0));
+	puts_1(0, __self__, mrb_float_value(5.0208669214530914));
+	puts_1(0, __self__, mrb_float_value(6.0));
+	puts_1(0, __self__, mrb_float_value(sqrt((-1.0))));
+	s = 0.0;
+	{
+		mrb_int __tmp_0 = 10;
+
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 10;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				s = (s + sqrt(((mrb_float)i)));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	puts_1(0, __self__, mrb_float_value(s));
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+static mrb_value
+polar(mrb_value __self__, mrb_value r, mrb_value t)
+{
+	return num_add_1(1, num_mul_1(1, r, cos_1(1, Math, t)), num_mul_1(1, r, sin_1(1, Math, t)));
+}
+
+static mrb_value
+norm(mrb_value __self__, mrb_value x, mrb_value y)
+{
+	return sqrt_1(1, Math, num_add_1(1, num_mul_1(1, x, x), num_mul_1(1, y, y)));
+}
+
+static double
+polar__c3(mrb_value __self__, double r, double t)
+{
+	return ((r * cos(t)) + (r * sin(t)));
+}
+
+static double
+norm__c2(mrb_value __self__, mrb_int x, mrb_int y)
+{
+	return sqrt(hpc_to_float(num_add_1(1, hpc_int_mul(x, x), hpc_int_mul(y, y))));
+}
+
+static double
+norm__c1(mrb_value __self__, double x, double y)
+{
+	return sqrt(((x * x) + (y * y)));
+}
+
+mrb_value
+norm_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	return norm(__self__, arg0, arg1);
+}mrb_value
+polar_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	return polar(__self__, arg0, arg1);
+}
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
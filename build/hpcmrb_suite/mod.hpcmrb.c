@@ -0,0 +1,333 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "mruby/dump.h"
+#include "mruby/proc.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+mrb_value
+m_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);
+mrb_value
+cyc_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);
+mrb_value
+by3_1(int val, mrb_value __self__, mrb_value arg0);
+
+static void
+hpc_vm_init(mrb_state *mrb);
+
+static void
+hpc_vm_main(mrb_state *mrb);
+
+static mrb_value
+by3(mrb_value __self__, mrb_value n);
+static mrb_value
+cyc(mrb_value __self__, mrb_value n, mrb_value k);
+static mrb_value
+m(mrb_value __self__, mrb_value a, mrb_value b);
+
+void
+init_global_syms(mrb_state * mrb)
+{
+	hpc_vm_init(mrb);
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { NULL };
+	hpc_vm_main(mrb);
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+static mrb_value
+by3(mrb_value __self__, mrb_value n)
+{
+	mrb_value s;
+
+	s = mrb_fixnum_value(0);
+	{
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = mrb_fixnum(n);
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				s = num_add_1(1, s, mrb_fixnum_value(hpc_mod_int(i, 3)));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	return s;
+}
+
+static mrb_value
+cyc(mrb_value __self__, mrb_value n, mrb_value k)
+{
+	mrb_value s = mrb_nil_value();
+	mrb_value *__roots1[] = { &s };
+	HPC_FRAME_PUSH(__frame1, __roots1);
+
+	s = mrb_fixnum_value(0);
+	{
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = mrb_fixnum(n);
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				s = num_add_1(1, s, num_mod_1(1, mrb_fixnum_value(i), k));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	{
+		mrb_value __ret = s;
+		HPC_FRAME_POP(__frame1);
+		return __ret;
+	}
+}
+
+static mrb_value
+m(mrb_value __self__, mrb_value a, mrb_value b)
+{
+	return num_mod_1(1, a, b);
+}
+
+mrb_value
+m_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	return m(__self__, arg0, arg1);
+}mrb_value
+cyc_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	return cyc(__self__, arg0, arg1);
+}mrb_value
+by3_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	return by3(__self__, arg0);
+}
+#include <stdint.h>
+const uint8_t hpc_vm_irep[] = {
+0x52,0x49,0x54,0x45,0x30,0x30,0x30,0x31,0xae,0xd5,0x00,0x00,0x03,0x8f,0x4d,0x41,
+0x54,0x5a,0x30,0x30,0x30,0x30,0x49,0x52,0x45,0x50,0x00,0x00,0x02,0x07,0x30,0x30,
+0x30,0x30,0x00,0x03,0x00,0xd8,0x00,0x00,0x00,0x31,0x00,0x01,0x00,0x02,0x00,0x00,
+0x00,0x05,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x80,
+0x00,0x05,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x06,
+0x73,0x61,0x66,0x65,0x5f,0x6d,0x00,0x00,0x00,0x00,0x99,0x00,0x04,0x00,0x07,0x00,
+0x00,0x00,0x15,0x04,0x00,0x00,0x26,0x00,0x40,0x02,0x9a,0x02,0x00,0x00,0x06,0x02,
+0x80,0x40,0x01,0x03,0x00,0x80,0x01,0x02,0x00,0x01,0x20,0x00,0x40,0x06,0x17,0x02,
+0x00,0x00,0x1b,0x02,0x80,0x00,0x91,0x03,0x01,0x00,0x01,0x02,0x80,0x80,0xa0,0x02,
+0xc0,0x00,0x98,0x00,0x40,0x02,0x97,0x02,0x00,0x00,0x3d,0x02,0x80,0x40,0x01,0x02,
+0x80,0xc0,0x20,0x02,0x01,0x40,0x3e,0x00,0x40,0x01,0x17,0x02,0x00,0x00,0x1d,0x00,
+0x80,0x00,0x1c,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x02,0x10,0x00,0x09,0x6e,0x6f,
+0x20,0x25,0x20,0x66,0x6f,0x72,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x01,
+0x6d,0x00,0x00,0x0d,0x4e,0x6f,0x4d,0x65,0x74,0x68,0x6f,0x64,0x45,0x72,0x72,0x6f,
+0x72,0x00,0x00,0x03,0x3d,0x3d,0x3d,0x00,0x00,0x05,0x63,0x6c,0x61,0x73,0x73,0x00,
+0x00,0x00,0x01,0x2d,0x00,0x01,0x00,0x05,0x00,0x00,0x00,0x38,0x00,0x80,0x00,0x06,
+0x01,0x00,0x00,0x06,0x01,0xc0,0x03,0x03,0x02,0x40,0x01,0x03,0x01,0x00,0x41,0x20,
+0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x06,0x01,0xbf,0xfc,0x03,
+0x02,0x40,0x01,0x03,0x01,0x00,0x41,0x20,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x06,
+0x01,0x00,0x00,0x06,0x01,0xc0,0x03,0x03,0x02,0x3f,0xfe,0x03,0x01,0x00,0x41,0x20,
+0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x06,0x01,0xc0,0x03,0x03,
+0x02,0x3f,0xff,0x83,0x01,0x00,0x41,0x20,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x06,
+0x01,0x00,0x00,0x06,0x01,0x80,0x00,0x02,0x02,0x40,0x00,0x83,0x01,0x00,0x41,0x20,
+0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x06,0x01,0xc0,0x04,0x83,
+0x02,0x40,0x01,0x83,0x01,0x00,0x81,0x20,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x06,
+0x01,0x00,0x00,0x06,0x01,0xc0,0x01,0x03,0x02,0x3f,0xff,0x83,0x01,0x00,0x81,0x20,
+0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x06,0x01,0xc0,0x04,0x83,
+0x01,0x00,0xc0,0xa0,0x00,0x80,0x00,0xa0,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x06,
+0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x83,0x01,0x80,0xc1,0x37,0x02,0x40,0x01,0x03,
+0x01,0x01,0x01,0x20,0x00,0x80,0x00,0xa0,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0x01,
+0x06,0x00,0x16,0x37,0x2e,0x35,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+0x30,0x30,0x30,0x30,0x30,0x65,0x2b,0x30,0x30,0x00,0x00,0x00,0x05,0x00,0x04,0x70,
+0x75,0x74,0x73,0x00,0x00,0x01,0x6d,0x00,0x00,0x03,0x63,0x79,0x63,0x00,0x00,0x03,
+0x62,0x79,0x33,0x00,0x00,0x06,0x73,0x61,0x66,0x65,0x5f,0x6d,0x00,0x4c,0x49,0x4e,
+0x45,0x00,0x00,0x01,0x6a,0x00,0x03,0x00,0xd8,0x00,0x00,0x00,0x48,0x00,0x34,0x2f,
+0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,
+0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,
+0x72,0x62,0x2f,0x74,0x65,0x73,0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x6d,0x6f,0x64,
+0x2e,0x72,0x62,0x00,0x00,0x00,0x05,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,
+0x1d,0x00,0x00,0x00,0x68,0x00,0x34,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,
+0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,
+0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,0x72,0x62,0x2f,0x74,0x65,0x73,0x74,0x63,
+0x61,0x73,0x65,0x73,0x2f,0x6d,0x6f,0x64,0x2e,0x72,0x62,0x00,0x00,0x00,0x15,0x00,
+0x1d,0x00,0x1c,0x00,0x19,0x00,0x19,0x00,0x19,0x00,0x19,0x00,0x19,0x00,0x19,0x00,
+0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,
+0x1b,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,0x00,0x00,0xae,0x00,0x34,0x2f,
+0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,
+0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,
+0x72,0x62,0x2f,0x74,0x65,0x73,0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x6d,0x6f,0x64,
+0x2e,0x72,0x62,0x00,0x00,0x00,0x38,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+0x1f,0x00,0x1f,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,
+0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,
+0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,
+0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,0x00,
+0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x26,0x00,
+0x26,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x00,
+0x27,0x00,0x27,0x00,0x27,0x00,0x27,0x45,0x4e,0x44,0x00,0x00,0x00,0x00,0x08,
+};
+
+static mrb_value
+by3__vm(mrb_state *mrb, mrb_value self)
+{
+	mrb_value *argv;
+	int argc;
+
+	mrb_get_args(mrb, "*", &argv, &argc);
+	if (argc != 1)
+		mrb_raisef(mrb, E_ARGUMENT_ERROR, "wrong number of arguments (%S for 1)", mrb_fixnum_value(argc));
+	return by3(self, argv[0]);
+}
+
+static mrb_value
+cyc__vm(mrb_state *mrb, mrb_value self)
+{
+	mrb_value *argv;
+	int argc;
+
+	mrb_get_args(mrb, "*", &argv, &argc);
+	if (argc != 2)
+		mrb_raisef(mrb, E_ARGUMENT_ERROR, "wrong number of arguments (%S for 2)", mrb_fixnum_value(argc));
+	return cyc(self, argv[0], argv[1]);
+}
+
+static mrb_value
+m__vm(mrb_state *mrb, mrb_value self)
+{
+	mrb_value *argv;
+	int argc;
+
+	mrb_get_args(mrb, "*", &argv, &argc);
+	if (argc != 2)
+		mrb_raisef(mrb, E_ARGUMENT_ERROR, "wrong number of arguments (%S for 2)", mrb_fixnum_value(argc));
+	return m(self, argv[0], argv[1]);
+}
+
+static size_t hpc_vm_base;
+
+static void
+hpc_vm_main(mrb_state *mrb)
+{
+	mrb_run(mrb, mrb_proc_new(mrb, mrb->irep[hpc_vm_base + 2]), mrb_top_self(mrb));
+	if (mrb->exc)
+		mrb_exc_raise(mrb, mrb_obj_value(mrb->exc));
+}
+
+static void
+hpc_vm_init(mrb_state *mrb)
+{
+	struct RClass *c;
+	size_t n = mrb->irep_len;
+
+	if (mrb_read_irep(mrb, hpc_vm_irep) < 0) {
+		fputs("cannot load the methods left to the VM\n", stderr);
+		exit(EXIT_FAILURE);
+	}
+	hpc_vm_base = n;
+	mrb_run(mrb, mrb_proc_new(mrb, mrb->irep[n]), mrb_top_self(mrb));
+	if (mrb->exc) {
+		mrb_p(mrb, mrb_obj_value(mrb->exc));
+		exit(EXIT_FAILURE);
+	}
+	c = mrb->object_class;
+	mrb_define_method(mrb, c, "by3", by3__vm, ARGS_ANY());
+	mrb_define_method(mrb, c, "cyc", cyc__vm, ARGS_ANY());
+	mrb_define_method(mrb, c, "m", m__vm, ARGS_ANY());
+}
+
+
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
@@ -0,0 +1,269 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+#define T_Hello 1001
+typedef struct {
+	int type;
+	mrb_int x;
+} cHello;
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+mrb_value
+x_0(int val, mrb_value __self__);
+mrb_value
+x_set_1(int val, mrb_value __self__, mrb_value arg0);
+
+static mrb_value
+Hello_x_set(mrb_value __self__, mrb_value other);
+static mrb_value
+Hello_x(mrb_value __self__);
+static mrb_value
+Hello_initialize(mrb_value __self__);
+static mrb_int
+Hello_x__c3(mrb_value __self__);
+static mrb_int
+Hello_x_set__c2(mrb_value __self__, mrb_int other);
+static mrb_int
+Hello_initialize__c1(mrb_value __self__);
+static mrb_value
+Hello_new__c1(mrb_value __self__);
+mrb_sym __i_x;
+
+void
+init_global_syms(mrb_state * mrb)
+{
+	__i_x = mrb_intern(mrb, "x");
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void Hello_init(mrb_value __self__);
+mrb_value Hello;
+void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { &Hello };
+	static mrb_shadow_frame __global_frame;
+	__global_frame.prev = mrb->shadow_frames;
+	__global_frame.len = sizeof(__global_roots) / sizeof(__global_roots[0]);
+	__global_frame.roots = __global_roots;
+	mrb->shadow_frames = &__global_frame;
+	mrb_int h__x;
+
+	Hello = mrb_obj_value(mrb_define_class(mrb, "Hello", mrb->object_class));
+	Hello_init(Hello);
+	h__x = 0;
+	h__x = 30;
+	(hpc_output_int(h__x), hpc_output_write("\n", 1), mrb_nil_value());
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+	if (c == (struct RClass *)mrb_obj_ptr(Hello)) {
+		cHello *sval;
+		Data_Make_Struct(mrb, c, cHello, &hpc_data_type, sval, data);
+		sval->type = T_Hello;
+		obj = mrb_obj_value(data);
+		Hello_initialize(obj);
+} else {
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+void
+Hello_init(mrb_value __self__)
+{
+}
+
+static mrb_value
+Hello_x_set(mrb_value __self__, mrb_value other)
+{
+	cHello *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->x = mrb_fixnum(other);
+	return mrb_fixnum_value(data->x);
+}
+
+static mrb_value
+Hello_x(mrb_value __self__)
+{
+	cHello *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return mrb_fixnum_value(data->x);
+}
+
+static mrb_value
+Hello_initialize(mrb_value __self__)
+{
+	cHello *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->x = 0;
+	return mrb_fixnum_value(data->x);
+}
+
+static mrb_int
+Hello_x__c3(mrb_value __self__)
+{
+	cHello *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->x;
+}
+
+static mrb_int
+Hello_x_set__c2(mrb_value __self__, mrb_int other)
+{
+	cHello *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->x = other;
+	return data->x;
+}
+
+static mrb_int
+Hello_initialize__c1(mrb_value __self__)
+{
+	cHello *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->x = 0;
+	return data->x;
+}
+
+static mrb_value
+Hello_new__c1(mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	cHello *sval;
+	Data_Make_Struct(mrb, mrb_class_ptr(__self__), cHello, &hpc_data_type, sval, data);
+	sval->type = T_Hello;
+	obj = mrb_obj_value(data);
+	Hello_initialize__c1(obj);
+	return obj;
+}
+
+mrb_value
+x_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Hello:
+			result = Hello_x(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "x", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+x_set_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Hello:
+			result = Hello_x_set(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "x=", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
@@ -0,0 +1,214 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+#define T_B 1001
+typedef struct {
+	int type;
+} cB;
+
+#define T_A 1002
+typedef struct {
+	int type;
+} cA;
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+mrb_value
+hi_0(int val, mrb_value __self__);
+
+static mrb_value
+B_hi(mrb_value __self__);
+static mrb_value
+B_hi__c2(mrb_value __self__);
+static mrb_value
+A_hi(mrb_value __self__);
+static mrb_value
+A_hi__c1(mrb_value __self__);
+
+void
+init_global_syms(mrb_state * mrb)
+{
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void B_init(mrb_value __self__);
+void A_init(mrb_value __self__);
+mrb_value A;
+mrb_value B;
+void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { &A, &B };
+	static mrb_shadow_frame __global_frame;
+	__global_frame.prev = mrb->shadow_frames;
+	__global_frame.len = sizeof(__global_roots) / sizeof(__global_roots[0]);
+	__global_frame.roots = __global_roots;
+	mrb->shadow_frames = &__global_frame;
+	A = mrb_obj_value(mrb_define_class(mrb, "A", mrb->object_class));
+	A_init(A);
+	B = mrb_obj_value(mrb_define_class(mrb, "B", mrb->object_class));
+	B_init(B);
+	A_hi__c1(mrb_funcall(mrb, A, "new", 0));
+	B_hi__c2(mrb_funcall(mrb, B, "new", 0));
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+void
+B_init(mrb_value __self__)
+{
+}
+
+void
+A_init(mrb_value __self__)
+{
+}
+
+static mrb_value
+B_hi(mrb_value __self__)
+{
+	cB *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return (hpc_output_write("B: hi\n", 6), mrb_nil_value());
+}
+
+static mrb_value
+B_hi__c2(mrb_value __self__)
+{
+	cB *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return (hpc_output_write("B: hi\n", 6), mrb_nil_value());
+}
+
+static mrb_value
+A_hi(mrb_value __self__)
+{
+	cA *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return (hpc_output_write("A: Hi\n", 6), mrb_nil_value());
+}
+
+static mrb_value
+A_hi__c1(mrb_value __self__)
+{
+	cA *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return (hpc_output_write("A: Hi\n", 6), mrb_nil_value());
+}
+
+mrb_value
+hi_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_A:
+			result = A_hi(__self__);
+			break;
+		case T_B:
+			result = B_hi(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "hi", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
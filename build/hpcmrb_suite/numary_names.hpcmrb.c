@@ -0,0 +1,410 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+#define T_Vec 1001
+typedef struct {
+	int type;
+	double y;
+	mrb_value x;
+} cVec;
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+mrb_value
+x_0(int val, mrb_value __self__);
+mrb_value
+y_0(int val, mrb_value __self__);
+mrb_value
+dot_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+sum_0(int val, mrb_value __self__);
+mrb_value
+axpy_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);
+
+static mrb_value
+Vec_axpy(mrb_value __self__, mrb_value a, mrb_value o);
+static mrb_value
+Vec_sum(mrb_value __self__);
+static mrb_value
+Vec_dot(mrb_value __self__, mrb_value o);
+static mrb_value
+Vec_y(mrb_value __self__);
+static mrb_value
+Vec_x(mrb_value __self__);
+static mrb_value
+Vec_initialize(mrb_value __self__, mrb_value x, mrb_value y);
+static mrb_value
+Vec_axpy__c6(mrb_value __self__, double a, mrb_value o);
+static double
+Vec_sum__c5(mrb_value __self__);
+static double
+Vec_y__c3(mrb_value __self__);
+static mrb_value
+Vec_x__c2(mrb_value __self__);
+static double
+Vec_dot__c4(mrb_value __self__, mrb_value o);
+static double
+Vec_initialize__c1(mrb_value __self__, double x, double y);
+static mrb_value
+Vec_new__c1(mrb_value __self__, double x, double y);
+mrb_value FloatArray;
+mrb_sym __i_y;
+mrb_sym __i_x;
+
+void
+init_global_syms(mrb_state * mrb)
+{
+	__i_y = mrb_intern(mrb, "y");
+	__i_x = mrb_intern(mrb, "x");
+	FloatArray = mrb_const_get(mrb, mrb_obj_value(mrb->object_class), mrb_intern(mrb, "FloatArray"));
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void Vec_init(mrb_value __self__);
+mrb_value Vec;
+void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { &Vec };
+	static mrb_shadow_frame __global_frame;
+	__global_frame.prev = mrb->shadow_frames;
+	__global_frame.len = sizeof(__global_roots) / sizeof(__global_roots[0]);
+	__global_frame.roots = __global_roots;
+	mrb->shadow_frames = &__global_frame;
+	mrb_value v = mrb_nil_value();
+	mrb_value w = mrb_nil_value();
+	mrb_value a = mrb_nil_value();
+	mrb_value b = mrb_nil_value();
+	mrb_value *__roots1[] = { &v, &w, &a, &b };
+	HPC_FRAME_PUSH(__frame1, __roots1);
+
+	Vec = mrb_obj_value(mrb_define_class(mrb, "Vec", mrb->object_class));
+	Vec_init(Vec);
+	v = Vec_new__c1(Vec, 1.5, 2.0);
+	w = Vec_new__c1(Vec, 3.0, 4.0);
+	puts_1(0, __self__, mrb_float_value(Vec_dot__c4(v, w)));
+	puts_1(0, __self__, mrb_float_value(Vec_sum__c5(v)));
+	puts_1(0, __self__, mrb_float_value(Vec_sum__c5(Vec_axpy__c6(v, 2.0, w))));
+	a = mrb_funcall(mrb, FloatArray, "new", 2, mrb_fixnum_value(4), mrb_float_value(1.5));
+	b = mrb_funcall(mrb, FloatArray, "new", 2, mrb_fixnum_value(4), mrb_float_value(2.0));
+	puts_1(0, __self__, hpc_numary_dot_1(1, a, b));
+	hpc_numary_axpy_2(0, a, mrb_float_value(2.0), b);
+	puts_1(0, __self__, hpc_numary_sum_0(1, a));
+	HPC_FRAME_POP(__frame1);
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+	if (c == (struct RClass *)mrb_obj_ptr(Vec)) {
+		cVec *sval;
+		Data_Make_Struct(mrb, c, cVec, &hpc_data_type, sval, data);
+		sval->type = T_Vec;
+		obj = mrb_obj_value(data);
+		Vec_initialize(obj, arg0, arg1);
+} else {
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+void
+Vec_init(mrb_value __self__)
+{
+}
+
+static mrb_value
+Vec_axpy(mrb_value __self__, mrb_value a, mrb_value o)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return mrb_funcall(mrb, Vec, "new", 2, num_add_1(1, num_mul_1(1, a, x_0(1, o)), data->x), num_add_1(1, num_mul_1(1, a, y_0(1, o)), mrb_float_value(data->y)));
+}
+
+static mrb_value
+Vec_sum(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return mrb_float_value((hpc_to_float(data->x) + data->y));
+}
+
+static mrb_value
+Vec_dot(mrb_value __self__, mrb_value o)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return num_add_1(1, num_mul_1(1, data->x, x_0(1, o)), num_mul_1(1, mrb_float_value(data->y), y_0(1, o)));
+}
+
+static mrb_value
+Vec_y(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return mrb_float_value(data->y);
+}
+
+static mrb_value
+Vec_x(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->x;
+}
+
+static mrb_value
+Vec_initialize(mrb_value __self__, mrb_value x, mrb_value y)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->x = x;
+	data->y = mrb_float(y);
+	return mrb_float_value(data->y);
+}
+
+static mrb_value
+Vec_axpy__c6(mrb_value __self__, double a, mrb_value o)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return Vec_new__c1(Vec, ((a * hpc_to_float(((cVec *)DATA_PTR(o))->x)) + hpc_to_float(data->x)), ((a * ((cVec *)DATA_PTR(o))->y) + data->y));
+}
+
+static double
+Vec_sum__c5(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return (hpc_to_float(data->x) + data->y);
+}
+
+static double
+Vec_y__c3(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->y;
+}
+
+static mrb_value
+Vec_x__c2(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->x;
+}
+
+static double
+Vec_dot__c4(mrb_value __self__, mrb_value o)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return (hpc_to_float(num_mul_1(1, data->x, ((cVec *)DATA_PTR(o))->x)) + (data->y * ((cVec *)DATA_PTR(o))->y));
+}
+
+static double
+Vec_initialize__c1(mrb_value __self__, double x, double y)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->x = mrb_float_value(x);
+	data->y = y;
+	return data->y;
+}
+
+static mrb_value
+Vec_new__c1(mrb_value __self__, double x, double y)
+{
+	mrb_value obj;
+	struct RData * data;
+	cVec *sval;
+	Data_Make_Struct(mrb, mrb_class_ptr(__self__), cVec, &hpc_data_type, sval, data);
+	sval->type = T_Vec;
+	obj = mrb_obj_value(data);
+	Vec_initialize__c1(obj, x, y);
+	return obj;
+}
+
+mrb_value
+x_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Vec:
+			result = Vec_x(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "x", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+y_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Vec:
+			result = Vec_y(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "y", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+dot_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Vec:
+			result = Vec_dot(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "dot", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+sum_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Vec:
+			result = Vec_sum(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "sum", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+axpy_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Vec:
+			result = Vec_axpy(__self__, arg0, arg1);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "axpy", 2, arg0, arg1);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
@@ -0,0 +1,239 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+
+mrb_value FloatArray;
+mrb_value IntArray;
+
+void
+init_global_syms(mrb_state * mrb)
+{
+	FloatArray = mrb_const_get(mrb, mrb_obj_value(mrb->object_class), mrb_intern(mrb, "FloatArray"));
+	IntArray = mrb_const_get(mrb, mrb_obj_value(mrb->object_class), mrb_intern(mrb, "IntArray"));
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { NULL };
+	mrb_int n;
+	mrb_value x = mrb_nil_value();
+	mrb_value y = mrb_nil_value();
+	mrb_value v = mrb_nil_value();
+	mrb_value s;
+	mrb_value *__roots1[] = { &x, &y, &v };
+	HPC_FRAME_PUSH(__frame1, __roots1);
+
+	n = 10;
+	x = mrb_funcall(mrb, FloatArray, "new", 1, mrb_fixnum_value(10));
+	y = mrb_funcall(mrb, FloatArray, "new", 2, mrb_fixnum_value(10), mrb_float_value(1.0));
+	v = mrb_funcall(mrb, IntArray, "new", 1, mrb_fixnum_value(10));
+	{
+		mrb_int __tmp_0 = 10;
+
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 10;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				hpc_fary_set(x, i, (((mrb_float)i) * 0.5));
+				hpc_ary_aset_2(0, v, mrb_fixnum_value(i), mrb_fixnum_value((i * i)));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	hpc_ary_aset_2(0, y, mrb_fixnum_value(0), mrb_fixnum_value(3));
+	puts_1(0, __self__, mrb_float_value(hpc_fary_ref(x, 3)));
+	puts_1(0, __self__, mrb_float_value(hpc_fary_ref(x, (-1))));
+	(hpc_output_int(hpc_iary_ref(v, 4)), hpc_output_write("\n", 1), mrb_nil_value());
+	(hpc_output_int(mrb_fixnum(hpc_numary_len_0(1, y))), hpc_output_write("\n", 1), mrb_nil_value());
+	{
+		mrb_int __tmp_1 = 10;
+
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 10;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				hpc_fary_set(y, i, ((2.0 * hpc_fary_ref(x, i)) + hpc_fary_ref(y, i)));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	puts_1(0, __self__, hpc_numary_sum_0(1, y));
+	puts_1(0, __self__, hpc_numary_dot_1(1, x, y));
+	hpc_numary_axpy_2(0, y, mrb_float_value(0.5), x);
+	puts_1(0, __self__, mrb_float_value(hpc_fary_ref(y, 9)));
+	s = mrb_fixnum_value(0);
+	{
+		mrb_value __tmp_2 = v;
+		mrb_int __tmp_3 = 0;
+		mrb_value *__roots2[] = { &__tmp_2 };
+		HPC_FRAME_PUSH(__frame2, __roots2);
+
+		{
+			mrb_int __tmp_8 = mrb_fixnum(hpc_numary_len_0(1, __tmp_2));
+
+			while (__tmp_3 < __tmp_8) {
+				int ai = mrb_gc_arena_save(mrb);
+				{
+					{
+						mrb_int k = hpc_iary_ref(__tmp_2, __tmp_3);
+
+						s = num_add_1(1, s, mrb_fixnum_value(k));
+					}
+					__tmp_3 = (__tmp_3 + 1);
+				}
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+		HPC_FRAME_POP(__frame2);
+	}
+	puts_1(0, __self__, s);
+	{
+		mrb_value __tmp_4 = x;
+		mrb_int __tmp_5 = 0;
+		mrb_value *__roots3[] = { &__tmp_4 };
+		HPC_FRAME_PUSH(__frame3, __roots3);
+
+		while (__tmp_5 < mrb_fixnum(hpc_numary_len_0(1, __tmp_4))) {
+			int ai = mrb_gc_arena_save(mrb);
+			{
+				{
+					double e = hpc_fary_ref(__tmp_4, __tmp_5);
+
+					hpc_fary_set(__tmp_4, __tmp_5, (e * e));
+				}
+				__tmp_5 = (__tmp_5 + 1);
+			}
+			mrb_gc_arena_restore(mrb, ai);
+		}
+		HPC_FRAME_POP(__frame3);
+	}
+	puts_1(0, __self__, mrb_float_value(hpc_fary_ref(x, 9)));
+	{
+		mrb_value __tmp_6 = v;
+		mrb_int __tmp_7 = 0;
+		mrb_value *__roots4[] = { &__tmp_6 };
+		HPC_FRAME_PUSH(__frame4, __roots4);
+
+		while (__tmp_7 < mrb_fixnum(hpc_numary_len_0(1, __tmp_6))) {
+			int ai = mrb_gc_arena_save(mrb);
+			{
+				{
+					mrb_int k = hpc_iary_ref(__tmp_6, __tmp_7);
+					mrb_int i = __tmp_7;
+
+					hpc_ary_aset_2(0, v, mrb_fixnum_value(i), hpc_int_add(k, i));
+				}
+				__tmp_7 = (__tmp_7 + 1);
+			}
+			mrb_gc_arena_restore(mrb, ai);
+		}
+		HPC_FRAME_POP(__frame4);
+	}
+	puts_1(0, __self__, hpc_numary_sum_0(1, v));
+	HPC_FRAME_POP(__frame1);
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
@@ -0,0 +1,252 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+mrb_value
+mix_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);
+mrb_value
+sum_squares_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+countdown_1(int val, mrb_value __self__, mrb_value arg0);
+
+static mrb_value
+countdown(mrb_value __self__, mrb_value n);
+static mrb_value
+sum_squares(mrb_value __self__, mrb_value n);
+static mrb_value
+mix(mrb_value __self__, mrb_value a, mrb_value b);
+static mrb_value
+countdown__c3(mrb_value __self__, mrb_int n);
+static mrb_value
+sum_squares__c2(mrb_value __self__, mrb_int n);
+static mrb_value
+mix__c1(mrb_value __self__, mrb_int a, mrb_int b);
+
+void
+init_global_syms(mrb_state * mrb)
+{
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { NULL };
+	puts_1(0, __self__, mix__c1(__self__, 3, 4));
+	puts_1(0, __self__, mix__c1(__self__, 1073741824, 4));
+	puts_1(0, __self__, mix__c1(__self__, (-1073741824), 4));
+	puts_1(0, __self__, sum_squares__c2(__self__, 100));
+	puts_1(0, __self__, sum_squares__c2(__self__, 3000));
+	puts_1(0, __self__, countdown__c3(__self__, 715827882));
+	puts_1(0, __self__, countdown__c3(__self__, (-715827882)));
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+static mrb_value
+countdown(mrb_value __self__, mrb_value n)
+{
+	mrb_int s;
+
+	s = 0;
+	{
+		mrb_int __tmp_1 = 10;
+
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 10;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				s = mrb_fixnum(num_add_1(1, mrb_fixnum_value(0), num_mul_1(1, num_sub_1(1, n, mrb_fixnum_value(i)), mrb_fixnum_value(3))));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	return mrb_fixnum_value(0);
+}
+
+static mrb_value
+sum_squares(mrb_value __self__, mrb_value n)
+{
+	mrb_value s;
+
+	s = mrb_fixnum_value(0);
+	{
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = mrb_fixnum(n);
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				s = num_add_1(1, num_add_1(1, s, hpc_int_mul(i, i)), mrb_fixnum_value((i + 1)));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	return s;
+}
+
+static mrb_value
+mix(mrb_value __self__, mrb_value a, mrb_value b)
+{
+	return num_sub_1(1, num_add_1(1, num_mul_1(1, a, b), a), b);
+}
+
+static mrb_value
+countdown__c3(mrb_value __self__, mrb_int n)
+{
+	mrb_value s;
+
+	s = mrb_fixnum_value(0);
+	{
+		mrb_int __tmp_3 = 10;
+
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 10;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				s = num_add_1(1, s, num_mul_1(1, hpc_int_sub(n, i), mrb_fixnum_value(3)));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	return s;
+}
+
+static mrb_value
+sum_squares__c2(mrb_value __self__, mrb_int n)
+{
+	mrb_value s;
+
+	s = mrb_fixnum_value(0);
+	{
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = n;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				s = num_add_1(1, num_add_1(1, s, hpc_int_mul(i, i)), mrb_fixnum_value((i + 1)));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	return s;
+}
+
+static mrb_value
+mix__c1(mrb_value __self__, mrb_int a, mrb_int b)
+{
+	return num_sub_1(1, num_add_1(1, hpc_int_mul(a, b), mrb_fixnum_value(a)), mrb_fixnum_value(b));
+}
+
+mrb_value
+mix_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	return mix(__self__, arg0, arg1);
+}mrb_value
+sum_squares_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	return sum_squares(__self__, arg0);
+}mrb_value
+countdown_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	return countdown(__self__, arg0);
+}
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
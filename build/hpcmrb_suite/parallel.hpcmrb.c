@@ -0,0 +1,198 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+
+
+void
+init_global_syms(mrb_state * mrb)
+{
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { NULL };
+	mrb_int n;
+	mrb_value a = mrb_nil_value();
+	mrb_value b = mrb_nil_value();
+	mrb_value c = mrb_nil_value();
+	mrb_value *__roots1[] = { &a, &b, &c };
+	HPC_FRAME_PUSH(__frame1, __roots1);
+
+	n = 1000;
+	a = mrb_funcall(mrb, mrb_obj_value(mrb->array_class), "new", 1, mrb_fixnum_value(1000));
+	b = mrb_funcall(mrb, mrb_obj_value(mrb->array_class), "new", 1, mrb_fixnum_value(1000));
+	{
+		mrb_int __tmp_0 = 1000;
+
+		if ( mrb_bool(hpc_ary_inplace_p_2(1, a, mrb_fixnum_value(0), mrb_fixnum_value(1000))) )
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 1000;
+			mrb_int __i_first = __i;
+#pragma omp parallel for if (hpc_ary_writable(a, __i_first, __i_last))
+			for (__i = __i_first; __i < __i_last; ++__i) {
+				mrb_int i = __i;
+				double x;
+
+				x = (((mrb_float)i) * 0.5);
+				if ( hpc_mod_int(i, 2) == 0 )
+				{
+					x = (x + 1.0);
+				}
+				hpc_ary_fset(a, i, (x * x));
+			}
+		}
+		else		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 1000;
+			mrb_int __i_first = __i;
+#pragma omp parallel for if (hpc_ary_writable(a, __i_first, __i_last))
+			for (__i = __i_first; __i < __i_last; ++__i) {
+				mrb_int i = __i;
+				double x;
+
+				x = (((mrb_float)i) * 0.5);
+				if ( hpc_mod_int(i, 2) == 0 )
+				{
+					x = (x + 1.0);
+				}
+				hpc_ary_aset_2(1, a, mrb_fixnum_value(i), mrb_float_value((x * x)));
+			}
+		}
+	}
+	{
+		mrb_int __tmp_1 = 1000;
+
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 1000;
+			mrb_int __i_first = __i;
+#pragma omp parallel for if (hpc_ary_writable(b, __i_first, __i_last))
+			for (__i = __i_first; __i < __i_last; ++__i) {
+				mrb_int i = __i;
+				hpc_ary_aset_2(1, b, mrb_fixnum_value(i), mrb_fixnum_value((i * 3)));
+			}
+		}
+	}
+	c = mrb_funcall(mrb, mrb_obj_value(mrb->array_class), "new", 1, mrb_fixnum_value(3));
+	{
+		mrb_int __tmp_2 = 5;
+
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 5;
+			mrb_int __i_first = __i;
+#pragma omp parallel for if (hpc_ary_writable(c, __i_first, __i_last))
+			for (__i = __i_first; __i < __i_last; ++__i) {
+				mrb_int i = __i;
+				hpc_ary_aset_2(1, c, mrb_fixnum_value(i), mrb_fixnum_value(i));
+			}
+		}
+	}
+	puts_1(0, __self__, hpc_ary_vref(a, 0));
+	puts_1(0, __self__, hpc_ary_vref(a, 999));
+	puts_1(0, __self__, hpc_ary_vref(b, 10));
+	puts_1(0, __self__, hpc_ary_vref(c, 4));
+	HPC_FRAME_POP(__frame1);
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
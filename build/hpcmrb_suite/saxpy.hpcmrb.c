@@ -0,0 +1,340 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+mrb_value
+saxpy_4(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2, mrb_value arg3);
+mrb_value
+scale_4(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2, mrb_value arg3);
+mrb_value
+dot_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);
+
+static mrb_value
+dot(mrb_value __self__, mrb_value n, mrb_value x, mrb_value y);
+static mrb_value
+scale(mrb_value __self__, mrb_value n, mrb_value a, mrb_value x, mrb_value y);
+static mrb_value
+saxpy(mrb_value __self__, mrb_value n, mrb_value a, mrb_value x, mrb_value y);
+static mrb_value
+dot__c3(mrb_value __self__, mrb_int n, mrb_value x, mrb_value y);
+static mrb_int
+scale__c2(mrb_value __self__, mrb_int n, double a, mrb_value x, mrb_value y);
+static mrb_int
+saxpy__c1(mrb_value __self__, mrb_int n, double a, mrb_value x, mrb_value y);
+
+void
+init_global_syms(mrb_state * mrb)
+{
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);static const mrb_int N = 100000;
+static const mrb_int ITER = 200;
+void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { NULL };
+	mrb_value x = mrb_nil_value();
+	mrb_value y = mrb_nil_value();
+	mrb_value *__roots1[] = { &x, &y };
+	HPC_FRAME_PUSH(__frame1, __roots1);
+
+	x = mrb_funcall(mrb, mrb_obj_value(mrb->array_class), "new", 1, mrb_fixnum_value(100000));
+	y = mrb_funcall(mrb, mrb_obj_value(mrb->array_class), "new", 1, mrb_fixnum_value(100000));
+	{
+		mrb_int __tmp_3 = 100000;
+
+		if ( mrb_bool(( (mrb_bool(hpc_ary_inplace_p_2(1, y, mrb_fixnum_value(0), mrb_fixnum_value(100000)))) ? hpc_ary_inplace_p_2(1, x, mrb_fixnum_value(0), mrb_fixnum_value(100000)) : mrb_false_value() )) )
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 100000;
+			mrb_int __i_first = __i;
+#pragma omp parallel for if (hpc_ary_writable(y, __i_first, __i_last) && hpc_ary_writable(x, __i_first, __i_last))
+			for (__i = __i_first; __i < __i_last; ++__i) {
+				mrb_int i = __i;
+				hpc_ary_fset(x, i, (((mrb_float)hpc_mod_int(i, 100)) * 0.01));
+				hpc_ary_fset(y, i, 1.0);
+			}
+		}
+		else		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 100000;
+			mrb_int __i_first = __i;
+#pragma omp parallel for if (hpc_ary_writable(y, __i_first, __i_last) && hpc_ary_writable(x, __i_first, __i_last))
+			for (__i = __i_first; __i < __i_last; ++__i) {
+				mrb_int i = __i;
+				hpc_ary_aset_2(1, x, mrb_fixnum_value(i), mrb_float_value((((mrb_float)hpc_mod_int(i, 100)) * 0.01)));
+				hpc_ary_aset_2(1, y, mrb_fixnum_value(i), mrb_float_value(1.0));
+			}
+		}
+	}
+	{
+		mrb_int __tmp_4 = 200;
+
+		{
+			mrb_int ____tmp_7 = 0;
+			mrb_int ____tmp_7_last = 200;
+			for (; ____tmp_7 < ____tmp_7_last; ++____tmp_7) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int __tmp_7 = ____tmp_7;
+				saxpy__c1(__self__, 100000, 0.5, x, y);
+				scale__c2(__self__, 100000, 0.5, y, y);
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	puts_1(0, __self__, dot__c3(__self__, 100000, x, y));
+	HPC_FRAME_POP(__frame1);
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+static mrb_value
+dot(mrb_value __self__, mrb_value n, mrb_value x, mrb_value y)
+{
+	double s;
+
+	s = 0.0;
+	{
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = mrb_fixnum(n);
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				s = hpc_to_float(num_add_1(1, mrb_float_value(0.0), num_mul_1(1, hpc_ary_aget_1(1, x, mrb_fixnum_value(i)), hpc_ary_aget_1(1, y, mrb_fixnum_value(i)))));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	return mrb_float_value(0.0);
+}
+
+static mrb_value
+scale(mrb_value __self__, mrb_value n, mrb_value a, mrb_value x, mrb_value y)
+{
+	{
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = mrb_fixnum(n);
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				hpc_ary_aset_2(0, y, mrb_fixnum_value(i), num_mul_1(1, hpc_ary_aget_1(1, x, mrb_fixnum_value(i)), a));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+		return n;
+	}
+}
+
+static mrb_value
+saxpy(mrb_value __self__, mrb_value n, mrb_value a, mrb_value x, mrb_value y)
+{
+	{
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = mrb_fixnum(n);
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				hpc_ary_aset_2(0, y, mrb_fixnum_value(i), num_add_1(1, num_mul_1(1, a, hpc_ary_aget_1(1, x, mrb_fixnum_value(i))), hpc_ary_aget_1(1, y, mrb_fixnum_value(i))));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+		return n;
+	}
+}
+
+static mrb_value
+dot__c3(mrb_value __self__, mrb_int n, mrb_value x, mrb_value y)
+{
+	mrb_value s = mrb_nil_value();
+	mrb_value *__roots2[] = { &s };
+	HPC_FRAME_PUSH(__frame2, __roots2);
+
+	s = mrb_float_value(0.0);
+	{
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = n;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				s = num_add_1(1, s, num_mul_1(1, hpc_ary_vref(x, i), hpc_ary_vref(y, i)));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	{
+		mrb_value __ret = s;
+		HPC_FRAME_POP(__frame2);
+		return __ret;
+	}
+}
+
+static mrb_int
+scale__c2(mrb_value __self__, mrb_int n, double a, mrb_value x, mrb_value y)
+{
+	{
+		if ( mrb_bool(( (mrb_bool(hpc_ary_float_p_2(1, x, mrb_fixnum_value(0), mrb_fixnum_value(n)))) ? hpc_ary_inplace_p_2(1, y, mrb_fixnum_value(0), mrb_fixnum_value(n)) : mrb_false_value() )) )
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = n;
+			mrb_int __i_first = __i;
+#pragma omp parallel for if (hpc_ary_writable(y, __i_first, __i_last))
+			for (__i = __i_first; __i < __i_last; ++__i) {
+				mrb_int i = __i;
+				hpc_ary_fset(y, i, (hpc_ary_fref(x, i) * a));
+			}
+		}
+		else		{
+			mrb_int __i = 0;
+			mrb_int __i_last = n;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				hpc_ary_aset_2(0, y, mrb_fixnum_value(i), num_mul_1(1, hpc_ary_vref(x, i), mrb_float_value(a)));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+		return n;
+	}
+}
+
+static mrb_int
+saxpy__c1(mrb_value __self__, mrb_int n, double a, mrb_value x, mrb_value y)
+{
+	{
+		if ( mrb_bool(( (mrb_bool(hpc_ary_float_p_2(1, x, mrb_fixnum_value(0), mrb_fixnum_value(n)))) ? hpc_ary_float_p_2(1, y, mrb_fixnum_value(0), mrb_fixnum_value(n)) : mrb_false_value() )) )
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = n;
+			mrb_int __i_first = __i;
+#pragma omp parallel for if (hpc_ary_writable(y, __i_first, __i_last))
+			for (__i = __i_first; __i < __i_last; ++__i) {
+				mrb_int i = __i;
+				hpc_ary_fset(y, i, ((a * hpc_ary_fref(x, i)) + hpc_ary_fref(y, i)));
+			}
+		}
+		else		{
+			mrb_int __i = 0;
+			mrb_int __i_last = n;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				hpc_ary_aset_2(0, y, mrb_fixnum_value(i), num_add_1(1, num_mul_1(1, mrb_float_value(a), hpc_ary_vref(x, i)), hpc_ary_vref(y, i)));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+		return n;
+	}
+}
+
+mrb_value
+saxpy_4(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2, mrb_value arg3)
+{
+	return saxpy(__self__, arg0, arg1, arg2, arg3);
+}mrb_value
+scale_4(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2, mrb_value arg3)
+{
+	return scale(__self__, arg0, arg1, arg2, arg3);
+}mrb_value
+dot_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	return dot(__self__, arg0, arg1, arg2);
+}
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
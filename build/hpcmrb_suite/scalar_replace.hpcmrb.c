@@ -0,0 +1,755 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+#define T_Counter 1001
+typedef struct {
+	int type;
+	mrb_value n;
+} cCounter;
+
+#define T_Vec 1002
+typedef struct {
+	int type;
+	double z;
+	double y;
+	double x;
+} cVec;
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+mrb_value
+sum_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+escape_0(int val, mrb_value __self__);
+mrb_value
+swap_0(int val, mrb_value __self__);
+mrb_value
+x_0(int val, mrb_value __self__);
+mrb_value
+y_0(int val, mrb_value __self__);
+mrb_value
+z_0(int val, mrb_value __self__);
+mrb_value
+x_set_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+y_set_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+z_set_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+n_0(int val, mrb_value __self__);
+mrb_value
+n_set_1(int val, mrb_value __self__, mrb_value arg0);
+
+static mrb_value
+Counter_n_set(mrb_value __self__, mrb_value v);
+static mrb_value
+Counter_n(mrb_value __self__);
+static mrb_value
+Counter_initialize(mrb_value __self__);
+static mrb_value
+Counter_n_set__c10(mrb_value __self__, mrb_value v);
+static mrb_value
+Counter_n__c9(mrb_value __self__);
+static mrb_value
+Counter_initialize__c8(mrb_value __self__);
+static mrb_value
+Counter_new__c8(mrb_value __self__);
+static mrb_value
+Vec_z_set(mrb_value __self__, mrb_value v);
+static mrb_value
+Vec_y_set(mrb_value __self__, mrb_value v);
+static mrb_value
+Vec_x_set(mrb_value __self__, mrb_value v);
+static mrb_value
+Vec_z(mrb_value __self__);
+static mrb_value
+Vec_y(mrb_value __self__);
+static mrb_value
+Vec_x(mrb_value __self__);
+static mrb_value
+Vec_initialize(mrb_value __self__, mrb_value x, mrb_value y, mrb_value z);
+static double
+Vec_z_set__c7(mrb_value __self__, double v);
+static double
+Vec_z__c6(mrb_value __self__);
+static double
+Vec_y_set__c5(mrb_value __self__, double v);
+static double
+Vec_y__c4(mrb_value __self__);
+static double
+Vec_x_set__c3(mrb_value __self__, double v);
+static double
+Vec_x__c2(mrb_value __self__);
+static double
+Vec_initialize__c1(mrb_value __self__, double x, double y, double z);
+static mrb_value
+Vec_new__c1(mrb_value __self__, double x, double y, double z);
+static mrb_value
+swap(mrb_value __self__);
+static mrb_value
+escape(mrb_value __self__);
+static mrb_value
+sum(mrb_value __self__, mrb_value k);
+static double
+swap__c13(mrb_value __self__);
+static mrb_value
+escape__c12(mrb_value __self__);
+static double
+sum__c11(mrb_value __self__, mrb_int k);
+mrb_sym __i_n;
+mrb_sym __i_z;
+mrb_sym __i_y;
+mrb_sym __i_x;
+
+void
+init_global_syms(mrb_state * mrb)
+{
+	__i_n = mrb_intern(mrb, "n");
+	__i_z = mrb_intern(mrb, "z");
+	__i_y = mrb_intern(mrb, "y");
+	__i_x = mrb_intern(mrb, "x");
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void Counter_init(mrb_value __self__);
+void Vec_init(mrb_value __self__);
+mrb_value Vec;
+mrb_value Counter;
+void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { &Vec, &Counter };
+	static mrb_shadow_frame __global_frame;
+	__global_frame.prev = mrb->shadow_frames;
+	__global_frame.len = sizeof(__global_roots) / sizeof(__global_roots[0]);
+	__global_frame.roots = __global_roots;
+	mrb->shadow_frames = &__global_frame;
+	mrb_value c__n;
+
+	Vec = mrb_obj_value(mrb_define_class(mrb, "Vec", mrb->object_class));
+	Vec_init(Vec);
+	Counter = mrb_obj_value(mrb_define_class(mrb, "Counter", mrb->object_class));
+	Counter_init(Counter);
+	c__n = mrb_fixnum_value(0);
+	{
+		mrb_int __tmp_7 = 10;
+
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 10;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				c__n = num_add_1(1, c__n, mrb_fixnum_value(i));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	puts_1(0, __self__, c__n);
+	puts_1(0, __self__, mrb_float_value(sum__c11(__self__, 10)));
+	puts_1(0, __self__, mrb_float_value(((cVec *)DATA_PTR(escape__c12(__self__)))->x));
+	puts_1(0, __self__, mrb_float_value(swap__c13(__self__)));
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+	if (c == (struct RClass *)mrb_obj_ptr(Counter)) {
+		cCounter *sval;
+		Data_Make_Struct(mrb, c, cCounter, &hpc_data_type, sval, data);
+		sval->type = T_Counter;
+		obj = mrb_obj_value(data);
+		Counter_initialize(obj);
+} else {
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+	if (c == (struct RClass *)mrb_obj_ptr(Vec)) {
+		cVec *sval;
+		Data_Make_Struct(mrb, c, cVec, &hpc_data_type, sval, data);
+		sval->type = T_Vec;
+		obj = mrb_obj_value(data);
+		Vec_initialize(obj, arg0, arg1, arg2);
+} else {
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+void
+Counter_init(mrb_value __self__)
+{
+}
+
+void
+Vec_init(mrb_value __self__)
+{
+}
+
+static mrb_value
+Counter_n_set(mrb_value __self__, mrb_value v)
+{
+	cCounter *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->n = v;
+	return data->n;
+}
+
+static mrb_value
+Counter_n(mrb_value __self__)
+{
+	cCounter *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->n;
+}
+
+static mrb_value
+Counter_initialize(mrb_value __self__)
+{
+	cCounter *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->n = mrb_fixnum_value(0);
+	return data->n;
+}
+
+static mrb_value
+Counter_n_set__c10(mrb_value __self__, mrb_value v)
+{
+	cCounter *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->n = v;
+	return data->n;
+}
+
+static mrb_value
+Counter_n__c9(mrb_value __self__)
+{
+	cCounter *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->n;
+}
+
+static mrb_value
+Counter_initialize__c8(mrb_value __self__)
+{
+	cCounter *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->n = mrb_fixnum_value(0);
+	return data->n;
+}
+
+static mrb_value
+Counter_new__c8(mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	cCounter *sval;
+	Data_Make_Struct(mrb, mrb_class_ptr(__self__), cCounter, &hpc_data_type, sval, data);
+	sval->type = T_Counter;
+	obj = mrb_obj_value(data);
+	Counter_initialize__c8(obj);
+	return obj;
+}
+
+static mrb_value
+Vec_z_set(mrb_value __self__, mrb_value v)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->z = hpc_to_float(v);
+	return mrb_float_value(data->z);
+}
+
+static mrb_value
+Vec_y_set(mrb_value __self__, mrb_value v)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->y = hpc_to_float(v);
+	return mrb_float_value(data->y);
+}
+
+static mrb_value
+Vec_x_set(mrb_value __self__, mrb_value v)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->x = hpc_to_float(v);
+	return mrb_float_value(data->x);
+}
+
+static mrb_value
+Vec_z(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return mrb_float_value(data->z);
+}
+
+static mrb_value
+Vec_y(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return mrb_float_value(data->y);
+}
+
+static mrb_value
+Vec_x(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return mrb_float_value(data->x);
+}
+
+static mrb_value
+Vec_initialize(mrb_value __self__, mrb_value x, mrb_value y, mrb_value z)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->x = hpc_to_float(x);
+	data->y = hpc_to_float(y);
+	data->z = hpc_to_float(z);
+	return mrb_float_value(data->z);
+}
+
+static double
+Vec_z_set__c7(mrb_value __self__, double v)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->z = v;
+	return data->z;
+}
+
+static double
+Vec_z__c6(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->z;
+}
+
+static double
+Vec_y_set__c5(mrb_value __self__, double v)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->y = v;
+	return data->y;
+}
+
+static double
+Vec_y__c4(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->y;
+}
+
+static double
+Vec_x_set__c3(mrb_value __self__, double v)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->x = v;
+	return data->x;
+}
+
+static double
+Vec_x__c2(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->x;
+}
+
+static double
+Vec_initialize__c1(mrb_value __self__, double x, double y, double z)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->x = x;
+	data->y = y;
+	data->z = z;
+	return data->z;
+}
+
+static mrb_value
+Vec_new__c1(mrb_value __self__, double x, double y, double z)
+{
+	mrb_value obj;
+	struct RData * data;
+	cVec *sval;
+	Data_Make_Struct(mrb, mrb_class_ptr(__self__), cVec, &hpc_data_type, sval, data);
+	sval->type = T_Vec;
+	obj = mrb_obj_value(data);
+	Vec_initialize__c1(obj, x, y, z);
+	return obj;
+}
+
+static mrb_value
+swap(mrb_value __self__)
+{
+	mrb_value v = mrb_nil_value();
+	mrb_value *__roots1[] = { &v };
+	HPC_FRAME_PUSH(__frame1, __roots1);
+
+	v = Vec_new__c1(Vec, 1.0, 2.0, 3.0);
+	v = Vec_new__c1(Vec, ((cVec *)DATA_PTR(v))->y, ((cVec *)DATA_PTR(v))->x, ((cVec *)DATA_PTR(v))->z);
+	{
+		mrb_value __ret = mrb_float_value(((cVec *)DATA_PTR(v))->x);
+		HPC_FRAME_POP(__frame1);
+		return __ret;
+	}
+}
+
+static mrb_value
+escape(mrb_value __self__)
+{
+	mrb_value v = mrb_nil_value();
+	mrb_value *__roots2[] = { &v };
+	HPC_FRAME_PUSH(__frame2, __roots2);
+
+	v = Vec_new__c1(Vec, 1.0, 2.0, 3.0);
+	((cVec *)DATA_PTR(v))->x = 4.0;
+	{
+		mrb_value __ret = v;
+		HPC_FRAME_POP(__frame2);
+		return __ret;
+	}
+}
+
+static mrb_value
+sum(mrb_value __self__, mrb_value k)
+{
+	double rad__x;
+	double rad__y;
+	double rad__z;
+
+	rad__x = 0.0;
+	rad__y = 0.0;
+	rad__z = 0.0;
+	{
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = mrb_fixnum(k);
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				rad__x = (rad__x + ((mrb_float)i));
+				rad__y = (rad__y + 0.5);
+				rad__z = (rad__z - rad__x);
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	return mrb_float_value(((rad__x + rad__y) + rad__z));
+}
+
+static double
+swap__c13(mrb_value __self__)
+{
+	mrb_value v = mrb_nil_value();
+	mrb_value *__roots3[] = { &v };
+	HPC_FRAME_PUSH(__frame3, __roots3);
+
+	v = Vec_new__c1(Vec, 1.0, 2.0, 3.0);
+	v = Vec_new__c1(Vec, ((cVec *)DATA_PTR(v))->y, ((cVec *)DATA_PTR(v))->x, ((cVec *)DATA_PTR(v))->z);
+	{
+		double __ret = ((cVec *)DATA_PTR(v))->x;
+		HPC_FRAME_POP(__frame3);
+		return __ret;
+	}
+}
+
+static mrb_value
+escape__c12(mrb_value __self__)
+{
+	mrb_value v = mrb_nil_value();
+	mrb_value *__roots4[] = { &v };
+	HPC_FRAME_PUSH(__frame4, __roots4);
+
+	v = Vec_new__c1(Vec, 1.0, 2.0, 3.0);
+	((cVec *)DATA_PTR(v))->x = 4.0;
+	{
+		mrb_value __ret = v;
+		HPC_FRAME_POP(__frame4);
+		return __ret;
+	}
+}
+
+static double
+sum__c11(mrb_value __self__, mrb_int k)
+{
+	double rad__x;
+	double rad__y;
+	double rad__z;
+
+	rad__x = 0.0;
+	rad__y = 0.0;
+	rad__z = 0.0;
+	{
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = k;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				rad__x = (rad__x + ((mrb_float)i));
+				rad__y = (rad__y + 0.5);
+				rad__z = (rad__z - rad__x);
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	return ((rad__x + rad__y) + rad__z);
+}
+
+mrb_value
+sum_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	return sum(__self__, arg0);
+}mrb_value
+escape_0(int val, mrb_value __self__)
+{
+	return escape(__self__);
+}mrb_value
+swap_0(int val, mrb_value __self__)
+{
+	return swap(__self__);
+}mrb_value
+x_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Vec:
+			result = Vec_x(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "x", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+y_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Vec:
+			result = Vec_y(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "y", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+z_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Vec:
+			result = Vec_z(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "z", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+x_set_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Vec:
+			result = Vec_x_set(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "x=", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+y_set_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Vec:
+			result = Vec_y_set(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "y=", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+z_set_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Vec:
+			result = Vec_z_set(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "z=", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+n_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Counter:
+			result = Counter_n(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "n", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+n_set_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Counter:
+			result = Counter_n_set(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "n=", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
@@ -0,0 +1,270 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+mrb_value
+scale_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);
+mrb_value
+fill_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);
+
+static mrb_value
+fill(mrb_value __self__, mrb_value a, mrb_value n, mrb_value x);
+static mrb_value
+scale(mrb_value __self__, mrb_value a, mrb_value n);
+static mrb_value
+fill__c2(mrb_value __self__, mrb_value a, mrb_int n, mrb_int x);
+static mrb_value
+scale__c1(mrb_value __self__, mrb_value a, mrb_int n);
+
+void
+init_global_syms(mrb_state * mrb)
+{
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { NULL };
+	mrb_value base = mrb_nil_value();
+	mrb_value part = mrb_nil_value();
+	mrb_value rest = mrb_nil_value();
+	mrb_value whole = mrb_nil_value();
+	mrb_value *__roots1[] = { &base, &part, &rest, &whole };
+	HPC_FRAME_PUSH(__frame1, __roots1);
+
+	base = mrb_funcall(mrb, mrb_obj_value(mrb->array_class), "new", 1, mrb_fixnum_value(6));
+	{
+		mrb_int __tmp_2 = 6;
+
+		if ( mrb_bool(hpc_ary_inplace_p_2(1, base, mrb_fixnum_value(0), mrb_fixnum_value(6))) )
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 6;
+			mrb_int __i_first = __i;
+#pragma omp parallel for if (hpc_ary_writable(base, __i_first, __i_last))
+			for (__i = __i_first; __i < __i_last; ++__i) {
+				mrb_int i = __i;
+				hpc_ary_fset(base, i, (((mrb_float)i) * 1.5));
+			}
+		}
+		else		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 6;
+			mrb_int __i_first = __i;
+#pragma omp parallel for if (hpc_ary_writable(base, __i_first, __i_last))
+			for (__i = __i_first; __i < __i_last; ++__i) {
+				mrb_int i = __i;
+				hpc_ary_aset_2(1, base, mrb_fixnum_value(i), mrb_float_value((((mrb_float)i) * 1.5)));
+			}
+		}
+	}
+	part = mrb_funcall(mrb, base, "[]", 2, mrb_fixnum_value(1), mrb_fixnum_value(4));
+	scale__c1(__self__, part, 4);
+	puts_1(0, __self__, hpc_ary_aget_1(1, part, mrb_fixnum_value(0)));
+	puts_1(0, __self__, hpc_ary_aget_1(1, part, mrb_fixnum_value(3)));
+	puts_1(0, __self__, hpc_ary_vref(base, 1));
+	puts_1(0, __self__, hpc_ary_vref(base, 4));
+	rest = mrb_funcall(mrb, base, "[]", 2, mrb_fixnum_value(2), mrb_fixnum_value(3));
+	fill__c2(__self__, rest, 3, 7);
+	puts_1(0, __self__, hpc_ary_aget_1(1, rest, mrb_fixnum_value(2)));
+	puts_1(0, __self__, hpc_ary_vref(base, 4));
+	fill__c2(__self__, rest, 0, 9);
+	puts_1(0, __self__, hpc_ary_aget_1(1, rest, mrb_fixnum_value(0)));
+	whole = mrb_funcall(mrb, base, "[]", 2, mrb_fixnum_value(0), mrb_fixnum_value(6));
+	{
+		mrb_int __tmp_5 = 6;
+
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 6;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				hpc_ary_aset_2(0, whole, mrb_fixnum_value(i), mrb_float_value((((mrb_float)i) * 0.25)));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	puts_1(0, __self__, hpc_ary_aget_1(1, whole, mrb_fixnum_value(5)));
+	puts_1(0, __self__, hpc_ary_vref(base, 5));
+	HPC_FRAME_POP(__frame1);
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+static mrb_value
+fill(mrb_value __self__, mrb_value a, mrb_value n, mrb_value x)
+{
+	{
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = mrb_fixnum(n);
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				hpc_ary_aset_2(0, a, mrb_fixnum_value(i), x);
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	return a;
+}
+
+static mrb_value
+scale(mrb_value __self__, mrb_value a, mrb_value n)
+{
+	{
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = mrb_fixnum(n);
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				hpc_ary_aset_2(0, a, mrb_fixnum_value(i), num_mul_1(1, hpc_ary_aget_1(1, a, mrb_fixnum_value(i)), mrb_float_value(2.0)));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	return a;
+}
+
+static mrb_value
+fill__c2(mrb_value __self__, mrb_value a, mrb_int n, mrb_int x)
+{
+	{
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = n;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				hpc_ary_aset_2(0, a, mrb_fixnum_value(i), mrb_fixnum_value(x));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	return a;
+}
+
+static mrb_value
+scale__c1(mrb_value __self__, mrb_value a, mrb_int n)
+{
+	{
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = n;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				hpc_ary_aset_2(0, a, mrb_fixnum_value(i), num_mul_1(1, hpc_ary_aget_1(1, a, mrb_fixnum_value(i)), mrb_float_value(2.0)));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	return a;
+}
+
+mrb_value
+scale_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	return scale(__self__, arg0, arg1);
+}mrb_value
+fill_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	return fill(__self__, arg0, arg1, arg2);
+}
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
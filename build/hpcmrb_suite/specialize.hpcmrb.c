@@ -0,0 +1,510 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+#define T_Vec 1001
+typedef struct {
+	int type;
+	double y;
+	double x;
+} cVec;
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+mrb_value
+scale_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);
+mrb_value
+hypot2_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);
+mrb_value
+fact_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+x_0(int val, mrb_value __self__);
+mrb_value
+y_0(int val, mrb_value __self__);
+mrb_value
+vadd_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+vscale_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+zero_0(int val, mrb_value __self__);
+
+static mrb_value
+Vec_zero(mrb_value __self__);
+static mrb_value
+Vec_vscale(mrb_value __self__, mrb_value k);
+static mrb_value
+Vec_vadd(mrb_value __self__, mrb_value b);
+static mrb_value
+Vec_y(mrb_value __self__);
+static mrb_value
+Vec_x(mrb_value __self__);
+static mrb_value
+Vec_initialize(mrb_value __self__, mrb_value x, mrb_value y);
+static mrb_value
+Vec_vscale__c12(mrb_value __self__, mrb_int k);
+static mrb_value
+Vec_vscale__c11(mrb_value __self__, double k);
+static double
+Vec_y__c9(mrb_value __self__);
+static double
+Vec_x__c8(mrb_value __self__);
+static mrb_value
+Vec_vadd__c10(mrb_value __self__, mrb_value b);
+static mrb_value
+Vec_zero__c7(mrb_value __self__);
+static double
+Vec_initialize__c1(mrb_value __self__, double x, double y);
+static mrb_value
+Vec_new__c1(mrb_value __self__, double x, double y);
+static mrb_value
+fact(mrb_value __self__, mrb_value n);
+static mrb_value
+hypot2(mrb_value __self__, mrb_value x, mrb_value y);
+static mrb_value
+scale(mrb_value __self__, mrb_value v, mrb_value k);
+static mrb_value
+fact__c5(mrb_value __self__, mrb_value n);
+static mrb_value
+fact__c6(mrb_value __self__, mrb_int n);
+static double
+hypot2__c4(mrb_value __self__, double x, double y);
+static mrb_value
+scale__c3(mrb_value __self__, mrb_int v, mrb_int k);
+static double
+scale__c2(mrb_value __self__, double v, double k);
+mrb_sym __i_y;
+mrb_sym __i_x;
+
+void
+init_global_syms(mrb_state * mrb)
+{
+	__i_y = mrb_intern(mrb, "y");
+	__i_x = mrb_intern(mrb, "x");
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void Vec_init(mrb_value __self__);
+mrb_value Vec;
+void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { &Vec };
+	static mrb_shadow_frame __global_frame;
+	__global_frame.prev = mrb->shadow_frames;
+	__global_frame.len = sizeof(__global_roots) / sizeof(__global_roots[0]);
+	__global_frame.roots = __global_roots;
+	mrb->shadow_frames = &__global_frame;
+	mrb_value v = mrb_nil_value();
+	mrb_value w = mrb_nil_value();
+	mrb_value *__roots1[] = { &v, &w };
+	HPC_FRAME_PUSH(__frame1, __roots1);
+
+	Vec = mrb_obj_value(mrb_define_class(mrb, "Vec", mrb->object_class));
+	Vec_init(Vec);
+	puts_1(0, __self__, mrb_float_value(scale__c2(__self__, 1.5, 2.0)));
+	puts_1(0, __self__, scale__c3(__self__, 3, 4));
+	puts_1(0, __self__, mrb_float_value(hypot2__c4(__self__, 3.0, 4.0)));
+	puts_1(0, __self__, fact__c6(__self__, 10));
+	v = Vec_vscale__c11(Vec_vadd__c10(Vec_zero__c7(Vec), Vec_new__c1(Vec, 1.0, 2.0)), 3.0);
+	puts_1(0, __self__, mrb_float_value(((cVec *)DATA_PTR(v))->x));
+	puts_1(0, __self__, mrb_float_value(((cVec *)DATA_PTR(v))->y));
+	w = Vec_vscale__c12(v, 2);
+	puts_1(0, __self__, mrb_float_value(((cVec *)DATA_PTR(w))->x));
+	HPC_FRAME_POP(__frame1);
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+	if (c == (struct RClass *)mrb_obj_ptr(Vec)) {
+		cVec *sval;
+		Data_Make_Struct(mrb, c, cVec, &hpc_data_type, sval, data);
+		sval->type = T_Vec;
+		obj = mrb_obj_value(data);
+		Vec_initialize(obj, arg0, arg1);
+} else {
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+void
+Vec_init(mrb_value __self__)
+{
+}
+
+static mrb_value
+Vec_zero(mrb_value __self__)
+{
+	return Vec_new__c1(Vec, 0.0, 0.0);
+}
+
+static mrb_value
+Vec_vscale(mrb_value __self__, mrb_value k)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return mrb_funcall(mrb, Vec, "new", 2, num_mul_1(1, mrb_float_value(data->x), k), num_mul_1(1, mrb_float_value(data->y), k));
+}
+
+static mrb_value
+Vec_vadd(mrb_value __self__, mrb_value b)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return mrb_funcall(mrb, Vec, "new", 2, num_add_1(1, mrb_float_value(data->x), x_0(1, b)), num_add_1(1, mrb_float_value(data->y), y_0(1, b)));
+}
+
+static mrb_value
+Vec_y(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return mrb_float_value(data->y);
+}
+
+static mrb_value
+Vec_x(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return mrb_float_value(data->x);
+}
+
+static mrb_value
+Vec_initialize(mrb_value __self__, mrb_value x, mrb_value y)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->x = hpc_to_float(x);
+	data->y = hpc_to_float(y);
+	return mrb_float_value(data->y);
+}
+
+static mrb_value
+Vec_vscale__c12(mrb_value __self__, mrb_int k)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return Vec_new__c1(Vec, (data->x * ((mrb_float)k)), (data->y * ((mrb_float)k)));
+}
+
+static mrb_value
+Vec_vscale__c11(mrb_value __self__, double k)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return Vec_new__c1(Vec, (data->x * k), (data->y * k));
+}
+
+static double
+Vec_y__c9(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->y;
+}
+
+static double
+Vec_x__c8(mrb_value __self__)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->x;
+}
+
+static mrb_value
+Vec_vadd__c10(mrb_value __self__, mrb_value b)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return Vec_new__c1(Vec, (data->x + ((cVec *)DATA_PTR(b))->x), (data->y + ((cVec *)DATA_PTR(b))->y));
+}
+
+static mrb_value
+Vec_zero__c7(mrb_value __self__)
+{
+	return Vec_new__c1(Vec, 0.0, 0.0);
+}
+
+static double
+Vec_initialize__c1(mrb_value __self__, double x, double y)
+{
+	cVec *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->x = x;
+	data->y = y;
+	return data->y;
+}
+
+static mrb_value
+Vec_new__c1(mrb_value __self__, double x, double y)
+{
+	mrb_value obj;
+	struct RData * data;
+	cVec *sval;
+	Data_Make_Struct(mrb, mrb_class_ptr(__self__), cVec, &hpc_data_type, sval, data);
+	sval->type = T_Vec;
+	obj = mrb_obj_value(data);
+	Vec_initialize__c1(obj, x, y);
+	return obj;
+}
+
+static mrb_value
+fact(mrb_value __self__, mrb_value n)
+{
+	if ( hpc_to_float(n) < ((mrb_float)2) )
+	{
+		return mrb_fixnum_value(1);
+	}
+	else	{
+		return num_mul_1(1, n, fact_1(1, __self__, num_sub_1(1, n, mrb_fixnum_value(1))));
+	}
+}
+
+static mrb_value
+hypot2(mrb_value __self__, mrb_value x, mrb_value y)
+{
+	return num_add_1(1, num_mul_1(1, x, x), num_mul_1(1, y, y));
+}
+
+static mrb_value
+scale(mrb_value __self__, mrb_value v, mrb_value k)
+{
+	return num_mul_1(1, v, k);
+}
+
+static mrb_value
+fact__c5(mrb_value __self__, mrb_value n)
+{
+	if ( hpc_to_float(n) < ((mrb_float)2) )
+	{
+		return mrb_fixnum_value(1);
+	}
+	else	{
+		return num_mul_1(1, n, fact_1(1, __self__, num_sub_1(1, n, mrb_fixnum_value(1))));
+	}
+}
+
+static mrb_value
+fact__c6(mrb_value __self__, mrb_int n)
+{
+	if ( n < 2 )
+	{
+		return mrb_fixnum_value(1);
+	}
+	else	{
+		return num_mul_1(1, mrb_fixnum_value(n), fact__c5(__self__, hpc_int_sub(n, 1)));
+	}
+}
+
+static double
+hypot2__c4(mrb_value __self__, double x, double y)
+{
+	return ((x * x) + (y * y));
+}
+
+static mrb_value
+scale__c3(mrb_value __self__, mrb_int v, mrb_int k)
+{
+	return hpc_int_mul(v, k);
+}
+
+static double
+scale__c2(mrb_value __self__, double v, double k)
+{
+	return (v * k);
+}
+
+mrb_value
+scale_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	return scale(__self__, arg0, arg1);
+}mrb_value
+hypot2_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	return hypot2(__self__, arg0, arg1);
+}mrb_value
+fact_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	return fact(__self__, arg0);
+}mrb_value
+x_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Vec:
+			result = Vec_x(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "x", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+y_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Vec:
+			result = Vec_y(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "y", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+vadd_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Vec:
+			result = Vec_vadd(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "vadd", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+vscale_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Vec:
+			result = Vec_vscale(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "vscale", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+zero_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+	if (hpc_class_eq(__self__, Vec)) {
+		result = Vec_zero(__self__);
+	} else {
+		switch (hpc_type_of(__self__)) {
+		default:
+			result = mrb_funcall(mrb, __self__, "zero", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
@@ -0,0 +1,343 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+#define T_Spring 1001
+typedef struct {
+	int type;
+	double k;
+} cSpring;
+
+#define T_Body 1002
+typedef struct {
+	int type;
+	double m;
+} cBody;
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+mrb_value
+scale_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);
+mrb_value
+energy_1(int val, mrb_value __self__, mrb_value arg0);
+
+static mrb_value
+Spring_energy(mrb_value __self__, mrb_value x);
+static mrb_value
+Spring_initialize(mrb_value __self__, mrb_value k);
+static double
+Spring_initialize__c2(mrb_value __self__, double k);
+static mrb_value
+Spring_new__c2(mrb_value __self__, double k);
+static mrb_value
+Body_energy(mrb_value __self__, mrb_value v);
+static mrb_value
+Body_initialize(mrb_value __self__, mrb_value m);
+static double
+Body_initialize__c1(mrb_value __self__, double m);
+static mrb_value
+Body_new__c1(mrb_value __self__, double m);
+static mrb_value
+scale(mrb_value __self__, mrb_value x, mrb_value n);
+static mrb_value
+scale__c3(mrb_value __self__, mrb_value x, mrb_value n);
+mrb_sym __i_k;
+mrb_sym __i_m;
+
+void
+init_global_syms(mrb_state * mrb)
+{
+	__i_k = mrb_intern(mrb, "k");
+	__i_m = mrb_intern(mrb, "m");
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void Spring_init(mrb_value __self__);
+void Body_init(mrb_value __self__);
+mrb_value Body;
+mrb_value Spring;
+void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { &Body, &Spring };
+	static mrb_shadow_frame __global_frame;
+	__global_frame.prev = mrb->shadow_frames;
+	__global_frame.len = sizeof(__global_roots) / sizeof(__global_roots[0]);
+	__global_frame.roots = __global_roots;
+	mrb->shadow_frames = &__global_frame;
+	mrb_value objs = mrb_nil_value();
+	mrb_value vals = mrb_nil_value();
+	mrb_value total = mrb_nil_value();
+	mrb_value counts = mrb_nil_value();
+	mrb_value *__roots1[] = { &objs, &vals, &total, &counts };
+	HPC_FRAME_PUSH(__frame1, __roots1);
+
+	Body = mrb_obj_value(mrb_define_class(mrb, "Body", mrb->object_class));
+	Body_init(Body);
+	Spring = mrb_obj_value(mrb_define_class(mrb, "Spring", mrb->object_class));
+	Spring_init(Spring);
+	objs = mrb_funcall(mrb, mrb_obj_value(mrb->array_class), "new", 0);
+	hpc_ary_aset_2(0, objs, mrb_fixnum_value(0), Body_new__c1(Body, 2.0));
+	hpc_ary_aset_2(0, objs, mrb_fixnum_value(1), Spring_new__c2(Spring, 3.0));
+	hpc_ary_aset_2(0, objs, mrb_fixnum_value(2), Body_new__c1(Body, 0.5));
+	vals = mrb_funcall(mrb, mrb_obj_value(mrb->array_class), "new", 0);
+	hpc_ary_aset_2(0, vals, mrb_fixnum_value(0), mrb_float_value(1.5));
+	hpc_ary_aset_2(0, vals, mrb_fixnum_value(1), mrb_float_value(0.25));
+	hpc_ary_aset_2(0, vals, mrb_fixnum_value(2), mrb_float_value(4.0));
+	total = mrb_float_value(0.0);
+	{
+		mrb_int __tmp_1 = 3;
+
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 3;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				total = num_add_1(1, total, energy_1(1, hpc_ary_vref(objs, i), hpc_ary_vref(vals, i)));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	puts_1(0, __self__, total);
+	counts = mrb_funcall(mrb, mrb_obj_value(mrb->array_class), "new", 0);
+	hpc_ary_aset_2(0, counts, mrb_fixnum_value(0), mrb_fixnum_value(3));
+	hpc_ary_aset_2(0, counts, mrb_fixnum_value(1), mrb_fixnum_value(4));
+	puts_1(0, __self__, scale__c3(__self__, hpc_ary_vref(vals, 0), hpc_ary_vref(counts, 1)));
+	puts_1(0, __self__, scale__c3(__self__, hpc_ary_vref(vals, 2), hpc_ary_vref(counts, 0)));
+	HPC_FRAME_POP(__frame1);
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+	if (c == (struct RClass *)mrb_obj_ptr(Body)) {
+		cBody *sval;
+		Data_Make_Struct(mrb, c, cBody, &hpc_data_type, sval, data);
+		sval->type = T_Body;
+		obj = mrb_obj_value(data);
+		Body_initialize(obj, arg0);
+} else 	if (c == (struct RClass *)mrb_obj_ptr(Spring)) {
+		cSpring *sval;
+		Data_Make_Struct(mrb, c, cSpring, &hpc_data_type, sval, data);
+		sval->type = T_Spring;
+		obj = mrb_obj_value(data);
+		Spring_initialize(obj, arg0);
+} else {
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+void
+Spring_init(mrb_value __self__)
+{
+}
+
+void
+Body_init(mrb_value __self__)
+{
+}
+
+static mrb_value
+Spring_energy(mrb_value __self__, mrb_value x)
+{
+	cSpring *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return num_mul_1(1, num_mul_1(1, mrb_float_value((0.5 * data->k)), x), x);
+}
+
+static mrb_value
+Spring_initialize(mrb_value __self__, mrb_value k)
+{
+	cSpring *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->k = hpc_to_float(k);
+	return mrb_float_value(data->k);
+}
+
+static double
+Spring_initialize__c2(mrb_value __self__, double k)
+{
+	cSpring *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->k = k;
+	return data->k;
+}
+
+static mrb_value
+Spring_new__c2(mrb_value __self__, double k)
+{
+	mrb_value obj;
+	struct RData * data;
+	cSpring *sval;
+	Data_Make_Struct(mrb, mrb_class_ptr(__self__), cSpring, &hpc_data_type, sval, data);
+	sval->type = T_Spring;
+	obj = mrb_obj_value(data);
+	Spring_initialize__c2(obj, k);
+	return obj;
+}
+
+static mrb_value
+Body_energy(mrb_value __self__, mrb_value v)
+{
+	cBody *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return num_mul_1(1, num_mul_1(1, mrb_float_value((0.5 * data->m)), v), v);
+}
+
+static mrb_value
+Body_initialize(mrb_value __self__, mrb_value m)
+{
+	cBody *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->m = hpc_to_float(m);
+	return mrb_float_value(data->m);
+}
+
+static double
+Body_initialize__c1(mrb_value __self__, double m)
+{
+	cBody *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->m = m;
+	return data->m;
+}
+
+static mrb_value
+Body_new__c1(mrb_value __self__, double m)
+{
+	mrb_value obj;
+	struct RData * data;
+	cBody *sval;
+	Data_Make_Struct(mrb, mrb_class_ptr(__self__), cBody, &hpc_data_type, sval, data);
+	sval->type = T_Body;
+	obj = mrb_obj_value(data);
+	Body_initialize__c1(obj, m);
+	return obj;
+}
+
+static mrb_value
+scale(mrb_value __self__, mrb_value x, mrb_value n)
+{
+	return num_mul_1(1, x, n);
+}
+
+static mrb_value
+scale__c3(mrb_value __self__, mrb_value x, mrb_value n)
+{
+	return num_mul_1(1, x, n);
+}
+
+mrb_value
+scale_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	return scale(__self__, arg0, arg1);
+}mrb_value
+energy_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Body:
+			result = Body_energy(__self__, arg0);
+			break;
+		case T_Spring:
+			result = Spring_energy(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "energy", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
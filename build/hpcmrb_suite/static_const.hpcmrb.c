@@ -0,0 +1,285 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+#define T_Grid 1001
+typedef struct {
+	int type;
+} cGrid;
+
+#define T_Scene 1002
+typedef struct {
+	int type;
+} cScene;
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+mrb_value
+span_0(int val, mrb_value __self__);
+mrb_value
+cells_0(int val, mrb_value __self__);
+
+static mrb_value
+Grid_cells(mrb_value __self__);
+static mrb_value
+Grid_cells__c2(mrb_value __self__);
+static mrb_value
+Scene_span(mrb_value __self__);
+static double
+Scene_span__c1(mrb_value __self__);
+
+void
+init_global_syms(mrb_state * mrb)
+{
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void Grid_init(mrb_value __self__);
+void Scene_init(mrb_value __self__);
+static const mrb_int W = 4;
+static const mrb_int N = 16;
+static const double NF = 16;
+static const double HALF = 2.5;
+mrb_value LIMIT;
+static const mrb_int SIZE = 8;
+static const double STEP = 0.125;
+mrb_value Scene;
+static const mrb_int CELLS = 64;
+mrb_value Grid;
+void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { &LIMIT, &Scene, &Grid };
+	static mrb_shadow_frame __global_frame;
+	__global_frame.prev = mrb->shadow_frames;
+	__global_frame.len = sizeof(__global_roots) / sizeof(__global_roots[0]);
+	__global_frame.roots = __global_roots;
+	mrb->shadow_frames = &__global_frame;
+	LIMIT = mrb_fixnum_value(100);
+	Scene = mrb_obj_value(mrb_define_class(mrb, "Scene", mrb->object_class));
+	Scene_init(Scene);
+	Grid = mrb_obj_value(mrb_define_class(mrb, "Grid", mrb->object_class));
+	Grid_init(Grid);
+	{
+		mrb_int __tmp_3 = 4;
+
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 4;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				(hpc_output_int(((i * 16) + 4)), hpc_output_write("\n", 1), mrb_nil_value());
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	{
+		mrb_int __tmp_4 = 4;
+
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 4;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				puts_1(0, __self__, mrb_float_value(((((mrb_float)i) * 2.5) - 16.0)));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	puts_1(0, __self__, mrb_float_value(Scene_span__c1(Scene)));
+	puts_1(0, __self__, mrb_float_value(40.0));
+	puts_1(0, __self__, Grid_cells__c2(mrb_funcall(mrb, Grid, "new", 0)));
+	(hpc_output_int(4), hpc_output_write(" ", 1), hpc_output_int(16), hpc_output_write("\n", 1), mrb_nil_value());
+	{
+		mrb_value __tmp_5 = LIMIT;
+		mrb_value *__roots1[] = { &__tmp_5 };
+		HPC_FRAME_PUSH(__frame1, __roots1);
+
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = mrb_fixnum(__tmp_5);
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				if ( i == 3 )
+				LIMIT = mrb_fixnum_value(i);
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+		HPC_FRAME_POP(__frame1);
+	}
+	puts_1(0, __self__, LIMIT);
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+void
+Grid_init(mrb_value __self__)
+{
+}
+
+void
+Scene_init(mrb_value __self__)
+{
+}
+
+static mrb_value
+Grid_cells(mrb_value __self__)
+{
+	cGrid *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return num_sub_1(1, mrb_fixnum_value(64), LIMIT);
+}
+
+static mrb_value
+Grid_cells__c2(mrb_value __self__)
+{
+	cGrid *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return num_sub_1(1, mrb_fixnum_value(64), LIMIT);
+}
+
+static mrb_value
+Scene_span(mrb_value __self__)
+{
+	return mrb_float_value(3.5);
+}
+
+static double
+Scene_span__c1(mrb_value __self__)
+{
+	return 3.5;
+}
+
+mrb_value
+span_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+	if (hpc_class_eq(__self__, Scene)) {
+		result = Scene_span(__self__);
+	} else {
+		switch (hpc_type_of(__self__)) {
+		default:
+			result = mrb_funcall(mrb, __self__, "span", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+cells_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Grid:
+			result = Grid_cells(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "cells", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
@@ -0,0 +1,367 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+mrb_value
+label_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+tag_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);
+mrb_value
+bump_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+letters_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+order_0(int val, mrb_value __self__);
+
+static mrb_value
+order(mrb_value __self__);
+static mrb_value
+letters(mrb_value __self__, mrb_value n);
+static mrb_value
+bump(mrb_value __self__, mrb_value s);
+static mrb_value
+tag(mrb_value __self__, mrb_value name, mrb_value n);
+static mrb_value
+label(mrb_value __self__, mrb_value i);
+static mrb_int
+bump__c6(mrb_value __self__, mrb_value s);
+static mrb_value
+order__c7(mrb_value __self__);
+static mrb_value
+tag__c5(mrb_value __self__, mrb_value name, mrb_int n);
+static mrb_value
+label__c3(mrb_value __self__, mrb_int i);
+static mrb_int
+letters__c4(mrb_value __self__, mrb_int n);
+static mrb_int
+bump__c2(mrb_value __self__, mrb_value s);
+static mrb_value
+label__c1(mrb_value __self__, mrb_int i);
+
+void
+init_global_syms(mrb_state * mrb)
+{
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);static const mrb_int W = 256;
+static const mrb_int H = 128;
+void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { NULL };
+	(hpc_output_int(256), hpc_output_write(" ", 1), hpc_output_int(128), hpc_output_write("\n", 1), mrb_nil_value());
+	(hpc_output_write("P6\n", 3), mrb_nil_value());
+	(hpc_output_write("done\n", 5), mrb_nil_value());
+	(hpc_output_int(256), hpc_output_write("\n", 1), mrb_nil_value());
+	(hpc_output_chr(65), mrb_nil_value());
+	letters__c4(__self__, 4);
+	puts_1(0, __self__, tag__c5(__self__, mrb_str_new(mrb, "a", 1), 3));
+	order__c7(__self__);
+	(hpc_output_int((-12)), hpc_output_write("/", 1), hpc_output_int(0), hpc_output_write("\n", 1), mrb_nil_value());
+	(hpc_output_write("abc\n", 4), mrb_nil_value());
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+static mrb_value
+order(mrb_value __self__)
+{
+	mrb_value t = mrb_nil_value();
+	mrb_value u = mrb_nil_value();
+	mrb_value *__roots1[] = { &t, &u };
+	HPC_FRAME_PUSH(__frame1, __roots1);
+
+	t = mrb_str_new(mrb, "x", 1);
+	u = num_add_1(1, t, ({
+		mrb_value __s = mrb_str_buf_new(mrb, 21);
+		hpc_str_cat_int(__s, bump__c2(__self__, t));
+		__s;
+	}));
+	puts_1(0, __self__, u);
+	{
+		mrb_value __ret = puts_1(1, __self__, t);
+		HPC_FRAME_POP(__frame1);
+		return __ret;
+	}
+}
+
+static mrb_value
+letters(mrb_value __self__, mrb_value n)
+{
+	{
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = mrb_fixnum(n);
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				(hpc_output_chr((i ^ 96)), mrb_nil_value());
+				puts_1(0, __self__, label__c1(__self__, i));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+		return n;
+	}
+}
+
+static mrb_value
+bump(mrb_value __self__, mrb_value s)
+{
+	num_lshift_1(0, s, mrb_str_new(mrb, "!", 1));
+	return mrb_fixnum_value(1);
+}
+
+static mrb_value
+tag(mrb_value __self__, mrb_value name, mrb_value n)
+{
+	mrb_value s = mrb_nil_value();
+	mrb_value *__roots2[] = { &s };
+	HPC_FRAME_PUSH(__frame2, __roots2);
+
+	s = num_add_1(1, mrb_str_new(mrb, "<", 1), name);
+	num_lshift_1(0, num_lshift_1(1, num_lshift_1(1, s, mrb_str_new(mrb, " n=", 3)), to_s_0(1, n)), mrb_str_new(mrb, ">", 1));
+	{
+		mrb_value __ret = s;
+		HPC_FRAME_POP(__frame2);
+		return __ret;
+	}
+}
+
+static mrb_value
+label(mrb_value __self__, mrb_value i)
+{
+	return num_add_1(1, num_add_1(1, num_add_1(1, mrb_str_new(mrb, "item", 4), to_s_0(1, i)), mrb_str_new(mrb, ":", 1)), to_s_0(1, num_lshift_1(1, i, mrb_fixnum_value(1))));
+}
+
+static mrb_int
+bump__c6(mrb_value __self__, mrb_value s)
+{
+	({
+		mrb_value __s = s;
+		mrb_str_cat(mrb, __s, "!", 1);
+		__s;
+	});
+	return 1;
+}
+
+static mrb_value
+order__c7(mrb_value __self__)
+{
+	mrb_value t = mrb_nil_value();
+	mrb_value u = mrb_nil_value();
+	mrb_value *__roots3[] = { &t, &u };
+	HPC_FRAME_PUSH(__frame3, __roots3);
+
+	t = mrb_str_new(mrb, "x", 1);
+	u = num_add_1(1, t, ({
+		mrb_value __s = mrb_str_buf_new(mrb, 21);
+		hpc_str_cat_int(__s, bump__c6(__self__, t));
+		__s;
+	}));
+	puts_1(0, __self__, u);
+	{
+		mrb_value __ret = puts_1(1, __self__, t);
+		HPC_FRAME_POP(__frame3);
+		return __ret;
+	}
+}
+
+static mrb_value
+tag__c5(mrb_value __self__, mrb_value name, mrb_int n)
+{
+	mrb_value s = mrb_nil_value();
+	mrb_value *__roots4[] = { &s };
+	HPC_FRAME_PUSH(__frame4, __roots4);
+
+	s = ({
+		mrb_value __s = mrb_str_buf_new(mrb, 1);
+		mrb_str_cat(mrb, __s, "<", 1);
+		mrb_str_concat(mrb, __s, name);
+		__s;
+	});
+	({
+		mrb_value __s = s;
+		mrb_str_cat(mrb, __s, " n=", 3);
+		hpc_str_cat_int(__s, n);
+		mrb_str_cat(mrb, __s, ">", 1);
+		__s;
+	});
+	{
+		mrb_value __ret = s;
+		HPC_FRAME_POP(__frame4);
+		return __ret;
+	}
+}
+
+static mrb_value
+label__c3(mrb_value __self__, mrb_int i)
+{
+	return ({
+		mrb_value __s = mrb_str_buf_new(mrb, 47);
+		mrb_str_cat(mrb, __s, "item", 4);
+		hpc_str_cat_int(__s, i);
+		mrb_str_cat(mrb, __s, ":", 1);
+		hpc_str_cat_int(__s, hpc_lshift_int(i, 1));
+		__s;
+	});
+}
+
+static mrb_int
+letters__c4(mrb_value __self__, mrb_int n)
+{
+	{
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = n;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				(hpc_output_chr((i ^ 96)), mrb_nil_value());
+				puts_1(0, __self__, label__c3(__self__, i));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+		return n;
+	}
+}
+
+static mrb_int
+bump__c2(mrb_value __self__, mrb_value s)
+{
+	({
+		mrb_value __s = s;
+		mrb_str_cat(mrb, __s, "!", 1);
+		__s;
+	});
+	return 1;
+}
+
+static mrb_value
+label__c1(mrb_value __self__, mrb_int i)
+{
+	return ({
+		mrb_value __s = mrb_str_buf_new(mrb, 47);
+		mrb_str_cat(mrb, __s, "item", 4);
+		hpc_str_cat_int(__s, i);
+		mrb_str_cat(mrb, __s, ":", 1);
+		hpc_str_cat_int(__s, hpc_lshift_int(i, 1));
+		__s;
+	});
+}
+
+mrb_value
+label_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	return label(__self__, arg0);
+}mrb_value
+tag_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	return tag(__self__, arg0, arg1);
+}mrb_value
+bump_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	return bump(__self__, arg0);
+}mrb_value
+letters_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	return letters(__self__, arg0);
+}mrb_value
+order_0(int val, mrb_value __self__)
+{
+	return order(__self__);
+}
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
@@ -0,0 +1,593 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "mruby/dump.h"
+#include "mruby/proc.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+#define T_Counter 1001
+typedef struct {
+	int type;
+	mrb_value n;
+} cCounter;
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	case T_Counter:
+		mrb_gc_mark_value(mrb, ((cCounter *)p)->n);
+		break;
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+mrb_value
+total_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+check_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+add_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+n_0(int val, mrb_value __self__);
+
+static void
+hpc_vm_init(mrb_state *mrb);
+
+static void
+hpc_vm_main(mrb_state *mrb);
+
+static mrb_value
+Counter_n(mrb_value __self__);
+static mrb_value
+Counter_add(mrb_value __self__, mrb_value x);
+static mrb_value
+Counter_initialize(mrb_value __self__);
+static mrb_value
+Counter_n__c3(mrb_value __self__);
+static mrb_value
+Counter_add__c2(mrb_value __self__, mrb_value x);
+static mrb_value
+Counter_initialize__c1(mrb_value __self__);
+static mrb_value
+Counter_new__c1(mrb_value __self__);
+static mrb_value
+check(mrb_value __self__, mrb_value x);
+static mrb_value
+total(mrb_value __self__, mrb_value n);
+mrb_sym __i_n;
+
+void
+init_global_syms(mrb_state * mrb)
+{
+	__i_n = mrb_intern(mrb, "n");
+	hpc_vm_init(mrb);
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void Counter_init(mrb_value __self__);
+mrb_value Counter;
+void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { &Counter };
+	static mrb_shadow_frame __global_frame;
+	__global_frame.prev = mrb->shadow_frames;
+	__global_frame.len = sizeof(__global_roots) / sizeof(__global_roots[0]);
+	__global_frame.roots = __global_roots;
+	mrb->shadow_frames = &__global_frame;
+	Counter = mrb_const_get(mrb, mrb_obj_value(mrb->object_class), mrb_intern(mrb, "Counter"));
+	Counter_init(Counter);
+	hpc_vm_main(mrb);
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+	if (c == (struct RClass *)mrb_obj_ptr(Counter)) {
+		cCounter *sval;
+		Data_Make_Struct(mrb, c, cCounter, &hpc_data_type, sval, data);
+		sval->type = T_Counter;
+		obj = mrb_obj_value(data);
+		Counter_initialize(obj);
+} else {
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+void
+Counter_init(mrb_value __self__)
+{
+}
+
+static mrb_value
+Counter_n(mrb_value __self__)
+{
+	cCounter *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->n;
+}
+
+static mrb_value
+Counter_add(mrb_value __self__, mrb_value x)
+{
+	cCounter *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->n = num_add_1(1, data->n, x);
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->n);
+	return data->n;
+}
+
+static mrb_value
+Counter_initialize(mrb_value __self__)
+{
+	cCounter *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->n = mrb_fixnum_value(0);
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->n);
+	return data->n;
+}
+
+static mrb_value
+Counter_n__c3(mrb_value __self__)
+{
+	cCounter *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->n;
+}
+
+static mrb_value
+Counter_add__c2(mrb_value __self__, mrb_value x)
+{
+	cCounter *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->n = num_add_1(1, data->n, x);
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->n);
+	return data->n;
+}
+
+static mrb_value
+Counter_initialize__c1(mrb_value __self__)
+{
+	cCounter *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->n = mrb_fixnum_value(0);
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->n);
+	return data->n;
+}
+
+static mrb_value
+Counter_new__c1(mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	cCounter *sval;
+	Data_Make_Struct(mrb, mrb_class_ptr(__self__), cCounter, &hpc_data_type, sval, data);
+	sval->type = T_Counter;
+	obj = mrb_obj_value(data);
+	Counter_initialize__c1(obj);
+	return obj;
+}
+
+static mrb_value
+check(mrb_value __self__, mrb_value x)
+{
+	if ( mrb_bool(num_gt_1(1, x, mrb_fixnum_value(10))) )
+	mrb_funcall(mrb, __self__, "raise", 2, mrb_funcall(mrb, mrb_obj_value(mrb->object_class), "const_get", 1, mrb_str_new(mrb, "TooBig", 6)), mrb_str_new(mrb, "too big", 7));
+	return x;
+}
+
+static mrb_value
+total(mrb_value __self__, mrb_value n)
+{
+	mrb_value c = mrb_nil_value();
+	mrb_value *__roots1[] = { &c };
+	HPC_FRAME_PUSH(__frame1, __roots1);
+
+	c = Counter_new__c1(Counter);
+	{
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = mrb_fixnum(n);
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				Counter_add__c2(c, mrb_funcall(mrb, mrb_funcall(mrb, mrb_funcall(mrb, mrb_obj_value(mrb->object_class), "const_get", 1, mrb_str_new(mrb, "Rect", 4)), "new", 2, mrb_fixnum_value(i), mrb_fixnum_value(2)), "area", 0));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	{
+		mrb_value __ret = ((cCounter *)DATA_PTR(c))->n;
+		HPC_FRAME_POP(__frame1);
+		return __ret;
+	}
+}
+
+mrb_value
+total_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	return total(__self__, arg0);
+}mrb_value
+check_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	return check(__self__, arg0);
+}mrb_value
+add_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Counter:
+			result = Counter_add(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "add", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+n_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Counter:
+			result = Counter_n(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "n", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+
+#include <stdint.h>
+const uint8_t hpc_vm_irep[] = {
+0x52,0x49,0x54,0x45,0x30,0x30,0x30,0x31,0x05,0x0b,0x00,0x00,0x09,0x9e,0x4d,0x41,
+0x54,0x5a,0x30,0x30,0x30,0x30,0x49,0x52,0x45,0x50,0x00,0x00,0x04,0xa4,0x30,0x30,
+0x30,0x30,0x00,0x0e,0x00,0xd8,0x00,0x00,0x00,0x35,0x00,0x01,0x00,0x02,0x00,0x00,
+0x00,0x05,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x80,
+0x00,0x05,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x0a,
+0x73,0x61,0x66,0x65,0x5f,0x63,0x68,0x65,0x63,0x6b,0x00,0x00,0x00,0x00,0xaa,0x00,
+0x04,0x00,0x07,0x00,0x00,0x00,0x18,0x02,0x00,0x00,0x26,0x00,0x40,0x02,0x1a,0x02,
+0x00,0x00,0x06,0x02,0x80,0x40,0x01,0x02,0x00,0x00,0xa0,0x00,0x40,0x08,0x17,0x02,
+0x00,0x00,0x1b,0x02,0x80,0x00,0x91,0x03,0x01,0x00,0x01,0x02,0x80,0x80,0xa0,0x02,
+0xc0,0x00,0x98,0x00,0x40,0x04,0x97,0x01,0x81,0x00,0x01,0x02,0x00,0x00,0x06,0x02,
+0x80,0x00,0x3d,0x03,0x00,0xc0,0x01,0x03,0x01,0x00,0x20,0x02,0x81,0x80,0x3e,0x02,
+0x00,0xc0,0xa0,0x02,0x3f,0xff,0x83,0x00,0x40,0x01,0x17,0x02,0x00,0x00,0x1d,0x00,
+0x80,0x00,0x1c,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x02,0x10,0x00,0x08,0x72,0x65,
+0x73,0x63,0x75,0x65,0x64,0x20,0x10,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x63,
+0x68,0x65,0x63,0x6b,0x00,0x00,0x06,0x54,0x6f,0x6f,0x42,0x69,0x67,0x00,0x00,0x03,
+0x3d,0x3d,0x3d,0x00,0x00,0x04,0x70,0x75,0x74,0x73,0x00,0x00,0x07,0x6d,0x65,0x73,
+0x73,0x61,0x67,0x65,0x00,0x00,0x00,0x01,0x4e,0x00,0x01,0x00,0x05,0x00,0x00,0x00,
+0x35,0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x05,0x00,0x80,0x00,0x43,0x00,0x80,0x00,
+0xc5,0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x11,0x00,0x80,0x40,0x43,0x00,0x80,0x02,
+0xc5,0x00,0x80,0x00,0x05,0x01,0x00,0x00,0x11,0x00,0x80,0x80,0x43,0x00,0x80,0x04,
+0xc5,0x00,0x80,0x00,0x05,0x01,0x00,0x01,0x91,0x00,0x81,0x00,0x43,0x00,0x80,0x05,
+0xc5,0x00,0x80,0x00,0x06,0x01,0x00,0x00,0x06,0x01,0xc0,0x02,0x03,0x01,0x01,0x80,
+0xa0,0x00,0x81,0x40,0xa0,0x00,0x80,0x00,0x06,0x01,0x00,0x01,0x11,0x01,0xc0,0x01,
+0x03,0x01,0x01,0xc0,0xa0,0x01,0x02,0x00,0x20,0x00,0x81,0x40,0xa0,0x00,0x80,0x00,
+0x06,0x01,0x00,0x00,0x91,0x01,0xc0,0x00,0x83,0x02,0x40,0x02,0x03,0x01,0x01,0xc1,
+0x20,0x01,0x02,0x00,0x20,0x00,0x81,0x40,0xa0,0x00,0x80,0x00,0x06,0x01,0x00,0x00,
+0x91,0x01,0xc0,0x00,0x03,0x02,0x40,0x00,0x03,0x01,0x01,0xc1,0x20,0x01,0x80,0x00,
+0x11,0x01,0x02,0x40,0xa0,0x00,0x81,0x40,0xa0,0x00,0x80,0x00,0x06,0x01,0x00,0x00,
+0x06,0x01,0xc0,0x01,0x03,0x01,0x02,0x80,0xa0,0x00,0x81,0x40,0xa0,0x00,0x80,0x00,
+0x06,0x01,0x00,0x00,0x06,0x01,0xc0,0x05,0x03,0x01,0x02,0x80,0xa0,0x00,0x81,0x40,
+0xa0,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x00,0x05,0x53,
+0x68,0x61,0x70,0x65,0x00,0x00,0x04,0x52,0x65,0x63,0x74,0x00,0x00,0x06,0x53,0x71,
+0x75,0x61,0x72,0x65,0x00,0x00,0x0d,0x53,0x74,0x61,0x6e,0x64,0x61,0x72,0x64,0x45,
+0x72,0x72,0x6f,0x72,0x00,0x00,0x06,0x54,0x6f,0x6f,0x42,0x69,0x67,0x00,0x00,0x04,
+0x70,0x75,0x74,0x73,0x00,0x00,0x05,0x74,0x6f,0x74,0x61,0x6c,0x00,0x00,0x03,0x6e,
+0x65,0x77,0x00,0x00,0x08,0x64,0x65,0x73,0x63,0x72,0x69,0x62,0x65,0x00,0x00,0x05,
+0x69,0x73,0x5f,0x61,0x3f,0x00,0x00,0x0a,0x73,0x61,0x66,0x65,0x5f,0x63,0x68,0x65,
+0x63,0x6b,0x00,0x00,0x00,0x00,0x5f,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x0b,0x00,
+0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x80,0x00,0x48,0x01,
+0x00,0x04,0xc0,0x00,0x80,0x40,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x06,0xc0,0x00,
+0x80,0x80,0x46,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x03,0x00,0x0a,0x69,0x6e,0x69,0x74,0x69,0x61,0x6c,0x69,0x7a,0x65,0x00,
+0x00,0x04,0x61,0x72,0x65,0x61,0x00,0x00,0x08,0x64,0x65,0x73,0x63,0x72,0x69,0x62,
+0x65,0x00,0x00,0x00,0x00,0x25,0x00,0x03,0x00,0x04,0x00,0x00,0x00,0x03,0x02,0x00,
+0x00,0x26,0x00,0x80,0x00,0x0e,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x01,0x00,0x02,0x40,0x77,0x00,0x00,0x00,0x00,0x31,0x00,0x02,0x00,0x04,0x00,
+0x00,0x00,0x05,0x00,0x00,0x00,0x26,0x01,0x00,0x00,0x0d,0x01,0x80,0x00,0x0d,0x01,
+0x00,0x40,0xb0,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,
+0x02,0x40,0x77,0x00,0x00,0x01,0x2a,0x00,0x00,0x00,0x00,0x55,0x00,0x02,0x00,0x04,
+0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x26,0x01,0x00,0x00,0x3d,0x01,0x80,0x00,0x06,
+0x01,0x80,0x00,0x20,0x01,0x00,0xc0,0x3e,0x01,0x80,0x00,0xbd,0x01,0x00,0xc0,0x3e,
+0x01,0x80,0x00,0x06,0x01,0x80,0x40,0x20,0x01,0x00,0xc0,0x3e,0x01,0x00,0x00,0x29,
+0x00,0x00,0x00,0x02,0x10,0x00,0x00,0x10,0x00,0x01,0x20,0x00,0x00,0x00,0x02,0x00,
+0x04,0x6b,0x69,0x6e,0x64,0x00,0x00,0x04,0x61,0x72,0x65,0x61,0x00,0x00,0x00,0x00,
+0x5b,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x0b,0x00,0x80,0x00,0x48,0x01,0x00,0x02,
+0xc0,0x00,0x80,0x00,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x04,0xc0,0x00,0x80,0x40,
+0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x06,0xc0,0x00,0x80,0x80,0x46,0x00,0x00,0x00,
+0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x0a,0x69,
+0x6e,0x69,0x74,0x69,0x61,0x6c,0x69,0x7a,0x65,0x00,0x00,0x04,0x61,0x72,0x65,0x61,
+0x00,0x00,0x04,0x6b,0x69,0x6e,0x64,0x00,0x00,0x00,0x00,0x31,0x00,0x04,0x00,0x06,
+0x00,0x00,0x00,0x06,0x04,0x00,0x00,0x26,0x02,0x80,0x40,0x01,0x03,0x00,0x00,0x05,
+0x02,0x00,0x00,0xa4,0x01,0x00,0x00,0x0e,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x01,0x00,0x02,0x40,0x68,0x00,0x00,0x00,0x00,0x36,0x00,0x02,0x00,
+0x04,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x26,0x01,0x00,0x00,0x0d,0x01,0x80,0x01,
+0x0d,0x01,0x00,0x40,0xb0,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x03,0x00,0x02,0x40,0x77,0x00,0x00,0x01,0x2a,0x00,0x00,0x02,0x40,0x68,0x00,0x00,
+0x00,0x00,0x27,0x00,0x02,0x00,0x03,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x26,0x00,
+0x00,0x00,0x3d,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x01,0x10,0x00,0x04,0x72,0x65,
+0x63,0x74,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0x00,0x01,0x00,0x02,0x00,0x00,
+0x00,0x05,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x00,
+0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x04,
+0x6b,0x69,0x6e,0x64,0x00,0x00,0x00,0x00,0x29,0x00,0x02,0x00,0x03,0x00,0x00,0x00,
+0x03,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x3d,0x00,0x00,0x00,0x29,0x00,0x00,0x00,
+0x01,0x10,0x00,0x06,0x73,0x71,0x75,0x61,0x72,0x65,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x1c,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x05,0x00,0x00,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4c,0x49,0x4e,0x45,0x00,0x00,
+0x04,0xdc,0x00,0x0e,0x00,0xd8,0x00,0x00,0x00,0x4d,0x00,0x39,0x2f,0x72,0x6f,0x6f,
+0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,
+0x72,0x75,0x62,0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,0x72,0x62,0x2f,
+0x74,0x65,0x73,0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x73,0x75,0x62,0x63,0x6c,0x61,
+0x73,0x73,0x2e,0x72,0x62,0x00,0x00,0x00,0x05,0x00,0x4b,0x00,0x4b,0x00,0x4b,0x00,
+0x4b,0x00,0x4b,0x00,0x00,0x00,0x73,0x00,0x39,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,
+0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,
+0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,0x72,0x62,0x2f,0x74,0x65,0x73,
+0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x73,0x75,0x62,0x63,0x6c,0x61,0x73,0x73,0x2e,
+0x72,0x62,0x00,0x00,0x00,0x18,0x00,0x4b,0x00,0x4a,0x00,0x46,0x00,0x46,0x00,0x46,
+0x00,0x46,0x00,0x46,0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x47,0x00,0x47,
+0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x48,0x00,0x49,0x00,0x49,
+0x00,0x49,0x00,0x49,0x00,0x49,0x00,0x00,0x00,0xad,0x00,0x39,0x2f,0x72,0x6f,0x6f,
+0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,
+0x72,0x75,0x62,0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,0x72,0x62,0x2f,
+0x74,0x65,0x73,0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x73,0x75,0x62,0x63,0x6c,0x61,
+0x73,0x73,0x2e,0x72,0x62,0x00,0x00,0x00,0x35,0x00,0x0f,0x00,0x0f,0x00,0x0f,0x00,
+0x0f,0x00,0x1e,0x00,0x11,0x00,0x11,0x00,0x11,0x00,0x24,0x00,0x20,0x00,0x20,0x00,
+0x20,0x00,0x35,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x4d,0x00,0x4d,0x00,0x4d,0x00,
+0x4d,0x00,0x4d,0x00,0x4e,0x00,0x4e,0x00,0x4e,0x00,0x4e,0x00,0x4e,0x00,0x4e,0x00,
+0x4f,0x00,0x4f,0x00,0x4f,0x00,0x4f,0x00,0x4f,0x00,0x4f,0x00,0x4f,0x00,0x50,0x00,
+0x50,0x00,0x50,0x00,0x50,0x00,0x50,0x00,0x50,0x00,0x50,0x00,0x50,0x00,0x51,0x00,
+0x51,0x00,0x51,0x00,0x51,0x00,0x51,0x00,0x52,0x00,0x52,0x00,0x52,0x00,0x52,0x00,
+0x52,0x00,0x52,0x00,0x00,0x00,0x59,0x00,0x39,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,
+0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,
+0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,0x72,0x62,0x2f,0x74,0x65,0x73,
+0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x73,0x75,0x62,0x63,0x6c,0x61,0x73,0x73,0x2e,
+0x72,0x62,0x00,0x00,0x00,0x0b,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x0a,0x00,0x0a,
+0x00,0x0a,0x00,0x0e,0x00,0x0e,0x00,0x0e,0x00,0x0e,0x00,0x0e,0x00,0x00,0x00,0x49,
+0x00,0x39,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,
+0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,
+0x70,0x63,0x6d,0x72,0x62,0x2f,0x74,0x65,0x73,0x74,0x63,0x61,0x73,0x65,0x73,0x2f,
+0x73,0x75,0x62,0x63,0x6c,0x61,0x73,0x73,0x2e,0x72,0x62,0x00,0x00,0x00,0x03,0x00,
+0x06,0x00,0x05,0x00,0x05,0x00,0x00,0x00,0x4d,0x00,0x39,0x2f,0x72,0x6f,0x6f,0x74,
+0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,
+0x75,0x62,0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,0x72,0x62,0x2f,0x74,
+0x65,0x73,0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x73,0x75,0x62,0x63,0x6c,0x61,0x73,
+0x73,0x2e,0x72,0x62,0x00,0x00,0x00,0x05,0x00,0x0a,0x00,0x09,0x00,0x09,0x00,0x09,
+0x00,0x09,0x00,0x00,0x00,0x59,0x00,0x39,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,
+0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,
+0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,0x72,0x62,0x2f,0x74,0x65,0x73,0x74,
+0x63,0x61,0x73,0x65,0x73,0x2f,0x73,0x75,0x62,0x63,0x6c,0x61,0x73,0x73,0x2e,0x72,
+0x62,0x00,0x00,0x00,0x0b,0x00,0x0e,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,
+0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x0d,0x00,0x00,0x00,0x59,0x00,
+0x39,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,
+0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,
+0x63,0x6d,0x72,0x62,0x2f,0x74,0x65,0x73,0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x73,
+0x75,0x62,0x63,0x6c,0x61,0x73,0x73,0x2e,0x72,0x62,0x00,0x00,0x00,0x0b,0x00,0x15,
+0x00,0x15,0x00,0x15,0x00,0x19,0x00,0x19,0x00,0x19,0x00,0x1d,0x00,0x1d,0x00,0x1d,
+0x00,0x1d,0x00,0x1d,0x00,0x00,0x00,0x4f,0x00,0x39,0x2f,0x72,0x6f,0x6f,0x74,0x2f,
+0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,
+0x62,0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,0x72,0x62,0x2f,0x74,0x65,
+0x73,0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x73,0x75,0x62,0x63,0x6c,0x61,0x73,0x73,
+0x2e,0x72,0x62,0x00,0x00,0x00,0x06,0x00,0x15,0x00,0x13,0x00,0x13,0x00,0x13,0x00,
+0x14,0x00,0x14,0x00,0x00,0x00,0x4d,0x00,0x39,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,
+0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,
+0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,0x72,0x62,0x2f,0x74,0x65,0x73,
+0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x73,0x75,0x62,0x63,0x6c,0x61,0x73,0x73,0x2e,
+0x72,0x62,0x00,0x00,0x00,0x05,0x00,0x19,0x00,0x18,0x00,0x18,0x00,0x18,0x00,0x18,
+0x00,0x00,0x00,0x49,0x00,0x39,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,
+0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x62,
+0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,0x72,0x62,0x2f,0x74,0x65,0x73,0x74,0x63,0x61,
+0x73,0x65,0x73,0x2f,0x73,0x75,0x62,0x63,0x6c,0x61,0x73,0x73,0x2e,0x72,0x62,0x00,
+0x00,0x00,0x03,0x00,0x1d,0x00,0x1c,0x00,0x1c,0x00,0x00,0x00,0x4d,0x00,0x39,0x2f,
+0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,
+0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,
+0x72,0x62,0x2f,0x74,0x65,0x73,0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x73,0x75,0x62,
+0x63,0x6c,0x61,0x73,0x73,0x2e,0x72,0x62,0x00,0x00,0x00,0x05,0x00,0x23,0x00,0x23,
+0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x00,0x00,0x49,0x00,0x39,0x2f,0x72,0x6f,0x6f,
+0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,
+0x72,0x75,0x62,0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,0x72,0x62,0x2f,
+0x74,0x65,0x73,0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x73,0x75,0x62,0x63,0x6c,0x61,
+0x73,0x73,0x2e,0x72,0x62,0x00,0x00,0x00,0x03,0x00,0x23,0x00,0x22,0x00,0x22,0x00,
+0x00,0x00,0x47,0x00,0x39,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,
+0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x62,0x69,
+0x6e,0x2d,0x68,0x70,0x63,0x6d,0x72,0x62,0x2f,0x74,0x65,0x73,0x74,0x63,0x61,0x73,
+0x65,0x73,0x2f,0x73,0x75,0x62,0x63,0x6c,0x61,0x73,0x73,0x2e,0x72,0x62,0x00,0x00,
+0x00,0x02,0x00,0x35,0x00,0x35,0x45,0x4e,0x44,0x00,0x00,0x00,0x00,0x08,
+};
+
+static mrb_value
+Counter_n__vm(mrb_state *mrb, mrb_value self)
+{
+	mrb_value *argv;
+	int argc;
+
+	mrb_get_args(mrb, "*", &argv, &argc);
+	if (argc != 0)
+		mrb_raisef(mrb, E_ARGUMENT_ERROR, "wrong number of arguments (%S for 0)", mrb_fixnum_value(argc));
+	if (hpc_type_of(self) != T_Counter)
+		mrb_raise(mrb, E_TYPE_ERROR, "not allocated by the compiled code");
+	return Counter_n(self);
+}
+
+static mrb_value
+Counter_add__vm(mrb_state *mrb, mrb_value self)
+{
+	mrb_value *argv;
+	int argc;
+
+	mrb_get_args(mrb, "*", &argv, &argc);
+	if (argc != 1)
+		mrb_raisef(mrb, E_ARGUMENT_ERROR, "wrong number of arguments (%S for 1)", mrb_fixnum_value(argc));
+	if (hpc_type_of(self) != T_Counter)
+		mrb_raise(mrb, E_TYPE_ERROR, "not allocated by the compiled code");
+	return Counter_add(self, argv[0]);
+}
+
+static mrb_value
+Counter_new__vm(mrb_state *mrb, mrb_value self)
+{
+	mrb_value *argv;
+	int argc;
+
+	mrb_get_args(mrb, "*", &argv, &argc);
+	if (argc != 0)
+		mrb_raisef(mrb, E_ARGUMENT_ERROR, "wrong number of arguments (%S for 0)", mrb_fixnum_value(argc));
+	return new_0(0, self);
+}
+
+static mrb_value
+check__vm(mrb_state *mrb, mrb_value self)
+{
+	mrb_value *argv;
+	int argc;
+
+	mrb_get_args(mrb, "*", &argv, &argc);
+	if (argc != 1)
+		mrb_raisef(mrb, E_ARGUMENT_ERROR, "wrong number of arguments (%S for 1)", mrb_fixnum_value(argc));
+	return check(self, argv[0]);
+}
+
+static mrb_value
+total__vm(mrb_state *mrb, mrb_value self)
+{
+	mrb_value *argv;
+	int argc;
+
+	mrb_get_args(mrb, "*", &argv, &argc);
+	if (argc != 1)
+		mrb_raisef(mrb, E_ARGUMENT_ERROR, "wrong number of arguments (%S for 1)", mrb_fixnum_value(argc));
+	return total(self, argv[0]);
+}
+
+static size_t hpc_vm_base;
+
+static void
+hpc_vm_main(mrb_state *mrb)
+{
+	mrb_run(mrb, mrb_proc_new(mrb, mrb->irep[hpc_vm_base + 2]), mrb_top_self(mrb));
+	if (mrb->exc)
+		mrb_exc_raise(mrb, mrb_obj_value(mrb->exc));
+}
+
+static void
+hpc_vm_init(mrb_state *mrb)
+{
+	struct RClass *c;
+	size_t n = mrb->irep_len;
+
+	if (mrb_read_irep(mrb, hpc_vm_irep) < 0) {
+		fputs("cannot load the methods left to the VM\n", stderr);
+		exit(EXIT_FAILURE);
+	}
+	hpc_vm_base = n;
+	mrb_run(mrb, mrb_proc_new(mrb, mrb->irep[n]), mrb_top_self(mrb));
+	if (mrb->exc) {
+		mrb_p(mrb, mrb_obj_value(mrb->exc));
+		exit(EXIT_FAILURE);
+	}
+	if (mrb_const_defined(mrb, mrb_obj_value(mrb->object_class), mrb_intern(mrb, "Counter")))
+		c = mrb_class_ptr(mrb_const_get(mrb, mrb_obj_value(mrb->object_class), mrb_intern(mrb, "Counter")));
+	else
+		c = mrb_define_class(mrb, "Counter", mrb->object_class);
+	mrb_define_method(mrb, c, "n", Counter_n__vm, ARGS_ANY());
+	mrb_define_method(mrb, c, "add", Counter_add__vm, ARGS_ANY());
+	mrb_define_class_method(mrb, c, "new", Counter_new__vm, ARGS_ANY());
+	c = mrb->object_class;
+	mrb_define_method(mrb, c, "check", check__vm, ARGS_ANY());
+	mrb_define_method(mrb, c, "total", total__vm, ARGS_ANY());
+}
+
+
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
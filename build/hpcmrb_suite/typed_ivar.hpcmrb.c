@@ -0,0 +1,655 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+#define T_Counter 1001
+typedef struct {
+	int type;
+	mrb_value label;
+	mrb_value n;
+} cCounter;
+
+#define T_Point 1002
+typedef struct {
+	int type;
+	double y;
+	double x;
+} cPoint;
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	case T_Counter:
+		mrb_gc_mark_value(mrb, ((cCounter *)p)->label);
+		break;
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+mrb_value
+x_0(int val, mrb_value __self__);
+mrb_value
+y_0(int val, mrb_value __self__);
+mrb_value
+x_set_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+add_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+norm2_0(int val, mrb_value __self__);
+mrb_value
+step_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+label_0(int val, mrb_value __self__);
+mrb_value
+set_label_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+n_0(int val, mrb_value __self__);
+
+static mrb_value
+Counter_n(mrb_value __self__);
+static mrb_value
+Counter_set_label(mrb_value __self__, mrb_value s);
+static mrb_value
+Counter_label(mrb_value __self__);
+static mrb_value
+Counter_step(mrb_value __self__, mrb_value k);
+static mrb_value
+Counter_initialize(mrb_value __self__);
+static mrb_value
+Counter_set_label__c10(mrb_value __self__, mrb_value s);
+static mrb_value
+Counter_n__c9(mrb_value __self__);
+static mrb_value
+Counter_step__c8(mrb_value __self__, mrb_int k);
+static mrb_value
+Counter_label__c7(mrb_value __self__);
+static mrb_value
+Counter_initialize__c6(mrb_value __self__);
+static mrb_value
+Counter_new__c6(mrb_value __self__);
+static mrb_value
+Point_norm2(mrb_value __self__);
+static mrb_value
+Point_add(mrb_value __self__, mrb_value o);
+static mrb_value
+Point_x_set(mrb_value __self__, mrb_value v);
+static mrb_value
+Point_y(mrb_value __self__);
+static mrb_value
+Point_x(mrb_value __self__);
+static mrb_value
+Point_initialize(mrb_value __self__, mrb_value x, mrb_value y);
+static double
+Point_norm2__c5(mrb_value __self__);
+static double
+Point_y__c3(mrb_value __self__);
+static double
+Point_x__c2(mrb_value __self__);
+static mrb_value
+Point_add__c4(mrb_value __self__, mrb_value o);
+static double
+Point_initialize__c1(mrb_value __self__, double x, double y);
+static mrb_value
+Point_new__c1(mrb_value __self__, double x, double y);
+mrb_sym __i_label;
+mrb_sym __i_n;
+mrb_sym __i_y;
+mrb_sym __i_x;
+
+void
+init_global_syms(mrb_state * mrb)
+{
+	__i_label = mrb_intern(mrb, "label");
+	__i_n = mrb_intern(mrb, "n");
+	__i_y = mrb_intern(mrb, "y");
+	__i_x = mrb_intern(mrb, "x");
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void Counter_init(mrb_value __self__);
+void Point_init(mrb_value __self__);
+mrb_value Point;
+mrb_value Counter;
+void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { &Point, &Counter };
+	static mrb_shadow_frame __global_frame;
+	__global_frame.prev = mrb->shadow_frames;
+	__global_frame.len = sizeof(__global_roots) / sizeof(__global_roots[0]);
+	__global_frame.roots = __global_roots;
+	mrb->shadow_frames = &__global_frame;
+	mrb_value p = mrb_nil_value();
+	mrb_value q = mrb_nil_value();
+	mrb_value pts = mrb_nil_value();
+	mrb_value c = mrb_nil_value();
+	mrb_value *__roots1[] = { &p, &q, &pts, &c };
+	HPC_FRAME_PUSH(__frame1, __roots1);
+
+	Point = mrb_obj_value(mrb_define_class(mrb, "Point", mrb->object_class));
+	Point_init(Point);
+	Counter = mrb_obj_value(mrb_define_class(mrb, "Counter", mrb->object_class));
+	Counter_init(Counter);
+	p = Point_new__c1(Point, 1.5, 2.0);
+	q = Point_add__c4(p, Point_new__c1(Point, 0.5, (-1.0)));
+	puts_1(0, __self__, mrb_float_value(((cPoint *)DATA_PTR(q))->x));
+	puts_1(0, __self__, mrb_float_value(((cPoint *)DATA_PTR(q))->y));
+	puts_1(0, __self__, mrb_float_value(Point_norm2__c5(q)));
+	pts = mrb_funcall(mrb, mrb_obj_value(mrb->array_class), "new", 0);
+	hpc_ary_aset_2(0, pts, mrb_fixnum_value(0), Point_new__c1(Point, 3.0, 4.0));
+	x_set_1(0, hpc_ary_vref(pts, 0), mrb_float_value(0.25));
+	puts_1(0, __self__, x_0(1, hpc_ary_vref(pts, 0)));
+	puts_1(0, __self__, norm2_0(1, hpc_ary_vref(pts, 0)));
+	c = Counter_new__c6(Counter);
+	puts_1(0, __self__, ((cCounter *)DATA_PTR(c))->label);
+	{
+		mrb_int __tmp_2 = 5;
+
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 5;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				Counter_step__c8(c, i);
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	puts_1(0, __self__, ((cCounter *)DATA_PTR(c))->n);
+	((cCounter *)DATA_PTR(c))->label = mrb_str_new(mrb, "done", 4);
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(c), ((cCounter *)DATA_PTR(c))->label);
+	puts_1(0, __self__, ((cCounter *)DATA_PTR(c))->label);
+	HPC_FRAME_POP(__frame1);
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+	if (c == (struct RClass *)mrb_obj_ptr(Counter)) {
+		cCounter *sval;
+		Data_Make_Struct(mrb, c, cCounter, &hpc_data_type, sval, data);
+		sval->type = T_Counter;
+		obj = mrb_obj_value(data);
+		Counter_initialize(obj);
+} else {
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+	if (c == (struct RClass *)mrb_obj_ptr(Point)) {
+		cPoint *sval;
+		Data_Make_Struct(mrb, c, cPoint, &hpc_data_type, sval, data);
+		sval->type = T_Point;
+		obj = mrb_obj_value(data);
+		Point_initialize(obj, arg0, arg1);
+} else {
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+void
+Counter_init(mrb_value __self__)
+{
+}
+
+void
+Point_init(mrb_value __self__)
+{
+}
+
+static mrb_value
+Counter_n(mrb_value __self__)
+{
+	cCounter *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->n;
+}
+
+static mrb_value
+Counter_set_label(mrb_value __self__, mrb_value s)
+{
+	cCounter *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->label = s;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->label);
+	return data->label;
+}
+
+static mrb_value
+Counter_label(mrb_value __self__)
+{
+	cCounter *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->label;
+}
+
+static mrb_value
+Counter_step(mrb_value __self__, mrb_value k)
+{
+	cCounter *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->n = num_add_1(1, data->n, k);
+	return data->n;
+}
+
+static mrb_value
+Counter_initialize(mrb_value __self__)
+{
+	cCounter *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->n = mrb_fixnum_value(0);
+	return data->n;
+}
+
+static mrb_value
+Counter_set_label__c10(mrb_value __self__, mrb_value s)
+{
+	cCounter *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->label = s;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->label);
+	return data->label;
+}
+
+static mrb_value
+Counter_n__c9(mrb_value __self__)
+{
+	cCounter *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->n;
+}
+
+static mrb_value
+Counter_step__c8(mrb_value __self__, mrb_int k)
+{
+	cCounter *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->n = num_add_1(1, data->n, mrb_fixnum_value(k));
+	return data->n;
+}
+
+static mrb_value
+Counter_label__c7(mrb_value __self__)
+{
+	cCounter *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->label;
+}
+
+static mrb_value
+Counter_initialize__c6(mrb_value __self__)
+{
+	cCounter *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->n = mrb_fixnum_value(0);
+	return data->n;
+}
+
+static mrb_value
+Counter_new__c6(mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	cCounter *sval;
+	Data_Make_Struct(mrb, mrb_class_ptr(__self__), cCounter, &hpc_data_type, sval, data);
+	sval->type = T_Counter;
+	obj = mrb_obj_value(data);
+	Counter_initialize__c6(obj);
+	return obj;
+}
+
+static mrb_value
+Point_norm2(mrb_value __self__)
+{
+	cPoint *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return mrb_float_value(((data->x * data->x) + (data->y * data->y)));
+}
+
+static mrb_value
+Point_add(mrb_value __self__, mrb_value o)
+{
+	cPoint *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return mrb_funcall(mrb, Point, "new", 2, num_add_1(1, mrb_float_value(data->x), x_0(1, o)), num_add_1(1, mrb_float_value(data->y), y_0(1, o)));
+}
+
+static mrb_value
+Point_x_set(mrb_value __self__, mrb_value v)
+{
+	cPoint *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->x = mrb_float(v);
+	return mrb_float_value(data->x);
+}
+
+static mrb_value
+Point_y(mrb_value __self__)
+{
+	cPoint *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return mrb_float_value(data->y);
+}
+
+static mrb_value
+Point_x(mrb_value __self__)
+{
+	cPoint *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return mrb_float_value(data->x);
+}
+
+static mrb_value
+Point_initialize(mrb_value __self__, mrb_value x, mrb_value y)
+{
+	cPoint *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->x = hpc_to_float(x);
+	data->y = hpc_to_float(y);
+	return mrb_float_value(data->y);
+}
+
+static double
+Point_norm2__c5(mrb_value __self__)
+{
+	cPoint *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return ((data->x * data->x) + (data->y * data->y));
+}
+
+static double
+Point_y__c3(mrb_value __self__)
+{
+	cPoint *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->y;
+}
+
+static double
+Point_x__c2(mrb_value __self__)
+{
+	cPoint *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->x;
+}
+
+static mrb_value
+Point_add__c4(mrb_value __self__, mrb_value o)
+{
+	cPoint *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return Point_new__c1(Point, (data->x + ((cPoint *)DATA_PTR(o))->x), (data->y + ((cPoint *)DATA_PTR(o))->y));
+}
+
+static double
+Point_initialize__c1(mrb_value __self__, double x, double y)
+{
+	cPoint *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->x = x;
+	data->y = y;
+	return data->y;
+}
+
+static mrb_value
+Point_new__c1(mrb_value __self__, double x, double y)
+{
+	mrb_value obj;
+	struct RData * data;
+	cPoint *sval;
+	Data_Make_Struct(mrb, mrb_class_ptr(__self__), cPoint, &hpc_data_type, sval, data);
+	sval->type = T_Point;
+	obj = mrb_obj_value(data);
+	Point_initialize__c1(obj, x, y);
+	return obj;
+}
+
+mrb_value
+x_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Point:
+			result = Point_x(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "x", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+y_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Point:
+			result = Point_y(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "y", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+x_set_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Point:
+			result = Point_x_set(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "x=", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+add_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Point:
+			result = Point_add(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "add", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+norm2_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Point:
+			result = Point_norm2(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "norm2", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+step_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Counter:
+			result = Counter_step(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "step", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+label_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Counter:
+			result = Counter_label(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "label", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+set_label_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Counter:
+			result = Counter_set_label(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "set_label", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+n_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Counter:
+			result = Counter_n(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "n", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
@@ -0,0 +1,205 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+mrb_value
+average_1(int val, mrb_value __self__, mrb_value arg0);
+
+static mrb_value
+average(mrb_value __self__, mrb_value n);
+static double
+average__c1(mrb_value __self__, mrb_int n);
+
+void
+init_global_syms(mrb_state * mrb)
+{
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { NULL };
+	double x;
+	double y;
+	double z;
+	mrb_int k;
+
+	x = 1.5;
+	y = 2.75;
+	z = (-1.5);
+	puts_1(0, __self__, mrb_float_value(2.75));
+	puts_1(0, __self__, mrb_float_value((-1.5)));
+	if ( 2.75 > 1.5 )
+	{
+		(hpc_output_write("greater\n", 8), mrb_nil_value());
+	}
+	puts_1(0, __self__, mrb_float_value(average__c1(__self__, 10)));
+	k = 7;
+	(hpc_output_int(1), hpc_output_write("\n", 1), mrb_nil_value());
+	(hpc_output_int(2), hpc_output_write("\n", 1), mrb_nil_value());
+	puts_1(0, __self__, mrb_float_value((-0.5)));
+	(hpc_output_int(16), hpc_output_write("\n", 1), mrb_nil_value());
+	{
+		mrb_int __tmp_2 = 4;
+
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = 4;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				mrb_int m;
+
+				m = hpc_mod_int(i, 3);
+				(hpc_output_int(m), hpc_output_write("\n", 1), mrb_nil_value());
+				puts_1(0, __self__, mrb_float_value(hpc_mod_float(((mrb_float)i), (-1.5))));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+static mrb_value
+average(mrb_value __self__, mrb_value n)
+{
+	double sum;
+
+	sum = 0.0;
+	{
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = mrb_fixnum(n);
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				sum = (sum + (((mrb_float)i) * 0.5));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	return num_div_1(1, mrb_float_value(sum), n);
+}
+
+static double
+average__c1(mrb_value __self__, mrb_int n)
+{
+	double sum;
+
+	sum = 0.0;
+	{
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = n;
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				sum = (sum + (((mrb_float)i) * 0.5));
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+	}
+	return (sum / ((mrb_float)n));
+}
+
+mrb_value
+average_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	return average(__self__, arg0);
+}
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
@@ -0,0 +1,461 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "mruby/dump.h"
+#include "mruby/proc.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+#define T_Pair 1001
+typedef struct {
+	int type;
+	mrb_value b;
+	mrb_value a;
+} cPair;
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	case T_Pair:
+		mrb_gc_mark_value(mrb, ((cPair *)p)->b);
+		mrb_gc_mark_value(mrb, ((cPair *)p)->a);
+		break;
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+mrb_value
+twice_0(int val, mrb_value __self__);
+mrb_value
+each_half_0(int val, mrb_value __self__);
+mrb_value
+repeat_1(int val, mrb_value __self__, mrb_value arg0);
+
+static void
+hpc_vm_init(mrb_state *mrb);
+
+static void
+hpc_vm_main(mrb_state *mrb);
+
+static mrb_value
+Pair_repeat(mrb_value __self__, mrb_value n);
+static mrb_value
+Pair_each_half(mrb_value __self__);
+static mrb_value
+Pair_initialize(mrb_value __self__, mrb_value a, mrb_value b);
+static mrb_value
+twice(mrb_value __self__);
+mrb_sym __i_b;
+mrb_sym __i_a;
+
+void
+init_global_syms(mrb_state * mrb)
+{
+	__i_b = mrb_intern(mrb, "b");
+	__i_a = mrb_intern(mrb, "a");
+	hpc_vm_init(mrb);
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void Pair_init(mrb_value __self__);
+mrb_value Pair;
+void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { &Pair };
+	static mrb_shadow_frame __global_frame;
+	__global_frame.prev = mrb->shadow_frames;
+	__global_frame.len = sizeof(__global_roots) / sizeof(__global_roots[0]);
+	__global_frame.roots = __global_roots;
+	mrb->shadow_frames = &__global_frame;
+	Pair = mrb_const_get(mrb, mrb_obj_value(mrb->object_class), mrb_intern(mrb, "Pair"));
+	Pair_init(Pair);
+	hpc_vm_main(mrb);
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+	if (c == (struct RClass *)mrb_obj_ptr(Pair)) {
+		cPair *sval;
+		Data_Make_Struct(mrb, c, cPair, &hpc_data_type, sval, data);
+		sval->type = T_Pair;
+		obj = mrb_obj_value(data);
+		Pair_initialize(obj, arg0, arg1);
+} else {
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+void
+Pair_init(mrb_value __self__)
+{
+}
+
+static mrb_value
+Pair_repeat(mrb_value __self__, mrb_value n)
+{
+	mrb_value __block__ = hpc_take_block();
+	{
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = mrb_fixnum(n);
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				hpc_yield(__block__, 1, (mrb_value[]){mrb_fixnum_value(i)});
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+		return n;
+	}
+}
+
+static mrb_value
+Pair_each_half(mrb_value __self__)
+{
+	cPair *data;
+	*(void**)&data = DATA_PTR(__self__);
+	mrb_value __block__ = hpc_take_block();
+	hpc_yield(__block__, 1, (mrb_value[]){num_div_1(1, data->a, mrb_fixnum_value(2))});
+	return hpc_yield(__block__, 1, (mrb_value[]){num_div_1(1, data->b, mrb_fixnum_value(2))});
+}
+
+static mrb_value
+Pair_initialize(mrb_value __self__, mrb_value a, mrb_value b)
+{
+	cPair *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->a = a;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->a);
+	data->b = b;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->b);
+	return data->b;
+}
+
+static mrb_value
+twice(mrb_value __self__)
+{
+	mrb_value __block__ = hpc_take_block();
+	hpc_yield(__block__, 1, (mrb_value[]){mrb_fixnum_value(1)});
+	return hpc_yield(__block__, 1, (mrb_value[]){mrb_fixnum_value(2)});
+}
+
+mrb_value
+twice_0(int val, mrb_value __self__)
+{
+	return twice(__self__);
+}mrb_value
+each_half_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Pair:
+			result = Pair_each_half(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "each_half", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+repeat_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+	if (hpc_class_eq(__self__, Pair)) {
+		result = Pair_repeat(__self__, arg0);
+	} else {
+		switch (hpc_type_of(__self__)) {
+		default:
+			result = mrb_funcall(mrb, __self__, "repeat", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+
+#include <stdint.h>
+const uint8_t hpc_vm_irep[] = {
+0x52,0x49,0x54,0x45,0x30,0x30,0x30,0x31,0x52,0xdb,0x00,0x00,0x06,0x2b,0x4d,0x41,
+0x54,0x5a,0x30,0x30,0x30,0x30,0x49,0x52,0x45,0x50,0x00,0x00,0x02,0xe2,0x30,0x30,
+0x30,0x30,0x00,0x09,0x00,0xd8,0x00,0x00,0x00,0x44,0x00,0x01,0x00,0x02,0x00,0x00,
+0x00,0x08,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x80,
+0x00,0x48,0x01,0x00,0x08,0xc0,0x00,0x80,0x40,0x46,0x00,0x80,0x00,0x05,0x00,0x00,
+0x00,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x06,0x73,0x63,0x61,0x6c,
+0x65,0x64,0x00,0x00,0x04,0x63,0x61,0x6c,0x63,0x00,0x00,0x00,0x00,0x9e,0x00,0x04,
+0x00,0x07,0x00,0x00,0x00,0x17,0x02,0x00,0x00,0x26,0x00,0x40,0x05,0x1a,0x01,0xbf,
+0xff,0x83,0x02,0x00,0x00,0x06,0x02,0x80,0x03,0x40,0x02,0x00,0x00,0x21,0x02,0x00,
+0x00,0x91,0x02,0xc0,0x01,0x03,0x03,0x00,0x05,0x40,0x02,0x00,0x80,0xa1,0x02,0x00,
+0xc0,0x01,0x00,0x40,0x04,0x97,0x02,0x00,0x00,0x1b,0x02,0x80,0x01,0x91,0x03,0x01,
+0x00,0x01,0x02,0x81,0x00,0xa0,0x02,0xc0,0x00,0x98,0x00,0x40,0x01,0x17,0x02,0x3f,
+0xff,0x03,0x00,0x40,0x01,0x17,0x02,0x00,0x00,0x1d,0x00,0x80,0x00,0x1c,0x02,0x00,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x74,0x77,0x69,0x63,
+0x65,0x00,0x00,0x04,0x50,0x61,0x69,0x72,0x00,0x00,0x06,0x72,0x65,0x70,0x65,0x61,
+0x74,0x00,0x00,0x0d,0x53,0x74,0x61,0x6e,0x64,0x61,0x72,0x64,0x45,0x72,0x72,0x6f,
+0x72,0x00,0x00,0x03,0x3d,0x3d,0x3d,0x00,0x00,0x00,0x00,0x3c,0x00,0x03,0x00,0x06,
+0x00,0x00,0x00,0x08,0x02,0x00,0x00,0x26,0x01,0x80,0xc0,0x15,0x02,0x00,0x40,0x01,
+0x02,0x80,0x40,0x15,0x02,0x00,0x00,0xb0,0x01,0x80,0x40,0xac,0x01,0x80,0xc0,0x16,
+0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x2a,0x00,
+0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0x30,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x06,
+0x02,0x00,0x00,0x26,0x01,0x80,0xc0,0x15,0x02,0x00,0x40,0x01,0x01,0x80,0x00,0xac,
+0x01,0x80,0xc0,0x16,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0x34,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x06,
+0x00,0x00,0x00,0x26,0x01,0x3f,0xff,0x83,0x01,0x80,0x00,0x06,0x02,0x00,0x03,0x40,
+0x01,0x80,0x00,0x21,0x01,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+0x00,0x05,0x74,0x77,0x69,0x63,0x65,0x00,0x00,0x00,0x00,0x30,0x00,0x03,0x00,0x05,
+0x00,0x00,0x00,0x06,0x02,0x00,0x00,0x26,0x01,0x80,0x80,0x15,0x02,0x00,0x40,0x01,
+0x01,0x80,0x00,0xac,0x01,0x80,0x80,0x16,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x01,0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0xc0,0x00,0x04,0x00,0x07,
+0x00,0x00,0x00,0x1d,0x00,0xbf,0xff,0x83,0x02,0x00,0x00,0x06,0x02,0x80,0x03,0x40,
+0x02,0x00,0x00,0x21,0x02,0x00,0x00,0x06,0x02,0x80,0x40,0x01,0x02,0x00,0x40,0xa0,
+0x02,0x00,0x00,0x06,0x02,0x80,0x00,0x06,0x02,0x80,0x80,0x20,0x02,0x00,0x40,0xa0,
+0x02,0x00,0x00,0x06,0x02,0x80,0x00,0x06,0x03,0x40,0x04,0x83,0x02,0x80,0xc0,0xa0,
+0x02,0x00,0x40,0xa0,0x02,0x00,0x02,0x11,0x02,0xc0,0x03,0x83,0x03,0x40,0x09,0x83,
+0x02,0x01,0x41,0x20,0x01,0x01,0x00,0x01,0x01,0xbf,0xff,0x83,0x02,0x00,0x80,0x01,
+0x02,0x80,0x05,0x40,0x02,0x01,0x80,0x21,0x02,0x00,0x00,0x06,0x02,0x80,0xc0,0x01,
+0x02,0x00,0x40,0xa0,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,
+0x00,0x05,0x74,0x77,0x69,0x63,0x65,0x00,0x00,0x04,0x70,0x75,0x74,0x73,0x00,0x00,
+0x04,0x63,0x61,0x6c,0x63,0x00,0x00,0x06,0x73,0x63,0x61,0x6c,0x65,0x64,0x00,0x00,
+0x04,0x50,0x61,0x69,0x72,0x00,0x00,0x03,0x6e,0x65,0x77,0x00,0x00,0x09,0x65,0x61,
+0x63,0x68,0x5f,0x68,0x61,0x6c,0x66,0x00,0x00,0x00,0x00,0x30,0x00,0x03,0x00,0x05,
+0x00,0x00,0x00,0x06,0x02,0x00,0x00,0x26,0x01,0x80,0x40,0x15,0x02,0x00,0x40,0x01,
+0x01,0x80,0x00,0xac,0x01,0x80,0x40,0x16,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x01,0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0x30,0x00,0x03,0x00,0x05,
+0x00,0x00,0x00,0x06,0x02,0x00,0x00,0x26,0x01,0x80,0xc0,0x15,0x02,0x00,0x40,0x01,
+0x01,0x80,0x00,0xac,0x01,0x80,0xc0,0x16,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x01,0x00,0x01,0x2b,0x00,0x4c,0x49,0x4e,0x45,0x00,0x00,0x03,0x2b,
+0x00,0x09,0x00,0xd8,0x00,0x00,0x00,0x53,0x00,0x39,0x2f,0x72,0x6f,0x6f,0x74,0x2f,
+0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,
+0x62,0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,0x72,0x62,0x2f,0x74,0x65,
+0x73,0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x76,0x6d,0x5f,0x62,0x6c,0x6f,0x63,0x6b,
+0x2e,0x72,0x62,0x00,0x00,0x00,0x08,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x1c,0x00,
+0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x00,0x00,0x71,0x00,0x39,0x2f,0x72,0x6f,
+0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,
+0x6d,0x72,0x75,0x62,0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,0x72,0x62,
+0x2f,0x74,0x65,0x73,0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x76,0x6d,0x5f,0x62,0x6c,
+0x6f,0x63,0x6b,0x2e,0x72,0x62,0x00,0x00,0x00,0x17,0x00,0x26,0x00,0x26,0x00,0x20,
+0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x23,
+0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x25,
+0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x00,0x00,0x53,0x00,0x39,0x2f,0x72,
+0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,
+0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,0x72,
+0x62,0x2f,0x74,0x65,0x73,0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x76,0x6d,0x5f,0x62,
+0x6c,0x6f,0x63,0x6b,0x2e,0x72,0x62,0x00,0x00,0x00,0x08,0x00,0x21,0x00,0x21,0x00,
+0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x00,0x00,0x4f,0x00,
+0x39,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,
+0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,
+0x63,0x6d,0x72,0x62,0x2f,0x74,0x65,0x73,0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x76,
+0x6d,0x5f,0x62,0x6c,0x6f,0x63,0x6b,0x2e,0x72,0x62,0x00,0x00,0x00,0x06,0x00,0x22,
+0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x22,0x00,0x00,0x00,0x4f,0x00,0x39,
+0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,
+0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,
+0x6d,0x72,0x62,0x2f,0x74,0x65,0x73,0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x76,0x6d,
+0x5f,0x62,0x6c,0x6f,0x63,0x6b,0x2e,0x72,0x62,0x00,0x00,0x00,0x06,0x00,0x1c,0x00,
+0x19,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1b,0x00,0x00,0x00,0x4f,0x00,0x39,0x2f,
+0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,
+0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,
+0x72,0x62,0x2f,0x74,0x65,0x73,0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x76,0x6d,0x5f,
+0x62,0x6c,0x6f,0x63,0x6b,0x2e,0x72,0x62,0x00,0x00,0x00,0x06,0x00,0x1a,0x00,0x1a,
+0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,0x00,0x00,0x7d,0x00,0x39,0x2f,0x72,
+0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,
+0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,0x72,
+0x62,0x2f,0x74,0x65,0x73,0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x76,0x6d,0x5f,0x62,
+0x6c,0x6f,0x63,0x6b,0x2e,0x72,0x62,0x00,0x00,0x00,0x1d,0x00,0x28,0x00,0x29,0x00,
+0x29,0x00,0x29,0x00,0x2a,0x00,0x2a,0x00,0x2a,0x00,0x2b,0x00,0x2b,0x00,0x2b,0x00,
+0x2b,0x00,0x2c,0x00,0x2c,0x00,0x2c,0x00,0x2c,0x00,0x2c,0x00,0x2d,0x00,0x2d,0x00,
+0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2e,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x30,0x00,
+0x30,0x00,0x30,0x00,0x30,0x00,0x00,0x00,0x4f,0x00,0x39,0x2f,0x72,0x6f,0x6f,0x74,
+0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,
+0x75,0x62,0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,0x72,0x62,0x2f,0x74,
+0x65,0x73,0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x76,0x6d,0x5f,0x62,0x6c,0x6f,0x63,
+0x6b,0x2e,0x72,0x62,0x00,0x00,0x00,0x06,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x29,
+0x00,0x29,0x00,0x29,0x00,0x00,0x00,0x4f,0x00,0x39,0x2f,0x72,0x6f,0x6f,0x74,0x2f,
+0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,
+0x62,0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,0x72,0x62,0x2f,0x74,0x65,
+0x73,0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x76,0x6d,0x5f,0x62,0x6c,0x6f,0x63,0x6b,
+0x2e,0x72,0x62,0x00,0x00,0x00,0x06,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,
+0x2f,0x00,0x2f,0x45,0x4e,0x44,0x00,0x00,0x00,0x00,0x08,
+};
+
+static mrb_value
+Pair_repeat__vm(mrb_state *mrb, mrb_value self)
+{
+	mrb_value *argv;
+	int argc;
+	mrb_value blk;
+
+	mrb_get_args(mrb, "*&", &argv, &argc, &blk);
+	if (argc != 1)
+		mrb_raisef(mrb, E_ARGUMENT_ERROR, "wrong number of arguments (%S for 1)", mrb_fixnum_value(argc));
+	hpc_vm_block = blk;
+	return Pair_repeat(self, argv[0]);
+}
+
+static mrb_value
+Pair_each_half__vm(mrb_state *mrb, mrb_value self)
+{
+	mrb_value *argv;
+	int argc;
+	mrb_value blk;
+
+	mrb_get_args(mrb, "*&", &argv, &argc, &blk);
+	if (argc != 0)
+		mrb_raisef(mrb, E_ARGUMENT_ERROR, "wrong number of arguments (%S for 0)", mrb_fixnum_value(argc));
+	if (hpc_type_of(self) != T_Pair)
+		mrb_raise(mrb, E_TYPE_ERROR, "not allocated by the compiled code");
+	hpc_vm_block = blk;
+	return Pair_each_half(self);
+}
+
+static mrb_value
+Pair_new__vm(mrb_state *mrb, mrb_value self)
+{
+	mrb_value *argv;
+	int argc;
+
+	mrb_get_args(mrb, "*", &argv, &argc);
+	if (argc != 2)
+		mrb_raisef(mrb, E_ARGUMENT_ERROR, "wrong number of arguments (%S for 2)", mrb_fixnum_value(argc));
+	return new_2(0, self, argv[0], argv[1]);
+}
+
+static mrb_value
+twice__vm(mrb_state *mrb, mrb_value self)
+{
+	mrb_value *argv;
+	int argc;
+	mrb_value blk;
+
+	mrb_get_args(mrb, "*&", &argv, &argc, &blk);
+	if (argc != 0)
+		mrb_raisef(mrb, E_ARGUMENT_ERROR, "wrong number of arguments (%S for 0)", mrb_fixnum_value(argc));
+	hpc_vm_block = blk;
+	return twice(self);
+}
+
+static size_t hpc_vm_base;
+
+static void
+hpc_vm_main(mrb_state *mrb)
+{
+	mrb_run(mrb, mrb_proc_new(mrb, mrb->irep[hpc_vm_base + 6]), mrb_top_self(mrb));
+	if (mrb->exc)
+		mrb_exc_raise(mrb, mrb_obj_value(mrb->exc));
+}
+
+static void
+hpc_vm_init(mrb_state *mrb)
+{
+	struct RClass *c;
+	size_t n = mrb->irep_len;
+
+	if (mrb_read_irep(mrb, hpc_vm_irep) < 0) {
+		fputs("cannot load the methods left to the VM\n", stderr);
+		exit(EXIT_FAILURE);
+	}
+	hpc_vm_base = n;
+	mrb_run(mrb, mrb_proc_new(mrb, mrb->irep[n]), mrb_top_self(mrb));
+	if (mrb->exc) {
+		mrb_p(mrb, mrb_obj_value(mrb->exc));
+		exit(EXIT_FAILURE);
+	}
+	if (mrb_const_defined(mrb, mrb_obj_value(mrb->object_class), mrb_intern(mrb, "Pair")))
+		c = mrb_class_ptr(mrb_const_get(mrb, mrb_obj_value(mrb->object_class), mrb_intern(mrb, "Pair")));
+	else
+		c = mrb_define_class(mrb, "Pair", mrb->object_class);
+	mrb_define_class_method(mrb, c, "repeat", Pair_repeat__vm, ARGS_ANY());
+	mrb_define_method(mrb, c, "each_half", Pair_each_half__vm, ARGS_ANY());
+	mrb_define_class_method(mrb, c, "new", Pair_new__vm, ARGS_ANY());
+	c = mrb->object_class;
+	mrb_define_method(mrb, c, "twice", twice__vm, ARGS_ANY());
+}
+
+
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
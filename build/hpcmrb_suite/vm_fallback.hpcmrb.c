@@ -0,0 +1,570 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "mruby/dump.h"
+#include "mruby/proc.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+#define T_Counter 1001
+typedef struct {
+	int type;
+	mrb_value count;
+} cCounter;
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	case T_Counter:
+		mrb_gc_mark_value(mrb, ((cCounter *)p)->count);
+		break;
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+mrb_value
+label_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+add_all_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);
+mrb_value
+sum_squares_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);
+mrb_value
+sum_squares_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+collatz_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+square_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+count_0(int val, mrb_value __self__);
+mrb_value
+add_1(int val, mrb_value __self__, mrb_value arg0);
+
+static void
+hpc_vm_init(mrb_state *mrb);
+
+static mrb_value
+Counter_add(mrb_value __self__, mrb_value n);
+static mrb_value
+Counter_count(mrb_value __self__);
+static mrb_value
+Counter_initialize(mrb_value __self__, mrb_value start);
+static mrb_value
+Counter_count__c2(mrb_value __self__);
+static mrb_value
+Counter_initialize__c1(mrb_value __self__, mrb_int start);
+static mrb_value
+Counter_new__c1(mrb_value __self__, mrb_int start);
+static mrb_value
+square(mrb_value __self__, mrb_value x);
+static mrb_value
+square__c3(mrb_value __self__, mrb_int x);
+mrb_sym __i_count;
+
+void
+init_global_syms(mrb_state * mrb)
+{
+	__i_count = mrb_intern(mrb, "count");
+	hpc_vm_init(mrb);
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void Counter_init(mrb_value __self__);
+mrb_value Counter;
+void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { &Counter };
+	static mrb_shadow_frame __global_frame;
+	__global_frame.prev = mrb->shadow_frames;
+	__global_frame.len = sizeof(__global_roots) / sizeof(__global_roots[0]);
+	__global_frame.roots = __global_roots;
+	mrb->shadow_frames = &__global_frame;
+	mrb_value c = mrb_nil_value();
+	mrb_value *__roots1[] = { &c };
+	HPC_FRAME_PUSH(__frame1, __roots1);
+
+	Counter = mrb_const_get(mrb, mrb_obj_value(mrb->object_class), mrb_intern(mrb, "Counter"));
+	Counter_init(Counter);
+	puts_1(0, __self__, mrb_funcall(mrb, __self__, "collatz", 1, mrb_fixnum_value(27)));
+	puts_1(0, __self__, mrb_funcall(mrb, __self__, "sum_squares", 1, mrb_fixnum_value(10)));
+	puts_1(0, __self__, mrb_funcall(mrb, __self__, "sum_squares", 2, mrb_fixnum_value(10), mrb_fixnum_value(5)));
+	c = Counter_new__c1(Counter, 3);
+	puts_1(0, __self__, mrb_funcall(mrb, c, "add_all", 3, mrb_fixnum_value(1), mrb_fixnum_value(2), mrb_fixnum_value(3)));
+	puts_1(0, __self__, ((cCounter *)DATA_PTR(c))->count);
+	puts_1(0, __self__, mrb_funcall(mrb, Counter, "label", 1, mrb_fixnum_value(2)));
+	puts_1(0, __self__, mrb_funcall(mrb, Counter, "label", 1, ((cCounter *)DATA_PTR(c))->count));
+	puts_1(0, __self__, square__c3(__self__, 7));
+	HPC_FRAME_POP(__frame1);
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+	if (c == (struct RClass *)mrb_obj_ptr(Counter)) {
+		cCounter *sval;
+		Data_Make_Struct(mrb, c, cCounter, &hpc_data_type, sval, data);
+		sval->type = T_Counter;
+		obj = mrb_obj_value(data);
+		Counter_initialize(obj, arg0);
+} else {
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+void
+Counter_init(mrb_value __self__)
+{
+}
+
+static mrb_value
+Counter_add(mrb_value __self__, mrb_value n)
+{
+	cCounter *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->count = num_add_1(1, data->count, n);
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->count);
+	return data->count;
+}
+
+static mrb_value
+Counter_count(mrb_value __self__)
+{
+	cCounter *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->count;
+}
+
+static mrb_value
+Counter_initialize(mrb_value __self__, mrb_value start)
+{
+	cCounter *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->count = start;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->count);
+	return data->count;
+}
+
+static mrb_value
+Counter_count__c2(mrb_value __self__)
+{
+	cCounter *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->count;
+}
+
+static mrb_value
+Counter_initialize__c1(mrb_value __self__, mrb_int start)
+{
+	cCounter *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->count = mrb_fixnum_value(start);
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->count);
+	return data->count;
+}
+
+static mrb_value
+Counter_new__c1(mrb_value __self__, mrb_int start)
+{
+	mrb_value obj;
+	struct RData * data;
+	cCounter *sval;
+	Data_Make_Struct(mrb, mrb_class_ptr(__self__), cCounter, &hpc_data_type, sval, data);
+	sval->type = T_Counter;
+	obj = mrb_obj_value(data);
+	Counter_initialize__c1(obj, start);
+	return obj;
+}
+
+static mrb_value
+square(mrb_value __self__, mrb_value x)
+{
+	return num_mul_1(1, x, x);
+}
+
+static mrb_value
+square__c3(mrb_value __self__, mrb_int x)
+{
+	return hpc_int_mul(x, x);
+}
+
+mrb_value
+label_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		default:
+			result = mrb_funcall(mrb, __self__, "label", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+add_all_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		default:
+			result = mrb_funcall(mrb, __self__, "add_all", 3, arg0, arg1, arg2);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+sum_squares_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		default:
+			result = mrb_funcall(mrb, __self__, "sum_squares", 2, arg0, arg1);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+sum_squares_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		default:
+			result = mrb_funcall(mrb, __self__, "sum_squares", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+collatz_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		default:
+			result = mrb_funcall(mrb, __self__, "collatz", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+square_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	return square(__self__, arg0);
+}mrb_value
+count_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Counter:
+			result = Counter_count(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "count", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+add_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Counter:
+			result = Counter_add(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "add", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+
+#include <stdint.h>
+const uint8_t hpc_vm_irep[] = {
+0x52,0x49,0x54,0x45,0x30,0x30,0x30,0x31,0x2c,0x9a,0x00,0x00,0x05,0xf3,0x4d,0x41,
+0x54,0x5a,0x30,0x30,0x30,0x30,0x49,0x52,0x45,0x50,0x00,0x00,0x02,0xd1,0x30,0x30,
+0x30,0x30,0x00,0x08,0x00,0xd8,0x00,0x00,0x00,0x62,0x00,0x01,0x00,0x03,0x00,0x00,
+0x00,0x0b,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x80,
+0x00,0x48,0x01,0x00,0x06,0xc0,0x00,0x80,0x40,0x46,0x00,0x80,0x00,0x05,0x01,0x00,
+0x00,0x05,0x00,0x80,0x80,0x43,0x00,0x80,0x02,0x45,0x00,0x00,0x00,0x4a,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x0b,0x73,0x75,0x6d,0x5f,0x73,0x71,0x75,0x61,
+0x72,0x65,0x73,0x00,0x00,0x07,0x63,0x6f,0x6c,0x6c,0x61,0x74,0x7a,0x00,0x00,0x07,
+0x43,0x6f,0x75,0x6e,0x74,0x65,0x72,0x00,0x00,0x00,0x00,0x43,0x00,0x05,0x00,0x08,
+0x00,0x00,0x00,0x0a,0x02,0x10,0x00,0x26,0x00,0x40,0x00,0x97,0x00,0x40,0x00,0x97,
+0x01,0x40,0x00,0x03,0x02,0x3f,0xff,0x83,0x02,0x80,0x80,0x01,0x03,0x00,0x40,0x01,
+0x03,0x80,0x03,0x40,0x02,0x80,0x00,0xa1,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x01,0x00,0x04,0x75,0x70,0x74,0x6f,0x00,0x00,0x00,0x00,0x41,0x00,
+0x03,0x00,0x06,0x00,0x00,0x00,0x08,0x02,0x00,0x00,0x26,0x01,0x81,0x00,0x15,0x02,
+0x00,0x00,0x06,0x02,0x80,0x40,0x01,0x02,0x00,0x00,0xa0,0x01,0x80,0x40,0xac,0x01,
+0x81,0x00,0x16,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,
+0x06,0x73,0x71,0x75,0x61,0x72,0x65,0x00,0x00,0x01,0x2b,0x00,0x00,0x00,0x00,0xa7,
+0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x1e,0x02,0x00,0x00,0x26,0x01,0xbf,0xff,0x83,
+0x00,0x40,0x0b,0x17,0x02,0x00,0x40,0x01,0x02,0xc0,0x00,0x83,0x02,0x00,0x00,0xa0,
+0x02,0xbf,0xff,0x83,0x03,0x01,0x00,0x01,0x02,0x80,0x40,0xa0,0x02,0xc0,0x00,0x98,
+0x00,0x40,0x02,0x97,0x02,0x80,0x40,0x01,0x03,0x40,0x00,0x83,0x02,0x80,0x80,0xb1,
+0x00,0x81,0x40,0x01,0x00,0x40,0x03,0x17,0x02,0xc0,0x01,0x03,0x03,0x00,0x40,0x01,
+0x02,0x80,0xc0,0xb0,0x02,0x81,0x00,0xad,0x00,0x81,0x40,0x01,0x00,0x40,0x00,0x17,
+0x02,0x80,0xc0,0x01,0x02,0x81,0x00,0xad,0x01,0x81,0x40,0x01,0x02,0x80,0x40,0x01,
+0x03,0x40,0x00,0x03,0x02,0x81,0x40,0xa0,0x02,0xbf,0xf3,0x18,0x01,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x01,0x25,0x00,0x00,0x03,0x3d,0x3d,
+0x3d,0x00,0x00,0x01,0x2f,0x00,0x00,0x01,0x2a,0x00,0x00,0x01,0x2b,0x00,0x00,0x02,
+0x21,0x3d,0x00,0x00,0x00,0x00,0x4a,0x00,0x01,0x00,0x02,0x00,0x00,0x00,0x09,0x00,
+0x80,0x00,0x06,0x00,0x80,0x40,0x47,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,
+0x80,0x00,0x48,0x01,0x00,0x04,0xc0,0x00,0x80,0x40,0x46,0x00,0x00,0x00,0x05,0x00,
+0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x05,0x6c,0x61,0x62,
+0x65,0x6c,0x00,0x00,0x07,0x61,0x64,0x64,0x5f,0x61,0x6c,0x6c,0x00,0x00,0x00,0x00,
+0x7d,0x00,0x03,0x00,0x05,0x00,0x00,0x00,0x14,0x02,0x00,0x00,0x26,0x01,0x80,0x40,
+0x01,0x02,0x40,0x00,0x03,0x02,0x80,0xc0,0x01,0x02,0x00,0x00,0xa0,0x02,0x40,0x00,
+0x98,0x00,0x40,0x01,0x17,0x02,0x00,0x00,0x3d,0x00,0x40,0x05,0x17,0x02,0x40,0x00,
+0x83,0x02,0x80,0xc0,0x01,0x02,0x00,0x00,0xa0,0x02,0x40,0x00,0x98,0x00,0x40,0x01,
+0x17,0x02,0x00,0x00,0xbd,0x00,0x40,0x01,0x97,0x02,0x00,0x01,0x3d,0x00,0x40,0x00,
+0x97,0x02,0x00,0x00,0x05,0x02,0x00,0x00,0x29,0x00,0x00,0x00,0x03,0x10,0x00,0x03,
+0x6f,0x6e,0x65,0x10,0x00,0x03,0x74,0x77,0x6f,0x10,0x00,0x04,0x6d,0x61,0x6e,0x79,
+0x00,0x00,0x00,0x01,0x00,0x03,0x3d,0x3d,0x3d,0x00,0x00,0x00,0x00,0x3f,0x00,0x03,
+0x00,0x05,0x00,0x00,0x00,0x07,0x00,0x08,0x00,0x26,0x01,0x80,0x40,0x01,0x02,0x00,
+0x03,0x40,0x01,0x80,0x00,0x21,0x01,0x80,0x00,0x06,0x01,0x80,0x40,0x20,0x01,0x80,
+0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x04,0x65,0x61,0x63,0x68,
+0x00,0x00,0x05,0x63,0x6f,0x75,0x6e,0x74,0x00,0x00,0x00,0x00,0x2e,0x00,0x03,0x00,
+0x05,0x00,0x00,0x00,0x05,0x02,0x00,0x00,0x26,0x01,0x80,0x00,0x06,0x02,0x00,0x40,
+0x01,0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x01,0x00,0x03,0x61,0x64,0x64,0x00,0x4c,0x49,0x4e,0x45,0x00,0x00,0x03,0x04,0x00,
+0x08,0x00,0xd8,0x00,0x00,0x00,0x5c,0x00,0x3c,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,
+0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,
+0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,0x72,0x62,0x2f,0x74,0x65,0x73,
+0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x76,0x6d,0x5f,0x66,0x61,0x6c,0x6c,0x62,0x61,
+0x63,0x6b,0x2e,0x72,0x62,0x00,0x00,0x00,0x0b,0x00,0x19,0x00,0x19,0x00,0x19,0x00,
+0x13,0x00,0x13,0x00,0x13,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,
+0x00,0x00,0x5a,0x00,0x3c,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,
+0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x62,0x69,
+0x6e,0x2d,0x68,0x70,0x63,0x6d,0x72,0x62,0x2f,0x74,0x65,0x73,0x74,0x63,0x61,0x73,
+0x65,0x73,0x2f,0x76,0x6d,0x5f,0x66,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x2e,0x72,
+0x62,0x00,0x00,0x00,0x0a,0x00,0x19,0x00,0x19,0x00,0x19,0x00,0x15,0x00,0x16,0x00,
+0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x18,0x00,0x00,0x00,0x56,0x00,0x3c,0x2f,
+0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,
+0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,
+0x72,0x62,0x2f,0x74,0x65,0x73,0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x76,0x6d,0x5f,
+0x66,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x2e,0x72,0x62,0x00,0x00,0x00,0x08,0x00,
+0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x17,0x00,
+0x00,0x00,0x82,0x00,0x3c,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,
+0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x62,0x69,
+0x6e,0x2d,0x68,0x70,0x63,0x6d,0x72,0x62,0x2f,0x74,0x65,0x73,0x74,0x63,0x61,0x73,
+0x65,0x73,0x2f,0x76,0x6d,0x5f,0x66,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x2e,0x72,
+0x62,0x00,0x00,0x00,0x1e,0x00,0x13,0x00,0x08,0x00,0x11,0x00,0x0a,0x00,0x0a,0x00,
+0x0a,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0b,0x00,0x0c,0x00,0x0c,0x00,
+0x0c,0x00,0x0c,0x00,0x0c,0x00,0x0e,0x00,0x0e,0x00,0x0e,0x00,0x0e,0x00,0x0e,0x00,
+0x0e,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x09,0x00,0x09,0x00,0x09,0x00,0x09,0x00,
+0x12,0x00,0x00,0x00,0x58,0x00,0x3c,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,
+0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,
+0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,0x72,0x62,0x2f,0x74,0x65,0x73,0x74,0x63,
+0x61,0x73,0x65,0x73,0x2f,0x76,0x6d,0x5f,0x66,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,
+0x2e,0x72,0x62,0x00,0x00,0x00,0x09,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,0x2d,0x00,
+0x2b,0x00,0x2b,0x00,0x2b,0x00,0x2b,0x00,0x2b,0x00,0x00,0x00,0x6e,0x00,0x3c,0x2f,
+0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,
+0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,
+0x72,0x62,0x2f,0x74,0x65,0x73,0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x76,0x6d,0x5f,
+0x66,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x2e,0x72,0x62,0x00,0x00,0x00,0x14,0x00,
+0x33,0x00,0x2e,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,0x2f,0x00,
+0x2f,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,0x30,0x00,
+0x31,0x00,0x31,0x00,0x31,0x00,0x31,0x00,0x00,0x00,0x54,0x00,0x3c,0x2f,0x72,0x6f,
+0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,
+0x6d,0x72,0x75,0x62,0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,0x72,0x62,
+0x2f,0x74,0x65,0x73,0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x76,0x6d,0x5f,0x66,0x61,
+0x6c,0x6c,0x62,0x61,0x63,0x6b,0x2e,0x72,0x62,0x00,0x00,0x00,0x07,0x00,0x2b,0x00,
+0x29,0x00,0x29,0x00,0x29,0x00,0x2a,0x00,0x2a,0x00,0x2a,0x00,0x00,0x00,0x50,0x00,
+0x3c,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,
+0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,
+0x63,0x6d,0x72,0x62,0x2f,0x74,0x65,0x73,0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x76,
+0x6d,0x5f,0x66,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x2e,0x72,0x62,0x00,0x00,0x00,
+0x05,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x29,0x00,0x29,0x45,0x4e,0x44,0x00,0x00,
+0x00,0x00,0x08,
+};
+
+static mrb_value
+Counter_add__vm(mrb_state *mrb, mrb_value self)
+{
+	mrb_value *argv;
+	int argc;
+
+	mrb_get_args(mrb, "*", &argv, &argc);
+	if (argc != 1)
+		mrb_raisef(mrb, E_ARGUMENT_ERROR, "wrong number of arguments (%S for 1)", mrb_fixnum_value(argc));
+	if (hpc_type_of(self) != T_Counter)
+		mrb_raise(mrb, E_TYPE_ERROR, "not allocated by the compiled code");
+	return Counter_add(self, argv[0]);
+}
+
+static mrb_value
+Counter_count__vm(mrb_state *mrb, mrb_value self)
+{
+	mrb_value *argv;
+	int argc;
+
+	mrb_get_args(mrb, "*", &argv, &argc);
+	if (argc != 0)
+		mrb_raisef(mrb, E_ARGUMENT_ERROR, "wrong number of arguments (%S for 0)", mrb_fixnum_value(argc));
+	if (hpc_type_of(self) != T_Counter)
+		mrb_raise(mrb, E_TYPE_ERROR, "not allocated by the compiled code");
+	return Counter_count(self);
+}
+
+static mrb_value
+Counter_new__vm(mrb_state *mrb, mrb_value self)
+{
+	mrb_value *argv;
+	int argc;
+
+	mrb_get_args(mrb, "*", &argv, &argc);
+	if (argc != 1)
+		mrb_raisef(mrb, E_ARGUMENT_ERROR, "wrong number of arguments (%S for 1)", mrb_fixnum_value(argc));
+	return new_1(0, self, argv[0]);
+}
+
+static mrb_value
+square__vm(mrb_state *mrb, mrb_value self)
+{
+	mrb_value *argv;
+	int argc;
+
+	mrb_get_args(mrb, "*", &argv, &argc);
+	if (argc != 1)
+		mrb_raisef(mrb, E_ARGUMENT_ERROR, "wrong number of arguments (%S for 1)", mrb_fixnum_value(argc));
+	return square(self, argv[0]);
+}
+
+static void
+hpc_vm_init(mrb_state *mrb)
+{
+	struct RClass *c;
+	size_t n = mrb->irep_len;
+
+	if (mrb_read_irep(mrb, hpc_vm_irep) < 0) {
+		fputs("cannot load the methods left to the VM\n", stderr);
+		exit(EXIT_FAILURE);
+	}
+	mrb_run(mrb, mrb_proc_new(mrb, mrb->irep[n]), mrb_top_self(mrb));
+	if (mrb->exc) {
+		mrb_p(mrb, mrb_obj_value(mrb->exc));
+		exit(EXIT_FAILURE);
+	}
+	if (mrb_const_defined(mrb, mrb_obj_value(mrb->object_class), mrb_intern(mrb, "Counter")))
+		c = mrb_class_ptr(mrb_const_get(mrb, mrb_obj_value(mrb->object_class), mrb_intern(mrb, "Counter")));
+	else
+		c = mrb_define_class(mrb, "Counter", mrb->object_class);
+	mrb_define_method(mrb, c, "add", Counter_add__vm, ARGS_ANY());
+	mrb_define_method(mrb, c, "count", Counter_count__vm, ARGS_ANY());
+	mrb_define_class_method(mrb, c, "new", Counter_new__vm, ARGS_ANY());
+	c = mrb->object_class;
+	mrb_define_method(mrb, c, "square", square__vm, ARGS_ANY());
+}
+
+
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
@@ -0,0 +1,428 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "mruby/dump.h"
+#include "mruby/proc.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+#define T_Point 1001
+typedef struct {
+	int type;
+	mrb_value y;
+	mrb_value x;
+} cPoint;
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	case T_Point:
+		mrb_gc_mark_value(mrb, ((cPoint *)p)->y);
+		mrb_gc_mark_value(mrb, ((cPoint *)p)->x);
+		break;
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+mrb_value
+x_0(int val, mrb_value __self__);
+mrb_value
+y_0(int val, mrb_value __self__);
+mrb_value
+dist2_0(int val, mrb_value __self__);
+
+static void
+hpc_vm_init(mrb_state *mrb);
+
+static void
+hpc_vm_main(mrb_state *mrb);
+
+static mrb_value
+Point_dist2(mrb_value __self__);
+static mrb_value
+Point_initialize(mrb_value __self__, mrb_value x, mrb_value y);
+static mrb_value
+Point_y(mrb_value __self__);
+static mrb_value
+Point_x(mrb_value __self__);
+mrb_sym __i_y;
+mrb_sym __i_x;
+
+void
+init_global_syms(mrb_state * mrb)
+{
+	__i_y = mrb_intern(mrb, "y");
+	__i_x = mrb_intern(mrb, "x");
+	hpc_vm_init(mrb);
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void Point_init(mrb_value __self__);
+static const mrb_int LIMIT = 10;
+mrb_value Point;
+void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { &Point };
+	static mrb_shadow_frame __global_frame;
+	__global_frame.prev = mrb->shadow_frames;
+	__global_frame.len = sizeof(__global_roots) / sizeof(__global_roots[0]);
+	__global_frame.roots = __global_roots;
+	mrb->shadow_frames = &__global_frame;
+	Point = mrb_const_get(mrb, mrb_obj_value(mrb->object_class), mrb_intern(mrb, "Point"));
+	Point_init(Point);
+	hpc_vm_main(mrb);
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+	if (c == (struct RClass *)mrb_obj_ptr(Point)) {
+		cPoint *sval;
+		Data_Make_Struct(mrb, c, cPoint, &hpc_data_type, sval, data);
+		sval->type = T_Point;
+		obj = mrb_obj_value(data);
+		Point_initialize(obj, arg0, arg1);
+} else {
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+void
+Point_init(mrb_value __self__)
+{
+}
+
+static mrb_value
+Point_dist2(mrb_value __self__)
+{
+	cPoint *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return num_add_1(1, num_mul_1(1, x_0(1, __self__), x_0(1, __self__)), num_mul_1(1, y_0(1, __self__), y_0(1, __self__)));
+}
+
+static mrb_value
+Point_initialize(mrb_value __self__, mrb_value x, mrb_value y)
+{
+	cPoint *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->x = x;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->x);
+	data->y = y;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->y);
+	return data->y;
+}
+
+static mrb_value
+Point_y(mrb_value __self__)
+{
+	cPoint *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->y;
+}
+
+static mrb_value
+Point_x(mrb_value __self__)
+{
+	cPoint *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->x;
+}
+
+mrb_value
+x_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Point:
+			result = Point_x(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "x", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+y_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Point:
+			result = Point_y(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "y", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+dist2_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Point:
+			result = Point_dist2(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "dist2", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+
+#include <stdint.h>
+const uint8_t hpc_vm_irep[] = {
+0x52,0x49,0x54,0x45,0x30,0x30,0x30,0x31,0x4c,0xcb,0x00,0x00,0x03,0xf9,0x4d,0x41,
+0x54,0x5a,0x30,0x30,0x30,0x30,0x49,0x52,0x45,0x50,0x00,0x00,0x02,0x27,0x30,0x30,
+0x30,0x30,0x00,0x04,0x00,0xd8,0x00,0x00,0x00,0x2e,0x00,0x01,0x00,0x02,0x00,0x00,
+0x00,0x05,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x80,
+0x00,0x05,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x03,
+0x74,0x72,0x69,0x00,0x00,0x00,0x00,0x5d,0x00,0x05,0x00,0x07,0x00,0x00,0x00,0x10,
+0x02,0x00,0x00,0x26,0x01,0xbf,0xff,0x83,0x02,0x40,0x00,0x03,0x00,0x40,0x03,0x97,
+0x02,0x80,0xc0,0x01,0x03,0x01,0x00,0x01,0x02,0x80,0x00,0xac,0x01,0x81,0x40,0x01,
+0x02,0x81,0x00,0x01,0x02,0x80,0x00,0xad,0x02,0x01,0x40,0x01,0x02,0x81,0x00,0x01,
+0x03,0x00,0x40,0x01,0x02,0x80,0x40,0xb4,0x02,0xbf,0xfa,0x98,0x01,0x80,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x01,0x2b,0x00,0x00,0x02,0x3c,0x3d,
+0x00,0x00,0x00,0x01,0x4f,0x00,0x04,0x00,0x07,0x00,0x00,0x00,0x34,0x02,0x40,0x04,
+0x83,0x02,0x00,0x00,0x12,0x00,0xc0,0x01,0x03,0x02,0x00,0x00,0x06,0x02,0x80,0x00,
+0x06,0x03,0x00,0x40,0x01,0x02,0x80,0x80,0xa0,0x02,0x00,0x40,0xa0,0x00,0x80,0x00,
+0x3d,0x02,0x00,0x00,0x06,0x02,0x80,0x40,0x01,0x02,0x00,0x40,0xa0,0x00,0x40,0x02,
+0x1a,0x02,0x00,0x00,0x06,0x02,0x80,0x00,0xbd,0x02,0x00,0xc0,0xa0,0x00,0x40,0x06,
+0x97,0x02,0x00,0x00,0x1b,0x02,0x80,0x02,0x11,0x03,0x01,0x00,0x01,0x02,0x81,0x40,
+0xa0,0x02,0xc0,0x00,0x98,0x00,0x40,0x03,0x17,0x01,0x01,0x00,0x01,0x02,0x00,0x00,
+0x06,0x02,0x80,0x80,0x01,0x02,0x81,0x80,0x20,0x02,0x00,0x40,0xa0,0x00,0x40,0x01,
+0x17,0x02,0x00,0x00,0x1d,0x00,0x80,0x00,0x1c,0x02,0x00,0x03,0x91,0x02,0xc0,0x01,
+0x03,0x03,0x40,0x01,0x83,0x02,0x02,0x01,0x20,0x01,0x81,0x00,0x01,0x02,0x00,0x00,
+0x06,0x02,0x80,0xc0,0x01,0x02,0x82,0x40,0x20,0x02,0x00,0x40,0xa0,0x02,0x00,0x00,
+0x06,0x02,0x80,0x00,0x06,0x03,0x00,0x00,0x11,0x02,0x80,0x80,0xa0,0x02,0x00,0x40,
+0xa0,0x02,0x40,0x00,0x03,0x02,0xc0,0x00,0x83,0x03,0x40,0x01,0x03,0x02,0x01,0x01,
+0xb7,0x02,0x80,0x03,0x40,0x02,0x02,0x80,0x21,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,
+0x02,0x10,0x00,0x07,0x63,0x68,0x61,0x6e,0x67,0x65,0x64,0x10,0x00,0x04,0x6f,0x6f,
+0x70,0x73,0x00,0x00,0x00,0x0b,0x00,0x05,0x4c,0x49,0x4d,0x49,0x54,0x00,0x00,0x04,
+0x70,0x75,0x74,0x73,0x00,0x00,0x03,0x74,0x72,0x69,0x00,0x00,0x05,0x72,0x61,0x69,
+0x73,0x65,0x00,0x00,0x0d,0x53,0x74,0x61,0x6e,0x64,0x61,0x72,0x64,0x45,0x72,0x72,
+0x6f,0x72,0x00,0x00,0x03,0x3d,0x3d,0x3d,0x00,0x00,0x07,0x6d,0x65,0x73,0x73,0x61,
+0x67,0x65,0x00,0x00,0x05,0x50,0x6f,0x69,0x6e,0x74,0x00,0x00,0x03,0x6e,0x65,0x77,
+0x00,0x00,0x05,0x64,0x69,0x73,0x74,0x32,0x00,0x00,0x04,0x65,0x61,0x63,0x68,0x00,
+0x00,0x00,0x00,0x3d,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x07,0x02,0x00,0x00,0x26,
+0x01,0x80,0x00,0x06,0x02,0x00,0x00,0x06,0x02,0x80,0x40,0x01,0x02,0x00,0x40,0xa0,
+0x01,0x80,0x00,0xa0,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,
+0x00,0x04,0x70,0x75,0x74,0x73,0x00,0x00,0x03,0x74,0x72,0x69,0x00,0x4c,0x49,0x4e,
+0x45,0x00,0x00,0x01,0xb4,0x00,0x04,0x00,0xd8,0x00,0x00,0x00,0x4c,0x00,0x38,0x2f,
+0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,
+0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,
+0x72,0x62,0x2f,0x74,0x65,0x73,0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x76,0x6d,0x5f,
+0x6d,0x61,0x69,0x6e,0x2e,0x72,0x62,0x00,0x00,0x00,0x05,0x00,0x1a,0x00,0x1a,0x00,
+0x1a,0x00,0x1a,0x00,0x1a,0x00,0x00,0x00,0x62,0x00,0x38,0x2f,0x72,0x6f,0x6f,0x74,
+0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,
+0x75,0x62,0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,0x72,0x62,0x2f,0x74,
+0x65,0x73,0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x76,0x6d,0x5f,0x6d,0x61,0x69,0x6e,
+0x2e,0x72,0x62,0x00,0x00,0x00,0x10,0x00,0x1a,0x00,0x13,0x00,0x14,0x00,0x18,0x00,
+0x16,0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x17,0x00,0x17,0x00,0x17,0x00,0x15,0x00,
+0x15,0x00,0x15,0x00,0x15,0x00,0x19,0x00,0x00,0x00,0xaa,0x00,0x38,0x2f,0x72,0x6f,
+0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,
+0x6d,0x72,0x75,0x62,0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,0x72,0x62,
+0x2f,0x74,0x65,0x73,0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x76,0x6d,0x5f,0x6d,0x61,
+0x69,0x6e,0x2e,0x72,0x62,0x00,0x00,0x00,0x34,0x00,0x03,0x00,0x03,0x00,0x1c,0x00,
+0x1d,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x1e,0x00,0x1f,0x00,0x1f,0x00,
+0x1f,0x00,0x24,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,
+0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x21,0x00,0x23,0x00,0x23,0x00,0x23,0x00,
+0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x25,0x00,
+0x25,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x27,0x00,0x27,0x00,0x27,0x00,
+0x27,0x00,0x27,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,
+0x28,0x00,0x00,0x00,0x50,0x00,0x38,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,
+0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,
+0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,0x72,0x62,0x2f,0x74,0x65,0x73,0x74,0x63,
+0x61,0x73,0x65,0x73,0x2f,0x76,0x6d,0x5f,0x6d,0x61,0x69,0x6e,0x2e,0x72,0x62,0x00,
+0x00,0x00,0x07,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,0x28,0x00,
+0x28,0x45,0x4e,0x44,0x00,0x00,0x00,0x00,0x08,
+};
+
+static mrb_value
+Point_dist2__vm(mrb_state *mrb, mrb_value self)
+{
+	mrb_value *argv;
+	int argc;
+
+	mrb_get_args(mrb, "*", &argv, &argc);
+	if (argc != 0)
+		mrb_raisef(mrb, E_ARGUMENT_ERROR, "wrong number of arguments (%S for 0)", mrb_fixnum_value(argc));
+	if (hpc_type_of(self) != T_Point)
+		mrb_raise(mrb, E_TYPE_ERROR, "not allocated by the compiled code");
+	return Point_dist2(self);
+}
+
+static mrb_value
+Point_y__vm(mrb_state *mrb, mrb_value self)
+{
+	mrb_value *argv;
+	int argc;
+
+	mrb_get_args(mrb, "*", &argv, &argc);
+	if (argc != 0)
+		mrb_raisef(mrb, E_ARGUMENT_ERROR, "wrong number of arguments (%S for 0)", mrb_fixnum_value(argc));
+	if (hpc_type_of(self) != T_Point)
+		mrb_raise(mrb, E_TYPE_ERROR, "not allocated by the compiled code");
+	return Point_y(self);
+}
+
+static mrb_value
+Point_x__vm(mrb_state *mrb, mrb_value self)
+{
+	mrb_value *argv;
+	int argc;
+
+	mrb_get_args(mrb, "*", &argv, &argc);
+	if (argc != 0)
+		mrb_raisef(mrb, E_ARGUMENT_ERROR, "wrong number of arguments (%S for 0)", mrb_fixnum_value(argc));
+	if (hpc_type_of(self) != T_Point)
+		mrb_raise(mrb, E_TYPE_ERROR, "not allocated by the compiled code");
+	return Point_x(self);
+}
+
+static mrb_value
+Point_new__vm(mrb_state *mrb, mrb_value self)
+{
+	mrb_value *argv;
+	int argc;
+
+	mrb_get_args(mrb, "*", &argv, &argc);
+	if (argc != 2)
+		mrb_raisef(mrb, E_ARGUMENT_ERROR, "wrong number of arguments (%S for 2)", mrb_fixnum_value(argc));
+	return new_2(0, self, argv[0], argv[1]);
+}
+
+static size_t hpc_vm_base;
+
+static void
+hpc_vm_main(mrb_state *mrb)
+{
+	mrb_run(mrb, mrb_proc_new(mrb, mrb->irep[hpc_vm_base + 2]), mrb_top_self(mrb));
+	if (mrb->exc)
+		mrb_exc_raise(mrb, mrb_obj_value(mrb->exc));
+}
+
+static void
+hpc_vm_init(mrb_state *mrb)
+{
+	struct RClass *c;
+	size_t n = mrb->irep_len;
+
+	if (mrb_read_irep(mrb, hpc_vm_irep) < 0) {
+		fputs("cannot load the methods left to the VM\n", stderr);
+		exit(EXIT_FAILURE);
+	}
+	hpc_vm_base = n;
+	mrb_run(mrb, mrb_proc_new(mrb, mrb->irep[n]), mrb_top_self(mrb));
+	if (mrb->exc) {
+		mrb_p(mrb, mrb_obj_value(mrb->exc));
+		exit(EXIT_FAILURE);
+	}
+	if (mrb_const_defined(mrb, mrb_obj_value(mrb->object_class), mrb_intern(mrb, "Point")))
+		c = mrb_class_ptr(mrb_const_get(mrb, mrb_obj_value(mrb->object_class), mrb_intern(mrb, "Point")));
+	else
+		c = mrb_define_class(mrb, "Point", mrb->object_class);
+	mrb_define_method(mrb, c, "dist2", Point_dist2__vm, ARGS_ANY());
+	mrb_define_class_method(mrb, c, "new", Point_new__vm, ARGS_ANY());
+	mrb_define_method(mrb, c, "y", Point_y__vm, ARGS_ANY());
+	mrb_define_method(mrb, c, "x", Point_x__vm, ARGS_ANY());
+	c = mrb->object_class;
+}
+
+
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
@@ -0,0 +1,324 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "mruby/dump.h"
+#include "mruby/proc.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+mrb_value
+safe_total_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+guarded_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+check_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+twice_1(int val, mrb_value __self__, mrb_value arg0);
+
+static void
+hpc_vm_init(mrb_state *mrb);
+
+static mrb_value
+twice(mrb_value __self__, mrb_value x);
+static mrb_value
+twice__c1(mrb_value __self__, mrb_int x);
+
+void
+init_global_syms(mrb_state * mrb)
+{
+	hpc_vm_init(mrb);
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { NULL };
+	puts_1(0, __self__, twice__c1(__self__, 3));
+	puts_1(0, __self__, mrb_funcall(mrb, __self__, "guarded", 1, mrb_fixnum_value(4)));
+	puts_1(0, __self__, mrb_funcall(mrb, __self__, "guarded", 1, mrb_fixnum_value((-4))));
+	puts_1(0, __self__, mrb_funcall(mrb, __self__, "guarded", 1, num_sub_1(1, twice__c1(__self__, 1), mrb_fixnum_value(5))));
+	puts_1(0, __self__, mrb_funcall(mrb, __self__, "safe_total", 1, mrb_fixnum_value(5)));
+	puts_1(0, __self__, twice__c1(__self__, 5));
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+static mrb_value
+twice(mrb_value __self__, mrb_value x)
+{
+	return num_mul_1(1, mrb_funcall(mrb, __self__, "check", 1, x), mrb_fixnum_value(2));
+}
+
+static mrb_value
+twice__c1(mrb_value __self__, mrb_int x)
+{
+	return num_mul_1(1, mrb_funcall(mrb, __self__, "check", 1, mrb_fixnum_value(x)), mrb_fixnum_value(2));
+}
+
+mrb_value
+safe_total_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		default:
+			result = mrb_funcall(mrb, __self__, "safe_total", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+guarded_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		default:
+			result = mrb_funcall(mrb, __self__, "guarded", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+check_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		default:
+			result = mrb_funcall(mrb, __self__, "check", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+twice_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	return twice(__self__, arg0);
+}
+#include <stdint.h>
+const uint8_t hpc_vm_irep[] = {
+0x52,0x49,0x54,0x45,0x30,0x30,0x30,0x31,0x63,0x7a,0x00,0x00,0x05,0x4e,0x4d,0x41,
+0x54,0x5a,0x30,0x30,0x30,0x30,0x49,0x52,0x45,0x50,0x00,0x00,0x02,0xd6,0x30,0x30,
+0x30,0x30,0x00,0x06,0x00,0xd8,0x00,0x00,0x00,0x73,0x00,0x01,0x00,0x02,0x00,0x00,
+0x00,0x0e,0x00,0x80,0x00,0x48,0x01,0x00,0x02,0xc0,0x00,0x80,0x00,0x46,0x00,0x80,
+0x00,0x48,0x01,0x00,0x04,0xc0,0x00,0x80,0x40,0x46,0x00,0x80,0x00,0x48,0x01,0x00,
+0x06,0xc0,0x00,0x80,0x80,0x46,0x00,0x80,0x00,0x48,0x01,0x00,0x0a,0xc0,0x00,0x80,
+0xc0,0x46,0x00,0x80,0x00,0x05,0x00,0x00,0x00,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x04,0x00,0x0a,0x73,0x61,0x66,0x65,0x5f,0x74,0x6f,0x74,0x61,0x6c,0x00,0x00,
+0x07,0x67,0x75,0x61,0x72,0x64,0x65,0x64,0x00,0x00,0x05,0x74,0x6f,0x74,0x61,0x6c,
+0x00,0x00,0x05,0x63,0x68,0x65,0x63,0x6b,0x00,0x00,0x00,0x00,0x93,0x00,0x03,0x00,
+0x05,0x00,0x00,0x00,0x14,0x02,0x00,0x00,0x26,0x00,0x40,0x02,0x1a,0x01,0x80,0x00,
+0x06,0x02,0x00,0x40,0x01,0x01,0x80,0x00,0xa0,0x00,0x40,0x06,0x17,0x01,0x80,0x00,
+0x1b,0x02,0x00,0x00,0x91,0x02,0x80,0xc0,0x01,0x02,0x00,0x80,0xa0,0x02,0x40,0x00,
+0x98,0x00,0x40,0x02,0x97,0x01,0x80,0x00,0x06,0x02,0x00,0x00,0x3d,0x01,0x80,0xc0,
+0xa0,0x01,0xbf,0xff,0x83,0x00,0x40,0x01,0x17,0x01,0x80,0x00,0x1d,0x00,0x80,0x00,
+0x1c,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x10,0x00,0x07,0x72,0x65,0x73,0x63,
+0x75,0x65,0x64,0x00,0x00,0x00,0x04,0x00,0x05,0x74,0x6f,0x74,0x61,0x6c,0x00,0x00,
+0x0d,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,
+0x03,0x3d,0x3d,0x3d,0x00,0x00,0x04,0x70,0x75,0x74,0x73,0x00,0x00,0x00,0x00,0x9b,
+0x00,0x04,0x00,0x06,0x00,0x00,0x00,0x16,0x02,0x00,0x00,0x26,0x00,0x40,0x02,0x1a,
+0x02,0x00,0x00,0x06,0x02,0x80,0x40,0x01,0x02,0x00,0x00,0xa0,0x00,0x40,0x07,0x17,
+0x02,0x00,0x00,0x1b,0x02,0x80,0x00,0x91,0x03,0x01,0x00,0x01,0x02,0x80,0x80,0xa0,
+0x02,0xc0,0x00,0x98,0x00,0x40,0x03,0x97,0x01,0x81,0x00,0x01,0x02,0x00,0x00,0x06,
+0x02,0x80,0xc0,0x01,0x02,0x81,0x00,0x20,0x02,0x00,0xc0,0xa0,0x02,0x3f,0xff,0x03,
+0x00,0x40,0x01,0x17,0x02,0x00,0x00,0x1d,0x00,0x80,0x00,0x1c,0x02,0x00,0x00,0x29,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0x00,0x05,0x74,0x77,0x69,0x63,0x65,0x00,
+0x00,0x0d,0x41,0x72,0x67,0x75,0x6d,0x65,0x6e,0x74,0x45,0x72,0x72,0x6f,0x72,0x00,
+0x00,0x03,0x3d,0x3d,0x3d,0x00,0x00,0x04,0x70,0x75,0x74,0x73,0x00,0x00,0x07,0x6d,
+0x65,0x73,0x73,0x61,0x67,0x65,0x00,0x00,0x00,0x00,0x34,0x00,0x04,0x00,0x06,0x00,
+0x00,0x00,0x06,0x02,0x00,0x00,0x26,0x01,0xbf,0xff,0x83,0x02,0x00,0x40,0x01,0x02,
+0x80,0x03,0x40,0x02,0x00,0x00,0x21,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x01,0x00,0x05,0x74,0x69,0x6d,0x65,0x73,0x00,0x00,0x00,0x00,0x48,0x00,
+0x03,0x00,0x07,0x00,0x00,0x00,0x09,0x02,0x00,0x00,0x26,0x01,0x80,0xc0,0x15,0x02,
+0x00,0x00,0x06,0x02,0x80,0x40,0x01,0x02,0x80,0x41,0x2f,0x02,0x00,0x00,0xa0,0x01,
+0x80,0x80,0xac,0x01,0x80,0xc0,0x16,0x01,0x80,0x00,0x29,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x03,0x00,0x05,0x74,0x77,0x69,0x63,0x65,0x00,0x00,0x01,0x2d,0x00,0x00,
+0x01,0x2b,0x00,0x00,0x00,0x00,0xa9,0x00,0x03,0x00,0x06,0x00,0x00,0x00,0x17,0x02,
+0x00,0x00,0x26,0x00,0x40,0x04,0x9a,0x01,0x80,0x40,0x01,0x02,0x3f,0xff,0x83,0x01,
+0x80,0x00,0xb3,0x01,0xc0,0x02,0x19,0x01,0x80,0x00,0x06,0x02,0x00,0x01,0x11,0x02,
+0x80,0x00,0x3d,0x01,0x80,0x41,0x20,0x00,0x40,0x05,0x17,0x01,0x80,0x00,0x1b,0x02,
+0x00,0x01,0x91,0x02,0x80,0xc0,0x01,0x02,0x01,0x00,0xa0,0x02,0x40,0x00,0x98,0x00,
+0x40,0x01,0x97,0x01,0xbf,0xff,0x83,0x01,0x80,0x80,0x29,0x00,0x40,0x01,0x17,0x01,
+0x80,0x00,0x1d,0x00,0x80,0x00,0x1c,0x00,0x80,0x00,0x29,0x00,0x00,0x00,0x01,0x10,
+0x00,0x08,0x6e,0x65,0x67,0x61,0x74,0x69,0x76,0x65,0x00,0x00,0x00,0x05,0x00,0x01,
+0x3c,0x00,0x00,0x05,0x72,0x61,0x69,0x73,0x65,0x00,0x00,0x0d,0x41,0x72,0x67,0x75,
+0x6d,0x65,0x6e,0x74,0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x09,0x54,0x79,0x70,0x65,
+0x45,0x72,0x72,0x6f,0x72,0x00,0x00,0x03,0x3d,0x3d,0x3d,0x00,0x4c,0x49,0x4e,0x45,
+0x00,0x00,0x02,0x5a,0x00,0x06,0x00,0xd8,0x00,0x00,0x00,0x5f,0x00,0x39,0x2f,0x72,
+0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,
+0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,0x72,
+0x62,0x2f,0x74,0x65,0x73,0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x76,0x6d,0x5f,0x72,
+0x61,0x69,0x73,0x65,0x2e,0x72,0x62,0x00,0x00,0x00,0x0e,0x00,0x28,0x00,0x28,0x00,
+0x28,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x16,0x00,0x16,0x00,0x16,0x00,0x0a,0x00,
+0x0a,0x00,0x0a,0x00,0x0a,0x00,0x0a,0x00,0x00,0x00,0x6b,0x00,0x39,0x2f,0x72,0x6f,
+0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,
+0x6d,0x72,0x75,0x62,0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,0x72,0x62,
+0x2f,0x74,0x65,0x73,0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x76,0x6d,0x5f,0x72,0x61,
+0x69,0x73,0x65,0x2e,0x72,0x62,0x00,0x00,0x00,0x14,0x00,0x28,0x00,0x27,0x00,0x23,
+0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x23,0x00,0x24,0x00,0x24,0x00,0x24,0x00,0x24,
+0x00,0x24,0x00,0x25,0x00,0x25,0x00,0x25,0x00,0x26,0x00,0x26,0x00,0x26,0x00,0x26,
+0x00,0x26,0x00,0x00,0x00,0x6f,0x00,0x39,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,
+0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,
+0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,0x72,0x62,0x2f,0x74,0x65,0x73,0x74,
+0x63,0x61,0x73,0x65,0x73,0x2f,0x76,0x6d,0x5f,0x72,0x61,0x69,0x73,0x65,0x2e,0x72,
+0x62,0x00,0x00,0x00,0x16,0x00,0x1f,0x00,0x1e,0x00,0x1a,0x00,0x1a,0x00,0x1a,0x00,
+0x1a,0x00,0x1a,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,0x1b,0x00,
+0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1c,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,0x1d,0x00,
+0x1d,0x00,0x00,0x00,0x4f,0x00,0x39,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,
+0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,
+0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,0x72,0x62,0x2f,0x74,0x65,0x73,0x74,0x63,
+0x61,0x73,0x65,0x73,0x2f,0x76,0x6d,0x5f,0x72,0x61,0x69,0x73,0x65,0x2e,0x72,0x62,
+0x00,0x00,0x00,0x06,0x00,0x16,0x00,0x11,0x00,0x12,0x00,0x14,0x00,0x14,0x00,0x15,
+0x00,0x00,0x00,0x55,0x00,0x39,0x2f,0x72,0x6f,0x6f,0x74,0x2f,0x72,0x65,0x70,0x6f,
+0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,0x75,0x62,0x79,0x2d,0x62,
+0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,0x72,0x62,0x2f,0x74,0x65,0x73,0x74,0x63,0x61,
+0x73,0x65,0x73,0x2f,0x76,0x6d,0x5f,0x72,0x61,0x69,0x73,0x65,0x2e,0x72,0x62,0x00,
+0x00,0x00,0x09,0x00,0x14,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,0x13,0x00,
+0x13,0x00,0x13,0x00,0x13,0x00,0x00,0x00,0x71,0x00,0x39,0x2f,0x72,0x6f,0x6f,0x74,
+0x2f,0x72,0x65,0x70,0x6f,0x2f,0x6d,0x72,0x62,0x67,0x65,0x6d,0x73,0x2f,0x6d,0x72,
+0x75,0x62,0x79,0x2d,0x62,0x69,0x6e,0x2d,0x68,0x70,0x63,0x6d,0x72,0x62,0x2f,0x74,
+0x65,0x73,0x74,0x63,0x61,0x73,0x65,0x73,0x2f,0x76,0x6d,0x5f,0x72,0x61,0x69,0x73,
+0x65,0x2e,0x72,0x62,0x00,0x00,0x00,0x17,0x00,0x0a,0x00,0x08,0x00,0x05,0x00,0x05,
+0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,0x00,0x05,
+0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x07,0x00,0x07,0x00,0x07,
+0x00,0x07,0x00,0x07,0x00,0x09,0x45,0x4e,0x44,0x00,0x00,0x00,0x00,0x08,
+};
+
+static mrb_value
+twice__vm(mrb_state *mrb, mrb_value self)
+{
+	mrb_value *argv;
+	int argc;
+
+	mrb_get_args(mrb, "*", &argv, &argc);
+	if (argc != 1)
+		mrb_raisef(mrb, E_ARGUMENT_ERROR, "wrong number of arguments (%S for 1)", mrb_fixnum_value(argc));
+	return twice(self, argv[0]);
+}
+
+static void
+hpc_vm_init(mrb_state *mrb)
+{
+	struct RClass *c;
+	size_t n = mrb->irep_len;
+
+	if (mrb_read_irep(mrb, hpc_vm_irep) < 0) {
+		fputs("cannot load the methods left to the VM\n", stderr);
+		exit(EXIT_FAILURE);
+	}
+	mrb_run(mrb, mrb_proc_new(mrb, mrb->irep[n]), mrb_top_self(mrb));
+	if (mrb->exc) {
+		mrb_p(mrb, mrb_obj_value(mrb->exc));
+		exit(EXIT_FAILURE);
+	}
+	c = mrb->object_class;
+	mrb_define_method(mrb, c, "twice", twice__vm, ARGS_ANY());
+}
+
+
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
@@ -0,0 +1,890 @@
+/* Generated by HPC mruby compiler */
+#include <stdio.h>
+#include <stdlib.h>
+#include "mruby.h"
+#include "mruby/variable.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "builtin.h"
+
+extern mrb_state * mrb;
+
+static void
+hpc_free(mrb_state *mrb, void *p)
+{
+	mrb_free(mrb, p);
+}
+static void hpc_mark(mrb_state *mrb, void *p);
+static const struct mrb_data_type hpc_data_type = {
+	"hpcmrb_class", hpc_free, hpc_mark
+};
+
+static int
+hpc_type_of(mrb_value v)
+{
+	if (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)
+		return 0;
+	return *(int *)DATA_PTR(v);
+}
+
+static inline int
+hpc_class_eq(mrb_value v, mrb_value klass)
+{
+	return mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);
+}
+
+#define T_Acc 1001
+typedef struct {
+	int type;
+	double f;
+} cAcc;
+
+#define T_Tally 1002
+typedef struct {
+	int type;
+	double n;
+} cTally;
+
+#define T_Cell 1003
+typedef struct {
+	int type;
+	mrb_value name;
+	double v;
+} cCell;
+
+static void
+hpc_mark(mrb_state *mrb, void *p)
+{
+	switch (*(int *)p) {
+	case T_Cell:
+		mrb_gc_mark_value(mrb, ((cCell *)p)->name);
+		break;
+	}
+}
+
+void
+compiled_main(mrb_value __self__, mrb_state * mrb);
+mrb_value
+each_step_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+set_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);
+mrb_value
+relabel_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);
+mrb_value
+bump_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+add_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);
+mrb_value
+fill_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);
+mrb_value
+v_0(int val, mrb_value __self__);
+mrb_value
+v_set_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+name_0(int val, mrb_value __self__);
+mrb_value
+name_set_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+n_0(int val, mrb_value __self__);
+mrb_value
+n_set_1(int val, mrb_value __self__, mrb_value arg0);
+mrb_value
+f_0(int val, mrb_value __self__);
+mrb_value
+f_set_1(int val, mrb_value __self__, mrb_value arg0);
+
+static mrb_value
+Acc_initialize(mrb_value __self__);
+static mrb_value
+Acc_f_set(mrb_value __self__, mrb_value f);
+static mrb_value
+Acc_f(mrb_value __self__);
+static double
+Acc_f_set__c15(mrb_value __self__, double f);
+static double
+Acc_f__c14(mrb_value __self__);
+static double
+Acc_initialize__c13(mrb_value __self__);
+static mrb_value
+Acc_new__c13(mrb_value __self__);
+static mrb_value
+Tally_initialize(mrb_value __self__);
+static mrb_value
+Tally_n_set(mrb_value __self__, mrb_value n);
+static mrb_value
+Tally_n(mrb_value __self__);
+static double
+Tally_n_set__c11(mrb_value __self__, double n);
+static double
+Tally_n__c10(mrb_value __self__);
+static double
+Tally_initialize__c9(mrb_value __self__);
+static mrb_value
+Tally_new__c9(mrb_value __self__);
+static mrb_value
+Cell_initialize(mrb_value __self__, mrb_value v);
+static mrb_value
+Cell_name_set(mrb_value __self__, mrb_value name);
+static mrb_value
+Cell_name(mrb_value __self__);
+static mrb_value
+Cell_v_set(mrb_value __self__, mrb_value v);
+static mrb_value
+Cell_v(mrb_value __self__);
+static mrb_value
+Cell_name__c7(mrb_value __self__);
+static mrb_value
+Cell_name_set__c5(mrb_value __self__, mrb_value name);
+static double
+Cell_v__c4(mrb_value __self__);
+static double
+Cell_v_set__c2(mrb_value __self__, double v);
+static mrb_value
+Cell_initialize__c1(mrb_value __self__, double v);
+static mrb_value
+Cell_new__c1(mrb_value __self__, double v);
+static mrb_value
+fill(mrb_value __self__, mrb_value c, mrb_value n);
+static mrb_value
+add(mrb_value __self__, mrb_value a, mrb_value x);
+static mrb_value
+bump(mrb_value __self__, mrb_value t);
+static mrb_value
+relabel(mrb_value __self__, mrb_value c, mrb_value s);
+static mrb_value
+set(mrb_value __self__, mrb_value c, mrb_value n);
+static mrb_value
+each_step(mrb_value __self__, mrb_value n);
+static double
+add__c16(mrb_value __self__, mrb_value a, double x);
+static double
+bump__c12(mrb_value __self__, mrb_value t);
+static mrb_int
+fill__c8(mrb_value __self__, mrb_value c, mrb_int n);
+static mrb_value
+relabel__c6(mrb_value __self__, mrb_value c, mrb_value s);
+static double
+set__c3(mrb_value __self__, mrb_value c, double n);
+mrb_sym __i_f;
+mrb_sym __i_n;
+mrb_sym __i_name;
+mrb_sym __i_v;
+
+void
+init_global_syms(mrb_state * mrb)
+{
+	__i_f = mrb_intern(mrb, "f");
+	__i_n = mrb_intern(mrb, "n");
+	__i_name = mrb_intern(mrb, "name");
+	__i_v = mrb_intern(mrb, "v");
+}
+mrb_value
+new_0(int val, mrb_value __self__);mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0);mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1);mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2);void Acc_init(mrb_value __self__);
+void Tally_init(mrb_value __self__);
+void Cell_init(mrb_value __self__);
+mrb_value Cell;
+mrb_value Tally;
+mrb_value Acc;
+void
+compiled_main(mrb_value __self__, mrb_state * mrb)
+{
+	static mrb_value *__global_roots[] = { &Cell, &Tally, &Acc };
+	static mrb_shadow_frame __global_frame;
+	__global_frame.prev = mrb->shadow_frames;
+	__global_frame.len = sizeof(__global_roots) / sizeof(__global_roots[0]);
+	__global_frame.roots = __global_roots;
+	mrb->shadow_frames = &__global_frame;
+	mrb_value c = mrb_nil_value();
+	mrb_value t = mrb_nil_value();
+	mrb_value a = mrb_nil_value();
+	mrb_value *__roots1[] = { &c, &t, &a };
+	HPC_FRAME_PUSH(__frame1, __roots1);
+
+	Cell = mrb_obj_value(mrb_define_class(mrb, "Cell", mrb->object_class));
+	Cell_init(Cell);
+	Tally = mrb_obj_value(mrb_define_class(mrb, "Tally", mrb->object_class));
+	Tally_init(Tally);
+	Acc = mrb_obj_value(mrb_define_class(mrb, "Acc", mrb->object_class));
+	Acc_init(Acc);
+	c = Cell_new__c1(Cell, 1.0);
+	puts_1(0, __self__, mrb_float_value(set__c3(__self__, c, 2.5)));
+	puts_1(0, __self__, mrb_float_value((set__c3(__self__, c, 4.0) + ((mrb_float)1))));
+	puts_1(0, __self__, mrb_float_value(((cCell *)DATA_PTR(c))->v));
+	puts_1(0, __self__, relabel__c6(__self__, c, mrb_str_new(mrb, "a", 1)));
+	puts_1(0, __self__, ((cCell *)DATA_PTR(c))->name);
+	fill__c8(__self__, c, 4);
+	puts_1(0, __self__, mrb_float_value(((cCell *)DATA_PTR(c))->v));
+	t = Tally_new__c9(Tally);
+	bump__c12(__self__, t);
+	puts_1(0, __self__, mrb_float_value((bump__c12(__self__, t) * ((mrb_float)10))));
+	puts_1(0, __self__, mrb_float_value(((cTally *)DATA_PTR(t))->n));
+	a = Acc_new__c13(Acc);
+	add__c16(__self__, a, 0.5);
+	puts_1(0, __self__, mrb_float_value((add__c16(__self__, a, 1.25) * ((mrb_float)2))));
+	puts_1(0, __self__, mrb_float_value(((cAcc *)DATA_PTR(a))->f));
+	HPC_FRAME_POP(__frame1);
+}
+
+mrb_value
+new_0(int val, mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+	if (c == (struct RClass *)mrb_obj_ptr(Tally)) {
+		cTally *sval;
+		Data_Make_Struct(mrb, c, cTally, &hpc_data_type, sval, data);
+		sval->type = T_Tally;
+		obj = mrb_obj_value(data);
+		Tally_initialize(obj);
+} else 	if (c == (struct RClass *)mrb_obj_ptr(Acc)) {
+		cAcc *sval;
+		Data_Make_Struct(mrb, c, cAcc, &hpc_data_type, sval, data);
+		sval->type = T_Acc;
+		obj = mrb_obj_value(data);
+		Acc_initialize(obj);
+} else {
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 0, NULL);
+	}
+	return obj;
+}
+
+mrb_value
+new_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+	if (c == (struct RClass *)mrb_obj_ptr(Cell)) {
+		cCell *sval;
+		Data_Make_Struct(mrb, c, cCell, &hpc_data_type, sval, data);
+		sval->type = T_Cell;
+		obj = mrb_obj_value(data);
+		Cell_initialize(obj, arg0);
+} else {
+		mrb_value argv[] = { arg0 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 1, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 2, argv);
+	}
+	return obj;
+}
+
+mrb_value
+new_3(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1, mrb_value arg2)
+{
+	mrb_value obj;
+	struct RData * data;
+	struct RClass *c = mrb_class_ptr(__self__);
+{
+		mrb_value argv[] = { arg0, arg1, arg2 };
+		obj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, "new"), 3, argv);
+	}
+	return obj;
+}
+
+void
+Acc_init(mrb_value __self__)
+{
+}
+
+void
+Tally_init(mrb_value __self__)
+{
+}
+
+void
+Cell_init(mrb_value __self__)
+{
+}
+
+static mrb_value
+Acc_initialize(mrb_value __self__)
+{
+	cAcc *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->f = 0.0;
+	return mrb_float_value(data->f);
+}
+
+static mrb_value
+Acc_f_set(mrb_value __self__, mrb_value f)
+{
+	cAcc *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->f = hpc_to_float(f);
+	return mrb_float_value(data->f);
+}
+
+static mrb_value
+Acc_f(mrb_value __self__)
+{
+	cAcc *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return mrb_float_value(data->f);
+}
+
+static double
+Acc_f_set__c15(mrb_value __self__, double f)
+{
+	cAcc *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->f = f;
+	return data->f;
+}
+
+static double
+Acc_f__c14(mrb_value __self__)
+{
+	cAcc *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->f;
+}
+
+static double
+Acc_initialize__c13(mrb_value __self__)
+{
+	cAcc *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->f = 0.0;
+	return data->f;
+}
+
+static mrb_value
+Acc_new__c13(mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	cAcc *sval;
+	Data_Make_Struct(mrb, mrb_class_ptr(__self__), cAcc, &hpc_data_type, sval, data);
+	sval->type = T_Acc;
+	obj = mrb_obj_value(data);
+	Acc_initialize__c13(obj);
+	return obj;
+}
+
+static mrb_value
+Tally_initialize(mrb_value __self__)
+{
+	cTally *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->n = 0.0;
+	return mrb_float_value(data->n);
+}
+
+static mrb_value
+Tally_n_set(mrb_value __self__, mrb_value n)
+{
+	cTally *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->n = hpc_to_float(n);
+	return mrb_float_value(data->n);
+}
+
+static mrb_value
+Tally_n(mrb_value __self__)
+{
+	cTally *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return mrb_float_value(data->n);
+}
+
+static double
+Tally_n_set__c11(mrb_value __self__, double n)
+{
+	cTally *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->n = n;
+	return data->n;
+}
+
+static double
+Tally_n__c10(mrb_value __self__)
+{
+	cTally *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->n;
+}
+
+static double
+Tally_initialize__c9(mrb_value __self__)
+{
+	cTally *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->n = 0.0;
+	return data->n;
+}
+
+static mrb_value
+Tally_new__c9(mrb_value __self__)
+{
+	mrb_value obj;
+	struct RData * data;
+	cTally *sval;
+	Data_Make_Struct(mrb, mrb_class_ptr(__self__), cTally, &hpc_data_type, sval, data);
+	sval->type = T_Tally;
+	obj = mrb_obj_value(data);
+	Tally_initialize__c9(obj);
+	return obj;
+}
+
+static mrb_value
+Cell_initialize(mrb_value __self__, mrb_value v)
+{
+	cCell *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->v = hpc_to_float(v);
+	data->name = mrb_str_new(mrb, "cell", 4);
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->name);
+	return data->name;
+}
+
+static mrb_value
+Cell_name_set(mrb_value __self__, mrb_value name)
+{
+	cCell *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->name = name;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->name);
+	return data->name;
+}
+
+static mrb_value
+Cell_name(mrb_value __self__)
+{
+	cCell *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->name;
+}
+
+static mrb_value
+Cell_v_set(mrb_value __self__, mrb_value v)
+{
+	cCell *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->v = hpc_to_float(v);
+	return mrb_float_value(data->v);
+}
+
+static mrb_value
+Cell_v(mrb_value __self__)
+{
+	cCell *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return mrb_float_value(data->v);
+}
+
+static mrb_value
+Cell_name__c7(mrb_value __self__)
+{
+	cCell *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->name;
+}
+
+static mrb_value
+Cell_name_set__c5(mrb_value __self__, mrb_value name)
+{
+	cCell *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->name = name;
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->name);
+	return data->name;
+}
+
+static double
+Cell_v__c4(mrb_value __self__)
+{
+	cCell *data;
+	*(void**)&data = DATA_PTR(__self__);
+	return data->v;
+}
+
+static double
+Cell_v_set__c2(mrb_value __self__, double v)
+{
+	cCell *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->v = v;
+	return data->v;
+}
+
+static mrb_value
+Cell_initialize__c1(mrb_value __self__, double v)
+{
+	cCell *data;
+	*(void**)&data = DATA_PTR(__self__);
+	data->v = v;
+	data->name = mrb_str_new(mrb, "cell", 4);
+	mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), data->name);
+	return data->name;
+}
+
+static mrb_value
+Cell_new__c1(mrb_value __self__, double v)
+{
+	mrb_value obj;
+	struct RData * data;
+	cCell *sval;
+	Data_Make_Struct(mrb, mrb_class_ptr(__self__), cCell, &hpc_data_type, sval, data);
+	sval->type = T_Cell;
+	obj = mrb_obj_value(data);
+	Cell_initialize__c1(obj, v);
+	return obj;
+}
+
+static mrb_value
+fill(mrb_value __self__, mrb_value c, mrb_value n)
+{
+	{
+		mrb_value __tmp_10 = mrb_nil_value();
+		mrb_value *__roots2[] = { &__tmp_10 };
+		HPC_FRAME_PUSH(__frame2, __roots2);
+
+		{
+			{
+				{
+					mrb_int __i__13 = 0;
+					mrb_int __i__13_last = mrb_fixnum(n);
+					for (; __i__13 < __i__13_last; ++__i__13) {
+						int ai = mrb_gc_arena_save(mrb);
+						mrb_int i__13 = __i__13;
+						{
+							mrb_value __tmp_12__13 = mrb_nil_value();
+							mrb_value *__roots3[] = { &__tmp_12__13 };
+							HPC_FRAME_PUSH(__frame3, __roots3);
+
+							{
+								__tmp_12__13 = v_set_1(1, c, mrb_float_value((((mrb_float)i__13) * 1.5)));
+							}
+							HPC_FRAME_POP(__frame3);
+						}
+						mrb_gc_arena_restore(mrb, ai);
+					}
+				}
+				__tmp_10 = n;
+			}
+		}
+		{
+			mrb_value __ret = __tmp_10;
+			HPC_FRAME_POP(__frame2);
+			return __ret;
+		}
+	}
+}
+
+static mrb_value
+add(mrb_value __self__, mrb_value a, mrb_value x)
+{
+	return f_set_1(1, a, num_add_1(1, f_0(1, a), x));
+}
+
+static mrb_value
+bump(mrb_value __self__, mrb_value t)
+{
+	return n_set_1(1, t, num_add_1(1, n_0(1, t), mrb_float_value(0.5)));
+}
+
+static mrb_value
+relabel(mrb_value __self__, mrb_value c, mrb_value s)
+{
+	mrb_value t = mrb_nil_value();
+	mrb_value *__roots4[] = { &t };
+	HPC_FRAME_PUSH(__frame4, __roots4);
+
+	t = name_set_1(1, c, s);
+	{
+		mrb_value __ret = num_add_1(1, t, mrb_str_new(mrb, "!", 1));
+		HPC_FRAME_POP(__frame4);
+		return __ret;
+	}
+}
+
+static mrb_value
+set(mrb_value __self__, mrb_value c, mrb_value n)
+{
+	return v_set_1(1, c, n);
+}
+
+static mrb_value
+each_step(mrb_value __self__, mrb_value n)
+{
+	mrb_value __block__ = hpc_take_block();
+	{
+		{
+			mrb_int __i = 0;
+			mrb_int __i_last = mrb_fixnum(n);
+			for (; __i < __i_last; ++__i) {
+				int ai = mrb_gc_arena_save(mrb);
+				mrb_int i = __i;
+				hpc_yield(__block__, 1, (mrb_value[]){mrb_fixnum_value(i)});
+				mrb_gc_arena_restore(mrb, ai);
+			}
+		}
+		return n;
+	}
+}
+
+static double
+add__c16(mrb_value __self__, mrb_value a, double x)
+{
+	return (((cAcc *)DATA_PTR(a))->f = (((cAcc *)DATA_PTR(a))->f + x));
+}
+
+static double
+bump__c12(mrb_value __self__, mrb_value t)
+{
+	return (((cTally *)DATA_PTR(t))->n = (((cTally *)DATA_PTR(t))->n + 0.5));
+}
+
+static mrb_int
+fill__c8(mrb_value __self__, mrb_value c, mrb_int n)
+{
+	{
+		mrb_int __tmp_14;
+
+		{
+			{
+				{
+					mrb_int __i__17 = 0;
+					mrb_int __i__17_last = n;
+					for (; __i__17 < __i__17_last; ++__i__17) {
+						int ai = mrb_gc_arena_save(mrb);
+						mrb_int i__17 = __i__17;
+						{
+							double __tmp_16__17;
+
+							{
+								__tmp_16__17 = (((cCell *)DATA_PTR(c))->v = (((mrb_float)i__17) * 1.5));
+							}
+						}
+						mrb_gc_arena_restore(mrb, ai);
+					}
+				}
+				__tmp_14 = n;
+			}
+		}
+		return __tmp_14;
+	}
+}
+
+static mrb_value
+relabel__c6(mrb_value __self__, mrb_value c, mrb_value s)
+{
+	mrb_value t = mrb_nil_value();
+	mrb_value *__roots5[] = { &t };
+	HPC_FRAME_PUSH(__frame5, __roots5);
+
+	t = hpc_field_set(mrb, mrb_basic_ptr(c), &((cCell *)DATA_PTR(c))->name, s);
+	{
+		mrb_value __ret = ({
+			mrb_value __s = mrb_str_buf_new(mrb, 1);
+			mrb_str_concat(mrb, __s, t);
+			mrb_str_cat(mrb, __s, "!", 1);
+			__s;
+		});
+		HPC_FRAME_POP(__frame5);
+		return __ret;
+	}
+}
+
+static double
+set__c3(mrb_value __self__, mrb_value c, double n)
+{
+	return (((cCell *)DATA_PTR(c))->v = n);
+}
+
+mrb_value
+each_step_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	return each_step(__self__, arg0);
+}mrb_value
+set_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	return set(__self__, arg0, arg1);
+}mrb_value
+relabel_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	return relabel(__self__, arg0, arg1);
+}mrb_value
+bump_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	return bump(__self__, arg0);
+}mrb_value
+add_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	return add(__self__, arg0, arg1);
+}mrb_value
+fill_2(int val, mrb_value __self__, mrb_value arg0, mrb_value arg1)
+{
+	return fill(__self__, arg0, arg1);
+}mrb_value
+v_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Cell:
+			result = Cell_v(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "v", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+v_set_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Cell:
+			result = Cell_v_set(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "v=", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+name_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Cell:
+			result = Cell_name(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "name", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+name_set_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Cell:
+			result = Cell_name_set(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "name=", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+n_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Tally:
+			result = Tally_n(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "n", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+n_set_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Tally:
+			result = Tally_n_set(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "n=", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+f_0(int val, mrb_value __self__)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Acc:
+			result = Acc_f(__self__);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "f", 0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+mrb_value
+f_set_1(int val, mrb_value __self__, mrb_value arg0)
+{
+	int ai;
+	if (!val) ai = mrb_gc_arena_save(mrb);
+	mrb_value result;
+{
+		switch (hpc_type_of(__self__)) {
+		case T_Acc:
+			result = Acc_f_set(__self__, arg0);
+			break;
+		default:
+			result = mrb_funcall(mrb, __self__, "f=", 1, arg0);
+		}
+	}
+	if (!val) mrb_gc_arena_restore(mrb,  ai);
+	return result;
+}
+
+
+/* runtime */
+#include "builtin.c"
+#include "driver.c"
@@ -49,6 +49,7 @@ MRuby::Build.new do |conf|
 
   # Use Random class
   conf.gem "#{root}/mrbgems/mruby-random"
+  conf.gem "#{root}/mrbgems/mruby-numeric-array"
 
   # No use eval method
   # conf.gem "#{root}/mrbgems/mruby-eval"
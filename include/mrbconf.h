@@ -26,8 +26,6 @@
 /* argv max size in mrb_funcall */
 //#define MRB_FUNCALL_ARGC_MAX 16
 
-#define MRB_ARENA_SIZE (1024*1024)
-
 /* number of object per heap page */
 //#define MRB_HEAP_PAGE_SIZE 1024
 
@@ -57,6 +55,7 @@
 
 /* -DDISABLE_XXXX to drop following features */
 //#define DISABLE_STDIO		/* use of stdio */
+//#define DISABLE_TYPE_PROFILE	/* hooks recording types for hpcmrb */
 
 /* -DENABLE_XXXX to enable following features */
 //#define ENABLE_DEBUG		/* hooks for debugger */
@@ -109,6 +108,9 @@ typedef short mrb_sym;
 #ifndef ENABLE_DEBUG
 #define DISABLE_DEBUG
 #endif
+#ifndef DISABLE_TYPE_PROFILE
+#define ENABLE_TYPE_PROFILE
+#endif
 
 #ifdef _MSC_VER
 # include <float.h>
@@ -67,6 +67,13 @@ enum gc_state {
   GC_STATE_SWEEP
 };
 
+/* boxed locals of a C function, e.g. compiled by hpcmrb, marked by the GC */
+typedef struct mrb_shadow_frame {
+  struct mrb_shadow_frame *prev;
+  int len;
+  mrb_value **roots;
+} mrb_shadow_frame;
+
 typedef struct mrb_state {
   void *jmp;
 
@@ -113,6 +120,7 @@ typedef struct mrb_state {
   size_t live; /* count of live objects */
   struct RBasic *arena[MRB_ARENA_SIZE];
   int arena_idx;
+  struct mrb_shadow_frame *shadow_frames; /* innermost is the first */
 
   enum gc_state gc_state; /* state of gc */
   int current_white_part; /* make white object by white_part */
@@ -135,6 +143,10 @@ typedef struct mrb_state {
 #ifdef ENABLE_DEBUG
   void (*code_fetch_hook)(struct mrb_state* mrb, struct mrb_irep *irep, mrb_code *pc, mrb_value *regs);
 #endif
+#ifdef ENABLE_TYPE_PROFILE
+  /* called at OP_ENTER and OP_SETIV */
+  void (*type_profile_hook)(struct mrb_state* mrb, struct mrb_irep *irep, mrb_code *pc, mrb_value *regs);
+#endif
 
   struct RClass *eException_class;
   struct RClass *eStandardError_class;
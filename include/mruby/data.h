@@ -14,6 +14,7 @@ extern "C" {
 typedef struct mrb_data_type {
   const char *struct_name;
   void (*dfree)(mrb_state *mrb, void*);
+  void (*dmark)(mrb_state *mrb, void*);  /* marks objects referred from the data */
 } mrb_data_type;
 
 struct RData {
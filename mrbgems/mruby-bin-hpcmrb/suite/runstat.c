@@ -0,0 +1,79 @@
+/*
+  Preloaded into the programs run by suite.rb.  Counts the heap
+  allocations and the user instructions of the program, and writes
+  them to the file named by $HPCMRB_RUNSTAT at exit:
+
+    allocations <count>
+    instructions <count, or -1 without a hardware counter>
+ */
+#define _GNU_SOURCE
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t n, size_t size);
+extern void *__libc_realloc(void *p, size_t size);
+
+static unsigned long allocations;
+static int perf_fd = -1;
+
+void *
+malloc(size_t size)
+{
+  __sync_fetch_and_add(&allocations, 1);
+  return __libc_malloc(size);
+}
+
+void *
+calloc(size_t n, size_t size)
+{
+  __sync_fetch_and_add(&allocations, 1);
+  return __libc_calloc(n, size);
+}
+
+/* mruby allocates by realloc(NULL, size) */
+void *
+realloc(void *p, size_t size)
+{
+  if (!p)
+    __sync_fetch_and_add(&allocations, 1);
+  return __libc_realloc(p, size);
+}
+
+__attribute__((constructor)) static void
+runstat_start(void)
+{
+  struct perf_event_attr attr;
+
+  memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.inherit = 1;             /* with the threads of OpenMP */
+  perf_fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+  allocations = 0;              /* not the ones of the loader */
+}
+
+__attribute__((destructor)) static void
+runstat_finish(void)
+{
+  const char *path = getenv("HPCMRB_RUNSTAT");
+  unsigned long count = allocations;    /* before fopen allocates */
+  int64_t instructions = -1;
+  FILE *fp;
+
+  if (perf_fd >= 0 && read(perf_fd, &instructions, sizeof(instructions)) != sizeof(instructions))
+    instructions = -1;
+  if (!path || !(fp = fopen(path, "w")))
+    return;
+  fprintf(fp, "allocations %lu\ninstructions %lld\n", count, (long long)instructions);
+  fclose(fp);
+}
@@ -0,0 +1,133 @@
+# Regression and benchmark suite of hpcmrb
+#
+#   ruby suite.rb [-o report.json] [-t timeout] [files...]
+#
+# Runs each file (testcases/*.rb and benchmark/*.rb by default) on the
+# VM by bin/mruby, compiles it by bin/hpcmrb $HPCMRB_FLAGS and runs the
+# executable.  The stdout and the exit status of the two runs must be
+# the same.  The wall time, the instructions and the heap allocations
+# of both runs are written to the report in JSON (runstat.c counts them;
+# instructions are null without a hardware counter).
+#
+# Exits with 1 if a file fails to compile, or the compiled program
+# differs from the VM or times out, unless EXPECTED_FAILURES lists the
+# file with that status.
+
+require 'fileutils'
+require 'json'
+
+MRUBY_ROOT = File.expand_path('../../../..', __FILE__)
+SUITE_DIR = File.dirname(File.expand_path(__FILE__))
+WORK_DIR = "#{MRUBY_ROOT}/build/hpcmrb_suite"
+MRUBY = "#{MRUBY_ROOT}/bin/mruby"
+HPCMRB = "#{MRUBY_ROOT}/bin/hpcmrb"
+HPCMRB_FLAGS = (ENV['HPCMRB_FLAGS'] || '-g -O2').split
+RUNSTAT = "#{WORK_DIR}/runstat.so"
+
+# name => status of the files known to fail, each with the reason
+EXPECTED_FAILURES = {
+  # rand is seeded by the time, so the two runs print different numbers
+  'assign' => 'diff',
+}
+
+report_file = "#{WORK_DIR}/report.json"
+timeout = 600
+files = []
+until ARGV.empty?
+  arg = ARGV.shift
+  case arg
+  when '-o' then report_file = ARGV.shift
+  when '-t' then timeout = ARGV.shift.to_f
+  else files << arg
+  end
+end
+if files.empty?
+  files = Dir["#{MRUBY_ROOT}/mrbgems/mruby-bin-hpcmrb/testcases/*.rb"].sort +
+    Dir["#{MRUBY_ROOT}/benchmark/*.rb"].sort
+end
+
+FileUtils.mkdir_p WORK_DIR
+unless system('cc', '-O2', '-shared', '-fPIC', '-o', RUNSTAT, "#{SUITE_DIR}/runstat.c")
+  abort "suite.rb: cannot build runstat.c"
+end
+
+def now
+  Process.clock_gettime(Process::CLOCK_MONOTONIC)
+end
+
+# run cmd with stdout to out, returns the exit status (nil on timeout)
+# and the wall time
+def spawn_timed(cmd, out, timeout, env = {})
+  start = now
+  pid = spawn(env, *cmd, :out => out, :err => "#{out}.err", :chdir => MRUBY_ROOT)
+  waiter = Thread.new { Process.wait2(pid)[1] }
+  unless waiter.join(timeout)
+    Process.kill(:KILL, pid)
+    waiter.join
+    return nil, now - start
+  end
+  return waiter.value.exitstatus, now - start
+end
+
+def run(cmd, out, timeout)
+  stat = "#{out}.stat"
+  FileUtils.rm_f stat
+  status, wall = spawn_timed(cmd, out, timeout,
+                             'LD_PRELOAD' => RUNSTAT, 'HPCMRB_RUNSTAT' => stat)
+  counts = {}
+  if File.exist?(stat)
+    File.readlines(stat).each do |line|
+      key, n = line.split
+      counts[key] = n.to_i < 0 ? nil : n.to_i
+    end
+  end
+  { 'exit' => status, 'wall' => wall.round(4),
+    'instructions' => counts['instructions'], 'allocations' => counts['allocations'] }
+end
+
+results = files.map do |file|
+  name = File.basename(file, '.rb')
+  base = "#{WORK_DIR}/#{name}"
+  result = { 'name' => name, 'file' => file.sub("#{MRUBY_ROOT}/", '') }
+
+  result['vm'] = run([MRUBY, file], "#{base}.vm.out", timeout)
+  status, wall = spawn_timed([HPCMRB, *HPCMRB_FLAGS, '-o', base, file],
+                             "#{base}.compile.log", timeout)
+  result['compile'] = { 'exit' => status, 'wall' => wall.round(4) }
+  if status != 0
+    result['status'] = 'compile_error'
+  else
+    hpc = result['hpcmrb'] = run([base], "#{base}.hpc.out", timeout)
+    vm = result['vm']
+    if vm['exit'].nil? || hpc['exit'].nil?
+      result['status'] = 'timeout'
+    elsif hpc['exit'] != vm['exit'] ||
+        File.read("#{base}.vm.out") != File.read("#{base}.hpc.out")
+      result['status'] = 'diff'
+    else
+      result['status'] = 'same'
+    end
+    result['speedup'] = (vm['wall'] / hpc['wall']).round(2) if hpc['wall'] > 0
+  end
+  result['expected'] = true if EXPECTED_FAILURES[name] == result['status']
+  printf("%-24s %-14s vm %9.3fs  hpcmrb %9s  %s%s\n", name, result['status'],
+         result['vm']['wall'],
+         result['hpcmrb'] ? format('%.3fs', result['hpcmrb']['wall']) : '-',
+         result['speedup'] ? "x#{result['speedup']}" : '',
+         result['expected'] ? ' (expected)' : '')
+  $stdout.flush
+  result
+end
+
+summary = Hash.new(0)
+results.each { |r| summary[r['status']] += 1 }
+File.open(report_file, 'w') do |f|
+  f.puts JSON.pretty_generate('hpcmrb_flags' => HPCMRB_FLAGS.join(' '),
+                              'summary' => summary, 'results' => results)
+end
+puts "#{summary.map { |k, v| "#{k}: #{v}" }.join(', ')} (#{report_file})"
+failures = results.reject { |r| r['status'] == 'same' || r['expected'] }
+unless failures.empty?
+  puts "unexpected: #{failures.map { |r| "#{r['name']} (#{r['status']})" }.join(', ')}"
+end
+exit(failures.empty? ? 0 : 1)
@@ -0,0 +1,26 @@
+# elements in bounds are read without checks, others as on the VM
+a = Array.new
+b = Array.new
+10.times do |i|
+  a[i] = i * 0.5
+end
+a.length.times do |i|
+  b[i] = a[i]
+end
+puts b[9]
+s = 0.0
+a.each { |x| s = s + x }
+puts s
+c = a.map { |x| x * 2 }
+puts c[3]
+t = 0.0
+a.length.times do |i|
+  t = t + a[i] * c[i]
+end
+puts t
+puts a[20]
+puts a[-1]
+n = a.size - 3
+n.times do |i|
+  puts a[i + 2]
+end
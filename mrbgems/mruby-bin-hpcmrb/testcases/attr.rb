@@ -0,0 +1,39 @@
+class Point
+  attr_accessor :x, :y
+  attr_reader :norm2
+  attr_writer :label
+
+  def initialize(x, y)
+    @x = x
+    @y = y
+    @norm2 = x * x + y * y
+    @label = 0
+  end
+
+  def label_plus(n)
+    @label + n
+  end
+end
+
+class Size
+  attr_reader :x
+
+  def initialize(x)
+    @x = x
+  end
+end
+
+# the readers and writers of Point are loads and stores of the fields
+pt = Point.new(1.5, -2.0)
+pt.x = pt.x + pt.y
+pt.label = 3
+puts pt.x
+puts pt.norm2
+puts pt.label_plus(4)
+
+# a call on Point or Size goes through the multiplexer
+o = Point.new(1, 2)
+2.times do |i|
+  puts o.x
+  o = Size.new(10)
+end
@@ -0,0 +1,50 @@
+module Xorshift
+  @@x = 123456789
+  @@y = 362436069
+  @@z = 521288629
+  @@w = 88675123
+  @@scale = 0.5
+  MASK = (1 << 16) - 1
+
+  def self.next
+    x = @@x
+    t = x ^ ((x & 0xfffff) << 11)
+    w = @@w
+    @@x, @@y, @@z = @@y, @@z, w
+    @@w = (w ^ (w >> 19)) ^ (t ^ (t >> 8))
+    @@w & MASK
+  end
+
+  def self.scaled
+    @@scale = @@scale * 1.5
+    self.next * @@scale
+  end
+end
+
+class Counter
+  @@count = 0
+  @@name = "counter"
+
+  def bump
+    @@count = @@count + 1
+  end
+
+  def remember(v)
+    @@last = v
+  end
+
+  def report
+    @@name + " " + @@count.to_s + " " + @@last.to_s
+  end
+end
+
+5.times do |i|
+  puts Xorshift.next
+end
+puts Xorshift.scaled
+c = Counter.new
+3.times do |i|
+  c.bump
+end
+c.remember(7)
+puts c.report
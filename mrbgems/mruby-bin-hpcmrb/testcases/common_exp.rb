@@ -0,0 +1,49 @@
+class Vec
+  def initialize(x, y, z)
+    @x = x
+    @y = y
+    @z = z
+  end
+
+  def x; @x; end
+  def y; @y; end
+  def z; @z; end
+
+  # the readers of each vector are called once
+  def vcross(b)
+    Vec.new(@y * b.z - @z * b.y,
+            @z * b.x - @x * b.z,
+            @x * b.y - @y * b.x)
+  end
+
+  def norm2
+    x * x + y * y + z * z
+  end
+end
+
+v = Vec.new(1.0, 2.0, 3.0).vcross(Vec.new(4.0, 5.0, 6.0))
+puts v.x
+puts v.y
+puts v.z
+puts v.norm2
+
+def scale(a, n, s, t)
+  # s * t is computed before the loop
+  n.times do |i|
+    a[i] = a[i] * (s * t) + n
+  end
+  a
+end
+
+a = Array.new
+3.times do |i|
+  a[i] = i + 1.0
+end
+puts scale(a, 3, 2.0, 0.5)[2]
+
+def poly(x)
+  y = x
+  (y * y + 1) * (y * y + 1)
+end
+puts poly(3)
+puts poly(1.5)
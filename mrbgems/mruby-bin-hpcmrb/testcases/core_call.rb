@@ -0,0 +1,30 @@
+# core methods without code in hpcmrb are called through mrb_funcall
+
+def square(x)
+  x ** 2
+end
+
+def class_of(a)
+  a.class
+end
+
+def size_of(s)
+  s.length
+end
+
+def shout(s)
+  s.upcase
+end
+
+def between(x, lo, hi)
+  x.between?(lo, hi)
+end
+
+puts square(7)
+puts square(1.5)
+puts class_of(1)
+puts class_of(2.5)
+puts size_of("hello")
+puts shout("hpc")
+puts between(3, 1, 5)
+puts between(9, 1, 5)
@@ -0,0 +1,45 @@
+class Square
+  def initialize(a)
+    @a = a
+  end
+
+  def area
+    @a * @a
+  end
+
+  def scale(k)
+    Square.new(@a * k)
+  end
+end
+
+class Circle
+  def initialize(r)
+    @r = r
+  end
+
+  def area
+    3.0 * @r * @r
+  end
+
+  def scale(k)
+    Circle.new(@r * k)
+  end
+end
+
+module Shapes
+  def self.area
+    0.0
+  end
+end
+
+# the elements are Square or Circle
+shapes = Array.new
+shapes[0] = Square.new(2.0)
+shapes[1] = Circle.new(1.0)
+shapes[2] = Square.new(3.0)
+total = 0.0
+3.times do |i|
+  total = total + shapes[i].area + shapes[i].scale(2.0).area
+end
+puts total
+puts Shapes.area
@@ -0,0 +1,37 @@
+n = 100
+x = Array.new(n)
+y = Array.new(n)
+n.times do |i|
+  x[i] = i * 0.25
+  y[i] = 1.0 - i * 0.5
+end
+a = 2.5
+n.times do |i|
+  y[i] = a * x[i] + y[i]
+end
+puts y[0]
+puts y[99]
+
+s = 0.0
+0.upto(n - 1) do |i|
+  s = s + x[i] * y[i]
+end
+puts s
+
+# not all Floats: the loop is not specialized at run time
+x[50] = 1
+n.times do |i|
+  y[i] = x[i] * 2
+end
+puts y[49]
+puts y[50]
+
+# stores a Fixnum: the loop is never specialized
+z = Array.new(n)
+n.times do |i|
+  z[i] = i
+end
+n.times do |i|
+  y[i] = y[i] + z[i]
+end
+puts y[99]
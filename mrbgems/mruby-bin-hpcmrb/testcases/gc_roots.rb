@@ -0,0 +1,53 @@
+# objects left only in locals, fields and globals survive the GC in loops
+class Node
+  def initialize(v, nxt)
+    @v = v
+    @nxt = nxt
+  end
+
+  def v
+    @v
+  end
+
+  def nxt
+    @nxt
+  end
+
+  def total(k)
+    if k == 0
+      @v
+    else
+      @v + @nxt.total(k - 1)
+    end
+  end
+end
+
+class Chain
+  def initialize
+    @head = Node.new("", 0)
+  end
+
+  def build(n)
+    n.times do |i|
+      @head = Node.new(i.to_s + "!", @head)
+    end
+  end
+
+  def total(n)
+    @head.total(n)
+  end
+end
+
+def names(n)
+  $names = Node.new("root", 0)
+  n.times do |i|
+    $names = Node.new("n" + i.to_s, $names)
+  end
+end
+
+names(3000)
+c = Chain.new
+c.build(5000)
+puts c.total(50)
+puts $names.v
+puts $names.nxt.nxt.v
@@ -0,0 +1,51 @@
+# if and the ternary operator used as values
+
+def maxi(a, b)
+  x = a > b ? a : b
+  x * 2
+end
+
+def opt(a, c)
+  x = (a if c)
+  x
+end
+
+def pick(a)
+  y = if a > 2
+        a * 3
+      else
+        a + 0.5
+      end
+  y
+end
+
+def sel(a)
+  z = a > 0 ? (a > 5 ? "big" : "small") : "neg"
+  z
+end
+
+def multi(a)
+  x = if a > 0
+        b = a * 2
+        b + 1
+      else
+        0
+      end
+  x
+end
+
+puts maxi(3, 4)
+puts maxi(7, 1)
+p opt(3, true)
+p opt(3, false)
+puts pick(3)
+puts pick(1)
+puts sel(7)
+puts sel(2)
+puts sel(-1)
+x = 3
+y = x > 2 ? 1 : 2
+puts y
+puts(x > 5 ? "a" : "b")
+puts multi(4)
+puts multi(-4)
@@ -0,0 +1,62 @@
+def sum_upto(n)
+  s = 0
+  1.upto(n) do |i|
+    s = s + i
+  end
+  s
+end
+
+puts sum_upto(10)
+t = 0
+3.times { t = t + 1 }
+puts t
+x = 5.times { |i| t = t + i }
+puts x
+1.step(10, 3) { |i| puts i }
+1.step(2.0, 0.25) { |f| puts f }
+a = Array.new
+a[0] = 3
+a[1] = 4
+a[2] = 5
+s = 0
+a.each { |e| s = s + e }
+puts s
+a.each_with_index { |e, i| puts e * i }
+b = a.map { |e| e * 2 }
+puts b[2]
+puts a.map { |e| e + 1 }[0]
+def twice
+  yield 1
+  yield 2
+end
+
+def each_pair(n)
+  i = 0
+  n.times do |k|
+    i = i + k
+    yield k, i
+  end
+  i
+end
+
+class Grid
+  def self.each_cell(w, h)
+    h.times do |y|
+      w.times do |x|
+        yield x, y
+      end
+    end
+  end
+end
+
+i = 100
+twice { |x| puts x + i }
+total = 0
+r = each_pair(4) { |k, s| total = total + k * s }
+puts total
+puts r
+cells = 0
+Grid.each_cell(3, 2) { |x, y| cells = cells + x + y * 10 }
+puts cells
+v = twice { |x| x * 3 }
+puts v
@@ -0,0 +1,22 @@
+# Math functions of numbers are libm calls, folded on constants
+def norm(x, y)
+  Math.sqrt(x * x + y * y)
+end
+
+def polar(r, t)
+  r * Math.cos(t) + r * Math.sin(t)
+end
+
+puts norm(3.0, 4.0)
+puts norm(1, 2)
+puts polar(2.0, 0.5)
+puts Math.atan2(1.0, 2.0)
+puts Math.hypot(3, 4)
+puts Math.exp(1.0) + Math.log(10.0)
+puts Math.log2(8) + Math.log10(1000)
+puts Math.sqrt(-1.0)
+s = 0.0
+10.times do |i|
+  s = s + Math.sqrt(i)
+end
+puts s
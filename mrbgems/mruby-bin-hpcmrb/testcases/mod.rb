@@ -0,0 +1,39 @@
+# Fixnum#% takes the sign of the divisor, and modulo by 0 is NaN
+
+def m(a, b)
+  a % b
+end
+
+def cyc(n, k)
+  s = 0
+  n.times do |i|
+    s = s + i % k
+  end
+  s
+end
+
+def by3(n)
+  s = 0
+  n.times do |i|
+    s = s + i % 3
+  end
+  s
+end
+
+def safe_m(a, b)
+  begin
+    m(a, b)
+  rescue NoMethodError
+    "no % for #{a.class}"
+  end
+end
+
+puts m(7, 3)
+puts m(-7, 3)
+puts m(7, -3)
+puts m(7, 0)
+puts m(7.5, 2)
+puts cyc(10, 4)
+puts cyc(3, 0)
+puts by3(10)
+puts safe_m([1, 2], 3)
@@ -0,0 +1,40 @@
+# user methods named like the bulk operations of FloatArray
+
+class Vec
+  def initialize(x, y)
+    @x = x
+    @y = y
+  end
+
+  def x
+    @x
+  end
+
+  def y
+    @y
+  end
+
+  def dot(o)
+    @x * o.x + @y * o.y
+  end
+
+  def sum
+    @x + @y
+  end
+
+  def axpy(a, o)
+    Vec.new(a * o.x + @x, a * o.y + @y)
+  end
+end
+
+v = Vec.new(1.5, 2.0)
+w = Vec.new(3.0, 4.0)
+puts v.dot(w)
+puts v.sum
+puts v.axpy(2.0, w).sum
+
+a = FloatArray.new(4, 1.5)
+b = FloatArray.new(4, 2.0)
+puts a.dot(b)
+a.axpy(2.0, b)
+puts a.sum
@@ -0,0 +1,29 @@
+n = 10
+x = FloatArray.new(n)
+y = FloatArray.new(n, 1.0)
+v = IntArray.new(n)
+n.times do |i|
+  x[i] = i * 0.5
+  v[i] = i * i
+end
+y[0] = 3
+puts x[3]
+puts x[-1]
+puts v[4]
+puts y.length
+
+n.times do |i|
+  y[i] = 2.0 * x[i] + y[i]
+end
+puts y.sum
+puts x.dot(y)
+y.axpy(0.5, x)
+puts y[9]
+
+s = 0
+v.each { |k| s = s + k }
+puts s
+x.map! { |e| e * e }
+puts x[9]
+v.each_with_index { |k, i| v[i] = k + i }
+puts v.sum
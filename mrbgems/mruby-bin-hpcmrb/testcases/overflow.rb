@@ -0,0 +1,29 @@
+# Fixnum + - * overflow into Float as on the VM
+def mix(a, b)
+  a * b + a - b
+end
+
+# i * i and i + 1 of the counter cannot overflow, s can
+def sum_squares(n)
+  s = 0
+  n.times do |i|
+    s = s + i * i + (i + 1)
+  end
+  s
+end
+
+def countdown(n)
+  s = 0
+  10.times do |i|
+    s = s + (n - i) * 3
+  end
+  s
+end
+
+puts mix(3, 4)
+puts mix(1073741824, 4)
+puts mix(-1073741824, 4)
+puts sum_squares(100)
+puts sum_squares(3000)
+puts countdown(715827882)
+puts countdown(-715827882)
@@ -0,0 +1,19 @@
+n = 1000
+a = Array.new(n)
+b = Array.new(n)
+n.times do |i|
+  x = i * 0.5
+  if i % 2 == 0
+    x = x + 1.0
+  end
+  a[i] = x * x
+end
+n.times do |i|
+  b[i] = i * 3
+end
+c = Array.new(3)
+5.times { |i| c[i] = i }
+puts a[0]
+puts a[999]
+puts b[10]
+puts c[4]
@@ -0,0 +1,57 @@
+class Vec
+  def initialize(x, y, z)
+    @x = x
+    @y = y
+    @z = z
+  end
+
+  def x; @x; end
+  def y; @y; end
+  def z; @z; end
+  def x=(v); @x = v; end
+  def y=(v); @y = v; end
+  def z=(v); @z = v; end
+end
+
+class Counter
+  def initialize
+    @n = 0
+  end
+
+  def n; @n; end
+  def n=(v); @n = v; end
+end
+
+def sum(k)
+  # rad never leaves sum, so it is kept in locals
+  rad = Vec.new(0.0, 0.0, 0.0)
+  k.times do |i|
+    rad.x = rad.x + i.to_f
+    rad.y = rad.y + 0.5
+    rad.z = rad.z - rad.x
+  end
+  rad.x + rad.y + rad.z
+end
+
+def escape
+  # v is returned
+  v = Vec.new(1.0, 2.0, 3.0)
+  v.x = 4.0
+  v
+end
+
+def swap
+  # the args read v before the fields are assigned
+  v = Vec.new(1.0, 2.0, 3.0)
+  v = Vec.new(v.y, v.x, v.z)
+  v.x
+end
+
+c = Counter.new
+10.times do |i|
+  c.n = c.n + i
+end
+puts c.n
+puts sum(10)
+puts escape.x
+puts swap
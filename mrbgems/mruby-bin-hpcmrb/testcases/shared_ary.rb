@@ -0,0 +1,34 @@
+# arrays sharing the elements of another are copied before written in place
+
+def scale(a, n)
+  n.times do |i|
+    a[i] = a[i] * 2.0
+  end
+  a
+end
+
+def fill(a, n, x)
+  n.times do |i|
+    a[i] = x
+  end
+  a
+end
+
+base = Array.new(6)
+6.times { |i| base[i] = i * 1.5 }
+part = base[1, 4]
+scale(part, 4)
+puts part[0]
+puts part[3]
+puts base[1]
+puts base[4]
+rest = base[2, 3]
+fill(rest, 3, 7)
+puts rest[2]
+puts base[4]
+fill(rest, 0, 9)
+puts rest[0]
+whole = base[0, 6]
+6.times { |i| whole[i] = i * 0.25 }
+puts whole[5]
+puts base[5]
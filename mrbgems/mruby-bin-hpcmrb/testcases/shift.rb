@@ -0,0 +1,30 @@
+# shifts behave as Fixnum#<< and #>> of the VM, beyond the width too
+
+def shl(x, n)
+  x << n
+end
+
+def shr(x, n)
+  x >> n
+end
+
+def checked_shl(x, n)
+  begin
+    shl(x, n)
+  rescue RangeError
+    puts "RangeError"
+    0
+  end
+end
+
+puts 1 << 3
+puts 1 << 30
+puts shl(4, 2)
+puts shl(5, -1)
+puts shl(-5, -40)
+puts shr(-20, 2)
+puts shr(-20, 40)
+puts shr(20, 40)
+puts shr(3, -2)
+puts checked_shl(1, 62)
+puts checked_shl(3, 4)
@@ -0,0 +1,52 @@
+def scale(v, k)
+  v * k
+end
+
+def hypot2(x, y)
+  x * x + y * y
+end
+
+def fact(n)
+  if n < 2
+    1
+  else
+    n * fact(n - 1)
+  end
+end
+
+class Vec
+  def initialize(x, y)
+    @x = x
+    @y = y
+  end
+
+  def x
+    @x
+  end
+
+  def y
+    @y
+  end
+
+  def vadd(b)
+    Vec.new(@x + b.x, @y + b.y)
+  end
+
+  def vscale(k)
+    Vec.new(@x * k, @y * k)
+  end
+
+  def self.zero
+    Vec.new(0.0, 0.0)
+  end
+end
+
+puts scale(1.5, 2.0)
+puts scale(3, 4)
+puts hypot2(3.0, 4.0)
+puts fact(10)
+v = Vec.zero.vadd(Vec.new(1.0, 2.0)).vscale(3.0)
+puts v.x
+puts v.y
+w = v.vscale(2)
+puts w.x
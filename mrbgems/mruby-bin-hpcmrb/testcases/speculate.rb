@@ -0,0 +1,46 @@
+# Args read from Arrays are not typed.  Compiled with the profile
+# (make compile_with_profile), the multiplexer calls clones taking Float
+# after checking the args are Float.
+class Body
+  def initialize(m)
+    @m = m
+  end
+
+  def energy(v)
+    0.5 * @m * v * v
+  end
+end
+
+class Spring
+  def initialize(k)
+    @k = k
+  end
+
+  def energy(x)
+    0.5 * @k * x * x
+  end
+end
+
+def scale(x, n)
+  x * n
+end
+
+objs = Array.new
+objs[0] = Body.new(2.0)
+objs[1] = Spring.new(3.0)
+objs[2] = Body.new(0.5)
+vals = Array.new
+vals[0] = 1.5
+vals[1] = 0.25
+vals[2] = 4.0
+total = 0.0
+3.times do |i|
+  total = total + objs[i].energy(vals[i])
+end
+puts total
+
+counts = Array.new
+counts[0] = 3
+counts[1] = 4
+puts scale(vals[0], counts[1])
+puts scale(vals[2], counts[0])
@@ -0,0 +1,39 @@
+W = 4
+N = 1 << 4
+NF = N.to_f
+HALF = W / 2 + 0.5
+LIMIT = 100
+
+module Scene
+  SIZE = W * 2
+  STEP = 1.0 / SIZE
+
+  def self.span
+    SIZE * STEP + HALF
+  end
+end
+
+class Grid
+  CELLS = W * N
+
+  def cells
+    CELLS - LIMIT
+  end
+end
+
+W.times do |i|
+  puts i * N + W
+end
+
+(N - W * 3).times do |i|
+  puts i * HALF - NF
+end
+puts Scene.span
+puts NF * HALF
+puts Grid.new.cells
+puts W.to_s + " " + N.to_s
+
+LIMIT.times do |i|
+  LIMIT = i if i == 3
+end
+puts LIMIT
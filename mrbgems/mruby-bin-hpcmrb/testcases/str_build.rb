@@ -0,0 +1,45 @@
+# + << to_s and chr of Strings are built in one buffer, print and puts
+# of them write the pieces
+
+W = 256
+H = 128
+
+def label(i)
+  "item" + i.to_s + ":" + (i << 1).to_s
+end
+
+def tag(name, n)
+  s = "<" + name
+  s << " n=" << n.to_s << ">"
+  s
+end
+
+def bump(s)
+  s << "!"
+  1
+end
+
+def letters(n)
+  n.times do |i|
+    print((i ^ 96).chr)
+    puts label(i)
+  end
+end
+
+def order
+  t = "x"
+  u = t + bump(t).to_s
+  puts u
+  puts t
+end
+
+print W.to_s + " " + H.to_s + "\n"
+puts "P6"
+puts "done\n"
+puts W
+print 65.chr
+letters(4)
+puts tag("a", 3)
+order
+puts (-12).to_s + "/" + 0.to_s
+puts "a" + "b" + "c"
@@ -0,0 +1,82 @@
+# classes with a superclass are run by the VM
+
+class Shape
+  def initialize(w)
+    @w = w
+  end
+
+  def area
+    @w * @w
+  end
+
+  def describe
+    "#{kind} #{area}"
+  end
+end
+
+class Rect < Shape
+  def initialize(w, h)
+    super(w)
+    @h = h
+  end
+
+  def area
+    @w * @h
+  end
+
+  def kind
+    "rect"
+  end
+end
+
+class Square < Shape
+  def kind
+    "square"
+  end
+end
+
+class Counter
+  def initialize
+    @n = 0
+  end
+
+  def add(x)
+    @n = @n + x
+  end
+
+  def n
+    @n
+  end
+end
+
+class TooBig < StandardError
+end
+
+def total(n)
+  c = Counter.new
+  n.times do |i|
+    c.add(Rect.new(i, 2).area)
+  end
+  c.n
+end
+
+def check(x)
+  raise TooBig, "too big" if x > 10
+  x
+end
+
+def safe_check(x)
+  begin
+    check(x)
+  rescue TooBig => e
+    puts "rescued #{e.message}"
+    0
+  end
+end
+
+puts total(5)
+puts Square.new(3).describe
+puts Rect.new(2, 5).describe
+puts Rect.new(1, 1).is_a?(Shape)
+puts safe_check(3)
+puts safe_check(11)
@@ -0,0 +1,60 @@
+class Point
+  def initialize(x, y)
+    @x = x
+    @y = y
+  end
+
+  def x; @x; end
+  def y; @y; end
+  def x=(v); @x = v; end
+
+  def add(o)
+    Point.new(@x + o.x, @y + o.y)
+  end
+
+  def norm2
+    @x * @x + @y * @y
+  end
+end
+
+class Counter
+  def initialize
+    @n = 0
+  end
+
+  def step(k)
+    @n = @n + k
+  end
+
+  def label
+    @label
+  end
+
+  def set_label(s)
+    @label = s
+  end
+
+  def n; @n; end
+end
+
+p = Point.new(1.5, 2.0)
+q = p.add(Point.new(0.5, -1.0))
+puts q.x
+puts q.y
+puts q.norm2
+
+# called through a multiplexer
+pts = Array.new
+pts[0] = Point.new(3.0, 4.0)
+pts[0].x = 0.25
+puts pts[0].x
+puts pts[0].norm2
+
+c = Counter.new
+puts c.label
+5.times do |i|
+  c.step(i)
+end
+puts c.n
+c.set_label("done")
+puts c.label
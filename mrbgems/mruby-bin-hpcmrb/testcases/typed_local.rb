@@ -0,0 +1,28 @@
+def average(n)
+  sum = 0.0
+  n.times do |i|
+    sum = sum + i.to_f * 0.5
+  end
+  sum / n
+end
+
+x = 1.5
+y = x * 2.0 - 0.25
+z = -x
+puts y
+puts z
+if y > x
+  puts "greater"
+end
+puts average(10)
+
+k = 7
+puts k % 3
+puts(-7 % 3)
+puts 7.5 % -2
+puts 1 << 4
+4.times do |i|
+  m = i % 3
+  puts m
+  puts(i.to_f % -1.5)
+end
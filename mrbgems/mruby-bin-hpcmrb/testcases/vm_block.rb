@@ -0,0 +1,48 @@
+# compiled methods which yield, called with a block by the VM
+
+def twice
+  yield 1
+  yield 2
+end
+
+class Pair
+  def initialize(a, b)
+    @a = a
+    @b = b
+  end
+
+  def each_half
+    yield @a / 2
+    yield @b / 2
+  end
+
+  def self.repeat(n)
+    n.times { |i| yield i }
+  end
+end
+
+def calc
+  s = 0
+  twice { |y| s += y }
+  s
+end
+
+# rescue leaves the method to the VM
+def scaled(k)
+  t = 0
+  twice { |y| t += y * k }
+  Pair.repeat(3) { |i| t += i }
+  t
+rescue
+  -1
+end
+
+v = 0
+twice { |y| v += y }
+puts v
+puts calc
+puts scaled(10)
+pr = Pair.new(8, 20)
+h = 0
+pr.each_half { |x| h += x }
+puts h
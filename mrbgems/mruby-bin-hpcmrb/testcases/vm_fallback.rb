@@ -0,0 +1,62 @@
+# methods hpcmrb does not compile are run on the VM
+
+def square(x)
+  x * x
+end
+
+def collatz(n)
+  steps = 0
+  while n != 1
+    case n % 2
+    when 0
+      n = n / 2
+    else
+      n = 3 * n + 1
+    end
+    steps += 1
+  end
+  steps
+end
+
+def sum_squares(n, from = 1)
+  s = 0
+  from.upto(n) { |i| s += square(i) }
+  s
+end
+
+class Counter
+  def initialize(start)
+    @count = start
+  end
+
+  def count
+    @count
+  end
+
+  def add(n)
+    @count = @count + n
+  end
+
+  def add_all(*ns)
+    ns.each { |n| add(n) }
+    count
+  end
+
+  def self.label(n)
+    case n
+    when 1 then "one"
+    when 2 then "two"
+    else "many"
+    end
+  end
+end
+
+puts collatz(27)
+puts sum_squares(10)
+puts sum_squares(10, 5)
+c = Counter.new(3)
+puts c.add_all(1, 2, 3)
+puts c.count
+puts Counter.label(2)
+puts Counter.label(c.count)
+puts square(7)
@@ -0,0 +1,40 @@
+# the top level statements hpcmrb cannot type are run by the VM
+
+LIMIT = 10
+
+class Point
+  attr_reader :x, :y
+
+  def initialize(x, y)
+    @x = x
+    @y = y
+  end
+
+  def dist2
+    x * x + y * y
+  end
+end
+
+def tri(n)
+  s = 0
+  i = 1
+  while i <= n
+    s += i
+    i += 1
+  end
+  s
+end
+
+v = 3
+puts tri(v)
+v = "changed"
+puts v
+begin
+  raise "oops"
+rescue => e
+  puts e.message
+end
+p = Point.new(3, 4)
+puts p.dist2
+puts tri(LIMIT)
+[1, 2, 3].each { |i| puts tri(i) }
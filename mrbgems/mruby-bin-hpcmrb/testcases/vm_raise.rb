@@ -0,0 +1,47 @@
+# exceptions raised on the VM pass through compiled methods
+
+def check(x)
+  begin
+    raise ArgumentError, "negative" if x < 0
+  rescue TypeError
+    return 0
+  end
+  x
+end
+
+def twice(x)
+  check(x) * 2
+end
+
+def total(n)
+  s = 0
+  n.times do |i|
+    s += twice(i - 2)
+  end
+  s
+end
+
+def guarded(x)
+  begin
+    twice(x)
+  rescue ArgumentError => e
+    puts e.message
+    -1
+  end
+end
+
+def safe_total(n)
+  begin
+    total(n)
+  rescue ArgumentError
+    puts "rescued"
+    0
+  end
+end
+
+puts twice(3)
+puts guarded(4)
+puts guarded(-4)
+puts guarded(twice(1) - 5)
+puts safe_total(5)
+puts twice(5)
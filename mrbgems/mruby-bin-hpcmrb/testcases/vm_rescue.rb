@@ -0,0 +1,32 @@
+# a method left to the VM calls a compiled one
+def half(x)
+  x / 2
+end
+
+def half_or_zero(x)
+  begin
+    half(x)
+  rescue
+    0
+  end
+end
+
+puts half_or_zero(9)
+
+# the VM rescues what a compiled method raises
+def strict(x)
+  raise ArgumentError, "too large" if x > 5
+  x
+end
+
+def strict_or_zero(x)
+  begin
+    strict(x)
+  rescue ArgumentError => e
+    puts e.message
+    0
+  end
+end
+
+puts strict_or_zero(3)
+puts strict_or_zero(7)
@@ -0,0 +1,69 @@
+class Cell
+  attr_accessor :v, :name
+
+  def initialize(v)
+    @v = v
+    @name = "cell"
+  end
+end
+
+class Tally
+  attr_accessor :n
+
+  def initialize
+    @n = 0.0
+  end
+end
+
+class Acc
+  attr_accessor :f
+
+  def initialize
+    @f = 0.0
+  end
+end
+
+def each_step(n)
+  n.times do |i|
+    yield i
+  end
+end
+
+# the value of a writer is the value assigned
+def set(c, n)
+  c.v = n
+end
+
+def relabel(c, s)
+  t = c.name = s
+  t + "!"
+end
+
+def bump(t)
+  t.n = t.n + 0.5
+end
+
+def add(a, x)
+  a.f = a.f + x
+end
+
+def fill(c, n)
+  each_step(n) { |q| c.v = q * 1.5 }
+end
+
+c = Cell.new(1.0)
+puts set(c, 2.5)
+puts set(c, 4.0) + 1
+puts c.v
+puts relabel(c, "a")
+puts c.name
+fill(c, 4)
+puts c.v
+t = Tally.new
+bump(t)
+puts bump(t) * 10
+puts t.n
+a = Acc.new
+add(a, 0.5)
+puts add(a, 1.25) * 2
+puts a.f
@@ -1,4 +1,9 @@
 #include "hpcmrb.h"
+#include "mruby/class.h"
+#include "mruby/variable.h"
+#include "mruby/dump.h"
+#include "node.h"
+#include <math.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -6,6 +11,8 @@
 #define CADDR(x) ((x)->cdr->cdr->car)
 #define CADDDR(x) ((x)->cdr->cdr->cdr->car)
 #define CADDDDR(x) ((x)->cdr->cdr->cdr->cdr->car)
+#define CAADR(x) ((x)->cdr->car->car)
+#define CDADR(x) ((x)->cdr->car->cdr)
 
 #define TYPE(x) ((intptr_t)((x)->car))
 #define DECLP(t) (t == HIR_GVARDECL || t == HIR_LVARDECL || \
@@ -25,16 +32,40 @@
 #define INDENT_PP (c->indent ++)
 #define INDENT_MM (c->indent --)
 
+#define CODEGEN_VARS_MAX 1024
+#define CODEGEN_FRAMES_MAX 256
+
+/* C type of a local variable in the current function */
+typedef struct {
+  mrb_sym sym;
+  enum hir_type_kind kind;
+} hpc_var_kind;
+
 typedef struct {
   mrb_state *mrb;
   FILE *wfp;
   int indent;
   hpc_class *current_class;
+  int nvars;                    /* innermost is the last */
+  hpc_var_kind vars[CODEGEN_VARS_MAX];
+  enum hir_type_kind ret_kind;  /* C type of the return value */
+  HIR *function_map;            /* list ((method_name . argc) . (class_name . sdefp)...) */
+  hpc_state *hpc;
+  int parallel;                 /* in a loop run by threads */
+  int nframes;                  /* shadow frames pushed in the function */
+  int frames[CODEGEN_FRAMES_MAX]; /* their ids, innermost is the last */
+  int loop_nframes;             /* frames pushed out of the innermost loop */
+  int frame_id;                 /* the last id in the file */
+  HIR *param_roots;             /* params rooted by the body of the function */
+  HIR *body;                    /* of the function */
+  HIR *globals;                 /* declarations at the top of the file */
 } hpc_codegen_context;
 
 static void put_decl(hpc_codegen_context *c, HIR *decl);
 static void put_exp(hpc_codegen_context *c, HIR *exp, int val);
+static void put_exp_as(hpc_codegen_context *c, HIR *exp, enum hir_type_kind kind, int val);
 static void put_statement(hpc_codegen_context *c, HIR *stat, int no_brace);
+static int boxed_field_p(hpc_codegen_context *c, HIR *lhs);
 int length(HIR *list);
 
 static int
@@ -57,6 +88,31 @@ built_in_class_p(hpc_codegen_context *c, mrb_sym sym)
           || strcmp(name, "Kernel") == 0);
 }
 
+/*
+  Constants defined by the VM or gems (Math, FloatArray, ...) which are
+  not given a value in the compiled program.  They are loaded at startup.
+ */
+static int
+vm_constant_p(hpc_codegen_context *c, HIR *decl)
+{
+  mrb_sym name;
+  const char *s;
+  HIR *classes;
+
+  if (TYPE(decl) != HIR_GVARDECL)
+    return FALSE;
+  name = sym(CADDR(decl));
+  for (classes = c->hpc->classes; classes; classes = classes->cdr) {
+    if (((hpc_class *)classes->car)->name == name)
+      return FALSE;             /* defined by the compiled program */
+  }
+  s = mrb_sym2name(c->mrb, name);
+  return s[0] >= 'A' && s[0] <= 'Z'
+    && TYPE(CADDDR(decl)) == HIR_EMPTY
+    && !built_in_class_p(c, name)
+    && mrb_const_defined(c->mrb, mrb_obj_value(c->mrb->object_class), name);
+}
+
 static void
 put_header(hpc_codegen_context *c)
 {
@@ -67,6 +123,8 @@ put_header(hpc_codegen_context *c)
   PUTS("#include \"mruby/variable.h\"\n");
   PUTS("#include \"mruby/class.h\"\n");
   PUTS("#include \"mruby/data.h\"\n");
+  if (c->hpc->vm_irep >= 0)
+    PUTS("#include \"mruby/dump.h\"\n#include \"mruby/proc.h\"\n");
   PUTS("#include \"builtin.h\"\n\n");
 
   PUTS("extern mrb_state * mrb;\n\n");
@@ -77,9 +135,27 @@ put_header(hpc_codegen_context *c)
   PUTS("\tmrb_free(mrb, p);\n");
   PUTS("}\n");
 
+  /* defined with the structs of the classes */
+  PUTS("static void hpc_mark(mrb_state *mrb, void *p);\n");
   PUTS("static const struct mrb_data_type hpc_data_type = {\n");
-  PUTS("\t\"hpcmrb_class\", hpc_free\n");
+  PUTS("\t\"hpcmrb_class\", hpc_free, hpc_mark\n");
   PUTS("};\n\n");
+
+  /* type code of instances allocated by the compiled code, 0 for others */
+  PUTS("static int\n");
+  PUTS("hpc_type_of(mrb_value v)\n");
+  PUTS("{\n");
+  PUTS("\tif (mrb_type(v) != MRB_TT_DATA || DATA_TYPE(v) != &hpc_data_type)\n");
+  PUTS("\t\treturn 0;\n");
+  PUTS("\treturn *(int *)DATA_PTR(v);\n");
+  PUTS("}\n\n");
+
+  /* the receiver of a class method, without calling mrb_eql */
+  PUTS("static inline int\n");
+  PUTS("hpc_class_eq(mrb_value v, mrb_value klass)\n");
+  PUTS("{\n");
+  PUTS("\treturn mrb_type(v) == mrb_type(klass) && mrb_obj_ptr(v) == mrb_obj_ptr(klass);\n");
+  PUTS("}\n\n");
 }
 
 static void
@@ -150,7 +226,7 @@ put_type(hpc_codegen_context *c, HIR *kind)
       PUTS("char");
       return;
     case HTYPE_INT:
-      PUTS("int");
+      PUTS("mrb_int");
       return;
     case HTYPE_FLOAT:
 #ifdef MRB_USE_FLOAT
@@ -374,6 +450,19 @@ put_ivar(hpc_codegen_context *c, HIR *name)
   PUTS("data->"); put_ivar_name(c, name);
 }
 
+static void put_exp(hpc_codegen_context *c, HIR *exp, int val);
+
+/* ((cClass *)DATA_PTR(recv))->ivar */
+static void
+put_field(hpc_codegen_context *c, HIR *exp)
+{
+  hpc_class *class = (hpc_class *)CAADR(exp);
+
+  PUTS("(("); put_class_type(c, class->name); PUTS(" *)DATA_PTR(");
+  put_exp(c, CADDR(exp), TRUE);
+  PUTS("))->"); put_ivar_name(c, CDADR(exp));
+}
+
 static void
 put_cvar_name(hpc_codegen_context *c, HIR *hir)
 {
@@ -390,15 +479,51 @@ put_cvar(hpc_codegen_context *c, HIR *name)
   put_cvar_name(c, name);
 }
 
+/* 0 if decl is not a specialized method */
+static int
+fundecl_clone_id(HIR *decl)
+{
+  HIR *rest = decl->cdr->cdr->cdr->cdr->cdr->cdr;
+  return rest ? (intptr_t)rest->car : 0;
+}
+
+static void
+put_fundecl_name(hpc_codegen_context *c, hpc_class *class, HIR *decl)
+{
+  put_unique_function_name(c, class ? hirsym(class->name) : 0, CADDDR(decl));
+  if (fundecl_clone_id(decl)) {
+    PUTS("__c"); put_int(c, fundecl_clone_id(decl));
+  }
+}
+
+/* Class_new__cN allocates an instance for the clone of initialize */
+static void
+put_new_name(hpc_codegen_context *c, hpc_class *class, HIR *decl)
+{
+  put_unique_function_name(c, hirsym(class->name),
+                           hirsym(mrb_intern_cstr(c->mrb, "new")));
+  PUTS("__c"); put_int(c, fundecl_clone_id(decl));
+}
+
+static int
+initialize_clone_p(hpc_codegen_context *c, hpc_class *class, HIR *decl)
+{
+  return class->name && !decl->cdr->car && fundecl_clone_id(decl) &&
+    sym(CADDDR(decl)) == c->mrb->init_sym;
+}
+
 static void
 put_fundecl_decl(hpc_codegen_context *c, hpc_class *class, HIR *decl)
 {
   HIR *funtype = CADDR(decl);
   HIR *params = CADDDDR(decl);
   hpc_assert((intptr_t)funtype->car == HTYPE_FUNC);
+  /* methods are called in this file only, and small ones are inlined */
+  if (class)
+    PUTS("static ");
   put_type(c, CADR(funtype));
   PUTS("\n");
-  put_unique_function_name(c, class ? hirsym(class->name) : 0, CADDDR(decl));
+  put_fundecl_name(c, class, decl);
   PUTS("(");
   while (params) {
     hpc_assert((intptr_t)params->car->car == HIR_PVARDECL);
@@ -411,17 +536,206 @@ put_fundecl_decl(hpc_codegen_context *c, hpc_class *class, HIR *decl)
   PUTS(")");
 }
 
+static void
+push_var(hpc_codegen_context *c, mrb_sym sym, enum hir_type_kind kind)
+{
+  hpc_assert(c->nvars < CODEGEN_VARS_MAX);
+  c->vars[c->nvars].sym = sym;
+  c->vars[c->nvars].kind = kind;
+  c->nvars++;
+}
+
+static enum hir_type_kind
+var_kind(hpc_codegen_context *c, mrb_sym sym)
+{
+  int i;
+  for (i = c->nvars - 1; i >= 0; i--) {
+    if (c->vars[i].sym == sym)
+      return c->vars[i].kind;
+  }
+  return HTYPE_VALUE;
+}
+
+/*
+  GC roots
+
+  The GC cannot see mrb_value in C frames.  The arena keeps objects
+  allocated in an iteration of a loop, but an object left only in a
+  local, in a field of a compiled instance or in a global is freed by
+  the first GC after the arena is restored.
+
+  A scope declaring boxed locals which can refer objects pushes a
+  shadow frame of their addresses onto mrb->shadow_frames, and pops
+  it at every exit: the end of the scope, return, break and continue.
+  The frame of the body of a function also has the params assigned in
+  it; the others keep the values the caller holds.  Locals declared in
+  the middle of a block (temporaries of masgn and shared expressions)
+  hold a value only while it is also held by the arena.  The globals
+  are rooted by a frame of compiled_main which is never popped, and
+  the fields of instances are marked by hpc_mark.  The body of a
+  parallel loop allocates nothing, so has no frame.
+ */
+static int
+rooted_decl_p(hpc_codegen_context *c, HIR *decl)
+{
+  switch (TYPE(decl)) {
+  case HIR_PVARDECL:
+    if (!hpc_assigned_p(c->body, sym(CADDR(decl))))
+      return FALSE;             /* held by the caller */
+    break;
+  case HIR_GVARDECL:
+    if (TYPE(CADDDR(decl)) != HIR_EMPTY || vm_constant_p(c, decl))
+      return FALSE;             /* static const */
+    break;
+  case HIR_LVARDECL:
+    break;
+  default:
+    return FALSE;
+  }
+  return TYPE(CADR(decl)) == HTYPE_VALUE
+    && !built_in_class_p(c, sym(CADDR(decl)))
+    && !hpc_lat_immediate_p(c->mrb, decl->lat);
+}
+
+static void
+put_frame_name(hpc_codegen_context *c, const char *prefix, int id)
+{
+  PUTS(prefix); put_int(c, id);
+}
+
+/*
+  Output:
+    mrb_value *__rootsN[] = { &a, &b };
+    HPC_FRAME_PUSH(__frameN, __rootsN);
+  if the decls have boxed locals.
+ */
+static int
+put_frame_push(hpc_codegen_context *c, HIR *params, HIR *decls)
+{
+  HIR *lists[2], *l;
+  int i, n = 0;
+
+  if (c->parallel)
+    return FALSE;
+  lists[0] = params; lists[1] = decls;
+  for (i = 0; i < 2; i++) {
+    for (l = lists[i]; l; l = l->cdr) {
+      if (!rooted_decl_p(c, l->car))
+        continue;
+      if (n++ == 0) {
+        hpc_assert(c->nframes < CODEGEN_FRAMES_MAX);
+        c->frames[c->nframes] = ++c->frame_id;
+        PUTS_INDENT; PUTS("mrb_value *");
+        put_frame_name(c, "__roots", c->frame_id); PUTS("[] = { ");
+      }
+      else {
+        PUTS(", ");
+      }
+      PUTS("&"); put_var(c, CADDR(l->car));
+    }
+  }
+  if (n == 0)
+    return FALSE;
+  PUTS(" };\n");
+  PUTS_INDENT; PUTS("HPC_FRAME_PUSH(");
+  put_frame_name(c, "__frame", c->frame_id); PUTS(", ");
+  put_frame_name(c, "__roots", c->frame_id); PUTS(");\n");
+  c->nframes++;
+  return TRUE;
+}
+
+/* restore mrb->shadow_frames to the one out of the i-th frame */
+static void
+put_frame_pop(hpc_codegen_context *c, int i)
+{
+  PUTS_INDENT; PUTS("HPC_FRAME_POP(");
+  put_frame_name(c, "__frame", c->frames[i]); PUTS(");\n");
+}
+
+/* the frame of the globals and the boxed class variables */
+static void
+put_global_frame(hpc_codegen_context *c)
+{
+  HIR *l, *cvs;
+  int n = 0;
+
+  PUTS_INDENT; PUTS("static mrb_value *__global_roots[] = { ");
+  for (l = c->globals; l; l = l->cdr) {
+    if (rooted_decl_p(c, l->car)) {
+      if (n++) PUTS(", ");
+      PUTS("&"); put_var(c, CADDR(l->car));
+    }
+  }
+  for (l = c->hpc->classes; l; l = l->cdr) {
+    hpc_class *class = (hpc_class *)l->car;
+
+    if (!class->name)
+      continue;
+    c->current_class = class;
+    for (cvs = class->cvs; cvs; cvs = cvs->cdr) {
+      if (hpc_lat_kind(c->mrb, cvs->car->lat) == HTYPE_VALUE
+          && !hpc_lat_immediate_p(c->mrb, cvs->car->lat)) {
+        if (n++) PUTS(", ");
+        PUTS("&"); put_cvar(c, cvs->car->cdr);
+      }
+    }
+    c->current_class = NULL;
+  }
+  if (n == 0) {
+    PUTS("NULL };\n");
+    return;
+  }
+  PUTS(" };\n");
+  PUTS_INDENT; PUTS("static mrb_shadow_frame __global_frame;\n");
+  PUTS_INDENT; PUTS("__global_frame.prev = mrb->shadow_frames;\n");
+  PUTS_INDENT; PUTS("__global_frame.len = sizeof(__global_roots) / sizeof(__global_roots[0]);\n");
+  PUTS_INDENT; PUTS("__global_frame.roots = __global_roots;\n");
+  PUTS_INDENT; PUTS("mrb->shadow_frames = &__global_frame;\n");
+}
+
+static int returned_p(HIR *stat);
+
 static void
 put_fundecl(hpc_codegen_context *c, hpc_class *class, HIR *decl)
 {
+  HIR *params = CADDDDR(decl);
+  HIR *body = decl->cdr->cdr->cdr->cdr->cdr->car;
+  int params_pushed = FALSE;
+  int mainp = !class && sym(CADDDR(decl)) == mrb_intern(c->mrb, "compiled_main");
+
   put_fundecl_decl(c, class, decl);
   PUTS("\n{\n");
   INDENT_PP;
+  c->nvars = 0;
+  c->nframes = c->loop_nframes = 0;
+  c->body = body;
+  c->ret_kind = TYPE(CADR(CADDR(decl)));
+  while (params) {
+    push_var(c, sym(CADDR(params->car)), TYPE(CADR(params->car)));
+    params = params->cdr;
+  }
   if (class && class->name && !decl->cdr->car) {
     PUTS_INDENT; put_class_type(c, class->name); PUTS(" *data;\n");
     PUTS_INDENT; PUTS("*(void**)&data = DATA_PTR(__self__);\n");
   }
-  put_statement(c, decl->cdr->cdr->cdr->cdr->cdr->car, TRUE);
+  if (hpc_calls_p(body, mrb_intern_cstr(c->mrb, "hpc_yield"))) {
+    /* held by the stack of the VM which passed it */
+    PUTS_INDENT; PUTS("mrb_value __block__ = hpc_take_block();\n");
+  }
+  if (mainp)
+    put_global_frame(c);
+  if (TYPE(body) == HIR_SCOPE)
+    c->param_roots = CADDDDR(decl);     /* in the frame of the body */
+  else
+    params_pushed = put_frame_push(c, CADDDDR(decl), NULL);
+  put_statement(c, body, TRUE);
+  if (mainp && c->hpc->vm_main_irep >= 0) {
+    /* the top level statements left to the VM */
+    PUTS_INDENT; PUTS("hpc_vm_main(mrb);\n");
+  }
+  if (params_pushed && !returned_p(body))
+    put_frame_pop(c, 0);
+  c->param_roots = NULL;
   INDENT_MM;
   PUTS("}\n\n");
 }
@@ -433,14 +747,21 @@ put_decl(hpc_codegen_context *c, HIR *decl)
   switch (TYPE(decl)) {
     case HIR_GVARDECL:
     case HIR_LVARDECL:
-      if (built_in_class_p(c, sym(decl->cdr->cdr->car)))
+      if (built_in_class_p(c, sym(decl->cdr->cdr->car)) || vm_constant_p(c, decl))
         return;
+      if (TYPE(decl) == HIR_GVARDECL && TYPE(CADDDR(decl)) != HIR_EMPTY)
+        PUTS("static const ");
       put_vardecl(c, decl->cdr);
       if (TYPE(CADDDR(decl)) != HIR_EMPTY) {
         PUTS(" = ");
-        put_exp(c, CADDDR(decl), TRUE);
+        put_exp_as(c, CADDDR(decl), TYPE(CADR(decl)), TRUE);
+      }
+      else if (TYPE(decl) == HIR_LVARDECL && !c->parallel && rooted_decl_p(c, decl)) {
+        PUTS(" = mrb_nil_value()");   /* marked before assigned */
       }
       PUTS(";\n");
+      if (TYPE(decl) == HIR_LVARDECL)
+        push_var(c, sym(CADDR(decl)), TYPE(CADR(decl)));
       return;
     case HIR_PVARDECL:
       put_vardecl(c, decl->cdr);
@@ -453,14 +774,789 @@ put_decl(hpc_codegen_context *c, HIR *decl)
   }
 }
 
+/*
+  Operators computed by C on unboxed numbers.
+  The lattice of the result tells its C type.
+ */
+enum native_op_kind {
+  NATIVE_NONE,
+  NATIVE_BINOP,   /* (a op b) */
+  NATIVE_FUNC,    /* func(a, b) defined in builtin.h */
+  NATIVE_CMP,     /* mrb_bool_value(a op b) */
+  NATIVE_CHECKED, /* hpc_int_op(a, b) of ints overflowing into Float */
+  NATIVE_UMINUS,  /* (-a) */
+  NATIVE_CONV,    /* a.to_f, a.to_i */
+  NATIVE_AREF,    /* func(a, i) an unboxed element defined in builtin.h */
+  NATIVE_ASET,    /* func(a, i, v) */
+  NATIVE_VREF,    /* func(a, i) a boxed element at a native index */
+  NATIVE_MATH,    /* func(a, ...) of libm for Math.func(a, ...) */
+};
+
+static enum native_op_kind
+native_op(hpc_codegen_context *c, HIR *exp, const char **op)
+{
+  mrb_state *mrb = c->mrb;
+  HIR *args;
+  enum hir_type_kind kind;
+  size_t len;
+  const char *name;
+
+  if (TYPE(exp) != HIR_CALL)
+    return NATIVE_NONE;
+  args = exp->cdr->cdr;
+  kind = hpc_lat_kind(mrb, exp->lat);
+  name = mrb_sym2name_len(mrb, sym(CADR(exp)), &len);
+  if (len > 9 && strncmp(name, "hpc_math_", 9) == 0) {
+    *op = name + 9;
+    return NATIVE_MATH;
+  }
+  if (len == 12 && (strncmp(name, "hpc_ary_uref", len) == 0 ||
+                    strncmp(name, "hpc_ary_vref", len) == 0)) {
+    *op = name;
+    return NATIVE_VREF;
+  }
+  if (len == 12 && strncmp(name, "hpc_", 4) == 0) {
+    static const char elems[][2][16] = {
+      {"hpc_ary_fref", "hpc_ary_fset"},   /* Arrays checked to have Floats */
+      {"hpc_fary_ref", "hpc_fary_set"},   /* FloatArray */
+      {"hpc_iary_ref", "hpc_iary_set"},   /* IntArray */
+    };
+    int i;
+
+    for (i = 0; i < sizeof(elems)/sizeof(elems[0]); i++) {
+      if (strncmp(name, elems[i][0], len) == 0) {
+        *op = elems[i][0];
+        return NATIVE_AREF;
+      }
+      if (strncmp(name, elems[i][1], len) == 0) {
+        *op = elems[i][1];
+        return NATIVE_ASET;
+      }
+    }
+  }
+  if (!hpc_lat_numeric_p(mrb, args->car->lat))
+    return NATIVE_NONE;
+
+  if (length(args) == 2) {
+    static const char table[][2][16] = {
+      {"+", "+"}, {"-", "-"}, {"*", "*"}, {"/", "/"},
+      {"^", "^"}, {"&", "&"}, {">>", "hpc_rshift"},
+      {"%", "hpc_mod"}, {"<<", "hpc_lshift"},
+      {"<", "<"}, {"<=", "<="}, {">", ">"}, {">=", ">="}, {"==", "=="},
+      {"", ""}
+    };
+    int i;
+
+    if (!hpc_lat_numeric_p(mrb, CADR(args)->lat))
+      return NATIVE_NONE;
+    for (i = 0; table[i][0][0]; i++) {
+      if (strlen(table[i][0]) == len && strncmp(table[i][0], name, len) == 0)
+        break;
+    }
+    if (!table[i][0][0])
+      return NATIVE_NONE;
+    *op = table[i][1];
+    if (name[0] == '=' || name[0] == '<' || name[0] == '>') {
+      if (len == 1 || name[1] == '=')
+        return NATIVE_CMP;
+    }
+    if (kind == HTYPE_VALUE) {
+      static const char checked[][2][16] = {
+        {"+", "hpc_int_add"}, {"-", "hpc_int_sub"}, {"*", "hpc_int_mul"},
+        {"%", "hpc_int_mod"},
+      };
+      if (len != 1 || hpc_lat_kind(mrb, args->car->lat) != HTYPE_INT ||
+          hpc_lat_kind(mrb, CADR(args)->lat) != HTYPE_INT)
+        return NATIVE_NONE;
+      for (i = 0; i < sizeof(checked)/sizeof(checked[0]); i++) {
+        if (name[0] == checked[i][0][0]) {
+          *op = checked[i][1];
+          return NATIVE_CHECKED;
+        }
+      }
+      return NATIVE_NONE;
+    }
+    /* integer operators need integer operands */
+    if (kind == HTYPE_INT &&
+        (hpc_lat_kind(mrb, args->car->lat) != HTYPE_INT ||
+         hpc_lat_kind(mrb, CADR(args)->lat) != HTYPE_INT))
+      return NATIVE_NONE;
+    if (kind == HTYPE_FLOAT && !(name[0] == '+' || name[0] == '-' ||
+                                 name[0] == '*' || name[0] == '/' || name[0] == '%'))
+      return NATIVE_NONE;
+    return (*op)[0] == 'h' ? NATIVE_FUNC : NATIVE_BINOP;
+  }
+  if (length(args) == 1 && kind != HTYPE_VALUE) {
+    if (len == 2 && strncmp(name, "-@", 2) == 0)
+      return NATIVE_UMINUS;
+    if (len == 4 && (strncmp(name, "to_f", 4) == 0 || strncmp(name, "to_i", 4) == 0))
+      return NATIVE_CONV;
+  }
+  return NATIVE_NONE;
+}
+
+/* the expression can be replaced with its value */
+static int
+pure_exp_p(hpc_codegen_context *c, HIR *exp)
+{
+  const char *op;
+  HIR *args;
+
+  switch (TYPE(exp)) {
+    case HIR_INT:
+    case HIR_FLOAT:
+    case HIR_LVAR:
+      return TRUE;
+    case HIR_GVAR:
+      return hpc_lat_const_p(c->mrb, exp->lat);   /* static const */
+    case HIR_CALL:
+      args = exp->cdr->cdr;
+      switch (native_op(c, exp, &op)) {
+        case NATIVE_NONE:
+        case NATIVE_ASET:
+          return FALSE;
+        case NATIVE_MATH:
+          args = args->cdr;     /* Math */
+          break;
+        default:
+          break;
+      }
+      for (; args; args = args->cdr) {
+        if (!pure_exp_p(c, args->car))
+          return FALSE;
+      }
+      return TRUE;
+    default:
+      return FALSE;
+  }
+}
+
+/* the expression is a known number */
+static int
+const_num_p(hpc_codegen_context *c, HIR *exp)
+{
+  mrb_value lat = exp->lat;
+
+  if (!hpc_lat_const_p(c->mrb, lat))
+    return FALSE;
+  switch (mrb_type(lat)) {
+    case MRB_TT_FIXNUM:
+      break;
+    case MRB_TT_FLOAT:
+      if (isnan(mrb_float(lat)) || isinf(mrb_float(lat)))
+        return FALSE;
+      break;
+    default:
+      return FALSE;
+  }
+  return (TYPE(exp) == HIR_LVAR || TYPE(exp) == HIR_GVAR || TYPE(exp) == HIR_CALL) &&
+    pure_exp_p(c, exp);
+}
+
+static void
+put_const_num(hpc_codegen_context *c, mrb_value v)
+{
+  char buf[64];
+
+  if (mrb_fixnum_p(v)) {
+    sprintf(buf, "%lld", (long long)mrb_fixnum(v));
+  }
+  else {
+    sprintf(buf, "%.17g", (double)mrb_float(v));
+    if (!strpbrk(buf, ".e"))
+      strcat(buf, ".0");
+  }
+  if (buf[0] == '-') {
+    PUTS("("); PUTS(buf); PUTS(")");
+  }
+  else {
+    PUTS(buf);
+  }
+}
+
+/* C type the expression is computed in */
+static enum hir_type_kind
+exp_kind(hpc_codegen_context *c, HIR *exp)
+{
+  const char *op;
+
+  switch (TYPE(exp)) {
+    case HIR_INT:
+      return HTYPE_INT;
+    case HIR_FLOAT:
+      return HTYPE_FLOAT;
+    case HIR_LVAR:
+      if (const_num_p(c, exp))
+        return hpc_lat_kind(c->mrb, exp->lat);
+      return var_kind(c, sym(exp->cdr));
+    case HIR_GVAR:
+      if (const_num_p(c, exp))
+        return hpc_lat_kind(c->mrb, exp->lat);
+      return HTYPE_VALUE;
+    case HIR_CALL:
+      switch (native_op(c, exp, &op)) {
+        case NATIVE_NONE:
+        case NATIVE_CMP:
+        case NATIVE_CHECKED:
+        case NATIVE_VREF:
+          return HTYPE_VALUE;
+        default:
+          return hpc_lat_kind(c->mrb, exp->lat);
+      }
+    case HIR_IVAR:
+    case HIR_FIELD:
+    case HIR_CVAR:
+      return hpc_lat_kind(c->mrb, exp->lat);
+    case HIR_SCALL:
+      return TYPE(CADR(CADDR(CDADR(exp))));
+    case HIR_ASSIGN:
+      return hpc_lat_kind(c->mrb, CADR(exp)->lat);
+    default:
+      return HTYPE_VALUE;
+  }
+}
+
+static void
+put_literal(hpc_codegen_context *c, HIR *exp)
+{
+  const char *text = (char *)CADR(exp);
+
+  if (text[0] == '-') {
+    PUTS("(-");
+    text++;
+  }
+  if ((intptr_t)CADDR(exp) == 16)
+    PUTS("0x");
+  PUTS(text);
+  if (((char *)CADR(exp))[0] == '-')
+    PUTS(")");
+}
+
+/*
+  Output:
+    Class_method__cN(recv, args...)
+  or Class_new__cN(recv, args...) for HIR_NEW
+  The arguments are converted into the types of the params.
+ */
+static void
+put_scall(hpc_codegen_context *c, HIR *exp)
+{
+  hpc_class *class = (hpc_class *)CAADR(exp);
+  HIR *fundecl = CDADR(exp);
+  HIR *params = CADDDDR(fundecl);
+  HIR *args = exp->cdr->cdr;
+
+  if (TYPE(exp) == HIR_NEW)
+    put_new_name(c, class, fundecl);
+  else
+    put_fundecl_name(c, class, fundecl);
+  PUTS("(");
+  put_exp(c, args->car, TRUE);
+  for (args = args->cdr, params = params->cdr; args; args = args->cdr, params = params->cdr) {
+    PUTS(", ");
+    put_exp_as(c, args->car, TYPE(CADR(params->car)), TRUE);
+  }
+  PUTS(")");
+}
+
+static HIR *lookup_map(HIR *map, mrb_sym sym, int arg_count);
+
+/*
+  The class of the method a call dispatches to when the receiver is
+  always an instance of the class (or the class itself), or 0.
+ */
+static mrb_sym
+monomorphic_class(hpc_codegen_context *c, HIR *exp)
+{
+  mrb_state *mrb = c->mrb;
+  mrb_value lat = CADDR(exp)->lat;
+  HIR *entries = lookup_map(c->function_map, sym(CADR(exp)), length(exp->cdr->cdr)-1);
+  struct RClass *klass;
+  int sdefp = FALSE;
+  mrb_sym name;
+
+  if (hpc_lat_const_p(mrb, lat) &&
+      (mrb_type(lat) == MRB_TT_CLASS || mrb_type(lat) == MRB_TT_MODULE)) {
+    klass = mrb_class_ptr(lat);
+    sdefp = TRUE;
+  }
+  else {
+    klass = hpc_lat_class_of(mrb, lat);
+  }
+  if (!klass)
+    return 0;
+  name = mrb_intern_cstr(mrb, mrb_class_name(mrb, klass));
+  for (; entries; entries = entries->cdr) {
+    if (sym(entries->car->car) == name && (intptr_t)entries->car->cdr == sdefp)
+      return name;
+  }
+  return 0;
+}
+
+/*
+  Class_method(recv, args...) in place of the multiplexer.
+  Returns FALSE if the method can be of any class.
+ */
+static int
+put_direct_call(hpc_codegen_context *c, HIR *exp)
+{
+  mrb_sym name = monomorphic_class(c, exp);
+  HIR *args = exp->cdr->cdr;
+
+  if (!name)
+    return FALSE;
+  put_unique_function_name(c, hirsym(name), CADR(exp));
+  PUTS("(");
+  while (args) {
+    put_exp(c, args->car, TRUE);
+    args = args->cdr;
+    if (args)
+      PUTS(", ");
+  }
+  PUTS(")");
+  return TRUE;
+}
+
+/* a function of the runtime (lib/builtin.c) implements the call */
+static int
+runtime_function_p(hpc_codegen_context *c, HIR *exp)
+{
+  static const struct {
+    const char *name;
+    int argc;
+  } table[] = {
+    {"+", 1}, {"-", 1}, {"*", 1}, {"/", 1}, {"^", 1}, {"<<", 1}, {">>", 1},
+    {"&", 1}, {"%", 1}, {"<", 1}, {"<=", 1}, {">", 1}, {">=", 1}, {"==", 1},
+    {"!", 0}, {"[]", 1}, {"[]=", 2}, {"-@", 0},
+    {"puts", 1}, {"print", 1},
+    {"sqrt", 1}, {"cos", 1}, {"sin", 1}, {"to_i", 0}, {"to_f", 0}, {"chr", 0},
+    {"to_s", 0}, {"hpc_ary_new", 0}, {"hpc_ary_float_p", 2},
+    {"hpc_ary_inplace_p", 2}, {"hpc_ary_len", 0}, {"hpc_numary_len", 0},
+    {"hpc_numary_sum", 0}, {"hpc_numary_dot", 1}, {"hpc_numary_axpy", 2},
+    {NULL, 0}
+  };
+  const char *name = mrb_sym2name(c->mrb, sym(CADR(exp)));
+  int argc = length(exp->cdr->cdr) - 1, i;
+
+  for (i = 0; table[i].name; i++) {
+    if (table[i].argc == argc && strcmp(table[i].name, name) == 0)
+      return TRUE;
+  }
+  return FALSE;
+}
+
+/*
+  mrb_funcall(mrb, recv, "name", argc, args...) for a method neither
+  compiled nor in the runtime, e.g. Integer#** or Object#class
+ */
+static int
+put_funcall(hpc_codegen_context *c, HIR *exp)
+{
+  HIR *args = exp->cdr->cdr;
+  int argc = length(args) - 1;
+  char buf[256];
+
+  if (lookup_map(c->function_map, sym(CADR(exp)), argc) || runtime_function_p(c, exp))
+    return FALSE;
+  PUTS("mrb_funcall(mrb, ");
+  put_exp(c, args->car, TRUE);
+  sprintf(buf, ", \"%s\", %d", mrb_sym2name(c->mrb, sym(CADR(exp))), argc);
+  PUTS(buf);
+  for (args = args->cdr; args; args = args->cdr) {
+    PUTS(", ");
+    put_exp(c, args->car, TRUE);
+  }
+  PUTS(")");
+  return TRUE;
+}
+
+/* hpc_yield(__block__, argc, argv) for yield in a method compiled without a block */
+static int
+put_yield_call(hpc_codegen_context *c, HIR *exp)
+{
+  HIR *args = exp->cdr->cdr->cdr;       /* after self */
+
+  if (sym(CADR(exp)) != mrb_intern_cstr(c->mrb, "hpc_yield"))
+    return FALSE;
+  PUTS("hpc_yield(__block__, ");
+  put_int(c, length(args));
+  if (!args) {
+    PUTS(", NULL)");
+    return TRUE;
+  }
+  PUTS(", (mrb_value[]){");
+  for (; args; args = args->cdr) {
+    put_exp(c, args->car, TRUE);
+    if (args->cdr)
+      PUTS(", ");
+  }
+  PUTS("})");
+  return TRUE;
+}
+
+/* operand kind of a numeric comparison */
+static enum hir_type_kind
+cmp_kind(hpc_codegen_context *c, HIR *args)
+{
+  if (hpc_lat_kind(c->mrb, args->car->lat) == HTYPE_INT &&
+      hpc_lat_kind(c->mrb, CADR(args)->lat) == HTYPE_INT)
+    return HTYPE_INT;
+  return HTYPE_FLOAT;
+}
+
+/*
+  A writer inlined where its value is used (see inline_accessors).  The
+  receiver is a variable, so it is evaluated again.
+ */
+static void
+put_field_assign(hpc_codegen_context *c, HIR *exp)
+{
+  HIR *lhs = CADR(exp);
+
+  hpc_assert(TYPE(lhs) == HIR_FIELD);
+  if (boxed_field_p(c, lhs)) {
+    PUTS("hpc_field_set(mrb, mrb_basic_ptr(");
+    put_exp(c, CADDR(lhs), TRUE);
+    PUTS("), &");
+    put_field(c, lhs);
+    PUTS(", ");
+    put_exp(c, CADDR(exp), TRUE);
+    PUTS(")");
+    return;
+  }
+  PUTS("(");
+  put_field(c, lhs);
+  PUTS(" = ");
+  put_exp_as(c, CADDR(exp), hpc_lat_kind(c->mrb, lhs->lat), TRUE);
+  PUTS(")");
+}
+
+/*
+  Output an expression in its own C type (exp_kind)
+ */
+static void
+put_native_exp(hpc_codegen_context *c, HIR *exp, int val)
+{
+  enum hir_type_kind kind = exp_kind(c, exp);
+  HIR *args;
+  const char *op;
+
+  if (kind != HTYPE_VALUE && const_num_p(c, exp)) {
+    put_const_num(c, exp->lat);
+    return;
+  }
+  switch (TYPE(exp)) {
+    case HIR_INT:
+    case HIR_FLOAT:
+      put_literal(c, exp);
+      return;
+    case HIR_LVAR:
+      put_var(c, exp->cdr);
+      return;
+    case HIR_IVAR:
+      put_ivar(c, exp->cdr);
+      return;
+    case HIR_FIELD:
+      put_field(c, exp);
+      return;
+    case HIR_CVAR:
+      put_cvar(c, exp->cdr);
+      return;
+    case HIR_SCALL:
+      put_scall(c, exp);
+      return;
+    case HIR_ASSIGN:
+      put_field_assign(c, exp);
+      return;
+    case HIR_CALL:
+      args = exp->cdr->cdr;
+      switch (native_op(c, exp, &op)) {
+        case NATIVE_BINOP:
+          PUTS("(");
+          put_exp_as(c, args->car, kind, TRUE);
+          PUTS(" "); PUTS(op); PUTS(" ");
+          put_exp_as(c, CADR(args), kind, TRUE);
+          PUTS(")");
+          return;
+        case NATIVE_FUNC:
+          PUTS(op);
+          PUTS(kind == HTYPE_INT ? "_int(" : "_float(");
+          put_exp_as(c, args->car, kind, TRUE);
+          PUTS(", ");
+          put_exp_as(c, CADR(args), kind, TRUE);
+          PUTS(")");
+          return;
+        case NATIVE_CMP:
+          PUTS("mrb_bool_value(");
+          put_exp_as(c, args->car, cmp_kind(c, args), TRUE);
+          PUTS(" "); PUTS(op); PUTS(" ");
+          put_exp_as(c, CADR(args), cmp_kind(c, args), TRUE);
+          PUTS(")");
+          return;
+        case NATIVE_CHECKED:
+          PUTS(op); PUTS("(");
+          put_exp_as(c, args->car, HTYPE_INT, TRUE);
+          PUTS(", ");
+          put_exp_as(c, CADR(args), HTYPE_INT, TRUE);
+          PUTS(")");
+          return;
+        case NATIVE_UMINUS:
+          PUTS("(-");
+          put_exp_as(c, args->car, kind, TRUE);
+          PUTS(")");
+          return;
+        case NATIVE_CONV:
+          PUTS(kind == HTYPE_INT ? "((mrb_int)" : "((mrb_float)");
+          /* a boxed param of a generic method is unboxed by its lattice */
+          put_exp_as(c, args->car, hpc_lat_kind(c->mrb, args->car->lat), TRUE);
+          PUTS(")");
+          return;
+        case NATIVE_AREF:
+        case NATIVE_ASET:
+        case NATIVE_VREF:
+          PUTS(op); PUTS("(");
+          put_exp(c, args->car, TRUE);
+          PUTS(", ");
+          put_exp_as(c, CADR(args), HTYPE_INT, TRUE);
+          if (args->cdr->cdr) {
+            PUTS(", ");
+            put_exp_as(c, CADDR(args), kind, TRUE);
+          }
+          PUTS(")");
+          return;
+        case NATIVE_MATH:
+          /* the receiver is Math */
+          PUTS(op); PUTS("(");
+          for (args = args->cdr; args; args = args->cdr) {
+            put_exp_as(c, args->car, HTYPE_FLOAT, TRUE);
+            if (args->cdr)
+              PUTS(", ");
+          }
+          PUTS(")");
+          return;
+        case NATIVE_NONE:
+          break;
+      }
+      break;
+    default:
+      break;
+  }
+  put_exp(c, exp, val);
+}
+
+/*
+  Output an expression converted into the given C type.
+  Unboxing relies on the lattice of the expression.
+ */
+static void
+put_exp_as(hpc_codegen_context *c, HIR *exp, enum hir_type_kind kind, int val)
+{
+  enum hir_type_kind have = exp_kind(c, exp);
+
+  if (have == kind) {
+    if (kind == HTYPE_VALUE)
+      put_exp(c, exp, val);
+    else
+      put_native_exp(c, exp, val);
+    return;
+  }
+  switch (kind) {
+    case HTYPE_VALUE:
+      PUTS(have == HTYPE_INT ? "mrb_fixnum_value(" : "mrb_float_value(");
+      put_native_exp(c, exp, val);
+      PUTS(")");
+      return;
+    case HTYPE_INT:
+      hpc_assert(have == HTYPE_VALUE);
+      PUTS("mrb_fixnum(");
+      put_exp(c, exp, val);
+      PUTS(")");
+      return;
+    case HTYPE_FLOAT:
+      if (have == HTYPE_INT) {
+        PUTS("((mrb_float)");
+        put_native_exp(c, exp, val);
+        PUTS(")");
+        return;
+      }
+      switch (hpc_lat_kind(c->mrb, exp->lat)) {
+        case HTYPE_FLOAT:
+          PUTS("mrb_float(");
+          break;
+        case HTYPE_INT:
+          PUTS("((mrb_float)mrb_fixnum(");
+          put_exp(c, exp, val);
+          PUTS("))");
+          return;
+        default:
+          PUTS("hpc_to_float(");
+          break;
+      }
+      put_exp(c, exp, val);
+      PUTS(")");
+      return;
+    default:
+      NOT_REACHABLE();
+  }
+}
+
+/*
+  Output a C condition (w/o parens)
+ */
+static void
+put_cond(hpc_codegen_context *c, HIR *exp)
+{
+  const char *op;
+
+  if (native_op(c, exp, &op) == NATIVE_CMP) {
+    HIR *args = exp->cdr->cdr;
+    put_exp_as(c, args->car, cmp_kind(c, args), TRUE);
+    PUTS(" "); PUTS(op); PUTS(" ");
+    put_exp_as(c, CADR(args), cmp_kind(c, args), TRUE);
+    return;
+  }
+  PUTS("mrb_bool(");
+  put_exp(c, exp, TRUE);
+  PUTS(")");
+}
+
+/*
+  Strings of pieces (see build_strings in compile.c)
+    hpc_str_build: ({ __s = a buffer of the size of the pieces; append; __s; })
+    hpc_str_append: ({ __s = the String; append; __s; })
+    hpc_print: (write the pieces, ..., mrb_nil_value())
+ */
+enum str_piece_kind {
+  PIECE_LITERAL,  /* bytes of a C string literal */
+  PIECE_INT,      /* digits of a Fixnum */
+  PIECE_CHR,      /* Fixnum#chr */
+  PIECE_STRING,   /* any String */
+};
+
+#define PIECE_INT_SIZE 21       /* digits of a 64 bit integer and sign */
+
+static enum str_piece_kind
+str_piece_kind(hpc_codegen_context *c, HIR *piece)
+{
+  if (TYPE(piece) == HIR_STRING)
+    return PIECE_LITERAL;
+  if (hpc_lat_kind(c->mrb, piece->lat) == HTYPE_INT)
+    return PIECE_INT;
+  if (TYPE(piece) == HIR_CALL && sym(CADR(piece)) == mrb_intern_cstr(c->mrb, "chr") &&
+      hpc_lat_kind(c->mrb, CADDR(piece)->lat) == HTYPE_INT)
+    return PIECE_CHR;
+  return PIECE_STRING;
+}
+
+static int
+str_pieces_size(hpc_codegen_context *c, HIR *pieces)
+{
+  int size = 0;
+
+  for (; pieces; pieces = pieces->cdr) {
+    switch (str_piece_kind(c, pieces->car)) {
+      case PIECE_LITERAL:
+        size += (intptr_t)CADDR(pieces->car);
+        break;
+      case PIECE_INT:
+        size += PIECE_INT_SIZE;
+        break;
+      case PIECE_CHR:
+        size++;
+        break;
+      case PIECE_STRING:
+        break;
+    }
+  }
+  return size;
+}
+
+/* append the piece to __s, or write it */
+static void
+put_str_piece(hpc_codegen_context *c, HIR *piece, int output)
+{
+  switch (str_piece_kind(c, piece)) {
+    case PIECE_LITERAL:
+      PUTS(output ? "hpc_output_write(\"" : "mrb_str_cat(mrb, __s, \"");
+      puts_noescape(c, (char *)CADR(piece));
+      PUTS("\", ");
+      put_int(c, (intptr_t)CADDR(piece));
+      break;
+    case PIECE_INT:
+      PUTS(output ? "hpc_output_int(" : "hpc_str_cat_int(__s, ");
+      put_exp_as(c, piece, HTYPE_INT, TRUE);
+      break;
+    case PIECE_CHR:
+      PUTS(output ? "hpc_output_chr(" : "hpc_str_cat_chr(__s, ");
+      put_exp_as(c, CADDR(piece), HTYPE_INT, TRUE);
+      break;
+    case PIECE_STRING:
+      PUTS(output ? "hpc_output_str(" : "mrb_str_concat(mrb, __s, ");
+      put_exp(c, piece, TRUE);
+      break;
+  }
+  PUTS(")");
+}
+
+static int
+put_str_call(hpc_codegen_context *c, HIR *exp)
+{
+  mrb_state *mrb = c->mrb;
+  mrb_sym name = sym(CADR(exp));
+  HIR *pieces = exp->cdr->cdr;
+
+  if (name == mrb_intern_cstr(mrb, "hpc_print")) {
+    PUTS("(");
+    for (; pieces; pieces = pieces->cdr) {
+      put_str_piece(c, pieces->car, TRUE);
+      PUTS(", ");
+    }
+    PUTS("mrb_nil_value())");
+    return TRUE;
+  }
+  if (name != mrb_intern_cstr(mrb, "hpc_str_build") &&
+      name != mrb_intern_cstr(mrb, "hpc_str_append"))
+    return FALSE;
+  PUTS("({\n");
+  INDENT_PP;
+  PUTS_INDENT;
+  PUTS("mrb_value __s = ");
+  if (name == mrb_intern_cstr(mrb, "hpc_str_build")) {
+    PUTS("mrb_str_buf_new(mrb, ");
+    put_int(c, str_pieces_size(c, pieces));
+    PUTS(")");
+  }
+  else {
+    put_exp(c, pieces->car, TRUE);
+    pieces = pieces->cdr;
+  }
+  PUTS(";\n");
+  for (; pieces; pieces = pieces->cdr) {
+    PUTS_INDENT;
+    put_str_piece(c, pieces->car, FALSE);
+    PUTS(";\n");
+  }
+  PUTS_INDENT;
+  PUTS("__s;\n");
+  INDENT_MM;
+  PUTS_INDENT;
+  PUTS("})");
+  return TRUE;
+}
+
 /*
   Output:
     some_exp
   w/o newline, w/o trailing semicolon
+  The value is boxed in mrb_value.
  */
 static void
 put_exp(hpc_codegen_context *c, HIR *exp, int val)
 {
+  if (exp_kind(c, exp) != HTYPE_VALUE) {
+    put_exp_as(c, exp, HTYPE_VALUE, val);
+    return;
+  }
   switch (TYPE(exp)) {
     case HIR_PRIM:
       switch ((enum hir_primitive_type)exp->cdr) {
@@ -474,18 +1570,6 @@ put_exp(hpc_codegen_context *c, HIR *exp, int val)
         PUTS("mrb_true_value()");
         return;
       }
-    case HIR_INT:
-      PUTS("mrb_fixnum_value(");
-      if ((intptr_t)CADDR(exp) == 16)
-        PUTS("0x");
-      PUTS((char *)CADR(exp));
-      PUTS(")");
-      return;
-    case HIR_FLOAT:
-      PUTS("mrb_float_value(");
-      PUTS((char *)CADR(exp));
-      PUTS(")");
-      return;
     case HIR_STRING:
       PUTS("mrb_str_new(mrb, \"");
       puts_noescape(c, (char *)CADR(exp));
@@ -500,6 +1584,9 @@ put_exp(hpc_codegen_context *c, HIR *exp, int val)
     case HIR_IVAR:
       put_ivar(c, exp->cdr);
       break;
+    case HIR_FIELD:
+      put_field(c, exp);
+      break;
     case HIR_CVAR:
       put_cvar(c, exp->cdr);
       break;
@@ -510,6 +1597,19 @@ put_exp(hpc_codegen_context *c, HIR *exp, int val)
        */
       {
         HIR *args = exp->cdr->cdr;
+        const char *op;
+        switch (native_op(c, exp, &op)) {
+          case NATIVE_CMP:
+          case NATIVE_CHECKED:
+          case NATIVE_VREF:
+            put_native_exp(c, exp, val);
+            return;
+          default:
+            break;
+        }
+        if (put_str_call(c, exp) || put_yield_call(c, exp) || put_direct_call(c, exp) ||
+            put_funcall(c, exp))
+          return;
         put_call_function_name(c, CADR(exp), length(args)-1);
         PUTS("(");
         put_int(c, val);
@@ -524,9 +1624,13 @@ put_exp(hpc_codegen_context *c, HIR *exp, int val)
       }
       PUTS(")");
       return;
+    case HIR_SCALL:
+    case HIR_NEW:
+      put_scall(c, exp);
+      return;
     case HIR_COND_OP:
-      PUTS("( mrb_bool(");
-      put_exp(c, CADR(exp), TRUE);
+      PUTS("( (");
+      put_cond(c, CADR(exp));
       PUTS(") ? ");
       put_exp(c, CADDR(exp), TRUE);
       PUTS(" : ");
@@ -559,11 +1663,265 @@ put_exp(hpc_codegen_context *c, HIR *exp, int val)
         PUTS(")");
       }
       return;
+    case HIR_SCOPE:
+      /* GCC statement expression, the last statement is the value */
+      {
+        HIR *decls = CADR(exp);
+        HIR *stats = exp->cdr->cdr;
+        int nvars = c->nvars, pushed;
+
+        PUTS("({\n");
+        INDENT_PP;
+        while (decls) {
+          put_decl(c, decls->car);
+          decls = decls->cdr;
+        }
+        pushed = put_frame_push(c, NULL, CADR(exp));
+        if (TYPE(stats) == HIR_BLOCK) {
+          for (stats = stats->cdr->car; stats->cdr; stats = stats->cdr)
+            put_statement(c, stats->car, FALSE);
+          stats = stats->car;
+        }
+        PUTS_INDENT;
+        if (pushed) {
+          int id = c->frames[c->nframes - 1];
+
+          PUTS("mrb_value "); put_frame_name(c, "__val", id); PUTS(" = ");
+          put_exp(c, stats, TRUE);
+          PUTS(";\n");
+          put_frame_pop(c, --c->nframes);
+          PUTS_INDENT; put_frame_name(c, "__val", id);
+        }
+        else {
+          put_exp(c, stats, TRUE);
+        }
+        PUTS(";\n");
+        c->nvars = nvars;
+        INDENT_MM;
+        PUTS_INDENT;
+        PUTS("})");
+      }
+      return;
+    case HIR_ASSIGN:
+      put_field_assign(c, exp);
+      return;
     default:
       NOT_REACHABLE();
   }
 }
 
+/*
+  Parallel loops
+
+  A DOALL loop runs its iterations in OpenMP threads if they are
+  independent: the body assigns only variables declared in the loop
+  and elements of arrays at the counter, and calls nothing which
+  allocates objects or has side effects.  Arrays written are checked
+  at run time not to be extended or read by other iterations (see
+  put_omp_pragma); otherwise the loop runs serially.
+ */
+
+typedef struct {
+  mrb_sym counter;
+  HIR *locals;                  /* variables declared in the loop */
+  HIR *writes;                  /* arrays written at the counter */
+  HIR *reads;                   /* arrays read at other elements */
+} hpc_par_info;
+
+static int
+sym_member_p(HIR *list, mrb_sym sym)
+{
+  for (; list; list = list->cdr) {
+    if (sym(list->car) == sym)
+      return TRUE;
+  }
+  return FALSE;
+}
+
+/* an array in a variable not assigned in the loop */
+static int
+par_array_p(hpc_codegen_context *c, hpc_par_info *info, HIR *exp)
+{
+  return TYPE(exp) == HIR_LVAR && !sym_member_p(info->locals, sym(exp->cdr)) &&
+    hpc_lat_class_of(c->mrb, exp->lat) == c->mrb->array_class;
+}
+
+static int
+counter_p(hpc_par_info *info, HIR *exp)
+{
+  return TYPE(exp) == HIR_LVAR && sym(exp->cdr) == info->counter;
+}
+
+static int
+par_exp_p(hpc_codegen_context *c, hpc_par_info *info, HIR *exp)
+{
+  hpc_state *p = c->hpc;
+  const char *op;
+  HIR *args;
+
+  switch (TYPE(exp)) {
+    case HIR_INT:
+    case HIR_FLOAT:
+    case HIR_PRIM:
+    case HIR_LVAR:
+      return TRUE;
+    case HIR_CALL:
+      args = exp->cdr->cdr;
+      if ((sym(CADR(exp)) == mrb_intern_cstr(c->mrb, "[]") ||
+           native_op(c, exp, &op) == NATIVE_AREF ||
+           native_op(c, exp, &op) == NATIVE_VREF) && length(args) == 2) {
+        if (!par_array_p(c, info, args->car) || !par_exp_p(c, info, CADR(args)))
+          return FALSE;
+        if (!counter_p(info, CADR(args)))
+          push(info->reads, args->car->cdr);
+        return TRUE;
+      }
+      switch (native_op(c, exp, &op)) {
+        case NATIVE_NONE:
+        case NATIVE_ASET:
+          return FALSE;
+        case NATIVE_MATH:
+          args = args->cdr;     /* Math */
+          break;
+        default:
+          break;
+      }
+      for (; args; args = args->cdr) {
+        if (!par_exp_p(c, info, args->car))
+          return FALSE;
+      }
+      return TRUE;
+    default:
+      return FALSE;
+  }
+}
+
+static int
+par_stat_p(hpc_codegen_context *c, hpc_par_info *info, HIR *stat)
+{
+  hpc_state *p = c->hpc;
+  HIR *list;
+
+  if (!stat)
+    return TRUE;
+  switch (TYPE(stat)) {
+    case HIR_SCOPE:
+      for (list = CADR(stat); list; list = list->cdr) {
+        if (!par_stat_p(c, info, list->car))
+          return FALSE;
+      }
+      return par_stat_p(c, info, stat->cdr->cdr);
+    case HIR_LVARDECL:
+      push(info->locals, CADDR(stat));
+      return TYPE(CADDDR(stat)) == HIR_EMPTY || par_exp_p(c, info, CADDDR(stat));
+    case HIR_BLOCK:
+      for (list = CADR(stat); list; list = list->cdr) {
+        if (!par_stat_p(c, info, list->car))
+          return FALSE;
+      }
+      return TRUE;
+    case HIR_ASSIGN:
+      return TYPE(CADR(stat)) == HIR_LVAR && sym_member_p(info->locals, sym(CADR(stat)->cdr)) &&
+        par_exp_p(c, info, CADDR(stat));
+    case HIR_IFELSE:
+      return par_exp_p(c, info, CADR(stat)) && par_stat_p(c, info, CADDR(stat)) &&
+        par_stat_p(c, info, CADDDR(stat));
+    case HIR_DOALL:
+      push(info->locals, CADR(stat)->cdr);
+      return par_exp_p(c, info, CADDR(stat)) && par_exp_p(c, info, CADDDR(stat)) &&
+        par_stat_p(c, info, CADDDDR(stat));
+    case HIR_WHILE:
+      return par_exp_p(c, info, CADR(stat)) && par_stat_p(c, info, CADDR(stat));
+    case HIR_CALL:
+      {
+        HIR *args = stat->cdr->cdr;
+        const char *op;
+        if ((sym(CADR(stat)) != mrb_intern_cstr(c->mrb, "[]=") &&
+             native_op(c, stat, &op) != NATIVE_ASET) || length(args) != 3)
+          return FALSE;
+        if (!par_array_p(c, info, args->car) || !counter_p(info, CADR(args)) ||
+            !par_exp_p(c, info, CADDR(args)))
+          return FALSE;
+        push(info->writes, args->car->cdr);
+        return TRUE;
+      }
+    case HIR_EMPTY:
+    case HIR_INT:
+    case HIR_FLOAT:
+    case HIR_PRIM:
+    case HIR_LVAR:
+      return TRUE;
+    default:
+      return FALSE;
+  }
+}
+
+/* the iterations of the DOALL loop can run in parallel */
+static int
+parallel_doall_p(hpc_codegen_context *c, HIR *stat, hpc_par_info *info)
+{
+  hpc_state *p = c->hpc;
+  HIR *w;
+
+  info->counter = sym(CADR(stat)->cdr);
+  info->locals = info->writes = info->reads = 0;
+  push(info->locals, CADR(stat)->cdr);
+  if (!par_stat_p(c, info, CADDDDR(stat)) || !info->writes)
+    return FALSE;
+  for (w = info->writes; w; w = w->cdr) {
+    if (sym_member_p(info->reads, sym(w->car)))
+      return FALSE;
+  }
+  return TRUE;
+}
+
+/*
+  #pragma omp parallel for if (arrays are written in place and
+                               not the arrays read)
+ */
+static void
+put_omp_pragma(hpc_codegen_context *c, hpc_par_info *info, const char *first, const char *last)
+{
+  HIR *w, *r;
+
+  PUTS("#pragma omp parallel for if (");
+  for (w = info->writes; w; w = w->cdr) {
+    PUTS("hpc_ary_writable("); put_var(c, w->car);
+    PUTS(", "); PUTS(first); PUTS(", "); PUTS(last); PUTS(")");
+    for (r = info->reads; r; r = r->cdr) {
+      PUTS(" && mrb_obj_ptr("); put_var(c, w->car);
+      PUTS(") != mrb_obj_ptr("); put_var(c, r->car); PUTS(")");
+    }
+    if (w->cdr)
+      PUTS(" && ");
+  }
+  PUTS(")\n");
+}
+
+/* the statement ends with return, popping the frames */
+static int
+returned_p(HIR *stat)
+{
+  if (TYPE(stat) == HIR_BLOCK) {
+    HIR *stats = CADR(stat);
+
+    if (!stats)
+      return FALSE;
+    while (stats->cdr)
+      stats = stats->cdr;
+    stat = stats->car;
+  }
+  return TYPE(stat) == HIR_RETURN;
+}
+
+/* a field which the GC marks, needing the write barrier */
+static int
+boxed_field_p(hpc_codegen_context *c, HIR *lhs)
+{
+  return hpc_lat_kind(c->mrb, lhs->lat) == HTYPE_VALUE
+    && !hpc_lat_immediate_p(c->mrb, lhs->lat);
+}
+
 /*
   Output:
     some
@@ -578,19 +1936,28 @@ put_statement(hpc_codegen_context *c, HIR *stat, int no_brace)
       {
         HIR *decls = CADR(stat);
         HIR *inner_stat = stat->cdr->cdr;
+        HIR *params = c->param_roots;
+        int nvars = c->nvars, pushed;
         if (!no_brace) {
           PUTS_INDENT;
           PUTS("{\n");
           INDENT_PP;
         }
+        c->param_roots = NULL;
         if (decls) {
           while (decls) {
             put_decl(c, decls->car);
             decls = decls->cdr;
           }
-          PUTS("\n");
         }
+        pushed = put_frame_push(c, params, CADR(stat));
+        if (CADR(stat) || pushed)
+          PUTS("\n");
         put_statement(c, inner_stat, TRUE);
+        if (pushed && !returned_p(inner_stat))
+          put_frame_pop(c, c->nframes - 1);
+        c->nframes -= pushed;
+        c->nvars = nvars;
         if (!no_brace) {
           INDENT_MM;
           PUTS_INDENT;
@@ -607,7 +1974,8 @@ put_statement(hpc_codegen_context *c, HIR *stat, int no_brace)
           INDENT_PP;
         }
         while (stats) {
-          put_statement(c, stats->car, TRUE);
+          /* nested scopes have their own declarations */
+          put_statement(c, stats->car, TYPE(stats->car) != HIR_SCOPE);
           stats = stats->cdr;
         }
         if (!no_brace) {
@@ -623,6 +1991,10 @@ put_statement(hpc_codegen_context *c, HIR *stat, int no_brace)
       PUTS_INDENT;
       switch (TYPE(CADR(stat))) {
       case HIR_LVAR:
+        put_var(c, CADR(stat)->cdr);
+        PUTS(" = ");
+        put_exp_as(c, CADDR(stat), var_kind(c, sym(CADR(stat)->cdr)), TRUE);
+        break;
       case HIR_GVAR:
         put_var(c, CADR(stat)->cdr);
         PUTS(" = ");
@@ -631,21 +2003,37 @@ put_statement(hpc_codegen_context *c, HIR *stat, int no_brace)
       case HIR_IVAR:
         put_ivar(c, CADR(stat)->cdr);
         PUTS(" = ");
-        put_exp(c, CADDR(stat), TRUE);
+        put_exp_as(c, CADDR(stat), hpc_lat_kind(c->mrb, CADR(stat)->lat), TRUE);
+        if (boxed_field_p(c, CADR(stat))) {
+          PUTS(";\n");
+          PUTS_INDENT; PUTS("mrb_field_write_barrier_value(mrb, mrb_basic_ptr(__self__), ");
+          put_ivar(c, CADR(stat)->cdr); PUTS(")");
+        }
+        break;
+      case HIR_FIELD:
+        put_field(c, CADR(stat));
+        PUTS(" = ");
+        put_exp_as(c, CADDR(stat), hpc_lat_kind(c->mrb, CADR(stat)->lat), TRUE);
+        if (boxed_field_p(c, CADR(stat))) {
+          PUTS(";\n");
+          PUTS_INDENT; PUTS("mrb_field_write_barrier_value(mrb, mrb_basic_ptr(");
+          put_exp(c, CADDR(CADR(stat)), TRUE); PUTS("), ");
+          put_field(c, CADR(stat)); PUTS(")");
+        }
         break;
       case HIR_CVAR:
         put_cvar(c, CADR(stat)->cdr);
         PUTS(" = ");
-        put_exp(c, CADDR(stat), TRUE);
+        put_exp_as(c, CADDR(stat), hpc_lat_kind(c->mrb, CADR(stat)->lat), TRUE);
         break;
       }
       PUTS(";\n");
       return;
     case HIR_IFELSE:
       PUTS_INDENT;
-      PUTS("if ( mrb_bool(");
-      put_exp(c, CADR(stat), TRUE);
-      PUTS(") )\n");
+      PUTS("if ( ");
+      put_cond(c, CADR(stat));
+      PUTS(" )\n");
       if (CADDR(stat)) {
         put_statement(c, CADDR(stat), FALSE);
       } else {
@@ -660,73 +2048,149 @@ put_statement(hpc_codegen_context *c, HIR *stat, int no_brace)
       return;
     case HIR_DOALL:
       /* FIXME: expects
-         - var is mrb_sym
-         - var is defined at the top of this block
+         - var is HIR_LVAR of the block scope
          - low, high are exp
          - body is a statement
       */
       {
         HIR *low  = CADDR(stat);
         HIR *high = CADDDR(stat);
-        HIR *sym = CADR(stat);
-        char counter[32], last[32];
+        HIR *var = CADR(stat);
+        HIR *sym = var->cdr;
+        enum hir_type_kind kind = hpc_lat_kind(c->mrb, var->lat);
+        int nvars = c->nvars, parallel = c->parallel;
+        int loop_nframes = c->loop_nframes;
+        char counter[64], first[64], last[64];
+        hpc_par_info info;
 
         sprintf(counter, "__%s", mrb_sym2name(c->mrb, sym(sym)));
+        sprintf(first, "__%s_first", mrb_sym2name(c->mrb, sym(sym)));
         sprintf(last, "__%s_last", mrb_sym2name(c->mrb, sym(sym)));
 
-        if (!no_brace) {
-          INDENT_PP;
-          PUTS_INDENT;
-          PUTS("{\n");
-        }
+        PUTS_INDENT;
+        PUTS("{\n");
+        INDENT_PP;
         PUTS_INDENT;
         PUTS("mrb_int "); PUTS(counter); PUTS(" = ");
-        PUTS("mrb_fixnum("); put_exp(c, low, TRUE); PUTS(");\n");
+        put_exp_as(c, low, HTYPE_INT, TRUE); PUTS(";\n");
         PUTS_INDENT;
         PUTS("mrb_int "); PUTS(last); PUTS(" = ");
-        PUTS("mrb_fixnum("); put_exp(c, high, TRUE); PUTS(");\n");
+        put_exp_as(c, high, HTYPE_INT, TRUE); PUTS(";\n");
         PUTS_INDENT;
-        PUTS("for (; ");
+        if (!parallel && parallel_doall_p(c, stat, &info)) {
+          /* OpenMP needs the initialization in for */
+          PUTS("mrb_int "); PUTS(first); PUTS(" = "); PUTS(counter); PUTS(";\n");
+          put_omp_pragma(c, &info, first, last);
+          PUTS_INDENT;
+          PUTS("for ("); PUTS(counter); PUTS(" = "); PUTS(first); PUTS("; ");
+          c->parallel = TRUE;
+        }
+        else {
+          PUTS("for (; ");
+        }
         PUTS(counter); PUTS(" < "); PUTS(last); PUTS("; ");
         PUTS("++"); PUTS(counter); PUTS(") {\n");
         INDENT_PP;
+        /* the body of a parallel loop does not allocate objects */
+        if (!c->parallel) {
+          PUTS_INDENT;
+          PUTS("int ai = mrb_gc_arena_save(mrb);\n");
+        }
         PUTS_INDENT;
-        PUTS("int ai = mrb_gc_arena_save(mrb);\n");
-        PUTS_INDENT;
-        PUTS("mrb_value "); put_symbol(c, sym); PUTS(" = "); PUTS("mrb_fixnum_value("); PUTS(counter); PUTS(");\n");
+        if (kind == HTYPE_INT) {
+          PUTS("mrb_int "); put_symbol(c, sym); PUTS(" = "); PUTS(counter); PUTS(";\n");
+        } else {
+          PUTS("mrb_value "); put_symbol(c, sym); PUTS(" = "); PUTS("mrb_fixnum_value("); PUTS(counter); PUTS(");\n");
+          kind = HTYPE_VALUE;
+        }
+        push_var(c, sym(sym), kind);
+        c->loop_nframes = c->nframes;
         put_statement(c, CADDDDR(stat), TRUE);
+        c->loop_nframes = loop_nframes;
+        c->nvars = nvars;
+        if (!c->parallel) {
+          PUTS_INDENT;
+          PUTS("mrb_gc_arena_restore(mrb, ai);\n");
+        }
+        c->parallel = parallel;
+        INDENT_MM;
         PUTS_INDENT;
-        PUTS("mrb_gc_arena_restore(mrb, ai);\n");
+        PUTS("}\n");
         INDENT_MM;
         PUTS_INDENT;
         PUTS("}\n");
-        if (!no_brace) {
-          INDENT_MM;
-          PUTS_INDENT;
-          PUTS("}\n");
-        }
       }
       return;
     case HIR_WHILE:
       PUTS_INDENT;
       PUTS("while (");
-      put_exp(c, CADR(stat), TRUE);
-      PUTS(") ");
-      put_statement(c, CADDR(stat), FALSE);
-      return;
-    case HIR_BREAK:
+      put_cond(c, CADR(stat));
+      PUTS(") {\n");
+      INDENT_PP;
+      if (!c->parallel) {
+        PUTS_INDENT;
+        PUTS("int ai = mrb_gc_arena_save(mrb);\n");
+      }
+      {
+        int loop_nframes = c->loop_nframes;
+
+        c->loop_nframes = c->nframes;
+        put_statement(c, CADDR(stat), FALSE);
+        c->loop_nframes = loop_nframes;
+      }
+      if (!c->parallel) {
+        PUTS_INDENT;
+        PUTS("mrb_gc_arena_restore(mrb, ai);\n");
+      }
+      INDENT_MM;
       PUTS_INDENT;
-      PUTS("break;\n");
+      PUTS("}\n");
       return;
+    case HIR_BREAK:
     case HIR_CONTINUE:
+      if (c->nframes > c->loop_nframes) {
+        /* leave the frames in the loop */
+        PUTS_INDENT; PUTS("{\n");
+        INDENT_PP;
+        put_frame_pop(c, c->loop_nframes);
+      }
       PUTS_INDENT;
-      PUTS("continue;\n");
+      PUTS(TYPE(stat) == HIR_BREAK ? "break;\n" : "continue;\n");
+      if (c->nframes > c->loop_nframes) {
+        INDENT_MM;
+        PUTS_INDENT; PUTS("}\n");
+      }
       return;
     case HIR_RETURN:
+      if (c->nframes > 0) {
+        PUTS_INDENT; PUTS("{\n");
+        INDENT_PP;
+        if (stat->cdr && c->ret_kind != HTYPE_VOID) {
+          /* the value is computed in the frames */
+          HIR type = { 0 };
+
+          type.car = (HIR *)(intptr_t)c->ret_kind;
+          PUTS_INDENT; put_type(c, &type); PUTS(" __ret = ");
+          put_exp_as(c, CADR(stat), c->ret_kind, TRUE);
+          PUTS(";\n");
+          put_frame_pop(c, 0);
+          PUTS_INDENT; PUTS("return __ret;\n");
+        }
+        else {
+          if (stat->cdr)
+            put_statement(c, CADR(stat), FALSE);
+          put_frame_pop(c, 0);
+          PUTS_INDENT;
+          PUTS("return mrb_nil_value();\n");
+        }
+        INDENT_MM;
+        PUTS_INDENT; PUTS("}\n");
+        return;
+      }
       PUTS_INDENT;
       if (stat->cdr) {
         PUTS("return ");
-        put_exp(c, CADR(stat), TRUE);
+        put_exp_as(c, CADR(stat), c->ret_kind, TRUE);
         PUTS(";\n");
       } else {
         PUTS("return mrb_nil_value();\n");
@@ -739,18 +2203,48 @@ put_statement(hpc_codegen_context *c, HIR *stat, int no_brace)
         HIR *name = hirsym(((hpc_class*)stat->cdr)->name);
         PUTS_INDENT;
         put_var(c, name); PUTS(" = ");
-        PUTS("mrb_obj_value(mrb_define_class(mrb, \"");
-        put_symbol(c, name);
-        PUTS("\", mrb->object_class));\n");
+        if (c->hpc->vm_irep >= 0) {
+          /* defined with the methods left to the VM by hpc_vm_init */
+          PUTS("mrb_const_get(mrb, mrb_obj_value(mrb->object_class), mrb_intern(mrb, \"");
+          put_symbol(c, name);
+          PUTS("\"));\n");
+        }
+        else {
+          PUTS("mrb_obj_value(mrb_define_class(mrb, \"");
+          put_symbol(c, name);
+          PUTS("\", mrb->object_class));\n");
+        }
         PUTS_INDENT;
         put_symbol(c, name); PUTS("_init("); put_var(c, name); PUTS(");\n");
       }
       return;
     case HIR_EMPTY:
+    case HIR_PRIM:
+    case HIR_INT:
+    case HIR_FLOAT:
+    case HIR_STRING:
+    case HIR_LVAR:
+    case HIR_GVAR:
+    case HIR_IVAR:
+    case HIR_CVAR:
+      /* the value is not used */
       return;
     case HIR_CALL:
       PUTS_INDENT;
-      put_exp(c, stat, FALSE);
+      if (exp_kind(c, stat) != HTYPE_VALUE)
+        put_native_exp(c, stat, c->parallel);
+      else
+        put_exp(c, stat, c->parallel);  /* no arena in threads */
+      PUTS(";\n");
+      return;
+    case HIR_FIELD:
+      /* only the receiver can have effects */
+      put_statement(c, CADDR(stat), FALSE);
+      return;
+    case HIR_SCALL:
+    case HIR_NEW:
+      PUTS_INDENT;
+      put_scall(c, stat);
       PUTS(";\n");
       return;
     case HIR_LVARDECL:
@@ -788,17 +2282,141 @@ put_map_decl(hpc_codegen_context *c, const mrb_sym name, const int arg_count)
   PUTS(")");
 }
 
+/* the entry appears before in the list of classes */
+static int
+dup_entry_p(HIR *classes, HIR *entry)
+{
+  for (; classes->car != entry; classes = classes->cdr) {
+    if (classes->car->car == entry->car && classes->car->cdr == entry->cdr)
+      return TRUE;
+  }
+  return FALSE;
+}
+
+/* the clone speculated for classes of args (see speculate), or 0 */
+static hpc_clone*
+lookup_speculation(hpc_codegen_context *c, HIR *class_name, int sdefp, HIR *mid, int argc,
+                   hpc_class **class)
+{
+  HIR *classes, *l;
+
+  for (classes = c->hpc->classes; classes; classes = classes->cdr) {
+    *class = (hpc_class *)classes->car;
+    if (hirsym((*class)->name) != class_name)
+      continue;
+    for (l = (*class)->speculations; l; l = l->cdr) {
+      hpc_clone *clone = (hpc_clone *)l->car;
+      if (CADDDR(clone->fundecl) == mid && clone->argc == argc &&
+          (intptr_t)CADR(clone->fundecl) == sdefp)
+        return clone;
+    }
+  }
+  return 0;
+}
+
+static int
+class_code_p(hpc_codegen_context *c, struct RClass *klass)
+{
+  const char *name = mrb_class_name(c->mrb, klass);
+  HIR *classes;
+
+  for (classes = c->hpc->classes; classes; classes = classes->cdr) {
+    mrb_sym class_name = ((hpc_class *)classes->car)->name;
+    if (class_name && name && strcmp(mrb_sym2name(c->mrb, class_name), name) == 0)
+      return TRUE;
+  }
+  return FALSE;
+}
+
+/*
+  if (mrb_float_p(arg0))
+    <lhs>mrb_float_value(Class_funname__cN(__self__, mrb_float(arg0)));
+  else
+    <the call of the generic method put by the caller>
+
+  self and args are named as the caller, argfmt is "arg%d" or "argv[%d]".
+ */
+static void
+put_speculation(hpc_codegen_context *c, HIR *class_name, int sdefp, HIR *mid, int argc,
+                const char *self, const char *argfmt, const char *indent, const char *lhs)
+{
+  mrb_state *mrb = c->mrb;
+  hpc_class *class;
+  hpc_clone *clone = lookup_speculation(c, class_name, sdefp, mid, argc, &class);
+  enum hir_type_kind ret_kind;
+  char arg[32], buf[256];
+  int i, guards = 0;
+
+  if (!clone)
+    return;
+  PUTS("if (");
+  for (i = 0; i < clone->argc; i++) {
+    struct RClass *klass = hpc_lat_class_of(mrb, clone->param_lats[i]);
+    if (!klass || !(klass == mrb->fixnum_class || klass == mrb->float_class ||
+                    class_code_p(c, klass)))
+      continue;
+    if (guards++)
+      PUTS(" && ");
+    sprintf(arg, argfmt, i);
+    if (klass == mrb->fixnum_class)
+      sprintf(buf, "mrb_fixnum_p(%s)", arg);
+    else if (klass == mrb->float_class)
+      sprintf(buf, "mrb_float_p(%s)", arg);
+    else
+      sprintf(buf, "hpc_type_of(%s) == T_%s", arg, mrb_class_name(mrb, klass));
+    PUTS(buf);
+  }
+  PUTS(")\n");
+  PUTS(indent); PUTS("\t"); PUTS(lhs);
+  ret_kind = (intptr_t)CADR(CADDR(clone->fundecl))->car;
+  if (ret_kind == HTYPE_INT)
+    PUTS("mrb_fixnum_value(");
+  else if (ret_kind == HTYPE_FLOAT)
+    PUTS("mrb_float_value(");
+  put_fundecl_name(c, class, clone->fundecl);
+  PUTS("("); PUTS(self);
+  for (i = 0; i < clone->argc; i++) {
+    sprintf(arg, argfmt, i);
+    switch (hpc_lat_kind(mrb, clone->param_lats[i])) {
+      case HTYPE_INT:
+        sprintf(buf, ", mrb_fixnum(%s)", arg);
+        break;
+      case HTYPE_FLOAT:
+        if (hpc_lat_class_of(mrb, clone->param_lats[i]) == mrb->float_class)
+          sprintf(buf, ", mrb_float(%s)", arg);
+        else
+          sprintf(buf, ", hpc_to_float(%s)", arg);
+        break;
+      default:
+        sprintf(buf, ", %s", arg);
+    }
+    PUTS(buf);
+  }
+  PUTS(ret_kind == HTYPE_INT || ret_kind == HTYPE_FLOAT ? "));\n" : ");\n");
+  PUTS(indent); PUTS("else\n");
+  PUTS(indent); PUTS("\t");
+}
+
 /*
   this does not handle initialize
 
   mrb_value funname_1(int val, mrb_value __self__, mrb_value arg1) {
-    struct RClass *c = mrb_obj_class(mrb, __self__);
-    if (c == mrb_class_get(mrb, "FirstClass")) {
-      FirstClass_funname(__self__, arg1);
-    } else if (c == mrb_class_get(mrb, "SecondClass")) {
-      SecondClass_funname(__self__, arg1);
+    if (hpc_class_eq(__self__, Module)) {
+      result = Module_funname(__self__, arg1);
     } else {
-      mrb_funcall(mrb, __self__, "funname", 1, arg1);
+      switch (hpc_type_of(__self__)) {
+      case T_FirstClass:
+        if (mrb_float_p(arg1))
+          result = mrb_float_value(FirstClass_funname__c2(__self__, mrb_float(arg1)));
+        else
+          result = FirstClass_funname(__self__, arg1);
+        break;
+      case T_SecondClass:
+        result = SecondClass_funname(__self__, arg1);
+        break;
+      default:
+        result = mrb_funcall(mrb, __self__, "funname", 1, arg1);
+      }
     }
   }
  */
@@ -812,6 +2430,7 @@ put_multiplexers(hpc_codegen_context *c, HIR *map)
     HIR* elm = map->car;
     HIR* method = elm->car;
     HIR* classes = elm->cdr;
+    HIR *l;
     map = map->cdr;
 
     if (sym(method->car) == mrb->init_sym)
@@ -827,7 +2446,9 @@ put_multiplexers(hpc_codegen_context *c, HIR *map)
     }
 
     if (has_null_class(classes)) {
-      PUTS("\treturn ");
+      PUTS("\t");
+      put_speculation(c, 0, FALSE, method->car, arg_count, "__self__", "arg%d", "\t", "return ");
+      PUTS("return ");
       put_unique_function_name(c, 0, method->car);
       PUTS("(__self__");
       PUTS(arglist);
@@ -840,35 +2461,45 @@ put_multiplexers(hpc_codegen_context *c, HIR *map)
     PUTS("\tif (!val) ai = mrb_gc_arena_save(mrb);\n");
 
     PUTS("\tmrb_value result;\n");
-    PUTS("\tstruct RClass *c = mrb_obj_ptr(__self__)->c;\n");
-    while (classes) {
-      HIR * klass = classes->car;
-      HIR * name = klass->car;
-      int sdefp = (intptr_t)klass->cdr;
-
-      if (sdefp) {
-        PUTS("\tif (mrb_eql(mrb, __self__, ");
-        put_symbol(c, name);
-        PUTS(")) {\n");
-      } else {
-        PUTS("\tif (c == (struct RClass *)mrb_obj_ptr(");
-        put_symbol(c, name);
-        PUTS(")) {\n");
-      }
-      PUTS("\t\tresult = ");
+    /* class methods are found by the receiver */
+    for (l = classes; l; l = l->cdr) {
+      HIR *name = l->car->car;
+      if (!(intptr_t)l->car->cdr || dup_entry_p(classes, l->car))
+        continue;
+      PUTS("\tif (hpc_class_eq(__self__, ");
+      put_symbol(c, name);
+      PUTS(")) {\n");
+      PUTS("\t\t");
+      put_speculation(c, name, TRUE, method->car, arg_count, "__self__", "arg%d", "\t\t", "result = ");
+      PUTS("result = ");
       put_unique_function_name(c, name, method->car);
       PUTS("(__self__");
       PUTS(arglist);
-      PUTS(");\n\t}");
-
-      PUTS(" else ");
-      next(classes);
+      PUTS(");\n\t} else ");
     }
 
+    /* instance methods by the type code of the receiver */
     PUTS("{\n");
-    sprintf(buf, "\t\tresult = mrb_funcall(mrb, __self__, \"%s\", %d%s);\n",
+    PUTS("\t\tswitch (hpc_type_of(__self__)) {\n");
+    for (l = classes; l; l = l->cdr) {
+      HIR *name = l->car->car;
+      if ((intptr_t)l->car->cdr || dup_entry_p(classes, l->car))
+        continue;
+      PUTS("\t\tcase "); put_class_code(c, sym(name)); PUTS(":\n");
+      PUTS("\t\t\t");
+      put_speculation(c, name, FALSE, method->car, arg_count, "__self__", "arg%d", "\t\t\t", "result = ");
+      PUTS("result = ");
+      put_unique_function_name(c, name, method->car);
+      PUTS("(__self__");
+      PUTS(arglist);
+      PUTS(");\n");
+      PUTS("\t\t\tbreak;\n");
+    }
+    PUTS("\t\tdefault:\n");
+    sprintf(buf, "\t\t\tresult = mrb_funcall(mrb, __self__, \"%s\", %d%s);\n",
             mrb_sym2name(mrb, sym(method->car)), arg_count, arglist);
     PUTS(buf);
+    PUTS("\t\t}\n");
     PUTS("\t}\n");
     PUTS("\tif (!val) mrb_gc_arena_restore(mrb,  ai);\n");
     PUTS("\treturn result;\n");
@@ -902,9 +2533,17 @@ put_fun_decls(hpc_codegen_context *c, HIR *hir, HIR *map)
 }
 
 void
-put_intern_table(hpc_codegen_context *c, HIR *names)
+put_intern_table(hpc_codegen_context *c, HIR *names, HIR *decls)
 {
   HIR *original_names = names;
+  HIR *d;
+
+  for (d = decls; d; d = d->cdr) {
+    if (vm_constant_p(c, d->car)) {
+      put_vardecl(c, d->car->cdr);
+      PUTS(";\n");
+    }
+  }
   while (names) {
     HIR * var = names->car;
     const char * name = mrb_sym2name(c->mrb, sym(var->cdr));
@@ -943,10 +2582,20 @@ put_intern_table(hpc_codegen_context *c, HIR *names)
 
     names = names->cdr;
   }
+  for (d = decls; d; d = d->cdr) {
+    if (vm_constant_p(c, d->car)) {
+      const char *name = mrb_sym2name(c->mrb, sym(CADDR(d->car)));
+      PUTS("\t"); PUTS(name);
+      PUTS(" = mrb_const_get(mrb, mrb_obj_value(mrb->object_class), mrb_intern(mrb, \"");
+      PUTS(name); PUTS("\"));\n");
+    }
+  }
+  if (c->hpc->vm_irep >= 0)
+    PUTS("\thpc_vm_init(mrb);\n");
   PUTS("}\n");
 }
 
-HIR *
+static HIR *
 lookup_map(HIR *map, mrb_sym sym, int arg_count)
 {
   while (map) {
@@ -959,6 +2608,68 @@ lookup_map(HIR *map, mrb_sym sym, int arg_count)
   return NULL;
 }
 
+/*
+  Output:
+    cName *sval;
+    Data_Make_Struct(mrb, klass, cName, &hpc_data_type, sval, data);
+    sval->type = T_Name;
+    obj = mrb_obj_value(data);
+  Fields of mrb_value are nil (zero) until assigned.
+ */
+static void
+put_alloc(hpc_codegen_context *c, mrb_sym name, const char *klass)
+{
+  PUTS_INDENT; put_class_type(c, name); PUTS(" *sval;\n");
+  PUTS_INDENT; PUTS("Data_Make_Struct(mrb, "); PUTS(klass); PUTS(", ");
+  put_class_type(c, name); PUTS(", ");
+  PUTS("&hpc_data_type, sval, data);\n");
+  PUTS_INDENT; PUTS("sval->type = "); put_class_code(c, name); PUTS(";\n");
+  PUTS_INDENT; PUTS("obj = mrb_obj_value(data);\n");
+}
+
+/* mrb_value Class_new__cN(mrb_value __self__, params...) */
+static void
+put_new_decl(hpc_codegen_context *c, hpc_class *class, HIR *decl)
+{
+  HIR *params = CADDDDR(decl);
+
+  PUTS("static mrb_value\n");
+  put_new_name(c, class, decl);
+  PUTS("(");
+  while (params) {
+    put_decl(c, params->car);
+    params = params->cdr;
+    if (params) {
+      PUTS(", ");
+    }
+  }
+  PUTS(")");
+}
+
+/* new calling the clone of initialize */
+static void
+put_new_clone(hpc_codegen_context *c, hpc_class *class, HIR *decl)
+{
+  HIR *params = CADDDDR(decl)->cdr;
+
+  put_new_decl(c, class, decl);
+  PUTS("\n{\n");
+  INDENT_PP;
+  PUTS_INDENT; PUTS("mrb_value obj;\n");
+  PUTS_INDENT; PUTS("struct RData * data;\n");
+  put_alloc(c, class->name, "mrb_class_ptr(__self__)");
+  PUTS_INDENT; put_fundecl_name(c, class, decl); PUTS("(obj");
+  while (params) {
+    PUTS(", ");
+    put_var(c, CADDR(params->car));
+    params = params->cdr;
+  }
+  PUTS(");\n");
+  PUTS_INDENT; PUTS("return obj;\n");
+  INDENT_MM;
+  PUTS("}\n\n");
+}
+
 void
 put_new_decls(hpc_codegen_context *c, HIR *map, int max_arg)
 {
@@ -1004,12 +2715,7 @@ put_new_bodies(hpc_codegen_context *c, HIR *map, int max_arg)
       PUTS(")) {\n");
       INDENT_PP;
 
-      PUTS_INDENT; put_class_type(c, name); PUTS(" *sval;\n");
-      PUTS_INDENT; PUTS("Data_Make_Struct(mrb, c, ");
-      put_class_type(c, name); PUTS(", ");
-      PUTS("&hpc_data_type, sval, data);\n");
-      PUTS_INDENT; PUTS("sval->type = "); put_class_code(c, name); PUTS(";\n");
-      PUTS_INDENT; PUTS("obj = mrb_obj_value(data);\n");
+      put_alloc(c, name, "c");
       PUTS_INDENT;
       put_unique_function_name(c, hirsym(name), (HIR *)(intptr_t)c->mrb->init_sym);
       PUTS("(obj");
@@ -1022,7 +2728,14 @@ put_new_bodies(hpc_codegen_context *c, HIR *map, int max_arg)
     }
 
     PUTS("{\n");
-    PUTS("\t\tobj = mrb_instance_new(mrb, __self__);\n");
+    /* go through Class#new so that initialize receives the arguments */
+    if (arg_count > 0) {
+      PUTS("\t\tmrb_value argv[] = { "); PUTS(arglist + 2); PUTS(" };\n");
+      PUTS("\t\tobj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, \"new\"), ");
+      put_int(c, arg_count); PUTS(", argv);\n");
+    } else {
+      PUTS("\t\tobj = mrb_funcall_argv(mrb, __self__, mrb_intern(mrb, \"new\"), 0, NULL);\n");
+    }
     PUTS("\t}\n");
     PUTS("\treturn obj;\n");
     INDENT_MM;
@@ -1030,6 +2743,17 @@ put_new_bodies(hpc_codegen_context *c, HIR *map, int max_arg)
   }
 }
 
+/* an ivar always of Fixnum or Float is stored unboxed */
+static void
+put_ivar_decl(hpc_codegen_context *c, HIR *ivar)
+{
+  HIR type = { 0 };
+
+  type.car = (HIR *)(intptr_t)hpc_lat_kind(c->mrb, ivar->lat);
+  PUTS("\t"); put_type(c, &type); PUTS(" ");
+  put_ivar_name(c, ivar->cdr); PUTS(";\n");
+}
+
 void
 put_class_decls(hpc_codegen_context *c, HIR* classes)
 {
@@ -1049,22 +2773,17 @@ put_class_decls(hpc_codegen_context *c, HIR* classes)
 
     PUTS("typedef struct {\n");
     PUTS("\tint type;\n");
-    if (ivs)
-      PUTS("\tmrb_value ");
     while (ivs) {
-      const char * name = mrb_sym2name(c->mrb, sym(ivs->car->cdr));
-      name += 1;                /* skip @ */
-      PUTS(name);
+      put_ivar_decl(c, ivs->car);
       next(ivs);
-      if (ivs) {
-        PUTS(", ");
-      } else {
-        PUTS(";\n");
-      }
     }
     PUTS("} "); put_class_type(c, class->name); PUTS(";\n");
     while(cvs) {
-      PUTS("mrb_value ");
+      HIR type = { 0 };
+
+      /* a number is stored natively */
+      type.car = (HIR *)(intptr_t)hpc_lat_kind(c->mrb, cvs->car->lat);
+      put_type(c, &type); PUTS(" ");
       put_cvar(c, cvs->car->cdr);
       PUTS(";\n");
       next(cvs);
@@ -1074,6 +2793,49 @@ put_class_decls(hpc_codegen_context *c, HIR* classes)
   }
 }
 
+/*
+  Output:
+    static void
+    hpc_mark(mrb_state *mrb, void *p)
+    {
+      switch (*(int *)p) {
+      case T_Name:
+        mrb_gc_mark_value(mrb, ((cName *)p)->field);
+        break;
+      }
+    }
+  The GC marks the boxed fields of instances of the compiled classes.
+ */
+void
+put_mark(hpc_codegen_context *c, HIR* classes)
+{
+  PUTS("static void\n");
+  PUTS("hpc_mark(mrb_state *mrb, void *p)\n");
+  PUTS("{\n");
+  PUTS("\tswitch (*(int *)p) {\n");
+  for (; classes; classes = classes->cdr) {
+    hpc_class *class = (hpc_class*)classes->car;
+    HIR *ivs;
+    int n = 0;
+
+    if (!class->name)
+      continue;
+    for (ivs = class->ivs; ivs; ivs = ivs->cdr) {
+      if (!boxed_field_p(c, ivs->car))
+        continue;
+      if (n++ == 0) {
+        PUTS("\tcase "); put_class_code(c, class->name); PUTS(":\n");
+      }
+      PUTS("\t\tmrb_gc_mark_value(mrb, (("); put_class_type(c, class->name);
+      PUTS(" *)p)->"); put_ivar_name(c, ivs->car->cdr); PUTS(");\n");
+    }
+    if (n)
+      PUTS("\t\tbreak;\n");
+  }
+  PUTS("\t}\n");
+  PUTS("}\n\n");
+}
+
 void
 put_class_init_decls(hpc_codegen_context *c, HIR* classes)
 {
@@ -1112,10 +2874,19 @@ put_class_method_decls(hpc_codegen_context *c, HIR *classes)
   while (classes) {
     hpc_class *class = (hpc_class *)classes->car;
     HIR *methods = class->methods;
+    HIR *clones = class->clones;
     while (methods) {
       put_fundecl_decl(c, class, methods->car); PUTS(";\n");
       next(methods);
     }
+    while (clones) {
+      HIR *fundecl = ((hpc_clone *)clones->car)->fundecl;
+      put_fundecl_decl(c, class, fundecl); PUTS(";\n");
+      if (initialize_clone_p(c, class, fundecl)) {
+        put_new_decl(c, class, fundecl); PUTS(";\n");
+      }
+      next(clones);
+    }
     next(classes);
   }
 }
@@ -1126,11 +2897,19 @@ put_class_methods(hpc_codegen_context *c, HIR *classes)
   while (classes) {
     hpc_class *class = (hpc_class *)classes->car;
     HIR *methods = class->methods;
+    HIR *clones = class->clones;
     c->current_class = class;
     while (methods) {
       put_fundecl(c, class, methods->car);
       next(methods);
     }
+    while (clones) {
+      HIR *fundecl = ((hpc_clone *)clones->car)->fundecl;
+      put_fundecl(c, class, fundecl);
+      if (initialize_clone_p(c, class, fundecl))
+        put_new_clone(c, class, fundecl);
+      next(clones);
+    }
     c->current_class = NULL;
     next(classes);
   }
@@ -1163,6 +2942,7 @@ construct_function_map(hpc_state *p)
 {
   HIR *map = 0;
   HIR *classes = p->classes;
+  HIR *calls;
 
   while (classes) {
     HIR *methods = ((hpc_class*)classes->car)->methods;
@@ -1172,10 +2952,182 @@ construct_function_map(hpc_state *p)
     }
     next(classes);
   }
+  /* methods left to the VM are called by mrb_funcall in the multiplexers */
+  for (calls = p->vm_calls; calls; calls = calls->cdr) {
+    if (!lookup_map(map, sym(calls->car->car), (intptr_t)calls->car->cdr))
+      push(map, cons(calls->car, 0));
+  }
 
   return map;
 }
 
+/*
+  mrb_value Class_method__vm(mrb_state *mrb, mrb_value self)
+  registered to the VM so that the methods left to it can call the
+  compiled method.  A method which yields is given the block of the VM
+  through hpc_vm_block.
+ */
+static void
+put_vm_wrapper(hpc_codegen_context *c, hpc_class *class, HIR *decl)
+{
+  char buf[256];
+  int sdefp = (intptr_t)decl->cdr->car;
+  int argc = length(CADDDDR(decl)) - 1, i;
+  int yieldp = hpc_calls_p(decl->cdr->cdr->cdr->cdr->cdr->car,
+                           mrb_intern_cstr(c->mrb, "hpc_yield"));
+
+  PUTS("static mrb_value\n");
+  put_fundecl_name(c, class->name ? class : NULL, decl);
+  PUTS("__vm(mrb_state *mrb, mrb_value self)\n{\n");
+  PUTS("\tmrb_value *argv;\n");
+  PUTS("\tint argc;\n");
+  if (yieldp) {
+    PUTS("\tmrb_value blk;\n\n");
+    PUTS("\tmrb_get_args(mrb, \"*&\", &argv, &argc, &blk);\n");
+  }
+  else {
+    PUTS("\n\tmrb_get_args(mrb, \"*\", &argv, &argc);\n");
+  }
+  sprintf(buf, "\tif (argc != %d)\n", argc);
+  PUTS(buf);
+  sprintf(buf, "\t\tmrb_raisef(mrb, E_ARGUMENT_ERROR, \"wrong number of arguments (%%S for %d)\", mrb_fixnum_value(argc));\n", argc);
+  PUTS(buf);
+  if (class->name && !sdefp) {
+    /* the instance has to be allocated by the compiled code */
+    PUTS("\tif (hpc_type_of(self) != "); put_class_code(c, class->name); PUTS(")\n");
+    PUTS("\t\tmrb_raise(mrb, E_TYPE_ERROR, \"not allocated by the compiled code\");\n");
+  }
+  if (yieldp)
+    PUTS("\thpc_vm_block = blk;\n");        /* taken by the method (see builtin.c) */
+  PUTS("\t");
+  put_speculation(c, hirsym(class->name), sdefp, CADDDR(decl), argc, "self", "argv[%d]", "\t", "return ");
+  PUTS("return ");
+  put_fundecl_name(c, class->name ? class : NULL, decl);
+  PUTS("(self");
+  for (i = 0; i < argc; i++) {
+    sprintf(buf, ", argv[%d]", i);
+    PUTS(buf);
+  }
+  PUTS(");\n}\n\n");
+}
+
+/*
+  The methods left to the VM (see hpc_vm_program in compile.c) are loaded
+  from hpc_vm_irep.  Compiled methods are registered to the VM, and new
+  of a class with a compiled initialize allocates the compiled instance.
+ */
+static void
+put_vm_init(hpc_codegen_context *c, HIR *classes)
+{
+  char buf[256];
+  HIR *l, *methods;
+
+  /* the function before may not end the line */
+  PUTS("\n");
+  if (mrb_dump_irep_cfunc(c->mrb, c->hpc->vm_irep, 1, c->wfp, "hpc_vm_irep") != MRB_DUMP_OK)
+    fprintf(stderr, "hpcmrb error: cannot dump the methods left to the VM\n");
+  PUTS("\n");
+
+  for (l = classes; l; l = l->cdr) {
+    hpc_class *class = (hpc_class *)l->car;
+    int init_argc = -1;
+
+    for (methods = class->methods; methods; methods = methods->cdr) {
+      HIR *decl = methods->car;
+
+      if (class->name && !decl->cdr->car && sym(CADDDR(decl)) == c->mrb->init_sym) {
+        init_argc = length(CADDDDR(decl)) - 1;
+        continue;
+      }
+      put_vm_wrapper(c, class, decl);
+    }
+    if (init_argc >= 0 && init_argc < 4) {
+      PUTS("static mrb_value\n");
+      put_symbol(c, hirsym(class->name));
+      PUTS("_new__vm(mrb_state *mrb, mrb_value self)\n{\n");
+      PUTS("\tmrb_value *argv;\n");
+      PUTS("\tint argc;\n\n");
+      PUTS("\tmrb_get_args(mrb, \"*\", &argv, &argc);\n");
+      sprintf(buf, "\tif (argc != %d)\n", init_argc);
+      PUTS(buf);
+      sprintf(buf, "\t\tmrb_raisef(mrb, E_ARGUMENT_ERROR, \"wrong number of arguments (%%S for %d)\", mrb_fixnum_value(argc));\n", init_argc);
+      PUTS(buf);
+      sprintf(buf, "\treturn new_%d(0, self", init_argc);
+      PUTS(buf);
+      for (int i = 0; i < init_argc; i++) {
+        sprintf(buf, ", argv[%d]", i);
+        PUTS(buf);
+      }
+      PUTS(");\n}\n\n");
+    }
+  }
+
+  if (c->hpc->vm_main_irep >= 0) {
+    /* run at the end of compiled_main, after the classes are set up */
+    PUTS("static size_t hpc_vm_base;\n\n");
+    PUTS("static void\nhpc_vm_main(mrb_state *mrb)\n{\n");
+    sprintf(buf, "\tmrb_run(mrb, mrb_proc_new(mrb, mrb->irep[hpc_vm_base + %d]), mrb_top_self(mrb));\n",
+            c->hpc->vm_main_irep);
+    PUTS(buf);
+    PUTS("\tif (mrb->exc)\n");
+    PUTS("\t\tmrb_exc_raise(mrb, mrb_obj_value(mrb->exc));\n");
+    PUTS("}\n\n");
+  }
+
+  PUTS("static void\nhpc_vm_init(mrb_state *mrb)\n{\n");
+  PUTS("\tstruct RClass *c;\n");
+  PUTS("\tsize_t n = mrb->irep_len;\n\n");
+  /* not mrb_load_irep, which runs irep[n + the index at the dump] */
+  PUTS("\tif (mrb_read_irep(mrb, hpc_vm_irep) < 0) {\n");
+  PUTS("\t\tfputs(\"cannot load the methods left to the VM\\n\", stderr);\n");
+  PUTS("\t\texit(EXIT_FAILURE);\n");
+  PUTS("\t}\n");
+  if (c->hpc->vm_main_irep >= 0)
+    PUTS("\thpc_vm_base = n;\n");
+  PUTS("\tmrb_run(mrb, mrb_proc_new(mrb, mrb->irep[n]), mrb_top_self(mrb));\n");
+  PUTS("\tif (mrb->exc) {\n");
+  PUTS("\t\tmrb_p(mrb, mrb_obj_value(mrb->exc));\n");
+  PUTS("\t\texit(EXIT_FAILURE);\n");
+  PUTS("\t}\n");
+  for (l = classes; l; l = l->cdr) {
+    hpc_class *class = (hpc_class *)l->car;
+    if (!class->name) {
+      PUTS("\tc = mrb->object_class;\n");
+    }
+    else {
+      const char *name = mrb_sym2name(c->mrb, class->name);
+      sprintf(buf, "\tif (mrb_const_defined(mrb, mrb_obj_value(mrb->object_class), mrb_intern(mrb, \"%s\")))\n", name);
+      PUTS(buf);
+      sprintf(buf, "\t\tc = mrb_class_ptr(mrb_const_get(mrb, mrb_obj_value(mrb->object_class), mrb_intern(mrb, \"%s\")));\n", name);
+      PUTS(buf);
+      if (class->modulep)
+        sprintf(buf, "\telse\n\t\tc = mrb_define_module(mrb, \"%s\");\n", name);
+      else
+        sprintf(buf, "\telse\n\t\tc = mrb_define_class(mrb, \"%s\", mrb->object_class);\n", name);
+      PUTS(buf);
+    }
+    for (methods = class->methods; methods; methods = methods->cdr) {
+      HIR *decl = methods->car;
+      int sdefp = (intptr_t)decl->cdr->car;
+
+      if (class->name && !sdefp && sym(CADDDR(decl)) == c->mrb->init_sym) {
+        if (length(CADDDDR(decl)) - 1 < 4) {
+          PUTS("\tmrb_define_class_method(mrb, c, \"new\", ");
+          put_symbol(c, hirsym(class->name));
+          PUTS("_new__vm, ARGS_ANY());\n");
+        }
+        continue;
+      }
+      PUTS(sdefp ? "\tmrb_define_class_method(mrb, c, \"" : "\tmrb_define_method(mrb, c, \"");
+      PUTS(mrb_sym2name(c->mrb, sym(CADDDR(decl))));
+      PUTS("\", ");
+      put_fundecl_name(c, class->name ? class : NULL, decl);
+      PUTS("__vm, ARGS_ANY());\n");
+    }
+  }
+  PUTS("}\n\n");
+}
+
 mrb_value
 hpc_generate_code(hpc_state *s, FILE *wfp, HIR *hir, mrbc_context *__c)
 {
@@ -1190,12 +3142,23 @@ hpc_generate_code(hpc_state *s, FILE *wfp, HIR *hir, mrbc_context *__c)
   c.current_class = NULL;
 
   function_map = construct_function_map(s);
+  c.function_map = function_map;
+  c.hpc = s;
+  c.parallel = FALSE;
+  c.nframes = c.loop_nframes = c.frame_id = 0;
+  c.param_roots = c.body = NULL;
+  c.globals = hir;
 
   put_header(&c);
   put_class_decls(&c, s->classes);
+  put_mark(&c, s->classes);
   put_fun_decls(&c, hir, function_map);
+  if (s->vm_irep >= 0)
+    fputs("static void\nhpc_vm_init(mrb_state *mrb);\n\n", wfp);
+  if (s->vm_main_irep >= 0)
+    fputs("static void\nhpc_vm_main(mrb_state *mrb);\n\n", wfp);
   put_class_method_decls(&c, s->classes);
-  put_intern_table(&c, s->intern_names);
+  put_intern_table(&c, s->intern_names, hir);
   put_new_decls(&c, function_map, 4);
   put_class_init_decls(&c, s->classes);
   while (hir) {
@@ -1206,6 +3169,8 @@ hpc_generate_code(hpc_state *s, FILE *wfp, HIR *hir, mrbc_context *__c)
   put_class_inits(&c, s->classes);
   put_class_methods(&c, s->classes);
   put_multiplexers(&c, function_map);
+  if (s->vm_irep >= 0)
+    put_vm_init(&c, s->classes);
 
   return mrb_fixnum_value(0);
 }
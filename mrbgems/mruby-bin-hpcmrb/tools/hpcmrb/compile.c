@@ -1,4 +1,5 @@
 #include <ctype.h>
+#include <math.h>
 #include <string.h>
 #include <stdlib.h>
 #include "hpcmrb.h"
@@ -8,7 +9,9 @@
 #include "mruby/proc.h"
 #include "mruby/string.h"
 #include "mruby/variable.h"
+#include "mruby/irep.h"
 #include "node.h"
+#include "opcode.h"
 
 /* Lattice for abstract intepreration */
 
@@ -39,6 +42,8 @@ static struct RClass *lat_class;
 
 static mrb_value lat_unknown;
 static mrb_value lat_dynamic;
+static mrb_value lat_pending;   /* LAT_UNKNOWN assigned to a variable: the value
+                                   depends on lattices not inferred yet */
 
 static int lat_equal(mrb_state*, mrb_value, mrb_value);
 
@@ -57,11 +62,14 @@ lat_new(mrb_state *mrb, enum lat_type type)
 {
   struct lattice *lat;
   struct RData *data;
+  int ai = mrb_gc_arena_save(mrb);
   Data_Make_Struct(mrb, lat_class, struct lattice, &lat_data_type, lat, data);
   lat->type = type;
   lat->value = mrb_nil_value();
   if (type == LAT_SET)
     lat->elems = mrb_ary_new(mrb);
+  /* GC is disabled while compiling; keep lattices out of the arena */
+  mrb_gc_arena_restore(mrb, ai);
   return mrb_obj_value(data);
 }
 
@@ -139,9 +147,8 @@ lat_equal(mrb_state *mrb, mrb_value lat1, mrb_value lat2)
       return mrb_equal(mrb, lat1, lat2);
   if (LAT(lat1)->type != LAT(lat2)->type)
     return FALSE;
-
-  hpc_assert(LAT_HAS_TYPE(mrb, lat1, LAT_SET));
-  hpc_assert(LAT_HAS_TYPE(mrb, lat2, LAT_SET));
+  if (LAT(lat1)->type != LAT_SET)
+    return TRUE;                /* lat_unknown and lat_pending */
 
   /* TODO: check instance variables */
   {
@@ -299,6 +306,15 @@ lat_set_new1(mrb_state *mrb, mrb_value val)
   return lat;
 }
 
+/* the set of instances of klass */
+static mrb_value
+lat_set_new_class(mrb_state *mrb, mrb_value klass)
+{
+  mrb_value lat = lat_new(mrb, LAT_SET);
+  lat_set_add_const(mrb, lat, klass);
+  return lat;
+}
+
 static mrb_value
 lat_set_new2(mrb_state *mrb, mrb_value val1, mrb_value val2)
 {
@@ -340,8 +356,10 @@ lat_clone(mrb_state *mrb, mrb_value lat)
       return lat;
     case LAT_SET:
       {
+        int ai = mrb_gc_arena_save(mrb);
         mrb_value new_lat = lat_new(mrb, LAT_SET);
         LAT(new_lat)->elems = mrb_obj_clone(mrb, LAT(lat)->elems);
+        mrb_gc_arena_restore(mrb, ai);
         return new_lat;
       }
     default:
@@ -397,6 +415,139 @@ lat_join(mrb_state *mrb, mrb_value val1, mrb_value val2)
   }
 }
 
+/* queries */
+
+/* the class all values of lat belong to, or NULL if there is no such class */
+static struct RClass*
+lat_class_of(mrb_state *mrb, mrb_value lat)
+{
+  switch (LAT_TYPE(mrb, lat)) {
+    case LAT_CONST:
+      return mrb_obj_class(mrb, lat);
+    case LAT_SET:
+      if (RARRAY_LEN(LAT(lat)->elems) == 1)
+        return mrb_class_ptr(RARRAY_PTR(LAT(lat)->elems)[0]);
+      return NULL;
+    default:
+      return NULL;
+  }
+}
+
+/* check every value of lat is an instance of c1 or c2 */
+static int
+lat_within2(mrb_state *mrb, mrb_value lat, struct RClass *c1, struct RClass *c2)
+{
+  switch (LAT_TYPE(mrb, lat)) {
+    case LAT_CONST:
+      {
+        struct RClass *c = mrb_obj_class(mrb, lat);
+        return c == c1 || c == c2;
+      }
+    case LAT_SET:
+      {
+        mrb_value *ary = RARRAY_PTR(LAT(lat)->elems);
+        int i, len = RARRAY_LEN(LAT(lat)->elems);
+        for (i = 0; i < len; i++) {
+          struct RClass *c = mrb_class_ptr(ary[i]);
+          if (c != c1 && c != c2)
+            return FALSE;
+        }
+        return len > 0;
+      }
+    default:
+      return FALSE;
+  }
+}
+
+enum lat_num {
+  LNUM_NONE,    /* not (only) a number */
+  LNUM_INT,     /* Fixnum */
+  LNUM_FLOAT,   /* Float */
+  LNUM_MIXED,   /* Fixnum or Float */
+};
+
+static enum lat_num
+lat_num(mrb_state *mrb, mrb_value lat)
+{
+  struct RClass *c = lat_class_of(mrb, lat);
+
+  if (c == mrb->fixnum_class)
+    return LNUM_INT;
+  if (c == mrb->float_class)
+    return LNUM_FLOAT;
+  if (lat_within2(mrb, lat, mrb->fixnum_class, mrb->float_class))
+    return LNUM_MIXED;
+  return LNUM_NONE;
+}
+
+enum hir_type_kind
+hpc_lat_kind(mrb_state *mrb, mrb_value lat)
+{
+  switch (lat_num(mrb, lat)) {
+    case LNUM_INT:
+      return HTYPE_INT;
+    case LNUM_FLOAT:
+      return HTYPE_FLOAT;
+    default:
+      return HTYPE_VALUE;
+  }
+}
+
+int
+hpc_lat_numeric_p(mrb_state *mrb, mrb_value lat)
+{
+  return lat_num(mrb, lat) != LNUM_NONE;
+}
+
+int
+hpc_lat_const_p(mrb_state *mrb, mrb_value lat)
+{
+  return LAT_TYPE(mrb, lat) == LAT_CONST;
+}
+
+struct RClass*
+hpc_lat_class_of(mrb_state *mrb, mrb_value lat)
+{
+  return lat_class_of(mrb, lat);
+}
+
+mrb_value
+hpc_lat_set_of(mrb_state *mrb, mrb_value val)
+{
+  return lat_set_new1(mrb, val);
+}
+
+/* every value of lat is not an object the GC has to mark */
+int
+hpc_lat_immediate_p(mrb_state *mrb, mrb_value lat)
+{
+  mrb_value *ary;
+  int i, len;
+
+  switch (LAT_TYPE(mrb, lat)) {
+    case LAT_CONST:
+      return mrb_type(lat) < MRB_TT_OBJECT;
+    case LAT_SET:
+      ary = RARRAY_PTR(LAT(lat)->elems);
+      len = RARRAY_LEN(LAT(lat)->elems);
+      for (i = 0; i < len; i++) {
+        struct RClass *c = mrb_class_ptr(ary[i]);
+        if (c != mrb->fixnum_class && c != mrb->float_class && c != mrb->nil_class &&
+            c != mrb->true_class && c != mrb->false_class && c != mrb->symbol_class)
+          return FALSE;
+      }
+      return TRUE;
+    default:
+      return FALSE;
+  }
+}
+
+mrb_value
+hpc_lat_dynamic(void)
+{
+  return lat_dynamic;
+}
+
 /* Compiler main */
 
 typedef mrb_ast_node node;
@@ -414,6 +565,16 @@ compiler_palloc(hpc_state *p, size_t size)
   return m;
 }
 
+/* literals in AST live in the parser pool, which is freed before codegen */
+static char*
+compiler_strndup(hpc_state *p, const char *s, size_t len)
+{
+  char *b = (char *)compiler_palloc(p, len+1);
+  memcpy(b, s, len);
+  b[len] = '\0';
+  return b;
+}
+
 static void
 cons_free_gen(hpc_state *p, HIR *cons)
 {
@@ -482,7 +643,7 @@ attrsym(hpc_state *p, mrb_sym a)
   char *name2;
 
   name = mrb_sym2name_len(p->mrb, a, &len);
-  name2 = (char *)compiler_palloc(p, len+1);
+  name2 = (char *)compiler_palloc(p, len+2);
   memcpy(name2, name, len);
   name2[len] = '=';
   name2[len+1] = '\0';
@@ -513,30 +674,47 @@ hpc_state_new(mrb_state *mrb)
   *p = hpc_state_zero;
   p->mrb = mrb;
   p->pool = pool;
+  p->vm_irep = -1;
+  p->vm_main_irep = -1;
   return p;
 }
 
+/*
+  A method yielding to the block is inlined at the call-site (see
+  typing_inline_call)
+ */
+struct hpc_inline {
+  struct hpc_inline *prev;      /* the call the method is inlined in */
+  struct scope *caller;         /* scope the block is typed in */
+  node *blk;
+  HIR *lvars;                   /* variables made while typing the method */
+  HIR *yields;                  /* bodies of the block, which are not renamed */
+  int depth;
+};
+
 static HIR*
 new_lvar(hpc_state *p, mrb_sym sym, mrb_value lat)
 {
   HIR *var = cons((HIR*)HIR_LVAR, hirsym(sym));
   var->lat = lat;
+  if (p->inlining)
+    push(p->inlining->lvars, var);      /* renamed later */
   return var;
 }
 
 static HIR*
-new_ivar(hpc_state *p, mrb_sym sym)
+new_ivar(hpc_state *p, mrb_sym sym, mrb_value lat)
 {
   HIR *var = cons((HIR*)HIR_IVAR, hirsym(sym));
-  var->lat = lat_unknown;
+  var->lat = lat;
   return var;
 }
 
 static HIR*
-new_cvar(hpc_state *p, mrb_sym sym)
+new_cvar(hpc_state *p, mrb_sym sym, mrb_value lat)
 {
   HIR *var = cons((HIR*)HIR_CVAR, hirsym(sym));
-  var->lat = lat_unknown;
+  var->lat = lat;
   return var;
 }
 
@@ -556,16 +734,23 @@ new_gvar(hpc_state *p, mrb_sym sym, mrb_value lat)
   return var;
 }
 
+static HIR *infer_type(hpc_state *p, mrb_value lat);
+
+/* the lattice of a declaration tells codegen if the GC has to see it */
 static HIR*
-new_lvardecl(hpc_state *p, HIR *type, mrb_sym sym, HIR *val)
+new_lvardecl(hpc_state *p, mrb_value lat, mrb_sym sym, HIR *val)
 {
-  return list4((HIR*)HIR_LVARDECL, type, hirsym(sym), val);
+  HIR *decl = list4((HIR*)HIR_LVARDECL, infer_type(p, lat), hirsym(sym), val);
+  decl->lat = lat;
+  return decl;
 }
 
 static HIR*
-new_gvardecl(hpc_state *p, HIR *type, mrb_sym sym, HIR *val)
+new_gvardecl(hpc_state *p, mrb_value lat, mrb_sym sym, HIR *val)
 {
-  return list4((HIR*)HIR_GVARDECL, type, hirsym(sym), val);
+  HIR *decl = list4((HIR*)HIR_GVARDECL, infer_type(p, lat), hirsym(sym), val);
+  decl->lat = lat;
+  return decl;
 }
 
 static HIR*
@@ -627,6 +812,19 @@ new_float(hpc_state *p, char *text, int base, double val)
   return lit;
 }
 
+/* a literal of the number */
+static HIR*
+new_num_const(hpc_state *p, mrb_value num)
+{
+  char *lit;
+
+  if (mrb_fixnum_p(num))
+    return new_int_const(p, mrb_fixnum(num));
+  lit = (char *)compiler_palloc(p, 32);
+  sprintf(lit, "%.17g", (double)mrb_float(num));
+  return new_float(p, lit, 10, mrb_float(num));
+}
+
 static HIR*
 new_ifelse(hpc_state *p, HIR* cond, HIR* ifthen, HIR* ifelse)
 {
@@ -664,7 +862,11 @@ static HIR*
 new_assign(hpc_state *p, HIR *lhs, HIR *rhs)
 {
   HIR *hir = list3((HIR*)HIR_ASSIGN, lhs, rhs);
-  lhs->lat = lat_join(p->mrb, lhs->lat, rhs->lat);
+  if (LAT_HAS_TYPE(p->mrb, lhs->lat, LAT_UNKNOWN) &&
+      LAT_HAS_TYPE(p->mrb, rhs->lat, LAT_UNKNOWN))
+    lhs->lat = lat_pending;     /* not nil when read */
+  else
+    lhs->lat = lat_join(p->mrb, lhs->lat, rhs->lat);
   hir->lat = rhs->lat;
   return hir;
 }
@@ -750,7 +952,7 @@ enum looptype {
   LOOP_FOR,
   LOOP_BEGIN,
   LOOP_RESCUE,
-} type;
+};
 
 struct loopinfo {
   enum looptype type;
@@ -823,6 +1025,20 @@ hpc_error(hpc_scope *s, const char *message)
   longjmp(s->jmp, 1);
 }
 
+/*
+  A construct hpcmrb does not compile.  The method being typed is left to
+  the VM (see try_typing_method), and so are the top level statements
+  (see typing_program); elsewhere, e.g. in class bodies, it is an error.
+ */
+static void
+unsupported(hpc_scope *s)
+{
+  if (s->hpc->fallback)
+    longjmp(*s->hpc->fallback, 1);
+  fprintf(stderr, "hpcmrb error:%d: not supported outside methods\n", s->lineno);
+  exit(EXIT_FAILURE);
+}
+
 static double
 readint_float(hpc_scope *s, const char *p, int base)
 {
@@ -904,8 +1120,10 @@ scope_new(hpc_state *p, hpc_scope *prev, HIR *lv, hpc_class *class, int inherit_
   s->mrb = p->mrb;
   s->mpool = pool;
 
+  /* self of a class body is the class; blocks share self with the outer scope */
   s->current_self = new_lvar(p, mrb_intern_cstr(p->mrb, "__self__"),
-      mrb_top_self(p->mrb));
+      (class && class->name) ? lat_dynamic :
+      prev ? prev->current_self->lat : mrb_top_self(p->mrb));
 
   if (class) {
     s->class = class;
@@ -1004,9 +1222,9 @@ join_scope(hpc_scope *s1, hpc_scope *s2)
     unknown2 = LAT_HAS_TYPE(s2->mrb, lat2, LAT_UNKNOWN);
 
     if (unknown1 != unknown2) {
-      if (unknown1)
+      if (unknown1 && !mrb_obj_eq(s1->mrb, lat1, lat_pending))
         lat1 = mrb_nil_value();
-      else
+      else if (unknown2 && !mrb_obj_eq(s2->mrb, lat2, lat_pending))
         lat2 = mrb_nil_value();
     }
 
@@ -1037,6 +1255,8 @@ hpc_top_class_new(hpc_state *p)
   return hpc_class_new(p, 0);
 }
 
+/* return 0 if no abstract interpreter is known;
+   the result of such a call is LAT_DYNAMIC */
 static struct RProc*
 search_abst_interp(mrb_state *mrb, struct RClass *klass, mrb_sym mid)
 {
@@ -1044,16 +1264,13 @@ search_abst_interp(mrb_state *mrb, struct RClass *klass, mrb_sym mid)
   m = mrb_method_search_vm(mrb, &klass, mid);
   if (!m) {
     /* TODO: emulate method_missing */
-    NOT_IMPLEMENTED();
+    return 0;
   }
   if (MRB_PROC_CFUNC_P(m)) {
-    m = get_interp(m);
-    if (!m)
-      mrb_raisef(mrb, E_NOTIMP_ERROR, "Abstract interpreter for %S",
-          mrb_symbol_value(mid));
-    return m;
+    return get_interp(m);
   } else {
-    NOT_IMPLEMENTED();
+    /* TODO: interpret methods written in Ruby */
+    return 0;
   }
 }
 
@@ -1062,7 +1279,14 @@ static HIR *typing(hpc_scope *s, node *tree);
 static HIR*
 infer_type(hpc_state *p, mrb_value lat)
 {
-  return value_type;
+  switch (hpc_lat_kind(p->mrb, lat)) {
+    case HTYPE_INT:
+      return int_type;
+    case HTYPE_FLOAT:
+      return float_type;
+    default:
+      return value_type;
+  }
 }
 
 static HIR*
@@ -1072,7 +1296,7 @@ lvs_to_decls(hpc_state *p, HIR *lvs)
 
   while (lvs) {
     mrb_sym sym = sym(lvs->car->cdr);
-    lv_decls = cons(new_lvardecl(p, infer_type(p, lvs->car->lat), sym, new_empty(p)), lv_decls);
+    lv_decls = cons(new_lvardecl(p, lvs->car->lat, sym, new_empty(p)), lv_decls);
     lvs = lvs->cdr;
   }
 
@@ -1101,16 +1325,252 @@ lookup_lvar(hpc_scope *s, mrb_sym sym)
   HIR* var = find_var_list(s->lv, sym);
   if (!var)
     NOT_REACHABLE();
+  /* reading a variable before assignment gives nil */
+  if (LAT_HAS_TYPE(s->mrb, var->lat, LAT_UNKNOWN) && !mrb_obj_eq(s->mrb, var->lat, lat_pending))
+    var->lat = mrb_nil_value();
   return var;
 }
 
+/*
+  Type profile
+
+  The classes of args and ivars observed by mruby --profile=file (see
+  mruby-bin-mruby) seed the assumed lattices instead of lat_unknown.  The
+  assumptions are still checked against the program, so a profile which
+  does not cover every run only costs passes of typing.
+ */
+
+enum profile_kind {
+  PROFILE_PARAM,
+  PROFILE_SPARAM,
+  PROFILE_IVAR,
+};
+
+static const char *const profile_kinds[] = { "param", "sparam", "ivar" };
+
+/* (((kind . class) . (name . index)) . vclasses) in entries; class 0 for Object */
+static HIR*
+profile_entry(HIR *entries, enum profile_kind kind, mrb_sym class_name, mrb_sym name, int index)
+{
+  HIR *l;
+
+  for (l = entries; l; l = l->cdr) {
+    HIR *key = l->car->car;
+    if ((intptr_t)key->car->car == kind && sym(key->car->cdr) == class_name &&
+        sym(key->cdr->car) == name && (intptr_t)key->cdr->cdr == index)
+      return l->car;
+  }
+  return 0;
+}
+
+int
+hpc_read_profile(hpc_state *p, FILE *fp)
+{
+  mrb_state *mrb = p->mrb;
+  char line[1024], kind[16], klass[256], name[256], vclass[256];
+  int lineno = 0;
+
+  while (fgets(line, sizeof(line), fp)) {
+    enum profile_kind k;
+    mrb_sym class_name;
+    int index = 0, n;
+    HIR *entry;
+
+    lineno++;
+    if (sscanf(line, "%15s", kind) != 1)
+      continue;
+    for (k = PROFILE_PARAM; k <= PROFILE_IVAR; k++) {
+      if (strcmp(kind, profile_kinds[k]) == 0)
+        break;
+    }
+    if (k == PROFILE_IVAR)
+      n = sscanf(line, "%*s %255s %255s %255s", klass, name, vclass) + 1;
+    else
+      n = sscanf(line, "%*s %255s %255s %d %255s", klass, name, &index, vclass);
+    if (k > PROFILE_IVAR || n != 4) {
+      fprintf(stderr, "hpcmrb error: profile:%d: broken entry\n", lineno);
+      return FALSE;
+    }
+    class_name = strcmp(klass, "Object") == 0 ? 0 : mrb_intern_cstr(mrb, klass);
+    entry = profile_entry(p->profile, k, class_name, mrb_intern_cstr(mrb, name), index);
+    if (!entry) {
+      entry = cons(cons(cons((HIR*)(intptr_t)k, hirsym(class_name)),
+                        cons(hirsym(mrb_intern_cstr(mrb, name)), (HIR*)(intptr_t)index)), 0);
+      push(p->profile, entry);
+    }
+    push(entry->cdr, hirsym(mrb_intern_cstr(mrb, vclass)));
+  }
+  return TRUE;
+}
+
+/* the lattice observed, or lat_unknown */
+static mrb_value
+profile_lat(hpc_state *p, enum profile_kind kind, mrb_sym class_name, mrb_sym name, int index)
+{
+  mrb_state *mrb = p->mrb;
+  mrb_value top = mrb_obj_value(mrb->object_class);
+  HIR *entry = profile_entry(p->profile, kind, class_name, name, index), *l;
+  mrb_value lat = lat_unknown;
+
+  if (!entry)
+    return lat_unknown;
+  for (l = entry->cdr; l; l = l->cdr) {
+    mrb_value klass;
+    /* a class defined later is added when assigned */
+    if (!mrb_const_defined(mrb, top, sym(l->car)))
+      continue;
+    klass = mrb_const_get(mrb, top, sym(l->car));
+    if (mrb_type(klass) == MRB_TT_CLASS)
+      lat = lat_join(mrb, lat, lat_set_new_class(mrb, klass));
+  }
+  return lat;
+}
+
+/*
+  Summaries of program files
+
+  hpcmrb -s writes a summary of each program file: the lattices of the
+  params of the methods and of the ivars of the classes defined in the
+  file, as the typing of the whole program ended with them.  When the
+  file is compiled again unchanged, its summary seeds the assumed
+  lattices like a profile, so the typing starts at the fixed point of
+  the last compilation instead of going up from lat_unknown:
+
+    param Point initialize 0 Float,Fixnum
+    sparam Rand next 0 =Rand
+    ivar Point @x Float
+    ivar Node @next dynamic
+
+  The assumptions are still checked against the program.  A seed can
+  only be wider than a fresh typing gives, when a caller in a changed
+  file no longer passes some classes; removing the summary drops it.
+ */
+
+/* a lattice of a summary, or lat_unknown if a class is not defined yet */
+static mrb_value
+read_summary_lat(hpc_state *p, const char *str)
+{
+  mrb_state *mrb = p->mrb;
+  mrb_value top = mrb_obj_value(mrb->object_class);
+  mrb_value lat = lat_unknown, klass;
+  const char *name = str, *end;
+
+  if (strcmp(str, "dynamic") == 0)
+    return lat_dynamic;
+  if (*str == '=')
+    name++;
+  for (; *name; name = *end ? end + 1 : end) {
+    mrb_sym class_name;
+
+    end = strchr(name, ',');
+    if (!end)
+      end = name + strlen(name);
+    class_name = mrb_intern2(mrb, name, end - name);
+    if (!mrb_const_defined(mrb, top, class_name))
+      return lat_unknown;
+    klass = mrb_const_get(mrb, top, class_name);
+    if (*str == '=') {
+      if (mrb_type(klass) != MRB_TT_CLASS && mrb_type(klass) != MRB_TT_MODULE)
+        return lat_unknown;
+      return klass;
+    }
+    if (mrb_type(klass) != MRB_TT_CLASS)
+      return lat_unknown;
+    lat = lat_join(mrb, lat, lat_set_new_class(mrb, klass));
+  }
+  return lat;
+}
+
+/* the lattice at the end of the last compilation, or lat_unknown */
+static mrb_value
+summary_lat(hpc_state *p, enum profile_kind kind, mrb_sym class_name, mrb_sym name, int index)
+{
+  HIR *entry = profile_entry(p->summary, kind, class_name, name, index), *l;
+  mrb_value lat = lat_unknown;
+
+  if (!entry)
+    return lat_unknown;
+  for (l = entry->cdr; l; l = l->cdr)
+    lat = lat_join(p->mrb, lat, read_summary_lat(p, (const char *)l->car));
+  return lat;
+}
+
+/* the seeds are joined if files define the same class */
+int
+hpc_read_summary(hpc_state *p, FILE *fp)
+{
+  mrb_state *mrb = p->mrb;
+  char line[1024], kind[16], klass[256], name[256], lat[512];
+  int lineno = 0;
+
+  while (fgets(line, sizeof(line), fp)) {
+    enum profile_kind k;
+    mrb_sym class_name;
+    int index = 0, n;
+    HIR *entry;
+
+    lineno++;
+    if (sscanf(line, "%15s", kind) != 1)
+      continue;
+    for (k = PROFILE_PARAM; k <= PROFILE_IVAR; k++) {
+      if (strcmp(kind, profile_kinds[k]) == 0)
+        break;
+    }
+    if (k == PROFILE_IVAR)
+      n = sscanf(line, "%*s %255s %255s %511s", klass, name, lat) + 1;
+    else
+      n = sscanf(line, "%*s %255s %255s %d %511s", klass, name, &index, lat);
+    if (k > PROFILE_IVAR || n != 4) {
+      fprintf(stderr, "hpcmrb error: summary:%d: broken entry\n", lineno);
+      return FALSE;
+    }
+    class_name = strcmp(klass, "Object") == 0 ? 0 : mrb_intern_cstr(mrb, klass);
+    entry = profile_entry(p->summary, k, class_name, mrb_intern_cstr(mrb, name), index);
+    if (!entry) {
+      entry = cons(cons(cons((HIR*)(intptr_t)k, hirsym(class_name)),
+                        cons(hirsym(mrb_intern_cstr(mrb, name)), (HIR*)(intptr_t)index)), 0);
+      push(p->summary, entry);
+    }
+    /* the classes are defined while typing */
+    push(entry->cdr, (HIR*)compiler_strndup(p, lat, strlen(lat)));
+  }
+  return TRUE;
+}
+
+/*
+  An instance variable can be assigned in any method, so its lattice
+  is assumed while typing the program, and the values assigned are
+  checked against it afterwards (see compile).  So is a class variable,
+  whose name does not conflict with ivars.
+  Returns (class_name . ivar) whose lat is the assumed lattice.
+ */
+static HIR*
+ivar_lat_entry(hpc_state *p, mrb_sym class_name, mrb_sym name)
+{
+  HIR *entries, *entry;
+
+  for (entries = p->ivar_lats; entries; entries = entries->cdr) {
+    entry = entries->car;
+    if (sym(entry->car) == class_name && sym(entry->cdr) == name)
+      return entry;
+  }
+  entry = cons(hirsym(class_name), hirsym(name));
+  if (p->lats_given_up)
+    entry->lat = lat_dynamic;
+  else
+    entry->lat = lat_join(p->mrb, profile_lat(p, PROFILE_IVAR, class_name, name, 0),
+                          summary_lat(p, PROFILE_IVAR, class_name, name, 0));
+  push(p->ivar_lats, entry);
+  return entry;
+}
+
 static HIR*
 lookup_ivar(hpc_class *c, mrb_sym sym)
 {
   hpc_state *p = c->hpc;
   HIR* var = find_var_list(c->ivs, sym);
   if (!var) {
-    var = new_ivar(p, sym);
+    var = new_ivar(p, sym, ivar_lat_entry(p, c->name, sym)->lat);
     push(c->ivs, var);
     push(p->intern_names, var);
   }
@@ -1123,18 +1583,22 @@ lookup_cvar(hpc_class *c, mrb_sym sym)
   hpc_state *p = c->hpc;
   HIR* var = find_var_list(c->cvs, sym);
   if (!var) {
-    var = new_cvar(p, sym);
+    var = new_cvar(p, sym, ivar_lat_entry(p, c->name, sym)->lat);
     push(c->cvs, var);
     push(p->intern_names, var);
   }
   return var;
 }
 
+/* makes a statement using the value exp of a statement, or nil if exp is 0 */
+typedef HIR *(*last_value_func)(hpc_state *p, HIR *exp, void *ud);
+
+/* replace the statement computing the value of hir with f */
 static HIR*
-insert_return_at_last(hpc_state *p, HIR *hir)
+insert_at_last(hpc_state *p, HIR *hir, last_value_func f, void *ud)
 {
   if (!hir)
-    return new_return_void(p);
+    return f(p, 0, ud);
   switch ((intptr_t)hir->car) {
   case HIR_INIT_LIST:
   case HIR_GVARDECL:
@@ -1144,45 +1608,64 @@ insert_return_at_last(hpc_state *p, HIR *hir)
     NOT_REACHABLE();
     return hir;
   case HIR_SCOPE:
-    hir->cdr->cdr = insert_return_at_last(p, hir->cdr->cdr);
+    hir->cdr->cdr = insert_at_last(p, hir->cdr->cdr, f, ud);
     return hir;
   case HIR_BLOCK:
     {
       HIR *last = hir->cdr->car;
+      if (!last)
+        return f(p, 0, ud);
       while (last->cdr)
         last = last->cdr;
-      last->car = insert_return_at_last(p, last->car);
+      last->car = insert_at_last(p, last->car, f, ud);
     }
     return hir;
   case HIR_ASSIGN:
-    return new_block(p, list2(hir, new_return_value(p, hir->cdr->car)));
+    return new_block(p, list2(hir, f(p, hir->cdr->car, ud)));
   case HIR_IFELSE:
-    hir->cdr->cdr->car = insert_return_at_last(p, hir->cdr->cdr->car);
-    hir->cdr->cdr->cdr->car = insert_return_at_last(p, hir->cdr->cdr->cdr->car);
+    hir->cdr->cdr->car = insert_at_last(p, hir->cdr->cdr->car, f, ud);
+    hir->cdr->cdr->cdr->car = insert_at_last(p, hir->cdr->cdr->cdr->car, f, ud);
     return hir;
   case HIR_DOALL:
   case HIR_WHILE:
-    return new_block(p, list2(hir, new_return_void(p)));
+    return new_block(p, list2(hir, f(p, 0, ud)));
   case HIR_BREAK:
   case HIR_CONTINUE:
     NOT_REACHABLE();
   case HIR_RETURN:
     return hir;
   case HIR_EMPTY:
-    return new_return_void(p);
+    return f(p, 0, ud);
+  case HIR_PRIM:
   case HIR_INT:
   case HIR_FLOAT:
+  case HIR_STRING:
   case HIR_LVAR:
   case HIR_GVAR:
   case HIR_IVAR:
   case HIR_CVAR:
   case HIR_CALL:
-    return new_return_value(p, hir);
+  case HIR_SCALL:
+  case HIR_NEW:
+  case HIR_COND_OP:
+    return f(p, hir, ud);
   default:
     NOT_IMPLEMENTED();
   }
 }
 
+static HIR*
+return_value(hpc_state *p, HIR *exp, void *ud)
+{
+  return exp ? new_return_value(p, exp) : new_return_void(p);
+}
+
+static HIR*
+insert_return_at_last(hpc_state *p, HIR *hir)
+{
+  return insert_at_last(p, hir, return_value, 0);
+}
+
 static HIR*
 typing_scope(hpc_scope *s, node *tree)
 {
@@ -1198,11 +1681,91 @@ typing_scope(hpc_scope *s, node *tree)
   }
 
   hpc_scope *scope = scope_new(p, s, lv, NULL, TRUE);
-  hir = new_scope(p, lvs_to_decls(p, scope->lv), typing(scope, tree->cdr));
+  /* decls are typed by the lattices after the body */
+  hir = typing(scope, tree->cdr);
+  hir = new_scope(p, lvs_to_decls(p, scope->lv), hir);
   scope_finish(scope);
   return hir;
 }
 
+/* put_exp of codegen outputs it as a C expression */
+static int
+exp_hir_p(HIR *hir)
+{
+  switch ((intptr_t)hir->car) {
+    case HIR_PRIM:
+    case HIR_INT:
+    case HIR_FLOAT:
+    case HIR_STRING:
+    case HIR_LVAR:
+    case HIR_GVAR:
+    case HIR_IVAR:
+    case HIR_CVAR:
+    case HIR_CALL:
+    case HIR_SCALL:
+    case HIR_NEW:
+    case HIR_FIELD:
+    case HIR_COND_OP:
+    case HIR_SCOPE:
+      return TRUE;
+    default:
+      return FALSE;
+  }
+}
+
+static HIR *value_exp(hpc_scope *s, HIR *hir);
+
+/* a branch of an if used as a value */
+static HIR*
+value_branch(hpc_scope *s, HIR *hir)
+{
+  if (hir && (intptr_t)hir->car == HIR_BLOCK) {
+    HIR *stmts = hir->cdr->car;
+    if (!stmts)
+      hir = 0;
+    else if (!stmts->cdr)
+      hir = stmts->car;
+  }
+  if (!hir)
+    return new_prim(s->hpc, HPTYPE_NIL);
+  hir = value_exp(s, hir);
+  if (!exp_hir_p(hir))
+    unsupported(s);
+  return hir;
+}
+
+/*
+  An if used as a value, e.g. x = a > b ? a : b, is lowered to the
+  conditional operator.  Branches of several statements are left to the
+  VM.
+ */
+static HIR*
+value_exp(hpc_scope *s, HIR *hir)
+{
+  HIR *l;
+
+  switch ((intptr_t)hir->car) {
+    case HIR_IFELSE:
+      return new_cond_op(s->hpc, hir->cdr->car, value_branch(s, hir->cdr->cdr->car),
+                         value_branch(s, hir->cdr->cdr->cdr->car));
+    case HIR_BLOCK:
+      /* (a if c) */
+      for (l = hir->cdr->car; l && l->cdr; l = l->cdr)
+        ;
+      if (l)
+        l->car = value_exp(s, l->car);
+      return hir;
+    default:
+      return hir;
+  }
+}
+
+static HIR*
+typing_value(hpc_scope *s, node *tree)
+{
+  return value_exp(s, typing(s, tree));
+}
+
 static HIR*
 typing_args(hpc_scope *s, node *args)
 {
@@ -1212,14 +1775,14 @@ typing_args(hpc_scope *s, node *args)
   while (args) {
     if (n >= 127 || (intptr_t)args->car->car == NODE_SPLAT) {
       /* splat mode */
-      NOT_IMPLEMENTED();
+      unsupported(s);
     }
     /* normal mode */
 
     if (hir)
-      last->cdr = cons(typing(s, args->car), 0);
+      last->cdr = cons(typing_value(s, args->car), 0);
     else
-      hir = last = cons(typing(s, args->car), 0);
+      hir = last = cons(typing_value(s, args->car), 0);
     n++;
     args = args->cdr;
   }
@@ -1228,11 +1791,20 @@ typing_args(hpc_scope *s, node *args)
 
 #define PRIMCALL_ARGC_MAX 16
 
+static HIR*
+new_call(hpc_state *p, mrb_sym mid, HIR *recv, HIR *args, mrb_value lat)
+{
+  HIR *hir = cons((HIR*)HIR_CALL, cons(hirsym(mid), cons(recv, args)));
+  hir->lat = lat;
+  return hir;
+}
+
 static HIR *
 typing_prim_call(hpc_scope *s, struct RProc *interp, HIR *recv, mrb_sym mid, HIR *args, node *blk)
 {
   mrb_value *argv, argv_s[PRIMCALL_ARGC_MAX];
   mrb_value ret;
+  HIR *arg = args;
   int i, argc = hir_len(args);
 
   if (argc > PRIMCALL_ARGC_MAX)
@@ -1241,79 +1813,606 @@ typing_prim_call(hpc_scope *s, struct RProc *interp, HIR *recv, mrb_sym mid, HIR
     argv = argv_s;
 
   for (i = 0; i < argc; i++) {
-    argv[i] = args->car->lat;
-    args = args->cdr;
+    argv[i] = arg->car->lat;
+    arg = arg->cdr;
   }
 
   if (blk)
-    NOT_IMPLEMENTED();
+    unsupported(s);
 
   ret = mrb_proccall_with_block(s->mrb, recv->lat, interp, mid, argc, argv, mrb_nil_value());
-  mrb_p(s->mrb, ret);
-  NOT_IMPLEMENTED();
+  if (argv != argv_s)
+    mrb_free(s->mrb, argv);
+  if (s->mrb->exc) {
+    /* the interpreter raised, e.g. while folding constants */
+    s->mrb->exc = 0;
+    ret = lat_dynamic;
+  }
+  return new_call(s->hpc, mid, recv, args, ret);
 }
 
-static HIR*
-typing_prim_add(hpc_scope *s, HIR *recv, HIR *args)
+enum prim_op_kind {
+  PRIM_ARITH,   /* + - *: Fixnum overflows into Float */
+  PRIM_DIV,     /* /: always Float */
+  PRIM_MOD,     /* % */
+  PRIM_BIT,     /* ^ & | << >>: Fixnum only */
+  PRIM_CMP,     /* < <= > >= == */
+};
+
+static mrb_value
+lat_bool(mrb_state *mrb)
 {
-  hpc_assert(!args->cdr);
-  NOT_IMPLEMENTED();
+  return lat_set_new2(mrb, mrb_true_value(), mrb_false_value());
 }
 
-static HIR*
-typing_prim_sub(hpc_scope *s, HIR *recv, HIR *args)
+/* fold constants by the VM; returns lat_unknown if it raised */
+static mrb_value
+lat_fold(mrb_state *mrb, mrb_value recv, const char *op, int argc, mrb_value arg)
 {
-  hpc_assert(!args->cdr);
-  NOT_IMPLEMENTED();
+  mrb_value ret = mrb_funcall(mrb, recv, op, argc, arg);
+  if (mrb->exc) {
+    mrb->exc = 0;
+    return lat_unknown;
+  }
+  return ret;
 }
 
-static HIR*
-typing_prim_mul(hpc_scope *s, HIR *recv, HIR *args)
+static mrb_value
+lat_prim_binop(mrb_state *mrb, const char *op, enum prim_op_kind kind, mrb_value a, mrb_value b)
 {
-  hpc_assert(!args->cdr);
-  NOT_IMPLEMENTED();
+  enum lat_num na, nb;
+
+  if (LAT_HAS_TYPE(mrb, a, LAT_UNKNOWN) || LAT_HAS_TYPE(mrb, b, LAT_UNKNOWN))
+    return lat_unknown;
+
+  na = lat_num(mrb, a);
+  nb = lat_num(mrb, b);
+  if (na == LNUM_NONE || nb == LNUM_NONE) {
+    struct RClass *ca = lat_class_of(mrb, a), *cb = lat_class_of(mrb, b);
+    if (ca != mrb->string_class || cb != mrb->string_class)
+      return lat_dynamic;
+    /* String#+ and String#== */
+    if (kind == PRIM_ARITH && op[0] == '+')
+      return lat_set_new1(mrb, mrb_str_new(mrb, 0, 0));
+    if (kind == PRIM_CMP && op[0] == '=')
+      return lat_bool(mrb);
+    /* String#<< appends to the receiver */
+    if (kind == PRIM_BIT && op[0] == '<')
+      return lat_set_new1(mrb, mrb_str_new(mrb, 0, 0));
+    return lat_dynamic;
+  }
+
+  if (!LAT_P(mrb, a) && !LAT_P(mrb, b)) {
+    mrb_value ret = lat_fold(mrb, a, op, 1, b);
+    if (!LAT_HAS_TYPE(mrb, ret, LAT_UNKNOWN))
+      return ret;
+  }
+
+  switch (kind) {
+    case PRIM_ARITH:
+      if (na == LNUM_FLOAT || nb == LNUM_FLOAT)
+        return lat_set_new1(mrb, mrb_float_value(0.0));
+      return lat_set_new2(mrb, mrb_fixnum_value(0), mrb_float_value(0.0));
+    case PRIM_DIV:
+      return lat_set_new1(mrb, mrb_float_value(0.0));
+    case PRIM_MOD:
+      /* Fixnum % 0 is NaN */
+      if (na == LNUM_INT && nb == LNUM_INT && !LAT_P(mrb, b) && mrb_fixnum(b) != 0)
+        return lat_set_new1(mrb, mrb_fixnum_value(0));
+      if (na == LNUM_FLOAT || nb == LNUM_FLOAT)
+        return lat_set_new1(mrb, mrb_float_value(0.0));
+      return lat_set_new2(mrb, mrb_fixnum_value(0), mrb_float_value(0.0));
+    case PRIM_BIT:
+      if (na == LNUM_INT && nb == LNUM_INT)
+        return lat_set_new1(mrb, mrb_fixnum_value(0));
+      return lat_dynamic;
+    case PRIM_CMP:
+      return lat_bool(mrb);
+    default:
+      NOT_REACHABLE();
+  }
 }
 
 static HIR*
-typing_prim_div(hpc_scope *s, HIR *recv, HIR *args)
+typing_prim_binop(hpc_scope *s, const char *op, enum prim_op_kind kind, HIR *recv, HIR *args)
 {
-  hpc_assert(!args->cdr);
-  NOT_IMPLEMENTED();
+  mrb_value lat;
+
+  hpc_assert(args && !args->cdr);
+  lat = lat_prim_binop(s->mrb, op, kind, recv->lat, args->car->lat);
+  return new_call(s->hpc, mrb_intern_cstr(s->mrb, op), recv, args, lat);
 }
 
 static HIR*
-typing_prim_lt(hpc_scope *s, HIR *recv, HIR *args)
+typing_prim_add(hpc_scope *s, HIR *recv, HIR *args)
 {
-  hpc_assert(!args->cdr);
-  NOT_IMPLEMENTED();
+  return typing_prim_binop(s, "+", PRIM_ARITH, recv, args);
 }
 
 static HIR*
-typing_prim_ltasgn(hpc_scope *s, HIR *recv, HIR *args)
+typing_prim_sub(hpc_scope *s, HIR *recv, HIR *args)
 {
-  hpc_assert(!args->cdr);
-  NOT_IMPLEMENTED();
+  return typing_prim_binop(s, "-", PRIM_ARITH, recv, args);
 }
 
 static HIR*
-typing_prim_gt(hpc_scope *s, HIR *recv, HIR *args)
+typing_prim_mul(hpc_scope *s, HIR *recv, HIR *args)
 {
-  hpc_assert(!args->cdr);
-  NOT_IMPLEMENTED();
+  return typing_prim_binop(s, "*", PRIM_ARITH, recv, args);
 }
 
 static HIR*
-typing_prim_gtasgn(hpc_scope *s, HIR *recv, HIR *args)
+typing_prim_div(hpc_scope *s, HIR *recv, HIR *args)
+{
+  return typing_prim_binop(s, "/", PRIM_DIV, recv, args);
+}
+
+static HIR*
+typing_prim_mod(hpc_scope *s, HIR *recv, HIR *args)
+{
+  return typing_prim_binop(s, "%", PRIM_MOD, recv, args);
+}
+
+static HIR*
+typing_prim_lt(hpc_scope *s, HIR *recv, HIR *args)
+{
+  return typing_prim_binop(s, "<", PRIM_CMP, recv, args);
+}
+
+static HIR*
+typing_prim_ltasgn(hpc_scope *s, HIR *recv, HIR *args)
+{
+  return typing_prim_binop(s, "<=", PRIM_CMP, recv, args);
+}
+
+static HIR*
+typing_prim_gt(hpc_scope *s, HIR *recv, HIR *args)
+{
+  return typing_prim_binop(s, ">", PRIM_CMP, recv, args);
+}
+
+static HIR*
+typing_prim_gtasgn(hpc_scope *s, HIR *recv, HIR *args)
 {
-  hpc_assert(!args->cdr);
-  NOT_IMPLEMENTED();
+  return typing_prim_binop(s, ">=", PRIM_CMP, recv, args);
 }
 
 static HIR*
 typing_prim_equal(hpc_scope *s, HIR *recv, HIR *args)
 {
-  hpc_assert(!args->cdr);
-  NOT_IMPLEMENTED();
+  return typing_prim_binop(s, "==", PRIM_CMP, recv, args);
+}
+
+static HIR*
+typing_prim_uminus(hpc_scope *s, HIR *recv)
+{
+  mrb_state *mrb = s->mrb;
+  mrb_value lat = recv->lat;
+
+  switch (lat_num(mrb, lat)) {
+    case LNUM_NONE:
+      if (!LAT_HAS_TYPE(mrb, lat, LAT_UNKNOWN))
+        lat = lat_dynamic;
+      break;
+    default:
+      if (!LAT_P(mrb, lat)) {
+        mrb_value ret = lat_fold(mrb, lat, "-@", 0, mrb_nil_value());
+        if (!LAT_HAS_TYPE(mrb, ret, LAT_UNKNOWN))
+          lat = ret;
+        break;
+      }
+      lat = lat_clone(mrb, lat);
+      break;
+  }
+  return new_call(s->hpc, mrb_intern_cstr(mrb, "-@"), recv, 0, lat);
+}
+
+/* Specialization of methods defined in the target code */
+
+#define CLONES_PER_METHOD_MAX 8
+
+static HIR *typing_method(hpc_scope *s, hpc_class *class, node *ast, int sdefp,
+                          mrb_value self_lat, mrb_value *param_lats, mrb_value *ret_lat);
+static HIR *try_typing_method(hpc_scope *s, hpc_class *class, node *ast, int sdefp,
+                              mrb_value self_lat, mrb_value *param_lats, mrb_value *ret_lat);
+static void add_vm_call(hpc_state *p, mrb_sym mid, int argc);
+
+/* constants are widened to their classes not to specialize for each value */
+static mrb_value
+lat_widen(mrb_state *mrb, mrb_value lat)
+{
+  switch (LAT_TYPE(mrb, lat)) {
+    case LAT_UNKNOWN:
+      return lat_dynamic;
+    case LAT_CONST:
+      switch (mrb_type(lat)) {
+        case MRB_TT_CLASS:
+        case MRB_TT_MODULE:
+          return lat;           /* receivers of class methods */
+        default:
+          return lat_set_new1(mrb, lat);
+      }
+    default:
+      return lat;
+  }
+}
+
+static mrb_sym
+class_sym(mrb_state *mrb, struct RClass *c)
+{
+  const char *name = mrb_class_name(mrb, c);
+  return name ? mrb_intern_cstr(mrb, name) : 0;
+}
+
+/* the number of params, or -1 unless all are mandatory */
+static int
+mandatory_argc(node *ast)
+{
+  node *args = ast->cdr->cdr->car;
+  node *m;
+  int n = 0;
+
+  if (args->cdr->car || args->cdr->cdr->car || args->cdr->cdr->cdr->car ||
+      args->cdr->cdr->cdr->cdr)
+    return -1;
+  for (m = args->car; m; m = m->cdr)
+    n++;
+  return n;
+}
+
+/* only mandatory params are supported */
+static int
+simple_params_p(node *ast, int argc)
+{
+  return mandatory_argc(ast) == argc;
+}
+
+/*
+  Find a method definition in classes named class_name (0 for toplevel).
+  Returns the class, or 0 if not found.
+  def is set to 0 if the method cannot be specialized.
+ */
+static hpc_class*
+find_method_def(hpc_state *p, mrb_sym class_name, int sdefp, mrb_sym mid, int argc,
+                node **def)
+{
+  HIR *classes, *defs;
+
+  for (classes = p->classes; classes; classes = classes->cdr) {
+    hpc_class *c = (hpc_class *)classes->car;
+    if (c->name != class_name)
+      continue;
+    for (defs = c->method_defs; defs; defs = defs->cdr) {
+      node *ast = (node *)defs->car->car;
+      if ((intptr_t)defs->car->cdr == sdefp && sym(ast->car) == mid) {
+        *def = simple_params_p(ast, argc) ? ast : 0;
+        return c;
+      }
+    }
+  }
+  return 0;
+}
+
+/* check any class in the target code defines mid */
+static int
+method_defined_in_class_p(hpc_state *p, mrb_sym mid)
+{
+  HIR *classes, *defs;
+
+  for (classes = p->classes; classes; classes = classes->cdr) {
+    hpc_class *c = (hpc_class *)classes->car;
+    if (!c->name)
+      continue;
+    for (defs = c->method_defs; defs; defs = defs->cdr) {
+      if (sym(((node *)defs->car->car)->car) == mid)
+        return TRUE;
+    }
+  }
+  return FALSE;
+}
+
+static int
+user_class_p(hpc_state *p, mrb_value lat)
+{
+  HIR *classes;
+  mrb_sym name;
+
+  if (LAT_TYPE(p->mrb, lat) != LAT_CONST || mrb_type(lat) != MRB_TT_CLASS)
+    return FALSE;
+  name = class_sym(p->mrb, mrb_class_ptr(lat));
+  for (classes = p->classes; classes; classes = classes->cdr) {
+    if (name && ((hpc_class *)classes->car)->name == name)
+      return TRUE;
+  }
+  return FALSE;
+}
+
+/*
+  Look up or type a clone of def for the lattices of self and args.
+  Returns 0 if the clone is being typed (recursive call) or there are
+  too many clones of def.
+ */
+static hpc_clone*
+specialize(hpc_scope *s, hpc_class *class, node *def, int sdefp, mrb_value self_lat,
+           HIR *args)
+{
+  hpc_state *p = s->hpc;
+  mrb_state *mrb = s->mrb;
+  int i, n = 0, argc = hir_len(args);
+  mrb_value *lats = (mrb_value *)compiler_palloc(p, sizeof(mrb_value)*(argc+1));
+  HIR *clones, *arg, *last;
+  hpc_clone *clone;
+
+  self_lat = lat_widen(mrb, self_lat);
+  for (i = 0, arg = args; arg; i++, arg = arg->cdr)
+    lats[i] = lat_widen(mrb, arg->car->lat);
+
+  for (clones = class->clones; clones; clones = clones->cdr) {
+    clone = (hpc_clone *)clones->car;
+    if (clone->def != def)
+      continue;
+    n++;
+    if (!lat_equal(mrb, clone->self_lat, self_lat))
+      continue;
+    for (i = 0; i < argc; i++) {
+      if (!lat_equal(mrb, clone->param_lats[i], lats[i]))
+        break;
+    }
+    if (i == argc)
+      return clone->fundecl ? clone : 0;
+  }
+  if (n >= CLONES_PER_METHOD_MAX)
+    return 0;
+
+  clone = (hpc_clone *)compiler_palloc(p, sizeof(hpc_clone));
+  clone->def = def;
+  clone->argc = argc;
+  clone->self_lat = self_lat;
+  clone->param_lats = lats;
+  clone->ret_lat = lat_dynamic;
+  clone->fundecl = 0;
+  push(class->clones, (HIR *)clone);
+
+  clone->fundecl = try_typing_method(s, class, def, sdefp, self_lat, lats, &clone->ret_lat);
+  if (!clone->fundecl) {
+    /* called through the multiplexer of the generic method */
+    HIR **l;
+    for (l = &class->clones; (*l)->car != (HIR *)clone; l = &(*l)->cdr)
+      ;
+    *l = (*l)->cdr;
+    return 0;
+  }
+  /* distinguish clones from the generic method by an id */
+  for (last = clone->fundecl; last->cdr; last = last->cdr)
+    ;
+  last->cdr = list1((HIR *)(intptr_t)++p->clone_counter);
+  return clone;
+}
+
+/*
+  The method called statically, or 0 if it is not known.
+  def is set to the definition, sdefp if it is a singleton method.
+ */
+static hpc_class*
+lookup_method_def(hpc_scope *s, HIR *recv, mrb_sym mid, int argc, node **def, int *sdefp)
+{
+  hpc_state *p = s->hpc;
+  mrb_state *mrb = s->mrb;
+  mrb_value recv_lat = recv->lat;
+  struct RClass *c;
+  hpc_class *class = 0;
+
+  *def = 0;
+  *sdefp = FALSE;
+  if (LAT_TYPE(mrb, recv_lat) == LAT_CONST &&
+      (mrb_type(recv_lat) == MRB_TT_CLASS || mrb_type(recv_lat) == MRB_TT_MODULE)) {
+    *sdefp = TRUE;
+    c = mrb_class_ptr(recv_lat);
+  }
+  else {
+    c = lat_class_of(mrb, recv_lat);
+  }
+  if (c)
+    class = find_method_def(p, class_sym(mrb, c), *sdefp, mid, argc, def);
+  if (!class && recv == s->current_self) {
+    /* toplevel methods are private methods of Object */
+    if (c || !method_defined_in_class_p(p, mid))
+      class = find_method_def(p, 0, FALSE, mid, argc, def);
+    *sdefp = FALSE;
+  }
+  if (!class || !*def)
+    return 0;
+  return class;
+}
+
+/*
+  A call of a method defined in the target code, which is typed for
+  the lattices at this call-site.
+  Returns 0 unless the method to be called is known statically.
+ */
+static HIR*
+typing_user_call(hpc_scope *s, HIR *recv, mrb_sym mid, HIR *args)
+{
+  hpc_state *p = s->hpc;
+  hpc_class *class;
+  hpc_clone *clone;
+  node *def;
+  int sdefp;
+  HIR *hir;
+
+  class = lookup_method_def(s, recv, mid, hir_len(args), &def, &sdefp);
+  if (!class)
+    return 0;
+
+  clone = specialize(s, class, def, sdefp, recv->lat, args);
+  if (!clone)
+    return 0;
+  hir = cons((HIR*)HIR_SCALL, cons(cons((HIR*)class, clone->fundecl), cons(recv, args)));
+  hir->lat = clone->ret_lat;
+  return hir;
+}
+
+/* instantiation with initialize specialized for the lattices of args */
+static HIR*
+typing_user_new(hpc_scope *s, HIR *recv, HIR *args)
+{
+  hpc_state *p = s->hpc;
+  mrb_state *mrb = s->mrb;
+  mrb_value self_lat = lat_set_new_class(mrb, recv->lat);
+  hpc_class *class;
+  hpc_clone *clone;
+  node *def = 0;
+  HIR *hir;
+
+  class = find_method_def(p, class_sym(mrb, mrb_class_ptr(recv->lat)), FALSE,
+                          mrb->init_sym, hir_len(args), &def);
+  if (!class || !def)
+    return 0;
+
+  clone = specialize(s, class, def, FALSE, self_lat, args);
+  if (!clone)
+    return 0;
+  hir = cons((HIR*)HIR_NEW, cons(cons((HIR*)class, clone->fundecl), cons(recv, args)));
+  hir->lat = self_lat;
+  return hir;
+}
+
+static HIR *typing_float_elem(hpc_scope *s, HIR *recv, mrb_sym mid, HIR *args);
+
+/*
+  FloatArray and IntArray (mruby-numeric-array) are vectors of unboxed
+  numbers, whose elements C reads and writes in place (see builtin.h).
+ */
+
+/* LNUM_FLOAT for FloatArray, LNUM_INT for IntArray, otherwise LNUM_NONE */
+static enum lat_num
+numary_kind(mrb_state *mrb, struct RClass *c)
+{
+  const char *name;
+
+  if (!c)
+    return LNUM_NONE;
+  name = mrb_class_name(mrb, c);
+  if (strcmp(name, "FloatArray") == 0)
+    return LNUM_FLOAT;
+  if (strcmp(name, "IntArray") == 0)
+    return LNUM_INT;
+  return LNUM_NONE;
+}
+
+static HIR*
+typing_numary_call(hpc_scope *s, HIR *recv, mrb_sym mid, HIR *args)
+{
+  hpc_state *p = s->hpc;
+  mrb_state *mrb = s->mrb;
+  enum lat_num kind = numary_kind(mrb, lat_class_of(mrb, recv->lat));
+  const char *name = mrb_sym2name(mrb, mid);
+  int argc = hir_len(args);
+  int floatp = kind == LNUM_FLOAT;
+
+  if (kind == LNUM_NONE)
+    return 0;
+  if (argc == 1 && strcmp(name, "[]") == 0 && lat_num(mrb, args->car->lat) == LNUM_INT)
+    return new_call(p, mrb_intern_cstr(mrb, floatp ? "hpc_fary_ref" : "hpc_iary_ref"),
+                    recv, args, lat_set_new1(mrb, floatp ? mrb_float_value(0.0) : mrb_fixnum_value(0)));
+  /* the value of the assignment is the value given, not converted */
+  if (argc == 2 && strcmp(name, "[]=") == 0 && lat_num(mrb, args->car->lat) == LNUM_INT &&
+      lat_num(mrb, args->cdr->car->lat) == kind)
+    return new_call(p, mrb_intern_cstr(mrb, floatp ? "hpc_fary_set" : "hpc_iary_set"),
+                    recv, args, args->cdr->car->lat);
+  if (argc == 0 && (strcmp(name, "length") == 0 || strcmp(name, "size") == 0))
+    return new_call(p, mrb_intern_cstr(mrb, "hpc_numary_len"), recv, 0,
+                    lat_set_new1(mrb, mrb_fixnum_value(0)));
+  /* bulk operations, named apart from the multiplexers of user methods */
+  if (argc == 0 && strcmp(name, "sum") == 0)
+    return new_call(p, mrb_intern_cstr(mrb, "hpc_numary_sum"), recv, 0,
+                    floatp ? lat_set_new1(mrb, mrb_float_value(0.0)) :
+                    lat_set_new2(mrb, mrb_fixnum_value(0), mrb_float_value(0.0)));
+  if (floatp && argc == 1 && strcmp(name, "dot") == 0)
+    return new_call(p, mrb_intern_cstr(mrb, "hpc_numary_dot"), recv, args,
+                    lat_set_new1(mrb, mrb_float_value(0.0)));
+  if (floatp && argc == 2 && strcmp(name, "axpy") == 0)
+    return new_call(p, mrb_intern_cstr(mrb, "hpc_numary_axpy"), recv, args, recv->lat);
+  return 0;
+}
+
+static int
+math_module_p(mrb_state *mrb, mrb_value lat)
+{
+  return !LAT_P(mrb, lat) && mrb_type(lat) == MRB_TT_MODULE &&
+    strcmp(mrb_class_name(mrb, mrb_class_ptr(lat)), "Math") == 0;
+}
+
+/*
+  Math functions of numbers are called in libm (see NATIVE_MATH in
+  codegen.c), and folded if the args are constants.  mruby-math raises
+  no domain errors, so the results are the same as on the VM.
+ */
+static const struct math_func {
+  const char *name;
+  int argc;
+  double (*f1)(double);
+  double (*f2)(double, double);
+} math_funcs[] = {
+  {"sin", 1, sin}, {"cos", 1, cos}, {"tan", 1, tan},
+  {"asin", 1, asin}, {"acos", 1, acos}, {"atan", 1, atan},
+  {"sinh", 1, sinh}, {"cosh", 1, cosh}, {"tanh", 1, tanh},
+  {"asinh", 1, asinh}, {"acosh", 1, acosh}, {"atanh", 1, atanh},
+  {"exp", 1, exp}, {"log", 1, log}, {"log2", 1, log2}, {"log10", 1, log10},
+  {"sqrt", 1, sqrt}, {"cbrt", 1, cbrt}, {"erf", 1, erf}, {"erfc", 1, erfc},
+  {"atan2", 2, 0, atan2}, {"hypot", 2, 0, hypot},
+};
+
+static double
+lat_to_double(mrb_value v)
+{
+  return mrb_fixnum_p(v) ? (double)mrb_fixnum(v) : mrb_float(v);
+}
+
+static HIR*
+typing_math_call(hpc_scope *s, HIR *recv, mrb_sym mid, HIR *args)
+{
+  mrb_state *mrb = s->mrb;
+  const char *name = mrb_sym2name(mrb, mid);
+  const struct math_func *f = 0;
+  char cname[32];
+  mrb_value lat;
+  HIR *arg;
+  int i, constp = TRUE;
+
+  if (!math_module_p(mrb, recv->lat))
+    return 0;
+  for (i = 0; i < sizeof(math_funcs)/sizeof(math_funcs[0]); i++) {
+    if (strcmp(math_funcs[i].name, name) == 0 && math_funcs[i].argc == hir_len(args))
+      f = &math_funcs[i];
+  }
+  if (!f)
+    return 0;
+  for (arg = args; arg; arg = arg->cdr) {
+    if (lat_num(mrb, arg->car->lat) == LNUM_NONE)
+      return 0;
+    if (LAT_TYPE(mrb, arg->car->lat) != LAT_CONST)
+      constp = FALSE;
+  }
+  if (constp && f->f1)
+    lat = mrb_float_value(f->f1(lat_to_double(args->car->lat)));
+  else if (constp)
+    lat = mrb_float_value(f->f2(lat_to_double(args->car->lat), lat_to_double(args->cdr->car->lat)));
+  else
+    lat = lat_set_new1(mrb, mrb_float_value(0.0));
+  snprintf(cname, sizeof(cname), "hpc_math_%s", name);
+  return new_call(s->hpc, mrb_intern_cstr(mrb, cname), recv, args, lat);
+}
+
+/* check any of exps depends on lattices not inferred yet */
+static int
+pending_exps_p(mrb_state *mrb, HIR *exps)
+{
+  for (; exps; exps = exps->cdr) {
+    if (LAT_HAS_TYPE(mrb, exps->car->lat, LAT_UNKNOWN))
+      return TRUE;
+  }
+  return FALSE;
 }
 
 static HIR*
@@ -1323,34 +2422,86 @@ typing_call0(hpc_scope *s, struct RClass *klass, HIR *recv, mrb_sym mid, HIR *ar
   struct RProc *interp = 0;
   size_t len;
   const char *name = mrb_sym2name_len(s->mrb, mid, &len);
+  int argc = hir_len(args);
+  HIR *hir;
+
+  /* typed again after the lattices are inferred (see compile) */
+  if (LAT_HAS_TYPE(s->mrb, recv->lat, LAT_UNKNOWN) || pending_exps_p(s->mrb, args))
+    return new_call(s->hpc, mid, recv, args, lat_unknown);
+
+  if (s->hpc->float_arrays && !blk) {
+    hir = typing_float_elem(s, recv, mid, args);
+    if (hir)
+      return hir;
+  }
+  if (!blk) {
+    hir = typing_user_call(s, recv, mid, args);
+    if (hir)
+      return hir;
+    hir = typing_numary_call(s, recv, mid, args);
+    if (hir)
+      return hir;
+    hir = typing_math_call(s, recv, mid, args);
+    if (hir)
+      return hir;
+    if (argc == 0 && lat_class_of(s->mrb, recv->lat) == s->mrb->array_class &&
+        (strcmp(name, "length") == 0 || strcmp(name, "size") == 0))
+      return new_call(s->hpc, mrb_intern_cstr(s->mrb, "hpc_ary_len"), recv, 0,
+                      lat_set_new1(s->mrb, mrb_fixnum_value(0)));
+    if (mid == mrb_intern_cstr(s->mrb, "new") && user_class_p(s->hpc, recv->lat)) {
+      hir = typing_user_new(s, recv, args);
+      if (hir)
+        return hir;
+      return new_call(s->hpc, mid, recv, args, lat_set_new_class(s->mrb, recv->lat));
+    }
+    /* Array.new and vectors, to inline iterators and element accesses */
+    if (mid == mrb_intern_cstr(s->mrb, "new") && !LAT_P(s->mrb, recv->lat) &&
+        mrb_type(recv->lat) == MRB_TT_CLASS &&
+        (mrb_class_ptr(recv->lat) == s->mrb->array_class ||
+         numary_kind(s->mrb, mrb_class_ptr(recv->lat)) != LNUM_NONE))
+      return new_call(s->hpc, mid, recv, args, lat_set_new_class(s->mrb, recv->lat));
+  }
+
+  if (argc == 1 && !blk) {
+    if (len == 1 && name[0] == '+')
+      return typing_prim_add(s, recv, args);
+    else if (len == 1 && name[0] == '-')
+      return typing_prim_sub(s, recv, args);
+    else if (len == 1 && name[0] == '*')
+      return typing_prim_mul(s, recv, args);
+    else if (len == 1 && name[0] == '/')
+      return typing_prim_div(s, recv, args);
+    else if (len == 1 && name[0] == '%')
+      return typing_prim_mod(s, recv, args);
+    else if (len == 1 && name[0] == '<')
+      return typing_prim_lt(s, recv, args);
+    else if (len == 2 && name[0] == '<' && name[1] == '=')
+      return typing_prim_ltasgn(s, recv, args);
+    else if (len == 1 && name[0] == '>')
+      return typing_prim_gt(s, recv, args);
+    else if (len == 2 && name[0] == '>' && name[1] == '=')
+      return typing_prim_gtasgn(s, recv, args);
+    else if (len == 2 && name[0] == '=' && name[1] == '=')
+      return typing_prim_equal(s, recv, args);
+    else if (len == 1 && (name[0] == '^' || name[0] == '&' || name[0] == '|'))
+      return typing_prim_binop(s, name, PRIM_BIT, recv, args);
+    else if (len == 2 && (name[0] == '<' || name[0] == '>') && name[0] == name[1])
+      return typing_prim_binop(s, name, PRIM_BIT, recv, args);
+  }
+  else if (argc == 0 && !blk) {
+    if (len == 2 && name[0] == '-' && name[1] == '@')
+      return typing_prim_uminus(s, recv);
+    else if (len == 1 && name[0] == '!')
+      return new_call(s->hpc, mid, recv, args, lat_bool(s->mrb));
+  }
 
-  mrb_p(s->mrb, recv->lat);
-  mrb_p(s->mrb, mrb_symbol_value(mid));
-  mrb_p(s->mrb, mrb_obj_value(klass));
-
-  if (len == 1 && name[0] == '+')
-    return typing_prim_add(s, recv, args);
-  else if (len == 1 && name[0] == '-')
-    return typing_prim_sub(s, recv, args);
-  else if (len == 1 && name[0] == '*')
-    return typing_prim_mul(s, recv, args);
-  else if (len == 1 && name[0] == '/')
-    return typing_prim_div(s, recv, args);
-  else if (len == 1 && name[0] == '<')
-    return typing_prim_lt(s, recv, args);
-  else if (len == 2 && name[0] == '<' && name[1] == '=')
-    return typing_prim_ltasgn(s, recv, args);
-  else if (len == 1 && name[0] == '>')
-    return typing_prim_gt(s, recv, args);
-  else if (len == 2 && name[0] == '>' && name[1] == '=')
-    return typing_prim_gtasgn(s, recv, args);
-  else if (len == 2 && name[0] == '=' && name[1] == '=')
-    return typing_prim_equal(s, recv, args);
-
-  interp = search_abst_interp(s->mrb, klass, mid);
-  if (interp)
-    return typing_prim_call(s, interp, recv, mid, args, blk);
-  NOT_IMPLEMENTED();
+  if (klass) {
+    interp = search_abst_interp(s->mrb, klass, mid);
+    if (interp)
+      return typing_prim_call(s, interp, recv, mid, args, blk);
+  }
+  add_vm_call(s->hpc, mid, argc);
+  return new_call(s->hpc, mid, recv, args, lat_dynamic);
 }
 
 static int
@@ -1365,15 +2516,23 @@ find_params(node *params, mrb_sym sym)
 }
 
 /*
+  class: class of a method, or NULL for a block,
+         which shares local variables and self with prev_scope
+  self_lat: lattice of self in a method
+  param_lats: lattices of margs, or NULL if they can be anything
+
   return: (hpc_scope *scope . HIR* body)
     scope is not closed, if you do not need scope, close it
  */
 static HIR*
-typing_block(hpc_scope *prev_scope, node *lv_tree, node *margs, node *n_body, int inherit_lvar)
+typing_block(hpc_scope *prev_scope, hpc_class *class, mrb_value self_lat,
+             node *lv_tree, node *margs, mrb_value *param_lats, node *n_body)
 {
   hpc_state *p = prev_scope->hpc;
   hpc_scope *scope;
   HIR *body, *lv = 0, *non_pv_lv = 0;
+  node *param;
+  int i;
 
   while (lv_tree) {
     if (lv_tree->car) {
@@ -1387,341 +2546,4320 @@ typing_block(hpc_scope *prev_scope, node *lv_tree, node *margs, node *n_body, in
     lv_tree = lv_tree->cdr;
   }
 
-  scope = scope_new(p, prev_scope, lv, NULL, inherit_lvar);
-  body = new_scope(p, lvs_to_decls(p, non_pv_lv), typing(scope, n_body));
+  scope = scope_new(p, prev_scope, lv, class, !class);
+  if (class)
+    scope->current_self->lat = self_lat;
+  for (param = margs, i = 0; param; param = param->cdr, i++) {
+    HIR *lvar = find_var_list(lv, sym(param->car->cdr));
+    lvar->lat = param_lats ? param_lats[i] : lat_dynamic;
+    if (LAT_HAS_TYPE(p->mrb, lvar->lat, LAT_UNKNOWN))
+      lvar->lat = lat_pending;
+  }
+
+  body = typing(scope, n_body);
+  body = new_scope(p, lvs_to_decls(p, non_pv_lv), body);
 
   return cons((HIR*)scope, body);
 }
 
-static HIR*
-typing_call_raw(hpc_scope *s, mrb_sym name, HIR *args_prefix, node *tree, HIR *args_suffix)
+/* receiver class to look up abstract interpreters */
+static struct RClass*
+lat_recv_class(mrb_state *mrb, mrb_value lat)
 {
-  HIR *args, *last;
-  hpc_state *p = s->hpc;
-
-  args = last = args_prefix;
-  while (last->cdr)
-    last = last->cdr;
+  if (!LAT_P(mrb, lat))
+    return mrb_class(mrb, lat);   /* a singleton class if any */
+  return lat_class_of(mrb, lat);
+}
 
-  if (tree) {
-    /* mandatory arg */
-    node *argtree = tree->car;
-    while (argtree) {
-      last->cdr = cons(typing(s, argtree->car), 0);
-      last = last->cdr;
-      argtree = argtree->cdr;
-    }
-    /* block arg */
-    if (tree->cdr) {
-      if (name != mrb_intern_cstr(p->mrb, "times"))
-        NOT_IMPLEMENTED();
+static mrb_value*
+snapshot_lvs(hpc_scope *s)
+{
+  int i, n = hir_len(s->lv);
+  mrb_value *lats = (mrb_value *)mrb_pool_alloc(s->mpool, sizeof(mrb_value)*(n+1));
+  HIR *lv = s->lv;
 
-      HIR* recv = args_prefix->car;
-      HIR* hir;
-      mrb_sym counter = sym(tree->cdr->cdr->car->car);
-      hpc_state *p = s->hpc;
+  for (i = 0; i < n; i++, lv = lv->cdr)
+    lats[i] = lv->car->lat;
+  return lats;
+}
 
-      HIR * result = typing_block(s, tree->cdr->cdr->car, tree->cdr->cdr->cdr->car->car, tree->cdr->cdr->cdr->cdr->car, TRUE);
-      scope_finish((hpc_scope *)result->car);
+static int
+lvs_changed(hpc_scope *s, mrb_value *lats)
+{
+  HIR *lv = s->lv;
+  int i;
 
-      hir = list5((HIR *)HIR_DOALL, hirsym(counter), new_int_const(p, 0), recv, result->cdr);
-      hir->lat = recv->lat;
-      return hir;
-    }
+  for (i = 0; lv; i++, lv = lv->cdr) {
+    if (!lat_equal(s->mrb, lats[i], lv->car->lat))
+      return TRUE;
   }
+  return FALSE;
+}
 
-  last->cdr = args_suffix;
+/*
+  Blocks
+
+  Iterators of builtin classes are inlined into loops.  The loop and the
+  temporaries are put in a scope, whose value is the last statement:
+    n.times {|i| }          DOALL i 0 n
+    a.upto(b) {|i| }        DOALL i a b+1
+    a.step(b, c) {|i| }     DOALL k 0 (b-a+c)/c; i = a+k*c  if all are Fixnum
+                            while (t <= b) { i = t; t += c }  otherwise
+    ary.each {|x| }         while (k < ary.length) { x = ary[k]; k += 1 }
+    ary.each_with_index     same as each with i = k
+    ary.map {|x| }          same as each with res[k] = the value of the block
+ */
 
-  return cons((HIR*)HIR_CALL, cons(hirsym(name), args));
-}
+/* (:block lv (mandatory-args ...) body) */
+#define BLOCK_LV(blk)       ((blk)->cdr->car)
+#define BLOCK_PARAMS(blk)   ((blk)->cdr->cdr->car ? (blk)->cdr->cdr->car->car : 0)
+#define BLOCK_BODY(blk)     ((blk)->cdr->cdr->cdr->car)
 
-static HIR*
-typing_call(hpc_scope *s, node *tree)
+static int
+hir_member_p(HIR *list, HIR *hir)
 {
-  HIR *recv = typing(s, tree->car);
-  mrb_sym name = sym(tree->cdr->car);
-  hpc_state *p = s->hpc;
+  for (; list; list = list->cdr) {
+    if (list->car == hir)
+      return TRUE;
+  }
+  return FALSE;
+}
 
-  return typing_call_raw(s, name, list1(recv), tree->cdr->cdr->car,  0);
+static mrb_value
+lat_fixnum(mrb_state *mrb)
+{
+  return lat_set_new1(mrb, mrb_fixnum_value(0));
 }
 
+/* a temporary variable of the lattice */
 static HIR*
-typing_assign(hpc_scope *s, node *lhs, HIR *rhs)
+new_temp(hpc_state *p, mrb_value lat)
 {
-  hpc_state *p = s->hpc;
-  switch ((intptr_t)lhs->car) {
-  case NODE_GVAR:
-  case NODE_LVAR:
-  case NODE_CONST:
-  case NODE_IVAR:
-  case NODE_CVAR:
-    return new_assign(p, typing(s, lhs), rhs);
-  case NODE_CALL:
-    {
-      HIR *recv = typing(s, lhs->cdr->car);
-      return typing_call_raw(s, attrsym(p, sym(lhs->cdr->cdr->car)), list1(recv), lhs->cdr->cdr->cdr->car,  list1(rhs));
+  return new_lvar(p, temp_sym(p), lat);
+}
+
+/* declaration of var initialized with val, typed by the lattice of var */
+static HIR*
+new_temp_decl(hpc_state *p, HIR *var, HIR *val)
+{
+  return new_lvardecl(p, var->lat, sym(var->cdr), val ? val : new_empty(p));
+}
+
+/* operator on Fixnums known not to overflow */
+static HIR*
+new_int_op(hpc_state *p, const char *op, HIR *a, HIR *b)
+{
+  return new_call(p, mrb_intern_cstr(p->mrb, op), a, list1(b), lat_fixnum(p->mrb));
+}
+
+/*
+  Type the body of blk once with the params of param_lats.
+  params[i] is set to the variable of the i-th param, 0 if the block
+  takes fewer params.  Returns the body, a HIR_SCOPE.
+ */
+static HIR*
+typing_iter_body(hpc_scope *s, node *blk, int argc, mrb_value *param_lats, HIR **params)
+{
+  node *margs = BLOCK_PARAMS(blk), *m;
+  hpc_scope *block_scope;
+  HIR *result;
+  int i;
+
+  for (m = margs, i = 0; m; m = m->cdr)
+    i++;
+  if (i > argc)
+    unsupported(s);
+  result = typing_block(s, NULL, lat_dynamic, BLOCK_LV(blk), margs, param_lats,
+                        BLOCK_BODY(blk));
+  block_scope = (hpc_scope *)result->car;
+  for (i = 0; i < argc; i++)
+    params[i] = 0;
+  for (m = margs, i = 0; m; m = m->cdr, i++)
+    params[i] = find_var_list(block_scope->lv, sym(m->car->cdr));
+  scope_finish(block_scope);
+  return result->cdr;
+}
+
+/* declare the params of the block body with their values */
+static void
+bind_params(hpc_state *p, HIR *body, HIR **params, HIR **vals, int argc)
+{
+  int i;
+
+  for (i = argc - 1; i >= 0; i--) {
+    if (params[i] && vals[i])
+      push(body->cdr->car, new_temp_decl(p, params[i], vals[i]));
+  }
+}
+
+/* scope of stat, whose value is val */
+static HIR*
+new_value_scope(hpc_state *p, HIR *decls, HIR *loop, HIR *val)
+{
+  HIR *hir = new_scope(p, decls, new_block(p, list2(loop, val)));
+  hir->lat = val->lat;
+  return hir;
+}
+
+/*
+  Float array kernels
+
+  A loop over arrays of Floats, e.g. saxpy:
+    n.times {|i| y[i] = a * x[i] + y[i] }
+  is typed once more with the elements of the arrays at the counter as
+  Floats, so that C computes the body on unboxed doubles:
+    if (x and y have Floats in [0, n))
+      DOALL(i, 0, n, body with mrb_float(RARRAY_PTR(x)[i])...)
+    else
+      DOALL(i, 0, n, body)
+  The body must not call methods which can change the arrays and must
+  store only Floats into arrays, so that the check before the loop holds
+  in every iteration.
+ */
+
+struct float_kernel {
+  mrb_sym counter;
+  int typed;                    /* elements are typed (see typing_float_elem) */
+  HIR *arrays;                  /* arrays in variables indexed by the counter */
+  HIR *reads;                   /* the arrays read */
+  HIR *assigned;                /* variables assigned */
+};
+
+/*
+  Returns FALSE if the body can change the arrays other than by storing
+  elements.  Before the elements are typed, receivers of calls are not
+  checked since lattices of the results of [] are unknown.
+ */
+static int
+scan_float_kernel(hpc_state *p, HIR *hir, struct float_kernel *k)
+{
+  mrb_state *mrb = p->mrb;
+  HIR *list, *recv, *args;
+  const char *name;
+  int read;
+
+  if (!hir)
+    return TRUE;
+  switch ((intptr_t)hir->car) {
+  case HIR_SCOPE:
+    for (list = hir->cdr->car; list; list = list->cdr) {
+      if (!scan_float_kernel(p, list->car, k))
+        return FALSE;
+    }
+    return scan_float_kernel(p, hir->cdr->cdr, k);
+  case HIR_LVARDECL:
+    return scan_float_kernel(p, hir->cdr->cdr->cdr->car, k);
+  case HIR_BLOCK:
+    for (list = hir->cdr->car; list; list = list->cdr) {
+      if (!scan_float_kernel(p, list->car, k))
+        return FALSE;
     }
+    return TRUE;
+  case HIR_ASSIGN:
+    if (hir->cdr->car->car == (HIR*)HIR_LVAR) {
+      if (sym(hir->cdr->car->cdr) == k->counter)
+        return FALSE;
+      push(k->assigned, hir->cdr->car);
+    }
+    return scan_float_kernel(p, hir->cdr->cdr->car, k);
+  case HIR_IFELSE:
+  case HIR_COND_OP:
+    for (list = hir->cdr; list; list = list->cdr) {
+      if (!scan_float_kernel(p, list->car, k))
+        return FALSE;
+    }
+    return TRUE;
+  case HIR_CALL:
+    recv = hir->cdr->cdr->car;
+    args = hir->cdr->cdr->cdr;
+    name = mrb_sym2name(mrb, sym(hir->cdr->car));
+    if (strcmp(name, "[]") == 0 || strcmp(name, "[]=") == 0) {
+      if (lat_class_of(mrb, recv->lat) != mrb->array_class)
+        return FALSE;
+      read = strcmp(name, "[]") == 0;
+      if (recv->car == (HIR*)HIR_LVAR && args && args->car->car == (HIR*)HIR_LVAR &&
+          sym(args->car->cdr) == k->counter) {
+        if (!hir_member_p(k->arrays, recv))
+          push(k->arrays, recv);
+        if (read && !hir_member_p(k->reads, recv))
+          push(k->reads, recv);
+      }
+    }
+    /* functions of the runtime (hpc_*) do not change arrays, but a block can */
+    else if (k->typed && (strncmp(name, "hpc_", 4) != 0 || strcmp(name, "hpc_yield") == 0) &&
+             !hpc_lat_numeric_p(mrb, recv->lat) && !math_module_p(mrb, recv->lat)) {
+      return FALSE;
+    }
+    for (list = hir->cdr->cdr; list; list = list->cdr) {
+      if (!scan_float_kernel(p, list->car, k))
+        return FALSE;
+    }
+    return TRUE;
+  case HIR_EMPTY:
+  case HIR_PRIM:
+  case HIR_INT:
+  case HIR_FLOAT:
+  case HIR_STRING:
+  case HIR_LVAR:
+  case HIR_GVAR:
+  case HIR_IVAR:
+  case HIR_CVAR:
+    return TRUE;
   default:
-    NOT_IMPLEMENTED();
+    /* loops, calls of user methods and returns */
+    return FALSE;
   }
 }
 
+/* arrays of the body to type as Float arrays, 0 if none */
 static HIR*
-typing_def(hpc_scope *s, node *ast, int sdefp)
+float_kernel_arrays(hpc_state *p, HIR *body, struct float_kernel *k)
+{
+  HIR *arrays, *result = 0;
+
+  k->arrays = k->reads = k->assigned = 0;
+  if (!scan_float_kernel(p, body, k))
+    return 0;
+  for (arrays = k->arrays; arrays; arrays = arrays->cdr) {
+    if (!hir_member_p(k->assigned, arrays->car))
+      push(result, arrays->car);
+  }
+  return result;
+}
+
+/*
+  Elements of the arrays in p->float_arrays at the counter of the
+  kernel being typed (see typing_doall).  Returns 0 if the call is not
+  such an element access.
+ */
+static HIR*
+typing_float_elem(hpc_scope *s, HIR *recv, mrb_sym mid, HIR *args)
 {
   hpc_state *p = s->hpc;
-  mrb_sym name = sym(ast->car);
-  node *mandatory_params = ast->cdr->cdr->car->car;
-  node *lv_tree = ast->cdr->car;
-  node *n_body = ast->cdr->cdr->cdr->car;
-  HIR *params = 0, *body, *last, *param;
-  hpc_scope *scope;
-  mrb_sym self_sym;
+  mrb_state *mrb = s->mrb;
+  const char *name = mrb_sym2name(mrb, mid);
+  int argc = hir_len(args);
+
+  if (strcmp(name, "[]=") == 0 && argc == 2 &&
+      numary_kind(mrb, lat_class_of(mrb, recv->lat)) == LNUM_NONE &&
+      lat_class_of(mrb, args->cdr->car->lat) != mrb->float_class) {
+    /* the array may be one of the arrays */
+    p->float_broken = TRUE;
+    return 0;
+  }
+  if (argc == 0 || !hir_member_p(p->float_arrays, recv) || args->car->car != (HIR*)HIR_LVAR ||
+      sym(args->car->cdr) != p->float_counter)
+    return 0;
+  if (strcmp(name, "[]") == 0 && argc == 1)
+    return new_call(p, mrb_intern_cstr(mrb, "hpc_ary_fref"), recv, args,
+                    lat_set_new1(mrb, mrb_float_value(0.0)));
+  if (strcmp(name, "[]=") == 0 && argc == 2)
+    return new_call(p, mrb_intern_cstr(mrb, "hpc_ary_fset"), recv, args, args->cdr->car->lat);
+  return 0;
+}
 
-  HIR *result = typing_block(s, lv_tree, mandatory_params, n_body, FALSE);
+/*
+  DOALL(counter, low, high, the block), low and high are variables.
+  Specialized for Float arrays if the body is a kernel.
+ */
+static HIR*
+typing_doall(hpc_scope *s, node *blk, HIR *low, HIR *high)
+{
+  hpc_state *p = s->hpc;
+  mrb_value counter_lat = lat_fixnum(p->mrb);
+  HIR *body, *counter, *fbody, *fcounter, *arrays, *cond, *check, *hir;
+  struct float_kernel k;
+  const char *guard;
+  HIR *outer_arrays = p->float_arrays;
+  mrb_sym outer_counter = p->float_counter;
+  int outer_broken = p->float_broken;
+  mrb_value *lats;
+
+  /* iterate until lattices of the outer variables are stable */
+  p->float_arrays = 0;
+  do {
+    lats = snapshot_lvs(s);
+    body = typing_iter_body(s, blk, 1, &counter_lat, &counter);
+  } while (lvs_changed(s, lats));
+
+  hir = 0;
+  arrays = 0;
+  if (counter) {
+    k.counter = sym(counter->cdr);
+    k.typed = FALSE;
+    arrays = float_kernel_arrays(p, body, &k);
+  }
+  if (arrays) {
+    p->float_arrays = arrays;
+    p->float_counter = k.counter;
+    p->float_broken = FALSE;
+    fbody = typing_iter_body(s, blk, 1, &counter_lat, &fcounter);
+    k.typed = TRUE;
+    if (!p->float_broken && scan_float_kernel(p, fbody, &k)) {
+      cond = 0;
+      for (; arrays; arrays = arrays->cdr) {
+        /* arrays only written need not have Floats yet */
+        guard = hir_member_p(k.reads, arrays->car) ? "hpc_ary_float_p" : "hpc_ary_inplace_p";
+        check = new_call(p, mrb_intern_cstr(p->mrb, guard), arrays->car,
+                         list2(low, high), lat_bool(p->mrb));
+        cond = cond ? new_cond_op(p, check, cond, new_prim(p, HPTYPE_FALSE)) : check;
+      }
+      hir = new_ifelse(p, cond, list5((HIR *)HIR_DOALL, fcounter, low, high, fbody),
+                       list5((HIR *)HIR_DOALL, counter, low, high, body));
+    }
+  }
+  p->float_arrays = outer_arrays;
+  p->float_counter = outer_counter;
+  p->float_broken = outer_broken;
+  if (hir)
+    return hir;
 
-  scope = (hpc_scope *)result->car;
-  self_sym = sym(scope->current_self->cdr);
-  scope_finish(scope);
+  if (!counter)
+    counter = new_temp(p, counter_lat);
+  return list5((HIR *)HIR_DOALL, counter, low, high, body);
+}
 
-  body = result->cdr;
+static HIR*
+typing_times(hpc_scope *s, HIR *recv, node *blk)
+{
+  hpc_state *p = s->hpc;
+  HIR *n = new_temp(p, recv->lat);
 
-  body = insert_return_at_last(p, body);
+  return new_value_scope(p, list1(new_temp_decl(p, n, recv)),
+                         typing_doall(s, blk, new_int_const(p, 0), n), n);
+}
 
-  /*
-    args
-    TODO: - support other than mrb_value (using info in scope)
-          - optional and block args
-  */
-  /* TODO: define self type from scope->current_self->lat */
-  params = last = cons(new_pvardecl(p, value_type, self_sym), 0);
+static HIR*
+typing_upto(hpc_scope *s, HIR *recv, HIR *last, node *blk)
+{
+  hpc_state *p = s->hpc;
+  HIR *a = new_temp(p, recv->lat), *b = new_temp(p, lat_fixnum(p->mrb));
 
-  while (mandatory_params) {
-    param = new_pvardecl(p, value_type, sym(mandatory_params->car->cdr));
-    last->cdr = cons(param, 0);
-    last = last->cdr;
-    mandatory_params = mandatory_params->cdr;
-  }
+  return new_value_scope(p, list2(new_temp_decl(p, a, recv),
+                                  new_temp_decl(p, b, new_int_op(p, "+", last,
+                                                                 new_int_const(p, 1)))),
+                         typing_doall(s, blk, a, b), a);
+}
 
-  /* TODO: inspect return type? */
-  return new_fundecl(p, sdefp, name, new_func_type(p, value_type, params), params, body);
+/* a.step(b, c) of Fixnums with a positive constant c */
+static HIR*
+typing_int_step(hpc_scope *s, HIR *recv, HIR *last, HIR *step, node *blk)
+{
+  hpc_state *p = s->hpc;
+  mrb_value counter_lat = lat_fixnum(p->mrb);
+  HIR *body, *i, *k = new_temp(p, counter_lat), *a = new_temp(p, recv->lat), *n;
+  mrb_value *lats;
+
+  do {
+    lats = snapshot_lvs(s);
+    body = typing_iter_body(s, blk, 1, &counter_lat, &i);
+  } while (lvs_changed(s, lats));
+
+  bind_params(p, body, &i, &(HIR *){new_int_op(p, "+", a, new_int_op(p, "*", k, step))}, 1);
+  n = new_int_op(p, "/", new_int_op(p, "+", new_int_op(p, "-", last, a), step), step);
+  return new_value_scope(p, list1(new_temp_decl(p, a, recv)),
+                        list5((HIR *)HIR_DOALL, k, new_int_const(p, 0), n, body), a);
 }
 
-static void
-add_def(hpc_scope *s, node *tree, int sdefp)
+/* a.step(b, c): t = a; while (t <= b) { i = t; t += c }, a is Float if b is */
+static HIR*
+typing_step(hpc_scope *s, HIR *recv, HIR *last, HIR *step, node *blk)
 {
   hpc_state *p = s->hpc;
-  HIR *fundecl = typing_def(s, tree, sdefp);
-  s->defs = cons(fundecl, s->defs);
+  mrb_state *mrb = p->mrb;
+  HIR *body, *i, *cond, *incr, *init = recv;
+  HIR *a = new_temp(p, recv->lat), *b = new_temp(p, last->lat);
+  HIR *c = new_temp(p, step->lat), *t;
+  mrb_value *lats, t_lat;
+
+  if (lat_class_of(mrb, last->lat) == mrb->float_class)
+    init = typing_call0(s, lat_recv_class(mrb, recv->lat), a, mrb_intern_cstr(mrb, "to_f"), 0, NULL);
+  t = new_temp(p, init->lat);
+  do {
+    lats = snapshot_lvs(s);
+    t_lat = t->lat;
+    body = typing_iter_body(s, blk, 1, &t->lat, &i);
+    incr = typing_call0(s, lat_recv_class(mrb, t->lat), t, mrb_intern_cstr(mrb, "+"), list1(c), NULL);
+    t->lat = lat_join(mrb, t->lat, incr->lat);
+  } while (lvs_changed(s, lats) || !lat_equal(mrb, t_lat, t->lat));
+
+  bind_params(p, body, &i, &t, 1);
+  cond = typing_call0(s, lat_recv_class(mrb, t->lat), t, mrb_intern_cstr(mrb, "<="), list1(b), NULL);
+  return new_value_scope(p, list4(new_temp_decl(p, a, recv), new_temp_decl(p, b, last),
+                                 new_temp_decl(p, c, step),
+                                 new_temp_decl(p, t, init == recv ? a : init)),
+                        list3((HIR *)HIR_WHILE, cond,
+                              new_block(p, list2(body, new_assign(p, t, incr)))), a);
 }
 
-/* collect ivs, cvs, methods defined in the given AST
-   register them to a new hpc_class with name */
-static hpc_class*
-collect_class_defs(hpc_scope *s, mrb_sym name, node *body)
+struct map_value {
+  hpc_scope *s;
+  HIR *res, *k;
+};
+
+/* res[k] = exp */
+static HIR*
+map_value(hpc_state *p, HIR *exp, void *ud)
+{
+  struct map_value *m = (struct map_value *)ud;
+  mrb_state *mrb = p->mrb;
+
+  if (!exp)
+    exp = new_prim(p, HPTYPE_NIL);
+  return typing_call0(m->s, lat_recv_class(mrb, m->res->lat), m->res,
+                      mrb_intern_cstr(mrb, "[]="), list2(m->k, exp), NULL);
+}
+
+/*
+  each, each_with_index and map of Array;
+  each, each_with_index and map! of FloatArray and IntArray
+ */
+static HIR*
+typing_ary_iter(hpc_scope *s, const char *name, HIR *recv, node *blk)
 {
   hpc_state *p = s->hpc;
-  hpc_class *class = hpc_class_new(p, name);
-  hpc_scope *class_scope = scope_new(p, s, 0, class, FALSE);
+  mrb_state *mrb = p->mrb;
+  struct RClass *c = lat_recv_class(mrb, recv->lat);
+  int numaryp = numary_kind(mrb, c) != LNUM_NONE;
+  int mapp = strcmp(name, "map") == 0 || strcmp(name, "collect") == 0;
+  int argc = strcmp(name, "each_with_index") == 0 ? 2 : 1;
+  HIR *a = new_temp(p, recv->lat), *k = new_temp(p, lat_fixnum(mrb)), *res = 0;
+  HIR *body, *params[2], *vals[2], *len, *decls;
+  mrb_value lats2[2], *lats;
+  struct map_value m;
+
+  vals[0] = typing_call0(s, numaryp ? c : mrb->array_class, a, mrb_intern_cstr(mrb, "[]"),
+                         list1(k), NULL);
+  vals[1] = k;
+  lats2[0] = vals[0]->lat;
+  lats2[1] = k->lat;
+  do {
+    lats = snapshot_lvs(s);
+    body = typing_iter_body(s, blk, argc, lats2, params);
+  } while (lvs_changed(s, lats));
+
+  bind_params(p, body, params, vals, argc);
+  decls = list2(new_temp_decl(p, a, recv), new_temp_decl(p, k, new_int_const(p, 0)));
+  if (mapp) {
+    res = new_temp(p, lat_set_new_class(mrb, mrb_obj_value(mrb->array_class)));
+    decls->cdr->cdr = list1(new_temp_decl(p, res, new_call(p, mrb_intern_cstr(mrb, "hpc_ary_new"),
+                                                           a, 0, res->lat)));
+  }
+  if (strcmp(name, "map!") == 0)
+    res = a;
+  if (res) {
+    m.s = s;
+    m.res = res;
+    m.k = k;
+    body = insert_at_last(p, body, map_value, &m);
+  }
+  len = new_call(p, mrb_intern_cstr(mrb, numaryp ? "hpc_numary_len" : "hpc_ary_len"), a, 0,
+                 lat_fixnum(mrb));
+  return new_value_scope(p, decls,
+                        list3((HIR *)HIR_WHILE,
+                              new_call(p, mrb_intern_cstr(mrb, "<"), k, list1(len), lat_bool(mrb)),
+                              new_block(p, list2(body,
+                                                 new_assign(p, k, new_int_op(p, "+", k, new_int_const(p, 1)))))),
+                        res ? res : a);
+}
 
-  class->initializer = typing(class_scope, body); /* collect defs */
-  class->methods = class_scope->defs;
-  scope_finish(class_scope);
+static int
+lat_fixnum_p(mrb_state *mrb, mrb_value lat)
+{
+  return lat_class_of(mrb, lat) == mrb->fixnum_class;
+}
 
-  push(p->classes, (HIR*)class);
-  return class;
+/*
+  call of an iterator inlined, or 0 if it is not known.
+  The receiver of an unknown lattice is assumed to be of the class
+  iterated; such a call is typed again after the lattices are inferred.
+ */
+static HIR*
+typing_iterator(hpc_scope *s, mrb_sym mid, HIR *recv, HIR *args, node *blk)
+{
+  mrb_state *mrb = s->mrb;
+  struct RClass *c = lat_class_of(mrb, recv->lat);
+  int unknown = LAT_HAS_TYPE(mrb, recv->lat, LAT_UNKNOWN);
+  const char *name = mrb_sym2name(mrb, mid);
+  int argc = hir_len(args);
+  HIR *step;
+
+  if (argc == 0 && strcmp(name, "times") == 0)
+    return typing_times(s, recv, blk);
+  if ((c == mrb->fixnum_class || unknown) && argc == 1 && strcmp(name, "upto") == 0) {
+    if (c == mrb->fixnum_class && lat_fixnum_p(mrb, args->car->lat))
+      return typing_upto(s, recv, args->car, blk);
+    return typing_step(s, recv, args->car, new_int_const(s->hpc, 1), blk);
+  }
+  if ((c == mrb->fixnum_class || c == mrb->float_class || unknown) &&
+      (argc == 1 || argc == 2) && strcmp(name, "step") == 0) {
+    step = argc == 2 ? args->cdr->car : new_int_const(s->hpc, 1);
+    if (c == mrb->fixnum_class && lat_fixnum_p(mrb, args->car->lat) &&
+        !LAT_P(mrb, step->lat) && mrb_fixnum_p(step->lat) && mrb_fixnum(step->lat) > 0)
+      return typing_int_step(s, recv, args->car, step, blk);
+    return typing_step(s, recv, args->car, step, blk);
+  }
+  if ((c == mrb->array_class || unknown) && argc == 0 &&
+      (strcmp(name, "each") == 0 || strcmp(name, "each_with_index") == 0 ||
+       strcmp(name, "map") == 0 || strcmp(name, "collect") == 0))
+    return typing_ary_iter(s, name, recv, blk);
+  if (numary_kind(mrb, c) != LNUM_NONE && argc == 0 &&
+      (strcmp(name, "each") == 0 || strcmp(name, "each_with_index") == 0 ||
+       strcmp(name, "map!") == 0))
+    return typing_ary_iter(s, name, recv, blk);
+  return 0;
 }
 
+/*
+  A method yielding to the block is inlined at the call-site with the
+  block; yield types the body of the block in the scope of the caller.
+  Variables of the method are renamed not to hide ones of the caller.
+ */
+
+#define INLINE_DEPTH_MAX 8
+
+/* var = exp */
 static HIR*
-typing(hpc_scope *s, node *tree)
+assign_value(hpc_state *p, HIR *exp, void *ud)
+{
+  return new_assign(p, (HIR *)ud, exp ? exp : new_prim(p, HPTYPE_NIL));
+}
+
+/* the value of yield: the body of the block */
+static HIR*
+typing_yield(hpc_scope *s, node *tree)
 {
-  if (!tree) return 0;
   hpc_state *p = s->hpc;
-  s->lineno = tree->lineno;
-  int type = (intptr_t)tree->car;
-  //parser_dump(p->mrb, tree, 0);
-  tree = tree->cdr;
-  switch (type) {
-    case NODE_SCOPE:
-      return typing_scope(s, tree);
-    case NODE_BEGIN:
-      {
-        HIR *stmts = 0, *last = 0, *stmt;
-        while (tree) {
-          stmt = typing(s, tree->car);
-          if (!stmts)
-            stmts = last = cons(stmt, 0);
-          else {
-            last->cdr = cons(stmt, 0);
-            last = last->cdr;
-          }
-          tree = tree->cdr;
+  struct hpc_inline *in = p->inlining;
+  HIR *args = 0, *last = 0, *body, *val, **params, **vals;
+  mrb_value *lats;
+  int i, argc;
+
+  for (; tree; tree = tree->cdr) {
+    HIR *arg = cons(typing_value(s, tree->car), 0);
+    if (last)
+      last->cdr = arg;
+    else
+      args = arg;
+    last = arg;
+  }
+  if (!in) {
+    /* the method is not inlined; the block is given by the VM, if any */
+    return new_call(p, mrb_intern_cstr(p->mrb, "hpc_yield"), s->current_self, args,
+                    lat_dynamic);
+  }
+
+  argc = hir_len(args);
+  lats = (mrb_value *)compiler_palloc(p, sizeof(mrb_value)*(argc+1));
+  params = (HIR **)compiler_palloc(p, sizeof(HIR *)*(argc+1));
+  vals = (HIR **)compiler_palloc(p, sizeof(HIR *)*(argc+1));
+  for (i = 0, last = args; last; i++, last = last->cdr) {
+    vals[i] = last->car;
+    lats[i] = last->car->lat;
+  }
+
+  /* yield in the block is of the method the caller is inlined in */
+  p->inlining = in->prev;
+  body = typing_iter_body(in->caller, in->blk, argc, lats, params);
+  p->inlining = in;
+  push(in->yields, body);
+
+  bind_params(p, body, params, vals, argc);
+  val = new_temp(p, lat_unknown);
+  body = insert_at_last(p, body, assign_value, val);
+  return new_value_scope(p, list1(new_temp_decl(p, val, 0)), body, val);
+}
+
+/* the variable renamed for the inlined method */
+static mrb_sym
+inline_sym(hpc_state *p, mrb_sym sym, int id)
+{
+  char name[256];
+
+  snprintf(name, sizeof(name), "%s__%d", mrb_sym2name(p->mrb, sym), id);
+  return mrb_intern(p->mrb, name);
+}
+
+static int rename_exps(hpc_state *p, HIR *exps, struct hpc_inline *in, int id);
+
+/*
+  Rename the declarations of the variables in in->lvars.
+  Returns FALSE if hir cannot be moved into another function.
+ */
+static int
+rename_decls(hpc_state *p, HIR *hir, struct hpc_inline *in, int id)
+{
+  HIR *decls;
+
+  if (!hir)
+    return TRUE;
+  switch ((intptr_t)hir->car) {
+  case HIR_SCOPE:
+    if (hir_member_p(in->yields, hir))
+      return TRUE;
+    for (decls = hir->cdr->car; decls; decls = decls->cdr) {
+      if (!rename_decls(p, decls->car, in, id))
+        return FALSE;
+    }
+    return rename_decls(p, hir->cdr->cdr, in, id);
+  case HIR_LVARDECL:
+    {
+      HIR *lvars;
+      mrb_sym name = sym(hir->cdr->cdr->car);
+      for (lvars = in->lvars; lvars; lvars = lvars->cdr) {
+        if (sym(lvars->car->cdr) == name) {
+          hir->cdr->cdr->car = hirsym(inline_sym(p, name, id));
+          break;
         }
-        return new_block(p, stmts);
       }
-    case NODE_CALL:
-    case NODE_FCALL:            /* when receiver is self */
-      return typing_call(s, tree);
-    case NODE_INT:
-      {
-        char *txt = (char*)tree->car;
-        int base = (intptr_t)tree->cdr->car;
-        mrb_int i;
-        int overflow;
-        i = readint_mrb_int(s, txt, base, FALSE, &overflow);
-        if (overflow) {
-          double f = readint_float(s, txt, base);
-          return new_float(p, txt, base, f);
-        } else {
-          return new_int(p, txt, base, i);
+      return rename_decls(p, hir->cdr->cdr->cdr->car, in, id);
+    }
+  case HIR_BLOCK:
+    return rename_exps(p, hir->cdr->car, in, id);
+  case HIR_ASSIGN:
+    return rename_decls(p, hir->cdr->car, in, id) && rename_decls(p, hir->cdr->cdr->car, in, id);
+  case HIR_IFELSE:
+  case HIR_COND_OP:
+  case HIR_DOALL:
+  case HIR_WHILE:
+    return rename_exps(p, hir->cdr, in, id);
+  case HIR_CALL:
+  case HIR_SCALL:
+  case HIR_NEW:
+    return rename_exps(p, hir->cdr->cdr, in, id);
+  case HIR_RETURN:
+    /* would return from the caller */
+    return FALSE;
+  case HIR_IVAR:
+  case HIR_CVAR:
+    /* accessed with self of the function */
+    return FALSE;
+  default:
+    return TRUE;
+  }
+}
+
+static int
+rename_exps(hpc_state *p, HIR *exps, struct hpc_inline *in, int id)
+{
+  for (; exps; exps = exps->cdr) {
+    if (!rename_decls(p, exps->car, in, id))
+      return FALSE;
+  }
+  return TRUE;
+}
+
+/*
+  The body of the method called with the block, or 0 if it cannot be
+  inlined:
+    ({ self' = recv; params' = args; body'; })
+ */
+static HIR*
+typing_inline_call(hpc_scope *s, mrb_sym mid, HIR *recv, HIR *args, node *blk)
+{
+  hpc_state *p = s->hpc;
+  mrb_state *mrb = s->mrb;
+  struct hpc_inline in;
+  hpc_class *class;
+  hpc_scope *scope;
+  node *def, *param;
+  int i, id, sdefp, argc = hir_len(args);
+  mrb_value *lats, *outer_lats;
+  HIR *result, *body, *val, *arg, *var, *lvars, *decls, *self, *lv;
+
+  class = lookup_method_def(s, recv, mid, argc, &def, &sdefp);
+  if (!class)
+    return 0;
+  in.prev = p->inlining;
+  in.depth = in.prev ? in.prev->depth + 1 : 1;
+  if (in.depth > INLINE_DEPTH_MAX)
+    return 0;
+  in.caller = s;
+  in.blk = blk;
+
+  lats = (mrb_value *)compiler_palloc(p, sizeof(mrb_value)*(argc+1));
+  for (i = 0, arg = args; arg; i++, arg = arg->cdr)
+    lats[i] = lat_widen(mrb, arg->car->lat);
+  val = new_temp(p, lat_unknown);
+
+  /* the block can change lattices of variables of the caller */
+  do {
+    outer_lats = snapshot_lvs(s);
+    in.lvars = in.yields = 0;
+    p->inlining = &in;
+    result = typing_block(s, class, lat_widen(mrb, recv->lat), def->cdr->car,
+                          def->cdr->cdr->car->car, lats, def->cdr->cdr->cdr->car);
+    p->inlining = in.prev;
+    scope = (hpc_scope *)result->car;
+    self = scope->current_self;
+    lv = scope->lv;
+    scope_finish(scope);
+  } while (lvs_changed(s, outer_lats));
+  body = insert_at_last(p, result->cdr, assign_value, val);
+
+  /* self and params are initialized with recv and args */
+  decls = list1(new_temp_decl(p, self, recv));
+  for (param = def->cdr->cdr->car->car, arg = args; param; param = param->cdr, arg = arg->cdr) {
+    var = find_var_list(lv, sym(param->car->cdr));
+    push(decls, new_temp_decl(p, var, arg->car));
+  }
+  body->cdr->car = append(p, decls, body->cdr->car);
+
+  id = p->temp_counter++;
+  if (!rename_decls(p, body, &in, id))
+    return 0;
+  for (lvars = in.lvars; lvars; lvars = lvars->cdr)
+    lvars->car->cdr = hirsym(inline_sym(p, sym(lvars->car->cdr), id));
+  return new_value_scope(p, list1(new_temp_decl(p, val, 0)), body, val);
+}
+
+/* call with a block */
+static HIR*
+typing_block_call(hpc_scope *s, mrb_sym mid, HIR *recv, HIR *args, node *blk)
+{
+  HIR *hir = typing_iterator(s, mid, recv, args, blk);
+
+  if (!hir)
+    hir = typing_inline_call(s, mid, recv, args, blk);
+  if (!hir)
+    unsupported(s);
+  return hir;
+}
+
+static HIR*
+typing_call_raw(hpc_scope *s, mrb_sym name, HIR *args_prefix, node *tree, HIR *args_suffix)
+{
+  HIR *args, *last;
+  hpc_state *p = s->hpc;
+
+  args = last = args_prefix;
+  while (last->cdr)
+    last = last->cdr;
+
+  if (tree) {
+    /* mandatory arg */
+    node *argtree = tree->car;
+    while (argtree) {
+      last->cdr = cons(typing_value(s, argtree->car), 0);
+      last = last->cdr;
+      argtree = argtree->cdr;
+    }
+    /* block arg */
+    if (tree->cdr) {
+      last->cdr = args_suffix;
+      return typing_block_call(s, name, args->car, args->cdr, tree->cdr);
+    }
+  }
+
+  last->cdr = args_suffix;
+
+  return typing_call0(s, lat_recv_class(s->mrb, args->car->lat), args->car, name,
+                      args->cdr, NULL);
+}
+
+static HIR*
+typing_call(hpc_scope *s, node *tree)
+{
+  HIR *recv = typing_value(s, tree->car);
+  mrb_sym name = sym(tree->cdr->car);
+  hpc_state *p = s->hpc;
+
+  return typing_call_raw(s, name, list1(recv), tree->cdr->cdr->car,  0);
+}
+
+/*
+  Constants
+
+  A constant assigned once by a statement of the program or of a class
+  body, not in a conditional nor in a loop, to a number computed from
+  literals and such constants is a static const of C.  Its value is
+  the lattice of the initializer given by the abstract interpreter, so
+  its reads fold into loop bounds and arithmetic.
+
+  The entries of const_defs are kept over the typing passes:
+    lat_unknown: the value is not typed yet
+    a number: the value of the static const
+    lat_dynamic: an ordinary global
+  An assignment found elsewhere while typing (e.g. in a block) makes
+  it an ordinary global, and the program is typed again if the
+  constant has been read as static.
+ */
+static void
+collect_const_defs(hpc_state *p, node *tree)
+{
+  node *stats, *lhs;
+  HIR *def;
+
+  if (!tree)
+    return;
+  switch ((intptr_t)tree->car) {
+    case NODE_SCOPE:
+      collect_const_defs(p, tree->cdr->cdr);
+      return;
+    case NODE_BEGIN:
+      for (stats = tree->cdr; stats; stats = stats->cdr)
+        collect_const_defs(p, stats->car);
+      return;
+    case NODE_CLASS:
+      collect_const_defs(p, tree->cdr->cdr->cdr->car->cdr);
+      return;
+    case NODE_MODULE:
+      collect_const_defs(p, tree->cdr->cdr->car->cdr);
+      return;
+    case NODE_ASGN:
+      lhs = tree->cdr->car;
+      if ((intptr_t)lhs->car != NODE_CONST)
+        return;
+      def = find_var_list(p->const_defs, sym(lhs->cdr));
+      if (def) {
+        def->lat = lat_dynamic;   /* assigned twice */
+        return;
+      }
+      def = cons((HIR*)lhs, hirsym(sym(lhs->cdr)));
+      def->lat = lat_unknown;
+      p->const_defs = cons(def, p->const_defs);
+      return;
+    default:
+      return;
+  }
+}
+
+/* a number computed from literals and static constants */
+static int
+const_exp_p(hpc_state *p, HIR *hir)
+{
+  mrb_state *mrb = p->mrb;
+  HIR *l;
+
+  if (LAT_TYPE(mrb, hir->lat) != LAT_CONST || lat_num(mrb, hir->lat) == LNUM_NONE)
+    return FALSE;
+  if (mrb_float_p(hir->lat) && (isnan(mrb_float(hir->lat)) || isinf(mrb_float(hir->lat))))
+    return FALSE;
+  switch ((intptr_t)hir->car) {
+    case HIR_INT:
+    case HIR_FLOAT:
+    case HIR_GVAR:
+      return TRUE;
+    case HIR_CALL:
+      /* operators and conversions folded by the interpreter */
+      for (l = hir->cdr->cdr; l; l = l->cdr) {
+        if (!const_exp_p(p, l->car))
+          return FALSE;
+      }
+      return TRUE;
+    default:
+      return FALSE;
+  }
+}
+
+/*
+  hpcmrb compiles no inheritance between classes: a class with a
+  superclass and the superclasses themselves are left to the VM with the
+  top level statements (see vm_main_stmt_p), and the compiled code gets
+  them by Object.const_get.
+ */
+static void
+collect_vm_classes(hpc_state *p, node *tree)
+{
+  node *stats, *super;
+
+  if (!tree)
+    return;
+  switch ((intptr_t)tree->car) {
+    case NODE_SCOPE:
+      collect_vm_classes(p, tree->cdr->cdr);
+      return;
+    case NODE_BEGIN:
+      for (stats = tree->cdr; stats; stats = stats->cdr)
+        collect_vm_classes(p, stats->car);
+      return;
+    case NODE_CLASS:
+      super = tree->cdr->cdr->car;
+      if (!super)
+        return;
+      p->vm_classes = cons(hirsym(sym(tree->cdr->car->cdr)), p->vm_classes);
+      if ((intptr_t)super->car == NODE_CONST)
+        p->vm_classes = cons(hirsym(sym(super->cdr)), p->vm_classes);
+      return;
+    default:
+      return;
+  }
+}
+
+static int
+vm_class_p(hpc_state *p, mrb_sym name)
+{
+  HIR *l;
+
+  for (l = p->vm_classes; l; l = l->cdr) {
+    if (sym(l->car) == name)
+      return TRUE;
+  }
+  return FALSE;
+}
+
+/* the value of the constant if it is static, otherwise lat_dynamic */
+static mrb_value
+static_const_lat(hpc_state *p, mrb_sym name)
+{
+  HIR *def = find_var_list(p->const_defs, name);
+
+  if (def && LAT_TYPE(p->mrb, def->lat) == LAT_CONST)
+    return def->lat;
+  return lat_dynamic;
+}
+
+/* lhs = rhs of a constant, 0 unless it is static */
+static HIR*
+typing_const_assign(hpc_scope *s, node *lhs, HIR *rhs)
+{
+  hpc_state *p = s->hpc;
+  HIR *def = find_var_list(p->const_defs, sym(lhs->cdr));
+  HIR *gvar;
+
+  if (!def || LAT_HAS_TYPE(p->mrb, def->lat, LAT_DYNAMIC))
+    return 0;
+  if ((node *)def->car != lhs || !const_exp_p(p, rhs)) {
+    if (LAT_TYPE(p->mrb, def->lat) == LAT_CONST)
+      p->consts_changed = TRUE;
+    def->lat = lat_dynamic;
+    return 0;
+  }
+  if (LAT_HAS_TYPE(p->mrb, def->lat, LAT_UNKNOWN))
+    def->lat = rhs->lat;
+  gvar = typing(s, lhs);
+  gvar->lat = def->lat;
+  return new_empty(p);
+}
+
+static HIR*
+typing_assign(hpc_scope *s, node *lhs, HIR *rhs)
+{
+  hpc_state *p = s->hpc;
+  switch ((intptr_t)lhs->car) {
+  case NODE_LVAR:
+    /* not lookup_lvar: this is not a read */
+    return new_assign(p, find_var_list(s->lv, sym(lhs->cdr)), rhs);
+  case NODE_IVAR:
+  case NODE_CVAR:
+    {
+      /* the lattice is fixed while typing; record the value for compile */
+      HIR *ivar = (intptr_t)lhs->car == NODE_IVAR ?
+        lookup_ivar(s->class, sym(lhs->cdr)) : lookup_cvar(s->class, sym(lhs->cdr));
+      HIR *write = cons((HIR*)s->class, ivar);
+      HIR *hir = list3((HIR*)HIR_ASSIGN, ivar, rhs);
+      write->lat = rhs->lat;
+      push(p->ivar_writes, write);
+      hir->lat = rhs->lat;
+      return hir;
+    }
+  case NODE_CONST:
+    {
+      HIR *hir = typing_const_assign(s, lhs, rhs);
+      if (hir)
+        return hir;
+    }
+    return new_assign(p, typing(s, lhs), rhs);
+  case NODE_GVAR:
+    return new_assign(p, typing(s, lhs), rhs);
+  case NODE_CALL:
+    {
+      HIR *recv = typing(s, lhs->cdr->car);
+      return typing_call_raw(s, attrsym(p, sym(lhs->cdr->cdr->car)), list1(recv), lhs->cdr->cdr->cdr->car,  list1(rhs));
+    }
+  default:
+    unsupported(s);
+    return 0;
+  }
+}
+
+/* join the lattices of values returned in stat */
+static mrb_value
+return_lat(mrb_state *mrb, HIR *stat, mrb_value lat)
+{
+  HIR *stats;
+
+  if (!stat)
+    return lat;
+  switch ((intptr_t)stat->car) {
+  case HIR_SCOPE:
+    return return_lat(mrb, stat->cdr->cdr, lat);
+  case HIR_BLOCK:
+    for (stats = stat->cdr->car; stats; stats = stats->cdr)
+      lat = return_lat(mrb, stats->car, lat);
+    return lat;
+  case HIR_IFELSE:
+    lat = return_lat(mrb, stat->cdr->cdr->car, lat);
+    return return_lat(mrb, stat->cdr->cdr->cdr->car, lat);
+  case HIR_DOALL:
+    return return_lat(mrb, stat->cdr->cdr->cdr->cdr->car, lat);
+  case HIR_WHILE:
+    return return_lat(mrb, stat->cdr->cdr->car, lat);
+  case HIR_RETURN:
+    return lat_join(mrb, lat, stat->lat);
+  default:
+    return lat;
+  }
+}
+
+/*
+  Type a method for the given lattices of self and params.
+  param_lats: NULL if they can be anything
+  ret_lat: set the lattice of the return value unless NULL;
+           NULL for a generic method, whose params are boxed
+ */
+static HIR*
+typing_method(hpc_scope *s, hpc_class *class, node *ast, int sdefp,
+              mrb_value self_lat, mrb_value *param_lats, mrb_value *ret_lat)
+{
+  hpc_state *p = s->hpc;
+  HIR *writes = p->ivar_writes, *fundecl;
+  mrb_sym name = sym(ast->car);
+  node *mandatory_params = ast->cdr->cdr->car->car;
+  node *lv_tree = ast->cdr->car;
+  node *n_body = ast->cdr->cdr->cdr->car;
+  HIR *params = 0, *body, *last, *param, *ret_type = value_type;
+  hpc_scope *scope;
+  mrb_sym self_sym;
+  int i;
+
+  HIR *result;
+
+  p->ivar_writes = 0;
+  result = typing_block(s, class, self_lat, lv_tree, mandatory_params,
+                        param_lats, n_body);
+
+  scope = (hpc_scope *)result->car;
+  self_sym = sym(scope->current_self->cdr);
+  scope_finish(scope);
+
+  body = result->cdr;
+
+  body = insert_return_at_last(p, body);
+
+  if (ret_lat) {
+    *ret_lat = return_lat(p->mrb, body, lat_unknown);
+    ret_type = infer_type(p, *ret_lat);
+  }
+
+  /*
+    args
+    TODO: - optional and block args
+  */
+  params = last = cons(new_pvardecl(p, value_type, self_sym), 0);
+
+  for (i = 0; mandatory_params; i++) {
+    HIR *type = ret_lat ? infer_type(p, param_lats[i]) : value_type;
+    param = new_pvardecl(p, type, sym(mandatory_params->car->cdr));
+    if (ret_lat)
+      param->lat = param_lats[i];
+    last->cdr = cons(param, 0);
+    last = last->cdr;
+    mandatory_params = mandatory_params->cdr;
+  }
+
+  fundecl = new_fundecl(p, sdefp, name, new_func_type(p, ret_type, params), params, body);
+
+  push(p->fun_writes, cons(fundecl, p->ivar_writes));
+  p->ivar_writes = writes;
+  return fundecl;
+}
+
+/*
+  Lattices of params of a method called through multiplexers: the join of
+  args at the call-sites found in the previous typing (see compile), of
+  the profile and of the summary.  NULL if they can be anything.
+ */
+static mrb_value*
+generic_param_lats(hpc_state *p, mrb_sym class_name, node *ast, int sdefp)
+{
+  int i, argc = mandatory_argc(ast);
+  HIR *entries, *entry;
+  mrb_value *lats;
+
+  if (p->lats_given_up || argc < 0)
+    return NULL;
+  for (entries = p->param_lats; entries; entries = entries->cdr) {
+    if (entries->car->car->car == (HIR*)ast)
+      return (mrb_value *)entries->car->car->cdr;
+  }
+  lats = (mrb_value *)compiler_palloc(p, sizeof(mrb_value)*(argc+1));
+  for (i = 0; i < argc; i++) {   /* lat_unknown if not called yet */
+    enum profile_kind kind = sdefp ? PROFILE_SPARAM : PROFILE_PARAM;
+    lats[i] = lat_join(p->mrb, profile_lat(p, kind, class_name, sym(ast->car), i),
+                       summary_lat(p, kind, class_name, sym(ast->car), i));
+  }
+  /* the summary is written after the ast is freed */
+  entry = cons(cons((HIR*)ast, (HIR*)lats),
+               cons(cons(hirsym(class_name), hirsym(sym(ast->car))),
+                    cons((HIR*)(intptr_t)sdefp, (HIR*)(intptr_t)argc)));
+  push(p->param_lats, entry);
+  return lats;
+}
+
+/* multiplexers call a method only for instances of the class (or the class) */
+static mrb_value
+generic_self_lat(hpc_scope *s, int sdefp)
+{
+  mrb_state *mrb = s->mrb;
+  mrb_value klass;
+
+  if (!s->class->name)
+    return lat_dynamic;         /* toplevel methods are called for any self */
+  klass = mrb_const_get(mrb, mrb_obj_value(mrb->object_class), s->class->name);
+  return sdefp ? klass : lat_set_new_class(mrb, klass);
+}
+
+/*
+  typing_method, or 0 if the method uses what hpcmrb does not compile
+  (see unsupported).  The state of the typing is restored in that case.
+ */
+static HIR*
+try_typing_method(hpc_scope *s, hpc_class *class, node *ast, int sdefp,
+                  mrb_value self_lat, mrb_value *param_lats, mrb_value *ret_lat)
+{
+  hpc_state *p = s->hpc;
+  jmp_buf jmp, *prev = p->fallback;
+  HIR *ivar_writes = p->ivar_writes, *float_arrays = p->float_arrays;
+  HIR *ivs = class->ivs, *cvs = class->cvs;
+  struct hpc_inline *inlining = p->inlining;
+  int float_broken = p->float_broken;
+  HIR *fundecl;
+
+  p->fallback = &jmp;
+  if (setjmp(jmp) != 0) {
+    p->fallback = prev;
+    p->ivar_writes = ivar_writes;
+    p->float_arrays = float_arrays;
+    p->float_broken = float_broken;
+    p->inlining = inlining;
+    class->ivs = ivs;
+    class->cvs = cvs;
+    return 0;
+  }
+  fundecl = typing_method(s, class, ast, sdefp, self_lat, param_lats, ret_lat);
+  p->fallback = prev;
+  return fundecl;
+}
+
+static HIR*
+typing_def(hpc_scope *s, node *ast, int sdefp)
+{
+  mrb_value *param_lats = generic_param_lats(s->hpc, s->class->name, ast, sdefp);
+  mrb_value self_lat = param_lats ? generic_self_lat(s, sdefp) : lat_dynamic;
+
+  /* optional, rest and block params are left to the VM */
+  if (mandatory_argc(ast) < 0)
+    return 0;
+  return try_typing_method(s, s->class, ast, sdefp, self_lat, param_lats, NULL);
+}
+
+/*
+  Methods left to the VM
+
+  A method hpcmrb cannot compile is compiled to RITE bytecode by the
+  mruby code generator and defined at startup (see hpc_vm_program).  The
+  compiled code calls it through mrb_funcall, and it calls the compiled
+  methods through wrappers registered to the VM (see codegen).
+ */
+
+static mrb_sym
+def_name(node *def)
+{
+  if ((intptr_t)def->car == NODE_SDEF)
+    return sym(def->cdr->cdr->car);
+  return sym(def->cdr->car);
+}
+
+static int
+vm_method_p(hpc_state *p, mrb_sym mid)
+{
+  HIR *m;
+
+  for (m = p->vm_methods; m; m = m->cdr) {
+    if (def_name((node *)m->car->cdr) == mid)
+      return TRUE;
+  }
+  return FALSE;
+}
+
+static void
+add_vm_method(hpc_scope *s, node *def)
+{
+  hpc_state *p = s->hpc;
+  HIR *m;
+
+  for (m = p->vm_methods; m; m = m->cdr) {
+    if (m->car->cdr == (HIR*)def)
+      return;
+  }
+  push(p->vm_methods, cons((HIR*)s->class, (HIR*)def));
+}
+
+/* a call through a multiplexer; those to vm_methods are kept at last */
+static void
+add_vm_call(hpc_state *p, mrb_sym mid, int argc)
+{
+  HIR *c;
+
+  for (c = p->vm_calls; c; c = c->cdr) {
+    if (sym(c->car->car) == mid && (intptr_t)c->car->cdr == argc)
+      return;
+  }
+  push(p->vm_calls, cons(hirsym(mid), (HIR*)(intptr_t)argc));
+}
+
+/*
+  Speculative specialization
+
+  When the lattice of a param is not a single class but the profile
+  observed only one, a clone is typed for it.  The multiplexer calls the
+  clone if the args pass guards on their classes, and the generic
+  method otherwise (see put_multiplexers).
+ */
+
+/* a single class codegen can check cheaply */
+static int
+guardable_lat_p(hpc_state *p, mrb_value lat)
+{
+  mrb_state *mrb = p->mrb;
+  struct RClass *c = lat_class_of(mrb, lat);
+
+  if (!c)
+    return FALSE;
+  if (c == mrb->fixnum_class || c == mrb->float_class)
+    return TRUE;
+  return user_class_p(p, mrb_obj_value(c));
+}
+
+static void
+speculate(hpc_scope *s, node *def, int sdefp)
+{
+  hpc_state *p = s->hpc;
+  mrb_state *mrb = s->mrb;
+  hpc_class *class = s->class;
+  mrb_sym mid = sym(def->car);
+  int i, argc = mandatory_argc(def), guarded = FALSE;
+  mrb_value *lats = generic_param_lats(p, class->name, def, sdefp);
+  HIR *args = 0, *arg;
+  hpc_clone *clone;
+
+  if (!p->profile || argc <= 0 || mid == mrb->init_sym)
+    return;
+  for (i = argc - 1; i >= 0; i--) {
+    mrb_value lat = lats ? lats[i] : lat_dynamic;
+    mrb_value observed = profile_lat(p, sdefp ? PROFILE_SPARAM : PROFILE_PARAM,
+                                     class->name, mid, i);
+    if (LAT_TYPE(mrb, lat) == LAT_UNKNOWN)
+      lat = lat_dynamic;
+    if (!guardable_lat_p(p, lat) && guardable_lat_p(p, observed)) {
+      lat = observed;
+      guarded = TRUE;
+    }
+    arg = new_empty(p);
+    arg->lat = lat;
+    push(args, arg);
+  }
+  if (!guarded)
+    return;
+  clone = specialize(s, class, def, sdefp, generic_self_lat(s, sdefp), args);
+  if (clone)
+    push(class->speculations, (HIR *)clone);
+}
+
+static void
+add_def(hpc_scope *s, node *tree, int sdefp, node *whole)
+{
+  hpc_state *p = s->hpc;
+  HIR *fundecl = typing_def(s, tree, sdefp);
+  HIR *defs;
+
+  if (!fundecl) {
+    add_vm_method(s, whole);
+    return;
+  }
+  s->defs = cons(fundecl, s->defs);
+  speculate(s, tree, sdefp);
+
+  /* remember the AST to specialize it at call-sites */
+  for (defs = s->class->method_defs; defs; defs = defs->cdr) {
+    if (defs->car->car == (HIR*)tree)
+      return;
+  }
+  push(s->class->method_defs, cons((HIR*)tree, (HIR*)(intptr_t)sdefp));
+}
+
+/*
+  attr_reader, attr_writer and attr_accessor in a class body are
+  replaced with the defs of the readers and writers, which are compiled
+  and inlined like those written by hand (see inline_accessors).
+ */
+
+static node*
+new_ast(hpc_state *p, node *car, node *cdr, int lineno)
+{
+  node *n = (node *)compiler_palloc(p, sizeof(node));
+
+  n->car = car;
+  n->cdr = cdr;
+  n->lineno = lineno;
+  return n;
+}
+
+#define AST(car, cdr)           new_ast(p, (node*)(car), (node*)(cdr), lineno)
+#define AST_LIST1(a)            AST(a, 0)
+#define AST_LIST4(a, b, c, d)   AST(a, AST(b, AST(c, AST_LIST1(d))))
+
+/* (:def name lv (m opt rest m2 . blk) body) */
+static node*
+new_attr_def(hpc_state *p, mrb_sym name, node *lv, node *params, node *stat, int lineno)
+{
+  node *args = AST(params, AST(0, AST(0, AST(0, 0))));
+
+  return AST(NODE_DEF, AST_LIST4(hirsym(name), lv, args, AST(NODE_BEGIN, AST_LIST1(stat))));
+}
+
+/* def x; @x; end and def x=(x); @x = x; end */
+static node*
+attr_defs(hpc_state *p, mrb_sym name, int readerp, int writerp, int lineno)
+{
+  mrb_state *mrb = p->mrb;
+  const char *s = mrb_sym2name(mrb, name);
+  char *buf = (char *)compiler_palloc(p, strlen(s) + 2);
+  node *ivar, *defs = 0;
+
+  buf[0] = '@';
+  strcpy(buf + 1, s);
+  ivar = AST(NODE_IVAR, hirsym(mrb_intern_cstr(mrb, buf)));
+  if (writerp)
+    defs = AST(new_attr_def(p, attrsym(p, name), AST_LIST1(hirsym(name)),
+                            AST_LIST1(AST(NODE_ARG, hirsym(name))),
+                            AST(NODE_ASGN, AST(ivar, AST(NODE_LVAR, hirsym(name)))), lineno),
+               defs);
+  if (readerp)
+    defs = AST(new_attr_def(p, name, 0, 0, ivar, lineno), defs);
+  return defs;
+}
+
+static void
+expand_attrs(hpc_state *p, node *body)
+{
+  mrb_state *mrb = p->mrb;
+  node *l, *next, *args, *defs, *last, *d;
+
+  if (!body || (intptr_t)body->car != NODE_BEGIN)
+    return;
+  for (l = body->cdr; l; l = next) {
+    /* (:call self mid (args . blk)) */
+    node *call = l->car;
+    int readerp, writerp, lineno;
+    const char *mid;
+
+    next = l->cdr;
+    if (!call || ((intptr_t)call->car != NODE_CALL && (intptr_t)call->car != NODE_FCALL) ||
+        (intptr_t)call->cdr->car->car != NODE_SELF || !call->cdr->cdr->cdr->car)
+      continue;
+    mid = mrb_sym2name(mrb, sym(call->cdr->cdr->car));
+    readerp = strcmp(mid, "attr_reader") == 0 || strcmp(mid, "attr_accessor") == 0;
+    writerp = strcmp(mid, "attr_writer") == 0 || strcmp(mid, "attr_accessor") == 0;
+    if (!readerp && !writerp)
+      continue;
+    lineno = call->lineno;
+    defs = last = 0;
+    for (args = call->cdr->cdr->cdr->car->car; args; args = args->cdr) {
+      if ((intptr_t)args->car->car != NODE_SYM)
+        break;
+      d = attr_defs(p, sym(args->car->cdr), readerp, writerp, lineno);
+      if (last)
+        last->cdr = d;
+      else
+        defs = d;
+      for (last = d; last->cdr; last = last->cdr)
+        ;
+    }
+    if (args || !defs)
+      continue;                 /* left as it is, e.g. attr_reader "x" */
+    last->cdr = next;
+    l->car = defs->car;
+    l->cdr = defs->cdr;
+  }
+}
+
+/* collect ivs, cvs, methods defined in the given AST
+   register them to a new hpc_class with name */
+static hpc_class*
+collect_class_defs(hpc_scope *s, mrb_sym name, node *body, int modulep)
+{
+  hpc_state *p = s->hpc;
+  hpc_class *class = hpc_class_new(p, name);
+  hpc_scope *class_scope = scope_new(p, s, 0, class, FALSE);
+  mrb_value top = mrb_obj_value(p->mrb->object_class);
+
+  /* to know lattices of the class and its instances */
+  if (!mrb_const_defined(p->mrb, top, name)) {
+    if (modulep)
+      mrb_define_module(p->mrb, mrb_sym2name(p->mrb, name));
+    else
+      mrb_define_class(p->mrb, mrb_sym2name(p->mrb, name), p->mrb->object_class);
+  }
+
+  /* methods can be specialized while typing the body */
+  push(p->classes, (HIR*)class);
+  expand_attrs(p, body);
+  class->initializer = typing(class_scope, body); /* collect defs */
+  class->methods = class_scope->defs;
+  scope_finish(class_scope);
+
+  return class;
+}
+
+/* the variable of a global or a constant */
+static HIR*
+lookup_global(hpc_state *p, mrb_sym name, int constp)
+{
+  HIR *gvar = find_var_list(p->gvars, name);
+
+  if (!gvar) {
+    mrb_value lat = lat_dynamic;
+    mrb_value top = mrb_obj_value(p->mrb->object_class);
+    if (constp)
+      lat = static_const_lat(p, name);
+    /* builtin classes and modules, e.g. Math */
+    if (constp && mrb_const_defined(p->mrb, top, name))
+      lat = mrb_const_get(p->mrb, top, name);
+    gvar = new_gvar(p, name, lat);
+    p->gvars = cons(gvar, p->gvars);
+  }
+  return gvar;
+}
+
+static HIR*
+typing(hpc_scope *s, node *tree)
+{
+  if (!tree) return 0;
+  hpc_state *p = s->hpc;
+  node *whole = tree;
+  s->lineno = tree->lineno;
+  int type = (intptr_t)tree->car;
+  //parser_dump(p->mrb, tree, 0);
+  tree = tree->cdr;
+  switch (type) {
+    case NODE_SCOPE:
+      return typing_scope(s, tree);
+    case NODE_BEGIN:
+      {
+        HIR *stmts = 0, *last = 0, *stmt;
+        while (tree) {
+          stmt = typing(s, tree->car);
+          if (!stmts)
+            stmts = last = cons(stmt, 0);
+          else {
+            last->cdr = cons(stmt, 0);
+            last = last->cdr;
+          }
+          tree = tree->cdr;
+        }
+        stmt = new_block(p, stmts);
+        /* (a + b) * c uses the value of the last statement */
+        stmt->lat = last ? last->car->lat : mrb_nil_value();
+        return stmt;
+      }
+    case NODE_CALL:
+    case NODE_FCALL:            /* when receiver is self */
+      return typing_call(s, tree);
+    case NODE_INT:
+      {
+        char *txt = compiler_strndup(p, (char*)tree->car, strlen((char*)tree->car));
+        int base = (intptr_t)tree->cdr->car;
+        mrb_int i;
+        int overflow;
+        i = readint_mrb_int(s, txt, base, FALSE, &overflow);
+        if (overflow) {
+          double f = readint_float(s, txt, base);
+          return new_float(p, txt, base, f);
+        } else {
+          return new_int(p, txt, base, i);
+        }
+      }
+    case NODE_FLOAT:
+      return new_float(p, compiler_strndup(p, (char *)tree, strlen((char *)tree)), 10,
+                       str_to_mrb_float((char *)tree));
+    case NODE_DEF:
+      /* This node will be translated later using information of call-sites */
+      add_def(s, tree, FALSE, whole);
+      return new_empty(p);
+    case NODE_SDEF:
+      add_def(s, tree->cdr, TRUE, whole);
+      return new_empty(p);
+    case NODE_IF:
+      {
+        HIR *ifthen = 0, *ifelse = 0, *cond = typing(s, tree->car);
+        hpc_scope *s2 = scope_dup(s);
+        if (tree->cdr->car)
+          ifthen = typing(s, tree->cdr->car);
+        if (tree->cdr->cdr->car)
+          ifelse = typing(s2, tree->cdr->cdr->car);
+        join_scope(s, s2);
+        return new_ifelse(p, cond, ifthen, ifelse);
+      }
+    case NODE_LVAR:
+      return lookup_lvar(s, sym(tree));
+    case NODE_IVAR:
+      return lookup_ivar(s->class, sym(tree));
+    case NODE_CVAR:
+      return lookup_cvar(s->class, sym(tree));
+    case NODE_SELF:
+      return s->current_self;
+    case NODE_YIELD:
+      return typing_yield(s, tree);
+    case NODE_RETURN:
+      if (tree) {
+        return new_return_value(p, typing_value(s, tree));
+      } else {
+        return new_return_void(p);
+      }
+    case NODE_ASGN:
+      return typing_assign(s, tree->car, typing_value(s, tree->cdr));
+    case NODE_MASGN:
+      if ((intptr_t)tree->cdr->car != NODE_ARRAY) {
+        unsupported(s);
+      }
+      {
+        HIR *assigns = 0;
+        node *lhs = tree->car->car;
+        node *rhs = tree->cdr->cdr;
+        HIR *temps = 0;
+
+        while (rhs) {
+          mrb_sym temp = temp_sym(p);
+          HIR *hir_rhs = typing_value(s, rhs->car);
+          HIR *lvar = new_lvar(p, temp, hir_rhs->lat);
+
+          unshift(assigns, new_lvardecl(p, hir_rhs->lat, temp, hir_rhs));
+          unshift(temps, lvar);
+
+          rhs = rhs->cdr;
+        }
+        while (lhs) {
+          unshift(assigns, typing_assign(s, lhs->car, temps->car));
+          lhs = lhs->cdr;
+          temps = temps->cdr;
+        }
+        return new_block(p, assigns);
+      }
+    case NODE_CONST:
+      if (vm_class_p(p, sym(tree))) {
+        HIR *name = new_str(p, (char *)mrb_sym2name(p->mrb, sym(tree)),
+                            (int)strlen(mrb_sym2name(p->mrb, sym(tree))));
+        return new_call(p, mrb_intern(p->mrb, "const_get"),
+                        lookup_global(p, mrb_intern(p->mrb, "Object"), TRUE),
+                        list1(name), lat_dynamic);
+      }
+      return lookup_global(p, sym(tree), TRUE);
+    case NODE_GVAR:
+      return lookup_global(p, sym(tree), FALSE);
+    case NODE_MODULE:
+      {
+        mrb_sym class_name = sym(tree->car->cdr);
+        hpc_class *c = collect_class_defs(s, class_name, tree->cdr->car->cdr, TRUE);
+        c->ast = whole;
+        c->modulep = TRUE;
+        lookup_global(p, class_name, TRUE);
+        return new_defclass(p, c);
+      }
+    case NODE_CLASS:
+      {
+        mrb_sym class_name = sym(tree->car->cdr);
+        hpc_class *c;
+
+        if (vm_class_p(p, class_name))
+          unsupported(s);
+        c = collect_class_defs(s, class_name, tree->cdr->cdr->car->cdr, FALSE);
+        c->ast = whole;
+        /* declared even if only the VM refers to the class */
+        lookup_global(p, class_name, TRUE);
+        return new_defclass(p, c);
+      }
+    case NODE_STR:
+      return new_str(p, compiler_strndup(p, (char*)tree->car, (intptr_t)tree->cdr),
+                     (int)(intptr_t)tree->cdr);
+    case NODE_AND:
+      /* (lhs ? rhs : lhs) */
+      {
+        HIR *lhs = typing_value(s, tree->car);
+        HIR *rhs = typing_value(s, tree->cdr);
+        return new_cond_op(p, lhs, rhs, lhs);
+      }
+    case NODE_OR:
+      /* (lhs ? lhs : rhs) */
+      {
+        HIR *lhs = typing_value(s, tree->car);
+        HIR *rhs = typing_value(s, tree->cdr);
+        return new_cond_op(p, lhs, lhs, rhs);
+      }
+    case NODE_FALSE:
+      return new_prim(p, HPTYPE_FALSE);
+    case NODE_TRUE:
+      return new_prim(p, HPTYPE_TRUE);
+    case NODE_NEGATE:
+      /* NEGATE is only for literal */
+      {
+        HIR *child = typing(s, tree);
+        char *old_lit = (char *)child->cdr->car;
+        char *new_lit = compiler_palloc(p, strlen(old_lit) + 2);
+        hpc_assert((intptr_t)child->car == HIR_INT
+                   || (intptr_t)child->car == HIR_FLOAT);
+        sprintf(new_lit, "-%s", old_lit);
+        child->cdr->car = (HIR *)new_lit;
+        if (mrb_fixnum_p(child->lat))
+          child->lat = mrb_fixnum_value(-mrb_fixnum(child->lat));
+        else
+          child->lat = mrb_float_value(-mrb_float(child->lat));
+        return child;
+      }
+    default:
+      unsupported(s);
+      return 0;
+  }
+}
+
+/*
+  Lattices over the whole program
+
+  Lattices of ivars and params of methods called through multiplexers
+  are assumed while typing.  After typing, the values assigned to them
+  in the reachable code are joined into the assumptions, and the program
+  is typed again until the assumptions hold.
+  Values depending on lattices not inferred yet are LAT_UNKNOWN, which
+  calls are not made with.
+ */
+
+#define TYPING_PASSES_MAX 16
+#define INIT_IVARS_MAX 64
+
+/* join lat into *assumed; returns TRUE if it is changed */
+static int
+join_assumed_lat(mrb_state *mrb, mrb_value *assumed, mrb_value lat)
+{
+  mrb_value joined;
+
+  if (LAT_HAS_TYPE(mrb, lat, LAT_UNKNOWN))
+    return FALSE;
+  joined = lat_join(mrb, *assumed, lat_widen(mrb, lat));
+  if (lat_equal(mrb, joined, *assumed))
+    return FALSE;
+  *assumed = joined;
+  return TRUE;
+}
+
+/* writes: list (class . ivar) whose lat is the value assigned */
+static int
+join_ivar_writes(hpc_state *p, HIR *writes)
+{
+  int changed = FALSE;
+
+  for (; writes; writes = writes->cdr) {
+    hpc_class *c = (hpc_class *)writes->car->car;
+    HIR *entry = ivar_lat_entry(p, c->name, sym(writes->car->cdr->cdr));
+    changed |= join_assumed_lat(p->mrb, &entry->lat, writes->car->lat);
+  }
+  return changed;
+}
+
+static void reach_hir(hpc_state *p, HIR *hir, HIR **reached, int *changed);
+
+static void
+reach_fundecl(hpc_state *p, HIR *fundecl, HIR **reached, int *changed)
+{
+  HIR *l;
+
+  for (l = *reached; l; l = l->cdr) {
+    if (l->car == fundecl)
+      return;
+  }
+  push(*reached, fundecl);
+  for (l = p->fun_writes; l; l = l->cdr) {
+    if (l->car->car == fundecl)
+      *changed |= join_ivar_writes(p, l->car->cdr);
+  }
+  reach_hir(p, fundecl->cdr->cdr->cdr->cdr->cdr->car, reached, changed);
+}
+
+/* a multiplexer calls any method of the name */
+static void
+reach_multiplexer(hpc_state *p, HIR *call, HIR **reached, int *changed)
+{
+  mrb_state *mrb = p->mrb;
+  mrb_sym mid = sym(call->cdr->car);
+  HIR *args = call->cdr->cdr->cdr;
+  int i, argc = hir_len(args);
+  HIR *classes, *l, *arg;
+
+  if (mid == mrb_intern_cstr(mrb, "new"))
+    mid = mrb->init_sym;
+  for (classes = p->classes; classes; classes = classes->cdr) {
+    hpc_class *c = (hpc_class *)classes->car;
+    for (l = c->method_defs; l; l = l->cdr) {
+      node *ast = (node *)l->car->car;
+      mrb_value *lats;
+      if (sym(ast->car) != mid || !simple_params_p(ast, argc))
+        continue;
+      lats = generic_param_lats(p, c->name, ast, (intptr_t)l->car->cdr);
+      for (i = 0, arg = args; lats && arg; i++, arg = arg->cdr)
+        *changed |= join_assumed_lat(mrb, &lats[i], arg->car->lat);
+    }
+    for (l = c->methods; l; l = l->cdr) {
+      HIR *fundecl = l->car;
+      if (sym(fundecl->cdr->cdr->cdr->car) == mid &&
+          hir_len(fundecl->cdr->cdr->cdr->cdr->car) == argc + 1)
+        reach_fundecl(p, fundecl, reached, changed);
+    }
+  }
+}
+
+/* follow calls in hir to join the values assigned into the assumptions */
+static void
+reach_hir(hpc_state *p, HIR *hir, HIR **reached, int *changed)
+{
+  HIR *l;
+
+  if (!hir)
+    return;
+  switch ((intptr_t)hir->car) {
+    case HIR_SCOPE:
+      for (l = hir->cdr->car; l; l = l->cdr)
+        reach_hir(p, l->car, reached, changed);
+      reach_hir(p, hir->cdr->cdr, reached, changed);
+      return;
+    case HIR_GVARDECL:
+    case HIR_LVARDECL:
+      reach_hir(p, hir->cdr->cdr->cdr->car, reached, changed);
+      return;
+    case HIR_BLOCK:
+      for (l = hir->cdr->car; l; l = l->cdr)
+        reach_hir(p, l->car, reached, changed);
+      return;
+    case HIR_INIT_LIST:
+    case HIR_ASSIGN:
+    case HIR_IFELSE:
+    case HIR_DOALL:
+    case HIR_WHILE:
+    case HIR_RETURN:
+    case HIR_COND_OP:
+      for (l = hir->cdr; l; l = l->cdr)
+        reach_hir(p, l->car, reached, changed);
+      return;
+    case HIR_DEFCLASS:
+      reach_hir(p, ((hpc_class *)hir->cdr)->initializer, reached, changed);
+      return;
+    case HIR_CALL:
+      for (l = hir->cdr->cdr; l; l = l->cdr)
+        reach_hir(p, l->car, reached, changed);
+      if (!pending_exps_p(p->mrb, hir->cdr->cdr))
+        reach_multiplexer(p, hir, reached, changed);
+      return;
+    case HIR_SCALL:
+    case HIR_NEW:
+      for (l = hir->cdr->cdr; l; l = l->cdr)
+        reach_hir(p, l->car, reached, changed);
+      reach_fundecl(p, hir->cdr->car->cdr, reached, changed);
+      return;
+    default:
+      return;
+  }
+}
+
+/* check the value of exp is computed without self or ivars and cvars not in inits */
+static int
+self_free_p(node *exp, mrb_sym *inits, int n)
+{
+  node *args;
+  int i;
+
+  switch ((intptr_t)exp->car) {
+    case NODE_LVAR:
+    case NODE_INT:
+    case NODE_FLOAT:
+    case NODE_STR:
+    case NODE_NIL:
+    case NODE_TRUE:
+    case NODE_FALSE:
+    case NODE_CONST:
+    case NODE_NEGATE:
+      return TRUE;
+    case NODE_IVAR:
+    case NODE_CVAR:
+      for (i = 0; i < n; i++) {
+        if (inits[i] == sym(exp->cdr))
+          return TRUE;
+      }
+      return FALSE;
+    case NODE_CALL:
+      /* (:call recv mid (args . blk)) */
+      if (!self_free_p(exp->cdr->car, inits, n))
+        return FALSE;
+      args = exp->cdr->cdr->cdr->car;
+      if (!args)
+        return TRUE;
+      if (args->cdr)
+        return FALSE;
+      for (args = args->car; args; args = args->cdr) {
+        if (!self_free_p(args->car, inits, n))
+          return FALSE;
+      }
+      return TRUE;
+    default:
+      return FALSE;
+  }
+}
+
+/*
+  Check initialize assigns ivar before it can be read, otherwise ivar
+  can be nil.  The leading assignments in initialize are checked.
+ */
+static int
+initialized_ivar_p(hpc_state *p, mrb_sym class_name, mrb_sym ivar)
+{
+  mrb_sym inits[INIT_IVARS_MAX];
+  int n = 0;
+  node *def = 0, *stats;
+  HIR *classes, *defs;
+
+  for (classes = p->classes; classes && !def; classes = classes->cdr) {
+    hpc_class *c = (hpc_class *)classes->car;
+    if (!class_name || c->name != class_name)
+      continue;
+    for (defs = c->method_defs; defs; defs = defs->cdr) {
+      node *ast = (node *)defs->car->car;
+      if (!defs->car->cdr && sym(ast->car) == p->mrb->init_sym) {
+        def = ast;
+        break;
+      }
+    }
+  }
+  if (!def || !def->cdr->cdr->cdr->car)
+    return FALSE;
+
+  for (stats = def->cdr->cdr->cdr->car->cdr; stats && n < INIT_IVARS_MAX; stats = stats->cdr) {
+    node *stat = stats->car;
+    if (!stat || (intptr_t)stat->car != NODE_ASGN ||
+        (intptr_t)stat->cdr->car->car != NODE_IVAR ||
+        !self_free_p(stat->cdr->cdr, inits, n))
+      break;
+    if (sym(stat->cdr->car->cdr) == ivar)
+      return TRUE;
+    inits[n++] = sym(stat->cdr->car->cdr);
+  }
+  return FALSE;
+}
+
+/*
+  Check the class body assigns cvar before any method can be called.
+  The leading assignments to cvars and constants are checked.
+ */
+static int
+initialized_cvar_p(hpc_state *p, mrb_sym class_name, mrb_sym cvar)
+{
+  mrb_sym inits[INIT_IVARS_MAX];
+  int n = 0;
+  node *ast = 0, *body, *stats;
+  HIR *classes;
+
+  for (classes = p->classes; classes && !ast; classes = classes->cdr) {
+    hpc_class *c = (hpc_class *)classes->car;
+    if (class_name && c->name == class_name)
+      ast = (node *)c->ast;
+  }
+  if (!ast)
+    return FALSE;
+  if ((intptr_t)ast->car == NODE_CLASS)
+    body = ast->cdr->cdr->cdr->car->cdr;
+  else
+    body = ast->cdr->cdr->car->cdr;
+  if (!body || (intptr_t)body->car != NODE_BEGIN)
+    return FALSE;
+
+  for (stats = body->cdr; stats && n < INIT_IVARS_MAX; stats = stats->cdr) {
+    node *stat = stats->car;
+    if (!stat || (intptr_t)stat->car != NODE_ASGN ||
+        !self_free_p(stat->cdr->cdr, inits, n))
+      break;
+    if ((intptr_t)stat->cdr->car->car == NODE_CONST)
+      continue;
+    if ((intptr_t)stat->cdr->car->car != NODE_CVAR)
+      break;
+    if (sym(stat->cdr->car->cdr) == cvar)
+      return TRUE;
+    inits[n++] = sym(stat->cdr->car->cdr);
+  }
+  return FALSE;
+}
+
+/* a class variable is named @@name */
+static int
+cvar_name_p(hpc_state *p, mrb_sym name)
+{
+  const char *s = mrb_sym2name(p->mrb, name);
+  return s[0] == '@' && s[1] == '@';
+}
+
+/* returns TRUE unless the assumptions hold */
+static int
+update_assumed_lats(hpc_state *p, HIR *main_body, HIR *main_writes)
+{
+  HIR *reached = 0, *entries;
+  int changed = join_ivar_writes(p, main_writes);
+
+  reach_hir(p, main_body, &reached, &changed);
+  for (entries = p->ivar_lats; entries; entries = entries->cdr) {
+    HIR *entry = entries->car;
+    mrb_sym name = sym(entry->cdr);
+    if (cvar_name_p(p, name) ? !initialized_cvar_p(p, sym(entry->car), name)
+        : !initialized_ivar_p(p, sym(entry->car), name))
+      changed |= join_assumed_lat(p->mrb, &entry->lat, mrb_nil_value());
+  }
+  return changed;
+}
+
+/*
+  Scalar replacement
+
+  An object assigned to a local variable by new, whose initialize only
+  copies args and literals into ivars, and read only through accessors
+  never leaves the function.  Its ivars are kept in locals instead and
+  the allocation disappears.
+ */
+
+/* flatten nested blocks of stat into *stats */
+static void
+flatten_stats(hpc_state *p, HIR *stat, HIR **stats)
+{
+  HIR *l;
+
+  if ((intptr_t)stat->car != HIR_BLOCK) {
+    *stats = append(p, *stats, list1(stat));
+    return;
+  }
+  for (l = stat->cdr->car; l; l = l->cdr)
+    flatten_stats(p, l->car, stats);
+}
+
+/* statements of the body of a method without locals, or -1 */
+static HIR*
+method_stats(hpc_state *p, HIR *fundecl)
+{
+  HIR *body = fundecl->cdr->cdr->cdr->cdr->cdr->car;
+  HIR *stats = 0;
+
+  if ((intptr_t)body->car != HIR_SCOPE || body->cdr->car)
+    return (HIR *)-1;
+  flatten_stats(p, body->cdr->cdr, &stats);
+  return stats;
+}
+
+static int
+ivar_p(HIR *hir)
+{
+  return (intptr_t)hir->car == HIR_IVAR;
+}
+
+/* the ivar read by a reader (def x; @x; end), or 0 */
+static mrb_sym
+reader_ivar(hpc_state *p, HIR *fundecl)
+{
+  HIR *stats = method_stats(p, fundecl), *ret;
+
+  if (stats == (HIR *)-1 || hir_len(fundecl->cdr->cdr->cdr->cdr->car) != 1 ||
+      hir_len(stats) != 1)
+    return 0;
+  ret = stats->car;
+  if ((intptr_t)ret->car != HIR_RETURN || !ret->cdr || !ivar_p(ret->cdr->car))
+    return 0;
+  return sym(ret->cdr->car->cdr);
+}
+
+/* the ivar assigned by a writer (def x=(v); @x = v; end), or 0 */
+static mrb_sym
+writer_ivar(hpc_state *p, HIR *fundecl)
+{
+  HIR *params = fundecl->cdr->cdr->cdr->cdr->car;
+  HIR *stats = method_stats(p, fundecl), *assign;
+
+  if (stats == (HIR *)-1 || hir_len(params) != 2 || hir_len(stats) != 2)
+    return 0;
+  assign = stats->car;
+  if ((intptr_t)assign->car != HIR_ASSIGN || !ivar_p(assign->cdr->car) ||
+      (intptr_t)assign->cdr->cdr->car->car != HIR_LVAR ||
+      sym(assign->cdr->cdr->car->cdr) != sym(params->cdr->car->cdr->cdr->car))
+    return 0;
+  return sym(assign->cdr->car->cdr);
+}
+
+/*
+  Assignments (:HIR_ASSIGN ivar rhs) of initialize, where rhs is a
+  literal or a param.  Params are used once in order so that args are
+  evaluated as before.  Returns -1 if initialize is not so simple.
+ */
+static HIR*
+initialize_assigns(hpc_state *p, HIR *fundecl)
+{
+  HIR *params = fundecl->cdr->cdr->cdr->cdr->car->cdr;
+  HIR *stats = method_stats(p, fundecl), *assigns = 0, *param = params;
+
+  if (stats == (HIR *)-1)
+    return stats;
+  for (; stats; stats = stats->cdr) {
+    HIR *stat = stats->car, *rhs;
+    if ((intptr_t)stat->car == HIR_RETURN && !stats->cdr)
+      break;
+    if ((intptr_t)stat->car != HIR_ASSIGN || !ivar_p(stat->cdr->car))
+      return (HIR *)-1;
+    rhs = stat->cdr->cdr->car;
+    switch ((intptr_t)rhs->car) {
+      case HIR_INT:
+      case HIR_FLOAT:
+      case HIR_PRIM:
+        break;
+      case HIR_LVAR:
+        if (!param || sym(rhs->cdr) != sym(param->car->cdr->cdr->car))
+          return (HIR *)-1;
+        param = param->cdr;
+        break;
+      default:
+        return (HIR *)-1;
+    }
+    assigns = append(p, assigns, list1(stat));
+  }
+  if (param)
+    return (HIR *)-1;
+  return assigns;
+}
+
+/* all ivars of the class are assigned by initialize */
+static int
+initialize_complete_p(hpc_state *p, mrb_sym class_name, HIR *assigns)
+{
+  HIR *classes, *ivs, *l;
+
+  for (classes = p->classes; classes; classes = classes->cdr) {
+    hpc_class *c = (hpc_class *)classes->car;
+    if (c->name != class_name)
+      continue;
+    for (ivs = c->ivs; ivs; ivs = ivs->cdr) {
+      for (l = assigns; l; l = l->cdr) {
+        if (sym(l->car->cdr->car->cdr) == sym(ivs->car->cdr))
+          break;
+      }
+      if (!l)
+        return FALSE;
+    }
+  }
+  return TRUE;
+}
+
+/* check the class of call matches *class_name, the first one decides it */
+static int
+same_class_p(HIR *call, mrb_sym *class_name)
+{
+  hpc_class *c = (hpc_class *)call->cdr->car->car;
+
+  if (!c->name)
+    return FALSE;
+  if (!*class_name)
+    *class_name = c->name;
+  return c->name == *class_name;
+}
+
+static int
+lvar_of_p(HIR *hir, mrb_sym var)
+{
+  return (intptr_t)hir->car == HIR_LVAR && sym(hir->cdr) == var;
+}
+
+static int
+declared_p(HIR *decls, mrb_sym var)
+{
+  for (; decls; decls = decls->cdr) {
+    if ((intptr_t)decls->car->car == HIR_LVARDECL && sym(decls->car->cdr->cdr->car) == var)
+      return TRUE;
+  }
+  return FALSE;
+}
+
+static int var_free_exps_p(HIR *exps, mrb_sym var);
+
+/* check the expression does not read var */
+static int
+var_free_p(HIR *exp, mrb_sym var)
+{
+  switch ((intptr_t)exp->car) {
+    case HIR_EMPTY:
+    case HIR_PRIM:
+    case HIR_INT:
+    case HIR_FLOAT:
+    case HIR_STRING:
+    case HIR_GVAR:
+    case HIR_IVAR:
+    case HIR_CVAR:
+      return TRUE;
+    case HIR_LVAR:
+      return sym(exp->cdr) != var;
+    case HIR_BLOCK:
+      return var_free_exps_p(exp->cdr->car, var);
+    case HIR_ASSIGN:
+    case HIR_INIT_LIST:
+    case HIR_COND_OP:
+      return var_free_exps_p(exp->cdr, var);
+    case HIR_CALL:
+    case HIR_SCALL:
+    case HIR_NEW:
+      return var_free_exps_p(exp->cdr->cdr, var);
+    default:
+      return FALSE;
+  }
+}
+
+static int
+var_free_exps_p(HIR *exps, mrb_sym var)
+{
+  for (; exps; exps = exps->cdr) {
+    if (!var_free_p(exps->car, var))
+      return FALSE;
+  }
+  return TRUE;
+}
+
+static int no_escape_exps_p(hpc_state *p, HIR *exps, mrb_sym var, mrb_sym *class_name);
+
+/*
+  Check the object in var does not escape from hir.
+  statp: hir is a statement, whose value is not used.
+ */
+static int
+no_escape_p(hpc_state *p, HIR *hir, mrb_sym var, mrb_sym *class_name, int statp)
+{
+  HIR *l, *lhs, *rhs, *assigns;
+
+  if (!hir)
+    return TRUE;
+  switch ((intptr_t)hir->car) {
+    case HIR_LVAR:
+      return sym(hir->cdr) != var;
+    case HIR_SCOPE:
+      if (declared_p(hir->cdr->car, var))
+        return TRUE;            /* another variable */
+      for (l = hir->cdr->car; l; l = l->cdr) {
+        if (!no_escape_p(p, l->car, var, class_name, TRUE))
+          return FALSE;
+      }
+      return no_escape_p(p, hir->cdr->cdr, var, class_name, TRUE);
+    case HIR_GVARDECL:
+    case HIR_LVARDECL:
+      return no_escape_p(p, hir->cdr->cdr->cdr->car, var, class_name, FALSE);
+    case HIR_BLOCK:
+      for (l = hir->cdr->car; l; l = l->cdr) {
+        if (!no_escape_p(p, l->car, var, class_name, statp))
+          return FALSE;
+      }
+      return TRUE;
+    case HIR_ASSIGN:
+      lhs = hir->cdr->car;
+      rhs = hir->cdr->cdr->car;
+      if (!lvar_of_p(lhs, var))
+        return no_escape_p(p, rhs, var, class_name, FALSE);
+      /* var = K.new(args), where args are assigned into fields of var */
+      if (!statp || (intptr_t)rhs->car != HIR_NEW || !same_class_p(rhs, class_name))
+        return FALSE;
+      assigns = initialize_assigns(p, rhs->cdr->car->cdr);
+      return assigns != (HIR *)-1 && initialize_complete_p(p, *class_name, assigns) &&
+        var_free_exps_p(rhs->cdr->cdr->cdr, var);
+    case HIR_IFELSE:
+      return no_escape_p(p, hir->cdr->car, var, class_name, FALSE) &&
+        no_escape_p(p, hir->cdr->cdr->car, var, class_name, TRUE) &&
+        no_escape_p(p, hir->cdr->cdr->cdr->car, var, class_name, TRUE);
+    case HIR_WHILE:
+    case HIR_DOALL:
+      /* the body is the last */
+      for (l = hir->cdr; l->cdr; l = l->cdr) {
+        if (!no_escape_p(p, l->car, var, class_name, FALSE))
+          return FALSE;
+      }
+      return no_escape_p(p, l->car, var, class_name, TRUE);
+    case HIR_INIT_LIST:
+    case HIR_RETURN:
+    case HIR_COND_OP:
+      return no_escape_exps_p(p, hir->cdr, var, class_name);
+    case HIR_CALL:
+    case HIR_NEW:
+      return no_escape_exps_p(p, hir->cdr->cdr, var, class_name);
+    case HIR_SCALL:
+      if (!lvar_of_p(hir->cdr->cdr->car, var))
+        return no_escape_exps_p(p, hir->cdr->cdr, var, class_name);
+      /* var.x or var.x = exp */
+      if (!same_class_p(hir, class_name))
+        return FALSE;
+      if (reader_ivar(p, hir->cdr->car->cdr))
+        return TRUE;
+      return statp && writer_ivar(p, hir->cdr->car->cdr) &&
+        no_escape_exps_p(p, hir->cdr->cdr->cdr, var, class_name);
+    default:
+      return TRUE;
+  }
+}
+
+static int
+no_escape_exps_p(hpc_state *p, HIR *exps, mrb_sym var, mrb_sym *class_name)
+{
+  for (; exps; exps = exps->cdr) {
+    if (!no_escape_p(p, exps->car, var, class_name, FALSE))
+      return FALSE;
+  }
+  return TRUE;
+}
+
+/* fields: list (ivar . HIR_LVAR) */
+static int
+field_lvar_p(HIR *fields, mrb_sym ivar)
+{
+  for (; fields; fields = fields->cdr) {
+    if (sym(fields->car->car) == ivar)
+      return TRUE;
+  }
+  return FALSE;
+}
+
+static HIR*
+field_lvar(HIR *fields, mrb_sym ivar)
+{
+  for (; fields; fields = fields->cdr) {
+    if (sym(fields->car->car) == ivar)
+      return fields->car->cdr;
+  }
+  NOT_REACHABLE();
+  return 0;
+}
+
+static HIR*
+new_field_assign(hpc_state *p, HIR *fields, mrb_sym ivar, HIR *rhs)
+{
+  HIR *hir = list3((HIR*)HIR_ASSIGN, field_lvar(fields, ivar), rhs);
+  hir->lat = rhs->lat;
+  return hir;
+}
+
+static void replace_scalar_exps(hpc_state *p, HIR *exps, mrb_sym var, HIR *fields);
+
+/* rewrite the accesses to the object in var checked by no_escape_p */
+static void
+replace_scalar(hpc_state *p, HIR *hir, mrb_sym var, HIR *fields)
+{
+  HIR *l, *lhs, *rhs, *fundecl, *field;
+
+  if (!hir)
+    return;
+  switch ((intptr_t)hir->car) {
+    case HIR_SCOPE:
+      if (declared_p(hir->cdr->car, var))
+        return;
+      replace_scalar_exps(p, hir->cdr->car, var, fields);
+      replace_scalar(p, hir->cdr->cdr, var, fields);
+      return;
+    case HIR_GVARDECL:
+    case HIR_LVARDECL:
+      replace_scalar(p, hir->cdr->cdr->cdr->car, var, fields);
+      return;
+    case HIR_BLOCK:
+      replace_scalar_exps(p, hir->cdr->car, var, fields);
+      return;
+    case HIR_ASSIGN:
+      lhs = hir->cdr->car;
+      rhs = hir->cdr->cdr->car;
+      replace_scalar(p, rhs, var, fields);
+      if (lvar_of_p(lhs, var)) {
+        /* var = K.new(args) -> var__f = arg; ... */
+        HIR *stats = 0, *arg = rhs->cdr->cdr->cdr;
+        for (l = initialize_assigns(p, rhs->cdr->car->cdr); l; l = l->cdr) {
+          HIR *ivar = l->car->cdr->car, *val = l->car->cdr->cdr->car;
+          if ((intptr_t)val->car == HIR_LVAR) {
+            val = arg->car;
+            arg = arg->cdr;
+          }
+          stats = append(p, stats, list1(new_field_assign(p, fields, sym(ivar->cdr), val)));
         }
+        hir->car = (HIR*)HIR_BLOCK;
+        hir->cdr = list1(stats);
+      }
+      return;
+    case HIR_IFELSE:
+    case HIR_WHILE:
+    case HIR_DOALL:
+    case HIR_INIT_LIST:
+    case HIR_RETURN:
+    case HIR_COND_OP:
+      replace_scalar_exps(p, hir->cdr, var, fields);
+      return;
+    case HIR_CALL:
+    case HIR_NEW:
+      replace_scalar_exps(p, hir->cdr->cdr, var, fields);
+      return;
+    case HIR_SCALL:
+      replace_scalar_exps(p, hir->cdr->cdr, var, fields);
+      if (!lvar_of_p(hir->cdr->cdr->car, var))
+        return;
+      fundecl = hir->cdr->car->cdr;
+      if (reader_ivar(p, fundecl)) {
+        /* var.x -> var__x */
+        field = field_lvar(fields, reader_ivar(p, fundecl));
+        hir->car = field->car;
+        hir->cdr = field->cdr;
+        hir->lat = field->lat;
+      }
+      else {
+        /* var.x = exp -> var__x = exp */
+        rhs = hir->cdr->cdr->cdr->car;
+        hir->car = (HIR*)HIR_ASSIGN;
+        hir->cdr = list2(field_lvar(fields, writer_ivar(p, fundecl)), rhs);
+        hir->lat = rhs->lat;
+      }
+      return;
+    default:
+      return;
+  }
+}
+
+static void
+replace_scalar_exps(hpc_state *p, HIR *exps, mrb_sym var, HIR *fields)
+{
+  for (; exps; exps = exps->cdr)
+    replace_scalar(p, exps->car, var, fields);
+}
+
+/* replace the declaration of var with a local for each ivar of the class */
+static HIR*
+field_decls(hpc_state *p, mrb_sym var, mrb_sym class_name, HIR **fields)
+{
+  mrb_state *mrb = p->mrb;
+  HIR *decls = 0, *classes, *ivs;
+  char buf[256];
+
+  *fields = 0;
+  for (classes = p->classes; classes; classes = classes->cdr) {
+    hpc_class *c = (hpc_class *)classes->car;
+    if (c->name != class_name)
+      continue;
+    for (ivs = c->ivs; ivs; ivs = ivs->cdr) {
+      mrb_sym ivar = sym(ivs->car->cdr), field_sym;
+      mrb_value lat = ivs->car->lat;
+      HIR *lvar;
+      if (field_lvar_p(*fields, ivar))
+        continue;
+      snprintf(buf, sizeof(buf), "%s__%s", mrb_sym2name(mrb, var), mrb_sym2name(mrb, ivar) + 1);
+      field_sym = mrb_intern_cstr(mrb, buf);
+      lvar = new_lvar(p, field_sym, lat);
+      push(*fields, cons(hirsym(ivar), lvar));
+      push(decls, new_lvardecl(p, lat, field_sym, new_empty(p)));
+    }
+  }
+  return decls;
+}
+
+static void
+scalar_replace_scope(hpc_state *p, HIR *scope)
+{
+  HIR *decls = scope->cdr->car, *body = scope->cdr->cdr, *l, *rest = 0;
+
+  scope->cdr->car = 0;
+  for (l = decls; l; l = l->cdr) {
+    HIR *decl = l->car, *fields;
+    mrb_sym var, class_name = 0;
+    if ((intptr_t)decl->car != HIR_LVARDECL ||
+        (intptr_t)decl->cdr->cdr->cdr->car->car != HIR_EMPTY) {
+      rest = append(p, rest, list1(decl));
+      continue;
+    }
+    var = sym(decl->cdr->cdr->car);
+    if (!no_escape_p(p, body, var, &class_name, TRUE) || !class_name) {
+      rest = append(p, rest, list1(decl));
+      continue;
+    }
+    rest = append(p, rest, field_decls(p, var, class_name, &fields));
+    replace_scalar(p, body, var, fields);
+  }
+  scope->cdr->car = rest;
+}
+
+/* find scopes in statements */
+static void
+scalar_replace(hpc_state *p, HIR *stat)
+{
+  HIR *l;
+
+  if (!stat)
+    return;
+  switch ((intptr_t)stat->car) {
+    case HIR_SCOPE:
+      scalar_replace_scope(p, stat);
+      scalar_replace(p, stat->cdr->cdr);
+      return;
+    case HIR_BLOCK:
+      for (l = stat->cdr->car; l; l = l->cdr)
+        scalar_replace(p, l->car);
+      return;
+    case HIR_IFELSE:
+      scalar_replace(p, stat->cdr->cdr->car);
+      scalar_replace(p, stat->cdr->cdr->cdr->car);
+      return;
+    case HIR_WHILE:
+      scalar_replace(p, stat->cdr->cdr->car);
+      return;
+    case HIR_DOALL:
+      scalar_replace(p, stat->cdr->cdr->cdr->cdr->car);
+      return;
+    default:
+      return;
+  }
+}
+
+/*
+  Value ranges
+
+  A pass over the typed bodies records facts about Fixnum locals:
+    the interval of the value, e.g. the counter of a DOALL not assigned
+    in the body is in [low, high-1]
+    the value is below or equal to the length of an Array in a local,
+    e.g. k in the body of while (k < a.length)
+  The facts are a list searched from the head.  An assignment pushes a
+  fact hiding the older one of the variable, and a loop pushes the
+  facts of the variables assigned in it, keeping the lower bound of a
+  variable only incremented.  A call which can shrink an Array pushes
+  a mark hiding the facts about lengths.
+
+  + - * of Fixnums are typed Fixnum|Float because they overflow into
+  Float.  They are retyped Fixnum if the interval of the result is in
+  mrb_int, and compiled to C operators instead of NATIVE_CHECKED.
+  a[i] of an Array is read at the native index i, without the check of
+  the bounds if 0 <= i < a.length (hpc_ary_uref, hpc_ary_vref).
+ */
+
+enum len_rel {
+  LEN_NONE,
+  LEN_BELOW,                    /* var < ary.length */
+  LEN_EQUAL,                    /* var == ary.length */
+};
+
+struct int_range {
+  mrb_sym var;                  /* 0 for the mark of a call shrinking Arrays */
+  mrb_int lo, hi;
+  enum len_rel rel;
+  mrb_sym ary;
+  struct int_range *next;
+};
+
+static struct int_range*
+push_range(hpc_state *p, struct int_range *next, mrb_sym var, mrb_int lo, mrb_int hi,
+           enum len_rel rel, mrb_sym ary)
+{
+  struct int_range *r = (struct int_range *)compiler_palloc(p, sizeof(struct int_range));
+
+  r->var = var;
+  r->lo = lo;
+  r->hi = hi;
+  r->rel = rel;
+  r->ary = ary;
+  r->next = next;
+  return r;
+}
+
+static struct int_range*
+find_range(struct int_range *ranges, mrb_sym var)
+{
+  for (; ranges; ranges = ranges->next) {
+    if (ranges->var == var)
+      return ranges;
+  }
+  return 0;
+}
+
+/* the fact of var relating it to the length of an Array, 0 if it may be stale */
+static struct int_range*
+find_len_rel(struct int_range *ranges, mrb_sym var)
+{
+  struct int_range *r = find_range(ranges, var), *l;
+
+  if (!r || r->rel == LEN_NONE)
+    return 0;
+  for (l = ranges; l != r; l = l->next) {
+    if (l->var == 0 || l->var == r->ary)
+      return 0;
+  }
+  return r;
+}
+
+/* z = x op y, or FALSE if it overflows */
+static int
+int_range_op(char op, mrb_int x, mrb_int y, mrb_int *z)
+{
+  switch (op) {
+    case '+':
+      if ((y > 0 && x > MRB_INT_MAX - y) || (y < 0 && x < MRB_INT_MIN - y))
+        return FALSE;
+      *z = x + y;
+      return TRUE;
+    case '-':
+      if ((y < 0 && x > MRB_INT_MAX + y) || (y > 0 && x < MRB_INT_MIN + y))
+        return FALSE;
+      *z = x - y;
+      return TRUE;
+    case '*':
+      if (x > 0 ? (y > 0 ? x > MRB_INT_MAX / y : y < MRB_INT_MIN / x)
+                : (y > 0 ? x < MRB_INT_MIN / y : x != 0 && y < MRB_INT_MAX / x))
+        return FALSE;
+      *z = x * y;
+      return TRUE;
+    default:
+      return FALSE;
+  }
+}
+
+static int
+call_name_p(hpc_state *p, HIR *exp, const char *name)
+{
+  return (intptr_t)exp->car == HIR_CALL && sym(exp->cdr->car) == mrb_intern_cstr(p->mrb, name);
+}
+
+/* the interval of a Fixnum expression, FALSE if it is not known */
+static int
+exp_range(hpc_state *p, HIR *exp, struct int_range *ranges, mrb_int *lo, mrb_int *hi)
+{
+  mrb_state *mrb = p->mrb;
+  mrb_int alo, ahi, blo, bhi, v[4];
+  struct int_range *r;
+  const char *name;
+  HIR *args;
+  int i;
+
+  if (LAT_TYPE(mrb, exp->lat) == LAT_CONST && mrb_fixnum_p(exp->lat)) {
+    *lo = *hi = mrb_fixnum(exp->lat);
+    return TRUE;
+  }
+  if (!lat_fixnum_p(mrb, exp->lat))
+    return FALSE;
+  switch ((intptr_t)exp->car) {
+    case HIR_LVAR:
+      r = find_range(ranges, sym(exp->cdr));
+      if (!r)
+        return FALSE;
+      *lo = r->lo;
+      *hi = r->hi;
+      return TRUE;
+    case HIR_CALL:
+      if (call_name_p(p, exp, "hpc_ary_len") || call_name_p(p, exp, "hpc_numary_len")) {
+        *lo = 0;
+        *hi = MRB_INT_MAX;
+        return TRUE;
+      }
+      name = mrb_sym2name(mrb, sym(exp->cdr->car));
+      args = exp->cdr->cdr;
+      if (hir_len(args) != 2 || name[1] || !strchr("+-*", name[0]) ||
+          !exp_range(p, args->car, ranges, &alo, &ahi) ||
+          !exp_range(p, args->cdr->car, ranges, &blo, &bhi))
+        return FALSE;
+      if (name[0] == '-')
+        return int_range_op('-', alo, bhi, lo) && int_range_op('-', ahi, blo, hi);
+      if (!int_range_op(name[0], alo, blo, &v[0]) || !int_range_op(name[0], alo, bhi, &v[1]) ||
+          !int_range_op(name[0], ahi, blo, &v[2]) || !int_range_op(name[0], ahi, bhi, &v[3]))
+        return FALSE;
+      *lo = *hi = v[0];
+      for (i = 1; i < 4; i++) {
+        if (v[i] < *lo) *lo = v[i];
+        if (v[i] > *hi) *hi = v[i];
+      }
+      return TRUE;
+    default:
+      return FALSE;
+  }
+}
+
+/* the Array in a local whose length exp is, or 0 */
+static mrb_sym
+exp_len_of(hpc_state *p, HIR *exp, struct int_range *ranges)
+{
+  struct int_range *r;
+
+  if (call_name_p(p, exp, "hpc_ary_len") && (intptr_t)exp->cdr->cdr->car->car == HIR_LVAR)
+    return sym(exp->cdr->cdr->car->cdr);
+  if ((intptr_t)exp->car == HIR_LVAR) {
+    r = find_len_rel(ranges, sym(exp->cdr));
+    if (r && r->rel == LEN_EQUAL)
+      return r->ary;
+  }
+  return 0;
+}
+
+/* call f with the subtrees of hir in the order of evaluation */
+static void
+hir_each_child(HIR *hir, void (*f)(HIR *, void *), void *ud)
+{
+  HIR *l;
+
+  switch ((intptr_t)hir->car) {
+    case HIR_SCOPE:
+      for (l = hir->cdr->car; l; l = l->cdr)
+        f(l->car, ud);
+      f(hir->cdr->cdr, ud);
+      return;
+    case HIR_GVARDECL:
+    case HIR_LVARDECL:
+      f(hir->cdr->cdr->cdr->car, ud);
+      return;
+    case HIR_BLOCK:
+      for (l = hir->cdr->car; l; l = l->cdr)
+        f(l->car, ud);
+      return;
+    case HIR_INIT_LIST:
+    case HIR_ASSIGN:
+    case HIR_IFELSE:
+    case HIR_DOALL:
+    case HIR_WHILE:
+    case HIR_RETURN:
+    case HIR_COND_OP:
+      for (l = hir->cdr; l; l = l->cdr)
+        f(l->car, ud);
+      return;
+    case HIR_CALL:
+    case HIR_SCALL:
+    case HIR_NEW:
+    case HIR_FIELD:
+      for (l = hir->cdr->cdr; l; l = l->cdr)
+        f(l->car, ud);
+      return;
+    default:
+      return;
+  }
+}
+
+/* the call cannot change the length of an Array */
+static int
+safe_call_p(hpc_state *p, HIR *call)
+{
+  mrb_state *mrb = p->mrb;
+  const char *name = mrb_sym2name(mrb, sym(call->cdr->car));
+  HIR *recv = call->cdr->cdr->car;
+
+  if (strcmp(name, "hpc_yield") == 0)
+    return FALSE;
+  if (strncmp(name, "hpc_", 4) == 0 || lat_num(mrb, recv->lat) != LNUM_NONE)
+    return TRUE;
+  if (lat_class_of(mrb, recv->lat) == mrb->array_class)
+    return strcmp(name, "[]") == 0 || strcmp(name, "[]=") == 0 ||
+      strcmp(name, "length") == 0 || strcmp(name, "size") == 0;
+  return FALSE;
+}
+
+struct hir_effects {
+  hpc_state *p;
+  HIR *assigned;                /* list of symbols */
+  int shrinks;                  /* calls what can shrink an Array */
+};
+
+static void
+collect_effects(HIR *hir, void *ud)
+{
+  struct hir_effects *e = (struct hir_effects *)ud;
+  HIR *var = 0;
+
+  if (!hir)
+    return;
+  switch ((intptr_t)hir->car) {
+    case HIR_LVARDECL:
+      var = hir->cdr->cdr->car;
+      break;
+    case HIR_ASSIGN:
+      if ((intptr_t)hir->cdr->car->car == HIR_LVAR)
+        var = hir->cdr->car->cdr;
+      break;
+    case HIR_CALL:
+      if (!safe_call_p(e->p, hir))
+        e->shrinks = TRUE;
+      break;
+    case HIR_SCALL:
+    case HIR_NEW:
+      e->shrinks = TRUE;
+      break;
+    default:
+      break;
+  }
+  if (var && !hir_member_p(e->assigned, var))
+    e->assigned = cons_gen(e->p, var, e->assigned);
+  hir_each_child(hir, collect_effects, ud);
+}
+
+struct incr_only {
+  hpc_state *p;
+  mrb_sym var;
+  int ok;
+};
+
+/* every assignment of var is var = var + c of a constant c >= 0 */
+static void
+check_incr_only(HIR *hir, void *ud)
+{
+  struct incr_only *in = (struct incr_only *)ud;
+  mrb_state *mrb = in->p->mrb;
+  HIR *rhs, *args;
+
+  if (!hir)
+    return;
+  switch ((intptr_t)hir->car) {
+    case HIR_LVARDECL:
+      if (sym(hir->cdr->cdr->car) == in->var)
+        in->ok = FALSE;
+      break;
+    case HIR_ASSIGN:
+      if ((intptr_t)hir->cdr->car->car != HIR_LVAR || sym(hir->cdr->car->cdr) != in->var)
+        break;
+      rhs = hir->cdr->cdr->car;
+      if (!call_name_p(in->p, rhs, "+")) {
+        in->ok = FALSE;
+        break;
+      }
+      args = rhs->cdr->cdr;
+      if (hir_len(args) != 2 ||
+          (intptr_t)args->car->car != HIR_LVAR || sym(args->car->cdr) != in->var ||
+          LAT_TYPE(mrb, args->cdr->car->lat) != LAT_CONST ||
+          !mrb_fixnum_p(args->cdr->car->lat) || mrb_fixnum(args->cdr->car->lat) < 0)
+        in->ok = FALSE;
+      break;
+    default:
+      break;
+  }
+  hir_each_child(hir, check_incr_only, ud);
+}
+
+/* the facts after hir is run any times, each assigned variable is unknown */
+static struct int_range*
+push_effects(hpc_state *p, HIR *hir, struct int_range *ranges)
+{
+  struct hir_effects e;
+  struct incr_only in;
+  struct int_range *r, *result = ranges;
+  HIR *l;
+
+  e.p = p;
+  e.assigned = 0;
+  e.shrinks = FALSE;
+  collect_effects(hir, &e);
+  for (l = e.assigned; l; l = l->cdr) {
+    r = find_range(ranges, sym(l->car));
+    in.p = p;
+    in.var = sym(l->car);
+    in.ok = TRUE;
+    if (r)
+      check_incr_only(hir, &in);
+    result = push_range(p, result, in.var, r && in.ok ? r->lo : MRB_INT_MIN, MRB_INT_MAX,
+                        LEN_NONE, 0);
+  }
+  if (e.shrinks)
+    result = push_range(p, result, 0, 0, 0, LEN_NONE, 0);
+  return result;
+}
+
+/* the fact of var = rhs */
+static struct int_range*
+push_assign(hpc_state *p, struct int_range *ranges, mrb_sym var, HIR *rhs)
+{
+  mrb_int lo = MRB_INT_MIN, hi = MRB_INT_MAX;
+  enum len_rel rel = LEN_NONE;
+  mrb_sym ary = exp_len_of(p, rhs, ranges);
+  struct int_range *r;
+
+  exp_range(p, rhs, ranges, &lo, &hi);
+  if (ary) {
+    rel = LEN_EQUAL;
+  }
+  else if ((intptr_t)rhs->car == HIR_LVAR) {
+    r = find_len_rel(ranges, sym(rhs->cdr));
+    if (r) {
+      rel = r->rel;
+      ary = r->ary;
+    }
+  }
+  if (ary == var)
+    rel = LEN_NONE;
+  return push_range(p, ranges, var, lo, hi, rel, ary);
+}
+
+/* + - * retyped Fixnum, a[i] read at a native index */
+static void
+narrow_call(hpc_state *p, HIR *hir, struct int_range *ranges)
+{
+  mrb_state *mrb = p->mrb;
+  const char *name = mrb_sym2name(mrb, sym(hir->cdr->car));
+  HIR *args = hir->cdr->cdr;
+  struct int_range *r;
+  mrb_int lo, hi;
+
+  if (strcmp(name, "[]") == 0 && hir_len(args) == 2 &&
+      lat_class_of(mrb, args->car->lat) == mrb->array_class &&
+      lat_fixnum_p(mrb, args->cdr->car->lat)) {
+    r = (intptr_t)args->car->car == HIR_LVAR && (intptr_t)args->cdr->car->car == HIR_LVAR ?
+      find_len_rel(ranges, sym(args->cdr->car->cdr)) : 0;
+    if (r && r->rel == LEN_BELOW && r->ary == sym(args->car->cdr) && r->lo >= 0)
+      hir->cdr->car = hirsym(mrb_intern_cstr(mrb, "hpc_ary_uref"));
+    else
+      hir->cdr->car = hirsym(mrb_intern_cstr(mrb, "hpc_ary_vref"));
+    return;
+  }
+  if (LAT_TYPE(mrb, hir->lat) == LAT_CONST || lat_fixnum_p(mrb, hir->lat) ||
+      lat_num(mrb, hir->lat) != LNUM_MIXED || name[1] || !strchr("+-*", name[0]))
+    return;
+  /* checked by exp_range as if it were Fixnum */
+  hir->lat = lat_fixnum(mrb);
+  if (!exp_range(p, hir, ranges, &lo, &hi))
+    hir->lat = lat_set_new2(mrb, mrb_fixnum_value(0), mrb_float_value(0.0));
+}
+
+/* the fact of k < e or k <= e in the body of a loop */
+static struct int_range*
+push_cond(hpc_state *p, HIR *cond, struct int_range *ranges)
+{
+  mrb_state *mrb = p->mrb;
+  HIR *args, *k;
+  struct int_range *r;
+  mrb_int lo, hi;
+  mrb_sym ary;
+  int below = call_name_p(p, cond, "<");
+
+  if (!(below || call_name_p(p, cond, "<=")))
+    return ranges;
+  args = cond->cdr->cdr;
+  if (hir_len(args) != 2)
+    return ranges;
+  k = args->car;
+  if ((intptr_t)k->car != HIR_LVAR || !lat_fixnum_p(mrb, k->lat))
+    return ranges;
+  r = find_range(ranges, sym(k->cdr));
+  if (!exp_range(p, args->cdr->car, ranges, &lo, &hi))
+    hi = MRB_INT_MAX;
+  if (below && hi == MRB_INT_MIN)
+    return ranges;
+  ary = below ? exp_len_of(p, args->cdr->car, ranges) : 0;
+  return push_range(p, ranges, sym(k->cdr), r ? r->lo : MRB_INT_MIN, below ? hi - 1 : hi,
+                    ary ? LEN_BELOW : LEN_NONE, ary);
+}
+
+/* the facts after hir */
+static struct int_range*
+range_walk(hpc_state *p, HIR *hir, struct int_range *ranges)
+{
+  struct int_range *entry = ranges, *loop;
+  struct hir_effects e;
+  mrb_int lo, hi, low, high;
+  mrb_sym counter, ary;
+  HIR *l;
+
+  if (!hir)
+    return ranges;
+  switch ((intptr_t)hir->car) {
+    case HIR_SCOPE:
+      for (l = hir->cdr->car; l; l = l->cdr)
+        ranges = range_walk(p, l->car, ranges);
+      range_walk(p, hir->cdr->cdr, ranges);
+      return push_effects(p, hir, entry);
+    case HIR_BLOCK:
+      for (l = hir->cdr->car; l; l = l->cdr)
+        ranges = range_walk(p, l->car, ranges);
+      return ranges;
+    case HIR_LVARDECL:
+      ranges = range_walk(p, hir->cdr->cdr->cdr->car, ranges);
+      return push_assign(p, ranges, sym(hir->cdr->cdr->car), hir->cdr->cdr->cdr->car);
+    case HIR_GVARDECL:
+      return range_walk(p, hir->cdr->cdr->cdr->car, ranges);
+    case HIR_ASSIGN:
+      ranges = range_walk(p, hir->cdr->cdr->car, ranges);
+      if ((intptr_t)hir->cdr->car->car != HIR_LVAR)
+        return ranges;
+      return push_assign(p, ranges, sym(hir->cdr->car->cdr), hir->cdr->cdr->car);
+    case HIR_IFELSE:
+    case HIR_COND_OP:
+      /* (cond then else) */
+      ranges = range_walk(p, hir->cdr->car, ranges);
+      range_walk(p, hir->cdr->cdr->car, ranges);
+      range_walk(p, hir->cdr->cdr->cdr->car, ranges);
+      return push_effects(p, hir, entry);
+    case HIR_WHILE:
+      /* (cond body), k < e holds at the start of the body */
+      loop = push_effects(p, hir, ranges);
+      ranges = range_walk(p, hir->cdr->car, loop);
+      range_walk(p, hir->cdr->cdr->car, push_cond(p, hir->cdr->car, ranges));
+      return loop;
+    case HIR_DOALL:
+      /* (counter low high body), high is evaluated once */
+      l = hir->cdr;
+      ranges = range_walk(p, l->cdr->car, ranges);
+      ranges = range_walk(p, l->cdr->cdr->car, ranges);
+      counter = sym(l->car->cdr);
+      low = exp_range(p, l->cdr->car, ranges, &lo, &hi) ? lo : MRB_INT_MIN;
+      if (!exp_range(p, l->cdr->cdr->car, ranges, &lo, &hi))
+        hi = MRB_INT_MAX;
+      high = hi - (hi > MRB_INT_MIN);
+      ary = exp_len_of(p, l->cdr->cdr->car, ranges);
+      l = l->cdr->cdr->cdr->car;
+      loop = push_effects(p, l, ranges);
+      e.p = p;
+      e.assigned = 0;
+      e.shrinks = FALSE;
+      collect_effects(l, &e);
+      if (e.shrinks || hir_member_p(e.assigned, hirsym(ary)))
+        ary = 0;
+      ranges = loop;
+      if (!hir_member_p(e.assigned, hirsym(counter)) && high >= low)
+        ranges = push_range(p, loop, counter, low, high, ary ? LEN_BELOW : LEN_NONE, ary);
+      range_walk(p, l, ranges);
+      return loop;
+    case HIR_CALL:
+      /* the order of evaluation of args is unspecified in C */
+      for (l = hir->cdr->cdr; l; l = l->cdr)
+        ranges = push_effects(p, l->car, ranges);
+      for (l = hir->cdr->cdr; l; l = l->cdr)
+        range_walk(p, l->car, ranges);
+      narrow_call(p, hir, ranges);
+      if (!safe_call_p(p, hir))
+        ranges = push_range(p, ranges, 0, 0, 0, LEN_NONE, 0);
+      return ranges;
+    case HIR_SCALL:
+    case HIR_NEW:
+      for (l = hir->cdr->cdr; l; l = l->cdr)
+        ranges = push_effects(p, l->car, ranges);
+      for (l = hir->cdr->cdr; l; l = l->cdr)
+        range_walk(p, l->car, ranges);
+      return push_range(p, ranges, 0, 0, 0, LEN_NONE, 0);
+    case HIR_FIELD:
+      return range_walk(p, hir->cdr->cdr->car, ranges);
+    case HIR_INIT_LIST:
+    case HIR_RETURN:
+      for (l = hir->cdr; l; l = l->cdr)
+        ranges = range_walk(p, l->car, ranges);
+      return ranges;
+    default:
+      return push_effects(p, hir, ranges);
+  }
+}
+
+static void
+propagate_ranges(hpc_state *p, HIR *stat)
+{
+  range_walk(p, stat, NULL);
+}
+
+/*
+  Accessors
+
+  A reader or a writer called on an instance of a class known at the
+  call-site is a load or a store of the field of the instance,
+  (:HIR_FIELD (class . ivar) recv), instead of the call.  Other small
+  methods are static functions in the same file, which the C compiler
+  inlines.
+ */
+
+static HIR*
+class_ivar(hpc_class *class, mrb_sym name)
+{
+  HIR *ivs;
+
+  for (ivs = class->ivs; ivs; ivs = ivs->cdr) {
+    if (sym(ivs->car->cdr) == name)
+      return ivs->car;
+  }
+  return 0;
+}
+
+static HIR*
+new_field(hpc_state *p, hpc_class *class, HIR *ivar, HIR *recv)
+{
+  HIR *hir = list3((HIR*)HIR_FIELD, cons((HIR*)class, ivar->cdr), recv);
+
+  hir->lat = ivar->lat;
+  return hir;
+}
+
+/* the value of the receiver is not changed by the evaluation of args */
+static int
+simple_recv_p(HIR *recv)
+{
+  switch ((intptr_t)recv->car) {
+    case HIR_LVAR:
+    case HIR_IVAR:
+    case HIR_GVAR:
+      return TRUE;
+    default:
+      return FALSE;
+  }
+}
+
+static void
+inline_accessor(HIR *hir, void *ud)
+{
+  hpc_state *p = (hpc_state *)ud;
+  hpc_class *class;
+  HIR *fundecl, *args, *ivar, *field, *rhs;
+  mrb_sym name;
+
+  if (!hir)
+    return;
+  hir_each_child(hir, inline_accessor, ud);
+  if ((intptr_t)hir->car != HIR_SCALL)
+    return;
+  class = (hpc_class *)hir->cdr->car->car;
+  fundecl = hir->cdr->car->cdr;
+  args = hir->cdr->cdr;
+  if (fundecl->cdr->car)
+    return;                     /* sdefp */
+  if ((name = reader_ivar(p, fundecl)) && (ivar = class_ivar(class, name))) {
+    /* a.x -> a->x */
+    field = new_field(p, class, ivar, args->car);
+    hir->car = field->car;
+    hir->cdr = field->cdr;
+    hir->lat = field->lat;
+  }
+  else if ((name = writer_ivar(p, fundecl)) && (ivar = class_ivar(class, name)) &&
+           simple_recv_p(args->car)) {
+    /* a.x = exp -> a->x = exp */
+    rhs = args->cdr->car;
+    hir->car = (HIR*)HIR_ASSIGN;
+    hir->cdr = list2(new_field(p, class, ivar, args->car), rhs);
+    hir->lat = rhs->lat;
+  }
+}
+
+static void
+inline_accessors(hpc_state *p, HIR *stat)
+{
+  inline_accessor(stat, p);
+}
+
+/*
+  Common and invariant expressions
+
+  Boxed arithmetic and readers are calls what the C compiler cannot
+  see through, so they are shared in the HIR after the typing:
+    an expression computed twice in a statement before anything with
+    an effect is computed once into a temporary
+    an expression of a loop whose locals are not assigned in the loop
+    is computed before the loop, if it reads memory the loop must have
+    no effects
+    a local initialized with a param or a counter and never assigned
+    is replaced with it
+    a local never read is removed with its initializer without effects
+  The temporaries are typed by the lattices of the expressions, so an
+  unboxed value stays unboxed between the uses.
+ */
+
+struct exp_info {
+  int reads;                    /* reads ivars, globals or elements */
+  int traps;                    /* can fail if evaluated speculatively */
+  int size;                     /* number of nodes */
+};
+
+/* the call is an operator of numbers or a read of a builtin */
+static int
+pure_op_p(hpc_state *p, HIR *call, struct exp_info *info)
+{
+  mrb_state *mrb = p->mrb;
+  const char *name = mrb_sym2name(mrb, sym(call->cdr->car));
+  HIR *l;
+  static const char *const ops[] = {
+    "+", "-", "*", "/", "%", "<", "<=", ">", ">=", "==",
+    "&", "|", "^", "<<", ">>", "-@", "to_f", "to_i", NULL
+  };
+  static const char *const reads[] = {
+    "hpc_ary_len", "hpc_numary_len", "hpc_ary_vref", "hpc_fary_ref", "hpc_iary_ref", NULL
+  };
+  int i;
+
+  if (strncmp(name, "hpc_math_", 9) == 0)
+    return TRUE;
+  for (i = 0; reads[i]; i++) {
+    if (strcmp(name, reads[i]) == 0) {
+      info->reads = TRUE;
+      return TRUE;
+    }
+  }
+  /* unchecked reads are valid only under the conditions of the ranges */
+  if (strcmp(name, "hpc_ary_uref") == 0 || strcmp(name, "hpc_ary_fref") == 0) {
+    info->reads = info->traps = TRUE;
+    return TRUE;
+  }
+  for (i = 0; ops[i]; i++) {
+    if (strcmp(name, ops[i]) == 0)
+      break;
+  }
+  if (!ops[i])
+    return FALSE;
+  for (l = call->cdr->cdr; l; l = l->cdr) {
+    if (lat_num(mrb, l->car->lat) == LNUM_NONE)
+      return FALSE;
+  }
+  if ((name[0] == '/' || name[0] == '%') && lat_num(mrb, call->lat) != LNUM_FLOAT)
+    info->traps = TRUE;         /* ZeroDivisionError */
+  return TRUE;
+}
+
+/* the expression has no effects */
+static int
+exp_pure_p(hpc_state *p, HIR *hir, struct exp_info *info)
+{
+  HIR *l;
+
+  info->size++;
+  switch ((intptr_t)hir->car) {
+    case HIR_INT:
+    case HIR_FLOAT:
+    case HIR_PRIM:
+    case HIR_LVAR:
+      return TRUE;
+    case HIR_IVAR:
+    case HIR_GVAR:
+    case HIR_CVAR:
+      info->reads = TRUE;
+      return TRUE;
+    case HIR_CALL:
+      if (!pure_op_p(p, hir, info))
+        return FALSE;
+      break;
+    case HIR_SCALL:
+      if (!reader_ivar(p, hir->cdr->car->cdr))
+        return FALSE;
+      info->reads = info->traps = TRUE;
+      break;
+    case HIR_FIELD:
+      info->reads = info->traps = TRUE;
+      break;
+    default:
+      return FALSE;
+  }
+  for (l = hir->cdr->cdr; l; l = l->cdr) {
+    if (!exp_pure_p(p, l->car, info))
+      return FALSE;
+  }
+  return TRUE;
+}
+
+static int
+hir_equal(mrb_state *mrb, HIR *a, HIR *b)
+{
+  HIR *la, *lb;
+
+  if (a == b)
+    return TRUE;
+  if (a->car != b->car)
+    return FALSE;
+  switch ((intptr_t)a->car) {
+    case HIR_INT:
+    case HIR_FLOAT:
+      return LAT_TYPE(mrb, a->lat) == LAT_CONST && LAT_TYPE(mrb, b->lat) == LAT_CONST &&
+        mrb_type(a->lat) == mrb_type(b->lat) && lat_equal(mrb, a->lat, b->lat);
+    case HIR_PRIM:
+    case HIR_LVAR:
+    case HIR_IVAR:
+    case HIR_GVAR:
+    case HIR_CVAR:
+      return a->cdr == b->cdr;
+    case HIR_CALL:
+      if (a->cdr->car != b->cdr->car)
+        return FALSE;
+      break;
+    case HIR_SCALL:
+      if (a->cdr->car->cdr != b->cdr->car->cdr)
+        return FALSE;
+      break;
+    case HIR_FIELD:
+      if (a->cdr->car->car != b->cdr->car->car || a->cdr->car->cdr != b->cdr->car->cdr)
+        return FALSE;
+      break;
+    default:
+      return FALSE;
+  }
+  for (la = a->cdr->cdr, lb = b->cdr->cdr; la && lb; la = la->cdr, lb = lb->cdr) {
+    if (!hir_equal(mrb, la->car, lb->car))
+      return FALSE;
+  }
+  return !la && !lb;
+}
+
+static int
+call_or_field_p(HIR *hir)
+{
+  switch ((intptr_t)hir->car) {
+    case HIR_CALL:
+    case HIR_SCALL:
+    case HIR_FIELD:
+      return TRUE;
+    default:
+      return FALSE;
+  }
+}
+
+/* a call or a load worth a temporary */
+static int
+shared_exp_p(hpc_state *p, HIR *hir)
+{
+  return call_or_field_p(hir) && LAT_TYPE(p->mrb, hir->lat) != LAT_CONST;
+}
+
+/* the largest candidate occurring min_count times or more in slots */
+static HIR*
+largest_slot(hpc_state *p, HIR *slots, int min_count)
+{
+  HIR *l, *m, *best = 0;
+  int best_size = 0;
+
+  for (l = slots; l; l = l->cdr) {
+    struct exp_info info = {0};
+    int count = 0;
+    for (m = slots; m; m = m->cdr) {
+      if (hir_equal(p->mrb, l->car->car, m->car->car))
+        count++;
+    }
+    exp_pure_p(p, l->car->car, &info);
+    if (count >= min_count && info.size > best_size) {
+      best = l->car;
+      best_size = info.size;
+    }
+  }
+  return best;
+}
+
+/* replace the expression in slots with a new temporary, return its decl */
+static HIR*
+share_slots(hpc_state *p, HIR *slots, HIR *best)
+{
+  HIR *exp = best->car, *t = new_temp(p, exp->lat), *l;
+
+  for (l = slots; l; l = l->cdr) {
+    if (hir_equal(p->mrb, l->car->car, exp))
+      l->car->car = t;
+  }
+  return new_temp_decl(p, t, exp);
+}
+
+struct cse_walk {
+  hpc_state *p;
+  HIR *slots;                   /* cells whose car is a candidate */
+  int stopped;                  /* an effect is evaluated */
+};
+
+/* candidates in the cell slot evaluated before any effect */
+static void
+collect_common(struct cse_walk *w, HIR *slot)
+{
+  struct exp_info info = {0};
+  HIR *hir = slot->car, *l;
+
+  if (w->stopped || !hir)
+    return;
+  if (exp_pure_p(w->p, hir, &info)) {
+    if (shared_exp_p(w->p, hir))
+      w->slots = cons_gen(w->p, slot, w->slots);
+    if (call_or_field_p(hir)) {
+      for (l = hir->cdr->cdr; l; l = l->cdr)
+        collect_common(w, l);
+    }
+    return;
+  }
+  switch ((intptr_t)hir->car) {
+    case HIR_CALL:
+    case HIR_SCALL:
+    case HIR_NEW:
+    case HIR_FIELD:
+      for (l = hir->cdr->cdr; l; l = l->cdr)
+        collect_common(w, l);
+      break;
+    case HIR_ASSIGN:
+      collect_common(w, hir->cdr->cdr);
+      break;
+    case HIR_RETURN:
+    case HIR_INIT_LIST:
+      for (l = hir->cdr; l; l = l->cdr)
+        collect_common(w, l);
+      return;
+    case HIR_COND_OP:
+      /* the branches are evaluated conditionally */
+      collect_common(w, hir->cdr);
+      break;
+    default:
+      break;
+  }
+  w->stopped = TRUE;
+}
+
+/* compute the common expressions of a statement into temporaries */
+static HIR*
+share_common_exps(hpc_state *p, HIR *stat)
+{
+  struct cse_walk w;
+  HIR *decls = 0, *root = list1(stat), *best, *l;
+
+  w.p = p;
+  for (;;) {
+    w.slots = 0;
+    w.stopped = FALSE;
+    for (l = decls; l; l = l->cdr)
+      collect_common(&w, l->car->cdr->cdr->cdr);
+    collect_common(&w, root);
+    best = largest_slot(p, w.slots, 2);
+    if (!best)
+      break;
+    decls = append(p, decls, list1(share_slots(p, w.slots, best)));
+  }
+  if (!decls)
+    return stat;
+  return new_scope(p, decls, new_block(p, root));
+}
+
+struct licm_walk {
+  hpc_state *p;
+  HIR *variant;                 /* symbols of locals assigned in the loop */
+  int writes;                   /* the loop has effects other than locals */
+  HIR *slots;
+};
+
+/* an effect other than an assignment of a local */
+static void
+check_writes(HIR *hir, void *ud)
+{
+  struct licm_walk *w = (struct licm_walk *)ud;
+  struct exp_info info = {0};
+
+  if (!hir || w->writes)
+    return;
+  switch ((intptr_t)hir->car) {
+    case HIR_CALL:
+    case HIR_SCALL:
+      if (!exp_pure_p(w->p, hir, &info))
+        w->writes = TRUE;
+      break;
+    case HIR_NEW:
+      w->writes = TRUE;
+      break;
+    case HIR_ASSIGN:
+      if ((intptr_t)hir->cdr->car->car != HIR_LVAR)
+        w->writes = TRUE;
+      break;
+    default:
+      break;
+  }
+  hir_each_child(hir, check_writes, ud);
+}
+
+/* the counters of the loops are not assigned by HIR_ASSIGN */
+static void
+collect_counters(HIR *hir, void *ud)
+{
+  struct licm_walk *w = (struct licm_walk *)ud;
+
+  if (!hir)
+    return;
+  if ((intptr_t)hir->car == HIR_DOALL)
+    w->variant = cons_gen(w->p, hir->cdr->car->cdr, w->variant);
+  hir_each_child(hir, collect_counters, ud);
+}
+
+static int
+invariant_p(struct licm_walk *w, HIR *hir)
+{
+  HIR *l;
+
+  switch ((intptr_t)hir->car) {
+    case HIR_LVAR:
+      return !hir_member_p(w->variant, hir->cdr);
+    case HIR_CALL:
+    case HIR_SCALL:
+    case HIR_FIELD:
+      for (l = hir->cdr->cdr; l; l = l->cdr) {
+        if (!invariant_p(w, l->car))
+          return FALSE;
+      }
+      return TRUE;
+    default:
+      return TRUE;
+  }
+}
+
+static void collect_invariant(struct licm_walk *w, HIR *slot);
+
+static void
+collect_invariant_in(struct licm_walk *w, HIR *hir)
+{
+  HIR *l;
+
+  switch ((intptr_t)hir->car) {
+    case HIR_SCOPE:
+      for (l = hir->cdr->car; l; l = l->cdr)
+        collect_invariant(w, l->car->cdr->cdr->cdr);
+      collect_invariant_in(w, hir->cdr->cdr);
+      return;
+    case HIR_CALL:
+    case HIR_SCALL:
+    case HIR_NEW:
+    case HIR_FIELD:
+      for (l = hir->cdr->cdr; l; l = l->cdr)
+        collect_invariant(w, l);
+      return;
+    case HIR_BLOCK:
+      for (l = hir->cdr->car; l; l = l->cdr)
+        collect_invariant(w, l);
+      return;
+    case HIR_ASSIGN:
+      collect_invariant(w, hir->cdr->cdr);
+      return;
+    case HIR_DOALL:
+      /* not the counter */
+      for (l = hir->cdr->cdr; l; l = l->cdr)
+        collect_invariant(w, l);
+      return;
+    case HIR_INIT_LIST:
+    case HIR_IFELSE:
+    case HIR_WHILE:
+    case HIR_RETURN:
+    case HIR_COND_OP:
+      for (l = hir->cdr; l; l = l->cdr)
+        collect_invariant(w, l);
+      return;
+    default:
+      return;
+  }
+}
+
+/* candidates in the cell slot of the loop */
+static void
+collect_invariant(struct licm_walk *w, HIR *slot)
+{
+  struct exp_info info = {0};
+  HIR *hir = slot->car;
+
+  if (!hir)
+    return;
+  if (exp_pure_p(w->p, hir, &info) && shared_exp_p(w->p, hir) &&
+      !info.traps && !(info.reads && w->writes) && invariant_p(w, hir))
+    w->slots = cons_gen(w->p, slot, w->slots);
+  else
+    collect_invariant_in(w, hir);
+}
+
+/* compute the invariant expressions of a loop before it */
+static HIR*
+hoist_invariants(hpc_state *p, HIR *loop)
+{
+  struct hir_effects e;
+  struct licm_walk w;
+  HIR *decls = 0, *best;
+
+  e.p = p;
+  e.assigned = 0;
+  e.shrinks = FALSE;
+  collect_effects(loop, &e);
+  w.p = p;
+  w.variant = e.assigned;
+  w.writes = FALSE;
+  check_writes(loop, &w);
+  collect_counters(loop, &w);
+  for (;;) {
+    w.slots = 0;
+    if ((intptr_t)loop->car == HIR_DOALL)
+      collect_invariant_in(&w, loop->cdr->cdr->cdr->cdr->car);
+    else
+      collect_invariant_in(&w, loop);
+    best = largest_slot(p, w.slots, 1);
+    if (!best)
+      break;
+    decls = append(p, decls, list1(share_slots(p, w.slots, best)));
+  }
+  if (!decls)
+    return loop;
+  return new_scope(p, decls, new_block(p, list1(loop)));
+}
+
+struct var_use {
+  mrb_sym var;
+  int decls, assigns, reads;
+  HIR *decl;
+  struct var_use *next;
+};
+
+struct var_uses {
+  hpc_state *p;
+  struct var_use *head;
+};
+
+static struct var_use*
+var_use_of(struct var_uses *u, mrb_sym var)
+{
+  struct var_use *v;
+
+  for (v = u->head; v; v = v->next) {
+    if (v->var == var)
+      return v;
+  }
+  v = (struct var_use *)compiler_palloc(u->p, sizeof(struct var_use));
+  v->var = var;
+  v->decls = v->assigns = v->reads = 0;
+  v->decl = 0;
+  v->next = u->head;
+  u->head = v;
+  return v;
+}
+
+static void
+count_uses(HIR *hir, void *ud)
+{
+  struct var_uses *u = (struct var_uses *)ud;
+  struct var_use *v;
+
+  if (!hir)
+    return;
+  switch ((intptr_t)hir->car) {
+    case HIR_LVARDECL:
+      v = var_use_of(u, sym(hir->cdr->cdr->car));
+      v->decls++;
+      v->decl = hir;
+      break;
+    case HIR_ASSIGN:
+      if ((intptr_t)hir->cdr->car->car == HIR_LVAR) {
+        var_use_of(u, sym(hir->cdr->car->cdr))->assigns++;
+        count_uses(hir->cdr->cdr->car, ud);
+        return;
       }
-    case NODE_FLOAT:
-      return new_float(p, (char *)tree, 10, str_to_mrb_float((char *)tree));
-    case NODE_DEF:
-      /* This node will be translated later using information of call-sites */
-      add_def(s, tree, FALSE);
-      return new_empty(p);
-    case NODE_SDEF:
-      add_def(s, tree->cdr, TRUE);
-      return new_empty(p);
-    case NODE_IF:
-      {
-        HIR *ifthen = 0, *ifelse = 0, *cond = typing(s, tree->car);
-        hpc_scope *s2 = scope_dup(s);
-        if (tree->cdr->car)
-          ifthen = typing(s, tree->cdr->car);
-        if (tree->cdr->cdr->car)
-          ifelse = typing(s2, tree->cdr->cdr->car);
-        join_scope(s, s2);
-        return new_ifelse(p, cond, ifthen, ifelse);
+      break;
+    case HIR_LVAR:
+      var_use_of(u, sym(hir->cdr))->reads++;
+      return;
+    default:
+      break;
+  }
+  hir_each_child(hir, count_uses, ud);
+}
+
+struct assign_of {
+  mrb_sym var;
+  int found;
+};
+
+static void
+find_assign(HIR *hir, void *ud)
+{
+  struct assign_of *a = (struct assign_of *)ud;
+
+  if (!hir || a->found)
+    return;
+  if ((intptr_t)hir->car == HIR_ASSIGN &&
+      (intptr_t)hir->cdr->car->car == HIR_LVAR && sym(hir->cdr->car->cdr) == a->var) {
+    a->found = TRUE;
+    return;
+  }
+  hir_each_child(hir, find_assign, ud);
+}
+
+struct call_of {
+  mrb_sym mid;
+  int found;
+};
+
+static void
+find_call(HIR *hir, void *ud)
+{
+  struct call_of *c = (struct call_of *)ud;
+
+  if (!hir || c->found)
+    return;
+  if ((intptr_t)hir->car == HIR_CALL && sym(hir->cdr->car) == c->mid) {
+    c->found = TRUE;
+    return;
+  }
+  hir_each_child(hir, find_call, ud);
+}
+
+/* hir calls the function mid, e.g. hpc_yield */
+int
+hpc_calls_p(HIR *hir, mrb_sym mid)
+{
+  struct call_of c;
+
+  c.mid = mid;
+  c.found = FALSE;
+  find_call(hir, &c);
+  return c.found;
+}
+
+/* the local is assigned in hir; a param which is not keeps the value
+   the caller holds */
+int
+hpc_assigned_p(HIR *hir, mrb_sym var)
+{
+  struct assign_of a;
+
+  a.var = var;
+  a.found = FALSE;
+  find_assign(hir, &a);
+  return a.found;
+}
+
+struct rename {
+  mrb_sym from;
+  HIR *to;                      /* HIR_LVAR */
+};
+
+static void
+rename_lvar(HIR *hir, void *ud)
+{
+  struct rename *r = (struct rename *)ud;
+
+  if (!hir)
+    return;
+  if ((intptr_t)hir->car == HIR_LVAR && sym(hir->cdr) == r->from) {
+    hir->cdr = r->to->cdr;
+    hir->lat = r->to->lat;
+    return;
+  }
+  hir_each_child(hir, rename_lvar, ud);
+}
+
+/* replace the locals initialized with an unassigned local with it */
+static void
+propagate_copies(hpc_state *p, HIR *stat)
+{
+  struct var_uses u;
+  struct var_use *v, *x;
+  struct rename r;
+  HIR *init;
+
+  u.p = p;
+  u.head = 0;
+  count_uses(stat, &u);
+  for (v = u.head; v; v = v->next) {
+    if (v->decls != 1 || v->assigns != 0)
+      continue;
+    init = v->decl->cdr->cdr->cdr->car;
+    if ((intptr_t)init->car != HIR_LVAR)
+      continue;
+    x = var_use_of(&u, sym(init->cdr));
+    /* params and counters are not declared by LVARDECL, a local
+       declared once is visible in the scope of v */
+    if (x->assigns != 0 || x->decls > 1 ||
+        (x->decls == 1 && (intptr_t)x->decl->cdr->cdr->cdr->car->car == HIR_EMPTY) ||
+        v->decl->cdr->car != infer_type(p, init->lat))
+      continue;
+    r.from = v->var;
+    r.to = init;
+    v->decl->cdr->cdr->cdr->car = new_empty(p);
+    rename_lvar(stat, &r);
+  }
+}
+
+/* the locals without reads whose initializers have no effects */
+static HIR*
+dead_vars(hpc_state *p, HIR *stat)
+{
+  struct var_uses u;
+  struct var_use *v;
+  HIR *dead = 0, *init;
+
+  u.p = p;
+  u.head = 0;
+  count_uses(stat, &u);
+  for (v = u.head; v; v = v->next) {
+    struct exp_info info = {0};
+    if (v->decls != 1 || v->assigns != 0 || v->reads != 0)
+      continue;
+    init = v->decl->cdr->cdr->cdr->car;
+    if ((intptr_t)init->car == HIR_EMPTY || exp_pure_p(p, init, &info))
+      dead = cons_gen(p, hirsym(v->var), dead);
+  }
+  return dead;
+}
+
+struct dead_decls {
+  HIR *vars;
+  int removed;
+};
+
+static void
+remove_decls(HIR *hir, void *ud)
+{
+  struct dead_decls *d = (struct dead_decls *)ud;
+  HIR **l;
+
+  if (!hir)
+    return;
+  if ((intptr_t)hir->car == HIR_SCOPE) {
+    for (l = &hir->cdr->car; *l; ) {
+      if ((intptr_t)(*l)->car->car == HIR_LVARDECL &&
+          hir_member_p(d->vars, (*l)->car->cdr->cdr->car)) {
+        *l = (*l)->cdr;
+        d->removed++;
       }
-    case NODE_LVAR:
-      return lookup_lvar(s, sym(tree));
-    case NODE_IVAR:
-      return lookup_ivar(s->class, sym(tree));
-    case NODE_CVAR:
-      return lookup_cvar(s->class, sym(tree));
-    case NODE_SELF:
-      return s->current_self;
-    case NODE_RETURN:
-      if (tree) {
-        return new_return_value(p, typing(s, tree));
-      } else {
-        return new_return_void(p);
+      else
+        l = &(*l)->cdr;
+    }
+  }
+  hir_each_child(hir, remove_decls, ud);
+}
+
+static HIR* simplify_stat(hpc_state *p, HIR *hir);
+
+/* simplify the statements in an expression */
+static HIR*
+simplify_exp(hpc_state *p, HIR *hir)
+{
+  HIR *l;
+
+  if (!hir)
+    return hir;
+  switch ((intptr_t)hir->car) {
+    case HIR_SCOPE:
+      /* the last statement is the value */
+      for (l = hir->cdr->car; l; l = l->cdr)
+        l->car->cdr->cdr->cdr->car = simplify_exp(p, l->car->cdr->cdr->cdr->car);
+      l = hir->cdr->cdr;
+      if ((intptr_t)l->car != HIR_BLOCK) {
+        hir->cdr->cdr = simplify_exp(p, l);
+        return hir;
       }
-    case NODE_ASGN:
-      return typing_assign(s, tree->car, typing(s, tree->cdr));
-    case NODE_MASGN:
-      if ((intptr_t)tree->cdr->car != NODE_ARRAY) {
-        NOT_IMPLEMENTED();
+      for (l = l->cdr->car; l; l = l->cdr)
+        l->car = l->cdr ? simplify_stat(p, l->car) : simplify_exp(p, l->car);
+      return hir;
+    case HIR_BLOCK:
+      /* (a + b) * c is a * c of a = a + b */
+      l = hir->cdr->car;
+      if (!l || l->cdr)
+        return hir;
+      switch ((intptr_t)l->car->car) {
+        case HIR_INT:
+        case HIR_FLOAT:
+        case HIR_LVAR:
+        case HIR_IVAR:
+        case HIR_GVAR:
+        case HIR_CVAR:
+        case HIR_CALL:
+        case HIR_SCALL:
+        case HIR_NEW:
+        case HIR_FIELD:
+          return simplify_exp(p, l->car);
+        default:
+          return hir;
       }
-      {
-        HIR *assigns = 0;
-        node *lhs = tree->car->car;
-        node *rhs = tree->cdr->cdr;
-        HIR *temps = 0;
+    case HIR_ASSIGN:
+    case HIR_INIT_LIST:
+    case HIR_RETURN:
+    case HIR_COND_OP:
+      for (l = hir->cdr; l; l = l->cdr)
+        l->car = simplify_exp(p, l->car);
+      return hir;
+    case HIR_CALL:
+    case HIR_SCALL:
+    case HIR_NEW:
+    case HIR_FIELD:
+      for (l = hir->cdr->cdr; l; l = l->cdr)
+        l->car = simplify_exp(p, l->car);
+      return hir;
+    default:
+      return hir;
+  }
+}
+
+static HIR*
+simplify_stat(hpc_state *p, HIR *hir)
+{
+  HIR *l;
+
+  if (!hir)
+    return hir;
+  switch ((intptr_t)hir->car) {
+    case HIR_SCOPE:
+      for (l = hir->cdr->car; l; l = l->cdr) {
+        if ((intptr_t)l->car->car == HIR_LVARDECL)
+          l->car->cdr->cdr->cdr->car = simplify_exp(p, l->car->cdr->cdr->cdr->car);
+      }
+      hir->cdr->cdr = simplify_stat(p, hir->cdr->cdr);
+      return hir;
+    case HIR_BLOCK:
+      for (l = hir->cdr->car; l; l = l->cdr)
+        l->car = simplify_stat(p, l->car);
+      return hir;
+    case HIR_IFELSE:
+      l = hir->cdr;
+      l->car = simplify_exp(p, l->car);
+      l->cdr->car = simplify_stat(p, l->cdr->car);
+      l->cdr->cdr->car = simplify_stat(p, l->cdr->cdr->car);
+      return hir;
+    case HIR_WHILE:
+      l = hir->cdr;
+      l->car = simplify_exp(p, l->car);
+      l->cdr->car = simplify_stat(p, l->cdr->car);
+      return hoist_invariants(p, hir);
+    case HIR_DOALL:
+      l = hir->cdr->cdr;
+      l->car = simplify_exp(p, l->car);
+      l->cdr->car = simplify_exp(p, l->cdr->car);
+      l->cdr->cdr->car = simplify_stat(p, l->cdr->cdr->car);
+      return hoist_invariants(p, hir);
+    case HIR_ASSIGN:
+    case HIR_RETURN:
+    case HIR_CALL:
+    case HIR_SCALL:
+    case HIR_NEW:
+      return share_common_exps(p, simplify_exp(p, hir));
+    default:
+      return hir;
+  }
+}
+
+static void
+share_exps(hpc_state *p, HIR *stat)
+{
+  struct dead_decls d;
+
+  /* the pass cannot replace the body itself */
+  if (!stat || ((intptr_t)stat->car != HIR_SCOPE && (intptr_t)stat->car != HIR_BLOCK))
+    return;
+  propagate_copies(p, stat);
+  simplify_stat(p, stat);
+  propagate_copies(p, stat);
+  do {
+    d.vars = dead_vars(p, stat);
+    d.removed = 0;
+    remove_decls(stat, &d);
+  } while (d.removed);
+}
+
+/*
+  Strings
+
+  A String made by + and << of literals, Fixnum#to_s and Fixnum#chr is
+  built in one buffer allocated for all of its pieces, instead of a
+  String for every operand and every operator:
+    (:HIR_CALL hpc_str_build piece...)        a new String
+    (:HIR_CALL hpc_str_append str piece...)   the pieces appended to str
+  print and puts of such a String write the pieces to the output
+  without building it:
+    (:HIR_CALL hpc_print piece...)
+  A piece is a literal, a Fixnum for its to_s, a call of chr on a
+  Fixnum, or any other String.  The bytes of literals are copied from
+  C string literals, so they are never allocated as objects.
+  The pieces are evaluated and appended in order, so a String is read
+  earlier than by the operators; it is built so only if nothing with
+  an effect is evaluated between (see collect_pieces).
+ */
+
+struct str_pieces {
+  hpc_state *p;
+  HIR *list, *last;
+  int len;                      /* number of pieces */
+};
+
+static int
+str_call_p(hpc_state *p, HIR *hir, const char *name, int argc)
+{
+  return (intptr_t)hir->car == HIR_CALL &&
+    strcmp(mrb_sym2name(p->mrb, sym(hir->cdr->car)), name) == 0 &&
+    hir_len(hir->cdr->cdr) == argc + 1;
+}
+
+static int
+str_lat_p(hpc_state *p, HIR *hir)
+{
+  return lat_class_of(p->mrb, hir->lat) == p->mrb->string_class;
+}
+
+/* Fixnum#to_s or Fixnum#chr */
+static int
+int_str_p(hpc_state *p, HIR *hir, const char *name)
+{
+  return str_call_p(p, hir, name, 0) && lat_num(p->mrb, hir->cdr->cdr->car->lat) == LNUM_INT;
+}
+
+static int fresh_str_p(hpc_state *p, HIR *hir);
+
+/* a + b, or a << b of a new String a */
+static int
+str_chain_p(hpc_state *p, HIR *hir)
+{
+  if (!str_lat_p(p, hir))
+    return FALSE;
+  if (str_call_p(p, hir, "<<", 1))
+    return fresh_str_p(p, hir->cdr->cdr->car);
+  return str_call_p(p, hir, "+", 1);
+}
+
+/* the expression makes a new String */
+static int
+fresh_str_p(hpc_state *p, HIR *hir)
+{
+  return (intptr_t)hir->car == HIR_STRING || str_chain_p(p, hir) ||
+    int_str_p(p, hir, "to_s") || int_str_p(p, hir, "chr");
+}
+
+/* a piece read when it is appended */
+static int
+str_leaf_p(hpc_state *p, HIR *hir)
+{
+  return !fresh_str_p(p, hir);
+}
+
+static int
+str_pure_p(hpc_state *p, HIR *hir)
+{
+  struct exp_info info = {0, 0, 0};
+
+  if ((intptr_t)hir->car == HIR_STRING)
+    return TRUE;
+  if (int_str_p(p, hir, "to_s") || int_str_p(p, hir, "chr"))
+    return exp_pure_p(p, hir->cdr->cdr->car, &info);
+  if (str_chain_p(p, hir))
+    return str_pure_p(p, hir->cdr->cdr->car) && str_pure_p(p, hir->cdr->cdr->cdr->car);
+  return exp_pure_p(p, hir, &info);
+}
+
+static HIR*
+join_literals(hpc_state *p, HIR *a, HIR *b)
+{
+  int alen = (int)(intptr_t)a->cdr->cdr->car, blen = (int)(intptr_t)b->cdr->cdr->car;
+  char *buf = (char *)compiler_palloc(p, alen + blen + 1);
+
+  memcpy(buf, (char *)a->cdr->car, alen);
+  memcpy(buf + alen, (char *)b->cdr->car, blen);
+  buf[alen + blen] = '\0';
+  return new_str(p, buf, alen + blen);
+}
+
+static void
+add_piece(struct str_pieces *s, HIR *piece)
+{
+  hpc_state *p = s->p;
+
+  HIR *cell;
+
+  if ((intptr_t)piece->car == HIR_STRING && s->last &&
+      (intptr_t)s->last->car->car == HIR_STRING) {
+    /* "a" + "b" -> "ab" */
+    s->last->car = join_literals(p, s->last->car, piece);
+    return;
+  }
+  cell = cons(piece, 0);
+  if (s->last)
+    s->last->cdr = cell;
+  else
+    s->list = cell;
+  s->last = cell;
+  s->len++;
+}
+
+static void
+init_pieces(struct str_pieces *s, hpc_state *p)
+{
+  s->p = p;
+  s->list = s->last = 0;
+  s->len = 0;
+}
+
+static void
+collect_pieces(struct str_pieces *s, HIR *hir)
+{
+  hpc_state *p = s->p;
+  HIR *lhs, *rhs;
+
+  if ((intptr_t)hir->car == HIR_STRING || int_str_p(p, hir, "chr")) {
+    add_piece(s, hir);
+    return;
+  }
+  if (int_str_p(p, hir, "to_s")) {
+    add_piece(s, hir->cdr->cdr->car);
+    return;
+  }
+  if (str_chain_p(p, hir)) {
+    lhs = hir->cdr->cdr->car;
+    rhs = hir->cdr->cdr->cdr->car;
+    /* a + f: a is read after f is evaluated */
+    if (!str_leaf_p(p, lhs) || str_pure_p(p, rhs)) {
+      collect_pieces(s, lhs);
+      collect_pieces(s, rhs);
+      return;
+    }
+  }
+  add_piece(s, hir);
+}
+
+/*
+  The pieces of an operand of << can be appended one by one: they
+  cannot change nor be the String appended to
+ */
+static int
+appendable_p(struct str_pieces *arg)
+{
+  hpc_state *p = arg->p;
+  HIR *l;
+
+  if (arg->len == 1)
+    return TRUE;
+  for (l = arg->list; l; l = l->cdr) {
+    if (!str_pure_p(p, l->car) || (str_leaf_p(p, l->car) && str_lat_p(p, l->car)))
+      return FALSE;
+  }
+  return TRUE;
+}
+
+/* s << a << b: the pieces of a and b appended to s, returns s */
+static HIR*
+collect_appended(struct str_pieces *s, HIR *hir)
+{
+  hpc_state *p = s->p;
+  struct str_pieces arg;
+  HIR *str, *l;
+
+  if (!str_lat_p(p, hir) || !str_call_p(p, hir, "<<", 1) || fresh_str_p(p, hir))
+    return hir;
+  str = collect_appended(s, hir->cdr->cdr->car);
+  init_pieces(&arg, p);
+  collect_pieces(&arg, hir->cdr->cdr->cdr->car);
+  if (!appendable_p(&arg)) {
+    add_piece(s, hir->cdr->cdr->cdr->car);
+    return str;
+  }
+  for (l = arg.list; l; l = l->cdr)
+    add_piece(s, l->car);
+  return str;
+}
 
-        while (rhs) {
-          mrb_sym temp = temp_sym(p);
-          HIR *hir_rhs = typing(s, rhs->car);
-          HIR *lvar = new_lvar(p, temp, hir_rhs->lat);
+/* print and puts of self */
+static int
+print_call_p(hpc_state *p, HIR *hir, const char *name)
+{
+  HIR *recv;
 
-          unshift(assigns, new_lvardecl(p, infer_type(p, hir_rhs->lat), temp, hir_rhs));
-          unshift(temps, lvar);
+  if (!str_call_p(p, hir, name, 1))
+    return FALSE;
+  recv = hir->cdr->cdr->car;
+  return (intptr_t)recv->car == HIR_LVAR &&
+    strcmp(mrb_sym2name(p->mrb, sym(recv->cdr)), "__self__") == 0;
+}
 
-          rhs = rhs->cdr;
-        }
-        while (lhs) {
-          unshift(assigns, typing_assign(s, lhs->car, temps->car));
-          lhs = lhs->cdr;
-          temps = temps->cdr;
-        }
-        return new_block(p, assigns);
-      }
-    case NODE_CONST:
-    case NODE_GVAR:
-      {
-        HIR *gvar = find_var_list(p->gvars, sym(tree));
-        if (!gvar) {
-          gvar = new_gvar(p, sym(tree), lat_unknown);
-          p->gvars = cons(gvar, p->gvars);
-        }
-        return gvar;
-      }
-    case NODE_MODULE:
-      {
-        mrb_sym class_name = sym(tree->car->cdr);
-        hpc_class *c = collect_class_defs(s, class_name, tree->cdr->car->cdr);
-        return new_defclass(p, c);
-      }
+/*
+  The pieces written by print or puts, FALSE if they are not known.
+  Output of the pieces must not be mixed with output of the others.
+ */
+static int
+collect_printed(struct str_pieces *s, HIR *hir)
+{
+  hpc_state *p = s->p;
+  int puts = print_call_p(p, hir, "puts");
+  HIR *arg, *l, *last;
+
+  if (!puts && !print_call_p(p, hir, "print"))
+    return FALSE;
+  arg = hir->cdr->cdr->cdr->car;
+  if (fresh_str_p(p, arg))
+    collect_pieces(s, arg);
+  else if (lat_num(p->mrb, arg->lat) == LNUM_INT)
+    add_piece(s, arg);
+  else
+    return FALSE;
+  for (l = s->list->cdr; l; l = l->cdr) {
+    if (!str_pure_p(p, l->car))
+      return FALSE;
+  }
+  if (puts) {
+    /* puts adds a newline unless the String ends with it */
+    last = s->last->car;
+    if ((intptr_t)last->car == HIR_STRING) {
+      int len = (int)(intptr_t)last->cdr->cdr->car;
+      if (len == 0 || ((char *)last->cdr->car)[len-1] != '\n')
+        add_piece(s, new_str(p, (char *)"\n", 1));
+    }
+    else if (lat_num(p->mrb, last->lat) == LNUM_INT)
+      add_piece(s, new_str(p, (char *)"\n", 1));
+    else
+      return FALSE;
+  }
+  return TRUE;
+}
+
+static void
+build_string(HIR *hir, void *ud)
+{
+  hpc_state *p = (hpc_state *)ud;
+  struct str_pieces s;
+  const char *name = 0;
+  HIR *str = 0, *l;
+
+  if (!hir)
+    return;
+  init_pieces(&s, p);
+  if (collect_printed(&s, hir)) {
+    name = "hpc_print";
+  }
+  else if (str_lat_p(p, hir) && str_call_p(p, hir, "<<", 1) && !fresh_str_p(p, hir)) {
+    init_pieces(&s, p);
+    str = collect_appended(&s, hir);
+    name = "hpc_str_append";
+  }
+  else if (fresh_str_p(p, hir) && (intptr_t)hir->car != HIR_STRING) {
+    init_pieces(&s, p);
+    collect_pieces(&s, hir);
+    /* a + f() is left to the operator */
+    if (s.len > 1 || s.list->car != hir)
+      name = "hpc_str_build";
+  }
+  if (!name) {
+    hir_each_child(hir, build_string, ud);
+    return;
+  }
+  for (l = s.list; l; l = l->cdr) {
+    if (int_str_p(p, l->car, "chr"))
+      build_string(l->car->cdr->cdr->car, ud);
+    else
+      build_string(l->car, ud);
+  }
+  if (str) {
+    build_string(str, ud);
+    s.list = cons(str, s.list);
+  }
+  hir->car = (HIR*)HIR_CALL;
+  hir->cdr = cons(hirsym(mrb_intern_cstr(p->mrb, name)), s.list);
+}
+
+static void
+build_strings(hpc_state *p, HIR *stat)
+{
+  build_string(stat, p);
+}
+
+/* run a pass over the bodies of the program */
+static void
+optimize_program(hpc_state *p, HIR *main_body, void (*pass)(hpc_state*, HIR*))
+{
+  HIR *classes, *l;
+
+  pass(p, main_body);
+  for (classes = p->classes; classes; classes = classes->cdr) {
+    hpc_class *c = (hpc_class *)classes->car;
+    pass(p, c->initializer);
+    for (l = c->methods; l; l = l->cdr)
+      pass(p, l->car->cdr->cdr->cdr->cdr->cdr->car);
+    for (l = c->clones; l; l = l->cdr)
+      pass(p, ((hpc_clone *)l->car)->fundecl->cdr->cdr->cdr->cdr->cdr->car);
+  }
+}
+
+/* return a raw list of decls (fundecl, global decl) */
+/* a top level statement run by the VM when p->vm_main */
+static int
+vm_main_stmt_p(hpc_state *p, node *stmt)
+{
+  switch ((intptr_t)stmt->car) {
     case NODE_CLASS:
-      {
-        mrb_sym class_name = sym(tree->car->cdr);
-        hpc_class *c = collect_class_defs(s, class_name, tree->cdr->cdr->car->cdr);
-        return new_defclass(p, c);
-      }
-    case NODE_STR:
-      return new_str(p, (char*)tree->car, (int)(intptr_t)tree->cdr);
-    case NODE_AND:
-      /* (lhs ? rhs : lhs) */
-      {
-        HIR *lhs = typing(s, tree->car);
-        HIR *rhs = typing(s, tree->cdr);
-        return new_cond_op(p, lhs, rhs, lhs);
-      }
-    case NODE_OR:
-      /* (lhs ? lhs : rhs) */
-      {
-        HIR *lhs = typing(s, tree->car);
-        HIR *rhs = typing(s, tree->cdr);
-        return new_cond_op(p, lhs, lhs, rhs);
-      }
-    case NODE_FALSE:
-      return new_prim(p, HPTYPE_FALSE);
-    case NODE_TRUE:
-      return new_prim(p, HPTYPE_TRUE);
-    case NODE_NEGATE:
-      /* NEGATE is only for literal */
-      {
-        HIR *child = typing(s, tree);
-        char *old_lit = (char *)child->cdr->car;
-        char *new_lit = compiler_palloc(p, strlen(old_lit) + 2);
-        hpc_assert((intptr_t)child->car == HIR_INT
-                   || (intptr_t)child->car == HIR_FLOAT);
-        sprintf(new_lit, "-%s", old_lit);
-        child->cdr->car = (HIR *)new_lit;
-        return child;
-      }
+      return vm_class_p(p, sym(stmt->cdr->car->cdr));
+    case NODE_DEF:
+    case NODE_SDEF:
+    case NODE_MODULE:
+      return FALSE;
     default:
-      NOT_REACHABLE();
+      return TRUE;
   }
 }
 
-/* return a raw list of decls (fundecl, global decl) */
+/*
+  A constant assigned a number, which the compiled methods fold.  The VM
+  assigns it as well.
+ */
+static int
+num_const_asgn_p(node *stmt)
+{
+  node *rhs;
+
+  if ((intptr_t)stmt->car != NODE_ASGN || (intptr_t)stmt->cdr->car->car != NODE_CONST)
+    return FALSE;
+  rhs = stmt->cdr->cdr;
+  if ((intptr_t)rhs->car == NODE_NEGATE)
+    rhs = rhs->cdr;
+  return (intptr_t)rhs->car == NODE_INT || (intptr_t)rhs->car == NODE_FLOAT;
+}
+
+/*
+  (NODE_SCOPE locals NODE_BEGIN stmts...) of the top level statements
+  the compiled code runs
+ */
+static node*
+compiled_main_ast(hpc_state *p, node *ast)
+{
+  node *stmts = 0, **tail = &stmts, *l;
+  int lineno;
+
+  if (!p->vm_main)
+    return ast;
+  for (l = ast->cdr->cdr->cdr; l; l = l->cdr) {
+    if (vm_main_stmt_p(p, l->car) && !num_const_asgn_p(l->car))
+      continue;
+    lineno = l->lineno;
+    *tail = AST_LIST1(l->car);
+    tail = &(*tail)->cdr;
+  }
+  lineno = ast->lineno;
+  return AST(NODE_SCOPE, AST(ast->cdr->car, AST(NODE_BEGIN, stmts)));
+}
+
+/*
+  If the top level statements use what hpcmrb does not compile, they are
+  left to the VM (see hpc_vm_program) and 0 is returned to type the
+  program again with only the defs, the classes and the constants of
+  numbers.
+ */
 static HIR*
-compile(hpc_state *p, node *ast)
+typing_program(hpc_state *p, node *ast, HIR **main_body)
 {
   HIR *topdecls;
   hpc_class *top_class = hpc_top_class_new(p);
   hpc_scope *scope = scope_new(p, 0, 0, top_class, FALSE);
-  HIR *main_body = typing(scope, ast);
+  struct hpc_inline *inlining = p->inlining;
+  HIR *float_arrays = p->float_arrays;
+  int float_broken = p->float_broken;
+  jmp_buf jmp;
+
+  if (!p->vm_main) {
+    p->fallback = &jmp;
+    if (setjmp(jmp) != 0) {
+      p->fallback = 0;
+      p->inlining = inlining;
+      p->float_arrays = float_arrays;
+      p->float_broken = float_broken;
+      p->vm_main = TRUE;
+      mrb_pool_close(scope->mpool);
+      return 0;
+    }
+  }
+  /* toplevel methods can be specialized while typing the main body */
+  push(p->classes, (HIR*)top_class);
+  *main_body = typing(scope, compiled_main_ast(p, ast));
+  p->fallback = 0;
 
   HIR *params = list2(
       new_pvardecl(p, value_type, sym(scope->current_self->cdr)),
       new_pvardecl(p, mrb_state_ptr_type, mrb_intern(p->mrb, "mrb"))
       );
   HIR *main_fun = new_fundecl(p, FALSE, mrb_intern(p->mrb, "compiled_main"),
-      new_func_type(p, void_type, params), params, main_body);
+      new_func_type(p, void_type, params), params, *main_body);
 
   topdecls = cons(main_fun, 0);
 
   top_class->methods = scope->defs;
-  push(p->classes, (HIR*)top_class);
 
   while (p->gvars) {
     HIR *gvar = p->gvars->car;
-    topdecls = cons(new_gvardecl(p, infer_type(p, gvar->lat), sym(gvar->cdr), new_empty(p)),
+    HIR *val = new_empty(p);
+    mrb_value lat = static_const_lat(p, sym(gvar->cdr));
+
+    if (LAT_TYPE(p->mrb, lat) == LAT_CONST)
+      val = new_num_const(p, lat);
+    topdecls = cons(new_gvardecl(p, gvar->lat, sym(gvar->cdr), val),
                     topdecls);
     p->gvars = p->gvars->cdr;
   }
@@ -1730,45 +6868,413 @@ compile(hpc_state *p, node *ast)
   return topdecls;
 }
 
+static HIR*
+compile(hpc_state *p, node *ast)
+{
+  HIR *topdecls, *main_body;
+  int pass;
+
+  collect_const_defs(p, ast);
+  collect_vm_classes(p, ast);
+  for (pass = 1; ; pass++) {
+    p->classes = p->gvars = p->intern_names = 0;
+    p->vm_methods = p->vm_calls = 0;
+    p->ivar_writes = p->fun_writes = 0;
+    p->clone_counter = 0;
+    p->consts_changed = FALSE;
+    topdecls = typing_program(p, ast, &main_body);
+    if (!topdecls || p->consts_changed)
+      continue;
+    if ((p->vm_methods || p->vm_main) && !p->lats_given_up) {
+      /* the VM calls compiled methods with any arguments */
+      p->lats_given_up = TRUE;
+      p->ivar_lats = p->param_lats = 0;
+      continue;
+    }
+    if (p->lats_given_up || !update_assumed_lats(p, main_body, p->ivar_writes)) {
+      optimize_program(p, main_body, scalar_replace);
+      optimize_program(p, main_body, inline_accessors);
+      optimize_program(p, main_body, propagate_ranges);
+      optimize_program(p, main_body, share_exps);
+      optimize_program(p, main_body, build_strings);
+      return topdecls;
+    }
+    if (pass == TYPING_PASSES_MAX) {
+      /* type once more without assumptions */
+      p->lats_given_up = TRUE;
+      p->ivar_lats = p->param_lats = 0;
+    }
+  }
+}
+
+static node*
+ast_cons(parser_state *parser, node *car, node *cdr)
+{
+  node *n = (node *)mrb_pool_alloc(parser->pool, sizeof(node));
+
+  n->car = car;
+  n->cdr = cdr;
+  n->lineno = 0;
+  return n;
+}
+
+static node*
+ast_append(node *list1, node *list2)
+{
+  node *l;
+
+  if (!list1) return list2;
+  for (l = list1; l->cdr; l = l->cdr)
+    ;
+  l->cdr = list2;
+  return list1;
+}
+
+static node*
+ast_push_def(parser_state *parser, node *defs, node *def)
+{
+  node *d = ast_cons(parser, def, 0);
+  node *l;
+
+  d->lineno = def->lineno;
+  if (!defs) return d;
+  for (l = defs; l->cdr; l = l->cdr)
+    ;
+  l->cdr = d;
+  return defs;
+}
+
+/* the ivar or cvar is stored in a field or a C variable by the compiled code */
+static int
+native_var_p(hpc_state *p, mrb_sym name)
+{
+  HIR *classes;
+
+  for (classes = p->classes; classes; classes = classes->cdr) {
+    hpc_class *c = (hpc_class *)classes->car;
+    if (find_var_list(c->ivs, name) || find_var_list(c->cvs, name))
+      return TRUE;
+  }
+  return FALSE;
+}
+
+/*
+  Compile vm_methods to RITE bytecode:
+    (NODE_SCOPE () NODE_BEGIN defs... (NODE_CLASS cpath super (locals NODE_BEGIN defs...))...)
+  Class bodies other than the defs are run by the compiled code.
+
+  If p->vm_main, the top level statements of tree other than the defs
+  and the classes follow as another irep (vm_main_irep), which the
+  compiled main runs at its end.
+ */
+static int
+hpc_vm_program(hpc_state *s, parser_state *parser, node *tree)
+{
+  mrb_state *mrb = s->mrb;
+  node *stmts = 0, *classes = 0, *l;
+  HIR *m;
+  size_t i, j;
+  int start, main_start;
+
+  /* group the methods by class */
+  for (m = s->vm_methods; m; m = m->cdr) {
+    hpc_class *c = (hpc_class *)m->car->car;
+    node *def = (node *)m->car->cdr, *l;
+
+    if (!c->name) {
+      stmts = ast_push_def(parser, stmts, def);
+      continue;
+    }
+    for (l = classes; l; l = l->cdr) {
+      if ((hpc_class *)l->car->car == c)
+        break;
+    }
+    if (!l) {
+      l = ast_cons(parser, ast_cons(parser, (node *)c, 0), classes);
+      classes = l;
+    }
+    l->car->cdr = ast_push_def(parser, l->car->cdr, def);
+  }
+  for (; classes; classes = classes->cdr) {
+    hpc_class *c = (hpc_class *)classes->car->car;
+    node *ast = (node *)c->ast;
+    node *begin = ast_cons(parser, (node *)NODE_BEGIN, classes->car->cdr);
+    node *klass;
+
+    if ((intptr_t)ast->car == NODE_CLASS)
+      klass = ast_cons(parser, ast->car,
+                ast_cons(parser, ast->cdr->car,
+                  ast_cons(parser, ast->cdr->cdr->car,
+                    ast_cons(parser, ast_cons(parser, ast->cdr->cdr->cdr->car->car, begin), 0))));
+    else
+      klass = ast_cons(parser, ast->car,
+                ast_cons(parser, ast->cdr->car,
+                  ast_cons(parser, ast_cons(parser, ast->cdr->cdr->car->car, begin), 0)));
+    klass->lineno = ast->lineno;
+    stmts = ast_push_def(parser, stmts, klass);
+  }
+  parser->tree = ast_cons(parser, (node *)NODE_SCOPE,
+                          ast_cons(parser, 0, ast_cons(parser, (node *)NODE_BEGIN, stmts)));
+
+  start = mrb_generate_code(mrb, parser);
+  if (start < 0) {
+    fprintf(stderr, "hpcmrb error: cannot compile methods left to the VM\n");
+    return -1;
+  }
+  if (s->vm_main) {
+    stmts = 0;
+    for (l = tree->cdr->cdr->cdr; l; l = l->cdr) {
+      if (vm_main_stmt_p(s, l->car))
+        stmts = ast_push_def(parser, stmts, l->car);
+    }
+    parser->tree = ast_cons(parser, (node *)NODE_SCOPE,
+                            ast_cons(parser, tree->cdr->car, ast_cons(parser, (node *)NODE_BEGIN, stmts)));
+    main_start = mrb_generate_code(mrb, parser);
+    if (main_start < 0) {
+      fprintf(stderr, "hpcmrb error: cannot compile the top level statements left to the VM\n");
+      return -1;
+    }
+    s->vm_main_irep = main_start - start;
+  }
+  for (i = start; i < mrb->irep_len; i++) {
+    mrb_irep *irep = mrb->irep[i];
+
+    for (j = 0; j < irep->ilen; j++) {
+      mrb_code c = irep->iseq[j];
+
+      switch (GET_OPCODE(c)) {
+      case OP_GETIV: case OP_SETIV: case OP_GETCV: case OP_SETCV:
+        if (native_var_p(s, irep->syms[GETARG_Bx(c)])) {
+          fprintf(stderr, "hpcmrb error:%s:%d: %s is stored natively and cannot be used by the VM\n",
+                  irep->filename ? irep->filename : "-", irep->lines ? irep->lines[j] : 0,
+                  mrb_sym2name(mrb, irep->syms[GETARG_Bx(c)]));
+          return -1;
+        }
+        break;
+      default:
+        break;
+      }
+    }
+  }
+  return start;
+}
+
+static void
+write_summary_lat(hpc_state *p, FILE *fp, mrb_value lat)
+{
+  mrb_state *mrb = p->mrb;
+  mrb_value *ary;
+  int i, n;
+
+  lat = lat_widen(mrb, lat);
+  switch (LAT_TYPE(mrb, lat)) {
+    case LAT_DYNAMIC:
+      fputs("dynamic", fp);
+      return;
+    case LAT_CONST:
+      fprintf(fp, "=%s", mrb_class_name(mrb, mrb_class_ptr(lat)));
+      return;
+    case LAT_SET:
+      ary = RARRAY_PTR(LAT(lat)->elems);
+      n = RARRAY_LEN(LAT(lat)->elems);
+      for (i = 0; i < n; i++)
+        fprintf(fp, "%s%s", i ? "," : "", mrb_class_name(mrb, mrb_class_ptr(ary[i])));
+      return;
+    default:
+      NOT_REACHABLE();
+  }
+}
+
+/* a lattice a summary can tell; lat_unknown of a method not called dynamically is not */
+static int
+summary_lat_p(hpc_state *p, mrb_value lat)
+{
+  mrb_state *mrb = p->mrb;
+  mrb_value *ary;
+  int i, n;
+
+  if (LAT_HAS_TYPE(mrb, lat, LAT_UNKNOWN))
+    return FALSE;
+  lat = lat_widen(mrb, lat);
+  switch (LAT_TYPE(mrb, lat)) {
+    case LAT_DYNAMIC:
+      return TRUE;
+    case LAT_CONST:
+      return mrb_class_name(mrb, mrb_class_ptr(lat)) != NULL;
+    case LAT_SET:
+      ary = RARRAY_PTR(LAT(lat)->elems);
+      n = RARRAY_LEN(LAT(lat)->elems);
+      for (i = 0; i < n; i++) {
+        if (!mrb_class_name(mrb, mrb_class_ptr(ary[i])))
+          return FALSE;
+      }
+      return n > 0;
+    default:
+      return FALSE;
+  }
+}
+
+static const char*
+summary_class_name(hpc_state *p, mrb_sym class_name)
+{
+  return class_name ? mrb_sym2name(p->mrb, class_name) : "Object";
+}
+
+/* the summary of the file-th program file given to hpc_compile_files */
+void
+hpc_write_summary(hpc_state *p, int file, FILE *fp)
+{
+  HIR *names = p->files, *entries;
+  int i;
+
+  for (i = 0; i < file; i++)
+    names = names->cdr;
+  names = names->car;
+  for (entries = p->param_lats; entries; entries = entries->cdr) {
+    mrb_value *lats = (mrb_value *)entries->car->car->cdr;
+    HIR *key = entries->car->cdr;
+    int sdefp = (intptr_t)key->cdr->car, argc = (intptr_t)key->cdr->cdr;
+
+    if (!hir_member_p(names, key->car->car))
+      continue;
+    for (i = 0; i < argc; i++) {
+      if (!summary_lat_p(p, lats[i]))
+        continue;
+      fprintf(fp, "%s %s %s %d ", profile_kinds[sdefp ? PROFILE_SPARAM : PROFILE_PARAM],
+              summary_class_name(p, sym(key->car->car)), mrb_sym2name(p->mrb, sym(key->car->cdr)), i);
+      write_summary_lat(p, fp, lats[i]);
+      fputs("\n", fp);
+    }
+  }
+  for (entries = p->ivar_lats; entries; entries = entries->cdr) {
+    HIR *entry = entries->car;
+
+    if (!hir_member_p(names, entry->car) || !summary_lat_p(p, entry->lat))
+      continue;
+    fprintf(fp, "%s %s %s ", profile_kinds[PROFILE_IVAR],
+            summary_class_name(p, sym(entry->car)), mrb_sym2name(p->mrb, sym(entry->cdr)));
+    write_summary_lat(p, fp, entry->lat);
+    fputs("\n", fp);
+  }
+}
+
+/* names of the classes (0 for top) the statements of tree define */
+static HIR*
+file_class_names(hpc_state *s, node *tree)
+{
+  HIR *names = 0;
+  node *stmts;
+
+  for (stmts = tree->cdr->cdr->cdr; stmts; stmts = stmts->cdr) {
+    node *stmt = stmts->car;
+    HIR *name;
+
+    switch ((intptr_t)stmt->car) {
+      case NODE_CLASS:
+      case NODE_MODULE:
+        name = hirsym(sym(stmt->cdr->car->cdr));
+        break;
+      case NODE_DEF:
+      case NODE_SDEF:
+        name = hirsym(0);
+        break;
+      default:
+        continue;
+    }
+    if (!hir_member_p(names, name))
+      names = cons_gen(s, name, names);
+  }
+  return names;
+}
+
+static void
+free_parsers(parser_state **parsers, int n)
+{
+  while (n-- > 0)
+    mrb_parser_free(parsers[n]);
+}
+
+/*
+  Compile the program files as one program, as if they were
+  concatenated.  The files share top level local variables like the
+  files of mruby -r.
+ */
 HIR*
-hpc_compile_file(hpc_state *s, FILE *rfp, mrbc_context *c)
+hpc_compile_files(hpc_state *s, FILE **rfps, const char **filenames, int nfiles, mrbc_context *c)
 {
   puts("Compiling...");
 
   mrb_state *mrb = s->mrb;  /* It is necessary for E_SYNTAX_ERROR macro */
-  parser_state *p = mrb_parse_file(s->mrb, rfp, c);
-  HIR *ret;
+  parser_state **parsers = (parser_state **)compiler_palloc(s, sizeof(parser_state*)*nfiles);
+  parser_state *p = 0;
+  node *stmts = 0;
+  HIR *ret, *files = 0;
+  int i;
 
-  if (!p) return 0;
-  if (!p->tree || p->nerr) {
-    if (p->capture_errors) {
-      char buf[256];
-
-      int n = snprintf(buf, sizeof(buf), "line %d: %s\n",
-      p->error_buffer[0].lineno, p->error_buffer[0].message);
-      mrb->exc = mrb_obj_ptr(mrb_exc_new(mrb, E_SYNTAX_ERROR, buf, n));
-      mrb_parser_free(p);
+  for (i = 0; i < nfiles; i++) {
+    c->filename = (char *)filenames[i];
+    p = mrb_parse_file(s->mrb, rfps[i], c);
+    if (!p) {
+      free_parsers(parsers, i);
       return 0;
     }
-    else {
-      static const char msg[] = "syntax error";
-      mrb->exc = mrb_obj_ptr(mrb_exc_new(mrb, E_SYNTAX_ERROR, msg, sizeof(msg) - 1));
-      mrb_parser_free(p);
-      return 0;
+    parsers[i] = p;
+    if (!p->tree || p->nerr) {
+      if (p->capture_errors) {
+        char buf[256];
+
+        int n = snprintf(buf, sizeof(buf), "%s:%d: %s\n", filenames[i],
+        p->error_buffer[0].lineno, p->error_buffer[0].message);
+        mrb->exc = mrb_obj_ptr(mrb_exc_new(mrb, E_SYNTAX_ERROR, buf, n));
+        free_parsers(parsers, i + 1);
+        return 0;
+      }
+      else {
+        static const char msg[] = "syntax error";
+        mrb->exc = mrb_obj_ptr(mrb_exc_new(mrb, E_SYNTAX_ERROR, msg, sizeof(msg) - 1));
+        free_parsers(parsers, i + 1);
+        return 0;
+      }
     }
+    files = append(s, files, cons_gen(s, file_class_names(s, p->tree), 0));
+    /* (NODE_SCOPE locals NODE_BEGIN stmts...) */
+    stmts = ast_append(stmts, p->tree->cdr->cdr->cdr);
   }
+  s->files = files;
+  /* the last locals have those of the files before */
+  p->tree = ast_cons(p, (node *)NODE_SCOPE, ast_cons(p, p->tree->cdr->car,
+                       ast_cons(p, (node *)NODE_BEGIN, stmts)));
 
   ret = compile(s, p->tree);
-  mrb_parser_free(p);
+  if (ret && (s->vm_methods || s->vm_main)) {
+    HIR *calls = 0, *l;
+
+    s->vm_irep = hpc_vm_program(s, p, p->tree);
+    if (s->vm_irep < 0)
+      ret = 0;
+    for (l = s->vm_calls; l; l = l->cdr) {
+      if (vm_method_p(s, sym(l->car->car)))
+        calls = cons_gen(s, l->car, calls);
+    }
+    s->vm_calls = calls;
+  }
+  else {
+    s->vm_calls = 0;
+  }
+  free_parsers(parsers, nfiles);
   return ret;
 }
 
 void
 init_hpc_compiler(hpc_state *p)
 {
+  /* lattices are referred from HIR, which GC does not know */
+  p->mrb->gc_disabled = TRUE;
+
   lat_class = mrb_define_class(p->mrb, "Lattice", p->mrb->object_class);
   lat_unknown = lat_new(p->mrb, LAT_UNKNOWN);
   lat_dynamic = lat_new(p->mrb, LAT_DYNAMIC);
+  lat_pending = lat_new(p->mrb, LAT_UNKNOWN);
   mrb_define_method(p->mrb, lat_class, "inspect", lat_inspect, ARGS_NONE());
 
   void_type   = new_simple_type(p, HTYPE_VOID);
@@ -1,6 +1,15 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <errno.h>
+#if defined(__unix__) || defined(__APPLE__)
+#define HPC_POSIX
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#include <process.h>
+#endif
 #include "mruby.h"
 #include "mruby/compile.h"
 #include "mruby/dump.h"
@@ -8,16 +17,26 @@
 #include "mruby/string.h"
 
 #include "hpcmrb.h"
+#include "hpcmrb_config.h"
 
 #define C_EXT ".c"
+#define UNIT_EXT ".hpcmrb.c"
+#define SUMMARY_EXT ".hpcmrb.summary"
 
 struct _args {
-  FILE *rfp;
+  FILE **rfps;                  /* program files */
+  char **filenames;
+  int nfiles;
   FILE *wfp;
-  char *filename;
+  char *exefile;                /* build an executable if not NULL */
+  char *cfile;
+  const char **cc_opts;         /* -O, -f and -m switches for the C compiler */
+  int ncc_opts;
+  FILE *profile;                /* written by mruby --profile */
   mrb_bool check_syntax : 1;
   mrb_bool verbose      : 1;
   mrb_bool debug_info   : 1;
+  mrb_bool summary      : 1;  /* read and write summaries of the files */
 };
 
 /* Ported from src/print.c */
@@ -64,7 +83,13 @@ usage(const char *name)
   static const char *const usage_msg[] = {
   "switches:",
   "-c           check syntax only",
-  "-o<outfile>  place the output into <outfile>",
+  "-o<outfile>  place the output into <outfile>; an executable unless it ends with .c",
+  "-O<level>    C compiler optimization level for the executable (default -O2)",
+  "-f<flag>     pass -f<flag> (e.g. -flto, -fopenmp) to the C compiler",
+  "-m<option>   pass -m<option> (e.g. -march=native) to the C compiler",
+  "-p<profile>  seed the typing with a profile of mruby --profile=<profile>",
+  "-s           seed the typing of unchanged files with their summaries (.hpcmrb.summary)",
+  "             of the last compilation, and write them",
   "-v           print version number, then turn on verbose mode",
   "-g           produce debugging information",
   "-B<symbol>   binary <symbol> output in C language format",
@@ -75,7 +100,7 @@ usage(const char *name)
   };
   const char *const *p = usage_msg;
 
-  printf("Usage: %s [switches] programfile\n", name);
+  printf("Usage: %s [switches] programfile...\n", name);
   while(*p)
     printf("  %s\n", *p++);
 }
@@ -97,6 +122,31 @@ get_outfilename(mrb_state *mrb, char *infile, char *ext)
   return outfile;
 }
 
+static void
+append_cc_opt(mrb_state *mrb, struct _args *args, const char *opt)
+{
+  args->cc_opts = (const char**)mrb_realloc(mrb, args->cc_opts, sizeof(char*) * (args->ncc_opts + 1));
+  args->cc_opts[args->ncc_opts++] = opt;
+}
+
+static int
+c_file_p(const char *name)
+{
+  size_t len = strlen(name);
+
+  return strcmp(name, "-") == 0 || (len > 2 && strcmp(name + len - 2, C_EXT) == 0);
+}
+
+static void
+add_program_file(mrb_state *mrb, struct _args *args, char *filename, FILE *fp)
+{
+  args->rfps = (FILE**)mrb_realloc(mrb, args->rfps, sizeof(FILE*) * (args->nfiles + 1));
+  args->filenames = (char**)mrb_realloc(mrb, args->filenames, sizeof(char*) * (args->nfiles + 1));
+  args->rfps[args->nfiles] = fp;
+  args->filenames[args->nfiles] = filename;
+  args->nfiles++;
+}
+
 static int
 parse_args(mrb_state *mrb, int argc, char **argv, struct _args *args)
 {
@@ -111,8 +161,9 @@ parse_args(mrb_state *mrb, int argc, char **argv, struct _args *args)
   for (argc--,argv++; argc > 0; argc--,argv++) {
     if (**argv == '-') {
       if (strlen(*argv) == 1) {
-        args->filename = infile = "-";
-        args->rfp = stdin;
+        if (!infile)
+          infile = "-";
+        add_program_file(mrb, args, "-", stdin);
         break;
       }
 
@@ -124,11 +175,41 @@ parse_args(mrb_state *mrb, int argc, char **argv, struct _args *args)
           result = EXIT_FAILURE;
           goto exit;
         }
-        outfile = get_outfilename(mrb, (*argv) + 2, "");
+        if ((*argv)[2] == '\0' && argc > 1) {
+          argc--; argv++;
+          outfile = get_outfilename(mrb, *argv, "");
+        }
+        else {
+          outfile = get_outfilename(mrb, (*argv) + 2, "");
+        }
+        break;
+      case 'O':
+      case 'f':
+      case 'm':
+        append_cc_opt(mrb, args, *argv);
+        break;
+      case 'p':
+        {
+          const char *profile = *argv + 2;
+          if (*profile == '\0' && argc > 1) {
+            argc--; argv++;
+            profile = *argv;
+          }
+          if (args->profile)
+            fclose(args->profile);
+          if ((args->profile = fopen(profile, "r")) == NULL) {
+            printf("%s: Cannot open profile. (%s)\n", *origargv, profile);
+            result = EXIT_FAILURE;
+            goto exit;
+          }
+        }
         break;
       case 'c':
         args->check_syntax = 1;
         break;
+      case 's':
+        args->summary = 1;
+        break;
       case 'v':
         if(!args->verbose) show_version(mrb);
         args->verbose = 1;
@@ -155,12 +236,17 @@ parse_args(mrb_state *mrb, int argc, char **argv, struct _args *args)
         break;
       }
     }
-    else if (args->rfp == NULL) {
-      args->filename = infile = *argv;
-      if ((args->rfp = fopen(infile, "r")) == NULL) {
-        printf("%s: Cannot open program file. (%s)\n", *origargv, infile);
+    else {
+      FILE *fp;
+
+      if ((fp = fopen(*argv, "r")) == NULL) {
+        printf("%s: Cannot open program file. (%s)\n", *origargv, *argv);
+        result = EXIT_FAILURE;
         goto exit;
       }
+      if (!infile)
+        infile = *argv;         /* names the output */
+      add_program_file(mrb, args, *argv, fp);
     }
   }
 
@@ -177,6 +263,13 @@ parse_args(mrb_state *mrb, int argc, char **argv, struct _args *args)
         outfile = get_outfilename(mrb, infile, C_EXT);
       }
     }
+    if (!c_file_p(outfile)) {
+      args->exefile = outfile;
+      args->cfile = get_outfilename(mrb, outfile, "");
+      args->cfile = (char*)mrb_realloc(mrb, args->cfile, strlen(outfile) + strlen(UNIT_EXT) + 1);
+      strcat(args->cfile, UNIT_EXT);
+      outfile = args->cfile;
+    }
     if (strcmp("-", outfile) == 0) {
       args->wfp = stdout;
     }
@@ -188,17 +281,214 @@ parse_args(mrb_state *mrb, int argc, char **argv, struct _args *args)
   }
 
 exit:
-  if (outfile && infile != outfile) mrb_free(mrb, outfile);
+  if (outfile && infile != outfile && outfile != args->cfile) mrb_free(mrb, outfile);
   return result;
 }
 
+/* run argv and wait for it; the exit status, or -1 */
+static int
+run_command(char **argv)
+{
+#if defined(HPC_POSIX)
+  pid_t pid;
+  int status;
+
+  fflush(stdout);
+  pid = fork();
+  if (pid < 0)
+    return -1;
+  if (pid == 0) {
+    execvp(argv[0], argv);
+    perror(argv[0]);
+    _exit(127);
+  }
+  while (waitpid(pid, &status, 0) < 0) {
+    if (errno != EINTR)
+      return -1;
+  }
+  return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+#elif defined(_WIN32)
+  fflush(stdout);
+  return (int)_spawnvp(_P_WAIT, argv[0], (const char * const *)argv);
+#else
+  return -1;
+#endif
+}
+
+/*
+  Compile the generated code into an executable with the toolchain of the
+  mruby build.  The runtime (builtin.c and driver.c) is included into the
+  same translation unit so that the C compiler can inline builtins.
+
+  The compiler is run without a shell, so the paths need no quoting.
+ */
+static int
+build_executable(mrb_state *mrb, struct _args *args)
+{
+  static const char *cc[] = { HPCMRB_CC NULL };
+  static const char *cflags[] = { HPCMRB_CFLAGS NULL };
+  static const char *libs[] = { HPCMRB_LIBS NULL };
+  static const char runtime_dir[] = HPCMRB_RUNTIME_DIR;
+  const char **argv;
+  char *include_lib, *include_dir;
+  int argc = 0, i, status, level = FALSE;
+
+  fputs("\n/* runtime */\n#include \"builtin.c\"\n#include \"driver.c\"\n", args->wfp);
+  fclose(args->wfp);
+  args->wfp = NULL;
+
+  for (i = 0; i < args->ncc_opts; i++) {
+    if (strncmp(args->cc_opts[i], "-O", 2) == 0)
+      level = TRUE;
+  }
+  include_lib = (char*)mrb_malloc(mrb, sizeof(runtime_dir) + 6);
+  include_dir = (char*)mrb_malloc(mrb, sizeof(runtime_dir) + 2);
+  strcpy(include_lib, "-I");
+  strcat(include_lib, runtime_dir);
+  strcat(include_lib, "/lib");
+  strcpy(include_dir, "-I");
+  strcat(include_dir, runtime_dir);
+
+  argv = (const char**)mrb_malloc(mrb, sizeof(char*) * (sizeof(cc)/sizeof(cc[0]) + sizeof(cflags)/sizeof(cflags[0])
+                                                      + sizeof(libs)/sizeof(libs[0]) + args->ncc_opts + 8));
+  for (i = 0; cc[i]; i++)
+    argv[argc++] = cc[i];
+  for (i = 0; cflags[i]; i++)
+    argv[argc++] = cflags[i];
+  argv[argc++] = include_lib;
+  argv[argc++] = include_dir;
+  if (!level)
+    argv[argc++] = "-O2";
+  for (i = 0; i < args->ncc_opts; i++)
+    argv[argc++] = args->cc_opts[i];
+  if (args->debug_info)
+    argv[argc++] = "-g";
+  argv[argc++] = "-o";
+  argv[argc++] = args->exefile;
+  argv[argc++] = args->cfile;
+  for (i = 0; libs[i]; i++)
+    argv[argc++] = libs[i];
+  argv[argc] = NULL;
+
+  if (args->verbose) {
+    for (i = 0; i < argc; i++)
+      printf(i ? " %s" : "%s", argv[i]);
+    putchar('\n');
+  }
+  status = run_command((char**)argv);
+  mrb_free(mrb, argv);
+  mrb_free(mrb, include_lib);
+  mrb_free(mrb, include_dir);
+  if (status != 0) {
+    printf("hpcmrb: C compiler failed. (%s)\n", args->cfile);
+    return EXIT_FAILURE;
+  }
+  if (!args->debug_info)
+    remove(args->cfile);
+  return EXIT_SUCCESS;
+}
+
+/*
+  A summary starts with the FNV-1a hash of the source, so that the
+  summary of a changed file is not read.
+ */
+static unsigned long
+source_hash(FILE *fp)
+{
+  unsigned long hash = 2166136261UL;
+  int ch;
+
+  while ((ch = getc(fp)) != EOF)
+    hash = ((hash ^ (unsigned char)ch) * 16777619UL) & 0xffffffffUL;
+  rewind(fp);
+  return hash;
+}
+
+static char *
+summary_filename(mrb_state *mrb, const char *infile)
+{
+  char *name = (char*)mrb_malloc(mrb, strlen(infile) + strlen(SUMMARY_EXT) + 1);
+
+  strcpy(name, infile);
+  strcat(name, SUMMARY_EXT);
+  return name;
+}
+
+/* read the summaries of the unchanged files */
+static int
+read_summaries(mrb_state *mrb, hpc_state *p, struct _args *args)
+{
+  int i, ok = 1;
+
+  for (i = 0; i < args->nfiles && ok; i++) {
+    char *name;
+    FILE *fp;
+    unsigned long hash;
+
+    if (args->rfps[i] == stdin)
+      continue;
+    name = summary_filename(mrb, args->filenames[i]);
+    if ((fp = fopen(name, "r")) != NULL) {
+      if (fscanf(fp, "source %lx\n", &hash) == 1 && hash == source_hash(args->rfps[i])) {
+        if (args->verbose)
+          printf("reading %s\n", name);
+        ok = hpc_read_summary(p, fp);
+      }
+      fclose(fp);
+    }
+    mrb_free(mrb, name);
+  }
+  return ok;
+}
+
+static void
+write_summaries(mrb_state *mrb, hpc_state *p, struct _args *args)
+{
+  int i;
+
+  for (i = 0; i < args->nfiles; i++) {
+    char *name;
+    FILE *fp;
+
+    if (args->rfps[i] == stdin)
+      continue;
+    name = summary_filename(mrb, args->filenames[i]);
+    if ((fp = fopen(name, "w")) == NULL) {
+      printf("hpcmrb: Cannot write summary. (%s)\n", name);
+    }
+    else {
+      rewind(args->rfps[i]);
+      fprintf(fp, "source %08lx\n", source_hash(args->rfps[i]));
+      hpc_write_summary(p, i, fp);
+      fclose(fp);
+    }
+    mrb_free(mrb, name);
+  }
+}
+
 static void
 cleanup(mrb_state *mrb, struct _args *args)
 {
-  if (args->rfp)
-    fclose(args->rfp);
+  int i;
+
+  for (i = 0; i < args->nfiles; i++) {
+    if (args->rfps[i] != stdin)
+      fclose(args->rfps[i]);
+  }
+  if (args->rfps)
+    mrb_free(mrb, args->rfps);
+  if (args->filenames)
+    mrb_free(mrb, args->filenames);
   if (args->wfp)
     fclose(args->wfp);
+  if (args->profile)
+    fclose(args->profile);
+  if (args->cfile)
+    mrb_free(mrb, args->cfile);
+  if (args->exefile)
+    mrb_free(mrb, args->exefile);
+  if (args->cc_opts)
+    mrb_free(mrb, (void*)args->cc_opts);
   mrb_close(mrb);
 }
 
@@ -222,7 +512,7 @@ main(int argc, char **argv)
   }
 
   n = parse_args(mrb, argc, argv, &args);
-  if (n == EXIT_FAILURE || args.rfp == NULL) {
+  if (n == EXIT_FAILURE || args.nfiles == 0) {
     cleanup(mrb, &args);
     usage(argv[0]);
     return n;
@@ -232,17 +522,26 @@ main(int argc, char **argv)
   if (args.verbose)
     c->dump_result = 1;
   c->no_exec = 1;
-  c->filename = args.filename;
 
   hpc_state *p = hpc_state_new(mrb);
   init_hpc_compiler(p);
   init_prim_interpreters(p);
-  hir = hpc_compile_file(p, args.rfp, c);
+  if (args.profile && !hpc_read_profile(p, args.profile)) {
+    cleanup(mrb, &args);
+    return EXIT_FAILURE;
+  }
+  if (args.summary && !read_summaries(mrb, p, &args)) {
+    cleanup(mrb, &args);
+    return EXIT_FAILURE;
+  }
+  hir = hpc_compile_files(p, args.rfps, (const char**)args.filenames, args.nfiles, c);
 
   if (!hir) {
     cleanup(mrb, &args);
     return EXIT_FAILURE;
   }
+  if (args.summary)
+    write_summaries(mrb, p, &args);
   if (args.check_syntax) {
     puts("Syntax OK");
     cleanup(mrb, &args);
@@ -254,6 +553,12 @@ main(int argc, char **argv)
     return EXIT_FAILURE;
   }
 
+  if (args.exefile) {
+    n = build_executable(mrb, &args);
+    cleanup(mrb, &args);
+    return n;
+  }
+
   puts("Done");
 
   cleanup(mrb, &args);
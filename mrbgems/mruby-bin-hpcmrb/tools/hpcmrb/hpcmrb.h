@@ -18,10 +18,10 @@ extern "C" {
 /* High-level intermediate representation. */
 enum hir_type {
   /* declarations */
-  HIR_GVARDECL,   /* (:HIR_GVARDECL type var value) */
+  HIR_GVARDECL,   /* (:HIR_GVARDECL type var value) static const if value is given */
   HIR_LVARDECL,   /* (:HIR_LVARDECL type var value) */
   HIR_PVARDECL,   /* (:HIR_PVARDECL type var) */
-  HIR_FUNDECL,    /* (:HIR_FUNDECL sdefp type sym (params...) body) */
+  HIR_FUNDECL,    /* (:HIR_FUNDECL sdefp type sym (params...) body [clone_id]) */
 
   HIR_INIT_LIST,  /* (:HIR_INIT_LIST values...) */
 
@@ -30,7 +30,7 @@ enum hir_type {
   HIR_BLOCK,      /* (:HIR_BLOCK (statements...)) */
   HIR_ASSIGN,     /* (:HIR_ASSIGN lhs rhs) */
   HIR_IFELSE,     /* (:HIR_IFELSE cond ifthen ifelse); ifthen and ifelse: stat */
-  HIR_DOALL,      /* (:HIR_DOALL var low high body) */
+  HIR_DOALL,      /* (:HIR_DOALL var low high body); var: HIR_LVAR */
   HIR_WHILE,      /* (:HIR_WHILE cond body) */
   HIR_BREAK,      /* (:HIR_BREAK) */
   HIR_CONTINUE,   /* (:HIR_CONTINUE) */
@@ -48,6 +48,9 @@ enum hir_type {
   HIR_IVAR,       /* (:HIR_IVAR . symbol) */
   HIR_CVAR,       /* (:HIR_CVAR . symbol) */
   HIR_CALL,       /* (:HIR_CALL func args...) */
+  HIR_SCALL,      /* (:HIR_SCALL (class . fundecl) args...) call of a specialized method */
+  HIR_NEW,        /* (:HIR_NEW (class . fundecl) args...) new with a specialized initialize */
+  HIR_FIELD,      /* (:HIR_FIELD (class . ivar) recv) ivar of an instance of the class */
   HIR_COND_OP,    /* (:HIR_COND_OP cond t f) t and f are exp */
 };
 
@@ -95,6 +98,29 @@ typedef struct hpc_state {
   HIR *classes;                 /* list hpc_class */
   HIR *intern_names;            /* name table to declare statically */
   int temp_counter;             /* temp name counter */
+  int clone_counter;            /* id of specialized methods */
+  HIR *ivar_lats;               /* list (class_name . ivar) lattices assumed for ivars */
+  HIR *ivar_writes;             /* list (class . ivar) assigned in the function being typed */
+  HIR *fun_writes;              /* list (fundecl . ivar_writes) */
+  HIR *param_lats;              /* list ((def . mrb_value[]) . ((class_name . name) . (sdefp . argc)))
+                                   of methods called dynamically */
+  int lats_given_up;            /* ivars and params are dynamic */
+  struct hpc_inline *inlining;  /* the innermost method inlined with a block */
+  HIR *float_arrays;            /* arrays of Floats in the kernel being typed */
+  mrb_sym float_counter;        /* counter of the kernel */
+  int float_broken;             /* the kernel may store a non-Float */
+  jmp_buf *fallback;            /* where typing a method gives up, if any */
+  HIR *vm_methods;              /* list (hpc_class . node) left to the VM */
+  HIR *vm_calls;                /* list (mid . argc) of calls to them */
+  int vm_irep;                  /* irep of the vm_methods, or -1 */
+  int vm_main;                  /* the top level statements are left to the VM */
+  int vm_main_irep;             /* irep of them relative to vm_irep, or -1 */
+  HIR *profile;                 /* types observed by mruby --profile */
+  HIR *summary;                 /* lattices of the summaries read */
+  HIR *files;                   /* list of names of the classes defined in each file */
+  HIR *const_defs;              /* list (node . name) constants assigned once */
+  HIR *vm_classes;              /* names of the classes left to the VM */
+  int consts_changed;           /* a constant read in the pass is not static */
   short line;
   jmp_buf jmp;
 } hpc_state;
@@ -106,15 +132,46 @@ typedef struct hpc_class {
   HIR *ivs;                     /* list symbol */
   HIR *cvs;                     /* list symbol */
   HIR *methods;                 /* list HIR_method_def */
+  HIR *method_defs;             /* list (node . sdefp) to specialize at call-sites */
+  HIR *clones;                  /* list hpc_clone */
+  HIR *speculations;            /* list hpc_clone called if args pass guards */
+  void *ast;                    /* node of the class or module definition */
+  int modulep;                  /* defined by module; the ast is freed before codegen */
 } hpc_class;
 
+/* A method typed for the lattices of self and arguments at call-sites */
+typedef struct hpc_clone {
+  void *def;                    /* node of the method definition */
+  int argc;
+  mrb_value self_lat;
+  mrb_value *param_lats;
+  mrb_value ret_lat;
+  HIR *fundecl;                 /* 0 while typing the body */
+} hpc_clone;
+
 void init_hpc_compiler(hpc_state *p);
 void init_prim_interpreters(hpc_state *p);
 struct RProc *get_interp(struct RProc *p);
 hpc_state* hpc_state_new(mrb_state *mrb);
-HIR *hpc_compile_file(hpc_state*, FILE*, mrbc_context*);
+HIR *hpc_compile_files(hpc_state*, FILE**, const char**, int, mrbc_context*);
+int hpc_read_profile(hpc_state*, FILE*);
+int hpc_read_summary(hpc_state*, FILE*);
+void hpc_write_summary(hpc_state*, int, FILE*);
 mrb_value hpc_generate_code(hpc_state*, FILE*, HIR*, mrbc_context*);
 
+/* lattice queries (compile.c) */
+enum hir_type_kind hpc_lat_kind(mrb_state *mrb, mrb_value lat);
+int hpc_lat_numeric_p(mrb_state *mrb, mrb_value lat);
+int hpc_lat_const_p(mrb_state *mrb, mrb_value lat);
+struct RClass *hpc_lat_class_of(mrb_state *mrb, mrb_value lat);
+mrb_value hpc_lat_set_of(mrb_state *mrb, mrb_value val);
+int hpc_lat_immediate_p(mrb_state *mrb, mrb_value lat);
+mrb_value hpc_lat_dynamic(void);
+
+/* HIR queries (compile.c) */
+int hpc_assigned_p(HIR *hir, mrb_sym var);
+int hpc_calls_p(HIR *hir, mrb_sym mid);
+
 HIR* cons_gen(hpc_state *p, HIR *car, HIR *cdr);
 #define cons(a,b) cons_gen(p, (a), (b))
 #define list1(a)          cons((a), 0)
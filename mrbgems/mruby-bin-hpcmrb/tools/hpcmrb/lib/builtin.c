@@ -6,7 +6,15 @@
 #include <limits.h> /* CHAR_BIT macro */
 #include <string.h> /* memcpy */
 #include <math.h>
+#include <signal.h>
 #include <stdlib.h>
+#if defined(__unix__) || defined(__APPLE__)
+#define HPC_POSIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#include "builtin.h"
 
 #define TYPES2(a,b) ((((uint16_t)(a))<<8)|(((uint16_t)(b))&0xff))
 
@@ -20,15 +28,10 @@ num_add_1(int val, mrb_value a, mrb_value b)
   switch (TYPES2(mrb_type(a), mrb_type(b))) {
   case TYPES2(MRB_TT_FIXNUM,MRB_TT_FIXNUM):
     {
-      mrb_int x, y, z;
+      mrb_int x, y;
       x = mrb_fixnum(a);
       y = mrb_fixnum(b);
-      z = x + y;
-      if ((x < 0) != (z < 0) && ((x < 0) ^ (y < 0)) == 0) {
-        /* integer overflow */
-        return mrb_float_value((mrb_float)x + (mrb_float)y);
-      }
-      return mrb_fixnum_value(z);
+      return hpc_int_add(x, y);
     }
   case TYPES2(MRB_TT_FIXNUM,MRB_TT_FLOAT):
     return mrb_float_value((mrb_float)mrb_fixnum(a) + mrb_float(b));
@@ -49,15 +52,10 @@ num_addi_1(int val, mrb_value a, mrb_int b)
   switch (mrb_type(a)) {
   case MRB_TT_FIXNUM:
     {
-      mrb_int x, y, z;
+      mrb_int x, y;
       x = mrb_fixnum(a);
       y = b;
-      z = x + y;
-      if ((x < 0) != (z < 0) && ((x < 0) ^ (y < 0)) == 0) {
-        /* integer overflow */
-        return mrb_float_value((mrb_float)x + (mrb_float)y);
-      }
-      return mrb_fixnum_value(z);
+      return hpc_int_add(x, y);
     }
   case MRB_TT_FLOAT:
     return mrb_float_value(mrb_float(a) + (mrb_float)b);
@@ -72,15 +70,10 @@ num_sub_1(int val, mrb_value a, mrb_value b)
   switch (TYPES2(mrb_type(a), mrb_type(b))) {
   case TYPES2(MRB_TT_FIXNUM,MRB_TT_FIXNUM):
     {
-      mrb_int x, y, z;
+      mrb_int x, y;
       x = mrb_fixnum(a);
       y = mrb_fixnum(b);
-      z = x - y;
-      if (((x < 0) ^ (y < 0)) != 0 && (x < 0) != (z < 0)) {
-        /* integer overflow */
-        return mrb_float_value((mrb_float)x - (mrb_float)y);
-      }
-      return mrb_fixnum_value(z);
+      return hpc_int_sub(x, y);
     }
   case TYPES2(MRB_TT_FIXNUM,MRB_TT_FLOAT):
     return mrb_float_value((mrb_float)mrb_fixnum(a) - mrb_float(b));
@@ -99,15 +92,10 @@ num_subi_1(int val, mrb_value a, mrb_int b)
   switch (mrb_type(a)) {
   case MRB_TT_FIXNUM:
     {
-      mrb_int x, y, z;
+      mrb_int x, y;
       x = mrb_fixnum(a);
       y = b;
-      z = x - y;
-      if (((x < 0) ^ (y < 0)) != 0 && (x < 0) != (z < 0)) {
-        /* integer overflow */
-        return mrb_float_value((mrb_float)x - (mrb_float)y);
-      }
-      return mrb_fixnum_value(z);
+      return hpc_int_sub(x, y);
     }
   case MRB_TT_FLOAT:
     return mrb_float_value(mrb_float(a) - (mrb_float)b);
@@ -122,15 +110,10 @@ num_mul_1(int val, mrb_value a, mrb_value b)
   switch (TYPES2(mrb_type(a), mrb_type(b))) {
   case TYPES2(MRB_TT_FIXNUM,MRB_TT_FIXNUM):
     {
-      mrb_int x, y, z;
+      mrb_int x, y;
       x = mrb_fixnum(a);
       y = mrb_fixnum(b);
-      z = x * y;
-      if (x != 0 && z/x != y) {
-        /* integer overflow */
-        return mrb_float_value((mrb_float)x * (mrb_float)y);
-      }
-      return mrb_fixnum_value(z);
+      return hpc_int_mul(x, y);
     }
   case TYPES2(MRB_TT_FIXNUM,MRB_TT_FLOAT):
     return mrb_float_value((mrb_float)mrb_fixnum(a) * mrb_float(b));
@@ -177,16 +160,31 @@ num_xor_1(int val, mrb_value a, mrb_value b)
   BINOP(^)
 }
 
+void
+hpc_shift_width_error(mrb_int width)
+{
+  mrb_raisef(mrb, E_RANGE_ERROR, "width(%S) > (%S:sizeof(mrb_int)*CHAR_BIT-1)",
+             mrb_fixnum_value(width), mrb_fixnum_value(HPC_SHIFT_WIDTH_MAX));
+}
+
 mrb_value
 num_lshift_1(int val, mrb_value a, mrb_value b)
 {
-  BINOP(<<)
+  if (mrb_string_p(a)) {
+    mrb_str_concat(mrb, a, b);
+    return a;
+  }
+  if (!mrb_fixnum_p(a) || !mrb_fixnum_p(b))
+    return mrb_funcall(mrb, a, "<<", 1, b);
+  return mrb_fixnum_value(hpc_lshift_int(mrb_fixnum(a), mrb_fixnum(b)));
 }
 
 mrb_value
 num_rshift_1(int val, mrb_value a, mrb_value b)
 {
-  BINOP(>>)
+  if (!mrb_fixnum_p(a) || !mrb_fixnum_p(b))
+    return mrb_funcall(mrb, a, ">>", 1, b);
+  return mrb_fixnum_value(hpc_rshift_int(mrb_fixnum(a), mrb_fixnum(b)));
 }
 
 mrb_value
@@ -198,7 +196,17 @@ num_and_1(int val, mrb_value a, mrb_value b)
 mrb_value
 num_mod_1(int val, mrb_value a, mrb_value b)
 {
-  BINOP(%)
+  switch (TYPES2(mrb_type(a), mrb_type(b))) {
+  case TYPES2(MRB_TT_FIXNUM,MRB_TT_FIXNUM):
+    return hpc_int_mod(mrb_fixnum(a), mrb_fixnum(b));
+  case TYPES2(MRB_TT_FIXNUM,MRB_TT_FLOAT):
+  case TYPES2(MRB_TT_FLOAT,MRB_TT_FIXNUM):
+  case TYPES2(MRB_TT_FLOAT,MRB_TT_FLOAT):
+    return mrb_float_value(hpc_mod_float(hpc_to_float(a), hpc_to_float(b)));
+  default:
+    /* e.g. String#% */
+    return mrb_funcall(mrb, a, "%", 1, b);
+  }
 }
 
 #define OP_CMP_BODY(op,v1,v2) do {\
@@ -280,17 +288,11 @@ hpc_str_plus(mrb_value a, mrb_value b)
   return v;
 }
 
-/* almost copied from numeric.c(mrb_fixnum_to_str) */
-mrb_value
-hpc_fixnum_to_str(int val, mrb_value x, int base)
+/* the digits of v at the end of a buffer, returns the first digit */
+static char*
+fixnum_digits(char *end, mrb_int v, int base)
 {
-  char buf[sizeof(mrb_int)*CHAR_BIT+1];
-  char *b = buf + sizeof buf;
-  mrb_int v = mrb_fixnum(x);
-
-  if (base < 2 || 36 < base) {
-    mrb_raisef(mrb, E_ARGUMENT_ERROR, "invid radix %S", mrb_fixnum_value(base));
-  }
+  char *b = end;
 
   if (v == 0) {
     *--b = '0';
@@ -304,37 +306,268 @@ hpc_fixnum_to_str(int val, mrb_value x, int base)
       *--b = mrb_digitmap[(int)(v % base)];
     } while (v /= base);
   }
+  return b;
+}
 
+/* almost copied from numeric.c(mrb_fixnum_to_str) */
+mrb_value
+hpc_fixnum_to_str(int val, mrb_value x, int base)
+{
+  char buf[sizeof(mrb_int)*CHAR_BIT+1];
+  char *b;
+
+  if (base < 2 || 36 < base) {
+    mrb_raisef(mrb, E_ARGUMENT_ERROR, "invid radix %S", mrb_fixnum_value(base));
+  }
+  b = fixnum_digits(buf + sizeof buf, mrb_fixnum(x), base);
   return mrb_str_new(mrb, b, buf + sizeof(buf) - b);
 }
 
+/* almost copied from mruby-numeric-ext(mrb_int_chr) */
+static char
+fixnum_chr(mrb_int c)
+{
+  if (c >= (1 << CHAR_BIT)) {
+    mrb_raisef(mrb, E_RANGE_ERROR, "%S out of char range", mrb_fixnum_value(c));
+  }
+  return (char)c;
+}
+
+/*
+  Pieces of Strings (see build_strings in compile.c)
+    hpc_str_cat_*: appended to a String
+    hpc_output_*: written by print and puts
+ */
+void
+hpc_str_cat_int(mrb_value s, mrb_int n)
+{
+  char buf[sizeof(mrb_int)*CHAR_BIT+1];
+  char *b = fixnum_digits(buf + sizeof buf, n, 10);
+
+  mrb_str_cat(mrb, s, b, buf + sizeof(buf) - b);
+}
+
+void
+hpc_str_cat_chr(mrb_value s, mrb_int c)
+{
+  char b = fixnum_chr(c);
+
+  mrb_str_cat(mrb, s, &b, 1);
+}
+
+/*
+  Output of print/puts.
+
+  Pieces are collected in hpc_out_buf and written to stdout when it is
+  full, or at once if stdout is a terminal.  Kernel#__printstr__, which
+  print, puts and p of the VM call, writes into the same buffer, so the
+  order is kept.
+
+  If HPCMRB_OUTPUT names a file, the output goes into a shared memory
+  mapping of that file instead, which grows by doubling.
+ */
+#define HPC_OUTPUT_BUFSIZ (1 << 16)
+#define HPC_MAP_INITIAL (1 << 20)
+
+static char hpc_out_buf[HPC_OUTPUT_BUFSIZ];
+static size_t hpc_out_len;
+static int hpc_out_tty;
+static char *hpc_map;           /* mapped output file, or NULL */
+static size_t hpc_map_len, hpc_map_cap;
+static int hpc_map_fd = -1;
+
+static int
+hpc_map_reserve(size_t len)
+{
+#ifdef HPC_POSIX
+  size_t cap = hpc_map_cap;
+
+  if (hpc_map_len + len <= cap)
+    return TRUE;
+  while (cap < hpc_map_len + len)
+    cap *= 2;
+  munmap(hpc_map, hpc_map_cap);
+  if (ftruncate(hpc_map_fd, cap) != 0) {
+    hpc_map = NULL;
+    return FALSE;
+  }
+  hpc_map = mmap(NULL, cap, PROT_READ | PROT_WRITE, MAP_SHARED, hpc_map_fd, 0);
+  if (hpc_map == MAP_FAILED) {
+    hpc_map = NULL;
+    return FALSE;
+  }
+  hpc_map_cap = cap;
+  return TRUE;
+#else
+  return FALSE;
+#endif
+}
+
+static void
+hpc_out_write(const char *s, size_t len)
+{
+#ifdef HPC_POSIX
+  while (len > 0) {
+    ssize_t n = write(STDOUT_FILENO, s, len);
+    if (n < 0)
+      return;
+    s += n;
+    len -= n;
+  }
+#else
+  fwrite(s, 1, len, stdout);
+  fflush(stdout);
+#endif
+}
+
+static void
+hpc_out_flush(void)
+{
+  hpc_out_write(hpc_out_buf, hpc_out_len);
+  hpc_out_len = 0;
+}
+
+#ifdef HPC_POSIX
+/*
+  abort, e.g. mrb_exc_raise without a jmp_buf, would lose the buffered
+  output.  Only async-signal-safe calls are made here.
+ */
+static void
+hpc_output_abort(int sig)
+{
+  if (hpc_map)
+    (void)ftruncate(hpc_map_fd, hpc_map_len);
+  else
+    hpc_out_write(hpc_out_buf, hpc_out_len);
+  signal(sig, SIG_DFL);
+  raise(sig);
+}
+#endif
+
+static mrb_value
+hpc_printstr(mrb_state *mrb, mrb_value self)
+{
+  mrb_value s;
+
+  mrb_get_args(mrb, "o", &s);
+  if (mrb_string_p(s))
+    hpc_output_write(RSTRING_PTR(s), RSTRING_LEN(s));
+  return s;
+}
+
+void
+hpc_output_open(void)
+{
+  const char *path = getenv("HPCMRB_OUTPUT");
+
+  mrb_define_method(mrb, mrb->kernel_module, "__printstr__", hpc_printstr, ARGS_REQ(1));
+  atexit(hpc_output_close);     /* also when the program calls exit */
+#ifdef HPC_POSIX
+  signal(SIGABRT, hpc_output_abort);
+#endif
+  if (!path || !*path) {
+#ifdef HPC_POSIX
+    hpc_out_tty = isatty(STDOUT_FILENO);
+#endif
+    return;
+  }
+#ifdef HPC_POSIX
+  hpc_map_fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0666);
+  if (hpc_map_fd < 0 || ftruncate(hpc_map_fd, HPC_MAP_INITIAL) != 0) {
+    perror(path);
+    exit(EXIT_FAILURE);
+  }
+  hpc_map = mmap(NULL, HPC_MAP_INITIAL, PROT_READ | PROT_WRITE, MAP_SHARED, hpc_map_fd, 0);
+  if (hpc_map == MAP_FAILED) {
+    perror(path);
+    exit(EXIT_FAILURE);
+  }
+  hpc_map_cap = HPC_MAP_INITIAL;
+#else
+  if (!freopen(path, "wb", stdout)) {
+    perror(path);
+    exit(EXIT_FAILURE);
+  }
+#endif
+}
+
+void
+hpc_output_write(const char *s, size_t len)
+{
+  if (hpc_map) {
+    if (hpc_map_reserve(len)) {
+      memcpy(hpc_map + hpc_map_len, s, len);
+      hpc_map_len += len;
+      return;
+    }
+    perror("HPCMRB_OUTPUT");
+    exit(EXIT_FAILURE);
+  }
+  if (hpc_out_len + len > sizeof(hpc_out_buf))
+    hpc_out_flush();
+  if (len > sizeof(hpc_out_buf) || hpc_out_tty) {
+    hpc_out_write(s, len);
+    return;
+  }
+  memcpy(hpc_out_buf + hpc_out_len, s, len);
+  hpc_out_len += len;
+}
+
+void
+hpc_output_close(void)
+{
+#ifdef HPC_POSIX
+  if (hpc_map) {
+    munmap(hpc_map, hpc_map_cap);
+    if (ftruncate(hpc_map_fd, hpc_map_len) != 0)
+      perror("HPCMRB_OUTPUT");
+    close(hpc_map_fd);
+    hpc_map = NULL;
+  }
+#endif
+  hpc_out_flush();
+}
+
+void
+hpc_output_int(mrb_int n)
+{
+  char buf[sizeof(mrb_int)*CHAR_BIT+1];
+  char *b = fixnum_digits(buf + sizeof buf, n, 10);
+
+  hpc_output_write(b, buf + sizeof(buf) - b);
+}
+
+void
+hpc_output_chr(mrb_int c)
+{
+  char b = fixnum_chr(c);
+
+  hpc_output_write(&b, 1);
+}
+
+void
+hpc_output_str(mrb_value s)
+{
+  hpc_output_write(RSTRING_PTR(s), RSTRING_LEN(s));
+}
+
 /* value n's type is expected to be <string> or <fixnum> */
 mrb_value
 puts_1(int val, mrb_value __self__, mrb_value n)
 {
-  mrb_value str = mrb_funcall(mrb, n, "to_s", 0);
-  const char *cstr = mrb_str_to_cstr(mrb, str);
-  puts(cstr);
+  if (!mrb_string_p(n))
+    n = mrb_funcall(mrb, n, "to_s", 0);
+  hpc_output_write(RSTRING_PTR(n), RSTRING_LEN(n));
+  hpc_output_write("\n", 1);
   return mrb_nil_value();
 }
 
-
-extern FILE *debug_fp;
 mrb_value
 print_1(int val, mrb_value __self__, mrb_value n)
 {
   if (!mrb_string_p(n))
     n = mrb_funcall(mrb, n, "to_s", 0);
-  const char *cstr = RSTRING_PTR(n);
-  size_t i, len = RSTRING_LEN(n);
-  for (i = 0; i < len; ++i) {
-    if (debug_fp) {
-      putc(cstr[i], debug_fp);
-      fflush(debug_fp);
-    } else {
-      putchar(cstr[i]);
-    }
-  }
+  hpc_output_write(RSTRING_PTR(n), RSTRING_LEN(n));
   return mrb_nil_value();
 }
 
@@ -347,6 +580,8 @@ bob_not_0(int val, mrb_value __self__)
 mrb_value
 hpc_ary_aget_1(int val, mrb_value __self__, mrb_value index)
 {
+  if (mrb_type(__self__) != MRB_TT_ARRAY)
+    return mrb_funcall(mrb, __self__, "[]", 1, index);
   if(mrb_type(index) == MRB_TT_FIXNUM){
     return mrb_ary_ref(mrb, __self__, mrb_fixnum(index));
   }
@@ -360,6 +595,10 @@ hpc_ary_aset_2(int val, mrb_value __self__, mrb_value index, mrb_value value)
   int ai;
   if (!val)
     ai = mrb_gc_arena_save(mrb);
+  if (mrb_type(__self__) != MRB_TT_ARRAY) {
+    mrb_funcall(mrb, __self__, "[]=", 2, index, value);
+    goto end;
+  }
   if(mrb_type(index) == MRB_TT_FIXNUM){
     mrb_ary_set(mrb, __self__, mrb_fixnum(index), value);
     goto end;
@@ -373,6 +612,117 @@ hpc_ary_aset_2(int val, mrb_value __self__, mrb_value index, mrb_value value)
   return value;
 }
 
+/* an empty array with the capacity for the elements of __self__ (map) */
+mrb_value
+hpc_ary_new_0(int val, mrb_value __self__)
+{
+  return mrb_ary_new_capa(mrb, RARRAY_LEN(__self__));
+}
+
+/*
+  The elements of ary in [first, last) can be written by threads: ary
+  is not extended, nor shared, nor black (write barriers do nothing).
+ */
+int
+hpc_ary_writable(mrb_value ary, mrb_int first, mrb_int last)
+{
+  if (mrb_type(ary) != MRB_TT_ARRAY || first < 0 || RARRAY_LEN(ary) < last)
+    return FALSE;
+  /* mrb_ary_set copies the elements of a shared ary and grays it */
+  if (first < last)
+    mrb_ary_set(mrb, ary, first, RARRAY_PTR(ary)[first]);
+  return !(mrb_ary_ptr(ary)->flags & MRB_ARY_SHARED);
+}
+
+/*
+  The elements of ary in [first, last) are Floats, which compiled code
+  reads and writes in place (see NATIVE_AREF in codegen.c)
+ */
+mrb_value
+hpc_ary_float_p_2(int val, mrb_value ary, mrb_value first, mrb_value last)
+{
+  mrb_int i, lo = mrb_fixnum(first), hi = mrb_fixnum(last);
+  mrb_value *ptr;
+
+  if (!hpc_ary_writable(ary, lo, hi))
+    return mrb_false_value();
+  ptr = RARRAY_PTR(ary);
+  for (i = lo; i < hi; i++) {
+    if (!mrb_float_p(ptr[i]))
+      return mrb_false_value();
+  }
+  return mrb_true_value();
+}
+
+/* the elements of ary in [first, last) can be written in place */
+mrb_value
+hpc_ary_inplace_p_2(int val, mrb_value ary, mrb_value first, mrb_value last)
+{
+  return mrb_bool_value(hpc_ary_writable(ary, mrb_fixnum(first), mrb_fixnum(last)));
+}
+
+mrb_value
+hpc_numary_len_0(int val, mrb_value __self__)
+{
+  return mrb_fixnum_value(NUMARY_LEN(__self__));
+}
+
+/* elements out of FloatArray or IntArray: negative indexes or errors */
+mrb_value
+hpc_numary_aref(mrb_value ary, mrb_int i)
+{
+  return mrb_funcall(mrb, ary, "[]", 1, mrb_fixnum_value(i));
+}
+
+void
+hpc_numary_aset(mrb_value ary, mrb_int i, mrb_value v)
+{
+  mrb_funcall(mrb, ary, "[]=", 2, mrb_fixnum_value(i), v);
+}
+
+/* bulk operations of FloatArray and IntArray */
+mrb_value
+hpc_numary_sum_0(int val, mrb_value __self__)
+{
+  return mrb_funcall(mrb, __self__, "sum", 0);
+}
+
+mrb_value
+hpc_numary_dot_1(int val, mrb_value __self__, mrb_value other)
+{
+  return mrb_funcall(mrb, __self__, "dot", 1, other);
+}
+
+mrb_value
+hpc_numary_axpy_2(int val, mrb_value __self__, mrb_value a, mrb_value x)
+{
+  return mrb_funcall(mrb, __self__, "axpy", 2, a, x);
+}
+
+/*
+  yield in a method compiled without a block.  The wrapper registered
+  to the VM leaves the block given by the VM in hpc_vm_block, which the
+  method takes at its entry; the compiled callers leave it nil.
+ */
+mrb_value hpc_vm_block;         /* nil while zero */
+
+mrb_value
+hpc_take_block(void)
+{
+  mrb_value blk = hpc_vm_block;
+
+  hpc_vm_block = mrb_nil_value();
+  return blk;
+}
+
+mrb_value
+hpc_yield(mrb_value blk, int argc, mrb_value *argv)
+{
+  if (mrb_nil_p(blk))
+    mrb_raise(mrb, E_LOCALJUMP_ERROR, "no block given");
+  return mrb_yield_argv(mrb, blk, argc, argv);
+}
+
 #define EVAL_FLOAT(num, exp) do {               \
   mrb_float f;                                  \
   switch (mrb_type(num)) {                      \
@@ -1,4 +1,12 @@
+#ifndef HPCMRB_BUILTIN_H
+#define HPCMRB_BUILTIN_H
+
 #include "mruby.h"
+#include "mruby/array.h"
+#include "mruby/numeric_array.h"
+#include "mruby/string.h"
+#include <limits.h>
+#include <math.h>
 
 mrb_value num_add_1(int val, mrb_value, mrb_value);
 
@@ -28,11 +36,32 @@ mrb_value num_gt_1(int val, mrb_value, mrb_value);
 
 mrb_value num_ge_1(int val, mrb_value, mrb_value);
 
+void hpc_output_open(void);
+void hpc_output_write(const char *s, size_t len);
+void hpc_output_close(void);
+void hpc_output_int(mrb_int n);
+void hpc_output_chr(mrb_int c);
+void hpc_output_str(mrb_value s);
+void hpc_str_cat_int(mrb_value s, mrb_int n);
+void hpc_str_cat_chr(mrb_value s, mrb_int c);
 mrb_value puts_1(int val, mrb_value __self__, mrb_value n);
 mrb_value print_1(int val, mrb_value __self__, mrb_value n);
 
 mrb_value hpc_ary_aget_1(int val, mrb_value __self__, mrb_value index);
 mrb_value hpc_ary_aset_2(int val, mrb_value __self__, mrb_value index, mrb_value value);
+mrb_value hpc_ary_new_0(int val, mrb_value __self__);
+extern mrb_value hpc_vm_block;
+mrb_value hpc_take_block(void);
+mrb_value hpc_yield(mrb_value blk, int argc, mrb_value *argv);
+int hpc_ary_writable(mrb_value ary, mrb_int first, mrb_int last);
+mrb_value hpc_ary_inplace_p_2(int val, mrb_value ary, mrb_value first, mrb_value last);
+mrb_value hpc_ary_float_p_2(int val, mrb_value ary, mrb_value first, mrb_value last);
+mrb_value hpc_numary_len_0(int val, mrb_value __self__);
+mrb_value hpc_numary_aref(mrb_value ary, mrb_int i);
+void hpc_numary_aset(mrb_value ary, mrb_int i, mrb_value v);
+mrb_value hpc_numary_sum_0(int val, mrb_value __self__);
+mrb_value hpc_numary_dot_1(int val, mrb_value __self__, mrb_value);
+mrb_value hpc_numary_axpy_2(int val, mrb_value __self__, mrb_value, mrb_value);
 
 mrb_value sqrt_1(int val, mrb_value __self__, mrb_value);
 mrb_value num_uminus_0(int val, mrb_value __self__);
@@ -43,3 +72,259 @@ mrb_value cos_1(int val, mrb_value __self__, mrb_value);
 mrb_value sin_1(int val, mrb_value __self__, mrb_value);
 mrb_value to_s_0(int val, mrb_value __self__);
 mrb_value bob_not_0(int val, mrb_value __self__);
+
+/* operators on unboxed numbers */
+
+static inline mrb_float
+hpc_to_float(mrb_value v)
+{
+  if (mrb_fixnum_p(v))
+    return (mrb_float)mrb_fixnum(v);
+  return mrb_float(v);
+}
+
+/*
+  Fixnum + - * overflowing into Float as the VM does (see NATIVE_CHECKED
+  in codegen.c).  The builtins of GCC 5 and clang test the flag of the
+  instruction instead of comparing signs or dividing.
+ */
+#if defined(__GNUC__) && __GNUC__ >= 5
+# define HPC_OVERFLOW_BUILTINS
+#elif defined(__has_builtin)
+# if __has_builtin(__builtin_add_overflow)
+#  define HPC_OVERFLOW_BUILTINS
+# endif
+#endif
+
+static inline int
+hpc_add_overflow(mrb_int x, mrb_int y, mrb_int *z)
+{
+#ifdef HPC_OVERFLOW_BUILTINS
+  return __builtin_add_overflow(x, y, z);
+#else
+  *z = (mrb_int)((unsigned long long)x + (unsigned long long)y);
+  return (x < 0) != (*z < 0) && ((x < 0) ^ (y < 0)) == 0;
+#endif
+}
+
+static inline int
+hpc_sub_overflow(mrb_int x, mrb_int y, mrb_int *z)
+{
+#ifdef HPC_OVERFLOW_BUILTINS
+  return __builtin_sub_overflow(x, y, z);
+#else
+  *z = (mrb_int)((unsigned long long)x - (unsigned long long)y);
+  return ((x < 0) ^ (y < 0)) != 0 && (x < 0) != (*z < 0);
+#endif
+}
+
+static inline int
+hpc_mul_overflow(mrb_int x, mrb_int y, mrb_int *z)
+{
+#ifdef HPC_OVERFLOW_BUILTINS
+  return __builtin_mul_overflow(x, y, z);
+#else
+  *z = (mrb_int)((unsigned long long)x * (unsigned long long)y);
+  return x != 0 && *z/x != y;
+#endif
+}
+
+static inline mrb_value
+hpc_int_add(mrb_int x, mrb_int y)
+{
+  mrb_int z;
+  if (hpc_add_overflow(x, y, &z))
+    return mrb_float_value((mrb_float)x + (mrb_float)y);
+  return mrb_fixnum_value(z);
+}
+
+static inline mrb_value
+hpc_int_sub(mrb_int x, mrb_int y)
+{
+  mrb_int z;
+  if (hpc_sub_overflow(x, y, &z))
+    return mrb_float_value((mrb_float)x - (mrb_float)y);
+  return mrb_fixnum_value(z);
+}
+
+static inline mrb_value
+hpc_int_mul(mrb_int x, mrb_int y)
+{
+  mrb_int z;
+  if (hpc_mul_overflow(x, y, &z))
+    return mrb_float_value((mrb_float)x * (mrb_float)y);
+  return mrb_fixnum_value(z);
+}
+
+/*
+  Ruby's modulo takes the sign of the divisor.  y is not 0 (see
+  hpc_int_mod); x % -1 traps on MRB_INT_MIN in C.
+ */
+static inline mrb_int
+hpc_mod_int(mrb_int x, mrb_int y)
+{
+  mrb_int m;
+  if (y == -1)
+    return 0;
+  m = x % y;
+  if (m != 0 && (m < 0) != (y < 0))
+    m += y;
+  return m;
+}
+
+/* Fixnum#% as the VM: modulo by 0 is NaN */
+static inline mrb_value
+hpc_int_mod(mrb_int x, mrb_int y)
+{
+  if (y == 0)
+    return mrb_float_value(NAN);
+  return mrb_fixnum_value(hpc_mod_int(x, y));
+}
+
+static inline mrb_float
+hpc_mod_float(mrb_float x, mrb_float y)
+{
+  mrb_float m = fmod(x, y);
+  if (y*m < 0)
+    m += y;
+  return m;
+}
+
+/*
+  Fixnum#<< and #>> as the VM: shifting left beyond mrb_int raises
+  RangeError (see hpc_shift_width_error), right gives 0 or -1.
+ */
+#define HPC_SHIFT_WIDTH_MAX ((mrb_int)(sizeof(mrb_int)*CHAR_BIT-1))
+
+void hpc_shift_width_error(mrb_int width);
+
+static inline mrb_int
+hpc_lshift_int(mrb_int x, mrb_int width)
+{
+  if (width < 0) {
+    if (-width >= HPC_SHIFT_WIDTH_MAX)
+      return x < 0 ? -1 : 0;
+    return x >> -width;
+  }
+  if (width > HPC_SHIFT_WIDTH_MAX)
+    hpc_shift_width_error(width);
+  return (mrb_int)((unsigned long long)x << width);
+}
+
+static inline mrb_int
+hpc_rshift_int(mrb_int x, mrb_int width)
+{
+  if (width <= 0)
+    return hpc_lshift_int(x, -width);
+  if (width >= HPC_SHIFT_WIDTH_MAX)
+    return x < 0 ? -1 : 0;
+  return x >> width;
+}
+
+/*
+  Elements of Arrays at native indexes (see propagate_ranges)
+    hpc_ary_uref: 0 <= i < a.length is known
+    hpc_ary_vref: checked, out of the Array goes to the method
+ */
+
+static inline mrb_value
+hpc_ary_len_0(int val, mrb_value __self__)
+{
+  return mrb_fixnum_value(RARRAY_LEN(__self__));
+}
+
+static inline mrb_value
+hpc_ary_uref(mrb_value a, mrb_int i)
+{
+  return RARRAY_PTR(a)[i];
+}
+
+static inline mrb_value
+hpc_ary_vref(mrb_value a, mrb_int i)
+{
+  if (i >= 0 && i < RARRAY_LEN(a))
+    return RARRAY_PTR(a)[i];
+  return hpc_ary_aget_1(1, a, mrb_fixnum_value(i));
+}
+
+/*
+  Unboxed elements (see NATIVE_AREF in codegen.c)
+    hpc_ary_fref/fset: an Array checked to have Floats (see typing_doall)
+    hpc_fary_ref/set, hpc_iary_ref/set: FloatArray and IntArray
+  Indexes out of the vectors go to the methods, which raise IndexError.
+ */
+
+static inline mrb_float
+hpc_ary_fref(mrb_value a, mrb_int i)
+{
+  return mrb_float(RARRAY_PTR(a)[i]);
+}
+
+static inline mrb_float
+hpc_ary_fset(mrb_value a, mrb_int i, mrb_float v)
+{
+  RARRAY_PTR(a)[i] = mrb_float_value(v);
+  return v;
+}
+
+static inline mrb_float
+hpc_fary_ref(mrb_value a, mrb_int i)
+{
+  struct RNumArray *v = RNUMARY(a);
+  if (v && i >= 0 && i < v->len)
+    return ((mrb_float *)v->ptr)[i];
+  return mrb_float(hpc_numary_aref(a, i));
+}
+
+static inline mrb_float
+hpc_fary_set(mrb_value a, mrb_int i, mrb_float f)
+{
+  struct RNumArray *v = RNUMARY(a);
+  if (v && i >= 0 && i < v->len)
+    ((mrb_float *)v->ptr)[i] = f;
+  else
+    hpc_numary_aset(a, i, mrb_float_value(f));
+  return f;
+}
+
+static inline mrb_int
+hpc_iary_ref(mrb_value a, mrb_int i)
+{
+  struct RNumArray *v = RNUMARY(a);
+  if (v && i >= 0 && i < v->len)
+    return ((mrb_int *)v->ptr)[i];
+  return mrb_fixnum(hpc_numary_aref(a, i));
+}
+
+static inline mrb_int
+hpc_iary_set(mrb_value a, mrb_int i, mrb_int n)
+{
+  struct RNumArray *v = RNUMARY(a);
+  if (v && i >= 0 && i < v->len)
+    ((mrb_int *)v->ptr)[i] = n;
+  else
+    hpc_numary_aset(a, i, mrb_fixnum_value(n));
+  return n;
+}
+
+/* a boxed field assigned where the value is used */
+static inline mrb_value
+hpc_field_set(mrb_state *mrb, struct RBasic *obj, mrb_value *field, mrb_value v)
+{
+  *field = v;
+  mrb_field_write_barrier_value(mrb, obj, v);
+  return v;
+}
+
+/*
+  Shadow frames of the boxed locals of a compiled function, which the
+  GC marks as roots.  A frame lives in the C block declaring its
+  locals, and is popped before leaving the block.
+ */
+#define HPC_FRAME_PUSH(f, roots) \
+  mrb_shadow_frame f = { mrb->shadow_frames, sizeof(roots) / sizeof((roots)[0]), (roots) }; \
+  mrb->shadow_frames = &f
+
+#define HPC_FRAME_POP(f) (mrb->shadow_frames = (f).prev)
+
+#endif  /* HPCMRB_BUILTIN_H */
@@ -5,28 +5,105 @@
 #include "mruby/compile.h"
 #include "mruby/dump.h"
 #include "mruby/variable.h"
+#include <setjmp.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 extern void compiled_main(mrb_value, mrb_state *);
 extern void init_global_syms(mrb_state *);
+extern void hpc_output_open(void);
+extern void hpc_output_write(const char *, size_t);
+extern void hpc_output_close(void);
 
 mrb_state *mrb;
 
-FILE *debug_fp = NULL;
+/* the frames of the VM methods, as showcallinfo of mruby */
+static void
+report_callinfo(mrb_state *mrb)
+{
+  mrb_value idx = mrb_obj_iv_get(mrb, mrb->exc, mrb_intern(mrb, "ciidx"));
+  mrb_callinfo *ci;
+  mrb_int ciidx;
+  const char *method, *sep, *cn;
+  char buf[256];
+  int i, line, n;
+
+  hpc_output_write("trace:\n", 7);
+  if (!mrb_fixnum_p(idx))
+    return;                     /* raised by the compiled code */
+  ciidx = mrb_fixnum(idx);
+  if (ciidx >= mrb->ciend - mrb->cibase)
+    ciidx = 10;
+  for (i = ciidx; i >= 0; i--) {
+    mrb_irep *irep;
+    mrb_code *pc;
+
+    ci = &mrb->cibase[i];
+    if (!ci->proc || MRB_PROC_CFUNC_P(ci->proc))
+      continue;
+    irep = ci->proc->body.irep;
+    if (!irep->lines)
+      continue;
+    if (i + 1 <= ciidx)
+      pc = mrb->cibase[i+1].pc;
+    else
+      pc = (mrb_code*)mrb_voidp(mrb_obj_iv_get(mrb, mrb->exc, mrb_intern(mrb, "lastpc")));
+    if (!(irep->iseq <= pc && pc < irep->iseq + irep->ilen))
+      continue;
+    line = irep->lines[pc - irep->iseq - 1];
+    sep = ci->target_class == ci->proc->target_class ? "." : "#";
+    method = mrb_sym2name(mrb, ci->mid);
+    cn = method ? mrb_class_name(mrb, ci->proc->target_class) : NULL;
+    if (!method)
+      n = snprintf(buf, sizeof(buf), "\t[%d] %s:%d\n", i, irep->filename ? irep->filename : "(unknown)", line);
+    else if (cn)
+      n = snprintf(buf, sizeof(buf), "\t[%d] %s:%d:in %s%s%s\n", i,
+                   irep->filename ? irep->filename : "(unknown)", line, cn, sep, method);
+    else
+      n = snprintf(buf, sizeof(buf), "\t[%d] %s:%d:in %s\n", i,
+                   irep->filename ? irep->filename : "(unknown)", line, method);
+    hpc_output_write(buf, n < (int)sizeof(buf) ? n : (int)sizeof(buf) - 1);
+  }
+}
+
+/* like mruby, report an exception nothing rescued and fail */
+static void
+report_exception(mrb_state *mrb)
+{
+  mrb_value s;
+
+  report_callinfo(mrb);
+  s = mrb_inspect(mrb, mrb_obj_value(mrb->exc));
+  hpc_output_write(RSTRING_PTR(s), RSTRING_LEN(s));
+  hpc_output_write("\n", 1);
+}
+
 int
 main(int argc, char **argv)
 {
+  jmp_buf top_jmp;
+  int n = 0;
+
   mrb = mrb_open();
-  debug_fp = fopen("result.ppm", "w");
+  hpc_output_open();
 
-  init_global_syms(mrb);
-  compiled_main(mrb_top_self(mrb), mrb);
+  /* an exception raised by a VM method or the runtime unwinds to here
+     instead of returning to compiled code as a value */
+  if (setjmp(top_jmp) == 0) {
+    mrb->jmp = &top_jmp;
+    init_global_syms(mrb);
+    compiled_main(mrb_top_self(mrb), mrb);
+  }
+  else {
+    n = -1;
+  }
+  mrb->jmp = 0;
+  if (n < 0 && mrb->exc)
+    report_exception(mrb);
 
-  fclose(debug_fp);
+  hpc_output_close();
   mrb_close(mrb);
 
-  return 0;
-  /* return n == 0 ? EXIT_SUCCESS : EXIT_FAILURE; */
+  return n == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
 }
@@ -3,6 +3,7 @@
 #include "mruby/class.h"
 #include "mruby/khash.h"
 #include "mruby/proc.h"
+#include "mruby/string.h"
 #include "mruby/variable.h"
 
 /* Abstrac interpreters for builtin methods. */
@@ -23,6 +24,46 @@ prim_printstr(mrb_state *mrb, mrb_value self)
   return argv;
 }
 
+#define PRIM_ARGC_MAX 4
+
+/* call the method itself if the receiver and args are constants,
+   otherwise return lat */
+static mrb_value
+prim_fold(mrb_state *mrb, mrb_value self, mrb_value lat)
+{
+  mrb_value *argv, args[PRIM_ARGC_MAX];
+  mrb_sym mid = mrb->ci->mid;
+  int i, argc;
+
+  mrb_get_args(mrb, "*", &argv, &argc);
+  if (argc > PRIM_ARGC_MAX || !hpc_lat_const_p(mrb, self))
+    return lat;
+  for (i = 0; i < argc; i++) {
+    if (!hpc_lat_const_p(mrb, argv[i]))
+      return lat;
+    args[i] = argv[i];
+  }
+  return mrb_funcall_argv(mrb, self, mid, argc, args);
+}
+
+static mrb_value
+prim_float(mrb_state *mrb, mrb_value self)
+{
+  return prim_fold(mrb, self, hpc_lat_set_of(mrb, mrb_float_value(0.0)));
+}
+
+static mrb_value
+prim_fixnum(mrb_state *mrb, mrb_value self)
+{
+  return prim_fold(mrb, self, hpc_lat_set_of(mrb, mrb_fixnum_value(0)));
+}
+
+static mrb_value
+prim_string(mrb_state *mrb, mrb_value self)
+{
+  return prim_fold(mrb, self, hpc_lat_set_of(mrb, mrb_str_new(mrb, 0, 0)));
+}
+
 static void
 add_interp_id(mrb_state *mrb, struct RClass *c, mrb_sym mid, mrb_func_t func, mrb_aspec aspec)
 {
@@ -57,10 +98,40 @@ add_interp(mrb_state *mrb, struct RClass *c, const char *name, mrb_func_t func,
   add_interp_id(mrb, c, mrb_intern(mrb, name), func, aspec);
 }
 
+static void
+add_math_interps(mrb_state *mrb)
+{
+  static const char *const float_funcs[] = {
+    "sin", "cos", "tan", "asin", "acos", "atan", "atan2", "sinh", "cosh", "tanh",
+    "exp", "log", "log2", "log10", "sqrt", "cbrt", "hypot", NULL
+  };
+  const char *const *name;
+  struct RClass *math;
+  mrb_sym sym = mrb_intern(mrb, "Math");
+
+  if (!mrb_const_defined(mrb, mrb_obj_value(mrb->object_class), sym))
+    return;
+  /* module functions are singleton methods */
+  math = mrb_class(mrb, mrb_const_get(mrb, mrb_obj_value(mrb->object_class), sym));
+  for (name = float_funcs; *name; name++)
+    add_interp(mrb, math, *name, prim_float, ARGS_ANY());
+}
+
 void
 init_prim_interpreters(hpc_state *p)
 {
   mrb_state *mrb = p->mrb;
   interp_tbl = kh_init(interp, mrb);
   add_interp(mrb, mrb->kernel_module, "__printstr__", prim_printstr, ARGS_REQ(1));
+
+  add_interp(mrb, mrb->fixnum_class, "to_f", prim_float, ARGS_NONE());
+  add_interp(mrb, mrb->float_class, "to_f", prim_float, ARGS_NONE());
+  add_interp(mrb, mrb->fixnum_class, "to_i", prim_fixnum, ARGS_NONE());
+  add_interp(mrb, mrb->float_class, "to_i", prim_fixnum, ARGS_NONE());
+  add_interp(mrb, mrb->fixnum_class, "to_s", prim_string, ARGS_NONE());
+  add_interp(mrb, mrb->float_class, "to_s", prim_string, ARGS_NONE());
+  /* mruby-numeric-ext */
+  if (mrb_obj_respond_to(mrb->fixnum_class, mrb_intern(mrb, "chr")))
+    add_interp(mrb, mrb->fixnum_class, "chr", prim_string, ARGS_NONE());
+  add_math_interps(mrb);
 }
@@ -8,6 +8,11 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#ifdef ENABLE_TYPE_PROFILE
+#include "mruby/class.h"
+#include "mruby/khash.h"
+#include "opcode.h"
+#endif
 
 #ifndef ENABLE_STDIO
 static void
@@ -27,6 +32,7 @@ void mrb_show_copyright(mrb_state *);
 struct _args {
   FILE *rfp;
   char* cmdline;
+  char* profile;
   mrb_bool fname        : 1;
   mrb_bool mrbfile      : 1;
   mrb_bool check_syntax : 1;
@@ -45,6 +51,9 @@ usage(const char *name)
   "-e 'command' one line of script",
   "-v           print version number, then run in verbose mode",
   "--verbose    run in verbose mode",
+#ifdef ENABLE_TYPE_PROFILE
+  "--profile=file record types of args and ivars for hpcmrb",
+#endif
   "--version    print the version",
   "--copyright  print the copyright",
   NULL
@@ -125,6 +134,12 @@ append_cmdline:
         mrb_show_copyright(mrb);
         exit(EXIT_SUCCESS);
       }
+#ifdef ENABLE_TYPE_PROFILE
+      else if (strncmp((*argv) + 2, "profile=", 8) == 0) {
+        args->profile = (*argv) + 10;
+        break;
+      }
+#endif
     default:
       return EXIT_FAILURE;
     }
@@ -162,6 +177,150 @@ cleanup(mrb_state *mrb, struct _args *args)
   mrb_close(mrb);
 }
 
+#ifdef ENABLE_TYPE_PROFILE
+/*
+  Type profile
+
+  --profile=file records the classes of the args of methods and of the
+  values assigned to ivars.  hpcmrb -p file seeds its typing with them.
+  Each line of the file is one of
+    param Class method index ValueClass
+    sparam Class method index ValueClass   (singleton methods)
+    ivar Class @name ValueClass
+  Methods defined at the toplevel are of Object.
+ */
+enum prof_kind {
+  PROF_PARAM,
+  PROF_SPARAM,
+  PROF_IVAR,
+};
+
+struct prof_key {
+  enum prof_kind kind;
+  struct RClass *klass;
+  mrb_sym name;
+  int index;
+  struct RClass *vclass;
+};
+
+#define prof_hash_func(mrb,k) (khint_t)((intptr_t)(k).klass ^ (k).name << 7 ^ (k).index << 3 ^ (k).kind ^ (intptr_t)(k).vclass >> 3)
+#define prof_hash_equal(mrb,a,b) ((a).kind == (b).kind && (a).klass == (b).klass && \
+                                  (a).name == (b).name && (a).index == (b).index && \
+                                  (a).vclass == (b).vclass)
+KHASH_DECLARE(prof, struct prof_key, char, 0)
+KHASH_DEFINE(prof, struct prof_key, char, 0, prof_hash_func, prof_hash_equal)
+
+static kh_prof_t *profile;
+
+static void
+profile_add(enum prof_kind kind, struct RClass *klass, mrb_sym name, int index, struct RClass *vclass)
+{
+  struct prof_key key;
+
+  key.kind = kind;
+  key.klass = klass;
+  key.name = name;
+  key.index = index;
+  key.vclass = vclass;
+  kh_put(prof, profile, key);
+}
+
+static void
+profile_hook(mrb_state *mrb, mrb_irep *irep, mrb_code *pc, mrb_value *regs)
+{
+  mrb_code i = *pc;
+
+  switch (GET_OPCODE(i)) {
+  case OP_ENTER:
+    {
+      struct RProc *proc = mrb->ci->proc;
+      struct RClass *klass;
+      enum prof_kind kind = PROF_PARAM;
+      int32_t ax = GETARG_Ax(i);
+      int n = ((ax>>18)&0x1f) + ((ax>>13)&0x1f); /* m1 + o */
+      int k;
+
+      /* blocks have the env of the method */
+      if (!proc || !MRB_PROC_STRICT_P(proc) || proc->env || mrb->ci->argc < 0)
+        return;
+      klass = mrb->ci->target_class;
+      if (klass->tt == MRB_TT_SCLASS) {
+        mrb_value v = mrb_obj_iv_get(mrb, (struct RObject*)klass, mrb_intern2(mrb, "__attached__", 12));
+        if (mrb_type(v) != MRB_TT_CLASS)
+          return;
+        klass = mrb_class_ptr(v);
+        kind = PROF_SPARAM;
+      }
+      if (mrb->ci->argc < n)
+        n = mrb->ci->argc;
+      for (k = 0; k < n; k++)
+        profile_add(kind, klass, mrb->ci->mid, k, mrb_obj_class(mrb, regs[k+1]));
+    }
+    break;
+  case OP_SETIV:
+    if (mrb_type(regs[0]) == MRB_TT_OBJECT)
+      profile_add(PROF_IVAR, mrb_obj_class(mrb, regs[0]), irep->syms[GETARG_Bx(i)], 0,
+                  mrb_obj_class(mrb, regs[GETARG_A(i)]));
+    break;
+  default:
+    break;
+  }
+}
+
+static int
+profile_line_cmp(const void *a, const void *b)
+{
+  return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+/* the name of klass; anonymous classes would be named by their address */
+static const char *
+profile_class_name(mrb_state *mrb, struct RClass *klass)
+{
+  if (!klass || mrb_nil_p(mrb_class_path(mrb, klass)))
+    return "(anonymous)";
+  return mrb_class_name(mrb, klass);
+}
+
+static void
+profile_write(mrb_state *mrb, const char *path)
+{
+  static const char *const kinds[] = { "param", "sparam", "ivar" };
+  FILE *fp = fopen(path, "w");
+  char **lines;
+  khint_t k;
+  size_t n = 0, j;
+
+  if (!fp) {
+    fprintf(stderr, "cannot open profile: %s\n", path);
+    return;
+  }
+  lines = (char **)mrb_malloc(mrb, sizeof(char *) * (kh_size(profile) + 1));
+  for (k = kh_begin(profile); k != kh_end(profile); k++) {
+    struct prof_key key;
+    char buf[1024];
+
+    if (!kh_exist(profile, k)) continue;
+    key = kh_key(profile, k);
+    if (key.kind == PROF_IVAR)
+      snprintf(buf, sizeof(buf), "%s %s %s %s\n", kinds[key.kind], profile_class_name(mrb, key.klass),
+               mrb_sym2name(mrb, key.name), profile_class_name(mrb, key.vclass));
+    else
+      snprintf(buf, sizeof(buf), "%s %s %s %d %s\n", kinds[key.kind], profile_class_name(mrb, key.klass),
+               mrb_sym2name(mrb, key.name), key.index, profile_class_name(mrb, key.vclass));
+    lines[n] = (char *)mrb_malloc(mrb, strlen(buf) + 1);
+    strcpy(lines[n++], buf);
+  }
+  qsort(lines, n, sizeof(char *), profile_line_cmp);
+  for (j = 0; j < n; j++) {
+    fputs(lines[j], fp);
+    mrb_free(mrb, lines[j]);
+  }
+  mrb_free(mrb, lines);
+  fclose(fp);
+}
+#endif
+
 static void
 showcallinfo(mrb_state *mrb)
 {
@@ -250,6 +409,12 @@ main(int argc, char **argv)
     mrb_ary_push(mrb, ARGV, mrb_str_new(mrb, args.argv[i], strlen(args.argv[i])));
   }
   mrb_define_global_const(mrb, "ARGV", ARGV);
+#ifdef ENABLE_TYPE_PROFILE
+  if (args.profile) {
+    profile = kh_init(prof, mrb);
+    mrb->type_profile_hook = profile_hook;
+  }
+#endif
 
   if (args.mrbfile) {
     n = mrb_read_irep_file(mrb, args.rfp);
@@ -301,6 +466,13 @@ main(int argc, char **argv)
       printf("Syntax OK\n");
     }
   }
+#ifdef ENABLE_TYPE_PROFILE
+  if (args.profile) {
+    mrb->type_profile_hook = NULL;
+    profile_write(mrb, args.profile);
+    kh_destroy(prof, profile);
+  }
+#endif
   cleanup(mrb, &args);
 
   return n == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
@@ -0,0 +1,42 @@
+/*
+** mruby/numeric_array.h - FloatArray and IntArray classes
+**
+** See Copyright Notice in mruby.h
+*/
+
+#ifndef MRUBY_NUMERIC_ARRAY_H
+#define MRUBY_NUMERIC_ARRAY_H 1
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "mruby/data.h"
+
+/* fixed-length vector of unboxed numbers */
+struct RNumArray {
+  mrb_int len;
+  void *ptr;            /* mrb_float[len] or mrb_int[len] */
+};
+
+extern const mrb_data_type mrb_float_array_type;
+extern const mrb_data_type mrb_int_array_type;
+
+#define RNUMARY(v)        ((struct RNumArray *)DATA_PTR(v))
+#define NUMARY_LEN(v)     (RNUMARY(v)->len)
+#define FARY_PTR(v)       ((mrb_float *)RNUMARY(v)->ptr)
+#define IARY_PTR(v)       ((mrb_int *)RNUMARY(v)->ptr)
+
+mrb_value mrb_float_array_new(mrb_state *mrb, mrb_int len);
+mrb_value mrb_int_array_new(mrb_state *mrb, mrb_int len);
+
+/* kernels of the bulk operations */
+mrb_float mrb_float_array_sum(const mrb_float *x, mrb_int n);
+mrb_float mrb_float_array_dot(const mrb_float *x, const mrb_float *y, mrb_int n);
+void mrb_float_array_axpy(mrb_float *y, mrb_float a, const mrb_float *x, mrb_int n);
+
+#if defined(__cplusplus)
+}  /* extern "C" { */
+#endif
+
+#endif  /* MRUBY_NUMERIC_ARRAY_H */
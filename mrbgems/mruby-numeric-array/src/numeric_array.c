@@ -0,0 +1,465 @@
+/*
+** numeric_array.c - FloatArray and IntArray classes
+**
+** See Copyright Notice in mruby.h
+*/
+
+#include "mruby.h"
+#include "mruby/array.h"
+#include "mruby/class.h"
+#include "mruby/data.h"
+#include "mruby/numeric.h"
+#include "mruby/variable.h"
+#include "mruby/numeric_array.h"
+#include <stdint.h>
+#include <string.h>
+
+/*
+  Fixed-length vectors of Floats or Fixnums stored unboxed in a
+  contiguous buffer.  The bulk operations are written as plain loops
+  over restrict pointers so that the C compiler vectorizes them.
+ */
+
+static void
+numary_free(mrb_state *mrb, void *p)
+{
+  struct RNumArray *a = (struct RNumArray *)p;
+
+  mrb_free(mrb, a->ptr);
+  mrb_free(mrb, a);
+}
+
+const mrb_data_type mrb_float_array_type = { "FloatArray", numary_free };
+const mrb_data_type mrb_int_array_type = { "IntArray", numary_free };
+
+#define FLOAT_ARRAY_P(v) (DATA_TYPE(v) == &mrb_float_array_type)
+
+static size_t
+elem_size(const mrb_data_type *type)
+{
+  return type == &mrb_float_array_type ? sizeof(mrb_float) : sizeof(mrb_int);
+}
+
+static struct RNumArray*
+numary_alloc(mrb_state *mrb, const mrb_data_type *type, mrb_int len)
+{
+  struct RNumArray *a;
+
+  if (len < 0)
+    mrb_raise(mrb, E_ARGUMENT_ERROR, "negative array size");
+  a = (struct RNumArray *)mrb_malloc(mrb, sizeof(struct RNumArray));
+  a->len = len;
+  a->ptr = mrb_malloc(mrb, len > 0 ? elem_size(type) * len : 1);
+  return a;
+}
+
+static struct RNumArray*
+numary_get(mrb_state *mrb, mrb_value self)
+{
+  struct RNumArray *a = (struct RNumArray *)DATA_PTR(self);
+
+  if (!a)
+    mrb_raise(mrb, E_ARGUMENT_ERROR, "uninitialized array");
+  return a;
+}
+
+/* another vector of the same class and length as self */
+static struct RNumArray*
+numary_other(mrb_state *mrb, mrb_value self, mrb_value other)
+{
+  struct RNumArray *a = numary_get(mrb, self), *b;
+
+  if (mrb_type(other) != MRB_TT_DATA || DATA_TYPE(other) != DATA_TYPE(self))
+    mrb_raise(mrb, E_TYPE_ERROR, "expected an array of the same class");
+  b = numary_get(mrb, other);
+  if (a->len != b->len)
+    mrb_raise(mrb, E_ARGUMENT_ERROR, "length mismatch");
+  return b;
+}
+
+static mrb_value
+numary_new(mrb_state *mrb, const char *name, const mrb_data_type *type, mrb_int len)
+{
+  struct RClass *c = mrb_class_get(mrb, name);
+
+  return mrb_obj_value(Data_Wrap_Struct(mrb, c, type, numary_alloc(mrb, type, len)));
+}
+
+mrb_value
+mrb_float_array_new(mrb_state *mrb, mrb_int len)
+{
+  mrb_value v = numary_new(mrb, "FloatArray", &mrb_float_array_type, len);
+
+  memset(FARY_PTR(v), 0, sizeof(mrb_float) * len);
+  return v;
+}
+
+mrb_value
+mrb_int_array_new(mrb_state *mrb, mrb_int len)
+{
+  mrb_value v = numary_new(mrb, "IntArray", &mrb_int_array_type, len);
+
+  memset(IARY_PTR(v), 0, sizeof(mrb_int) * len);
+  return v;
+}
+
+/* kernels */
+
+mrb_float
+mrb_float_array_sum(const mrb_float *x, mrb_int n)
+{
+  mrb_float s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+  mrb_int i;
+
+  /* independent partial sums for the vector lanes */
+  for (i = 0; i + 4 <= n; i += 4) {
+    s0 += x[i];
+    s1 += x[i+1];
+    s2 += x[i+2];
+    s3 += x[i+3];
+  }
+  for (; i < n; i++)
+    s0 += x[i];
+  return (s0 + s1) + (s2 + s3);
+}
+
+mrb_float
+mrb_float_array_dot(const mrb_float *x, const mrb_float *y, mrb_int n)
+{
+  mrb_float s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+  mrb_int i;
+
+  for (i = 0; i + 4 <= n; i += 4) {
+    s0 += x[i] * y[i];
+    s1 += x[i+1] * y[i+1];
+    s2 += x[i+2] * y[i+2];
+    s3 += x[i+3] * y[i+3];
+  }
+  for (; i < n; i++)
+    s0 += x[i] * y[i];
+  return (s0 + s1) + (s2 + s3);
+}
+
+void
+mrb_float_array_axpy(mrb_float *y, mrb_float a, const mrb_float *x, mrb_int n)
+{
+  mrb_int i;
+
+  if (x == y) {
+    for (i = 0; i < n; i++)
+      y[i] += a * y[i];
+    return;
+  }
+  {
+    mrb_float *restrict yr = y;
+    const mrb_float *restrict xr = x;
+    for (i = 0; i < n; i++)
+      yr[i] += a * xr[i];
+  }
+}
+
+/* methods */
+
+static mrb_value
+numary_init(mrb_state *mrb, mrb_value self, const mrb_data_type *type)
+{
+  struct RNumArray *a = (struct RNumArray *)DATA_PTR(self);
+  mrb_int len, i;
+  mrb_value init = mrb_fixnum_value(0);
+
+  mrb_get_args(mrb, "i|o", &len, &init);
+  if (a)
+    numary_free(mrb, a);
+  DATA_TYPE(self) = type;
+  DATA_PTR(self) = NULL;
+  a = numary_alloc(mrb, type, len);
+  DATA_PTR(self) = a;
+  if (type == &mrb_float_array_type) {
+    mrb_float f = mrb_float(mrb_Float(mrb, init));
+    mrb_float *p = (mrb_float *)a->ptr;
+    for (i = 0; i < len; i++)
+      p[i] = f;
+  }
+  else {
+    mrb_int n = mrb_fixnum(mrb_Integer(mrb, init));
+    mrb_int *p = (mrb_int *)a->ptr;
+    for (i = 0; i < len; i++)
+      p[i] = n;
+  }
+  return self;
+}
+
+/*
+ *  call-seq:
+ *     FloatArray.new(size, init=0.0)   -> float_array
+ *
+ *  Returns a vector of <i>size</i> Floats, each set to <i>init</i>.
+ */
+static mrb_value
+float_ary_initialize(mrb_state *mrb, mrb_value self)
+{
+  return numary_init(mrb, self, &mrb_float_array_type);
+}
+
+/*
+ *  call-seq:
+ *     IntArray.new(size, init=0)   -> int_array
+ *
+ *  Returns a vector of <i>size</i> Fixnums, each set to <i>init</i>.
+ */
+static mrb_value
+int_ary_initialize(mrb_state *mrb, mrb_value self)
+{
+  return numary_init(mrb, self, &mrb_int_array_type);
+}
+
+static mrb_value
+numary_initialize_copy(mrb_state *mrb, mrb_value copy)
+{
+  mrb_value src;
+  struct RNumArray *a, *b;
+
+  mrb_get_args(mrb, "o", &src);
+  if (mrb_obj_equal(mrb, copy, src))
+    return copy;
+  if (mrb_type(src) != MRB_TT_DATA || !DATA_TYPE(src) ||
+      mrb_obj_class(mrb, src) != mrb_obj_class(mrb, copy))
+    mrb_raise(mrb, E_TYPE_ERROR, "wrong argument class");
+  b = numary_get(mrb, src);
+  a = (struct RNumArray *)DATA_PTR(copy);
+  if (a)
+    numary_free(mrb, a);
+  DATA_TYPE(copy) = DATA_TYPE(src);
+  DATA_PTR(copy) = NULL;
+  a = numary_alloc(mrb, DATA_TYPE(src), b->len);
+  memcpy(a->ptr, b->ptr, elem_size(DATA_TYPE(src)) * b->len);
+  DATA_PTR(copy) = a;
+  return copy;
+}
+
+/* index into the vector; negative counts from the end */
+static mrb_int
+numary_index(mrb_state *mrb, struct RNumArray *a, mrb_int i)
+{
+  mrb_int j = i < 0 ? i + a->len : i;
+
+  if (j < 0 || j >= a->len)
+    mrb_raisef(mrb, E_INDEX_ERROR, "index %S out of array", mrb_fixnum_value(i));
+  return j;
+}
+
+static mrb_value
+numary_aget(mrb_state *mrb, mrb_value self)
+{
+  struct RNumArray *a = numary_get(mrb, self);
+  mrb_int i;
+
+  mrb_get_args(mrb, "i", &i);
+  i = numary_index(mrb, a, i);
+  if (FLOAT_ARRAY_P(self))
+    return mrb_float_value(((mrb_float *)a->ptr)[i]);
+  return mrb_fixnum_value(((mrb_int *)a->ptr)[i]);
+}
+
+static mrb_value
+numary_aset(mrb_state *mrb, mrb_value self)
+{
+  struct RNumArray *a = numary_get(mrb, self);
+  mrb_int i;
+  mrb_value v;
+
+  mrb_get_args(mrb, "io", &i, &v);
+  i = numary_index(mrb, a, i);
+  if (FLOAT_ARRAY_P(self))
+    ((mrb_float *)a->ptr)[i] = mrb_float(mrb_Float(mrb, v));
+  else
+    ((mrb_int *)a->ptr)[i] = mrb_fixnum(mrb_Integer(mrb, v));
+  return v;
+}
+
+static mrb_value
+numary_size(mrb_state *mrb, mrb_value self)
+{
+  return mrb_fixnum_value(numary_get(mrb, self)->len);
+}
+
+static mrb_value
+numary_to_a(mrb_state *mrb, mrb_value self)
+{
+  struct RNumArray *a = numary_get(mrb, self);
+  mrb_value ary = mrb_ary_new_capa(mrb, a->len);
+  mrb_int i;
+
+  for (i = 0; i < a->len; i++) {
+    if (FLOAT_ARRAY_P(self))
+      mrb_ary_push(mrb, ary, mrb_float_value(((mrb_float *)a->ptr)[i]));
+    else
+      mrb_ary_push(mrb, ary, mrb_fixnum_value(((mrb_int *)a->ptr)[i]));
+  }
+  return ary;
+}
+
+static mrb_value
+numary_each(mrb_state *mrb, mrb_value self)
+{
+  struct RNumArray *a;
+  mrb_value blk;
+  mrb_int i;
+
+  mrb_get_args(mrb, "&", &blk);
+  /* the block may replace the buffer by initialize */
+  for (i = 0; i < (a = numary_get(mrb, self))->len; i++) {
+    if (FLOAT_ARRAY_P(self))
+      mrb_yield(mrb, blk, mrb_float_value(((mrb_float *)a->ptr)[i]));
+    else
+      mrb_yield(mrb, blk, mrb_fixnum_value(((mrb_int *)a->ptr)[i]));
+  }
+  return self;
+}
+
+/*
+ *  call-seq:
+ *     ary.map! {|x| block }   -> ary
+ *
+ *  Replaces each element with the value of the block.
+ */
+static mrb_value
+numary_map_bang(mrb_state *mrb, mrb_value self)
+{
+  struct RNumArray *a;
+  mrb_value blk, v;
+  mrb_int i;
+
+  mrb_get_args(mrb, "&", &blk);
+  for (i = 0; i < (a = numary_get(mrb, self))->len; i++) {
+    if (FLOAT_ARRAY_P(self)) {
+      v = mrb_yield(mrb, blk, mrb_float_value(((mrb_float *)a->ptr)[i]));
+      a = numary_get(mrb, self);
+      if (i < a->len)
+        ((mrb_float *)a->ptr)[i] = mrb_float(mrb_Float(mrb, v));
+    }
+    else {
+      v = mrb_yield(mrb, blk, mrb_fixnum_value(((mrb_int *)a->ptr)[i]));
+      a = numary_get(mrb, self);
+      if (i < a->len)
+        ((mrb_int *)a->ptr)[i] = mrb_fixnum(mrb_Integer(mrb, v));
+    }
+  }
+  return self;
+}
+
+static mrb_value
+float_ary_sum(mrb_state *mrb, mrb_value self)
+{
+  struct RNumArray *a = numary_get(mrb, self);
+
+  return mrb_float_value(mrb_float_array_sum((mrb_float *)a->ptr, a->len));
+}
+
+/* exact sum in 64 bits, a Float if it does not fit in a Fixnum */
+static mrb_value
+int_ary_sum(mrb_state *mrb, mrb_value self)
+{
+  struct RNumArray *a = numary_get(mrb, self);
+  const mrb_int *x = (const mrb_int *)a->ptr;
+  int64_t s = 0;
+  mrb_int i;
+
+  if (sizeof(mrb_int) < sizeof(int64_t)) {
+    for (i = 0; i < a->len; i++)
+      s += x[i];
+    if (FIXABLE(s))
+      return mrb_fixnum_value((mrb_int)s);
+    return mrb_float_value((mrb_float)s);
+  }
+  else {
+    mrb_float f = 0.0;
+    for (i = 0; i < a->len; i++) {
+      if (x[i] > 0 ? s > INT64_MAX - x[i] : s < INT64_MIN - x[i])
+        break;
+      s += x[i];
+    }
+    if (i == a->len)
+      return mrb_fixnum_value((mrb_int)s);
+    for (f = (mrb_float)s; i < a->len; i++)
+      f += (mrb_float)x[i];
+    return mrb_float_value(f);
+  }
+}
+
+/*
+ *  call-seq:
+ *     x.dot(y)   -> float
+ *
+ *  Returns the inner product of the vectors.
+ */
+static mrb_value
+float_ary_dot(mrb_state *mrb, mrb_value self)
+{
+  struct RNumArray *a = numary_get(mrb, self), *b;
+  mrb_value other;
+
+  mrb_get_args(mrb, "o", &other);
+  b = numary_other(mrb, self, other);
+  return mrb_float_value(mrb_float_array_dot((mrb_float *)a->ptr, (mrb_float *)b->ptr, a->len));
+}
+
+/*
+ *  call-seq:
+ *     y.axpy(a, x)   -> y
+ *
+ *  y[i] += a * x[i] for each i.
+ */
+static mrb_value
+float_ary_axpy(mrb_state *mrb, mrb_value self)
+{
+  struct RNumArray *y = numary_get(mrb, self), *x;
+  mrb_float a;
+  mrb_value other;
+
+  mrb_get_args(mrb, "fo", &a, &other);
+  x = numary_other(mrb, self, other);
+  mrb_float_array_axpy((mrb_float *)y->ptr, a, (mrb_float *)x->ptr, y->len);
+  return self;
+}
+
+static void
+define_numary_methods(mrb_state *mrb, struct RClass *c)
+{
+  mrb_value enumerable = mrb_const_get(mrb, mrb_obj_value(mrb->object_class), mrb_intern(mrb, "Enumerable"));
+
+  mrb_include_module(mrb, c, mrb_class_ptr(enumerable));
+  mrb_define_method(mrb, c, "initialize_copy", numary_initialize_copy, ARGS_REQ(1));
+  mrb_define_method(mrb, c, "[]", numary_aget, ARGS_REQ(1));
+  mrb_define_method(mrb, c, "[]=", numary_aset, ARGS_REQ(2));
+  mrb_define_method(mrb, c, "length", numary_size, ARGS_NONE());
+  mrb_define_method(mrb, c, "size", numary_size, ARGS_NONE());
+  mrb_define_method(mrb, c, "to_a", numary_to_a, ARGS_NONE());
+  mrb_define_method(mrb, c, "each", numary_each, ARGS_BLOCK());
+  mrb_define_method(mrb, c, "map!", numary_map_bang, ARGS_BLOCK());
+}
+
+void
+mrb_mruby_numeric_array_gem_init(mrb_state* mrb)
+{
+  struct RClass *fa, *ia;
+
+  fa = mrb_define_class(mrb, "FloatArray", mrb->object_class);
+  MRB_SET_INSTANCE_TT(fa, MRB_TT_DATA);
+  define_numary_methods(mrb, fa);
+  mrb_define_method(mrb, fa, "initialize", float_ary_initialize, ARGS_REQ(1)|ARGS_OPT(1));
+  mrb_define_method(mrb, fa, "sum", float_ary_sum, ARGS_NONE());
+  mrb_define_method(mrb, fa, "dot", float_ary_dot, ARGS_REQ(1));
+  mrb_define_method(mrb, fa, "axpy", float_ary_axpy, ARGS_REQ(2));
+
+  ia = mrb_define_class(mrb, "IntArray", mrb->object_class);
+  MRB_SET_INSTANCE_TT(ia, MRB_TT_DATA);
+  define_numary_methods(mrb, ia);
+  mrb_define_method(mrb, ia, "initialize", int_ary_initialize, ARGS_REQ(1)|ARGS_OPT(1));
+  mrb_define_method(mrb, ia, "sum", int_ary_sum, ARGS_NONE());
+}
+
+void
+mrb_mruby_numeric_array_gem_final(mrb_state* mrb)
+{
+}
@@ -0,0 +1,72 @@
+##
+# FloatArray and IntArray Test
+
+assert('FloatArray.new') do
+  a = FloatArray.new(3)
+  b = FloatArray.new(2, 1)
+  a.size == 3 and a[0] == 0.0 and b.to_a == [1.0, 1.0]
+end
+
+assert('FloatArray#[]=') do
+  a = FloatArray.new(3)
+  a[0] = 1
+  a[-1] = 2.5
+  a.to_a == [1.0, 0.0, 2.5]
+end
+
+assert('FloatArray#[] out of range') do
+  e = nil
+  begin
+    FloatArray.new(2)[2]
+  rescue IndexError => e
+  end
+  e.class == IndexError
+end
+
+assert('FloatArray#sum') do
+  a = FloatArray.new(7)
+  7.times { |i| a[i] = i * 0.5 }
+  a.sum == 10.5
+end
+
+assert('FloatArray#dot') do
+  a = FloatArray.new(5, 2.0)
+  b = FloatArray.new(5, 3.0)
+  a.dot(b) == 30.0
+end
+
+assert('FloatArray#axpy') do
+  y = FloatArray.new(5, 1.0)
+  x = FloatArray.new(5, 2.0)
+  y.axpy(0.5, x)
+  y.axpy(1.0, y)
+  y.to_a == [4.0, 4.0, 4.0, 4.0, 4.0]
+end
+
+assert('FloatArray#map!') do
+  a = FloatArray.new(3, 2.0)
+  a.map! { |x| x * x }
+  a.to_a == [4.0, 4.0, 4.0]
+end
+
+assert('FloatArray#dup') do
+  a = FloatArray.new(2, 1.0)
+  b = a.dup
+  b[0] = 5.0
+  a[0] == 1.0 and b[0] == 5.0
+end
+
+assert('IntArray') do
+  a = IntArray.new(4, 3)
+  a[1] = 2.9
+  s = 0
+  a.each { |x| s += x }
+  a.to_a == [3, 2, 3, 3] and a.sum == 11 and s == 11
+end
+
+assert('IntArray is Enumerable') do
+  a = IntArray.new(3, 2)
+  t = 0
+  a.each_with_index { |x, i| t += x * i }
+  t == 6 and a.map { |x| x + 1 } == [3, 3, 3]
+end
@@ -409,7 +409,17 @@ gc_mark_children(mrb_state *mrb, struct RBasic *obj)
     /* fall through */
 
   case MRB_TT_OBJECT:
+    mrb_gc_mark_iv(mrb, (struct RObject*)obj);
+    break;
+
   case MRB_TT_DATA:
+    {
+      struct RData *d = (struct RData*)obj;
+
+      if (d->type && d->type->dmark && d->data) {
+        d->type->dmark(mrb, d->data);
+      }
+    }
     mrb_gc_mark_iv(mrb, (struct RObject*)obj);
     break;
 
@@ -555,6 +565,19 @@ obj_free(mrb_state *mrb, struct RBasic *obj)
   obj->tt = MRB_TT_FREE;
 }
 
+static void
+mark_shadow_frames(mrb_state *mrb)
+{
+  mrb_shadow_frame *f;
+  int i;
+
+  for (f = mrb->shadow_frames; f; f = f->prev) {
+    for (i=0; i<f->len; i++) {
+      mrb_gc_mark_value(mrb, *f->roots[i]);
+    }
+  }
+}
+
 static void
 root_scan_phase(mrb_state *mrb)
 {
@@ -573,6 +596,7 @@ root_scan_phase(mrb_state *mrb)
   for (i=0,e=mrb->arena_idx; i<e; i++) {
     mrb_gc_mark(mrb, mrb->arena[i]);
   }
+  mark_shadow_frames(mrb);
   /* mark class hierarchy */
   mrb_gc_mark(mrb, (struct RBasic*)mrb->object_class);
   /* mark top_self */
@@ -683,6 +707,8 @@ incremental_marking_phase(mrb_state *mrb, size_t limit)
 static void
 final_marking_phase(mrb_state *mrb)
 {
+  /* locals of C functions are assigned without write barriers */
+  mark_shadow_frames(mrb);
   while (mrb->gray_list) {
     if (is_gray(mrb->gray_list))
       gc_mark_children(mrb, mrb->gray_list);
@@ -298,12 +298,14 @@ mrb_funcall_with_block(mrb_state *mrb, mrb_value self, mrb_sym mid, int argc, mr
   if (!mrb->jmp) {
     jmp_buf c_jmp;
     mrb_callinfo *old_ci = mrb->ci;
+    mrb_shadow_frame *old_frames = mrb->shadow_frames;
 
     if (setjmp(c_jmp) != 0) { /* error */
       while (old_ci != mrb->ci) {
         mrb->stack = mrb->stbase + mrb->ci->stackidx;
         cipop(mrb);
       }
+      mrb->shadow_frames = old_frames;
       mrb->jmp = 0;
       val = mrb_obj_value(mrb->exc);
     }
@@ -385,12 +387,14 @@ mrb_proccall_with_block(mrb_state *mrb, mrb_value self, struct RProc *p, mrb_sym
   if (!mrb->jmp) {
     jmp_buf c_jmp;
     mrb_callinfo *old_ci = mrb->ci;
+    mrb_shadow_frame *old_frames = mrb->shadow_frames;
 
     if (setjmp(c_jmp) != 0) { /* error */
       while (old_ci != mrb->ci) {
         mrb->stack = mrb->stbase + mrb->ci->stackidx;
         cipop(mrb);
       }
+      mrb->shadow_frames = old_frames;
       mrb->jmp = 0;
       val = mrb_obj_value(mrb->exc);
     }
@@ -564,6 +568,12 @@ argnum_error(mrb_state *mrb, int num)
 #define CODE_FETCH_HOOK(mrb, irep, pc, regs)
 #endif
 
+#ifdef ENABLE_TYPE_PROFILE
+#define TYPE_PROFILE_HOOK(mrb, irep, pc, regs) ((mrb)->type_profile_hook ? (mrb)->type_profile_hook((mrb), (irep), (pc), (regs)) : (void)0)
+#else
+#define TYPE_PROFILE_HOOK(mrb, irep, pc, regs)
+#endif
+
 #ifdef __GNUC__
 #define DIRECT_THREADED
 #endif
@@ -605,6 +615,8 @@ mrb_run(mrb_state *mrb, struct RProc *proc, mrb_value self)
   int ai = mrb_gc_arena_save(mrb);
   jmp_buf *prev_jmp = (jmp_buf *)mrb->jmp;
   jmp_buf c_jmp;
+  mrb_shadow_frame *shadow_frames = mrb->shadow_frames;
+  ptrdiff_t ciidx = mrb->ci - mrb->cibase;
 
 #ifdef DIRECT_THREADED
   static void *optable[] = {
@@ -636,6 +648,8 @@ mrb_run(mrb_state *mrb, struct RProc *proc, mrb_value self)
     mrb->jmp = &c_jmp;
   }
   else {
+    /* frames of the C functions unwound by longjmp */
+    mrb->shadow_frames = shadow_frames;
     goto L_RAISE;
   }
   if (!mrb->stack) {
@@ -727,6 +741,7 @@ mrb_run(mrb_state *mrb, struct RProc *proc, mrb_value self)
 
     CASE(OP_SETIV) {
       /* ivset(Sym(B),R(A)) */
+      TYPE_PROFILE_HOOK(mrb, irep, pc, regs);
       mrb_vm_iv_set(mrb, syms[GETARG_Bx(i)], regs[GETARG_A(i)]);
       NEXT;
     }
@@ -1205,6 +1220,7 @@ mrb_run(mrb_state *mrb, struct RProc *proc, mrb_value self)
       int len = m1 + o + r + m2;
       mrb_value *blk = &argv[argc < 0 ? 1 : argc];
 
+      TYPE_PROFILE_HOOK(mrb, irep, pc, regs);
       if (argc < 0) {
         struct RArray *ary = mrb_ary_ptr(regs[1]);
         argv = ary->ptr;
@@ -1292,7 +1308,8 @@ mrb_run(mrb_state *mrb, struct RProc *proc, mrb_value self)
           cipop(mrb);
           ci = mrb->ci;
           mrb->stack = mrb->stbase + ci[1].stackidx;
-          if (ci[1].acc < 0 && prev_jmp) {
+          /* frames above ciidx were called by C functions unwound by longjmp */
+          if (ci[1].acc < 0 && prev_jmp && ci - mrb->cibase < ciidx) {
             mrb->jmp = prev_jmp;
             longjmp(*(jmp_buf*)mrb->jmp, 1);
           }